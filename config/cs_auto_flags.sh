@@ -857,6 +857,16 @@ if test "$?" = "0" ; then
         fcflags_default="$fcflags_default -fdiagnostics-color=auto"
        ;;
     esac
+    case "$cs_fc_version" in
+      [4-9].*)
+        ;;
+      *)
+        # gfortran 10 and above promote argument mismatches in legacy
+        # implicit interfaces to errors; keep them as warnings.
+        fcflags_default="`echo $fcflags_default | sed -e 's/ -pedantic-errors//'`"
+        fcflags_default="$fcflags_default -fallow-argument-mismatch"
+        ;;
+    esac
   fi
 
 fi
@@ -95,6 +95,16 @@ extern "C" {
 #define _EXCHANGE_SENDRECV       100  /* Sendrecv */
 #define _EXCHANGE_ISEND_IRECV    200  /* Isend/Irecv/Waitall */
 
+/*
+ * Refinement level of the Morton-ordered point octree used to select
+ * candidate points for each distant rank during location, and minimum
+ * candidate-search size (points x ranks) below which a simple scan
+ * is preferred.
+ */
+
+#define _OCTREE_LEVEL             10
+#define _OCTREE_THRESHOLD       4096
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -107,6 +117,57 @@ typedef struct {
 
 } _rank_intersects_t;
 
+#if defined(PLE_HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Structure defining a Morton-ordered linear octree indexing a point
+ * subset, used to select candidate points for distant rank extents
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int                  level;     /* Refinement level */
+  ple_lnum_t           n_points;  /* Number of indexed points */
+
+  unsigned long long  *code;      /* Morton code per point, sorted */
+  ple_lnum_t          *order;     /* Point subset index per sorted code */
+
+  double               s_min[3];  /* Scaling: minimum coordinates */
+  double               s_mult[3]; /* Scaling: multiplication factor
+                                     (grid cells per unit length) */
+
+} _point_octree_t;
+
+/*----------------------------------------------------------------------------
+ * Structure defining an in-progress asynchronous exchange, also caching
+ * the persistent communication setup between successive exchanges
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  int            persistent;    /* Persistent requests are set up */
+  int            in_progress;   /* Between begin and end calls */
+
+  int            reverse;       /* Reversed exchange */
+  size_t         stride;        /* Variable dimension */
+  size_t         size;          /* Associated datatype size */
+  MPI_Datatype   datatype;      /* Associated MPI datatype */
+
+  void          *distant_var;   /* Caller arrays of the associated setup, */
+  void          *local_var;     /* used to detect setup reusability */
+  const ple_lnum_t  *local_list;
+
+  int           *loc_v_flag;    /* Received variable flag per distant rank */
+  unsigned char *loc_v_buf;     /* Local values buffer */
+
+  int            n_requests;    /* Number of persistent requests */
+  MPI_Request   *request;       /* Persistent requests */
+  MPI_Status    *status;        /* Associated statuses */
+
+} _exchange_state_t;
+
+#endif /* defined(PLE_HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Structure defining a locator
  *----------------------------------------------------------------------------*/
@@ -124,6 +185,9 @@ struct _ple_locator_t {
 
 #if defined(PLE_HAVE_MPI)
   MPI_Comm  comm;                /* Associated MPI communicator */
+
+  _exchange_state_t  *exchange_state;  /* Asynchronous exchange state and
+                                          persistent setup, or NULL */
 #endif
 
   int       n_ranks;             /* Number of MPI ranks of distant location */
@@ -521,6 +585,382 @@ _clear_location_info(ple_locator_t  *this_locator)
 
 #if defined(PLE_HAVE_MPI)
 
+/*----------------------------------------------------------------------------
+ * Compute the Morton code of a point at a given refinement level.
+ *
+ * The encoding matches the scheme of distributed Morton-ordered octrees
+ * (one bit per dimension interleaved per level, highest level first).
+ *
+ * parameters:
+ *   dim    <-- spatial dimension
+ *   level  <-- refinement level
+ *   c      <-- integer cell coordinates at given level
+ *
+ * returns:
+ *   associated Morton code
+ *----------------------------------------------------------------------------*/
+
+static inline unsigned long long
+_morton_code(int             dim,
+             int             level,
+             const unsigned  c[])
+{
+  int i, l;
+  unsigned long long code = 0;
+
+  for (l = level - 1; l >= 0; l--) {
+    for (i = 0; i < dim; i++)
+      code = (code << 1) | ((c[i] >> l) & 1);
+  }
+
+  return code;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a Morton-ordered octree indexing a point subset.
+ *
+ * The octree is linear: points are encoded on a regular grid of
+ * 2^level cells per dimension covering the subset extents, and sorted
+ * by Morton code; octants are implicit code ranges of that array.
+ *
+ * parameters:
+ *   oct          --> octree to build
+ *   dim          <-- spatial dimension
+ *   idb          <-- base numbering of the point list
+ *   n_points     <-- number of points in subset
+ *   point_list   <-- optional indirection list for point_coords
+ *   point_coords <-- point coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_point_octree_build(_point_octree_t   *oct,
+                    int                dim,
+                    ple_lnum_t         idb,
+                    ple_lnum_t         n_points,
+                    const ple_lnum_t   point_list[],
+                    const ple_coord_t  point_coords[])
+{
+  int i;
+  ple_lnum_t j, k;
+  unsigned c[3];
+
+  const unsigned refinement = 1u << _OCTREE_LEVEL;
+
+  oct->level = _OCTREE_LEVEL;
+  oct->n_points = n_points;
+
+  PLE_MALLOC(oct->code, n_points, unsigned long long);
+  PLE_MALLOC(oct->order, n_points, ple_lnum_t);
+
+  /* Compute subset extents and associated scaling */
+
+  for (i = 0; i < 3; i++) {
+    oct->s_min[i] = HUGE_VAL;
+    oct->s_mult[i] = -HUGE_VAL;  /* used as maximum at this stage */
+  }
+
+  for (j = 0; j < n_points; j++) {
+    ple_lnum_t coord_idx = (point_list != NULL) ? point_list[j] - idb : j;
+    for (i = 0; i < dim; i++) {
+      double x = point_coords[dim*coord_idx + i];
+      if (x < oct->s_min[i])
+        oct->s_min[i] = x;
+      if (x > oct->s_mult[i])
+        oct->s_mult[i] = x;
+    }
+  }
+
+  for (i = 0; i < dim; i++) {
+    double delta = oct->s_mult[i] - oct->s_min[i];
+    if (delta > 0)
+      oct->s_mult[i] = refinement / delta;
+    else
+      oct->s_mult[i] = 0.;
+  }
+
+  /* Encode points */
+
+  for (j = 0; j < n_points; j++) {
+    ple_lnum_t coord_idx = (point_list != NULL) ? point_list[j] - idb : j;
+    for (i = 0; i < dim; i++) {
+      double s = (  point_coords[dim*coord_idx + i]
+                  - oct->s_min[i]) * oct->s_mult[i];
+      if (s < 0)
+        c[i] = 0;
+      else if (s >= refinement)
+        c[i] = refinement - 1;
+      else
+        c[i] = (unsigned)s;
+    }
+    oct->code[j] = _morton_code(dim, oct->level, c);
+    oct->order[j] = j;
+  }
+
+  /* Indirect heapsort on codes */
+
+  for (j = n_points/2 - 1; j >= 0; j--) {
+
+    ple_lnum_t l = j, h;
+    const ple_lnum_t save = oct->order[j];
+
+    while ((h = 2*l + 1) < n_points) {
+      if (   h + 1 < n_points
+          && oct->code[oct->order[h+1]] > oct->code[oct->order[h]])
+        h++;
+      if (oct->code[oct->order[h]] <= oct->code[save])
+        break;
+      oct->order[l] = oct->order[h];
+      l = h;
+    }
+    oct->order[l] = save;
+
+  }
+
+  for (k = n_points - 1; k > 0; k--) {
+
+    ple_lnum_t l = 0, h;
+    const ple_lnum_t save = oct->order[k];
+
+    oct->order[k] = oct->order[0];
+
+    while ((h = 2*l + 1) < k) {
+      if (   h + 1 < k
+          && oct->code[oct->order[h+1]] > oct->code[oct->order[h]])
+        h++;
+      if (oct->code[oct->order[h]] <= oct->code[save])
+        break;
+      oct->order[l] = oct->order[h];
+      l = h;
+    }
+    oct->order[l] = save;
+
+  }
+
+  /* Apply ordering to the codes themselves */
+
+  {
+    unsigned long long *code_s = NULL;
+    PLE_MALLOC(code_s, n_points, unsigned long long);
+    for (j = 0; j < n_points; j++)
+      code_s[j] = oct->code[oct->order[j]];
+    PLE_FREE(oct->code);
+    oct->code = code_s;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free the arrays of a Morton-ordered point octree.
+ *
+ * parameters:
+ *   oct <-> octree whose arrays should be freed
+ *----------------------------------------------------------------------------*/
+
+static void
+_point_octree_free(_point_octree_t  *oct)
+{
+  PLE_FREE(oct->code);
+  PLE_FREE(oct->order);
+  oct->n_points = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Recursively query a Morton-ordered point octree for a box.
+ *
+ * Octants disjoint from the query box are pruned; octants fully inside
+ * it, and small or maximum-level octants, are returned whole (the
+ * caller applies the exact per-point test in all cases).
+ *
+ * parameters:
+ *   oct    <-- point octree
+ *   dim    <-- spatial dimension
+ *   qlo    <-- lower integer bounds of the query box
+ *   qhi    <-- upper integer bounds of the query box (inclusive)
+ *   prefix <-- Morton prefix of the current octant
+ *   level  <-- level of the current octant
+ *   start  <-- start of the octant's range in the sorted code array
+ *   end    <-- past-the-end of the octant's range
+ *   sel    --> selected point subset indices
+ *   n_sel  <-> number of selected points
+ *----------------------------------------------------------------------------*/
+
+static void
+_point_octree_query(const _point_octree_t  *oct,
+                    int                     dim,
+                    const unsigned          qlo[],
+                    const unsigned          qhi[],
+                    unsigned long long      prefix,
+                    int                     level,
+                    ple_lnum_t              start,
+                    ple_lnum_t              end,
+                    ple_lnum_t              sel[],
+                    ple_lnum_t             *n_sel)
+{
+  int i, l, shift;
+  unsigned c[3];
+  _Bool inside;
+  ple_lnum_t j;
+
+  if (end <= start)
+    return;
+
+  /* Decode octant cell coordinates at current level */
+
+  for (i = 0; i < dim; i++)
+    c[i] = 0;
+
+  for (l = level - 1; l >= 0; l--) {
+    for (i = 0; i < dim; i++) {
+      unsigned bit
+        = (unsigned)((prefix >> ((unsigned)l*dim + (dim-1-i))) & 1);
+      c[i] |= bit << l;
+    }
+  }
+
+  shift = oct->level - level;
+
+  inside = true;
+
+  for (i = 0; i < dim; i++) {
+    unsigned o_lo = c[i] << shift;
+    unsigned o_hi = ((c[i] + 1) << shift) - 1;
+    if (o_hi < qlo[i] || o_lo > qhi[i])
+      return;
+    if (o_lo < qlo[i] || o_hi > qhi[i])
+      inside = false;
+  }
+
+  if (inside || level == oct->level || end - start <= 8) {
+    for (j = start; j < end; j++)
+      sel[(*n_sel)++] = oct->order[j];
+    return;
+  }
+
+  /* Partial overlap: recurse on children, locating each child's code
+     range in the sorted array by binary search */
+
+  {
+    int child;
+    ple_lnum_t c_start = start;
+
+    const int c_shift = dim*(shift - 1);
+
+    for (child = 0; child < (1 << dim); child++) {
+
+      unsigned long long c_prefix = (prefix << dim) | (unsigned)child;
+      unsigned long long c_code_end = (c_prefix + 1) << c_shift;
+
+      ple_lnum_t lo = c_start, hi = end;
+      while (lo < hi) {
+        ple_lnum_t mid = lo + (hi - lo)/2;
+        if (oct->code[mid] < c_code_end)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+
+      _point_octree_query(oct, dim, qlo, qhi,
+                          c_prefix, level + 1,
+                          c_start, lo,
+                          sel, n_sel);
+
+      c_start = lo;
+
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Select the points of an octree-indexed subset possibly within given
+ * extents.
+ *
+ * The returned selection is a superset of the points within the
+ * extents, in ascending subset index order, so applying the exact
+ * per-point extents test to it gives the same result as a full scan.
+ *
+ * parameters:
+ *   oct     <-- point octree
+ *   dim     <-- spatial dimension
+ *   extents <-- query extents (size: 2*dim)
+ *   sel     --> selected point subset indices (size: subset size)
+ *
+ * returns:
+ *   number of selected points
+ *----------------------------------------------------------------------------*/
+
+static ple_lnum_t
+_point_octree_select(const _point_octree_t  *oct,
+                     int                     dim,
+                     const double            extents[],
+                     ple_lnum_t              sel[])
+{
+  int i;
+  ple_lnum_t j, k, n_sel;
+  unsigned qlo[3], qhi[3];
+
+  const unsigned refinement = 1u << oct->level;
+
+  for (i = 0; i < dim; i++) {
+
+    double s_lo = (extents[i] - oct->s_min[i]) * oct->s_mult[i];
+    double s_hi = (extents[i + dim] - oct->s_min[i]) * oct->s_mult[i];
+
+    if (s_hi < 0 || s_lo >= refinement)
+      return 0;
+
+    qlo[i] = (s_lo < 0) ? 0 : (unsigned)s_lo;
+    qhi[i] = (s_hi >= refinement) ? refinement - 1 : (unsigned)s_hi;
+
+  }
+
+  n_sel = 0;
+
+  _point_octree_query(oct, dim, qlo, qhi,
+                      0, 0,
+                      0, oct->n_points,
+                      sel, &n_sel);
+
+  /* Sort selection (ascending subset indices, heapsort) so the caller
+     builds its buffers in the same order as with a full scan */
+
+  for (j = n_sel/2 - 1; j >= 0; j--) {
+
+    ple_lnum_t l = j, h;
+    const ple_lnum_t save = sel[j];
+
+    while ((h = 2*l + 1) < n_sel) {
+      if (h + 1 < n_sel && sel[h+1] > sel[h])
+        h++;
+      if (sel[h] <= save)
+        break;
+      sel[l] = sel[h];
+      l = h;
+    }
+    sel[l] = save;
+
+  }
+
+  for (k = n_sel - 1; k > 0; k--) {
+
+    ple_lnum_t l = 0, h;
+    const ple_lnum_t save = sel[k];
+
+    sel[k] = sel[0];
+
+    while ((h = 2*l + 1) < k) {
+      if (h + 1 < k && sel[h+1] > sel[h])
+        h++;
+      if (sel[h] <= save)
+        break;
+      sel[l] = sel[h];
+      l = h;
+    }
+    sel[l] = save;
+
+  }
+
+  return n_sel;
+}
+
 /*----------------------------------------------------------------------------
  * Update intersection rank information once location is done.
  *
@@ -928,13 +1368,16 @@ _locate_distant(ple_locator_t               *this_locator,
 {
   int i, k;
   int dist_rank, dist_index;
-  ple_lnum_t j;
+  ple_lnum_t j, jj, n_sel;
   ple_lnum_t n_coords_loc, n_coords_dist;
   ple_lnum_t *location_loc, *location_dist;
   ple_lnum_t *tag_dist, *send_tag;
+  ple_lnum_t *sel = NULL;
   ple_coord_t *coords_dist, *send_coords;
   float *distance_dist, *distance_loc;
+  _Bool use_octree;
 
+  _point_octree_t octree;
   _rank_intersects_t intersects;
   MPI_Status status;
 
@@ -1009,6 +1452,23 @@ _locate_distant(ple_locator_t               *this_locator,
   else
     send_tag = NULL;
 
+  /* With many candidate ranks, select candidate points for each rank
+     through a Morton-ordered octree rather than scanning all points
+     for every rank */
+
+  use_octree = (   intersects.n > 1
+                && (double)_n_points * intersects.n > _OCTREE_THRESHOLD);
+
+  if (use_octree) {
+    _point_octree_build(&octree,
+                        dim,
+                        idb,
+                        _n_points,
+                        _point_list_p,
+                        point_coords);
+    PLE_MALLOC(sel, _n_points, ple_lnum_t);
+  }
+
   /* First loop on possibly intersecting distant ranks */
   /*---------------------------------------------------*/
 
@@ -1027,10 +1487,17 @@ _locate_distant(ple_locator_t               *this_locator,
 
     /* Build partial buffer */
 
-    for (j = 0; j < _n_points; j++) {
+    if (use_octree)
+      n_sel = _point_octree_select(&octree, dim, extents, sel);
+    else
+      n_sel = _n_points;
+
+    for (jj = 0; jj < n_sel; jj++) {
 
       ple_lnum_t coord_idx;
 
+      j = (use_octree) ? sel[jj] : jj;
+
       if (_point_list_p != NULL)
         coord_idx = _point_list_p[j] - idb;
       else
@@ -1159,6 +1626,11 @@ _locate_distant(ple_locator_t               *this_locator,
 
   /* Free temporary arrays */
 
+  if (use_octree) {
+    _point_octree_free(&octree);
+    PLE_FREE(sel);
+  }
+
   PLE_FREE(send_id);
   PLE_FREE(send_tag);
   PLE_FREE(send_coords);
@@ -2409,58 +2881,478 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[1] += comm_timing[1];
 }
 
-#endif /* defined(PLE_HAVE_MPI) */
+/*----------------------------------------------------------------------------
+ * Free the asynchronous exchange state of a locator, if present.
+ *
+ * Must be called whenever the intersect or point lists of the locator
+ * may change, as the persistent communication setup depends on them.
+ *
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_state_reset(ple_locator_t  *this_locator)
+{
+  _exchange_state_t *es = this_locator->exchange_state;
+
+  if (es != NULL) {
+
+    assert(es->in_progress == 0);
+
+    if (es->persistent) {
+      int i;
+      for (i = 0; i < es->n_requests; i++)
+        MPI_Request_free(&(es->request[i]));
+    }
+
+    PLE_FREE(es->loc_v_flag);
+    PLE_FREE(es->loc_v_buf);
+    PLE_FREE(es->request);
+    PLE_FREE(es->status);
+
+    PLE_FREE(this_locator->exchange_state);
+
+  }
+}
 
 /*----------------------------------------------------------------------------
- * Distribute variable defined on "distant points" to the original ("local")
- * points.
+ * Set up persistent communication for asynchronous variable exchange.
  *
- * The exchange is symmetric if both variables are defined, receive
- * only if distant_var is NULL, or send only if local_var is NULL.
+ * Exchanges the variable presence flags with the distant ranks, then
+ * creates persistent send and receive requests for the variable values;
+ * the requests may be reused by every subsequent exchange using the
+ * same arrays and parameters, so the per-exchange cost reduces to
+ * starting and completing them.
  *
  * parameters:
  *   this_locator  <-- pointer to locator structure
- *   distant_var   <-> variable defined on distant points (ready to send)
+ *   es            <-> exchange state to set up
+ *   distant_var   <-> variable defined on distant points (sent)
  *   local_var     <-> variable defined on local points (received)
  *   local_list    <-- optional indirection list for local_var
- *   type_size     <-- sizeof (float or double) variable type
+ *   datatype      <-- variable type
  *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
  *   reverse       <-- if true, exchange is reversed
- *                     (receive values associated with distant points
- *                     from the processes owning the original points)
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_point_var_local(ple_locator_t     *this_locator,
-                          void              *distant_var,
-                          void              *local_var,
-                          const ple_lnum_t  *local_list,
-                          size_t             type_size,
-                          size_t             stride,
-                          _Bool              reverse)
+_exchange_state_setup(ple_locator_t     *this_locator,
+                      _exchange_state_t  *es,
+                      void              *distant_var,
+                      void              *local_var,
+                      const ple_lnum_t  *local_list,
+                      MPI_Datatype       datatype,
+                      size_t             stride,
+                      _Bool              reverse)
 {
-  ple_lnum_t i;
-  size_t j;
-  ple_lnum_t n_points_loc;
+  int i, dist_v_count, loc_v_count, size;
+  int dist_rank;
+  ple_lnum_t n_points_loc, n_points_loc_tot, n_points_dist;
+  size_t dist_v_idx;
+  unsigned char *dist_v_ptr, *loc_v_ptr;
 
-  const size_t nbytes = stride*type_size;
+  MPI_Aint lb, extent;
+  int *dist_v_flag = NULL;
 
-  /* Initialization */
+  double comm_timing[4] = {0., 0., 0., 0.};
 
-  if (this_locator->n_interior == 0)
-    return;
+  /* Check extent of datatype */
 
-  n_points_loc =   this_locator->local_points_idx[1]
-                 - this_locator->local_points_idx[0];
+#if (MPI_VERSION >= 2)
+  MPI_Type_get_extent(datatype, &lb, &extent);
+#else
+  MPI_Type_extent(datatype, &extent);
+#endif
+  MPI_Type_size(datatype, &size);
 
-  assert(n_points_loc == (  this_locator->distant_points_idx[1]
-                          - this_locator->distant_points_idx[0]));
+  if (extent != size)
+    ple_error(__FILE__, __LINE__, 0,
+              _("_exchange_point_var() is not implemented for use with\n"
+                "MPI datatypes associated with structures using padding\n"
+                "(for which size != extent)."));
 
-  /* Exchange information */
+  /* Free a previous setup with different arrays or parameters */
 
-  if (reverse == false) {
+  if (es->persistent) {
+    for (i = 0; i < es->n_requests; i++)
+      MPI_Request_free(&(es->request[i]));
+    es->persistent = 0;
+  }
 
-    if (local_list == NULL)
+  es->reverse = reverse;
+  es->stride = stride;
+  es->size = size;
+  es->datatype = datatype;
+
+  es->distant_var = distant_var;
+  es->local_var = local_var;
+  es->local_list = local_list;
+
+  n_points_loc_tot
+    = this_locator->local_points_idx[this_locator->n_intersects];
+
+  PLE_REALLOC(es->loc_v_flag, this_locator->n_intersects, int);
+  PLE_REALLOC(es->request, this_locator->n_intersects*2, MPI_Request);
+  PLE_REALLOC(es->status, this_locator->n_intersects*2, MPI_Status);
+
+  PLE_REALLOC(es->loc_v_buf, n_points_loc_tot*size*stride, unsigned char);
+
+  /* Exchange variable presence flags, as in the non-persistent variants */
+
+  PLE_MALLOC(dist_v_flag, this_locator->n_intersects, int);
+
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+  for (i = 0; i < this_locator->n_intersects; i++) {
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+
+    if (distant_var != NULL && n_points_dist > 0)
+      dist_v_flag[i] = 1;
+    else
+      dist_v_flag[i] = 0;
+
+    MPI_Irecv(es->loc_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &(es->request[i*2]));
+    MPI_Isend(dist_v_flag + i, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+              this_locator->comm, &(es->request[i*2+1]));
+  }
+
+  MPI_Waitall(this_locator->n_intersects*2, es->request, es->status);
+
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  PLE_FREE(dist_v_flag);
+
+  for (i = 0; i < this_locator->n_intersects; i++) {
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_loc =   this_locator->local_points_idx[i+1]
+                   - this_locator->local_points_idx[i];
+
+    if (es->loc_v_flag[i] == 1 && (local_var == NULL || n_points_loc == 0))
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incoherent arguments to different instances in "
+                  "_exchange_point_var().\n"
+                  "Send and receive operations do not match "
+                  "(dist_rank = %d\n)\n"), dist_rank);
+  }
+
+  /* Create persistent requests; distant values are sent (or received in
+     reverse mode) in place, local values go through the buffer */
+
+  loc_v_ptr = es->loc_v_buf;
+
+  for (i = 0; i < this_locator->n_intersects; i++) {
+
+    dist_rank = this_locator->intersect_rank[i];
+
+    n_points_loc =    this_locator->local_points_idx[i+1]
+                    - this_locator->local_points_idx[i];
+
+    n_points_dist =   this_locator->distant_points_idx[i+1]
+                    - this_locator->distant_points_idx[i];
+
+    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
+
+    if (distant_var != NULL)
+      dist_v_count = n_points_dist * stride;
+    else
+      dist_v_count = 0;
+
+    if (es->loc_v_flag[i] > 0)
+      loc_v_count = n_points_loc*stride;
+    else
+      loc_v_count = 0;
+
+    if (distant_var != NULL)
+      dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
+    else
+      dist_v_ptr = NULL;
+
+    if (reverse == false) {
+      MPI_Recv_init(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                    this_locator->comm, &(es->request[i*2]));
+      MPI_Send_init(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                    this_locator->comm, &(es->request[i*2+1]));
+    }
+    else {
+      MPI_Recv_init(dist_v_ptr, dist_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                    this_locator->comm, &(es->request[i*2]));
+      MPI_Send_init(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                    this_locator->comm, &(es->request[i*2+1]));
+    }
+
+    loc_v_ptr += loc_v_count*size;
+
+  }
+
+  es->n_requests = this_locator->n_intersects*2;
+  es->persistent = 1;
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Begin an asynchronous exchange of a variable defined on distant points.
+ *
+ * The persistent communication setup of a previous exchange with the
+ * same arrays and parameters is reused when possible; otherwise it is
+ * (re)built first. In reverse mode, the send buffer is prepared here,
+ * so local_var may be modified between the begin and end calls.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (sent)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   datatype      <-- variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_begin(ple_locator_t     *this_locator,
+                                  void              *distant_var,
+                                  void              *local_var,
+                                  const ple_lnum_t  *local_list,
+                                  MPI_Datatype       datatype,
+                                  size_t             stride,
+                                  _Bool              reverse)
+{
+  int i;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  _exchange_state_t *es = this_locator->exchange_state;
+
+  if (es == NULL) {
+
+    PLE_MALLOC(es, 1, _exchange_state_t);
+
+    es->persistent = 0;
+    es->in_progress = 0;
+
+    es->loc_v_flag = NULL;
+    es->loc_v_buf = NULL;
+    es->n_requests = 0;
+    es->request = NULL;
+    es->status = NULL;
+
+    this_locator->exchange_state = es;
+
+  }
+
+  assert(es->in_progress == 0);
+
+  if (   es->persistent == 0
+      || es->distant_var != distant_var
+      || es->local_var != local_var
+      || es->local_list != local_list
+      || es->datatype != datatype
+      || es->stride != stride
+      || (_Bool)es->reverse != reverse)
+    _exchange_state_setup(this_locator,
+                          es,
+                          distant_var,
+                          local_var,
+                          local_list,
+                          datatype,
+                          stride,
+                          reverse);
+
+  /* In reverse mode, fill the send buffer before starting the requests */
+
+  if (reverse == true) {
+
+    unsigned char *loc_v_ptr = es->loc_v_buf;
+
+    for (i = 0; i < this_locator->n_intersects; i++) {
+
+      const ple_lnum_t *_local_point_ids
+        = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+      ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                - this_locator->local_points_idx[i];
+
+      if (es->loc_v_flag[i] > 0) {
+        int k;
+        size_t l;
+        const size_t nbytes = stride*es->size;
+        if (local_list == NULL) {
+          for (k = 0; k < n_points_loc; k++) {
+            const char *local_v_p
+              = (const char *)local_var + _local_point_ids[k]*nbytes;
+            char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+            for (l = 0; l < nbytes; l++)
+              loc_v_buf_p[l] = local_v_p[l];
+          }
+        }
+        else {
+          const ple_lnum_t idb = this_locator->point_id_base;
+          for (k = 0; k < n_points_loc; k++) {
+            const char *local_v_p
+              = (const char *)local_var
+                + (local_list[_local_point_ids[k]] - idb)*nbytes;
+            char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
+            for (l = 0; l < nbytes; l++)
+              loc_v_buf_p[l] = local_v_p[l];
+          }
+        }
+        loc_v_ptr += n_points_loc*nbytes;
+      }
+
+    }
+
+  }
+
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+  MPI_Startall(es->n_requests, es->request);
+
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  es->in_progress = 1;
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+/*----------------------------------------------------------------------------
+ * Complete an asynchronous exchange of a variable defined on distant
+ * points.
+ *
+ * Waits for the requests started by the matching begin call, then in
+ * standard mode distributes the received buffer to the local points.
+ *
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_distant_end(ple_locator_t  *this_locator)
+{
+  int i;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+
+  _exchange_state_t *es = this_locator->exchange_state;
+
+  assert(es != NULL && es->in_progress == 1);
+
+  _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+  MPI_Waitall(es->n_requests, es->request, es->status);
+
+  _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+  if (es->reverse == 0 && es->local_var != NULL) {
+
+    const unsigned char *loc_v_ptr = es->loc_v_buf;
+
+    for (i = 0; i < this_locator->n_intersects; i++) {
+
+      const ple_lnum_t *_local_point_ids
+        = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+      ple_lnum_t n_points_loc =   this_locator->local_points_idx[i+1]
+                                - this_locator->local_points_idx[i];
+
+      if (es->loc_v_flag[i] > 0) {
+        int k;
+        size_t l;
+        const size_t nbytes = es->stride*es->size;
+        if (es->local_list == NULL) {
+          for (k = 0; k < n_points_loc; k++) {
+            char *local_v_p
+              = (char *)es->local_var + _local_point_ids[k]*nbytes;
+            const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+            for (l = 0; l < nbytes; l++)
+              local_v_p[l] = loc_v_buf_p[l];
+          }
+        }
+        else {
+          const ple_lnum_t idb = this_locator->point_id_base;
+          for (k = 0; k < n_points_loc; k++) {
+            char *local_v_p
+              = (char *)es->local_var
+                + (es->local_list[_local_point_ids[k]] - idb)*nbytes;
+            const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
+            for (l = 0; l < nbytes; l++)
+              local_v_p[l] = loc_v_buf_p[l];
+          }
+        }
+        loc_v_ptr += n_points_loc*nbytes;
+      }
+
+    }
+
+  }
+
+  es->in_progress = 0;
+
+  this_locator->exchange_wtime[1] += comm_timing[0];
+  this_locator->exchange_cpu_time[1] += comm_timing[1];
+}
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on "distant points" to the original ("local")
+ * points.
+ *
+ * The exchange is symmetric if both variables are defined, receive
+ * only if distant_var is NULL, or send only if local_var is NULL.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if true, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_point_var_local(ple_locator_t     *this_locator,
+                          void              *distant_var,
+                          void              *local_var,
+                          const ple_lnum_t  *local_list,
+                          size_t             type_size,
+                          size_t             stride,
+                          _Bool              reverse)
+{
+  ple_lnum_t i;
+  size_t j;
+  ple_lnum_t n_points_loc;
+
+  const size_t nbytes = stride*type_size;
+
+  /* Initialization */
+
+  if (this_locator->n_interior == 0)
+    return;
+
+  n_points_loc =   this_locator->local_points_idx[1]
+                 - this_locator->local_points_idx[0];
+
+  assert(n_points_loc == (  this_locator->distant_points_idx[1]
+                          - this_locator->distant_points_idx[0]));
+
+  /* Exchange information */
+
+  if (reverse == false) {
+
+    if (local_list == NULL)
       memcpy(local_var, distant_var, n_points_loc*nbytes);
 
     else {
@@ -2493,6 +3385,74 @@ _exchange_point_var_local(ple_locator_t     *this_locator,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update local point ids and point list references once location is done.
+ *
+ * local_point_ids[] is made to refer to an index in a dense
+ * [0, n_interior] subset of the local points, and, if an initial point
+ * list was given, interior_list and exterior_list are updated so that
+ * they refer to the same point set as that initial list (and not to an
+ * index within the selected point set).
+ *
+ * parameters:
+ *   this_locator <-> pointer to locator structure
+ *   n_points     <-- number of points to locate
+ *   point_list   <-- optional indirection array to point coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_finalize_point_ids(ple_locator_t     *this_locator,
+                    ple_lnum_t         n_points,
+                    const ple_lnum_t   point_list[])
+{
+  ple_lnum_t i;
+
+  const ple_lnum_t idb = this_locator->point_id_base;
+
+  /* Update local_point_ids values */
+
+  if (   this_locator->n_interior > 0
+      && this_locator->local_point_ids != NULL) {
+
+    ple_lnum_t  *reduced_index;
+
+    PLE_MALLOC(reduced_index, n_points, ple_lnum_t);
+
+    for (i = 0; i < n_points; i++)
+      reduced_index[i] = -1;
+
+    assert(  this_locator->local_points_idx[this_locator->n_intersects]
+           == this_locator->n_interior);
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      reduced_index[this_locator->interior_list[i] - idb] = i;
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      this_locator->local_point_ids[i]
+        = reduced_index[this_locator->local_point_ids[i]];
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      assert(this_locator->local_point_ids[i] > -1);
+
+    PLE_FREE(reduced_index);
+
+  }
+
+  /* Update interior and exterior lists */
+
+  if (point_list != NULL) {
+
+    for (i = 0; i < this_locator->n_interior; i++)
+      this_locator->interior_list[i]
+        = point_list[this_locator->interior_list[i] - idb];
+
+    for (i = 0; i < this_locator->n_exterior; i++)
+      this_locator->exterior_list[i]
+        = point_list[this_locator->exterior_list[i] - idb];
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
@@ -2596,6 +3556,7 @@ ple_locator_create(void)
 
 #if defined(PLE_HAVE_MPI)
   this_locator->comm = comm;
+  this_locator->exchange_state = NULL;
   this_locator->n_ranks = n_ranks;
   this_locator->start_rank = start_rank;
 #else
@@ -2650,6 +3611,10 @@ ple_locator_destroy(ple_locator_t  *this_locator)
 {
   if (this_locator != NULL) {
 
+#if defined(PLE_HAVE_MPI)
+    _exchange_state_reset(this_locator);
+#endif
+
     PLE_FREE(this_locator->local_points_idx);
     PLE_FREE(this_locator->distant_points_idx);
 
@@ -2808,7 +3773,6 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                           ple_mesh_extents_t          *mesh_extents_f,
                           ple_mesh_elements_locate_t  *mesh_locate_f)
 {
-  int i;
   double w_start, w_end, cpu_start, cpu_end;
   ple_lnum_t  *location;
 
@@ -2830,10 +3794,17 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
   else
     this_locator->point_id_base = 0;
 
-  const int idb = this_locator->point_id_base;
-
   this_locator->have_tags = 0;
 
+#if defined(PLE_HAVE_MPI)
+
+  /* The persistent exchange setup depends on the point distribution,
+     so it may not survive a new search */
+
+  _exchange_state_reset(this_locator);
+
+#endif
+
   /* Prepare locator (MPI version) */
   /*-------------------------------*/
 
@@ -2889,145 +3860,429 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                   "with distant space dimension %d\n"),
                 dim, globflag[0]);
 
-    /* Check algorithm versions and supported features */
+    /* Check algorithm versions and supported features */
+
+    globflag[3] = -globflag[3];
+
+    if (globflag[2] > globflag[3])
+      ple_error(__FILE__, __LINE__, 0,
+                _("Incompatible locator algorithm ranges:\n"
+                  "  global minimum algorithm id %d\n"
+                  "  global maximum algorithm id %d\n"
+                  "PLE library versions or builds are incompatible."),
+                globflag[2], globflag[3]);
+
+    if (globflag[5] > 0)
+      this_locator->have_tags = 1;
+
+    /* Free temporary memory */
+
+    PLE_MALLOC(location, n_points, ple_lnum_t);
+    PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
+
+    _transfer_location_distant(this_locator,
+                               n_points,
+                               location,
+                               location_rank_id);
+
+    _locate_all_distant(this_locator,
+                        mesh,
+                        tolerance_base,
+                        tolerance_fraction,
+                        n_points,
+                        point_list,
+                        point_tag,
+                        point_coords,
+                        location,
+                        location_rank_id,
+                        distance,
+                        mesh_extents_f,
+                        mesh_locate_f);
+
+    PLE_FREE(location_rank_id);
+  }
+
+#endif
+
+  /* Prepare locator (local version) */
+  /*---------------------------------*/
+
+  if (!mpi_flag) {
+
+    if (mesh == NULL || n_points == 0)
+      return;
+
+    if (point_tag != NULL)
+      this_locator->have_tags = 1;
+
+    PLE_MALLOC(location, n_points, ple_lnum_t);
+
+    _transfer_location_local(this_locator,
+                             n_points,
+                             location);
+
+    _locate_all_local(this_locator,
+                      mesh,
+                      tolerance_base,
+                      tolerance_fraction,
+                      n_points,
+                      point_list,
+                      point_tag,
+                      point_coords,
+                      location,
+                      distance,
+                      mesh_extents_f,
+                      mesh_locate_f);
+
+    PLE_FREE(location);
+
+  }
+
+  /* Update local_point_ids values and point list references */
+  /*---------------------------------------------------------*/
+
+  _finalize_point_ids(this_locator, n_points, point_list);
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->location_wtime[0] += (w_end - w_start);
+  this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
+
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update point locations incrementally after small displacements.
+ *
+ * Points previously located by ple_locator_set_mesh() are first
+ * re-located by the ranks which hosted them, using their new
+ * coordinates; only points lost by their previous host (i.e. whose new
+ * location distance exceeds max_distance) go through the full
+ * distributed search. When coupled meshes move by small displacements,
+ * almost all points stay on their previous host, so the cost of the
+ * global candidate search is avoided.
+ *
+ * Arguments are those of ple_locator_set_mesh(), plus the acceptance
+ * distance; as with that function, this function must be called
+ * simultaneously on all ranks of the locator's communicator. A full
+ * search is done when no previous location information is available,
+ * when the point set size has changed, or when point tags are used.
+ *
+ * \param[in, out] this_locator        pointer to locator structure
+ * \param[in]      mesh                pointer to mesh representation structure
+ * \param[in]      options             options array (size
+ *                                     PLE_LOCATOR_N_OPTIONS), or NULL
+ * \param[in]      tolerance_base      associated fixed tolerance
+ * \param[in]      tolerance_fraction  associated fraction of element bounding
+ *                                     boxes added to tolerance
+ * \param[in]      dim                 spatial dimension of mesh and points to
+ *                                     locate
+ * \param[in]      max_distance        maximum distance at which a point
+ *                                     re-located by its previous host is
+ *                                     accepted (1 keeps points inside volume
+ *                                     elements)
+ * \param[in]      n_points            number of points to locate
+ * \param[in]      point_list          optional indirection array to point_coords
+ * \param[in]      point_tag           optional point tag (size: n_points)
+ * \param[in]      point_coords        coordinates of points to locate
+ *                                     (dimension: dim * n_points)
+ * \param[out]     distance            optional distance from point to matching
+ *                                     element: < 0 if unlocated, 0 - 1 if
+ *                                     inside and > 1 if outside a volume
+ *                                     element, or absolute distance to a
+ *                                     surface element (size: n_points)
+ * \param[in]      mesh_extents_f      pointer to function computing mesh or
+ *                                     mesh subset or element extents
+ * \param[in]      mesh_locate_f       pointer to function wich updates the
+ *                                     location[] and distance[] arrays
+ *                                     associated with a set of points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_relocate(ple_locator_t               *this_locator,
+                     const void                  *mesh,
+                     const int                   *options,
+                     float                        tolerance_base,
+                     float                        tolerance_fraction,
+                     int                          dim,
+                     float                        max_distance,
+                     ple_lnum_t                   n_points,
+                     const ple_lnum_t             point_list[],
+                     const ple_lnum_t             point_tag[],
+                     const ple_coord_t            point_coords[],
+                     float                        distance[],
+                     ple_mesh_extents_t          *mesh_extents_f,
+                     ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  int incremental = 0;
+
+#if defined(PLE_HAVE_MPI)
+
+  int mpi_flag = 0;
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    int loc_ok, glob_ok;
+
+    /* The incremental path requires previous location info for the
+       same point set, and does not handle tags; all ranks must agree
+       on the path taken, as the collective operations differ */
+
+    loc_ok = (   this_locator->local_points_idx != NULL
+              && this_locator->dim == dim
+              && (  this_locator->n_interior
+                  + this_locator->n_exterior) == n_points
+              && this_locator->have_tags == 0
+              && point_tag == NULL) ? 1 : 0;
+
+    MPI_Allreduce(&loc_ok, &glob_ok, 1, MPI_INT, MPI_MIN,
+                  this_locator->comm);
+
+    incremental = glob_ok;
+
+  }
+
+  if (incremental) {
+
+    int i;
+    ple_lnum_t j, k;
+    ple_lnum_t *loc_elt = NULL, *accept_loc = NULL, *host_rank = NULL;
+    ple_lnum_t *location = NULL, *location_rank_id = NULL;
+    ple_lnum_t *inv_list = NULL;
+    ple_coord_t *coords_int = NULL, *coords_dist = NULL;
+    float *dist_int = NULL, *dist_new = NULL;
+    float *_distance = distance;
+
+    double w_start, w_end, cpu_start, cpu_end;
+
+    const ple_lnum_t n_interior = this_locator->n_interior;
+    const ple_lnum_t n_dist
+      = this_locator->distant_points_idx[this_locator->n_intersects];
+    const ple_lnum_t idb = this_locator->point_id_base;
 
-    globflag[3] = -globflag[3];
+    w_start = ple_timer_wtime();
+    cpu_start = ple_timer_cpu_time();
 
-    if (globflag[2] > globflag[3])
-      ple_error(__FILE__, __LINE__, 0,
-                _("Incompatible locator algorithm ranges:\n"
-                  "  global minimum algorithm id %d\n"
-                  "  global maximum algorithm id %d\n"
-                  "PLE library versions or builds are incompatible."),
-                globflag[2], globflag[3]);
+    this_locator->dim = dim;
 
-    if (globflag[5] > 0)
-      this_locator->have_tags = 1;
+    /* Send the new coordinates of previously located points to their
+       previous host ranks, reusing the variable exchange mechanism */
 
-    /* Free temporary memory */
+    PLE_MALLOC(coords_int, n_interior*dim, ple_coord_t);
+    PLE_MALLOC(coords_dist, n_dist*dim, ple_coord_t);
 
-    PLE_MALLOC(location, n_points, ple_lnum_t);
-    PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
+    for (j = 0; j < n_interior; j++) {
+      ple_lnum_t coord_idx = this_locator->interior_list[j] - idb;
+      for (k = 0; k < dim; k++)
+        coords_int[j*dim + k] = point_coords[dim*coord_idx + k];
+    }
 
-    _transfer_location_distant(this_locator,
-                               n_points,
-                               location,
-                               location_rank_id);
+    _exchange_point_var_distant(this_locator,
+                                coords_dist,
+                                coords_int,
+                                NULL,
+                                PLE_MPI_COORD,
+                                dim,
+                                true);
 
-    _locate_all_distant(this_locator,
-                        mesh,
-                        tolerance_base,
-                        tolerance_fraction,
-                        n_points,
-                        point_list,
-                        point_tag,
-                        point_coords,
-                        location,
-                        location_rank_id,
-                        distance,
-                        mesh_extents_f,
-                        mesh_locate_f);
+    PLE_FREE(coords_int);
 
-    PLE_FREE(location_rank_id);
-  }
+    /* Re-locate previously hosted points on the local mesh only */
 
-#endif
+    PLE_MALLOC(accept_loc, n_dist, ple_lnum_t);
+    PLE_MALLOC(dist_new, n_dist, float);
 
-  /* Prepare locator (local version) */
-  /*---------------------------------*/
+    for (j = 0; j < n_dist; j++) {
+      accept_loc[j] = -1;
+      dist_new[j] = -1.0;
+    }
 
-  if (!mpi_flag) {
+    if (n_dist > 0)
+      mesh_locate_f(mesh,
+                    tolerance_base,
+                    tolerance_fraction,
+                    n_dist,
+                    coords_dist,
+                    NULL,
+                    accept_loc,
+                    dist_new);
 
-    if (mesh == NULL || n_points == 0)
-      return;
+    PLE_FREE(coords_dist);
 
-    if (point_tag != NULL)
-      this_locator->have_tags = 1;
+    for (j = 0; j < n_dist; j++) {
+      if (!(dist_new[j] > -0.1) || dist_new[j] > max_distance) {
+        accept_loc[j] = -1;
+        dist_new[j] = -1.0;
+      }
+    }
+
+    /* Return new element ids and distances to the point-owning ranks */
+
+    PLE_MALLOC(loc_elt, n_interior, ple_lnum_t);
+    PLE_MALLOC(dist_int, n_interior, float);
+
+    _exchange_point_var_distant(this_locator,
+                                accept_loc,
+                                loc_elt,
+                                NULL,
+                                PLE_MPI_LNUM,
+                                1,
+                                false);
+
+    _exchange_point_var_distant(this_locator,
+                                dist_new,
+                                dist_int,
+                                NULL,
+                                MPI_FLOAT,
+                                1,
+                                false);
+
+    PLE_FREE(accept_loc);
+    PLE_FREE(dist_new);
+
+    /* Previous host rank of each point of the dense interior subset */
+
+    PLE_MALLOC(host_rank, n_interior, ple_lnum_t);
+
+    for (i = 0; i < this_locator->n_intersects; i++) {
+      for (j = this_locator->local_points_idx[i];
+           j < this_locator->local_points_idx[i+1];
+           j++)
+        host_rank[this_locator->local_point_ids[j]]
+          = this_locator->intersect_rank[i];
+    }
+
+    /* Build full location arrays; re-located points keep their
+       previous host rank, lost points are re-searched globally */
 
     PLE_MALLOC(location, n_points, ple_lnum_t);
+    PLE_MALLOC(location_rank_id, n_points, ple_lnum_t);
 
-    _transfer_location_local(this_locator,
-                             n_points,
-                             location);
+    if (distance == NULL)
+      PLE_MALLOC(_distance, n_points, float);
 
-    _locate_all_local(this_locator,
-                      mesh,
-                      tolerance_base,
-                      tolerance_fraction,
-                      n_points,
-                      point_list,
-                      point_tag,
-                      point_coords,
-                      location,
-                      distance,
-                      mesh_extents_f,
-                      mesh_locate_f);
+    for (j = 0; j < n_points; j++) {
+      location[j] = -1;
+      location_rank_id[j] = -1;
+      _distance[j] = -1.0;
+    }
 
-    PLE_FREE(location);
+    if (point_list != NULL) {
 
-  }
+      /* Map point coordinate indexes (used by interior_list) back to
+         point subset indexes (used by location arrays) */
 
-  /* Update local_point_ids values */
-  /*-------------------------------*/
+      ple_lnum_t inv_size = 0;
+      for (j = 0; j < n_points; j++) {
+        if (point_list[j] - idb >= inv_size)
+          inv_size = point_list[j] - idb + 1;
+      }
+      PLE_MALLOC(inv_list, inv_size, ple_lnum_t);
+      for (j = 0; j < n_points; j++)
+        inv_list[point_list[j] - idb] = j;
 
-  if (   this_locator->n_interior > 0
-      && this_locator->local_point_ids != NULL) {
+    }
 
-    ple_lnum_t  *reduced_index;
+    for (j = 0; j < n_interior; j++) {
 
-    PLE_MALLOC(reduced_index, n_points, ple_lnum_t);
+      ple_lnum_t pt_id = this_locator->interior_list[j] - idb;
 
-    for (i = 0; i < n_points; i++)
-      reduced_index[i] = -1;
+      if (inv_list != NULL)
+        pt_id = inv_list[pt_id];
 
-    assert(  this_locator->local_points_idx[this_locator->n_intersects]
-           == this_locator->n_interior);
+      if (loc_elt[j] > -1) {
+        location[pt_id] = loc_elt[j];
+        location_rank_id[pt_id] = host_rank[j];
+        _distance[pt_id] = dist_int[j];
+      }
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      reduced_index[this_locator->interior_list[i] - idb] = i;
+    }
 
-    /* Update this_locator->local_point_ids[] so that it refers
-       to an index in a dense [0, this_locator->n_interior] subset
-       of the local points */
+    PLE_FREE(inv_list);
+    PLE_FREE(host_rank);
+    PLE_FREE(loc_elt);
+    PLE_FREE(dist_int);
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      this_locator->local_point_ids[i]
-        = reduced_index[this_locator->local_point_ids[i]];
+    /* Release previous location info and rebuild it from the
+       location arrays, searching only for lost points */
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      assert(this_locator->local_point_ids[i] > -1);
+    _exchange_state_reset(this_locator);
 
-    PLE_FREE(reduced_index);
+    this_locator->n_intersects = 0;
+    PLE_FREE(this_locator->intersect_rank);
+    PLE_FREE(this_locator->local_points_idx);
+    PLE_FREE(this_locator->distant_points_idx);
+    PLE_FREE(this_locator->local_point_ids);
+    PLE_FREE(this_locator->distant_point_location);
+    PLE_FREE(this_locator->distant_point_coords);
 
-  }
+    this_locator->n_interior = 0;
+    this_locator->n_exterior = 0;
+    PLE_FREE(this_locator->interior_list);
+    PLE_FREE(this_locator->exterior_list);
 
-  /* If an initial point list was given, update
-     this_locator->interior_list and this_locator->exterior_list
-     so that they refer to the same point set as that initial
-     list (and not to an index within the selected point set) */
+    if (options != NULL)
+      this_locator->point_id_base = options[PLE_LOCATOR_NUMBERING];
+    else
+      this_locator->point_id_base = 0;
 
-  if (point_list != NULL) {
+    _locate_all_distant(this_locator,
+                        mesh,
+                        tolerance_base,
+                        tolerance_fraction,
+                        n_points,
+                        point_list,
+                        point_tag,
+                        point_coords,
+                        location,
+                        location_rank_id,
+                        _distance,
+                        mesh_extents_f,
+                        mesh_locate_f);
 
-    for (i = 0; i < this_locator->n_interior; i++)
-      this_locator->interior_list[i]
-        = point_list[this_locator->interior_list[i] - idb];
+    PLE_FREE(location);
+    PLE_FREE(location_rank_id);
 
-    for (i = 0; i < this_locator->n_exterior; i++)
-      this_locator->exterior_list[i]
-        = point_list[this_locator->exterior_list[i] - idb];
+    if (_distance != distance)
+      PLE_FREE(_distance);
 
-  }
+    _finalize_point_ids(this_locator, n_points, point_list);
 
-  /* Finalize timing */
+    w_end = ple_timer_wtime();
+    cpu_end = ple_timer_cpu_time();
 
-  w_end = ple_timer_wtime();
-  cpu_end = ple_timer_cpu_time();
+    this_locator->location_wtime[0] += (w_end - w_start);
+    this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
 
-  this_locator->location_wtime[0] += (w_end - w_start);
-  this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
+  }
 
-  this_locator->location_wtime[1] += comm_timing[0];
-  this_locator->location_cpu_time[1] += comm_timing[1];
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!incremental)
+    ple_locator_set_mesh(this_locator,
+                         mesh,
+                         options,
+                         tolerance_base,
+                         tolerance_fraction,
+                         dim,
+                         n_points,
+                         point_list,
+                         point_tag,
+                         point_coords,
+                         distance,
+                         mesh_extents_f,
+                         mesh_locate_f);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3328,6 +4583,152 @@ ple_locator_exchange_point_var(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Begin an asynchronous exchange of a variable defined on distant
+ * points.
+ *
+ * This function is the first half of ple_locator_exchange_point_var(),
+ * with the same arguments and semantics; local computation unrelated to
+ * the exchanged arrays may be overlapped with the communication between
+ * this call and the matching call to ple_locator_exchange_point_var_end(),
+ * which completes the exchange.
+ *
+ * In parallel mode, persistent MPI communication is set up on the first
+ * exchange and reused as long as the same arrays and parameters are
+ * passed, so repeated exchanges (such as those of coupling algorithms)
+ * avoid the setup latency. The distant_var array (and, in reverse mode
+ * only, the local_var array) must not be modified before the end call.
+ *
+ * Without MPI, the exchange is completed immediately and the end call
+ * is a no-op.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] local_var    variable defined on located local points
+ *                              (received); size: n_interior*stride
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_begin(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse)
+{
+  double w_start, w_end, cpu_start, cpu_end;
+
+  int mpi_flag = 0;
+  _Bool _reverse = reverse;
+
+  /* Initialize timing */
+
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
+
+#if defined(PLE_HAVE_MPI)
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to ple_locator_exchange_point_var() does\n"
+                  "not correspond to double or float."));
+
+    assert (datatype != MPI_DATATYPE_NULL);
+
+    _exchange_point_var_distant_begin(this_locator,
+                                      distant_var,
+                                      local_var,
+                                      local_list,
+                                      datatype,
+                                      stride,
+                                      _reverse);
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!mpi_flag)
+    _exchange_point_var_local(this_locator,
+                              distant_var,
+                              local_var,
+                              local_list,
+                              type_size,
+                              stride,
+                              _reverse);
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->exchange_wtime[0] += (w_end - w_start);
+  this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete an asynchronous exchange of a variable defined on
+ * distant points.
+ *
+ * Waits for the communication started by the matching call to
+ * ple_locator_exchange_point_var_begin() and distributes the received
+ * values; the exchanged arrays may be used again after this call.
+ *
+ * \param[in] this_locator pointer to locator structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_end(ple_locator_t  *this_locator)
+{
+  double w_start, w_end, cpu_start, cpu_end;
+
+  /* Initialize timing */
+
+  w_start = ple_timer_wtime();
+  cpu_start = ple_timer_cpu_time();
+
+#if defined(PLE_HAVE_MPI)
+
+  if (   this_locator->exchange_state != NULL
+      && this_locator->exchange_state->in_progress == 1)
+    _exchange_point_var_distant_end(this_locator);
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  /* Finalize timing */
+
+  w_end = ple_timer_wtime();
+  cpu_end = ple_timer_cpu_time();
+
+  this_locator->exchange_wtime[0] += (w_end - w_start);
+  this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return timing information.
@@ -301,6 +301,67 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                           ple_mesh_extents_t          *mesh_extents_f,
                           ple_mesh_elements_locate_t  *mesh_locate_f);
 
+/*----------------------------------------------------------------------------
+ * Update point locations incrementally after small displacements.
+ *
+ * Points previously located by ple_locator_set_mesh() are first
+ * re-located by the ranks which hosted them, using their new
+ * coordinates; only points lost by their previous host (i.e. whose new
+ * location distance exceeds max_distance) go through the full
+ * distributed search. When coupled meshes move by small displacements,
+ * almost all points stay on their previous host, so the cost of the
+ * global candidate search is avoided.
+ *
+ * Arguments are those of ple_locator_set_mesh(), plus the acceptance
+ * distance; as with that function, this function must be called
+ * simultaneously on all ranks of the locator's communicator. A full
+ * search is done when no previous location information is available,
+ * when the point set size has changed, or when point tags are used.
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   options            <-- options array (size PLE_LOCATOR_N_OPTIONS),
+ *                          or NULL
+ *   tolerance_base     <-- associated base tolerance (used for bounding
+ *                          box check only, not for location test)
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   dim                <-- spatial dimension of mesh and points to locate
+ *   max_distance       <-- maximum distance at which a point re-located
+ *                          by its previous host is accepted (1 keeps
+ *                          points inside volume elements)
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   distance           --> optional distance from point to matching element:
+ *                          < 0 if unlocated; 0 - 1 if inside and > 1 if
+ *                          outside a volume element, or absolute distance
+ *                          to a surface element (size: n_points)
+ *   mesh_extents_f     <-- pointer to function computing mesh extents
+ *   mesh_locate_f      <-- pointer to function wich updates the location[]
+ *                          and distance[] arrays associated with a set of
+ *                          points
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_relocate(ple_locator_t               *this_locator,
+                     const void                  *mesh,
+                     const int                   *options,
+                     float                        tolerance_base,
+                     float                        tolerance_fraction,
+                     int                          dim,
+                     float                        max_distance,
+                     ple_lnum_t                   n_points,
+                     const ple_lnum_t             point_list[],
+                     const ple_lnum_t             point_tag[],
+                     const ple_coord_t            point_coords[],
+                     float                        distance[],
+                     ple_mesh_extents_t          *mesh_extents_f,
+                     ple_mesh_elements_locate_t  *mesh_locate_f);
+
 /*----------------------------------------------------------------------------
  * Shift location ids for located points after locator initialization.
  *
@@ -463,6 +524,62 @@ ple_locator_exchange_point_var(ple_locator_t     *this_locator,
                                size_t             stride,
                                int                reverse);
 
+/*----------------------------------------------------------------------------
+ * Begin an asynchronous exchange of a variable defined on distant points.
+ *
+ * This function is the first half of ple_locator_exchange_point_var(),
+ * with the same arguments and semantics; local computation unrelated to
+ * the exchanged arrays may be overlapped with the communication between
+ * this call and the matching call to ple_locator_exchange_point_var_end(),
+ * which completes the exchange.
+ *
+ * In parallel mode, persistent MPI communication is set up on the first
+ * exchange and reused as long as the same arrays and parameters are
+ * passed, so repeated exchanges (such as those of coupling algorithms)
+ * avoid the setup latency. The distant_var array (and, in reverse mode
+ * only, the local_var array) must not be modified before the end call.
+ *
+ * Without MPI, the exchange is completed immediately and the end call
+ * is a no-op.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *                     size: n_dist_points*stride
+ *   local_var     <-> variable defined on located local points (received)
+ *                     size: n_interior*stride
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if nonzero, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_begin(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse);
+
+/*----------------------------------------------------------------------------
+ * Complete an asynchronous exchange of a variable defined on distant
+ * points.
+ *
+ * Waits for the communication started by the matching call to
+ * ple_locator_exchange_point_var_begin() and distributes the received
+ * values; the exchanged arrays may be used again after this call.
+ *
+ * parameters:
+ *   this_locator  <-> pointer to locator structure
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_end(ple_locator_t  *this_locator);
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
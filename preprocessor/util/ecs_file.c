@@ -86,6 +86,16 @@ extern "C" {
 #endif
 #endif /* __cplusplus */
 
+/*-----------------------------------------------------------------------------
+ * Local macro definitions
+ *-----------------------------------------------------------------------------*/
+
+/* Buffer size for binary file streams; import and output of large meshes
+   are dominated by sequential binary I/O, for which the default stdio
+   buffer is too small on parallel filesystems such as Lustre. */
+
+#define ECS_FILE_BUF_SIZE  (1024*1024*4)
+
 /*-----------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -752,6 +762,12 @@ ecs_file_open_stream(ecs_file_t       *f,
 
   }
 
+  /* Enlarge the stdio buffer for binary streams (must be done before
+     any other operation on the stream). */
+
+  if (f->ptr != NULL && f->type != ECS_FILE_TYPE_TEXT)
+    setvbuf(f->ptr, NULL, _IOFBF, ECS_FILE_BUF_SIZE);
+
   if (f->ptr == NULL
 #if defined(HAVE_ZLIB)
       && f->gzptr == NULL
@@ -91,12 +91,174 @@ BEGIN_C_DECLS
 
 */
 
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Persistent face selection associated with a volume zone: interior faces
+   of the zone, boundary faces of the zone on the domain boundary, and
+   boundary faces of the zone which are interior to the total mesh, with
+   the inside cell of each of the latter. Building these lists requires a
+   pass over all mesh faces, so they are cached between calls. */
+
+typedef struct {
+
+  cs_lnum_t     n_cells;        /* number of selected cells (match key) */
+  cs_lnum_t    *cell_ids;       /* selected cell ids (match key) */
+
+  cs_lnum_t     n_i_faces;      /* interior faces of the zone */
+  cs_lnum_t    *i_face_ids;
+  cs_lnum_t     n_bb_faces;     /* zone faces on the domain boundary */
+  cs_lnum_t    *bb_face_ids;
+  cs_lnum_t     n_bi_faces;     /* zone boundary faces interior to the mesh */
+  cs_lnum_t    *bi_face_ids;
+  cs_lnum_2_t  *bi_face_cells;  /* inside cell for each of those faces,
+                                   in the matching slot (as i_face_cells) */
+
+} _zone_face_index_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Cache of zone face selections, invalidated on mesh size change or
+   through cs_balance_by_zone_face_index_clear */
+
+static int                  _zfi_size = 0;
+static _zone_face_index_t  *_zfi = NULL;
+
+static cs_lnum_t  _zfi_n_cells = -1;    /* mesh signature */
+static cs_lnum_t  _zfi_n_i_faces = -1;
+static cs_lnum_t  _zfi_n_b_faces = -1;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*----------------------------------------------------------------------------
+ * Return the cached face selection associated with a volume zone, building
+ * it if needed.
+ *
+ * The cells_tag_ids array (1 for cells of the zone, 0 otherwise, with
+ * ghost values synchronized) is used for the face classification on a
+ * cache miss.
+ *
+ * parameters:
+ *   n_cells_sel   -->  number of selected cells
+ *   cell_sel_ids  -->  ids of selected cells
+ *   cells_tag_ids -->  cell tags (over cells + ghosts)
+ *
+ * returns:
+ *   pointer to the (cached) face selection of the zone
+ *----------------------------------------------------------------------------*/
+
+static const _zone_face_index_t *
+_zone_face_index(cs_lnum_t         n_cells_sel,
+                 const cs_lnum_t   cell_sel_ids[],
+                 const cs_lnum_t   cells_tag_ids[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  _zone_face_index_t *z = NULL;
+
+  /* Invalidate the cache if the mesh changed */
+
+  if (   m->n_cells != _zfi_n_cells
+      || n_i_faces != _zfi_n_i_faces
+      || n_b_faces != _zfi_n_b_faces) {
+    cs_balance_by_zone_face_index_clear();
+    _zfi_n_cells = m->n_cells;
+    _zfi_n_i_faces = n_i_faces;
+    _zfi_n_b_faces = n_b_faces;
+  }
+
+  /* Search for a selection matching the given cell list */
+
+  for (int i = 0; i < _zfi_size; i++) {
+    z = _zfi + i;
+    if (   z->n_cells == n_cells_sel
+        && memcmp(z->cell_ids,
+                  cell_sel_ids,
+                  n_cells_sel*sizeof(cs_lnum_t)) == 0)
+      return z;
+  }
+
+  /* Not cached yet: classify mesh faces with respect to the zone */
+
+  BFT_REALLOC(_zfi, _zfi_size + 1, _zone_face_index_t);
+  z = _zfi + _zfi_size;
+  _zfi_size += 1;
+
+  z->n_cells = n_cells_sel;
+  BFT_MALLOC(z->cell_ids, n_cells_sel, cs_lnum_t);
+  memcpy(z->cell_ids, cell_sel_ids, n_cells_sel*sizeof(cs_lnum_t));
+
+  z->n_i_faces = 0;
+  z->n_bb_faces = 0;
+  z->n_bi_faces = 0;
+  BFT_MALLOC(z->i_face_ids, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(z->bb_face_ids, n_b_faces, cs_lnum_t);
+  BFT_MALLOC(z->bi_face_ids, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(z->bi_face_cells, n_i_faces, cs_lnum_2_t);
+
+  /* Boundary faces of the mesh whose cell is in the zone */
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t c_id = b_face_cells[f_id];
+    if (cells_tag_ids[c_id] == 1) {
+      z->bb_face_ids[z->n_bb_faces] = f_id;
+      z->n_bb_faces += 1;
+    }
+  }
+
+  /* Interior faces of the mesh: either interior to the zone,
+     or on its boundary */
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    cs_lnum_t c_id1 = i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+    bool indic1 = (cells_tag_ids[c_id1] == 1);
+    bool indic2 = (cells_tag_ids[c_id2] == 1);
+
+    if (indic1 && indic2) {
+      z->i_face_ids[z->n_i_faces] = f_id;
+      z->n_i_faces += 1;
+    }
+    else if (indic1 || indic2) {
+      z->bi_face_ids[z->n_bi_faces] = f_id;
+      /* Build the faces -> cells connectivity as done in i_face_cells */
+      if (indic1) {
+        z->bi_face_cells[z->n_bi_faces][0] = c_id1;
+        z->bi_face_cells[z->n_bi_faces][1] = -999;
+      }
+      else {
+        z->bi_face_cells[z->n_bi_faces][0] = -999;
+        z->bi_face_cells[z->n_bi_faces][1] = c_id2;
+      }
+      z->n_bi_faces += 1;
+    }
+
+  }
+
+  BFT_REALLOC(z->i_face_ids, z->n_i_faces, cs_lnum_t);
+  BFT_REALLOC(z->bb_face_ids, z->n_bb_faces, cs_lnum_t);
+  BFT_REALLOC(z->bi_face_ids, z->n_bi_faces, cs_lnum_t);
+  BFT_REALLOC(z->bi_face_cells, z->n_bi_faces, cs_lnum_2_t);
+
+  return z;
+}
+
 /*----------------------------------------------------------------------------
  * Compute convection and diffusion contributions to the flux of a scalar at
  * a boundary face.
@@ -549,8 +711,7 @@ _balance_internal_faces(const int         iupwin,
                                 blencp,
                                 blend_st,
                                 weight,
-                                i_dist,
-                                i_face_surf,
+                                i_face_surf/i_dist,
                                 cell_ceni,
                                 cell_cenj,
                                 i_face_normal,
@@ -616,8 +777,7 @@ _balance_internal_faces(const int         iupwin,
                                   blencp,
                                   blend_st,
                                   weight,
-                                  i_dist,
-                                  i_face_surf,
+                                  i_face_surf/i_dist,
                                   cell_ceni,
                                   cell_cenj,
                                   i_face_normal,
@@ -828,12 +988,12 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   /* Zone cells selection variables*/
   cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = NULL;
+  const cs_lnum_t *i_face_sel_ids = NULL;
   cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = NULL;
+  const cs_lnum_t *bb_face_sel_ids = NULL;
   cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = NULL;
-  cs_lnum_2_t *bi_face_cells = NULL;
+  const cs_lnum_t *bi_face_sel_ids = NULL;
+  const cs_lnum_2_t *bi_face_cells = NULL;
   cs_lnum_t *cells_tag_ids = NULL;
 
   /* Initialize balance contributions
@@ -1007,29 +1167,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   /* Get user-selected zone
      ====================== */
 
-  /* Initialize arrays */
-
-  /* Internal faces of the selected zone */
-  BFT_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  BFT_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
-
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  BFT_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
-
   /* Synchronization for parallelism */
   BFT_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
@@ -1043,51 +1180,21 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     cs_halo_sync_num(halo, halo_type, cells_tag_ids);
   }
 
-  /* Classify mesh faces with respect to the selected zone */
-
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-
-    cs_lnum_t c_id = b_face_cells[f_id];
-
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
-    }
-  }
-
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-    bool indic1 = false;
-    bool indic2 = false;
-
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
-
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      bi_face_sel_ids[n_bi_faces_sel] = f_id;
-      n_bi_faces_sel++;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
-    }
-
+  /* Face selections are cached, so repeated balances (zone monitoring)
+     do not pay a full-mesh face classification at each time step */
+
+  {
+    const _zone_face_index_t *zfi = _zone_face_index(n_cells_sel,
+                                                     cell_sel_ids,
+                                                     cells_tag_ids);
+
+    n_i_faces_sel = zfi->n_i_faces;
+    i_face_sel_ids = zfi->i_face_ids;
+    n_bb_faces_sel = zfi->n_bb_faces;
+    bb_face_sel_ids = zfi->bb_face_ids;
+    n_bi_faces_sel = zfi->n_bi_faces;
+    bi_face_sel_ids = zfi->bi_face_ids;
+    bi_face_cells = (const cs_lnum_2_t *)zfi->bi_face_cells;
   }
 
   /* Compute the balance at time step n
@@ -1140,8 +1247,8 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
     cs_lnum_t f_id_sel = bi_face_sel_ids[f_id];
     /* Associated boundary-internal cells */
-    cs_lnum_t c_id1 = bi_face_cells[f_id_sel][0];
-    cs_lnum_t c_id2 = bi_face_cells[f_id_sel][1];
+    cs_lnum_t c_id1 = bi_face_cells[f_id][0];
+    cs_lnum_t c_id2 = bi_face_cells[f_id][1];
 
     /* Contribution to flux from the only cell of the current face
        lying inside the selected zone
@@ -1386,7 +1493,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
     /* (The cell is counted only once in parallel by checking that
        the c_id is not in the halo) */
     /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
+    if (bi_face_cells[f_id][0] >= 0) {
       if (c_id1 < n_cells) {
         if (i_mass_flux[f_id_sel] > 0)
           bi_o_balance -= bi_bterms[0]*dt[c_id1];
@@ -1406,7 +1513,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   }
 
-  /* Free memory */
+  /* Free memory (face selections are kept in the zone cache) */
 
   BFT_FREE(grad);
   BFT_FREE(gradup);
@@ -1420,10 +1527,6 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   BFT_FREE(b_visc);
 
   BFT_FREE(cells_tag_ids);
-  BFT_FREE(bi_face_cells);
-  BFT_FREE(i_face_sel_ids);
-  BFT_FREE(bb_face_sel_ids);
-  BFT_FREE(bi_face_sel_ids);
 
   /* Sum of values on all ranks (parallel calculations) */
 
@@ -1556,6 +1659,79 @@ cs_balance_by_zone(const char  *selection_crit,
      balance[CS_BALANCE_TOTAL], balance[CS_BALANCE_TOTAL_NORMALIZED]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the balance of a given scalar on several volume zones.
+ *
+ * This is a batched form of \ref cs_balance_by_zone_compute for zone
+ * monitoring: balances are returned without logging, and the face
+ * selection of each zone is cached, so repeated calls (for example at
+ * each time step) only loop on zone-local faces after the first call.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     selection_crits     selection criteria of each zone
+ * \param[in]     scalar_name         scalar name
+ * \param[out]    balance             computed balance terms of each zone
+ *                                    (of size n_zones * CS_BALANCE_N_TERMS,
+ *                                    see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_n(int           n_zones,
+                     const char  **selection_crits,
+                     const char   *scalar_name,
+                     cs_real_t    *balance)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_lnum_t n_cells_sel = 0;
+  cs_lnum_t *cells_sel_ids = NULL;
+
+  BFT_MALLOC(cells_sel_ids, m->n_cells, cs_lnum_t);
+
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+
+    cs_selector_get_cell_list(selection_crits[z_id],
+                              &n_cells_sel,
+                              cells_sel_ids);
+
+    cs_balance_by_zone_compute(scalar_name,
+                               n_cells_sel,
+                               cells_sel_ids,
+                               balance + z_id*CS_BALANCE_N_TERMS);
+
+  }
+
+  BFT_FREE(cells_sel_ids);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Clear the cached face selections of volume zone balances.
+ *
+ * The cache is also cleared automatically when the local mesh size
+ * changes; this function should be called when the mesh is modified
+ * without a size change (for example when cells move between ranks or
+ * coordinates only are updated).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_face_index_clear(void)
+{
+  for (int i = 0; i < _zfi_size; i++) {
+    BFT_FREE(_zfi[i].cell_ids);
+    BFT_FREE(_zfi[i].i_face_ids);
+    BFT_FREE(_zfi[i].bb_face_ids);
+    BFT_FREE(_zfi[i].bi_face_ids);
+    BFT_FREE(_zfi[i].bi_face_cells);
+  }
+
+  BFT_FREE(_zfi);
+  _zfi_size = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
@@ -1580,8 +1756,6 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const cs_lnum_t n_i_faces = m->n_i_faces;
-  const cs_lnum_t n_b_faces = m->n_b_faces;
 
   const cs_lnum_2_t *restrict i_face_cells
     = (const cs_lnum_2_t *restrict)m->i_face_cells;
@@ -1616,13 +1790,11 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
                          cs_glob_physical_constants->gravity[2]};
 
   /* Zone cells selection variables*/
-  cs_lnum_t n_i_faces_sel = 0;
-  cs_lnum_t *i_face_sel_ids = NULL;
   cs_lnum_t n_bb_faces_sel = 0;
-  cs_lnum_t *bb_face_sel_ids = NULL;
+  const cs_lnum_t *bb_face_sel_ids = NULL;
   cs_lnum_t n_bi_faces_sel = 0;
-  cs_lnum_t *bi_face_sel_ids = NULL;
-  cs_lnum_2_t *bi_face_cells = NULL;
+  const cs_lnum_t *bi_face_sel_ids = NULL;
+  const cs_lnum_2_t *bi_face_cells = NULL;
   cs_lnum_t *cells_tag_ids = NULL;
 
   /* Initialization of balance contributions
@@ -1672,30 +1844,6 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
   /* Get user-selected zone
      ====================== */
 
-  /* Initialize arrays */
-
-  /* Internal faces of the selected zone */
-  BFT_MALLOC(i_face_sel_ids, n_i_faces, cs_lnum_t);
-  /* Boundary faces of the selected zone,
-     which are internal faces of the global mesh.
-     Faces -> cells connectivity */
-  BFT_MALLOC(bi_face_sel_ids, n_i_faces, cs_lnum_t);
-  BFT_MALLOC(bi_face_cells, n_i_faces, cs_lnum_2_t);
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    i_face_sel_ids[f_id] = -1;
-    bi_face_sel_ids[f_id] = -1;
-    bi_face_cells[f_id][0] = -999;
-    bi_face_cells[f_id][1] = -999;
-  }
-
-  /* Boundary faces of the selected zone,
-     which are also boundary faces of the global mesh */
-  BFT_MALLOC(bb_face_sel_ids, n_b_faces, cs_lnum_t);
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-    bb_face_sel_ids[f_id] = -1;
-  }
-
-
   /* Synchronization for parallelism */
   BFT_MALLOC(cells_tag_ids, n_cells_ext, cs_lnum_t);
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
@@ -1709,51 +1857,19 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     cs_halo_sync_num(halo, CS_HALO_STANDARD, cells_tag_ids);
   }
 
-  /* Classify mesh faces with respect to the selected zone */
-
-  /* Check boundary faces:
-     if they are in the selected zone, they are boundary as well */
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-
-    cs_lnum_t c_id = b_face_cells[f_id];
-
-    if (cells_tag_ids[c_id] == 1) {
-      n_bb_faces_sel++;
-      bb_face_sel_ids[n_bb_faces_sel-1] = f_id;
-    }
-  }
-
-  /* Check internal faces:
-     if they are in the selected zone, they can be either
-     internal or boundary faces */
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-    bool indic1 = false;
-    bool indic2 = false;
+  /* Face selections are cached, so repeated balances (zone monitoring)
+     do not pay a full-mesh face classification at each time step */
 
-    if (cells_tag_ids[c_id1] == 1)
-      indic1 = true;
-    if (cells_tag_ids[c_id2] == 1)
-      indic2 = true;
-
-    if (indic1 && indic2) {
-      n_i_faces_sel++;
-      i_face_sel_ids[n_i_faces_sel-1] = f_id;
-    }
-    else if (indic1 || indic2) {
-      n_bi_faces_sel++;
-      bi_face_sel_ids[n_bi_faces_sel-1] = f_id;
-      /* Build the faces -> cells connectivity as done in
-         i_face_cells */
-      if (indic1)
-        bi_face_cells[f_id][0] = c_id1;
-      else
-        bi_face_cells[f_id][1] = c_id2;
-    }
+  {
+    const _zone_face_index_t *zfi = _zone_face_index(n_cells_sel,
+                                                     cell_sel_ids,
+                                                     cells_tag_ids);
 
+    n_bb_faces_sel = zfi->n_bb_faces;
+    bb_face_sel_ids = zfi->bb_face_ids;
+    n_bi_faces_sel = zfi->n_bi_faces;
+    bi_face_sel_ids = zfi->bi_face_ids;
+    bi_face_cells = (const cs_lnum_2_t *)zfi->bi_face_cells;
   }
 
   /* Balance computation
@@ -1939,7 +2055,7 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     /* (The cell is counted only once in parallel by checking that
        the c_id is not in the halo) */
     /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
+    if (bi_face_cells[f_id][0] >= 0) {
       if (c_id1 < n_cells) {
         if (i_mass_flux[f_id_sel] > 0) {
           out_pressure += bi_bterms[0];
@@ -2003,7 +2119,7 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     /* (The cell is counted only once in parallel by checking that
        the c_id is not in the halo) */
     /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
+    if (bi_face_cells[f_id][0] >= 0) {
       if (c_id1 < n_cells) {
         if (i_mass_flux[f_id_sel] > 0) {
           out_u2 += bi_bterms[0];
@@ -2059,7 +2175,7 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
     /* (The cell is counted only once in parallel by checking that
        the c_id is not in the halo) */
     /* Face normal well oriented (check bi_face_cells array) */
-    if (bi_face_cells[f_id_sel][0] >= 0) {
+    if (bi_face_cells[f_id][0] >= 0) {
       if (c_id1 < n_cells) {
         if (i_mass_flux[f_id_sel] > 0) {
           out_rhogx += bi_bterms[0];
@@ -2081,13 +2197,9 @@ cs_pressure_drop_by_zone_compute(cs_lnum_t        n_cells_sel,
 
   }
 
-  /* Free memory */
+  /* Free memory (face selections are kept in the zone cache) */
 
   BFT_FREE(cells_tag_ids);
-  BFT_FREE(bi_face_cells);
-  BFT_FREE(i_face_sel_ids);
-  BFT_FREE(bb_face_sel_ids);
-  BFT_FREE(bi_face_sel_ids);
 
   /* Sum of values on all ranks (parallel calculations) */
 
@@ -158,6 +158,44 @@ void
 cs_balance_by_zone(const char  *selection_crit,
                    const char  *scalar_name);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the balance of a given scalar on several volume zones.
+ *
+ * This is a batched form of \ref cs_balance_by_zone_compute for zone
+ * monitoring: balances are returned without logging, and the face
+ * selection of each zone is cached, so repeated calls (for example at
+ * each time step) only loop on zone-local faces after the first call.
+ *
+ * \param[in]     n_zones             number of zones
+ * \param[in]     selection_crits     selection criteria of each zone
+ * \param[in]     scalar_name         scalar name
+ * \param[out]    balance             computed balance terms of each zone
+ *                                    (of size n_zones * CS_BALANCE_N_TERMS,
+ *                                    see \ref cs_balance_term_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_n(int           n_zones,
+                     const char  **selection_crits,
+                     const char   *scalar_name,
+                     cs_real_t    *balance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Clear the cached face selections of volume zone balances.
+ *
+ * The cache is also cleared automatically when the local mesh size
+ * changes; this function should be called when the mesh is modified
+ * without a size change (for example when cells move between ranks or
+ * coordinates only are updated).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_balance_by_zone_face_index_clear(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes one term of the head loss balance (pressure drop) on a
@@ -76,6 +76,7 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
@@ -131,6 +132,11 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
      {N_("Block y <- A.x"),
       N_("Block y <- (A-D).x")}};
 
+/* Measured STREAM triad bandwidth (GB/s, per rank), used as a baseline
+   for the bandwidth-bound kernels of this file; < 0 if not measured yet */
+
+static double  _stream_triad_bw = -1.;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -223,6 +229,209 @@ _print_stats(long    n_runs,
   cs_log_printf_flush(CS_LOG_PERFORMANCE);
 }
 
+/*----------------------------------------------------------------------------
+ * Print bandwidth-related statistics.
+ *
+ * When a STREAM triad baseline has been measured, the fraction of that
+ * baseline achieved by the measured operation is also reported, so as to
+ * indicate how far a given kernel is from the memory bandwidth roofline.
+ *
+ * parameters:
+ *   n_runs  <-- Local number of runs
+ *   n_bytes <-- Local number of bytes moved per run (estimated)
+ *   wt      <-- wall-clock time
+ *----------------------------------------------------------------------------*/
+
+static void
+_print_mem_stats(long    n_runs,
+                 long    n_bytes,
+                 double  wt)
+{
+  double bm = 1.0 * n_runs / (1.e9 * (CS_MAX(wt, 1)));
+
+  if (cs_glob_n_ranks == 1) {
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  N bytes:     %12ld\n"
+                    "  Wall clock:  %12.5e\n"
+                    "  GB/s:        %12.5e\n"),
+                  n_bytes, wt/n_runs, n_bytes*bm);
+    if (_stream_triad_bw > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  %% of triad:  %12.3f\n"),
+                    n_bytes*bm*100. / _stream_triad_bw);
+  }
+
+#if defined(HAVE_MPI)
+
+  else {
+
+    long n_bytes_min, n_bytes_max, n_bytes_tot;
+    double loc_count[2], glob_sum[2], glob_min[2], glob_max[2], bmg;
+
+    loc_count[0] = wt;
+    loc_count[1] = n_bytes*bm;
+
+    MPI_Allreduce(&n_bytes, &n_bytes_min, 1, MPI_LONG, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(&n_bytes, &n_bytes_max, 1, MPI_LONG, MPI_MAX,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(&n_bytes, &n_bytes_tot, 1, MPI_LONG, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    MPI_Allreduce(loc_count, glob_min, 2, MPI_DOUBLE, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(loc_count, glob_max, 2, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(loc_count, glob_sum, 2, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    /* global bandwidth multiplier */
+    bmg = n_runs / (1.e9 * CS_MAX(glob_max[0], 1));
+
+    glob_sum[0] /= n_runs;
+    glob_min[0] /= n_runs;
+    glob_max[0] /= n_runs;
+
+    cs_log_printf
+      (CS_LOG_PERFORMANCE,
+       _("               Mean         Min          Max          Total\n"
+         "  N bytes:     %12ld %12ld %12ld %12ld\n"
+         "  Wall clock:  %12.5e %12.5e %12.5e\n"
+         "  GB/s:        %12.5e %12.5e %12.5e %12.5e\n"),
+       n_bytes_tot/cs_glob_n_ranks, n_bytes_min, n_bytes_max, n_bytes_tot,
+       glob_sum[0]/cs_glob_n_ranks, glob_min[0], glob_max[0],
+       glob_sum[1]/cs_glob_n_ranks, glob_min[1], glob_max[1],
+       n_bytes_tot*bmg);
+
+    if (_stream_triad_bw > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  %% of triad:  %12.3f\n"),
+                    glob_sum[1]*100. / (cs_glob_n_ranks*_stream_triad_bw));
+  }
+
+#endif
+
+  cs_log_printf_flush(CS_LOG_PERFORMANCE);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure local memory bandwidth using STREAM-like copy and triad kernels.
+ *
+ * The triad result is kept as a per-rank baseline against which the
+ * bandwidth-bound kernels of this file are compared.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+static void
+_stream_test(double  t_measure)
+{
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_bytes;
+
+  double test_sum = 0.0;
+  cs_real_t *a = NULL, *b = NULL, *c = NULL;
+
+  const cs_real_t scalar = 3.0;
+
+  /* Use arrays at least as large as the local mesh, with a floor
+     ensuring the working set exceeds cache levels on small test meshes */
+
+  const cs_lnum_t n = CS_MAX((cs_lnum_t)(cs_glob_mesh->n_cells_with_ghosts),
+                             (cs_lnum_t)4194304);
+
+  BFT_MALLOC(a, n, cs_real_t);
+  BFT_MALLOC(b, n, cs_real_t);
+  BFT_MALLOC(c, n, cs_real_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    a[ii] = 1.0;
+    b[ii] = 2.0;
+    c[ii] = 0.0;
+  }
+
+  /* Copy: c <- a (1 load + 1 store per element) */
+
+  n_bytes = (long)n * sizeof(cs_real_t) * 2;
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < n; ii++)
+        c[ii] = a[ii];
+      test_sum += c[n-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Memory bandwidth, copy (c <- a)\n"
+                  "----------------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+
+  /* Triad: a <- b + scalar.c (2 loads + 1 store per element) */
+
+  n_bytes = (long)n * sizeof(cs_real_t) * 3;
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+#     pragma omp parallel for
+      for (cs_lnum_t ii = 0; ii < n; ii++)
+        a[ii] = b[ii] + scalar*c[ii];
+      test_sum += a[n-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  _stream_triad_bw = n_bytes * (1.0 * n_runs / (1.e9 * (CS_MAX(wt1-wt0, 1))));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Memory bandwidth, triad (a <- b + s.c)\n"
+                  "-----------------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+
+  BFT_FREE(c);
+  BFT_FREE(b);
+  BFT_FREE(a);
+}
+
 /*----------------------------------------------------------------------------
  * Measure matrix.vector product related performance.
  *
@@ -748,6 +957,534 @@ _sub_matrix_vector_test(double               t_measure,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Upwind convection + diffusion face flux kernel.
+ *
+ * This reproduces the access pattern of the assembly of the upwind part
+ * of explicit balances in cs_convection_diffusion_scalar.
+ *
+ * parameters:
+ *   n_faces    <-- local number of internal faces
+ *   face_cell  <-- face -> cells connectivity
+ *   i_massflux <-- mass flux at interior faces
+ *   i_visc     <-- diffusion coefficient at interior faces
+ *   x          <-- variable values
+ *   y          <-> assembled right-hand side
+ *----------------------------------------------------------------------------*/
+
+static void
+_face_flux_upwind(cs_lnum_t            n_faces,
+                  const cs_lnum_2_t   *face_cell,
+                  const cs_real_t     *restrict i_massflux,
+                  const cs_real_t     *restrict i_visc,
+                  const cs_real_t     *restrict x,
+                  cs_real_t           *restrict y)
+{
+  cs_lnum_t  ii, jj, face_id;
+
+  /* Tell IBM compiler not to alias */
+#if defined(__xlc__)
+#pragma disjoint(*x, *y, *i_massflux, *i_visc)
+#endif
+
+  const cs_lnum_t *restrict face_cel_p
+    = (const cs_lnum_t *restrict)face_cell;
+
+  for (face_id = 0; face_id < n_faces; face_id++) {
+    ii = *face_cel_p++;
+    jj = *face_cel_p++;
+    cs_real_t flui = 0.5*(i_massflux[face_id] + fabs(i_massflux[face_id]));
+    cs_real_t fluj = 0.5*(i_massflux[face_id] - fabs(i_massflux[face_id]));
+    cs_real_t flux =   flui*x[ii] + fluj*x[jj]
+                     + i_visc[face_id]*(x[ii] - x[jj]);
+    y[ii] -= flux;
+    y[jj] += flux;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Measure upwind convection + diffusion flux assembly performance.
+ *
+ * parameters:
+ *   t_measure   <-- minimum time for each measure (< 0 for single pass)
+ *   n_cells     <-- number of cells
+ *   n_cells_ext <-- number of cells including ghost cells (array size)
+ *   n_faces     <-- local number of internal faces
+ *   face_cell   <-- face -> cells connectivity
+ *   i_massflux  <-- mass flux at interior faces
+ *   i_visc      <-- diffusion coefficient at interior faces
+ *   x           <-- variable values
+ *   y           <-> work and result array
+ *----------------------------------------------------------------------------*/
+
+static void
+_face_flux_test(double               t_measure,
+                cs_lnum_t            n_cells,
+                cs_lnum_t            n_cells_ext,
+                cs_lnum_t            n_faces,
+                const cs_lnum_2_t   *face_cell,
+                const cs_real_t     *restrict i_massflux,
+                const cs_real_t     *restrict i_visc,
+                cs_real_t           *restrict x,
+                cs_real_t           *restrict y)
+{
+  cs_lnum_t  jj;
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob, n_bytes;
+
+  double test_sum = 0.0;
+
+  /* 11 ops per face (2 abs counted as 1 op each) */
+
+  n_ops = n_faces*11;
+
+  if (cs_glob_n_ranks == 1)
+    n_ops_glob = n_ops;
+  else
+    n_ops_glob = cs_glob_mesh->n_g_i_faces*11;
+
+  /* Minimum useful data movement, assuming perfect caching of cell values */
+
+  n_bytes =   (long)n_faces*(2*sizeof(cs_lnum_t) + 2*sizeof(cs_real_t))
+            + (long)n_cells*3*sizeof(cs_real_t);
+
+  for (jj = 0; jj < n_cells_ext; jj++)
+    y[jj] = 0.0;
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+      _face_flux_upwind(n_faces, face_cell, i_massflux, i_visc, x, y);
+      test_sum += y[n_cells-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Face flux assembly, upwind convection + diffusion\n"
+                  "------------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure Jacobi smoother sweep related performance.
+ *
+ * This reproduces the memory access pattern of one sweep of the Jacobi
+ * smoother used by the algebraic multigrid on a native (face-based)
+ * matrix, including the halo update of the iterate.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   mesh      <-- pointer to mesh structure
+ *   da        <-- diagonal values
+ *   xa        <-- extradiagonal values
+ *   x         <-- iterate values
+ *   y         <-> updated iterate values
+ *----------------------------------------------------------------------------*/
+
+static void
+_jacobi_test(double            t_measure,
+             const cs_mesh_t  *mesh,
+             const cs_real_t  *restrict da,
+             const cs_real_t  *restrict xa,
+             const cs_real_t  *restrict x,
+             cs_real_t        *restrict y)
+{
+  cs_lnum_t  ii, jj, face_id;
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_ops, n_ops_glob, n_bytes;
+
+  double test_sum = 0.0;
+  cs_real_t *rhs = NULL;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_faces = mesh->n_i_faces;
+  const cs_lnum_t *restrict face_cel_p
+    = (const cs_lnum_t *restrict)mesh->i_face_cells;
+
+  BFT_MALLOC(rhs, n_cells, cs_real_t);
+  for (ii = 0; ii < n_cells; ii++)
+    rhs[ii] = 1.0;
+
+  /* 4 ops per face (2 multiply-subtract pairs),
+     1 division per cell */
+
+  n_ops = n_faces*4 + n_cells;
+
+  if (cs_glob_n_ranks == 1)
+    n_ops_glob = n_ops;
+  else
+    n_ops_glob = cs_glob_mesh->n_g_i_faces*4 + cs_glob_mesh->n_g_cells;
+
+  /* Minimum useful data movement, assuming perfect caching of cell values */
+
+  n_bytes =   (long)n_faces*(2*sizeof(cs_lnum_t) + 2*sizeof(cs_real_t))
+            + (long)n_cells*4*sizeof(cs_real_t);
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+
+      /* One sweep: y <- (rhs - (A-D).x) / D */
+
+      for (ii = 0; ii < n_cells; ii++)
+        y[ii] = rhs[ii];
+
+      const cs_lnum_t *restrict fc_p = face_cel_p;
+      for (face_id = 0; face_id < n_faces; face_id++) {
+        ii = *fc_p++;
+        jj = *fc_p++;
+        y[ii] -= xa[face_id*2]     * x[jj];
+        y[jj] -= xa[face_id*2 + 1] * x[ii];
+      }
+
+      for (ii = 0; ii < n_cells; ii++)
+        y[ii] /= da[ii];
+
+      if (mesh->halo != NULL)
+        cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, y);
+
+      test_sum += y[n_cells-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Jacobi smoother sweep, native matrix\n"
+                  "---------------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_stats(n_runs, n_ops, n_ops_glob, wt1 - wt0);
+  _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+
+  BFT_FREE(rhs);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure scalar gradient reconstruction performance.
+ *
+ * Both the iterative and least-squares gradients are timed, on a linear
+ * synthetic variable with homogeneous Neumann boundary conditions.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_test(double  t_measure)
+{
+  cs_lnum_t ii;
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_bytes;
+
+  double test_sum = 0.0;
+
+  cs_real_t *var = NULL, *coefap = NULL, *coefbp = NULL;
+  cs_real_3_t *grad = NULL;
+
+  const cs_mesh_t *mesh = cs_glob_mesh;
+  const cs_mesh_quantities_t *mesh_v = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_faces = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+
+  BFT_MALLOC(var, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+  BFT_MALLOC(coefap, n_b_faces, cs_real_t);
+  BFT_MALLOC(coefbp, n_b_faces, cs_real_t);
+
+  for (ii = 0; ii < n_cells_ext; ii++)
+    var[ii] = mesh_v->cell_cen[ii*3];
+
+  /* Homogeneous Neumann boundary conditions */
+
+  for (ii = 0; ii < n_b_faces; ii++) {
+    coefap[ii] = 0.;
+    coefbp[ii] = 1.;
+  }
+
+  /* Minimum useful data movement, assuming perfect caching of cell values
+     (variable, gradient, and local geometric coefficients for cells,
+     connectivity and weighting data for faces); operation counts depend
+     on the variant and reconstruction sweeps, so only memory throughput
+     is reported here */
+
+  n_bytes =   (long)n_cells*10*sizeof(cs_real_t)
+            + (long)n_faces*(2*sizeof(cs_lnum_t) + 3*sizeof(cs_real_t));
+
+  for (int g_id = 0; g_id < 2; g_id++) {
+
+    cs_gradient_type_t gradient_type
+      = (g_id == 0) ? CS_GRADIENT_ITER : CS_GRADIENT_LSQ;
+    int n_r_sweeps = (g_id == 0) ? 2 : 1;
+
+    /* Warm up, computing geometric quantities outside of timings */
+
+    cs_gradient_scalar("benchmark",
+                       gradient_type,
+                       CS_HALO_STANDARD,
+                       1,       /* inc */
+                       true,    /* recompute_cocg */
+                       n_r_sweeps,
+                       0,       /* tr_dim */
+                       0,       /* hyd_p_flag */
+                       1,       /* w_stride */
+                       0,       /* verbosity */
+                       -1,      /* clip_mode */
+                       1e-5,    /* epsilon */
+                       0.,      /* extrap */
+                       1.5,     /* clip_coeff */
+                       NULL,    /* f_ext */
+                       coefap,
+                       coefbp,
+                       var,
+                       NULL,    /* c_weight */
+                       NULL,    /* cpl */
+                       grad);
+
+    test_sum = 0.0;
+    wt0 = cs_timer_wtime(), wt1 = wt0;
+    if (t_measure > 0)
+      n_runs = 8;
+    else
+      n_runs = 1;
+    run_id = 0;
+    while (run_id < n_runs) {
+      double test_sum_mult = 1.0/n_runs;
+      while (run_id < n_runs) {
+        cs_gradient_scalar("benchmark",
+                           gradient_type,
+                           CS_HALO_STANDARD,
+                           1,       /* inc */
+                           false,   /* recompute_cocg */
+                           n_r_sweeps,
+                           0,       /* tr_dim */
+                           0,       /* hyd_p_flag */
+                           1,       /* w_stride */
+                           0,       /* verbosity */
+                           -1,      /* clip_mode */
+                           1e-5,    /* epsilon */
+                           0.,      /* extrap */
+                           1.5,     /* clip_coeff */
+                           NULL,    /* f_ext */
+                           coefap,
+                           coefbp,
+                           var,
+                           NULL,    /* c_weight */
+                           NULL,    /* cpl */
+                           grad);
+        test_sum += grad[n_cells-1][0]*test_sum_mult;
+        run_id++;
+      }
+      wt1 = cs_timer_wtime();
+      if (wt1 - wt0 < t_measure)
+        n_runs *= 2;
+    }
+
+    if (g_id == 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n"
+                      "Scalar gradient reconstruction, iterative\n"
+                      "------------------------------\n"));
+    else
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n"
+                      "Scalar gradient reconstruction, least-squares\n"
+                      "------------------------------\n"));
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  (calls: %d;  test sum: %12.5f)\n"),
+                  n_runs, test_sum);
+
+    _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+
+  }
+
+  BFT_FREE(coefbp);
+  BFT_FREE(coefap);
+  BFT_FREE(grad);
+  BFT_FREE(var);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure halo exchange performance.
+ *
+ * Scalar and strided synchronizations are timed, as well as the
+ * start/finish pair allowing communication/computation overlap.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure (< 0 for single pass)
+ *   mesh      <-- pointer to mesh structure
+ *   x         <-> scalar work array (n_cells_with_ghosts)
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_test(double            t_measure,
+           const cs_mesh_t  *mesh,
+           cs_real_t        *restrict x)
+{
+  cs_lnum_t ii;
+  double wt0, wt1;
+  int    run_id, n_runs;
+  long   n_bytes;
+
+  double test_sum = 0.0;
+  cs_real_t *xs = NULL;
+
+  const cs_halo_t *halo = mesh->halo;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+
+  if (halo == NULL)
+    return;
+
+  /* Bytes sent plus bytes received per exchange */
+
+  n_bytes = (long)(halo->n_send_elts[1] + halo->n_elts[1])*sizeof(cs_real_t);
+
+  /* Blocking scalar exchange */
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+      cs_halo_sync_var(halo, CS_HALO_STANDARD, x);
+      test_sum += x[n_cells_ext-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Halo exchange, scalar\n"
+                  "-------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+
+  /* Split scalar exchange (start/finish pair, without overlapped work,
+     so as to measure the overhead of splitting alone) */
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+      cs_halo_sync_var_start(halo, CS_HALO_STANDARD, x);
+      cs_halo_sync_var_finish(halo, CS_HALO_STANDARD, x);
+      test_sum += x[n_cells_ext-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Halo exchange, scalar, split start/finish\n"
+                  "-------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_mem_stats(n_runs, n_bytes, wt1 - wt0);
+
+  /* Strided exchange (stride 3, as for gradients) */
+
+  BFT_MALLOC(xs, n_cells_ext*3, cs_real_t);
+  for (ii = 0; ii < n_cells_ext; ii++) {
+    xs[ii*3]     = x[ii];
+    xs[ii*3 + 1] = x[ii];
+    xs[ii*3 + 2] = x[ii];
+  }
+
+  test_sum = 0.0;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+  if (t_measure > 0)
+    n_runs = 8;
+  else
+    n_runs = 1;
+  run_id = 0;
+  while (run_id < n_runs) {
+    double test_sum_mult = 1.0/n_runs;
+    while (run_id < n_runs) {
+      cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, xs, 3);
+      test_sum += xs[n_cells_ext*3-1]*test_sum_mult;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Halo exchange, strided (stride 3)\n"
+                  "-------------\n"));
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  (calls: %d;  test sum: %12.5f)\n"),
+                n_runs, test_sum);
+
+  _print_mem_stats(n_runs, n_bytes*3, wt1 - wt0);
+
+  BFT_FREE(xs);
+}
+
 /*----------------------------------------------------------------------------
  * Copy array to reference for matrix computation check.
  *
@@ -1206,6 +1943,11 @@ cs_benchmark(int  mpi_trace_mode)
                   "Benchmark mode activated\n"
                   "========================\n"));
 
+  /* Measure memory bandwidth baseline */
+  /*-----------------------------------*/
+
+  _stream_test(t_measure);
+
   /* Run some feature tests */
   /*------------------------*/
 
@@ -1316,6 +2058,40 @@ cs_benchmark(int  mpi_trace_mode)
                           x,
                           y);
 
+  /* Operator micro-benchmarks */
+  /*---------------------------*/
+
+  {
+    cs_real_t *i_massflux = NULL, *i_visc = NULL;
+
+    BFT_MALLOC(i_massflux, n_faces, cs_real_t);
+    BFT_MALLOC(i_visc, n_faces, cs_real_t);
+
+    for (ii = 0; ii < n_faces; ii++) {
+      i_massflux[ii] = mesh_v->i_face_normal[ii*3];
+      i_visc[ii] = 0.2;
+    }
+
+    _face_flux_test(t_measure,
+                    n_cells,
+                    n_cells_ext,
+                    n_faces,
+                    i_face_cells,
+                    i_massflux,
+                    i_visc,
+                    x,
+                    y);
+
+    BFT_FREE(i_visc);
+    BFT_FREE(i_massflux);
+  }
+
+  _jacobi_test(t_measure, mesh, da, xa, x, y);
+
+  _gradient_test(t_measure);
+
+  _halo_test(t_measure, mesh, x);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
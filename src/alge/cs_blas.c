@@ -37,6 +37,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_mem.h"
+
 #include "cs_base.h"
 #include "cs_parall.h"
 
@@ -66,6 +68,13 @@ BEGIN_C_DECLS
        Reduction based on l3superblock60 algorithm, described in
        \cite Castaldo:2008
 
+  \var CS_BLAS_REDUCE_DETERMINISTIC
+       Reduction based on partial sums over fixed-size blocks, combined
+       in a pairwise tree whose shape depends only on the array size;
+       local results are bitwise reproducible from one run to the next
+       and independent of the number of threads (though not of the
+       domain partitioning)
+
   \var CS_BLAS_REDUCE_KAHAN
        Reduction based on Kahan's compensated summation, described in
        \cite Kahan:1965
@@ -81,9 +90,16 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
-/* Block size for superblock algorithm */
+/* Block size for superblock algorithm; a multiple of the vector size,
+   so blocks map to whole SIMD lanes */
+
+#define CS_SBLOCK_BLOCK_SIZE 64
 
-#define CS_SBLOCK_BLOCK_SIZE 60
+/* Block size for deterministic reduction; partial sums are computed
+   over blocks of this fixed size, so the summation tree depends only
+   on the array size, not on the number of threads */
+
+#define CS_RBLOCK_BLOCK_SIZE 256
 
 /* Cache line multiple, in cs_real_t units */
 
@@ -223,6 +239,33 @@ _sbloc_sizes(cs_lnum_t   n,
   *blocks_in_sblocks = (n + n_b - 1) / n_b;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Combine per-block partial sums using a pairwise tree.
+ *
+ * The combination order depends only on the number of blocks, so for
+ * partial sums computed over fixed-size blocks, the result does not
+ * depend on the number of threads. The s array is modified in place.
+ *
+ * \param[in]       n_blocks  number of partial sums
+ * \param[in, out]  s         array of partial sums
+ *
+ * \return  sum of all partial sums
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_block_pairwise_sum(cs_lnum_t   n_blocks,
+                    double     *s)
+{
+  for (cs_lnum_t stride = 1; stride < n_blocks; stride *= 2) {
+    for (cs_lnum_t i = 0; i + stride < n_blocks; i += 2*stride)
+      s[i] += s[i + stride];
+  }
+
+  return s[0];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the dot product of 2 vectors: x.y
@@ -266,9 +309,26 @@ _cs_dot_superblock(cs_lnum_t         n,
         cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
         if (end_id > _n)
           end_id = _n;
+        double d[CS_VS];
+        for (cs_lnum_t j = 0; j < CS_VS; j++)
+          d[j] = 0.0;
+
+        /* vector multiple */
+
+        cs_lnum_t nv_id = start_id + ((end_id - start_id)/CS_VS)*CS_VS;
+        for (cs_lnum_t i = start_id; i < nv_id; i += CS_VS) {
+          for (cs_lnum_t j = 0; j < CS_VS; j++)
+            d[j] += _x[i+j]*_y[i+j];
+        }
+
         double cdot = 0.0;
-        for (cs_lnum_t i = start_id; i < end_id; i++)
-        cdot += _x[i]*_y[i];
+        for (cs_lnum_t j = 0; j < CS_VS; j++)
+          cdot += d[j];
+
+        /* vector remainder */
+
+        for (cs_lnum_t i = nv_id; i < end_id; i++)
+          cdot += _x[i]*_y[i];
         sdot += cdot;
       }
 
@@ -321,8 +381,25 @@ _cs_dot_xx_superblock(cs_lnum_t         n,
         cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
         if (end_id > _n)
           end_id = _n;
+        double d[CS_VS];
+        for (cs_lnum_t j = 0; j < CS_VS; j++)
+          d[j] = 0.0;
+
+        /* vector multiple */
+
+        cs_lnum_t nv_id = start_id + ((end_id - start_id)/CS_VS)*CS_VS;
+        for (cs_lnum_t i = start_id; i < nv_id; i += CS_VS) {
+          for (cs_lnum_t j = 0; j < CS_VS; j++)
+            d[j] += _x[i+j]*_x[i+j];
+        }
+
         double cdot_xx = 0.0;
-        for (cs_lnum_t i = start_id; i < end_id; i++)
+        for (cs_lnum_t j = 0; j < CS_VS; j++)
+          cdot_xx += d[j];
+
+        /* vector remainder */
+
+        for (cs_lnum_t i = nv_id; i < end_id; i++)
           cdot_xx += _x[i]*_x[i];
         sdot_xx += cdot_xx;
       }
@@ -386,9 +463,32 @@ _cs_dot_xx_xy_superblock(cs_lnum_t                    n,
         cs_lnum_t end_id = block_size * (blocks_in_sblocks*sid + bid + 1);
         if (end_id > _n)
           end_id = _n;
+        double d_xx[CS_VS], d_xy[CS_VS];
+        for (cs_lnum_t j = 0; j < CS_VS; j++) {
+          d_xx[j] = 0.0;
+          d_xy[j] = 0.0;
+        }
+
+        /* vector multiple */
+
+        cs_lnum_t nv_id = start_id + ((end_id - start_id)/CS_VS)*CS_VS;
+        for (cs_lnum_t i = start_id; i < nv_id; i += CS_VS) {
+          for (cs_lnum_t j = 0; j < CS_VS; j++) {
+            d_xx[j] += _x[i+j]*_x[i+j];
+            d_xy[j] += _x[i+j]*_y[i+j];
+          }
+        }
+
         double cdot_xx = 0.0;
         double cdot_xy = 0.0;
-        for (cs_lnum_t i = start_id; i < end_id; i++) {
+        for (cs_lnum_t j = 0; j < CS_VS; j++) {
+          cdot_xx += d_xx[j];
+          cdot_xy += d_xy[j];
+        }
+
+        /* vector remainder */
+
+        for (cs_lnum_t i = nv_id; i < end_id; i++) {
           cdot_xx += _x[i]*_x[i];
           cdot_xy += _x[i]*_y[i];
         }
@@ -738,6 +838,517 @@ _cs_gres_superblock(cs_lnum_t         n,
   return dot;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the dot product of 2 vectors: x.y
+ *        using a deterministic blocked reduction.
+ *
+ * Partial sums are computed over fixed-size blocks and combined in a
+ * pairwise tree, so the result does not depend on the number of threads
+ * and is bitwise reproducible from one run to the next.
+ *
+ * \param[in]  n  size of arrays x and y
+ * \param[in]  x  array of floating-point values
+ * \param[in]  y  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_deterministic(cs_lnum_t         n,
+                      const cs_real_t  *x,
+                      const cs_real_t  *y)
+{
+  if (n < 1)
+    return 0.0;
+
+  const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *s;
+  BFT_MALLOC(s, n_blocks, double);
+
+# pragma omp parallel for  if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+    cs_lnum_t start_id = block_size * bid;
+    cs_lnum_t end_id = start_id + block_size;
+    if (end_id > n)
+      end_id = n;
+
+    double d[CS_VS];
+    for (cs_lnum_t j = 0; j < CS_VS; j++)
+      d[j] = 0.0;
+
+    /* vector multiple */
+
+    cs_lnum_t nv_id = start_id + ((end_id - start_id)/CS_VS)*CS_VS;
+    for (cs_lnum_t i = start_id; i < nv_id; i += CS_VS) {
+      for (cs_lnum_t j = 0; j < CS_VS; j++)
+        d[j] += x[i+j]*y[i+j];
+    }
+
+    double bdot = 0.0;
+    for (cs_lnum_t j = 0; j < CS_VS; j++)
+      bdot += d[j];
+
+    /* vector remainder */
+
+    for (cs_lnum_t i = nv_id; i < end_id; i++)
+      bdot += x[i]*y[i];
+
+    s[bid] = bdot;
+
+  }
+
+  double dot = _block_pairwise_sum(n_blocks, s);
+
+  BFT_FREE(s);
+
+  return dot;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return dot products of a vector with itself: x.x
+ *        using a deterministic blocked reduction.
+ *
+ * \param[in]  n  size of array x
+ * \param[in]  x  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_xx_deterministic(cs_lnum_t         n,
+                         const cs_real_t  *x)
+{
+  if (n < 1)
+    return 0.0;
+
+  const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *s;
+  BFT_MALLOC(s, n_blocks, double);
+
+# pragma omp parallel for  if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+    cs_lnum_t start_id = block_size * bid;
+    cs_lnum_t end_id = start_id + block_size;
+    if (end_id > n)
+      end_id = n;
+
+    double d[CS_VS];
+    for (cs_lnum_t j = 0; j < CS_VS; j++)
+      d[j] = 0.0;
+
+    /* vector multiple */
+
+    cs_lnum_t nv_id = start_id + ((end_id - start_id)/CS_VS)*CS_VS;
+    for (cs_lnum_t i = start_id; i < nv_id; i += CS_VS) {
+      for (cs_lnum_t j = 0; j < CS_VS; j++)
+        d[j] += x[i+j]*x[i+j];
+    }
+
+    double bdot = 0.0;
+    for (cs_lnum_t j = 0; j < CS_VS; j++)
+      bdot += d[j];
+
+    /* vector remainder */
+
+    for (cs_lnum_t i = nv_id; i < end_id; i++)
+      bdot += x[i]*x[i];
+
+    s[bid] = bdot;
+
+  }
+
+  double dot_xx = _block_pairwise_sum(n_blocks, s);
+
+  BFT_FREE(s);
+
+  return dot_xx;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 2 vectors: x.x, and x.y
+ *        using a deterministic blocked reduction.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_deterministic(cs_lnum_t                    n,
+                            const cs_real_t  *restrict   x,
+                            const cs_real_t  *restrict   y,
+                            double                      *xx,
+                            double                      *xy)
+{
+  if (n < 1) {
+    *xx = 0.0;
+    *xy = 0.0;
+    return;
+  }
+
+  const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *s;
+  BFT_MALLOC(s, n_blocks*2, double);
+
+# pragma omp parallel for  if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+    cs_lnum_t start_id = block_size * bid;
+    cs_lnum_t end_id = start_id + block_size;
+    if (end_id > n)
+      end_id = n;
+
+    double d_xx[CS_VS], d_xy[CS_VS];
+    for (cs_lnum_t j = 0; j < CS_VS; j++) {
+      d_xx[j] = 0.0;
+      d_xy[j] = 0.0;
+    }
+
+    /* vector multiple */
+
+    cs_lnum_t nv_id = start_id + ((end_id - start_id)/CS_VS)*CS_VS;
+    for (cs_lnum_t i = start_id; i < nv_id; i += CS_VS) {
+      for (cs_lnum_t j = 0; j < CS_VS; j++) {
+        d_xx[j] += x[i+j]*x[i+j];
+        d_xy[j] += x[i+j]*y[i+j];
+      }
+    }
+
+    double bdot_xx = 0.0;
+    double bdot_xy = 0.0;
+    for (cs_lnum_t j = 0; j < CS_VS; j++) {
+      bdot_xx += d_xx[j];
+      bdot_xy += d_xy[j];
+    }
+
+    /* vector remainder */
+
+    for (cs_lnum_t i = nv_id; i < end_id; i++) {
+      bdot_xx += x[i]*x[i];
+      bdot_xy += x[i]*y[i];
+    }
+
+    s[bid] = bdot_xx;
+    s[n_blocks + bid] = bdot_xy;
+
+  }
+
+  *xx = _block_pairwise_sum(n_blocks, s);
+  *xy = _block_pairwise_sum(n_blocks, s + n_blocks);
+
+  BFT_FREE(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 3 vectors: x.y, and y.z
+ *        using a deterministic blocked reduction.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x and y, and z
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_yz_deterministic(cs_lnum_t                    n,
+                            const cs_real_t  *restrict   x,
+                            const cs_real_t  *restrict   y,
+                            const cs_real_t  *restrict   z,
+                            double                      *xy,
+                            double                      *yz)
+{
+  if (n < 1) {
+    *xy = 0.0;
+    *yz = 0.0;
+    return;
+  }
+
+  const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *s;
+  BFT_MALLOC(s, n_blocks*2, double);
+
+# pragma omp parallel for  if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+    cs_lnum_t start_id = block_size * bid;
+    cs_lnum_t end_id = start_id + block_size;
+    if (end_id > n)
+      end_id = n;
+
+    double bdot_xy = 0.0;
+    double bdot_yz = 0.0;
+    for (cs_lnum_t i = start_id; i < end_id; i++) {
+      bdot_xy += x[i]*y[i];
+      bdot_yz += y[i]*z[i];
+    }
+
+    s[bid] = bdot_xy;
+    s[n_blocks + bid] = bdot_yz;
+
+  }
+
+  *xy = _block_pairwise_sum(n_blocks, s);
+  *yz = _block_pairwise_sum(n_blocks, s + n_blocks);
+
+  BFT_FREE(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.x, x.y, and y.z
+ *        using a deterministic blocked reduction.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x and y, and z
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_yz_deterministic(cs_lnum_t                    n,
+                               const cs_real_t  *restrict   x,
+                               const cs_real_t  *restrict   y,
+                               const cs_real_t  *restrict   z,
+                               double                      *xx,
+                               double                      *xy,
+                               double                      *yz)
+{
+  if (n < 1) {
+    *xx = 0.0;
+    *xy = 0.0;
+    *yz = 0.0;
+    return;
+  }
+
+  const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *s;
+  BFT_MALLOC(s, n_blocks*3, double);
+
+# pragma omp parallel for  if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+    cs_lnum_t start_id = block_size * bid;
+    cs_lnum_t end_id = start_id + block_size;
+    if (end_id > n)
+      end_id = n;
+
+    double bdot_xx = 0.0;
+    double bdot_xy = 0.0;
+    double bdot_yz = 0.0;
+    for (cs_lnum_t i = start_id; i < end_id; i++) {
+      bdot_xx += x[i]*x[i];
+      bdot_xy += x[i]*y[i];
+      bdot_yz += y[i]*z[i];
+    }
+
+    s[bid] = bdot_xx;
+    s[n_blocks + bid] = bdot_xy;
+    s[n_blocks*2 + bid] = bdot_yz;
+
+  }
+
+  *xx = _block_pairwise_sum(n_blocks, s);
+  *xy = _block_pairwise_sum(n_blocks, s + n_blocks);
+  *yz = _block_pairwise_sum(n_blocks, s + n_blocks*2);
+
+  BFT_FREE(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 5 dot products of 3 vectors: x.x, y.y, x.y, x.z, and y.z
+ *        using a deterministic blocked reduction.
+ *
+ * The products could be computed separately, but computing them
+ * simultaneously adds more optimization opportunities and possibly better
+ * cache behavior.
+ *
+ * \param[in]   n   size of arrays x and y, and z
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  yy  y.y dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_yy_xy_xz_yz_deterministic(cs_lnum_t                    n,
+                                     const cs_real_t  *restrict   x,
+                                     const cs_real_t  *restrict   y,
+                                     const cs_real_t  *restrict   z,
+                                     double                      *xx,
+                                     double                      *yy,
+                                     double                      *xy,
+                                     double                      *xz,
+                                     double                      *yz)
+{
+  if (n < 1) {
+    *xx = 0.0;
+    *yy = 0.0;
+    *xy = 0.0;
+    *xz = 0.0;
+    *yz = 0.0;
+    return;
+  }
+
+  const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *s;
+  BFT_MALLOC(s, n_blocks*5, double);
+
+# pragma omp parallel for  if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+    cs_lnum_t start_id = block_size * bid;
+    cs_lnum_t end_id = start_id + block_size;
+    if (end_id > n)
+      end_id = n;
+
+    double bdot_xx = 0.0;
+    double bdot_yy = 0.0;
+    double bdot_xy = 0.0;
+    double bdot_xz = 0.0;
+    double bdot_yz = 0.0;
+    for (cs_lnum_t i = start_id; i < end_id; i++) {
+      bdot_xx += x[i]*x[i];
+      bdot_yy += y[i]*y[i];
+      bdot_xy += x[i]*y[i];
+      bdot_xz += x[i]*z[i];
+      bdot_yz += y[i]*z[i];
+    }
+
+    s[bid] = bdot_xx;
+    s[n_blocks + bid] = bdot_yy;
+    s[n_blocks*2 + bid] = bdot_xy;
+    s[n_blocks*3 + bid] = bdot_xz;
+    s[n_blocks*4 + bid] = bdot_yz;
+
+  }
+
+  *xx = _block_pairwise_sum(n_blocks, s);
+  *yy = _block_pairwise_sum(n_blocks, s + n_blocks);
+  *xy = _block_pairwise_sum(n_blocks, s + n_blocks*2);
+  *xz = _block_pairwise_sum(n_blocks, s + n_blocks*3);
+  *yz = _block_pairwise_sum(n_blocks, s + n_blocks*4);
+
+  BFT_FREE(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the global residual of 2 extensive vectors:
+ *        1/sum(vol) . sum(X.Y.vol)
+ *        using a deterministic blocked reduction.
+ *
+ * In parallel mode, the local results are summed on the default
+ * global communicator; only the local sums are reduced deterministically.
+ *
+ * \param[in]  n    size of arrays x and y
+ * \param[in]  vol  array of floating-point values
+ * \param[in]  x    array of floating-point values
+ * \param[in]  y    array of floating-point values
+ *
+ * \return  global residual
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_gres_deterministic(cs_lnum_t         n,
+                       const cs_real_t  *vol,
+                       const cs_real_t  *x,
+                       const cs_real_t  *y)
+{
+  double dot = 0.0;
+  double vtot = 0.0;
+
+  if (n > 0) {
+
+    const cs_lnum_t block_size = CS_RBLOCK_BLOCK_SIZE;
+    const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+    double *s;
+    BFT_MALLOC(s, n_blocks*2, double);
+
+#   pragma omp parallel for  if (n > CS_THR_MIN)
+    for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+      cs_lnum_t start_id = block_size * bid;
+      cs_lnum_t end_id = start_id + block_size;
+      if (end_id > n)
+        end_id = n;
+
+      double bdot = 0.0;
+      double bvtot = 0.0;
+      for (cs_lnum_t i = start_id; i < end_id; i++) {
+        bdot += x[i]*y[i]*vol[i];
+        bvtot += vol[i];
+      }
+
+      s[bid] = bdot;
+      s[n_blocks + bid] = bvtot;
+
+    }
+
+    dot = _block_pairwise_sum(n_blocks, s);
+    vtot = _block_pairwise_sum(n_blocks, s + n_blocks);
+
+    BFT_FREE(s);
+
+  }
+
+  double atot[2] = {dot, vtot};
+  cs_parall_sum(2, CS_DOUBLE, atot);
+
+  dot = atot[0] / atot[1];
+
+  return dot;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the dot product of 2 vectors: x.y
@@ -993,7 +1604,7 @@ _cs_dot_xy_yz_kahan(cs_lnum_t                    n,
     }
 
     dot_xy = s[0];
-    dot_xy = s[1];
+    dot_yz = s[1];
   }
 
   *xy = dot_xy;
@@ -1252,6 +1863,17 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_gres = _cs_gres_superblock;
       }
       break;
+    case CS_BLAS_REDUCE_DETERMINISTIC:
+      {
+        _cs_glob_dot = _cs_dot_deterministic;
+        _cs_glob_dot_xx = _cs_dot_xx_deterministic;
+        _cs_glob_dot_xx_xy = _cs_dot_xx_xy_deterministic;
+        _cs_glob_dot_xy_yz = _cs_dot_xy_yz_deterministic;
+        _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_deterministic;
+        _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_deterministic;
+        _cs_glob_gres = _cs_gres_deterministic;
+      }
+      break;
     case CS_BLAS_REDUCE_KAHAN:
       {
         _cs_glob_dot    = _cs_dot_kahan;
@@ -56,6 +56,7 @@ BEGIN_C_DECLS
 typedef enum {
 
   CS_BLAS_REDUCE_SUPERBLOCK,
+  CS_BLAS_REDUCE_DETERMINISTIC,
   CS_BLAS_REDUCE_KAHAN
 
 } cs_blas_reduce_t;
@@ -99,14 +99,127 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Size of face blocks for two-phase (compute, then scatter) flux loops;
+   the flux computation over a block may then be vectorized, while the
+   per-block flux array remains in L1 cache for the scatter. */
+
+#define CS_CD_FACE_BLOCK_SIZE  64
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Cached interior face geometric quantities for the slope test and NVD/TVD
+   limiters; they are purely geometric, so they are shared by all fields and
+   only rebuilt when the mesh quantities are recomputed. */
+
+static int          _i_geom_compute_count = -1;
+static cs_real_t   *_i_dist_factor = NULL;  /* i_face_surf / i_dist */
+static cs_real_6_t *_i_nvd_geom = NULL;     /* NVD limiter stencil geometry:
+                                               unit vector joining the cell
+                                               centers (oriented i to j),
+                                               associated distance, and
+                                               normalized face distance for
+                                               each upwind orientation */
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Update cached interior face geometric quantities if needed.
+ *
+ * parameters:
+ *   need_nvd <-- true if the NVD limiter stencil geometry is required
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_i_geom_cache(bool  need_nvd)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const int compute_count = cs_mesh_quantities_compute_count();
+
+  if (compute_count != _i_geom_compute_count) {
+    BFT_FREE(_i_dist_factor);
+    BFT_FREE(_i_nvd_geom);
+    _i_geom_compute_count = compute_count;
+  }
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+
+  if (_i_dist_factor == NULL) {
+
+    const cs_real_t *restrict i_dist = fvq->i_dist;
+    const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+
+    BFT_MALLOC(_i_dist_factor, n_i_faces, cs_real_t);
+
+#   pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+      _i_dist_factor[face_id] = i_face_surf[face_id] / i_dist[face_id];
+
+  }
+
+  if (need_nvd && _i_nvd_geom == NULL) {
+
+    const cs_lnum_2_t *restrict i_face_cells
+      = (const cs_lnum_2_t *restrict)m->i_face_cells;
+    const cs_real_3_t *restrict cell_cen
+      = (const cs_real_3_t *restrict)fvq->cell_cen;
+    const cs_real_3_t *restrict i_face_cog
+      = (const cs_real_3_t *restrict)fvq->i_face_cog;
+
+    BFT_MALLOC(_i_nvd_geom, n_i_faces, cs_real_6_t);
+
+#   pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
+
+      /* Vector of the line that joins the centers of cells i and j */
+      cs_real_3_t rdc;
+      rdc[0] = cell_cen[jj][0] - cell_cen[ii][0];
+      rdc[1] = cell_cen[jj][1] - cell_cen[ii][1];
+      rdc[2] = cell_cen[jj][2] - cell_cen[ii][2];
+
+      const cs_real_t dist_dc = cs_math_3_norm(rdc);
+
+      _i_nvd_geom[face_id][0] = rdc[0]/dist_dc;
+      _i_nvd_geom[face_id][1] = rdc[1]/dist_dc;
+      _i_nvd_geom[face_id][2] = rdc[2]/dist_dc;
+      _i_nvd_geom[face_id][3] = dist_dc;
+
+      /* Distance between the face and each cell center, normalized
+         as in the NVD diagram (the upwind point is placed at the same
+         distance from the central cell as the downwind cell) */
+
+      cs_real_3_t rfc;
+      rfc[0] = i_face_cog[face_id][0] - cell_cen[ii][0];
+      rfc[1] = i_face_cog[face_id][1] - cell_cen[ii][1];
+      rfc[2] = i_face_cog[face_id][2] - cell_cen[ii][2];
+
+      _i_nvd_geom[face_id][4]
+        = (cs_math_3_norm(rfc) + dist_dc) / (dist_dc + dist_dc);
+
+      rfc[0] = i_face_cog[face_id][0] - cell_cen[jj][0];
+      rfc[1] = i_face_cog[face_id][1] - cell_cen[jj][1];
+      rfc[2] = i_face_cog[face_id][2] - cell_cen[jj][2];
+
+      _i_nvd_geom[face_id][5]
+        = (cs_math_3_norm(rfc) + dist_dc) / (dist_dc + dist_dc);
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Synchronize halos for scalar variables.
  *
@@ -2027,8 +2140,6 @@ cs_convection_diffusion_scalar(int                       idtvar,
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
   const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
   const cs_real_t *restrict cell_vol = fvq->cell_vol;
   const cs_real_3_t *restrict cell_cen
     = (const cs_real_3_t *restrict)fvq->cell_cen;
@@ -2163,6 +2274,22 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
   iupwin = (blencp > 0.) ? 0 : 1;
 
+  /* Fused kernels are provided for the most common scheme combinations:
+     pure upwind without reconstruction (orthogonal meshes), and legacy
+     SOLU with flux reconstruction. The selection is made once here from
+     the calculation options of the field, so the face loops of those
+     kernels carry no per-face dependence on the iconvp/idiffp/ircflp
+     flags; other combinations use the generic (flag-parameterized)
+     loops below. */
+
+  int fused_kernel = 0;
+  if (idtvar >= 0 && iconvp == 1 && idiffp == 1) {
+    if (iupwin == 1 && ircflp == 0)
+      fused_kernel = 1;
+    else if (iupwin == 0 && isstpp == 1 && ischcp == 0 && ircflp == 1)
+      fused_kernel = 2;
+  }
+
   if (icoupl > 0) {
     assert(f_id != -1);
     const cs_int_t coupling_key_id = cs_field_key_id("coupling_entity");
@@ -2320,67 +2447,149 @@ cs_convection_diffusion_scalar(int                       idtvar,
       for (int g_id = 0; g_id < n_i_groups; g_id++) {
 #       pragma omp parallel for reduction(+:n_upwind)
         for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
 
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+          /* Fluxes are computed for blocks of faces, then applied to the
+             right hand side, so that the computation phase may benefit
+             from vectorization (cells of a same group and thread are
+             disjoint from those of other threads). */
+
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
+
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_2_t b_flux[CS_CD_FACE_BLOCK_SIZE];
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              cs_real_2_t fluxij = {0.,0.};
+
+              cs_real_t pifri, pjfri, pifrj, pjfrj;
+              cs_real_t pip, pjp, pipr, pjpr;
+
+              cs_i_cd_steady_upwind(ircflp,
+                                    relaxp,
+                                    diipf[face_id],
+                                    djjpf[face_id],
+                                    grad[ii],
+                                    grad[jj],
+                                    _pvar[ii],
+                                    _pvar[jj],
+                                    pvara[ii],
+                                    pvara[jj],
+                                    &pifri,
+                                    &pifrj,
+                                    &pjfri,
+                                    &pjfrj,
+                                    &pip,
+                                    &pjp,
+                                    &pipr,
+                                    &pjpr);
+
+              cs_i_conv_flux(iconvp,
+                             1.,
+                             1,
+                             _pvar[ii],
+                             _pvar[jj],
+                             pifri,
+                             pifrj,
+                             pjfri,
+                             pjfrj,
+                             i_massflux[face_id],
+                             1., /* xcpp */
+                             1., /* xcpp */
+                             fluxij);
+
+              cs_i_diff_flux(idiffp,
+                             1.,
+                             pip,
+                             pjp,
+                             pipr,
+                             pjpr,
+                             i_visc[face_id],
+                             fluxij);
+
+              b_flux[face_id - b_id][0] = fluxij[0];
+              b_flux[face_id - b_id][1] = fluxij[1];
 
-            /* in parallel, face will be counted by one and only one rank */
-            if (ii < n_cells) {
-              n_upwind++;
             }
 
-            cs_real_2_t fluxij = {0.,0.};
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
 
-            cs_real_t pifri, pjfri, pifrj, pjfrj;
-            cs_real_t pip, pjp, pipr, pjpr;
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
 
-            cs_i_cd_steady_upwind(ircflp,
-                                  relaxp,
-                                  diipf[face_id],
-                                  djjpf[face_id],
-                                  grad[ii],
-                                  grad[jj],
-                                  _pvar[ii],
-                                  _pvar[jj],
-                                  pvara[ii],
-                                  pvara[jj],
-                                  &pifri,
-                                  &pifrj,
-                                  &pjfri,
-                                  &pjfrj,
-                                  &pip,
-                                  &pjp,
-                                  &pipr,
-                                  &pjpr);
+              /* in parallel, face will be counted by one and only one rank */
+              if (ii < n_cells) {
+                n_upwind++;
+              }
 
-            cs_i_conv_flux(iconvp,
-                           1.,
-                           1,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pifri,
-                           pifrj,
-                           pjfri,
-                           pjfrj,
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
+              rhs[ii] -= b_flux[face_id - b_id][0];
+              rhs[jj] += b_flux[face_id - b_id][1];
 
-            cs_i_diff_flux(idiffp,
-                           1.,
-                           pip,
-                           pjp,
-                           pipr,
-                           pjpr,
-                           i_visc[face_id],
-                           fluxij);
+            }
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+          }
+        }
+      }
+
+    /* Unsteady, fused kernel: upwind convection and non-reconstructed
+       diffusion, with the scheme flags compiled out */
+    } else if (fused_kernel == 1) {
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for reduction(+:n_upwind)
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
+
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_2_t b_flux[CS_CD_FACE_BLOCK_SIZE];
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              cs_real_t pi = _pvar[ii];
+              cs_real_t pj = _pvar[jj];
+
+              cs_real_t i_mf = i_massflux[face_id];
+
+              cs_real_t flui = 0.5*(i_mf + fabs(i_mf));
+              cs_real_t fluj = 0.5*(i_mf - fabs(i_mf));
+
+              cs_real_t fluxc = thetap*(flui*pi + fluj*pj);
+              cs_real_t fluxd = thetap*i_visc[face_id]*(pi - pj);
+
+              b_flux[face_id - b_id][0] = fluxc - imasac*i_mf*pi + fluxd;
+              b_flux[face_id - b_id][1] = fluxc - imasac*i_mf*pj + fluxd;
+
+            }
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              /* in parallel, face will be counted by one and only one rank */
+              if (ii < n_cells) {
+                n_upwind++;
+              }
+
+              rhs[ii] -= b_flux[face_id - b_id][0];
+              rhs[jj] += b_flux[face_id - b_id][1];
+
+            }
 
           }
         }
@@ -2392,60 +2601,80 @@ cs_convection_diffusion_scalar(int                       idtvar,
       for (int g_id = 0; g_id < n_i_groups; g_id++) {
 #       pragma omp parallel for reduction(+:n_upwind)
         for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
 
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
 
-            /* in parallel, face will be counted by one and only one rank */
-            if (ii < n_cells) {
-              n_upwind++;
-            }
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
 
-            cs_real_2_t fluxij = {0.,0.};
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_2_t b_flux[CS_CD_FACE_BLOCK_SIZE];
 
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
 
-            cs_i_cd_unsteady_upwind(ircflp,
-                                    diipf[face_id],
-                                    djjpf[face_id],
-                                    grad[ii],
-                                    grad[jj],
-                                    _pvar[ii],
-                                    _pvar[jj],
-                                    &pif,
-                                    &pjf,
-                                    &pip,
-                                    &pjp);
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
 
-            cs_i_conv_flux(iconvp,
-                           thetap,
-                           imasac,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pif,
-                           pif, /* no relaxation */
-                           pjf,
-                           pjf, /* no relaxation */
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
+              cs_real_2_t fluxij = {0.,0.};
 
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip,/* no relaxation */
-                           pjp,/* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
+              cs_real_t pif, pjf;
+              cs_real_t pip, pjp;
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+              cs_i_cd_unsteady_upwind(ircflp,
+                                      diipf[face_id],
+                                      djjpf[face_id],
+                                      grad[ii],
+                                      grad[jj],
+                                      _pvar[ii],
+                                      _pvar[jj],
+                                      &pif,
+                                      &pjf,
+                                      &pip,
+                                      &pjp);
+
+              cs_i_conv_flux(iconvp,
+                             thetap,
+                             imasac,
+                             _pvar[ii],
+                             _pvar[jj],
+                             pif,
+                             pif, /* no relaxation */
+                             pjf,
+                             pjf, /* no relaxation */
+                             i_massflux[face_id],
+                             1., /* xcpp */
+                             1., /* xcpp */
+                             fluxij);
+
+              cs_i_diff_flux(idiffp,
+                             thetap,
+                             pip,
+                             pjp,
+                             pip,/* no relaxation */
+                             pjp,/* no relaxation */
+                             i_visc[face_id],
+                             fluxij);
+
+              b_flux[face_id - b_id][0] = fluxij[0];
+              b_flux[face_id - b_id][1] = fluxij[1];
+
+            }
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              /* in parallel, face will be counted by one and only one rank */
+              if (ii < n_cells) {
+                n_upwind++;
+              }
+
+              rhs[ii] -= b_flux[face_id - b_id][0];
+              rhs[jj] += b_flux[face_id - b_id][1];
+
+            }
 
           }
         }
@@ -2456,83 +2685,179 @@ cs_convection_diffusion_scalar(int                       idtvar,
   /* --> Flux with no slope test or Min/Max Beta limiter
     ====================================================*/
 
-  } else if (isstpp == 1 || isstpp == 2) {
+  } else if (isstpp == 1 || isstpp == 2) {
+
+    if (ischcp < 0 || ischcp > 2) {
+      bft_error(__FILE__, __LINE__, 0,
+                _("invalid value of ischcv"));
+    }
+
+    /* Steady */
+    if (idtvar < 0) {
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
+
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_2_t b_flux[CS_CD_FACE_BLOCK_SIZE];
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              cs_real_2_t fluxij = {0.,0.};
+
+              cs_real_t pifri, pjfri, pifrj, pjfrj;
+              cs_real_t pip, pjp, pipr, pjpr;
+
+              cs_i_cd_steady(ircflp,
+                             ischcp,
+                             relaxp,
+                             blencp,
+                             weight[face_id],
+                             cell_cen[ii],
+                             cell_cen[jj],
+                             i_face_cog[face_id],
+                             diipf[face_id],
+                             djjpf[face_id],
+                             grad[ii],
+                             grad[jj],
+                             gradup[ii],
+                             gradup[jj],
+                             _pvar[ii],
+                             _pvar[jj],
+                             pvara[ii],
+                             pvara[jj],
+                             &pifri,
+                             &pifrj,
+                             &pjfri,
+                             &pjfrj,
+                             &pip,
+                             &pjp,
+                             &pipr,
+                             &pjpr);
+
+              cs_i_conv_flux(iconvp,
+                             1.,
+                             1,
+                             _pvar[ii],
+                             _pvar[jj],
+                             pifri,
+                             pifrj,
+                             pjfri,
+                             pjfrj,
+                             i_massflux[face_id],
+                             1., /* xcpp */
+                             1., /* xcpp */
+                             fluxij);
+
+              cs_i_diff_flux(idiffp,
+                             1.,
+                             pip,
+                             pjp,
+                             pipr,
+                             pjpr,
+                             i_visc[face_id],
+                             fluxij);
+
+              b_flux[face_id - b_id][0] = fluxij[0];
+              b_flux[face_id - b_id][1] = fluxij[1];
+
+            }
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              rhs[ii] -= b_flux[face_id - b_id][0];
+              rhs[jj] += b_flux[face_id - b_id][1];
+
+            }
+
+          }
+        }
+      }
+
+    /* Unsteady, fused kernel: legacy SOLU convection and reconstructed
+       diffusion, with the scheme flags compiled out */
+    } else if (fused_kernel == 2) {
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
+
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_2_t b_flux[CS_CD_FACE_BLOCK_SIZE];
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              cs_real_t pi = _pvar[ii];
+              cs_real_t pj = _pvar[jj];
+
+              cs_real_t gradpf[3] = {0.5*(grad[ii][0] + grad[jj][0]),
+                                     0.5*(grad[ii][1] + grad[jj][1]),
+                                     0.5*(grad[ii][2] + grad[jj][2])};
+
+              cs_real_t pip = pi + cs_math_3_dot_product(gradpf,
+                                                         diipf[face_id]);
+              cs_real_t pjp = pj + cs_math_3_dot_product(gradpf,
+                                                         djjpf[face_id]);
+
+              cs_real_t pif, pjf;
+              cs_solu_f_val(cell_cen[ii],
+                            i_face_cog[face_id],
+                            grad[ii],
+                            pi,
+                            &pif);
+              cs_solu_f_val(cell_cen[jj],
+                            i_face_cog[face_id],
+                            grad[jj],
+                            pj,
+                            &pjf);
 
-    if (ischcp < 0 || ischcp > 2) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
-    }
+              cs_blend_f_val(blencp, pi, &pif);
+              cs_blend_f_val(blencp, pj, &pjf);
 
-    /* Steady */
-    if (idtvar < 0) {
+              cs_real_t i_mf = i_massflux[face_id];
 
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
+              cs_real_t flui = 0.5*(i_mf + fabs(i_mf));
+              cs_real_t fluj = 0.5*(i_mf - fabs(i_mf));
 
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
+              cs_real_t fluxc = thetap*(flui*pif + fluj*pjf);
+              cs_real_t fluxd = thetap*i_visc[face_id]*(pip - pjp);
 
-            cs_real_2_t fluxij = {0.,0.};
+              b_flux[face_id - b_id][0] = fluxc - imasac*i_mf*pi + fluxd;
+              b_flux[face_id - b_id][1] = fluxc - imasac*i_mf*pj + fluxd;
 
-            cs_real_t pifri, pjfri, pifrj, pjfrj;
-            cs_real_t pip, pjp, pipr, pjpr;
+            }
 
-            cs_i_cd_steady(ircflp,
-                           ischcp,
-                           relaxp,
-                           blencp,
-                           weight[face_id],
-                           cell_cen[ii],
-                           cell_cen[jj],
-                           i_face_cog[face_id],
-                           diipf[face_id],
-                           djjpf[face_id],
-                           grad[ii],
-                           grad[jj],
-                           gradup[ii],
-                           gradup[jj],
-                           _pvar[ii],
-                           _pvar[jj],
-                           pvara[ii],
-                           pvara[jj],
-                           &pifri,
-                           &pifrj,
-                           &pjfri,
-                           &pjfrj,
-                           &pip,
-                           &pjp,
-                           &pipr,
-                           &pjpr);
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
 
-            cs_i_conv_flux(iconvp,
-                           1.,
-                           1,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pifri,
-                           pifrj,
-                           pjfri,
-                           pjfrj,
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
 
-            cs_i_diff_flux(idiffp,
-                           1.,
-                           pip,
-                           pjp,
-                           pipr,
-                           pjpr,
-                           i_visc[face_id],
-                           fluxij);
+              rhs[ii] -= b_flux[face_id - b_id][0];
+              rhs[jj] += b_flux[face_id - b_id][1];
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            }
 
           }
         }
@@ -2541,84 +2866,107 @@ cs_convection_diffusion_scalar(int                       idtvar,
     /* Unsteady */
     } else {
 
+      const cs_real_t  *hybrid_blend = (ischcp == 3) ?
+        CS_F_(hybrid_blend)->val : NULL;
+
       for (int g_id = 0; g_id < n_i_groups; g_id++) {
 #       pragma omp parallel for
         for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
 
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
 
-            cs_real_t beta = blencp;
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
 
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_2_t b_flux[CS_CD_FACE_BLOCK_SIZE];
 
-            /* Beta blending coefficient ensuring positivity of the scalar */
-            if (isstpp == 2) {
-              beta = CS_MAX(CS_MIN(limiter[ii], limiter[jj]), 0.);
-            }
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
 
-            cs_real_t hybrid_coef_ii, hybrid_coef_jj;
-            if (ischcp == 3) {
-              hybrid_coef_ii = CS_F_(hybrid_blend)->val[ii];
-              hybrid_coef_jj = CS_F_(hybrid_blend)->val[jj];
-            } else {
-              hybrid_coef_ii = 0.;
-              hybrid_coef_jj = 0.;
-            }
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
 
-            cs_real_2_t fluxij = {0.,0.};
+              cs_real_t beta = blencp;
 
-            cs_i_cd_unsteady(ircflp,
-                             ischcp,
-                             beta,
-                             weight[face_id],
-                             cell_cen[ii],
-                             cell_cen[jj],
-                             i_face_cog[face_id],
-                             hybrid_coef_ii,
-                             hybrid_coef_jj,
-                             diipf[face_id],
-                             djjpf[face_id],
-                             grad[ii],
-                             grad[jj],
-                             gradup[ii],
-                             gradup[jj],
+              cs_real_t pif, pjf;
+              cs_real_t pip, pjp;
+
+              /* Beta blending coefficient ensuring positivity of the scalar */
+              if (isstpp == 2) {
+                beta = CS_MAX(CS_MIN(limiter[ii], limiter[jj]), 0.);
+              }
+
+              cs_real_t hybrid_coef_ii, hybrid_coef_jj;
+              if (hybrid_blend != NULL) {
+                hybrid_coef_ii = hybrid_blend[ii];
+                hybrid_coef_jj = hybrid_blend[jj];
+              } else {
+                hybrid_coef_ii = 0.;
+                hybrid_coef_jj = 0.;
+              }
+
+              cs_real_2_t fluxij = {0.,0.};
+
+              cs_i_cd_unsteady(ircflp,
+                               ischcp,
+                               beta,
+                               weight[face_id],
+                               cell_cen[ii],
+                               cell_cen[jj],
+                               i_face_cog[face_id],
+                               hybrid_coef_ii,
+                               hybrid_coef_jj,
+                               diipf[face_id],
+                               djjpf[face_id],
+                               grad[ii],
+                               grad[jj],
+                               gradup[ii],
+                               gradup[jj],
+                               _pvar[ii],
+                               _pvar[jj],
+                               &pif,
+                               &pjf,
+                               &pip,
+                               &pjp);
+
+              cs_i_conv_flux(iconvp,
+                             thetap,
+                             imasac,
                              _pvar[ii],
                              _pvar[jj],
-                             &pif,
-                             &pjf,
-                             &pip,
-                             &pjp);
+                             pif,
+                             pif, /* no relaxation */
+                             pjf,
+                             pjf, /* no relaxation */
+                             i_massflux[face_id],
+                             1., /* xcpp */
+                             1., /* xcpp */
+                             fluxij);
 
-            cs_i_conv_flux(iconvp,
-                           thetap,
-                           imasac,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pif,
-                           pif, /* no relaxation */
-                           pjf,
-                           pjf, /* no relaxation */
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
+              cs_i_diff_flux(idiffp,
+                             thetap,
+                             pip,
+                             pjp,
+                             pip, /* no relaxation */
+                             pjp, /* no relaxation */
+                             i_visc[face_id],
+                             fluxij);
 
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip, /* no relaxation */
-                           pjp, /* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
+              b_flux[face_id - b_id][0] = fluxij[0];
+              b_flux[face_id - b_id][1] = fluxij[1];
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+            }
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              rhs[ii] -= b_flux[face_id - b_id][0];
+              rhs[jj] += b_flux[face_id - b_id][1];
+
+            }
 
           }
         }
@@ -2636,6 +2984,14 @@ cs_convection_diffusion_scalar(int                       idtvar,
                 _("invalid value of ischcv"));
     }
 
+    /* Cached geometric quantities, shared by all advected fields */
+
+    _update_i_geom_cache(isstpp == 3);
+
+    const cs_real_t *restrict i_dist_factor = _i_dist_factor;
+    const cs_real_6_t *restrict i_nvd_geom
+      = (const cs_real_6_t *restrict)_i_nvd_geom;
+
     /* Steady */
     if (idtvar < 0) {
 
@@ -2663,8 +3019,7 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                       blencp,
                                       blend_st,
                                       weight[face_id],
-                                      i_dist[face_id],
-                                      i_face_surf[face_id],
+                                      i_dist_factor[face_id],
                                       cell_cen[ii],
                                       cell_cen[jj],
                                       i_face_normal[face_id],
@@ -2763,8 +3118,7 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                           blencp,
                                           blend_st,
                                           weight[face_id],
-                                          i_dist[face_id],
-                                          i_face_surf[face_id],
+                                          i_dist_factor[face_id],
                                           cell_cen[ii],
                                           cell_cen[jj],
                                           i_face_normal[face_id],
@@ -2833,35 +3187,22 @@ cs_convection_diffusion_scalar(int                       idtvar,
               p_c = _pvar[ic];
               p_d = _pvar[id];
 
-              /* Compute the distance between the face and the
-                 centroid of the central cell */
-              cs_real_3_t rfc;
-              rfc[0] = i_face_cog[face_id][0] - cell_cen[ic][0];
-              rfc[1] = i_face_cog[face_id][1] - cell_cen[ic][1];
-              rfc[2] = i_face_cog[face_id][2] - cell_cen[ic][2];
-
-              const cs_real_t dist_fc = cs_math_3_norm(rfc);
-
-              /* Compute the vector of the line that joins the current point
-                 with the downwind point */
-              cs_real_3_t rdc, ndc;
-              rdc[0] = cell_cen[id][0] - cell_cen[ic][0];
-              rdc[1] = cell_cen[id][1] - cell_cen[ic][1];
-              rdc[2] = cell_cen[id][2] - cell_cen[ic][2];
-
-              const cs_real_t dist_dc = cs_math_3_norm(rdc);
-
-              /* Compute the unit vector of the line that joins the current
-                 point with the downwind point */
-              ndc[0] = rdc[0]/dist_dc;
-              ndc[1] = rdc[1]/dist_dc;
-              ndc[2] = rdc[2]/dist_dc;
-
-              /* Place the upwind point on the line that joins
-                 the two cells on the upwind side and the same
-                 distance as that between the two cells */
+              /* Cached stencil geometry: unit vector of the line that
+                 joins the current point with the downwind point (oriented
+                 from central to downwind cell), associated distance, and
+                 normalised distances, with the upwind point placed on the
+                 same line at the same distance as that between the
+                 two cells */
+
+              const cs_real_t o_sgn = (ic == ii) ? 1. : -1.;
+              const cs_real_t dist_dc = i_nvd_geom[face_id][3];
+
+              cs_real_3_t ndc;
+              ndc[0] = o_sgn*i_nvd_geom[face_id][0];
+              ndc[1] = o_sgn*i_nvd_geom[face_id][1];
+              ndc[2] = o_sgn*i_nvd_geom[face_id][2];
+
               const cs_real_t dist_cu = dist_dc;
-              const cs_real_t dist_du = dist_dc + dist_cu;
 
               /* Compute the property on the upwind assuming a parabolic
                  variation of the property between the two cells */
@@ -2872,9 +3213,9 @@ cs_convection_diffusion_scalar(int                       idtvar,
               p_u = p_c + (grad2c*dist_cu - gradc)*dist_cu;
               p_u = CS_MAX(CS_MIN(p_u, local_max[ic]), local_min[ic]);
 
-              /* Compute the normalised distances */
-              const cs_real_t nvf_r_f = (dist_fc+dist_cu)/dist_du;
-              const cs_real_t nvf_r_c = dist_cu/dist_du;
+              const cs_real_t nvf_r_f = (ic == ii) ?
+                i_nvd_geom[face_id][4] : i_nvd_geom[face_id][5];
+              const cs_real_t nvf_r_c = 0.5;
 
               /* Check for the bounds of the NVD diagram and compute the face
                  property according to the selected NVD scheme */
@@ -3517,6 +3858,23 @@ cs_convection_diffusion_vector(int                         idtvar,
 
   iupwin = (blencp > 0.) ? 0 : 1;
 
+  /* As for the scalar version, fused kernels are provided for the most
+     common unsteady scheme combinations: pure upwind without
+     reconstruction, and centered with flux reconstruction and no slope
+     test. The per-face 3x3 reconstruction algebra is handled over face
+     blocks with structure-of-arrays temporaries so the flux loop
+     vectorizes; other combinations (including the porous face factor)
+     use the generic (flag-parameterized) loops below. */
+
+  int fused_kernel = 0;
+  if (idtvar >= 0 && iconvp == 1 && idiffp == 1
+      && i_f_face_factor == NULL) {
+    if (iupwin == 1 && ircflp == 0)
+      fused_kernel = 1;
+    else if (iupwin == 0 && isstpp == 1 && ischcp == 1 && ircflp == 1)
+      fused_kernel = 2;
+  }
+
   if (icoupl > 0) {
     assert(f_id != -1);
     const cs_int_t coupling_key_id = cs_field_key_id("coupling_entity");
@@ -3730,6 +4088,73 @@ cs_convection_diffusion_vector(int                         idtvar,
         }
       }
 
+    /* Unsteady, fused kernel: upwind convection and non-reconstructed
+       diffusion, with the scheme flags compiled out */
+    } else if (fused_kernel == 1) {
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for reduction(+:n_upwind)
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
+
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_t b_flux[2][3][CS_CD_FACE_BLOCK_SIZE];
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              cs_real_t i_mf = i_massflux[face_id];
+
+              cs_real_t flui = 0.5*(i_mf + fabs(i_mf));
+              cs_real_t fluj = 0.5*(i_mf - fabs(i_mf));
+
+              cs_real_t tv = thetap*i_visc[face_id];
+
+              for (int isou = 0; isou < 3; isou++) {
+
+                cs_real_t pi = _pvar[ii][isou];
+                cs_real_t pj = _pvar[jj][isou];
+
+                cs_real_t fluxc = thetap*(flui*pi + fluj*pj);
+                cs_real_t fluxd = tv*(pi - pj);
+
+                b_flux[0][isou][face_id - b_id]
+                  = fluxc - imasac*i_mf*pi + fluxd;
+                b_flux[1][isou][face_id - b_id]
+                  = fluxc - imasac*i_mf*pj + fluxd;
+
+              }
+
+            }
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              /* in parallel, face will be counted by one and only one rank */
+              if (ii < n_cells) {
+                n_upwind++;
+              }
+
+              for (int isou = 0; isou < 3; isou++) {
+                rhs[ii][isou] -= b_flux[0][isou][face_id - b_id];
+                rhs[jj][isou] += b_flux[1][isou][face_id - b_id];
+              }
+
+            }
+
+          }
+        }
+      }
+
     /* Unsteady */
     } else {
 
@@ -3926,6 +4351,88 @@ cs_convection_diffusion_vector(int                         idtvar,
         }
       }
 
+      /* Unsteady, fused kernel: centered convection with reconstructed
+         fluxes, with the scheme flags compiled out */
+    } else if (fused_kernel == 2) {
+
+      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#       pragma omp parallel for
+        for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+          cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+          cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+
+          for (cs_lnum_t b_id = s_id; b_id < e_id;
+               b_id += CS_CD_FACE_BLOCK_SIZE) {
+
+            cs_lnum_t b_e_id = CS_MIN(b_id + CS_CD_FACE_BLOCK_SIZE, e_id);
+            cs_real_t b_flux[2][3][CS_CD_FACE_BLOCK_SIZE];
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              cs_real_t pnd = weight[face_id];
+              cs_real_t i_mf = i_massflux[face_id];
+
+              cs_real_t flui = 0.5*(i_mf + fabs(i_mf));
+              cs_real_t fluj = 0.5*(i_mf - fabs(i_mf));
+
+              cs_real_t tv = thetap*i_visc[face_id];
+
+              for (int isou = 0; isou < 3; isou++) {
+
+                cs_real_t pi = _pvar[ii][isou];
+                cs_real_t pj = _pvar[jj][isou];
+
+                /* Reconstruction at I' and J' */
+
+                cs_real_t dpvf[3];
+                for (int jsou = 0; jsou < 3; jsou++)
+                  dpvf[jsou] = 0.5*(  grad[ii][isou][jsou]
+                                    + grad[jj][isou][jsou]);
+
+                cs_real_t pip = pi + cs_math_3_dot_product(dpvf,
+                                                           diipf[face_id]);
+                cs_real_t pjp = pj + cs_math_3_dot_product(dpvf,
+                                                           djjpf[face_id]);
+
+                /* Centered face value, blended with upwind */
+
+                cs_real_t pc = pnd*pip + (1.-pnd)*pjp;
+
+                cs_real_t pif = blencp*pc + (1.-blencp)*pi;
+                cs_real_t pjf = blencp*pc + (1.-blencp)*pj;
+
+                cs_real_t fluxc = thetap*(flui*pif + fluj*pjf);
+                cs_real_t fluxd = tv*(pip - pjp);
+
+                b_flux[0][isou][face_id - b_id]
+                  = fluxc - imasac*i_mf*pi + fluxd;
+                b_flux[1][isou][face_id - b_id]
+                  = fluxc - imasac*i_mf*pj + fluxd;
+
+              }
+
+            }
+
+            for (cs_lnum_t face_id = b_id; face_id < b_e_id; face_id++) {
+
+              cs_lnum_t ii = i_face_cells[face_id][0];
+              cs_lnum_t jj = i_face_cells[face_id][1];
+
+              for (int isou = 0; isou < 3; isou++) {
+                rhs[ii][isou] -= b_flux[0][isou][face_id - b_id];
+                rhs[jj][isou] += b_flux[1][isou][face_id - b_id];
+              }
+
+            }
+
+          }
+        }
+      }
+
       /* Unsteady */
     } else {
 
@@ -5858,8 +6365,6 @@ cs_convection_diffusion_thermal(int                       idtvar,
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *restrict)m->b_face_cells;
   const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
   const cs_real_t *restrict cell_vol = fvq->cell_vol;
   const cs_real_3_t *restrict cell_cen
     = (const cs_real_3_t *restrict)fvq->cell_cen;
@@ -6458,6 +6963,14 @@ cs_convection_diffusion_thermal(int                       idtvar,
                 _("invalid value of isstpc"));
     }
 
+    /* Cached geometric quantities, shared by all advected fields */
+
+    _update_i_geom_cache(isstpp == 3);
+
+    const cs_real_t *restrict i_dist_factor = _i_dist_factor;
+    const cs_real_6_t *restrict i_nvd_geom
+      = (const cs_real_6_t *restrict)_i_nvd_geom;
+
     /* Steady */
     if (idtvar < 0) {
 
@@ -6486,8 +6999,7 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                       blencp,
                                       blend_st,
                                       weight[face_id],
-                                      i_dist[face_id],
-                                      i_face_surf[face_id],
+                                      i_dist_factor[face_id],
                                       cell_cen[ii],
                                       cell_cen[jj],
                                       i_face_normal[face_id],
@@ -6586,8 +7098,7 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                           blencp,
                                           blend_st,
                                           weight[face_id],
-                                          i_dist[face_id],
-                                          i_face_surf[face_id],
+                                          i_dist_factor[face_id],
                                           cell_cen[ii],
                                           cell_cen[jj],
                                           i_face_normal[face_id],
@@ -6659,32 +7170,22 @@ cs_convection_diffusion_thermal(int                       idtvar,
               p_c = _pvar[ic];
               p_d = _pvar[id];
 
-              /* Compute the distance between the face and the
-                 centroid of the central cell */
-              cs_real_3_t rfc;
-              rfc[0] = i_face_cog[face_id][0] - cell_cen[ic][0];
-              rfc[1] = i_face_cog[face_id][1] - cell_cen[ic][1];
-              rfc[2] = i_face_cog[face_id][2] - cell_cen[ic][2];
+              /* Cached stencil geometry: unit vector of the line that
+                 joins the current point with the downwind point (oriented
+                 from central to downwind cell), associated distance, and
+                 normalised distances, with the upwind point placed on the
+                 same line at the same distance as that between the
+                 two cells */
 
-              const cs_real_t dist_fc = cs_math_3_norm(rfc);
+              const cs_real_t o_sgn = (ic == ii) ? 1. : -1.;
+              const cs_real_t dist_dc = i_nvd_geom[face_id][3];
 
-              /* Compute the vector of the line that joins the current point
-                 with the downwind point */
-              cs_real_3_t rdc, ndc;
-              rdc[0] = cell_cen[id][0] - cell_cen[ic][0];
-              rdc[1] = cell_cen[id][1] - cell_cen[ic][1];
-              rdc[2] = cell_cen[id][2] - cell_cen[ic][2];
+              cs_real_3_t ndc;
+              ndc[0] = o_sgn*i_nvd_geom[face_id][0];
+              ndc[1] = o_sgn*i_nvd_geom[face_id][1];
+              ndc[2] = o_sgn*i_nvd_geom[face_id][2];
 
-              const cs_real_t dist_dc = cs_math_3_norm(rdc);
-
-              ndc[0] = rdc[0]/dist_dc;
-              ndc[1] = rdc[1]/dist_dc;
-              ndc[2] = rdc[2]/dist_dc;
-
-              /* Locate the upwind point to be on the line that joins
-                 the two cells on the upwind side and the same distance */
               const cs_real_t dist_cu = dist_dc;
-              const cs_real_t dist_du = dist_dc + dist_cu;
 
               /* Compute the property on the upwind assuming a parabolic
                  variation of the property between the two cells */
@@ -6695,9 +7196,9 @@ cs_convection_diffusion_thermal(int                       idtvar,
               p_u = p_c + (grad2c*dist_cu - gradc)*dist_cu;
               p_u = CS_MAX(CS_MIN(p_u, local_max[ic]), local_min[ic]);
 
-              /* Compute the normalised distances */
-              const cs_real_t nvf_r_f = (dist_fc+dist_cu)/dist_du;
-              const cs_real_t nvf_r_c = dist_cu/dist_du;
+              const cs_real_t nvf_r_f = (ic == ii) ?
+                i_nvd_geom[face_id][4] : i_nvd_geom[face_id][5];
+              const cs_real_t nvf_r_c = 0.5;
 
               /* Check for the bounds of the NVD diagram and compute
                  the face property according to the selected NVD scheme */
@@ -11163,6 +11664,23 @@ cs_anisotropic_diffusion_potential(const int                 f_id,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached interior face quantities used by the slope test and
+ *        NVD/TVD limiters.
+ *
+ * The cache is rebuilt automatically the next time it is needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_free_quantities(void)
+{
+  BFT_FREE(_i_dist_factor);
+  BFT_FREE(_i_nvd_geom);
+  _i_geom_compute_count = -1;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -115,8 +115,7 @@ typedef enum {
  *
  * \param[in]     pi              value at cell i
  * \param[in]     pj              value at cell j
- * \param[in]     distf           distance IJ.Nij
- * \param[in]     srfan           face surface
+ * \param[in]     i_dist_factor   face surface / distance IJ.Nij
  * \param[in]     i_face_normal   face normal
  * \param[in]     gradi           gradient at cell i
  * \param[in]     gradj           gradient at cell j
@@ -131,8 +130,7 @@ typedef enum {
 inline static void
 cs_slope_test(const cs_real_t   pi,
               const cs_real_t   pj,
-              const cs_real_t   distf,
-              const cs_real_t   srfan,
+              const cs_real_t   i_dist_factor,
               const cs_real_t   i_face_normal[3],
               const cs_real_t   gradi[3],
               const cs_real_t   gradj[3],
@@ -163,12 +161,12 @@ cs_slope_test(const cs_real_t   pi,
           + gradi[1]*i_face_normal[1]
           + gradi[2]*i_face_normal[2];
     ddi = testi;
-    ddj = (pj-pi)/distf *srfan;
+    ddj = (pj-pi)*i_dist_factor;
   } else {
     dcc =   gradj[0]*i_face_normal[0]
           + gradj[1]*i_face_normal[1]
           + gradj[2]*i_face_normal[2];
-    ddi = (pj-pi)/distf *srfan;
+    ddi = (pj-pi)*i_dist_factor;
     ddj = testj;
   }
 
@@ -2474,8 +2472,7 @@ cs_i_cd_unsteady_tensor(const int           ircflp,
  *                                when the slope test is activated
  *                                (1-blend_st) is the proportion of upwind.
  * \param[in]     weight          geometrical weight
- * \param[in]     i_dist          distance IJ.Nij
- * \param[in]     i_face_surf     face surface
+ * \param[in]     i_dist_factor   face surface / distance IJ.Nij
  * \param[in]     cell_ceni       center of gravity coordinates of cell i
  * \param[in]     cell_cenj       center of gravity coordinates of cell j
  * \param[in]     i_face_normal   face normal
@@ -2513,8 +2510,7 @@ cs_i_cd_steady_slope_test(bool              *upwind_switch,
                           const double       blencp,
                           const double       blend_st,
                           const cs_real_t    weight,
-                          const cs_real_t    i_dist,
-                          const cs_real_t    i_face_surf,
+                          const cs_real_t    i_dist_factor,
                           const cs_real_3_t  cell_ceni,
                           const cs_real_3_t  cell_cenj,
                           const cs_real_3_t  i_face_normal,
@@ -2575,8 +2571,7 @@ cs_i_cd_steady_slope_test(bool              *upwind_switch,
   if (iconvp > 0) {
     cs_slope_test(pi,
                   pj,
-                  i_dist,
-                  i_face_surf,
+                  i_dist_factor,
                   i_face_normal,
                   gradi,
                   gradj,
@@ -3414,8 +3409,7 @@ cs_i_cd_steady_slope_test_tensor(bool               *upwind_switch,
  *                                when the slope test is activated
  *                                (1-blend_st) is the proportion of upwind.
  * \param[in]     weight          geometrical weight
- * \param[in]     i_dist          distance IJ.Nij
- * \param[in]     i_face_surf     face surface
+ * \param[in]     i_dist_factor   face surface / distance IJ.Nij
  * \param[in]     cell_ceni       center of gravity coordinates of cell i
  * \param[in]     cell_cenj       center of gravity coordinates of cell i
  * \param[in]     i_face_normal   face normal
@@ -3446,8 +3440,7 @@ cs_i_cd_unsteady_slope_test(bool              *upwind_switch,
                             const double       blencp,
                             const double       blend_st,
                             const cs_real_t    weight,
-                            const cs_real_t    i_dist,
-                            const cs_real_t    i_face_surf,
+                            const cs_real_t    i_dist_factor,
                             const cs_real_3_t  cell_ceni,
                             const cs_real_3_t  cell_cenj,
                             const cs_real_3_t  i_face_normal,
@@ -3491,8 +3484,7 @@ cs_i_cd_unsteady_slope_test(bool              *upwind_switch,
   if (iconvp > 0) {
     cs_slope_test(pi,
                   pj,
-                  i_dist,
-                  i_face_surf,
+                  i_dist_factor,
                   i_face_normal,
                   gradi,
                   gradj,
@@ -6137,6 +6129,18 @@ cs_anisotropic_diffusion_potential(const int                 f_id,
                                    const cs_real_t           weighb[],
                                    cs_real_t       *restrict diverg);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached interior face quantities used by the slope test and
+ *        NVD/TVD limiters.
+ *
+ * The cache is rebuilt automatically the next time it is needed.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_free_quantities(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
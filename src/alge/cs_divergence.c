@@ -53,6 +53,7 @@
 #include "cs_halo_perio.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_gradient.h"
@@ -95,6 +96,68 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add the integrated mass flux on cells by a gather over cell adjacencies.
+ *
+ * Each cell row is summed in a fixed adjacency order by a single thread,
+ * so the result does not depend on the number of threads or on the face
+ * renumbering groups, and no scatter conflicts are involved; the
+ * variable face-based accumulation only guarantees this for a given
+ * numbering and thread layout.
+ *
+ * Ghost cell values, initialized by the caller, are left untouched; the
+ * face-based accumulation only held partial sums there.
+ *
+ * parameters:
+ *   m          <-- pointer to mesh
+ *   madj       <-- pointer to mesh adjacencies structure
+ *   i_massflux <-- mass flux at interior faces
+ *   b_massflux <-- mass flux at boundary faces
+ *   diverg     <-> mass flux divergence (incremented)
+ *----------------------------------------------------------------------------*/
+
+static void
+_divergence_gather(const cs_mesh_t              *m,
+                   const cs_mesh_adjacencies_t  *madj,
+                   const cs_real_t               i_massflux[],
+                   const cs_real_t               b_massflux[],
+                   cs_real_t           *restrict diverg)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)madj->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_face
+    = (const cs_lnum_t *restrict)madj->cell_cells_face;
+  const cs_lnum_t *restrict cell_b_faces_idx
+    = (const cs_lnum_t *restrict)madj->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces
+    = (const cs_lnum_t *restrict)madj->cell_b_faces;
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+    cs_real_t d = 0.;
+
+    for (cs_lnum_t i = cell_cells_idx[ii]; i < cell_cells_idx[ii+1]; i++) {
+      cs_lnum_t face_id = cell_cells_face[i];
+      if (i_face_cells[face_id][0] == ii)
+        d += i_massflux[face_id];
+      else
+        d -= i_massflux[face_id];
+    }
+
+    for (cs_lnum_t i = cell_b_faces_idx[ii]; i < cell_b_faces_idx[ii+1]; i++)
+      d += b_massflux[cell_b_faces[i]];
+
+    diverg[ii] += d;
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1448,6 +1511,21 @@ cs_divergence(const cs_mesh_t          *m,
               _("invalid value of init"));
   }
 
+  /* Gather-based accumulation when the mesh adjacencies provide the
+     matching face ids; summation order is then fixed by the adjacency,
+     independently of the thread count and face renumbering. */
+
+  const cs_mesh_adjacencies_t *madj = cs_glob_mesh_adjacencies;
+
+  if (   madj != NULL
+      && madj->cell_cells_face != NULL
+      && madj->single_faces_to_cells) {
+
+    _divergence_gather(m, madj, i_massflux, b_massflux, diverg);
+
+    return;
+
+  }
 
   /*==========================================================================
     2. Integration on internal faces
@@ -870,14 +870,14 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
                           const cs_real_t        var[],
                           cs_real_3_t  *restrict grad)
 {
-  cs_gnum_t  t_n_clip;
+  cs_gnum_t  t_n_clip, t_n_mod;
   cs_real_t  global_min_factor, global_max_factor;
   cs_real_t  t_min_factor, t_max_factor;
 
-  cs_gnum_t  n_clip = 0, n_g_clip = 0;
+  cs_gnum_t  n_clip = 0, n_mod = 0;
   cs_real_t  min_factor = 1, max_factor = 0;
   cs_real_t  *buf = NULL, *restrict clip_factor = NULL;
-  cs_real_t  *restrict denom = NULL, *restrict denum = NULL;
+  cs_real_2_t  *restrict dd = NULL;
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const int n_i_groups = mesh->i_face_numbering->n_groups;
@@ -897,9 +897,11 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
   if (clip_mode < 0)
     return;
 
-  /* Synchronize variable */
+  /* Synchronize variable; on the standard halo, the gradient kernels
+     have already synchronized grad, so only the extended section
+     may be stale */
 
-  if (halo != NULL) {
+  if (halo != NULL && halo_type == CS_HALO_EXTENDED) {
 
     /* Exchange for the gradients. Not useful for working array */
 
@@ -926,28 +928,28 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
 
   } /* End if halo */
 
-  /* Allocate and initialize working buffers */
+  /* Allocate and initialize working buffers; denum and denom are
+     interleaved so a single halo exchange may update both */
 
   if (clip_mode == 1)
     BFT_MALLOC(buf, 3*n_cells_ext, cs_real_t);
   else
     BFT_MALLOC(buf, 2*n_cells_ext, cs_real_t);
 
-  denum = buf;
-  denom = buf + n_cells_ext;
+  dd = (cs_real_2_t *)buf;
 
   if (clip_mode == 1)
     clip_factor = buf + 2*n_cells_ext;
 
 # pragma omp parallel for
   for (cs_lnum_t ii = 0; ii < n_cells_ext; ii++) {
-    denum[ii] = 0;
-    denom[ii] = 0;
+    dd[ii][0] = 0;
+    dd[ii][1] = 0;
   }
 
   /* First computations:
-      denum holds the maximum variation of the gradient
-      denom holds the maximum variation of the variable */
+      dd[][0] (denum) holds the maximum variation of the gradient
+      dd[][1] (denom) holds the maximum variation of the variable */
 
   if (clip_mode == 0) {
 
@@ -974,10 +976,10 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
 
           cs_real_t dvar = CS_ABS(var[ii] - var[jj]);
 
-          denum[ii] = CS_MAX(denum[ii], dist1);
-          denum[jj] = CS_MAX(denum[jj], dist2);
-          denom[ii] = CS_MAX(denom[ii], dvar);
-          denom[jj] = CS_MAX(denom[jj], dvar);
+          dd[ii][0] = CS_MAX(dd[ii][0], dist1);
+          dd[jj][0] = CS_MAX(dd[jj][0], dist2);
+          dd[ii][1] = CS_MAX(dd[ii][1], dvar);
+          dd[jj][1] = CS_MAX(dd[jj][1], dvar);
 
         } /* End of loop on faces */
 
@@ -1006,8 +1008,8 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
                                    + dist[2]*grad[ii][2]);
           cs_real_t dvar = CS_ABS(var[ii] - var[jj]);
 
-          denum[ii] = CS_MAX(denum[ii], dist1);
-          denom[ii] = CS_MAX(denom[ii], dvar);
+          dd[ii][0] = CS_MAX(dd[ii][0], dist1);
+          dd[ii][1] = CS_MAX(dd[ii][1], dvar);
 
         }
       }
@@ -1040,10 +1042,10 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
                                    + dist[2]*dpdzf);
           cs_real_t dvar = CS_ABS(var[ii] - var[jj]);
 
-          denum[ii] = CS_MAX(denum[ii], dist1);
-          denum[jj] = CS_MAX(denum[jj], dist1);
-          denom[ii] = CS_MAX(denom[ii], dvar);
-          denom[jj] = CS_MAX(denom[jj], dvar);
+          dd[ii][0] = CS_MAX(dd[ii][0], dist1);
+          dd[jj][0] = CS_MAX(dd[jj][0], dist1);
+          dd[ii][1] = CS_MAX(dd[ii][1], dvar);
+          dd[jj][1] = CS_MAX(dd[jj][1], dvar);
 
         } /* End of loop on faces */
 
@@ -1076,8 +1078,8 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
                                    + dist[2]*dpdzf);
           cs_real_t dvar = CS_ABS(var[ii] - var[jj]);
 
-          denum[ii] = CS_MAX(denum[ii], dist1);
-          denom[ii] = CS_MAX(denom[ii], dvar);
+          dd[ii][0] = CS_MAX(dd[ii][0], dist1);
+          dd[ii][1] = CS_MAX(dd[ii][1], dvar);
 
         }
       }
@@ -1101,9 +1103,9 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
 #     pragma omp for
       for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
 
-        if (denum[ii] > climgp * denom[ii]) {
+        if (dd[ii][0] > climgp * dd[ii][1]) {
 
-          cs_real_t factor1 = climgp * denom[ii]/denum[ii];
+          cs_real_t factor1 = climgp * dd[ii][1]/dd[ii][0];
           grad[ii][0] *= factor1;
           grad[ii][1] *= factor1;
           grad[ii][2] *= factor1;
@@ -1124,6 +1126,8 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
       }
     } /* End of omp parallel construct */
 
+    n_mod = n_clip;
+
   }
   else if (clip_mode == 1) {
 
@@ -1134,14 +1138,14 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
     /* Synchronize variable */
 
     if (halo != NULL) {
-      if (idimtr > 0) {
-        cs_halo_sync_component(halo, halo_type, CS_HALO_ROTATION_IGNORE, denom);
-        cs_halo_sync_component(halo, halo_type, CS_HALO_ROTATION_IGNORE, denum);
-      }
-      else {
-        cs_halo_sync_var(halo, halo_type, denom);
-        cs_halo_sync_var(halo, halo_type, denum);
-      }
+      if (idimtr > 0)
+        cs_halo_sync_components_strided(halo,
+                                        halo_type,
+                                        CS_HALO_ROTATION_IGNORE,
+                                        (cs_real_t *)dd,
+                                        2);
+      else
+        cs_halo_sync_var_strided(halo, halo_type, (cs_real_t *)dd, 2);
     }
 
     for (int g_id = 0; g_id < n_i_groups; g_id++) {
@@ -1157,12 +1161,12 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
           cs_lnum_t jj = i_face_cells[face_id][1];
 
           cs_real_t factor1 = 1.0;
-          if (denum[ii] > climgp * denom[ii])
-            factor1 = climgp * denom[ii]/denum[ii];
+          if (dd[ii][0] > climgp * dd[ii][1])
+            factor1 = climgp * dd[ii][1]/dd[ii][0];
 
           cs_real_t factor2 = 1.0;
-          if (denum[jj] > climgp * denom[jj])
-            factor2 = climgp * denom[jj]/denum[jj];
+          if (dd[jj][0] > climgp * dd[jj][1])
+            factor2 = climgp * dd[jj][1]/dd[jj][0];
 
           min_factor = CS_MIN(factor1, factor2);
 
@@ -1192,8 +1196,8 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
 
           cs_real_t factor2 = 1.0;
 
-          if (denum[jj] > climgp * denom[jj])
-            factor2 = climgp * denom[jj]/denum[jj];
+          if (dd[jj][0] > climgp * dd[jj][1])
+            factor2 = climgp * dd[jj][1]/dd[jj][0];
 
           factor1 = CS_MIN(factor1, factor2);
 
@@ -1205,9 +1209,10 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
 
     } /* End for extended neighborhood */
 
-#   pragma omp parallel private(t_min_factor, t_max_factor, t_n_clip)
+#   pragma omp parallel private(t_min_factor, t_max_factor, t_n_clip, t_n_mod)
     {
       t_n_clip = 0;
+      t_n_mod = 0;
       t_min_factor = min_factor; t_max_factor = max_factor;
 
 #     pragma omp for
@@ -1216,6 +1221,9 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
         for (int ll = 0; ll < 3; ll++)
           grad[ii][ll] *= clip_factor[ii];
 
+        if (clip_factor[ii] < 1.)
+          t_n_mod++;
+
         if (clip_factor[ii] < 0.99) {
           t_max_factor = CS_MAX(t_max_factor, clip_factor[ii]);
           t_min_factor = CS_MIN(t_min_factor, clip_factor[ii]);
@@ -1229,6 +1237,7 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
         min_factor = CS_MIN(min_factor, t_min_factor);
         max_factor = CS_MAX(max_factor, t_max_factor);
         n_clip += t_n_clip;
+        n_mod += t_n_mod;
       }
     } /* End of omp parallel construct */
 
@@ -1256,12 +1265,15 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
 
     min_factor = global_min_factor;
 
-    /* Sum number of clippings */
+    /* Sum number of clippings and modifications */
 
-    MPI_Allreduce(&n_clip, &n_g_clip, 1, CS_MPI_GNUM,
+    cs_gnum_t sum_buf[2] = {n_clip, n_mod}, g_sum_buf[2];
+
+    MPI_Allreduce(sum_buf, g_sum_buf, 2, CS_MPI_GNUM,
                   MPI_SUM, cs_glob_mpi_comm);
 
-    n_clip = n_g_clip;
+    n_clip = g_sum_buf[0];
+    n_mod = g_sum_buf[1];
 
   } /* If n_domains > 1 */
 
@@ -1274,9 +1286,10 @@ _scalar_gradient_clipping(cs_halo_type_t         halo_type,
                  "   minimum factor = %14.5e; maximum factor = %14.5e\n"),
                (unsigned long long)n_clip, min_factor, max_factor);
 
-  /* Synchronize grad */
+  /* Synchronize grad; if no gradient was modified on any rank,
+     the synchronization done by the gradient kernels still holds */
 
-  if (halo != NULL) {
+  if (halo != NULL && n_mod > 0) {
 
     if (idimtr > 0) {
 
@@ -1637,7 +1650,7 @@ _initialize_scalar_gradient_old(const cs_mesh_t             *m,
 
   /* Synchronize halos */
 
-  _sync_scalar_gradient_halo(m, CS_HALO_EXTENDED, idimtr, grad);
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
 }
 
 /*----------------------------------------------------------------------------
@@ -1961,7 +1974,13 @@ _initialize_scalar_gradient(const cs_mesh_t                *m,
 
   /* Synchronize halos */
 
-  _sync_scalar_gradient_halo(m, CS_HALO_EXTENDED, idimtr, grad);
+  /* Only face-adjacent ghost values of the gradient are read downstream
+     (face-based reconstruction and slope tests), so restricting the
+     exchange to the standard halo is sufficient, as in the iterative
+     gradient; this avoids extra ghost traffic when the mesh uses an
+     extended halo for least-squares purposes. */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
 }
 
 /*----------------------------------------------------------------------------
@@ -2384,6 +2403,166 @@ _iterative_scalar_gradient_old(const cs_mesh_t             *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradient using least-squares reconstruction, assembling
+ * the right-hand side in a single gather pass over cell adjacencies.
+ *
+ * Compared to the face-based assembly, each cell is visited exactly once,
+ * using the cs_mesh_adjacencies_t CSR arrays, so no face renumbering
+ * groups or write conflicts are involved, and the variable and geometric
+ * data are streamed once per cell. The (inverted) cocg tensors are those
+ * already cached in the mesh quantities, which only depend on geometry
+ * (and on boundary condition coefficients at boundary cells, handled by
+ * the caller when recompute_cocg is set).
+ *
+ * Restricted to the standard case: no hydrostatic pressure contribution,
+ * no cell weighting, no internal coupling, no gradient extrapolation at
+ * boundary faces.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   madj           <-- pointer to mesh adjacencies structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   idimtr         <-- 0 if ivar does not match a vector or tensor
+ *                        or there is no periodicity of rotation
+ *                      1 for velocity, 2 for Reynolds stress
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   pvar           <-- variable
+ *   cocg           <-- inverted cocg tensors
+ *   grad           <-> gradient of pvar (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_gather(const cs_mesh_t              *m,
+                            const cs_mesh_adjacencies_t  *madj,
+                            const cs_mesh_quantities_t   *fvq,
+                            cs_halo_type_t                halo_type,
+                            int                           idimtr,
+                            cs_real_t                     inc,
+                            const cs_real_t               coefap[],
+                            const cs_real_t               coefbp[],
+                            const cs_real_t               pvar[],
+                            const cs_real_33_t  *restrict cocg,
+                            cs_real_3_t         *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)madj->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells
+    = (const cs_lnum_t *restrict)madj->cell_cells;
+  const cs_lnum_t *restrict cell_cells_e_idx
+    = (const cs_lnum_t *restrict)madj->cell_cells_e_idx;
+  const cs_lnum_t *restrict cell_cells_e
+    = (const cs_lnum_t *restrict)madj->cell_cells_e;
+  const cs_lnum_t *restrict cell_b_faces_idx
+    = (const cs_lnum_t *restrict)madj->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces
+    = (const cs_lnum_t *restrict)madj->cell_b_faces;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+
+  const bool e_nbr =    halo_type == CS_HALO_EXTENDED
+                     && cell_cells_e_idx != NULL;
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+    cs_real_t rhs[3] = {0., 0., 0.};
+    cs_real_t dc[3], dsij[3];
+
+    const cs_real_t pvar_ii = pvar[ii];
+
+    /* Contribution from interior faces (gathered by adjacent cell) */
+
+    for (cs_lnum_t i = cell_cells_idx[ii]; i < cell_cells_idx[ii+1]; i++) {
+
+      cs_lnum_t jj = cell_cells[i];
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+      cs_real_t pfac =   (pvar[jj] - pvar_ii)
+                       / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] += dc[ll] * pfac;
+
+    }
+
+    /* Contribution from extended neighborhood */
+
+    if (e_nbr) {
+
+      for (cs_lnum_t i = cell_cells_e_idx[ii];
+           i < cell_cells_e_idx[ii+1];
+           i++) {
+
+        cs_lnum_t jj = cell_cells_e[i];
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        cs_real_t pfac =   (pvar[jj] - pvar_ii)
+                         / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhs[ll] += dc[ll] * pfac;
+
+      }
+
+    }
+
+    /* Contribution from boundary faces */
+
+    for (cs_lnum_t i = cell_b_faces_idx[ii]; i < cell_b_faces_idx[ii+1]; i++) {
+
+      cs_lnum_t face_id = cell_b_faces[i];
+
+      cs_real_t unddij = 1. / b_dist[face_id];
+      cs_real_t udbfs = 1. / b_face_surf[face_id];
+      cs_real_t umcbdd = (1. - coefbp[face_id]) * unddij;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        dsij[ll] =   udbfs * b_face_normal[face_id][ll]
+                   + umcbdd * diipb[face_id][ll];
+
+      cs_real_t pfac =   (  coefap[face_id]*inc
+                          + (coefbp[face_id] -1.)*pvar_ii)
+                       * unddij;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        rhs[ll] += dsij[ll] * pfac;
+
+    }
+
+    /* Apply inverted local cocg to obtain gradient */
+
+    for (cs_lnum_t ll = 0; ll < 3; ll++)
+      grad[ii][ll] =   cocg[ii][ll][0] * rhs[0]
+                     + cocg[ii][ll][1] * rhs[1]
+                     + cocg[ii][ll][2] * rhs[2];
+
+  }
+
+  /* Synchronize halos */
+
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction for non-orthogonal
  * meshes (nswrgp > 1).
@@ -2618,6 +2797,38 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   } /* End of recompute_cocg */
 
+  /* Fused single-pass assembly in the standard case: the RHS is gathered
+     cell by cell using the mesh adjacencies, and the gradient obtained
+     directly, halving memory traffic compared to the face-based passes
+     below. Usable when each cell pair shares a single face, so gathering
+     by adjacent cell is equivalent to the face-based assembly. */
+
+  const cs_mesh_adjacencies_t *madj = cs_glob_mesh_adjacencies;
+
+  if (   (hyd_p_flag == 0 || hyd_p_flag == 2)
+      && cpl == NULL
+      && c_weight == NULL
+      && extrap <= 0.
+      && madj != NULL
+      && madj->cell_cells_idx != NULL
+      && madj->single_faces_to_cells) {
+
+    _lsq_scalar_gradient_gather(m,
+                                madj,
+                                fvq,
+                                halo_type,
+                                idimtr,
+                                inc,
+                                coefap,
+                                coefbp,
+                                pvar,
+                                (const cs_real_33_t *)cocg,
+                                grad);
+
+    return;
+
+  }
+
   /* Compute Right-Hand Side */
   /*-------------------------*/
 
@@ -5854,7 +6065,61 @@ _reconstruct_scalar_gradient(const cs_mesh_t                 *m,
 
   /* Synchronize halos */
 
-  _sync_scalar_gradient_halo(m, CS_HALO_EXTENDED, idimtr, grad);
+  _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+}
+
+/*----------------------------------------------------------------------------
+ * Increment the gradient of a scalar for a list of cells, based on the
+ * right hand side assembled during an iterative reconstruction sweep.
+ *
+ * The right hand side is scaled by the inverse cell volume, so it may be
+ * used directly for the residual computation after this call.
+ *
+ * parameters:
+ *   n_cells      <-- number of cells in list
+ *   cell_ids     <-- list of cell ids, or NULL for [0, n_cells[
+ *   c_solid_flag <-- indicator of fully solid cells
+ *   is_p         <-- 1 for porous models, 0 otherwise
+ *   cell_f_vol   <-- cell fluid volumes
+ *   cocg         <-- geometric matrices for iterative gradients
+ *   rhs          <-> right hand side
+ *   grad         <-> gradient of pvar
+ *----------------------------------------------------------------------------*/
+
+static void
+_iterative_scalar_gradient_increment(cs_lnum_t                     n_cells,
+                                     const cs_lnum_t    *restrict  cell_ids,
+                                     const cs_int_t     *restrict  c_solid_flag,
+                                     int                           is_p,
+                                     const cs_real_t    *restrict  cell_f_vol,
+                                     const cs_real_33_t *restrict  cocg,
+                                     cs_real_3_t        *restrict  rhs,
+                                     cs_real_3_t        *restrict  grad)
+{
+# pragma omp parallel for
+  for (cs_lnum_t c_idx = 0; c_idx < n_cells; c_idx++) {
+    cs_lnum_t cell_id = (cell_ids != NULL) ? cell_ids[c_idx] : c_idx;
+    cs_real_t dvol;
+    /* Is the cell fully solid? */
+    if (c_solid_flag[is_p * cell_id] == 0)
+      dvol = 1. / cell_f_vol[cell_id];
+    else
+      dvol = 0.;
+
+    rhs[cell_id][0] *= dvol;
+    rhs[cell_id][1] *= dvol;
+    rhs[cell_id][2] *= dvol;
+
+    grad[cell_id][0] +=   rhs[cell_id][0] * cocg[cell_id][0][0]
+                        + rhs[cell_id][1] * cocg[cell_id][1][0]
+                        + rhs[cell_id][2] * cocg[cell_id][2][0];
+    grad[cell_id][1] +=   rhs[cell_id][0] * cocg[cell_id][0][1]
+                        + rhs[cell_id][1] * cocg[cell_id][1][1]
+                        + rhs[cell_id][2] * cocg[cell_id][2][1];
+    grad[cell_id][2] +=   rhs[cell_id][0] * cocg[cell_id][0][2]
+                        + rhs[cell_id][1] * cocg[cell_id][1][2]
+                        + rhs[cell_id][2] * cocg[cell_id][2][2];
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -5971,6 +6236,39 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
 
   BFT_MALLOC(rhs, n_cells_ext, cs_real_3_t);
 
+  /* When running in parallel without periodicity of rotation, the halo
+     exchange of the updated gradient may be overlapped with computation:
+     cells whose values must be sent to neighboring ranks are listed first,
+     followed by purely interior cells. */
+
+  cs_lnum_t n_halo_cells = 0;
+  cs_lnum_t *halo_cell_ids = NULL;
+
+  if (m->halo != NULL && idimtr == 0 && cs_glob_n_ranks > 1) {
+
+    const cs_halo_t *halo = m->halo;
+    char *is_halo_cell;
+
+    BFT_MALLOC(is_halo_cell, n_cells, char);
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      is_halo_cell[cell_id] = 0;
+    for (cs_lnum_t i = 0; i < halo->n_send_elts[1]; i++)
+      is_halo_cell[halo->send_list[i]] = 1;
+
+    BFT_MALLOC(halo_cell_ids, n_cells, cs_lnum_t);
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      if (is_halo_cell[cell_id])
+        halo_cell_ids[n_halo_cells++] = cell_id;
+    }
+    cs_lnum_t j = n_halo_cells;
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      if (!is_halo_cell[cell_id])
+        halo_cell_ids[j++] = cell_id;
+    }
+
+    BFT_FREE(is_halo_cell);
+  }
+
   /* Vector OijFij is computed in CLDijP */
 
   /* Start iterations */
@@ -6214,37 +6512,55 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
     /* Increment gradient */
     /*--------------------*/
 
-#   pragma omp parallel for
-    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
-      cs_real_t dvol;
-      /* Is the cell fully solid? */
-      if (c_solid_flag[is_p * cell_id] == 0)
-        dvol = 1. / cell_f_vol[cell_id];
-      else
-        dvol = 0.;
-
-      rhs[cell_id][0] *= dvol;
-      rhs[cell_id][1] *= dvol;
-      rhs[cell_id][2] *= dvol;
-
-      grad[cell_id][0] +=   rhs[cell_id][0] * cocg[cell_id][0][0]
-                          + rhs[cell_id][1] * cocg[cell_id][1][0]
-                          + rhs[cell_id][2] * cocg[cell_id][2][0];
-      grad[cell_id][1] +=   rhs[cell_id][0] * cocg[cell_id][0][1]
-                          + rhs[cell_id][1] * cocg[cell_id][1][1]
-                          + rhs[cell_id][2] * cocg[cell_id][2][1];
-      grad[cell_id][2] +=   rhs[cell_id][0] * cocg[cell_id][0][2]
-                          + rhs[cell_id][1] * cocg[cell_id][1][2]
-                          + rhs[cell_id][2] * cocg[cell_id][2][2];
+    if (halo_cell_ids != NULL) {
+
+      /* Cells whose values appear in the halo send list are updated
+         first, so that the exchange of ghost values may be started
+         immediately and overlap with the update of interior cells
+         and the residual computation. */
+
+      _iterative_scalar_gradient_increment(n_halo_cells,
+                                           halo_cell_ids,
+                                           c_solid_flag, is_p, cell_f_vol,
+                                           (const cs_real_33_t *)cocg,
+                                           rhs, grad);
+
+      cs_halo_sync_var_strided_start(m->halo, CS_HALO_STANDARD,
+                                     (cs_real_t *)grad, 3);
+
+      _iterative_scalar_gradient_increment(n_cells - n_halo_cells,
+                                           halo_cell_ids + n_halo_cells,
+                                           c_solid_flag, is_p, cell_f_vol,
+                                           (const cs_real_33_t *)cocg,
+                                           rhs, grad);
+
+      /* Convergence test (requires no ghost values) */
+
+      l2_residual = _l2_norm_1(3*n_cells, (cs_real_t *)rhs);
+
+      cs_halo_sync_var_strided_finish(m->halo, CS_HALO_STANDARD,
+                                      (cs_real_t *)grad, 3);
+      if (m->n_init_perio > 0)
+        cs_halo_perio_sync_var_vect(m->halo, CS_HALO_STANDARD,
+                                    (cs_real_t *)grad, 3);
+
     }
+    else {
 
-    /* Synchronize halos */
+      _iterative_scalar_gradient_increment(n_cells, NULL,
+                                           c_solid_flag, is_p, cell_f_vol,
+                                           (const cs_real_33_t *)cocg,
+                                           rhs, grad);
 
-    _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+      /* Synchronize halos */
 
-    /* Convergence test */
+      _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, idimtr, grad);
+
+      /* Convergence test */
 
-    l2_residual = _l2_norm_1(3*n_cells, (cs_real_t *)rhs);
+      l2_residual = _l2_norm_1(3*n_cells, (cs_real_t *)rhs);
+
+    }
 
     if (l2_residual < epsrgp*rnorm) {
       if (verbosity >= 2)
@@ -6266,6 +6582,7 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
                (int)(strlen(__func__)), " ", l2_residual/rnorm, rnorm);
   }
 
+  BFT_FREE(halo_cell_ids);
   BFT_FREE(rhs);
 }
 
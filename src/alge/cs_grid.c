@@ -282,6 +282,11 @@ static int _grid_tune_max_level = 0;
 static int *_grid_tune_max_fill_level = NULL;
 static cs_matrix_variant_t **_grid_tune_variant = NULL;
 
+/* Minimum level from which single-precision matrix coefficients
+   are used for coarse grids (-1: never) */
+
+static int _grid_sp_coeff_min_level = -1;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -2927,6 +2932,203 @@ _automatic_aggregation_pw_msr(const cs_grid_t  *f,
   BFT_FREE(_x_val);
 }
 
+/*----------------------------------------------------------------------------
+ * Build a coarse grid level from the previous level using an
+ * automatic criterion and double pairwise aggregation,
+ * with a matrix in MSR format.
+ *
+ * A second pairwise pass is applied to a scalar matrix condensed on the
+ * first-pass aggregates, built directly from the fine matrix arrays, so
+ * no intermediate grid or matrix structure needs to be assembled.
+ *
+ * parameters:
+ *   f                   <-- Fine grid structure
+ *   verbosity           <-- Verbosity level
+ *   f_c_row             --> Fine row -> coarse row connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_automatic_aggregation_dpw_msr(const cs_grid_t  *f,
+                               int               verbosity,
+                               cs_lnum_t        *f_c_row)
+{
+  const cs_real_t beta = 0.25;
+
+  const cs_real_t dd_threshold = (f->level == 0) ? _dd_threshold_pw : -1;
+
+  const cs_lnum_t f_n_rows = f->n_rows;
+
+  /* Access matrix MSR vectors */
+
+  const cs_lnum_t  *row_index, *col_id;
+  const cs_real_t  *d_val, *x_val;
+  cs_real_t *_d_val = NULL, *_x_val = NULL;
+
+  cs_matrix_get_msr_arrays(f->matrix,
+                           &row_index,
+                           &col_id,
+                           &d_val,
+                           &x_val);
+
+  const cs_lnum_t *db_size = f->db_size;
+  const cs_lnum_t *eb_size = f->eb_size;
+
+  if (db_size[0] > 1) {
+    BFT_MALLOC(_d_val, f_n_rows, cs_real_t);
+    _reduce_block(f_n_rows, db_size, d_val, _d_val);
+    d_val = _d_val;
+  }
+
+  if (eb_size[0] > 1) {
+    cs_lnum_t f_n_enz = row_index[f_n_rows];
+    BFT_MALLOC(_x_val, f_n_enz, cs_real_t);
+    _reduce_block(f_n_enz, eb_size, x_val, _x_val);
+    x_val = _x_val;
+  }
+
+  if (verbosity > 3)
+    bft_printf("\n     %s:\n", __func__);
+
+  /* First pass */
+
+  cs_lnum_t c_n_rows = _pairwise_msr(f_n_rows,
+                                     beta,
+                                     dd_threshold,
+                                     row_index,
+                                     col_id,
+                                     d_val,
+                                     x_val,
+                                     f_c_row);
+
+  /* Condense the scalar matrix on the first-pass aggregates (Galerkin
+     product with piecewise constant prolongation); couplings with ignored
+     rows are simply dropped, as those rows take no part in aggregation. */
+
+  if (c_n_rows > 0) {
+
+    /* Group fine rows by aggregate (each aggregate has 1 or 2 rows) */
+
+    cs_lnum_t *c_f_idx, *c_f_row;
+
+    BFT_MALLOC(c_f_idx, c_n_rows+1, cs_lnum_t);
+    BFT_MALLOC(c_f_row, f_n_rows, cs_lnum_t);
+
+    for (cs_lnum_t ii = 0; ii < c_n_rows+1; ii++)
+      c_f_idx[ii] = 0;
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+      if (f_c_row[ii] > -1)
+        c_f_idx[f_c_row[ii] + 1] += 1;
+    }
+    for (cs_lnum_t ii = 0; ii < c_n_rows; ii++)
+      c_f_idx[ii+1] += c_f_idx[ii];
+
+    {
+      cs_lnum_t *shift;
+      BFT_MALLOC(shift, c_n_rows, cs_lnum_t);
+      for (cs_lnum_t ii = 0; ii < c_n_rows; ii++)
+        shift[ii] = 0;
+      for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+        cs_lnum_t cc = f_c_row[ii];
+        if (cc > -1) {
+          c_f_row[c_f_idx[cc] + shift[cc]] = ii;
+          shift[cc] += 1;
+        }
+      }
+      BFT_FREE(shift);
+    }
+
+    /* Condensed arrays; the fine nonzero count is an upper bound */
+
+    cs_lnum_t *c_row_index, *c_col_id, *last;
+    cs_real_t *c_d_val, *c_x_val;
+
+    BFT_MALLOC(c_row_index, c_n_rows+1, cs_lnum_t);
+    BFT_MALLOC(c_col_id, row_index[f_n_rows], cs_lnum_t);
+    BFT_MALLOC(c_d_val, c_n_rows, cs_real_t);
+    BFT_MALLOC(c_x_val, row_index[f_n_rows], cs_real_t);
+    BFT_MALLOC(last, c_n_rows, cs_lnum_t);
+
+    for (cs_lnum_t ii = 0; ii < c_n_rows; ii++)
+      last[ii] = -1;
+
+    cs_lnum_t k = 0;
+    c_row_index[0] = 0;
+
+    for (cs_lnum_t cc = 0; cc < c_n_rows; cc++) {
+
+      c_d_val[cc] = 0;
+
+      for (cs_lnum_t jj = c_f_idx[cc]; jj < c_f_idx[cc+1]; jj++) {
+
+        cs_lnum_t ii = c_f_row[jj];
+        c_d_val[cc] += d_val[ii];
+
+        cs_lnum_t s_id = row_index[ii], e_id = row_index[ii+1];
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+          cs_lnum_t kk = col_id[ll];
+          if (kk >= f_n_rows)
+            continue;
+          cs_lnum_t ck = f_c_row[kk];
+          if (ck < 0)
+            continue;
+          if (ck == cc)  /* intra-aggregate coupling */
+            c_d_val[cc] += x_val[ll];
+          else if (last[ck] < c_row_index[cc]) {
+            /* entry index from a previous row means "not seen yet" here */
+            c_col_id[k] = ck;
+            c_x_val[k] = x_val[ll];
+            last[ck] = k;
+            k += 1;
+          }
+          else
+            c_x_val[last[ck]] += x_val[ll];
+        }
+
+      }
+
+      c_row_index[cc+1] = k;
+
+    }
+
+    BFT_FREE(last);
+    BFT_FREE(c_f_idx);
+    BFT_FREE(c_f_row);
+
+    /* Second pass, on the condensed matrix */
+
+    cs_lnum_t *c_c_row;
+    BFT_MALLOC(c_c_row, c_n_rows, cs_lnum_t);
+
+    cs_lnum_t c2_n_rows = _pairwise_msr(c_n_rows,
+                                        beta,
+                                        -1,  /* no dominance check */
+                                        c_row_index,
+                                        c_col_id,
+                                        c_d_val,
+                                        c_x_val,
+                                        c_c_row);
+
+    if (c2_n_rows > 0) {
+      for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+        if (f_c_row[ii] > -1)
+          f_c_row[ii] = c_c_row[f_c_row[ii]];
+      }
+    }
+
+    BFT_FREE(c_c_row);
+    BFT_FREE(c_row_index);
+    BFT_FREE(c_col_id);
+    BFT_FREE(c_d_val);
+    BFT_FREE(c_x_val);
+
+  }
+
+  /* Free working arrays */
+
+  BFT_FREE(_d_val);
+  BFT_FREE(_x_val);
+}
+
 /*----------------------------------------------------------------------------
  * Build a coarse grid level from the previous level using an
  * automatic criterion and pairwise aggregation variant 1,
@@ -4542,24 +4744,34 @@ _compute_coarse_quantities_conv_diff(const cs_grid_t  *fine_grid,
 }
 
 /*----------------------------------------------------------------------------
- * Build a coarse level from a finer level with an MSR matrix.
+ * Compute coarse matrix coefficients for a given MSR structure.
+ *
+ * The coarse matrix row index and column ids are assumed fixed (built
+ * by a previous traversal of the same fine grid connectivity), so only
+ * the associated values are computed here.
  *
  * parameters:
- *   fine_grid   <-- Fine grid structure
- *   coarse_grid <-> Coarse grid structure
+ *   fine_grid   <-- fine grid structure
+ *   coarse_grid <-- coarse grid structure
+ *   c_row_index <-- coarse matrix MSR row index (0 to n-1)
+ *   c_col_id    <-- coarse matrix MSR column id (0 to n-1)
+ *   c_d_val     --> diagonal values
+ *   c_x_val     --> extradiagonal values
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
-                               cs_grid_t        *coarse_grid)
-
+_compute_coarse_coeffs_msr(const cs_grid_t      *fine_grid,
+                           const cs_grid_t      *coarse_grid,
+                           const cs_lnum_t      *c_row_index,
+                           const cs_lnum_t      *c_col_id,
+                           cs_real_t  *restrict  c_d_val,
+                           cs_real_t  *restrict  c_x_val)
 {
   const cs_lnum_t *db_size = fine_grid->db_size;
 
   const cs_lnum_t f_n_rows = fine_grid->n_rows;
 
   const cs_lnum_t c_n_rows = coarse_grid->n_rows;
-  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
   const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
 
   /* Fine matrix in the MSR format */
@@ -4573,16 +4785,9 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
                            &f_d_val,
                            &f_x_val);
 
-  /* Coarse matrix elements in the MSR format */
-
-  cs_lnum_t *restrict c_row_index,  *restrict c_col_id;
-  cs_real_t *restrict c_d_val, *restrict c_x_val;
-
   /* Diagonal elements
      ----------------- */
 
-  BFT_MALLOC(c_d_val, c_n_rows*db_size[3], cs_real_t);
-
   for (cs_lnum_t i = 0; i < c_n_rows*db_size[3]; i++)
     c_d_val[i] = 0.0;
 
@@ -4612,6 +4817,92 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
   /* Extradiagonal elements
      ---------------------- */
 
+  {
+    cs_lnum_t c_size = c_row_index[c_n_rows];
+
+    for (cs_lnum_t i = 0; i < c_size; i++)
+      c_x_val[i] = 0;
+
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+      cs_lnum_t i = c_coarse_row[ii];
+
+      if (i > -1 && i < c_n_rows) {
+
+        for (cs_lnum_t jj_ind = f_row_index[ii];
+             jj_ind < f_row_index[ii+1];
+             jj_ind++) {
+
+          cs_lnum_t jj = f_col_id[jj_ind];
+
+          cs_lnum_t j = c_coarse_row[jj];
+
+          if (j > -1) {
+
+            if (i != j) {
+              cs_lnum_t s_id = c_row_index[i];
+              cs_lnum_t n_cols = c_row_index[i+1] - s_id;
+              /* ids are sorted, so binary search possible */
+              cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
+              c_x_val[k + s_id] += f_x_val[jj_ind];
+            }
+            else { /* i == j */
+              for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+                /* diagonal terms only */
+                c_d_val[i*db_size[3] + db_size[2]*kk + kk]
+                  += f_x_val[jj_ind];
+              }
+            }
+
+          }
+        }
+
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build a coarse level from a finer level with an MSR matrix.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
+                               cs_grid_t        *coarse_grid)
+
+{
+  const cs_lnum_t *db_size = fine_grid->db_size;
+
+  const cs_lnum_t f_n_rows = fine_grid->n_rows;
+
+  const cs_lnum_t c_n_rows = coarse_grid->n_rows;
+  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
+  const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
+
+  /* Fine matrix connectivity in the MSR format */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+
+  cs_matrix_get_msr_arrays(fine_grid->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           NULL,
+                           NULL);
+
+  /* Coarse matrix elements in the MSR format */
+
+  cs_lnum_t *restrict c_row_index,  *restrict c_col_id;
+  cs_real_t *restrict c_d_val, *restrict c_x_val;
+
+  /* Extradiagonal structure
+     ----------------------- */
+
   BFT_MALLOC(c_row_index, c_n_rows+1, cs_lnum_t);
 
   /* Prepare to traverse fine rows by increasing associated coarse row */
@@ -4754,52 +5045,66 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   /* Values assignment pass */
 
-  {
-    for (cs_lnum_t i = 0; i < c_size; i++)
-      c_x_val[i] = 0;
-
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-
-      cs_lnum_t i = c_coarse_row[ii];
-
-      if (i > -1 && i < c_n_rows) {
+  BFT_MALLOC(c_d_val, c_n_rows*db_size[3], cs_real_t);
 
-        for (cs_lnum_t jj_ind = f_row_index[ii];
-             jj_ind < f_row_index[ii+1];
-             jj_ind++) {
+  _compute_coarse_coeffs_msr(fine_grid,
+                             coarse_grid,
+                             c_row_index,
+                             c_col_id,
+                             c_d_val,
+                             c_x_val);
 
-          cs_lnum_t jj = f_col_id[jj_ind];
+  _build_coarse_matrix_msr(coarse_grid, c_row_index, c_col_id,
+                           c_x_val, c_d_val);
+}
 
-          cs_lnum_t j = c_coarse_row[jj];
+/*----------------------------------------------------------------------------
+ * Refresh matrix coefficients of a coarse level built with an MSR matrix.
+ *
+ * The coarse matrix structure (based on a previous coarsening of the
+ * same fine grid connectivity) is kept, and only coefficient values
+ * are recomputed.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
 
-          if (j > -1) {
+static void
+_refresh_coarse_quantities_msr(const cs_grid_t  *fine_grid,
+                               cs_grid_t        *coarse_grid)
+{
+  const cs_lnum_t *db_size = fine_grid->db_size;
+  const cs_lnum_t c_n_rows = coarse_grid->n_rows;
 
-            if (i != j) {
-              cs_lnum_t s_id = c_row_index[i];
-              cs_lnum_t n_cols = c_row_index[i+1] - s_id;
-              /* ids are sorted, so binary search possible */
-              cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
-              c_x_val[k + s_id] += f_x_val[jj_ind];
-            }
-            else { /* i == j */
-              for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
-                /* diagonal terms only */
-                c_d_val[i*db_size[3] + db_size[2]*kk + kk]
-                  += f_x_val[jj_ind];
-              }
-            }
+  const cs_lnum_t  *c_row_index, *c_col_id;
 
-          }
-        }
+  cs_matrix_get_msr_arrays(coarse_grid->matrix,
+                           &c_row_index,
+                           &c_col_id,
+                           NULL,
+                           NULL);
 
-      }
+  cs_real_t *c_d_val, *c_x_val;
 
-    }
+  BFT_MALLOC(c_d_val, c_n_rows*db_size[3], cs_real_t);
+  BFT_MALLOC(c_x_val, c_row_index[c_n_rows], cs_real_t);
 
-  }
+  _compute_coarse_coeffs_msr(fine_grid,
+                             coarse_grid,
+                             c_row_index,
+                             c_col_id,
+                             c_d_val,
+                             c_x_val);
 
-  _build_coarse_matrix_msr(coarse_grid, c_row_index, c_col_id,
-                           c_x_val, c_d_val);
+  cs_matrix_transfer_coefficients_msr(coarse_grid->_matrix,
+                                      false,
+                                      NULL,
+                                      NULL,
+                                      c_row_index,
+                                      c_col_id,
+                                      &c_d_val,
+                                      &c_x_val);
 }
 
 /*----------------------------------------------------------------------------
@@ -4996,6 +5301,122 @@ cs_grid_create_from_shared(cs_lnum_t              n_faces,
   return g;
 }
 
+/*----------------------------------------------------------------------------
+ * Update a base grid with new matrix coefficients.
+ *
+ * This is a fast path for cases where the mesh and matrix structure are
+ * unchanged relative to the call to cs_grid_create_from_shared which built
+ * the grid, so only the shared coefficient pointers and the derived
+ * multigrid-specific terms need to be refreshed.
+ *
+ * parameters:
+ *   g              <-> Base grid structure
+ *   a              <-- Associated matrix
+ *   a_conv         <-- Associated matrix (convection)
+ *   a_diff         <-- Associated matrix (diffusion)
+ *
+ * returns:
+ *   true in case of success, false if the matrix does not match the
+ *   grid (in which case the hierarchy should be rebuilt)
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_from_shared(cs_grid_t          *g,
+                           const cs_matrix_t  *a,
+                           const cs_matrix_t  *a_conv,
+                           const cs_matrix_t  *a_diff)
+{
+  assert(g != NULL);
+
+  bool conv_diff = (a_conv != NULL || a_diff != NULL) ? true : false;
+
+  /* Check the matrix still matches the grid structurally; if not,
+     the caller should rebuild the hierarchy from scratch */
+
+  if (   g->level != 0
+      || g->conv_diff != conv_diff
+      || g->symmetric != cs_matrix_is_symmetric(a)
+      || g->n_rows != cs_matrix_get_n_rows(a)
+      || g->n_cols_ext != cs_matrix_get_n_columns(a)
+      || g->halo != cs_matrix_get_halo(a))
+    return false;
+
+  {
+    const cs_lnum_t *db_size = cs_matrix_get_diag_block_size(a);
+    const cs_lnum_t *eb_size = cs_matrix_get_extra_diag_block_size(a);
+    for (cs_lnum_t ii = 0; ii < 4; ii++) {
+      if (g->db_size[ii] != db_size[ii] || g->eb_size[ii] != eb_size[ii])
+        return false;
+    }
+  }
+
+  if (g->face_cell != NULL) {
+    if (   cs_matrix_is_mapped_from_native(a) == false
+        || g->xa0ij == NULL)
+      return false;
+    if (   g->symmetric == false && g->conv_diff == false
+        && g->_xa0 == NULL)
+      return false;
+  }
+
+  /* Update shared matrix coefficients */
+
+  if (cs_matrix_is_mapped_from_native(a)) {
+    g->da = cs_matrix_get_diagonal(a);
+    g->xa= cs_matrix_get_extra_diagonal(a);
+  }
+
+  if (conv_diff) {
+    g->da_conv = cs_matrix_get_diagonal(a_conv);
+    g->da_diff = cs_matrix_get_diagonal(a_diff);
+    g->xa_conv = cs_matrix_get_extra_diagonal(a_conv);
+    g->xa_diff = cs_matrix_get_extra_diagonal(a_diff);
+  }
+
+  if (g->face_cell != NULL) {
+
+    const cs_lnum_t n_faces = g->n_faces;
+    const cs_lnum_2_t *face_cell = g->face_cell;
+    const cs_real_t *cell_cen = g->cell_cen;
+
+    /* Update symmetrized extra-diagonal terms */
+
+    if (g->symmetric == true)
+      g->xa0 = g->xa;
+    else if (g->conv_diff) {
+      g->xa0  = g->xa;
+      g->xa0_diff = g->xa_diff;
+    }
+    else {
+      for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++)
+        g->_xa0[face_id] = 0.5 * (g->xa[face_id*2] + g->xa[face_id*2+1]);
+      g->xa0 = g->_xa0;
+    }
+
+    /* Update multigrid-specific terms */
+
+    const cs_real_t *restrict g_xa0 = g->xa0;
+    if (g->conv_diff)
+      g_xa0 = g->xa0_diff;
+
+#   pragma omp parallel for  if(n_faces > CS_THR_MIN)
+    for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++) {
+      cs_lnum_t i0 = face_cell[face_id][0];
+      cs_lnum_t i1 = face_cell[face_id][1];
+      for (cs_lnum_t kk = 0; kk < 3; kk++) {
+        g->xa0ij[face_id*3 + kk] =   g_xa0[face_id]
+                                   * (  cell_cen[i1*3 + kk]
+                                      - cell_cen[i0*3 + kk]);
+      }
+    }
+
+  }
+
+  g->matrix = a;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Destroy a grid structure.
  *
@@ -5393,9 +5814,13 @@ cs_grid_coarsen(const cs_grid_t   *f,
   else if (coarsening_type == CS_GRID_COARSENING_SPD_PW) {
     switch (fine_matrix_type) {
     case CS_MATRIX_MSR:
-      _automatic_aggregation_pw_msr(f, verbosity, c->coarse_row);
-      if (aggregation_limit > 2)
-        recurse = 2;
+      if (aggregation_limit > 2) {
+        _automatic_aggregation_dpw_msr(f, verbosity, c->coarse_row);
+        if (aggregation_limit > 4)
+          recurse = 4;
+      }
+      else
+        _automatic_aggregation_pw_msr(f, verbosity, c->coarse_row);
       break;
     default:
       bft_error(__FILE__, __LINE__, 0,
@@ -5562,6 +5987,27 @@ cs_grid_coarsen(const cs_grid_t   *f,
     if (coarse_mv != NULL)
       coarse_matrix_type = cs_matrix_variant_type(coarse_mv);
 
+    /* Optionally switch to single-precision coefficients from a
+       given level (scalar MSR matrices only) */
+
+    cs_matrix_variant_t *sp_mv = NULL;
+
+    if (   coarse_mv == NULL
+        && _grid_sp_coeff_min_level > -1
+        && c->level >= _grid_sp_coeff_min_level
+        && coarse_matrix_type == CS_MATRIX_MSR
+        && c->db_size[3] == 1 && c->eb_size[3] == 1) {
+
+      cs_matrix_fill_type_t mft
+        = cs_matrix_get_fill_type(c->symmetric,
+                                  c->db_size,
+                                  c->eb_size);
+
+      sp_mv = cs_matrix_variant_create(CS_MATRIX_MSR, NULL);
+      cs_matrix_variant_set_func(sp_mv, NULL, mft, 2, "single_prec");
+      coarse_mv = sp_mv;
+    }
+
     c->matrix_struct = cs_matrix_structure_create(coarse_matrix_type,
                                                   true,
                                                   c->n_rows,
@@ -5585,6 +6031,9 @@ cs_grid_coarsen(const cs_grid_t   *f,
                                c->da,
                                c->xa);
 
+    if (sp_mv != NULL)
+      cs_matrix_variant_destroy(&sp_mv);
+
   }
 
   c->matrix = c->_matrix;
@@ -5643,6 +6092,84 @@ cs_grid_coarsen(const cs_grid_t   *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Refresh matrix coefficients of a grid previously built by coarsening.
+ *
+ * This is a fast path for cases where the fine grid's structure is
+ * unchanged (only its coefficient values have been updated), so the
+ * coarsening (fine->coarse row and face mappings) and the coarse matrix
+ * structure are kept, and only coefficient values are recomputed.
+ *
+ * This requires that the data needed for the coefficient computation
+ * has not been freed (see cs_grid_free_quantities).
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true in case of success, false if required data is missing
+ *   (in which case the hierarchy should be rebuilt)
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_refresh_coarse_matrix(const cs_grid_t  *f,
+                              cs_grid_t        *c,
+                              int               verbosity)
+{
+  assert(f != NULL && c != NULL);
+
+#if defined(HAVE_MPI)
+  if (c->merge_sub_size > 1)
+    return false;
+#endif
+
+  cs_matrix_type_t fine_matrix_type = cs_matrix_get_type(f->matrix);
+
+  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+
+    if (c->_matrix == NULL)
+      return false;
+
+    _refresh_coarse_quantities_msr(f, c);
+
+  }
+
+  else if (   f->face_cell != NULL
+           && c->coarse_face != NULL
+           && c->_matrix != NULL
+           && c->_xa != NULL
+           && (c->relaxation <= 0 || f->xa0ij != NULL)) {
+
+    if (c->conv_diff)
+      _compute_coarse_quantities_conv_diff(f, c, verbosity);
+    else
+      _compute_coarse_quantities_native(f, c, verbosity);
+
+    /* Synchronize matrix's geometric quantities */
+
+    if (c->halo != NULL)
+      cs_halo_sync_var_strided(c->halo, CS_HALO_STANDARD, c->_da,
+                               f->db_size[3]);
+
+    cs_matrix_set_coefficients(c->_matrix,
+                               c->symmetric,
+                               c->db_size,
+                               c->eb_size,
+                               c->n_faces,
+                               c->face_cell,
+                               c->da,
+                               c->xa);
+
+  }
+
+  else
+    return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute coarse row variable values from fine row values
  *
@@ -6388,6 +6915,33 @@ cs_grid_set_merge_options(int         rank_stride,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the level from which single-precision matrix coefficients
+ *        are used for multigrid coarse meshes.
+ *
+ * Coarse level smoothing is memory-bandwidth bound and usually not very
+ * sensitive to coefficient precision when used as a preconditioner, so
+ * this roughly halves the matrix memory traffic and footprint for the
+ * selected levels. It currently applies only to scalar MSR matrices,
+ * and is exclusive of coarse matrix tuning or forced variants.
+ *
+ * The finest mesh (level 0) always uses standard precision.
+ *
+ * \param[in]  min_level  minimum level at which single-precision
+ *                        coefficients are used (-1 to disable)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_single_precision_level(int  min_level)
+{
+  if (min_level < 1)
+    _grid_sp_coeff_min_level = -1;
+  else
+    _grid_sp_coeff_min_level = min_level;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set matrix tuning behavior for multigrid coarse meshes.
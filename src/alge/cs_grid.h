@@ -117,6 +117,31 @@ cs_grid_create_from_shared(cs_lnum_t              n_faces,
                            const cs_matrix_t     *a_conv,
                            const cs_matrix_t     *a_diff);
 
+/*----------------------------------------------------------------------------
+ * Update a base grid with new matrix coefficients.
+ *
+ * This is a fast path for cases where the mesh and matrix structure are
+ * unchanged relative to the call to cs_grid_create_from_shared which built
+ * the grid, so only the shared coefficient pointers and the derived
+ * multigrid-specific terms need to be refreshed.
+ *
+ * parameters:
+ *   g              <-> Base grid structure
+ *   a              <-- Associated matrix
+ *   a_conv         <-- Associated matrix (convection)
+ *   a_diff         <-- Associated matrix (diffusion)
+ *
+ * returns:
+ *   true in case of success, false if the matrix does not match the
+ *   grid (in which case the hierarchy should be rebuilt)
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_from_shared(cs_grid_t          *g,
+                           const cs_matrix_t  *a,
+                           const cs_matrix_t  *a_conv,
+                           const cs_matrix_t  *a_diff);
+
 /*----------------------------------------------------------------------------
  * Destroy a grid structure.
  *
@@ -273,6 +298,32 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 int               aggregation_limit,
                 double            relaxation_parameter);
 
+/*----------------------------------------------------------------------------
+ * Refresh matrix coefficients of a grid previously built by coarsening.
+ *
+ * This is a fast path for cases where the fine grid's structure is
+ * unchanged (only its coefficient values have been updated), so the
+ * coarsening (fine->coarse row and face mappings) and the coarse matrix
+ * structure are kept, and only coefficient values are recomputed.
+ *
+ * This requires that the data needed for the coefficient computation
+ * has not been freed (see cs_grid_free_quantities).
+ *
+ * parameters:
+ *   f         <-- Fine grid structure
+ *   c         <-> Coarse grid structure
+ *   verbosity <-- Verbosity level
+ *
+ * returns:
+ *   true in case of success, false if required data is missing
+ *   (in which case the hierarchy should be rebuilt)
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_refresh_coarse_matrix(const cs_grid_t  *f,
+                              cs_grid_t        *c,
+                              int               verbosity);
+
 /*----------------------------------------------------------------------------
  * Compute coarse row variable values from fine row values
  *
@@ -458,6 +509,23 @@ cs_grid_set_merge_options(int         rank_stride,
                           cs_gnum_t   rows_glob_threshold,
                           int         min_ranks);
 
+/*----------------------------------------------------------------------------
+ * Set the level from which single-precision matrix coefficients
+ * are used for multigrid coarse meshes.
+ *
+ * This currently applies only to scalar MSR matrices, and is exclusive
+ * of coarse matrix tuning or forced variants.
+ *
+ * The finest mesh (level 0) always uses standard precision.
+ *
+ * parameters:
+ *   min_level <-- minimum level at which single-precision coefficients
+ *                 are used (-1 to disable)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_single_precision_level(int  min_level);
+
 /*----------------------------------------------------------------------------
  * Set matrix tuning behavior for multigrid coarse meshes.
  *
@@ -86,6 +86,7 @@
 #include "cs_prototypes.h"
 #include "cs_sort.h"
 #include "cs_timer.h"
+#include "cs_timer_stats.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -136,7 +137,8 @@ BEGIN_C_DECLS
 const char  *cs_matrix_type_name[] = {N_("native"),
                                       N_("CSR"),
                                       N_("symmetric CSR"),
-                                      N_("MSR")};
+                                      N_("MSR"),
+                                      N_("SELL")};
 
 /* Full names for matrix types */
 
@@ -144,7 +146,45 @@ const char
 *cs_matrix_type_fullname[] = {N_("diagonal + faces"),
                               N_("Compressed Sparse Row"),
                               N_("symmetric Compressed Sparse Row"),
-                              N_("Modified Compressed Sparse Row")};
+                              N_("Modified Compressed Sparse Row"),
+                              N_("Sliced ELLPACK")};
+
+/* Slice height for SELL storage; 8 rows of double precision values
+   fill an AVX-512 register, and remain a multiple of smaller SIMD widths */
+
+static const cs_lnum_t _sell_slice_size = 8;
+
+/* Overlap halo exchange and computation in matrix.vector products,
+   when the matrix format allows it */
+
+static bool _vector_multiply_overlap = false;
+
+/* Timer statistic for matrix.vector products, with declared work for
+   the end-of-run kernel work summary (-2 before first lookup, -1 if
+   the "spmv" statistic is not defined) */
+
+#if !defined(_CS_UNIT_MATRIX_TEST)
+static int _spmv_stats_id = -2;
+#endif
+
+/* Per-thread staging buffers for lock-free threaded MSR assembly;
+   entries reference coefficients through a flattened index (diagonal
+   values first, extra-diagonal values next). As the buffers are shared
+   at the module level, only one staged assembly may be active at a
+   given time. */
+
+typedef struct {
+
+  cs_lnum_t   n;        /* number of staged entries */
+  cs_lnum_t   max;      /* number of allocated entries */
+
+  cs_lnum_t  *c_idx;    /* flattened coefficient indexes */
+  cs_real_t  *val;      /* associated values */
+
+} _staging_buffer_t;
+
+static int                 _n_staging_buffers = 0;
+static _staging_buffer_t  *_staging_buffers = NULL;
 
 /* Fill type names for matrices */
 
@@ -155,7 +195,7 @@ const char  *cs_matrix_fill_type_name[] = {"CS_MATRIX_SCALAR",
                                            "CS_MATRIX_BLOCK_D_SYM",
                                            "CS_MATRIX_BLOCK"};
 
-#if defined (HAVE_MKL)
+#if defined (HAVE_MKL) || defined(HAVE_OPENMP_TARGET)
 
 static char _no_exclude_diag_error_str[]
   = N_("Matrix product variant using function %s\n"
@@ -181,6 +221,48 @@ static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Add a matrix.vector product's time and theoretical work to the "spmv"
+ * timer statistic, when it is defined.
+ *
+ * The declared traffic assumes coefficients and column indexes are read
+ * once and the x and y vectors are accessed once per row (i.e. the x
+ * gather stays in cache), with 2 flops per entry; it is a roofline
+ * reference, not a measurement.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   t0     <-- product start time
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_spmv_stats_add(const cs_matrix_t  *matrix,
+                const cs_timer_t   *t0)
+{
+#if defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+
+  CS_UNUSED(matrix);
+  CS_UNUSED(t0);
+
+#else
+
+  if (_spmv_stats_id < 0)
+    return;
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_stats_add_diff(_spmv_stats_id, t0, &t1);
+
+  double n_ent = (double)cs_matrix_get_n_entries(matrix)
+                 * matrix->eb_size[0]*matrix->eb_size[0];
+  double n_val = (double)matrix->n_rows * matrix->db_size[0];
+
+  cs_timer_stats_add_work(_spmv_stats_id,
+                          n_ent*12. + n_val*24.,
+                          n_ent*2.);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Set matrix fill metadata.
  *
@@ -420,6 +502,42 @@ _dense_eb_ax_add(cs_lnum_t        b_i,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute matrix-vector product increment for one dense block:
+ * y[i] += a[ij].x[j]
+ *
+ * This variant uses a fixed 3x3 block, for better compiler optimization.
+ *
+ * parameters:
+ *   b_i    <-- block id for i
+ *   b_j    <-- block id for j
+ *   b_ij   <-- block id for matrix ij position
+ *   a      <-- pointer to block matrixes array (usually matrix extra-diagonal)
+ *   x      <-- multipliying vector values
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_dense_3_3_eb_ax_add(cs_lnum_t        b_i,
+                     cs_lnum_t        b_j,
+                     cs_lnum_t        b_ij,
+                     const cs_real_t  a[restrict],
+                     const cs_real_t  x[restrict],
+                     cs_real_t        y[restrict])
+{
+  y[b_i*3]     +=   a[b_ij*9]         * x[b_j*3]
+                  + a[b_ij*9 + 1]     * x[b_j*3 + 1]
+                  + a[b_ij*9 + 2]     * x[b_j*3 + 2];
+
+  y[b_i*3 + 1] +=   a[b_ij*9 + 3]     * x[b_j*3]
+                  + a[b_ij*9 + 3 + 1] * x[b_j*3 + 1]
+                  + a[b_ij*9 + 3 + 2] * x[b_j*3 + 2];
+
+  y[b_i*3 + 2] +=   a[b_ij*9 + 6]     * x[b_j*3]
+                  + a[b_ij*9 + 6 + 1] * x[b_j*3 + 1]
+                  + a[b_ij*9 + 6 + 2] * x[b_j*3 + 2];
+}
+
 /*----------------------------------------------------------------------------
  * y[i] = da[i].x[i], with da possibly NULL
  *
@@ -862,6 +980,10 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
     _da = mc->d_val;
   }
+  else if (matrix->type == CS_MATRIX_SELL) {
+    const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+    _da = mc->d_val;
+  }
   const cs_lnum_t  n_rows = matrix->n_rows;
 
   /* Unblocked version */
@@ -1101,6 +1223,102 @@ _bb_mat_vec_p_l_native(bool                exclude_diag,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix.
+ *
+ * This variant uses fixed 3x3 diagonal and extra-diagonal blocks, for
+ * better compiler optimization.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_3_3_bb_mat_vec_p_l_native(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t     x[restrict],
+                           cs_real_t           y[restrict])
+{
+  cs_lnum_t  ii, jj, face_id;
+
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  const cs_matrix_coeff_native_t  *mc = matrix->coeffs;
+
+  const cs_real_t  *restrict xa = mc->xa;
+
+  assert(   matrix->db_size[0] == 3 && matrix->db_size[3] == 9
+         && matrix->eb_size[0] == 3 && matrix->eb_size[3] == 9);
+
+  /* Diagonal part of matrix.vector product */
+
+  if (! exclude_diag) {
+    _3_3_diag_vec_p_l(mc->da, x, y, ms->n_rows);
+    _3_3_zero_range(y, ms->n_rows, ms->n_cols_ext);
+  }
+  else
+    _3_3_zero_range(y, 0, ms->n_cols_ext);
+
+  /* Note: parallel and periodic synchronization could be delayed to here */
+
+  /* non-diagonal terms */
+
+  if (mc->xa != NULL) {
+
+    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+    if (mc->symmetric) {
+
+      for (face_id = 0; face_id < ms->n_edges; face_id++) {
+        ii = face_cel_p[face_id][0];
+        jj = face_cel_p[face_id][1];
+        _dense_3_3_eb_ax_add(ii, jj, face_id, xa, x, y);
+        _dense_3_3_eb_ax_add(jj, ii, face_id, xa, x, y);
+      }
+    }
+    else {
+
+      for (face_id = 0; face_id < ms->n_edges; face_id++) {
+        ii = face_cel_p[face_id][0];
+        jj = face_cel_p[face_id][1];
+        _dense_3_3_eb_ax_add(ii, jj, 2*face_id, xa, x, y);
+        _dense_3_3_eb_ax_add(jj, ii, 2*face_id + 1, xa, x, y);
+      }
+
+    }
+
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with native matrix, full block version.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_bb_mat_vec_p_l_native_fixed(bool                exclude_diag,
+                             const cs_matrix_t  *matrix,
+                             const cs_real_t     x[restrict],
+                             cs_real_t           y[restrict])
+{
+  if (   matrix->db_size[0] == 3 && matrix->db_size[3] == 9
+      && matrix->eb_size[0] == 3 && matrix->eb_size[3] == 9)
+    _3_3_bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+
+  else
+    _bb_mat_vec_p_l_native(exclude_diag, matrix, x, y);
+}
+
 /*----------------------------------------------------------------------------
  * Local matrix.vector product y = A.x with native matrix.
  *
@@ -1198,7 +1416,7 @@ _6_6_mat_vec_p_l_native(bool                exclude_diag,
 
   const cs_real_t  *restrict xa = mc->xa;
 
-  assert(matrix->db_size[0] == 3 && matrix->db_size[3] == 9);
+  assert(matrix->db_size[0] == 6 && matrix->db_size[3] == 36);
 
   /* Diagonal part of matrix.vector product */
 
@@ -2194,6 +2412,37 @@ _set_xa_coeffs_csr_increment(cs_matrix_t        *matrix,
 
 }
 
+#if defined(HAVE_OPENMP_TARGET)
+
+/*----------------------------------------------------------------------------
+ * Unmap CSR matrix structure and coefficient arrays from default device.
+ *
+ * No-op if the matrix coefficients are not currently device-resident.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unmap_coeffs_from_device_csr(cs_matrix_t  *matrix)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+
+  if (mc == NULL || mc->val == NULL)
+    return;
+
+  if (omp_target_is_present(mc->val, omp_get_default_device())) {
+    const cs_lnum_t  n_rows = ms->n_rows;
+    const cs_lnum_t  nnz = ms->row_index[n_rows];
+#   pragma omp target exit data map(delete: ms->row_index[0:n_rows+1], \
+                                            ms->col_id[0:nnz],         \
+                                            mc->val[0:nnz])
+  }
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
 /*----------------------------------------------------------------------------
  * Set CSR matrix coefficients.
  *
@@ -2223,6 +2472,10 @@ _set_coeffs_csr(cs_matrix_t      *matrix,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_csr(matrix);
+#endif
+
   if (mc->_val == NULL)
     BFT_MALLOC(mc->_val, ms->row_index[ms->n_rows], cs_real_t);
   mc->val = mc->_val;
@@ -2321,6 +2574,10 @@ _set_coeffs_csr_from_msr(cs_matrix_t       *matrix,
 
   const cs_lnum_t  n_rows = ms->n_rows;
 
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_csr(matrix);
+#endif
+
   /* Sanity check */
 
   if (matrix->db_size[0] > 1 || matrix->eb_size[0] > 1)
@@ -2481,6 +2738,9 @@ static void
 _release_coeffs_csr(cs_matrix_t  *matrix)
 {
   cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_csr(matrix);
+#endif
   if (mc != NULL)
     mc->d_val = NULL;
   return;
@@ -2614,6 +2874,60 @@ _mat_vec_p_l_csr_mkl(bool                exclude_diag,
 
 #endif /* defined (HAVE_MKL) */
 
+#if defined(HAVE_OPENMP_TARGET)
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with CSR matrix, on device.
+ *
+ * The matrix structure and coefficients are uploaded on first use and
+ * remain resident on the device until the coefficients are released,
+ * so only x and y move across the bus for each product.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_csr_omp_target(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t    *restrict x,
+                            cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_csr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_cols_ext = ms->n_cols_ext;
+  const cs_lnum_t  nnz = ms->row_index[n_rows];
+  const cs_lnum_t  *restrict row_index = ms->row_index;
+  const cs_lnum_t  *restrict col_id = ms->col_id;
+  const cs_real_t  *restrict val = mc->val;
+
+  if (exclude_diag)
+    bft_error(__FILE__, __LINE__, 0,
+              _(_no_exclude_diag_error_str), __func__);
+
+  if (! omp_target_is_present(val, omp_get_default_device())) {
+#   pragma omp target enter data map(to: row_index[0:n_rows+1], \
+                                         col_id[0:nnz],         \
+                                         val[0:nnz])
+  }
+
+# pragma omp target teams distribute parallel for \
+    map(to: x[0:n_cols_ext]) map(from: y[0:n_rows])
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_real_t sii = 0.0;
+    for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+      sii += val[jj] * x[col_id[jj]];
+    y[ii] = sii;
+  }
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
 /*----------------------------------------------------------------------------
  * Create a symmetric CSR matrix structure from a native matrix stucture.
  *
@@ -3202,6 +3516,9 @@ _create_coeff_msr(void)
   mc->_d_val = NULL;
   mc->_x_val = NULL;
 
+  mc->d_val_sp = NULL;
+  mc->x_val_sp = NULL;
+
   return mc;
 }
 
@@ -3223,6 +3540,10 @@ _destroy_coeff_msr(cs_matrix_coeff_msr_t  **coeff)
 
     BFT_FREE(mc->_d_val);
 
+    BFT_FREE(mc->x_val_sp);
+
+    BFT_FREE(mc->d_val_sp);
+
     BFT_FREE(*coeff);
 
   }
@@ -3420,6 +3741,65 @@ _set_xa_coeffs_msr_increment(cs_matrix_t        *matrix,
 
 }
 
+#if defined(HAVE_OPENMP_TARGET)
+
+/*----------------------------------------------------------------------------
+ * Unmap MSR matrix structure and coefficient arrays from default device.
+ *
+ * No-op if the matrix coefficients are not currently device-resident.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_unmap_coeffs_from_device_msr(cs_matrix_t  *matrix)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  if (mc == NULL)
+    return;
+
+  const int  device_id = omp_get_default_device();
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  if (   mc->x_val != NULL
+      && omp_target_is_present(mc->x_val, device_id)) {
+    const cs_lnum_t  nnz = ms->row_index[n_rows];
+#   pragma omp target exit data map(delete: ms->row_index[0:n_rows+1], \
+                                            ms->col_id[0:nnz],         \
+                                            mc->x_val[0:nnz])
+  }
+
+  if (   mc->d_val != NULL
+      && omp_target_is_present(mc->d_val, device_id)) {
+#   pragma omp target exit data map(delete: mc->d_val[0:n_rows])
+  }
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
+/*----------------------------------------------------------------------------
+ * Release single-precision MSR matrix coefficient copies.
+ *
+ * Must be called whenever the reference coefficients are modified or
+ * released, so that copies are rebuilt on the next use.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_coeffs_sp_msr(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  if (mc != NULL) {
+    BFT_FREE(mc->d_val_sp);
+    BFT_FREE(mc->x_val_sp);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Map or copy MSR matrix diagonal coefficients.
  *
@@ -3567,6 +3947,12 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_msr(matrix);
+#endif
+
+  _release_coeffs_sp_msr(matrix);
+
   /* Map or copy diagonal values */
 
   _map_or_copy_da_coeffs_msr(matrix, copy, da);
@@ -3627,6 +4013,12 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
 
   bool d_transferred = false, x_transferred = false;
 
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_msr(matrix);
+#endif
+
+  _release_coeffs_sp_msr(matrix);
+
   /* TODO: we should use metadata or check that the row_index and
      column id values are consistent, which should be true as long
      as columns are ordered in an identical manner */
@@ -3680,6 +4072,10 @@ static void
 _release_coeffs_msr(cs_matrix_t  *matrix)
 {
   cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_msr(matrix);
+#endif
+  _release_coeffs_sp_msr(matrix);
   if (mc !=NULL) {
     /* Unmap shared values */
     mc->d_val = NULL;
@@ -3751,31 +4147,234 @@ _mat_vec_p_l_msr(bool                exclude_diag,
 }
 
 /*----------------------------------------------------------------------------
- * Local matrix.vector product y = A.x with MSR matrix.
+ * Build list of halo-dependent rows of an MSR matrix.
+ *
+ * Column ids are sorted inside each row, so a row depends on halo values
+ * if and only if its last column id maps to a ghost element.
  *
  * parameters:
- *   exclude_diag <-- exclude diagonal if true
- *   matrix       <-- pointer to matrix structure
- *   x            <-- multipliying vector values
- *   y            --> resulting vector
+ *   matrix <-> pointer to matrix structure
  *----------------------------------------------------------------------------*/
 
 static void
-_mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
-                           const cs_matrix_t  *matrix,
-                           const cs_real_t    *restrict x,
-                           cs_real_t          *restrict y)
+_msr_build_halo_rows(cs_matrix_t  *matrix)
 {
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
-  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
-  cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  *restrict row_index = ms->row_index;
+  const cs_lnum_t  *restrict col_id = ms->col_id;
 
-  /* Standard case */
+  cs_lnum_t n_h_rows = 0;
 
-  if (!exclude_diag && mc->d_val != NULL) {
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t e_id = row_index[ii+1];
+    if (e_id > row_index[ii] && col_id[e_id-1] >= n_rows)
+      n_h_rows++;
+  }
 
-#   pragma omp parallel if(n_rows > CS_THR_MIN)
-    {
+  BFT_MALLOC(matrix->h_row_id, n_h_rows, cs_lnum_t);
+
+  n_h_rows = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t e_id = row_index[ii+1];
+    if (e_id > row_index[ii] && col_id[e_id-1] >= n_rows)
+      matrix->h_row_id[n_h_rows++] = ii;
+  }
+
+  matrix->n_h_rows = n_h_rows;
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with scalar MSR matrix, overlapping the
+ * halo update of x with computation on halo-independent rows.
+ *
+ * The halo exchange is started asynchronously, halo-independent rows are
+ * computed while it progresses, and halo-dependent rows are computed once
+ * it has finished.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   x      <-> multipliying vector values (ghost values updated)
+ *   y      --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_overlap(const cs_matrix_t  *matrix,
+                         cs_real_t          *restrict x,
+                         cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  /* Build halo-dependent row list on first call; this caches data not
+     visible to the caller, so the const qualifier is cast away locally */
+
+  if (matrix->n_h_rows < 0)
+    _msr_build_halo_rows((cs_matrix_t *)matrix);
+
+  const cs_lnum_t  n_h_rows = matrix->n_h_rows;
+  const cs_lnum_t  *restrict h_row_id = matrix->h_row_id;
+
+  /* Start halo exchange, then compute halo-independent rows */
+
+  cs_halo_sync_var_start(matrix->halo, CS_HALO_STANDARD, x);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+
+    if (n_cols > 0 && col_id[n_cols-1] >= n_rows) /* halo-dependent row */
+      continue;
+
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+
+    y[ii] = sii + mc->d_val[ii]*x[ii];
+
+  }
+
+  /* Finish halo exchange, then compute halo-dependent rows */
+
+  cs_halo_sync_var_finish(matrix->halo, CS_HALO_STANDARD, x);
+
+# pragma omp parallel for  if(n_h_rows > CS_THR_MIN)
+  for (cs_lnum_t h_id = 0; h_id < n_h_rows; h_id++) {
+
+    cs_lnum_t ii = h_row_id[h_id];
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->x_val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += (m_row[jj]*x[col_id[jj]]);
+
+    y[ii] = sii + mc->d_val[ii]*x[ii];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using
+ * single-precision coefficient copies.
+ *
+ * Vectors remain in standard precision; only the matrix coefficients
+ * are read as floats, roughly halving the memory traffic of the
+ * product. Copies are built on first use and released whenever the
+ * reference coefficients are modified.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_sp(bool                exclude_diag,
+                    const cs_matrix_t  *matrix,
+                    const cs_real_t    *restrict x,
+                    cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  /* Build single-precision coefficient copies if needed */
+
+  if (mc->x_val_sp == NULL) {
+    const cs_lnum_t nnz = ms->row_index[n_rows];
+    BFT_MALLOC(mc->x_val_sp, nnz, float);
+#   pragma omp parallel for  if(nnz > CS_THR_MIN)
+    for (cs_lnum_t jj = 0; jj < nnz; jj++)
+      mc->x_val_sp[jj] = mc->x_val[jj];
+  }
+
+  if (mc->d_val_sp == NULL && mc->d_val != NULL) {
+    BFT_MALLOC(mc->d_val_sp, n_rows, float);
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      mc->d_val_sp[ii] = mc->d_val[ii];
+  }
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+    const float *restrict d_val = mc->d_val_sp;
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const float *restrict m_row = mc->x_val_sp + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii + d_val[ii]*x[ii];
+
+    }
+
+  }
+
+  /* Exclude diagonal */
+
+  else {
+
+#   pragma omp parallel for  if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+      const float *restrict m_row = mc->x_val_sp + ms->row_index[ii];
+      cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += (m_row[jj]*x[col_id[jj]]);
+
+      y[ii] = sii;
+
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_omp_sched(bool                exclude_diag,
+                           const cs_matrix_t  *matrix,
+                           const cs_real_t    *restrict x,
+                           cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+  cs_lnum_t  n_rows = ms->n_rows;
+
+  /* Standard case */
+
+  if (!exclude_diag && mc->d_val != NULL) {
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
 
       cs_lnum_t n_s_rows = cs_align(n_rows * 0.9, CS_CL);
       if (n_s_rows > n_rows)
@@ -4142,6 +4741,500 @@ _mat_vec_p_l_msr_mkl(bool                exclude_diag,
 
 #endif /* defined (HAVE_MKL) */
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, on device.
+ *
+ * The matrix structure and coefficients are uploaded on first use and
+ * remain resident on the device until the coefficients are released,
+ * so only x and y move across the bus for each product.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_OPENMP_TARGET)
+
+static void
+_mat_vec_p_l_msr_omp_target(bool                exclude_diag,
+                            const cs_matrix_t  *matrix,
+                            const cs_real_t     x[restrict],
+                            cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_cols_ext = ms->n_cols_ext;
+  const cs_lnum_t  nnz = ms->row_index[n_rows];
+  const cs_lnum_t  *restrict row_index = ms->row_index;
+  const cs_lnum_t  *restrict col_id = ms->col_id;
+  const cs_real_t  *restrict x_val = mc->x_val;
+  const cs_real_t  *restrict d_val = mc->d_val;
+
+  const int  device_id = omp_get_default_device();
+
+  if (! omp_target_is_present(x_val, device_id)) {
+#   pragma omp target enter data map(to: row_index[0:n_rows+1], \
+                                         col_id[0:nnz],         \
+                                         x_val[0:nnz])
+  }
+
+  if (!exclude_diag && d_val != NULL) {
+
+    if (! omp_target_is_present(d_val, device_id)) {
+#     pragma omp target enter data map(to: d_val[0:n_rows])
+    }
+
+#   pragma omp target teams distribute parallel for \
+      map(to: x[0:n_cols_ext]) map(from: y[0:n_rows])
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t sii = 0.0;
+      for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+        sii += x_val[jj] * x[col_id[jj]];
+      y[ii] = sii + d_val[ii]*x[ii];
+    }
+
+  }
+  else {
+
+#   pragma omp target teams distribute parallel for \
+      map(to: x[0:n_cols_ext]) map(from: y[0:n_rows])
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t sii = 0.0;
+      for (cs_lnum_t jj = row_index[ii]; jj < row_index[ii+1]; jj++)
+        sii += x_val[jj] * x[col_id[jj]];
+      y[ii] = sii;
+    }
+
+  }
+}
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
+/*----------------------------------------------------------------------------
+ * Destroy a SELL matrix structure.
+ *
+ * parameters:
+ *   matrix  <->  pointer to SELL matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_sell(cs_matrix_struct_sell_t  **matrix)
+{
+  if (matrix != NULL && *matrix !=NULL) {
+
+    cs_matrix_struct_sell_t  *ms = *matrix;
+
+    BFT_FREE(ms->slice_index);
+
+    BFT_FREE(ms->col_id);
+
+    BFT_FREE(ms);
+
+    *matrix = NULL;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Create a SELL matrix structure from a native matrix stucture.
+ *
+ * The structure is built from an intermediate CSR structure, so that
+ * entries of a given row are sorted by column id, and rows are padded
+ * to the largest row size of their slice.
+ *
+ * parameters:
+ *   n_rows      <-- number of local rows
+ *   n_cols_ext  <-- number of local + ghost columns
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *
+ * returns:
+ *   pointer to allocated SELL matrix structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell(cs_lnum_t           n_rows,
+                    cs_lnum_t           n_cols_ext,
+                    cs_lnum_t           n_edges,
+                    const cs_lnum_2_t  *edges)
+{
+  cs_matrix_struct_sell_t  *ms;
+
+  cs_matrix_struct_csr_t  *ms_csr = _create_struct_csr(false, /* have_diag */
+                                                       n_rows,
+                                                       n_cols_ext,
+                                                       n_edges,
+                                                       edges);
+
+  const cs_lnum_t ss = _sell_slice_size;
+
+  /* Allocate and map */
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  ms->n_rows = n_rows;
+  ms->n_cols_ext = n_cols_ext;
+
+  ms->slice_size = ss;
+  ms->n_slices = (n_rows + ss - 1) / ss;
+
+  ms->direct_assembly = ms_csr->direct_assembly;
+
+  BFT_MALLOC(ms->slice_index, ms->n_slices + 1, cs_lnum_t);
+
+  /* Compute slice widths (largest row size of each slice) */
+
+  ms->slice_index[0] = 0;
+
+  for (cs_lnum_t sid = 0; sid < ms->n_slices; sid++) {
+    cs_lnum_t w = 0;
+    cs_lnum_t r_end = CS_MIN((sid+1)*ss, n_rows);
+    for (cs_lnum_t ii = sid*ss; ii < r_end; ii++) {
+      cs_lnum_t n_cols = ms_csr->row_index[ii+1] - ms_csr->row_index[ii];
+      if (n_cols > w)
+        w = n_cols;
+    }
+    ms->slice_index[sid+1] = ms->slice_index[sid] + w*ss;
+  }
+
+  /* Build padded, interleaved column ids; inside a slice, the entry
+     for position jj of row sid*ss + r is at slice_index[sid] + jj*ss + r.
+     Padding entries reference column 0, and are assigned zero
+     coefficient values, so they do not contribute to products. */
+
+  BFT_MALLOC(ms->col_id, ms->slice_index[ms->n_slices], cs_lnum_t);
+
+# pragma omp parallel for  if(ms->n_slices > CS_THR_MIN)
+  for (cs_lnum_t sid = 0; sid < ms->n_slices; sid++) {
+    cs_lnum_t *restrict s_col_id = ms->col_id + ms->slice_index[sid];
+    cs_lnum_t w = (ms->slice_index[sid+1] - ms->slice_index[sid]) / ss;
+    for (cs_lnum_t r = 0; r < ss; r++) {
+      cs_lnum_t ii = sid*ss + r;
+      cs_lnum_t n_cols = 0;
+      if (ii < n_rows) {
+        const cs_lnum_t *restrict c_col_id
+          = ms_csr->col_id + ms_csr->row_index[ii];
+        n_cols = ms_csr->row_index[ii+1] - ms_csr->row_index[ii];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          s_col_id[jj*ss + r] = c_col_id[jj];
+      }
+      for (cs_lnum_t jj = n_cols; jj < w; jj++)
+        s_col_id[jj*ss + r] = 0;
+    }
+  }
+
+  _destroy_struct_csr(&ms_csr);
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Create SELL matrix coefficients.
+ *
+ * returns:
+ *   pointer to allocated SELL coefficients structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_coeff_sell_t *
+_create_coeff_sell(void)
+{
+  cs_matrix_coeff_sell_t  *mc;
+
+  /* Allocate */
+
+  BFT_MALLOC(mc, 1, cs_matrix_coeff_sell_t);
+
+  /* Initialize */
+
+  mc->d_val = NULL;
+
+  mc->_d_val = NULL;
+  mc->_x_val = NULL;
+
+  return mc;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy SELL matrix coefficients.
+ *
+ * parameters:
+ *   coeff  <->  pointer to SELL matrix coefficients pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_coeff_sell(cs_matrix_coeff_sell_t  **coeff)
+{
+  if (coeff != NULL && *coeff !=NULL) {
+
+    cs_matrix_coeff_sell_t  *mc = *coeff;
+
+    BFT_FREE(mc->_x_val);
+
+    BFT_FREE(mc->_d_val);
+
+    BFT_FREE(*coeff);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix extradiagonal coefficients to zero, including padding.
+ *
+ * The coefficients should already be allocated.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_zero_x_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  const cs_lnum_t  n_slices = ms->n_slices;
+
+# pragma omp parallel for  if(n_slices > CS_THR_MIN)
+  for (cs_lnum_t sid = 0; sid < n_slices; sid++) {
+    const cs_lnum_t  s_size = ms->slice_index[sid+1] - ms->slice_index[sid];
+    cs_real_t  *m_slice = mc->_x_val + ms->slice_index[sid];
+    for (cs_lnum_t jj = 0; jj < s_size; jj++)
+      m_slice[jj] = 0.0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add SELL extradiagonal matrix coefficients.
+ *
+ * The matrix coefficients should have been initialized (i.e. set to 0)
+ * before using this function, which handles both direct and incremental
+ * assembly (entries of a given row being sorted by column id, the
+ * matching entry is searched for below; rows of the cell-based matrices
+ * used here are short, so a linear search is used, as in the MSR case).
+ *
+ * parameters:
+ *   matrix      <-- pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   xa          <-- extradiagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_xa_coeffs_sell_increment(cs_matrix_t        *matrix,
+                              bool                symmetric,
+                              cs_lnum_t           n_edges,
+                              const cs_lnum_2_t  *edges,
+                              const cs_real_t    *restrict xa)
+{
+  cs_lnum_t  ii, jj, face_id;
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_lnum_t ss = ms->slice_size;
+
+  const cs_lnum_t *restrict edges_p
+    = (const cs_lnum_t *restrict)(edges);
+
+  /* Copy extra-diagonal values */
+
+  assert(edges != NULL || n_edges == 0);
+
+  for (face_id = 0; face_id < n_edges; face_id++) {
+    cs_lnum_t kk, ll;
+    cs_real_t xa_ij, xa_ji;
+    ii = *edges_p++;
+    jj = *edges_p++;
+    if (symmetric == false) {
+      xa_ij = xa[2*face_id];
+      xa_ji = xa[2*face_id + 1];
+    }
+    else {
+      xa_ij = xa[face_id];
+      xa_ji = xa[face_id];
+    }
+    if (ii < ms->n_rows) {
+      for (kk = ms->slice_index[ii/ss] + ii%ss;
+           ms->col_id[kk] != jj;
+           kk += ss);
+      mc->_x_val[kk] += xa_ij;
+    }
+    if (jj < ms->n_rows) {
+      for (ll = ms->slice_index[jj/ss] + jj%ss;
+           ms->col_id[ll] != ii;
+           ll += ss);
+      mc->_x_val[ll] += xa_ji;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Map or copy SELL matrix diagonal coefficients.
+ *
+ * parameters:
+ *   matrix           <-> pointer to matrix structure
+ *   copy             <-- indicates if coefficients should be copied
+ *   da               <-- diagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_map_or_copy_da_coeffs_sell(cs_matrix_t      *matrix,
+                            bool              copy,
+                            const cs_real_t  *restrict da)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t n_rows = matrix->n_rows;
+
+  /* Map or copy diagonal values */
+
+  if (da != NULL) {
+
+    if (copy) {
+      if (mc->_d_val == NULL)
+        BFT_MALLOC(mc->_d_val, n_rows, cs_real_t);
+#     pragma omp parallel for  if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        mc->_d_val[ii] = da[ii];
+      mc->d_val = mc->_d_val;
+    }
+    else
+      mc->d_val = da;
+
+  }
+  else
+    mc->d_val = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL matrix coefficients.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+
+  if (matrix->db_size[3] != 1 || matrix->eb_size[3] != 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Handling of block matrixes in %s format\n"
+                "is not operational yet."),
+              _(cs_matrix_type_name[matrix->type]));
+
+  /* Map or copy diagonal values */
+
+  _map_or_copy_da_coeffs_sell(matrix, copy, da);
+
+  /* Extradiagonal values; the values array is always zeroed first,
+     as padding entries must remain zero */
+
+  if (mc->_x_val == NULL)
+    BFT_MALLOC(mc->_x_val, ms->slice_index[ms->n_slices], cs_real_t);
+
+  _zero_x_coeffs_sell(matrix);
+
+  if (xa != NULL)
+    _set_xa_coeffs_sell_increment(matrix, symmetric, n_edges, edges, xa);
+}
+
+/*----------------------------------------------------------------------------
+ * Release shared SELL matrix coefficients.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_release_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+  if (mc != NULL) {
+    /* Unmap shared values */
+    mc->d_val = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL matrix.
+ *
+ * parameters:
+ *   exclude_diag <-- exclude diagonal if true
+ *   matrix       <-- pointer to matrix structure
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(bool                exclude_diag,
+                  const cs_matrix_t  *matrix,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms = matrix->structure;
+  const cs_matrix_coeff_sell_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_slices = ms->n_slices;
+  const cs_lnum_t  ss = ms->slice_size;
+
+  const bool add_diag = (!exclude_diag && mc->d_val != NULL);
+
+# pragma omp parallel for  if(n_slices > CS_THR_MIN)
+  for (cs_lnum_t sid = 0; sid < n_slices; sid++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->slice_index[sid];
+    const cs_real_t *restrict m_slice = mc->_x_val + ms->slice_index[sid];
+    const cs_lnum_t w = (ms->slice_index[sid+1] - ms->slice_index[sid]) / ss;
+    const cs_lnum_t r_shift = sid*ss;
+    const cs_lnum_t n_s_rows = CS_MIN(ss, n_rows - r_shift);
+
+    cs_real_t sii[8]; /* _sell_slice_size */
+
+    for (cs_lnum_t r = 0; r < ss; r++)
+      sii[r] = 0.0;
+
+    /* Padding entries reference column 0 with zero values,
+       so lanes may be computed unconditionally */
+
+    for (cs_lnum_t jj = 0; jj < w; jj++) {
+      for (cs_lnum_t r = 0; r < ss; r++)
+        sii[r] += m_slice[jj*ss + r] * x[col_id[jj*ss + r]];
+    }
+
+    if (add_diag) {
+      for (cs_lnum_t r = 0; r < n_s_rows; r++)
+        y[r_shift + r] = sii[r] + mc->d_val[r_shift + r]*x[r_shift + r];
+    }
+    else {
+      for (cs_lnum_t r = 0; r < n_s_rows; r++)
+        y[r_shift + r] = sii[r];
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Synchronize ghost values prior to matrix.vector product
  *
@@ -4575,6 +5668,7 @@ _variant_add(const char                        *name,
  *     default
  *     standard
  *     mkl             (with MKL)
+ *     omp_target      (with OpenMP target offload)
  *
  *   CS_MATRIX_CSR_SYM (for CS_MATRIX_SCALAR_SYM)
  *     default
@@ -4585,6 +5679,13 @@ _variant_add(const char                        *name,
  *     standard
  *     omp_sched       (Improved scheduling for OpenMP)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     omp_target      (with OpenMP target offload, for CS_MATRIX_SCALAR
+ *                      or CS_MATRIX_SCALAR_SYM)
+ *     single_prec     (single-precision coefficients, for CS_MATRIX_SCALAR
+ *                      or CS_MATRIX_SCALAR_SYM)
+ *
+ *   CS_MATRIX_SELL    (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     standard
  *
  * parameters:
  *   m_type          <-- Matrix type
@@ -4632,15 +5733,18 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[1] = _mat_vec_p_l_native;
         break;
       case CS_MATRIX_BLOCK_D:
-      case CS_MATRIX_BLOCK_D_66:
       case CS_MATRIX_BLOCK_D_SYM:
-        spmv[0] = _b_mat_vec_p_l_native;
-        spmv[1] = _b_mat_vec_p_l_native;
+        spmv[0] = _b_mat_vec_p_l_native_fixed;
+        spmv[1] = _b_mat_vec_p_l_native_fixed;
         break;
-      case CS_MATRIX_BLOCK:
-        spmv[0] = _bb_mat_vec_p_l_native;
-        spmv[1] = _bb_mat_vec_p_l_native;
+      case CS_MATRIX_BLOCK_D_66:
+        /* block size known from fill type, so dispatch directly */
+        spmv[0] = _6_6_mat_vec_p_l_native;
+        spmv[1] = _6_6_mat_vec_p_l_native;
         break;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_native_fixed;
+        spmv[1] = _bb_mat_vec_p_l_native_fixed;
         break;
       default:
         break;
@@ -4690,6 +5794,10 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[0] = _b_mat_vec_p_l_native_fixed;
         spmv[1] = _b_mat_vec_p_l_native_fixed;
         break;
+      case CS_MATRIX_BLOCK:
+        spmv[0] = _bb_mat_vec_p_l_native_fixed;
+        spmv[1] = _bb_mat_vec_p_l_native_fixed;
+        break;
       default:
         break;
       }
@@ -4750,6 +5858,14 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[1] = _mat_vec_p_l_csr_mkl;
 #else
         retcode = 2;
+#endif
+      }
+      else if (!strcmp(func_name, "omp_target")) {
+#if defined(HAVE_OPENMP_TARGET)
+        spmv[0] = _mat_vec_p_l_csr_omp_target;
+        spmv[1] = _mat_vec_p_l_csr_omp_target;
+#else
+        retcode = 2;
 #endif
       }
       break;
@@ -4791,11 +5907,15 @@ _set_spmv_func(cs_matrix_type_t             m_type,
         spmv[1] = _mat_vec_p_l_msr;
         break;
       case CS_MATRIX_BLOCK_D:
-      case CS_MATRIX_BLOCK_D_66:
       case CS_MATRIX_BLOCK_D_SYM:
         spmv[0] = _b_mat_vec_p_l_msr;
         spmv[1] = _b_mat_vec_p_l_msr;
         break;
+      case CS_MATRIX_BLOCK_D_66:
+        /* block size known from fill type, so dispatch directly */
+        spmv[0] = _6_6_mat_vec_p_l_msr;
+        spmv[1] = _6_6_mat_vec_p_l_msr;
+        break;
       default:
         break;
       }
@@ -4842,6 +5962,50 @@ _set_spmv_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "single_prec")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_msr_sp;
+        spmv[1] = _mat_vec_p_l_msr_sp;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "omp_target")) {
+#if defined(HAVE_OPENMP_TARGET)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        spmv[0] = _mat_vec_p_l_msr_omp_target;
+        spmv[1] = _mat_vec_p_l_msr_omp_target;
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    break;
+
+  case CS_MATRIX_SELL:
+
+    switch(fill_type) {
+    case CS_MATRIX_SCALAR:
+    case CS_MATRIX_SCALAR_SYM:
+      if (standard > 0) {
+        spmv[0] = _mat_vec_p_l_sell;
+        spmv[1] = _mat_vec_p_l_sell;
+      }
+      break;
+    default:
+      break;
+    }
+
     break;
 
   default:
@@ -5015,6 +6179,13 @@ _structure_destroy(cs_matrix_type_t   type,
       *structure = _structure;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_sell_t *_structure = *structure;
+      _destroy_struct_sell(&_structure);
+      *structure = _structure;
+    }
+    break;
   default:
     assert(0);
     break;
@@ -5085,6 +6256,9 @@ _matrix_create(cs_matrix_type_t  type)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5095,6 +6269,9 @@ _matrix_create(cs_matrix_type_t  type)
 
   m->xa = NULL;
 
+  m->n_h_rows = -1;
+  m->h_row_id = NULL;
+
   /* Set function pointers here */
 
   m->set_coefficients = NULL;
@@ -5135,6 +6312,12 @@ _matrix_create(cs_matrix_type_t  type)
     m->copy_diagonal = _copy_diagonal_separate;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_sell;
+    m->copy_diagonal = _copy_diagonal_separate;
+    break;
+
   default:
     assert(0);
     break;
@@ -5234,6 +6417,12 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                        n_edges,
                                        edges);
     break;
+  case CS_MATRIX_SELL:
+    ms->structure = _create_struct_sell(n_rows,
+                                        n_cols_ext,
+                                        n_edges,
+                                        edges);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5623,6 +6812,9 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   case CS_MATRIX_MSR:
     m->coeffs = _create_coeff_msr();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_sell();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in %s format\n"
@@ -5680,6 +6872,13 @@ cs_matrix_destroy(cs_matrix_t **matrix)
         m->coeffs = NULL;
       }
       break;
+    case CS_MATRIX_SELL:
+      {
+        cs_matrix_coeff_sell_t *coeffs = m->coeffs;
+        _destroy_coeff_sell(&coeffs);
+        m->coeffs = NULL;
+      }
+      break;
     default:
       assert(0);
       break;
@@ -5687,6 +6886,8 @@ cs_matrix_destroy(cs_matrix_t **matrix)
 
     m->coeffs = NULL;
 
+    BFT_FREE(m->h_row_id);
+
     if (m->_structure != NULL)
       _structure_destroy(m->type, &(m->_structure));
 
@@ -5792,6 +6993,12 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
       retval = ms->row_index[ms->n_rows] + ms->n_rows;
     }
     break;
+  case CS_MATRIX_SELL:
+    {
+      const cs_matrix_struct_sell_t  *ms = matrix->structure;
+      retval = ms->slice_index[ms->n_slices] + ms->n_rows;
+    }
+    break;
   default:
     break;
   }
@@ -6483,6 +7690,182 @@ cs_matrix_msr_assembler_values_add_1_critic(void             *matrix_p,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize MSR matrix coefficients and per-thread staging buffers
+ *        for lock-free threaded assembly.
+ *
+ * Intended for use with \ref cs_matrix_msr_assembler_values_add_1_staged
+ * and \ref cs_matrix_msr_assembler_values_end_staged, which must be called
+ * to merge the staged contributions before the matrix is used.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ * \param[in]       db_size   optional diagonal block sizes
+ * \param[in]       eb_size   optional extra-diagonal block sizes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_assembler_values_init_staged(void             *matrix_p,
+                                           const cs_lnum_t  *db_size,
+                                           const cs_lnum_t  *eb_size)
+{
+  cs_matrix_msr_assembler_values_init(matrix_p, db_size, eb_size);
+
+  if (_staging_buffers != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: a staged matrix assembly is already in progress;\n"
+                "only one may be active at a given time."), __func__);
+
+  _n_staging_buffers = cs_glob_n_threads;
+
+  BFT_MALLOC(_staging_buffers, _n_staging_buffers, _staging_buffer_t);
+
+  for (int i = 0; i < _n_staging_buffers; i++) {
+    _staging_buffer_t *b = _staging_buffers + i;
+    b->n = 0;
+    b->max = 0;
+    b->c_idx = NULL;
+    b->val = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function pointer for addition to MSR matrix coefficients using
+ *        local row ids and column indexes.
+ *        Specific case: OpenMP with per-thread staging buffers and stride = 1
+ *
+ * Contributions are accumulated in a buffer private to the calling thread,
+ * with no synchronization, and merged into the matrix coefficients by
+ * \ref cs_matrix_msr_assembler_values_end_staged.
+ *
+ * Values whose associated row index is negative should be ignored;
+ * Values whose column index is -1 are assumed to be assigned to a
+ * separately stored diagonal. Other indexes shoudl be valid.
+ *
+ * \warning  The matrix pointer must point to valid data when the selection
+ *           function is called, so the life cycle of the data pointed to
+ *           should be at least as long as that of the assembler values
+ *           structure.
+ *
+ * \remark  Note that we pass column indexes (not ids) here; as the
+ *          caller is already assumed to have identified the index
+ *          matching a given column id.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ * \param[in]       n         number of values to add
+ * \param[in]       stride    associated data block size
+ * \param[in]       row_id    associated local row ids
+ * \param[in]       col_idx   associated local column indexes
+ * \param[in]       val       pointer to values (size: n*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_assembler_values_add_1_staged(void             *matrix_p,
+                                            cs_lnum_t         n,
+                                            cs_lnum_t         stride,
+                                            const cs_lnum_t   row_id[],
+                                            const cs_lnum_t   col_idx[],
+                                            const cs_real_t   vals[])
+{
+  CS_UNUSED(stride);
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  assert(stride == 1);
+
+  int t_id = 0;
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+#endif
+
+  _staging_buffer_t *b = _staging_buffers + t_id;
+
+  if (b->n + n > b->max) {
+    b->max = (b->max > 0) ? b->max*2 : 4096;
+    if (b->max < b->n + n)
+      b->max = b->n + n;
+    BFT_REALLOC(b->c_idx, b->max, cs_lnum_t);
+    BFT_REALLOC(b->val, b->max, cs_real_t);
+  }
+
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    const cs_lnum_t r_id = row_id[ii];
+    if (r_id < 0)
+      continue;
+    if (col_idx[ii] < 0)
+      b->c_idx[b->n] = r_id;
+    else
+      b->c_idx[b->n] = n_rows + ms->row_index[r_id] + col_idx[ii];
+    b->val[b->n] = vals[ii];
+    b->n += 1;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge per-thread staging buffers into MSR matrix coefficients.
+ *
+ * Each thread of the merge handles a distinct range of coefficients,
+ * scanning the staging buffers in thread id order, so no synchronization
+ * is needed and the summation order for a given coefficient does not
+ * depend on the number of threads used for the merge.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_assembler_values_end_staged(void  *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+  cs_matrix_coeff_msr_t  *mc = matrix->coeffs;
+
+  const cs_matrix_struct_csr_t  *ms = matrix->structure;
+  const cs_lnum_t n_rows = ms->n_rows;
+
+  if (_staging_buffers == NULL)
+    return;
+
+  const int n_b = _n_staging_buffers;
+  const cs_lnum_t span = n_rows + ms->row_index[n_rows];
+
+# pragma omp parallel for  schedule(static, 1)
+  for (int t_id = 0; t_id < n_b; t_id++) {
+
+    const cs_lnum_t s_idx = span*t_id / n_b;
+    const cs_lnum_t e_idx = span*(t_id+1) / n_b;
+
+    for (int i = 0; i < n_b; i++) {
+
+      const _staging_buffer_t *b = _staging_buffers + i;
+
+      for (cs_lnum_t j = 0; j < b->n; j++) {
+        const cs_lnum_t c_idx = b->c_idx[j];
+        if (c_idx < s_idx || c_idx >= e_idx)
+          continue;
+        if (c_idx < n_rows)
+          mc->_d_val[c_idx] += b->val[j];
+        else
+          mc->_x_val[c_idx - n_rows] += b->val[j];
+      }
+
+    }
+
+  }
+
+  for (int i = 0; i < n_b; i++) {
+    BFT_FREE(_staging_buffers[i].c_idx);
+    BFT_FREE(_staging_buffers[i].val);
+  }
+  BFT_FREE(_staging_buffers);
+  _n_staging_buffers = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Copy matrix diagonal values.
@@ -6637,6 +8020,23 @@ cs_matrix_get_diagonal(const cs_matrix_t  *matrix)
     }
     break;
 
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_coeff_sell_t *mc = matrix->coeffs;
+      assert(matrix->db_size[3] == 1);
+      if (mc->d_val == NULL) {
+        cs_lnum_t n_rows = matrix->n_rows;
+        if (mc->_d_val == NULL)
+          BFT_MALLOC(mc->_d_val, matrix->n_rows, cs_real_t);
+#       pragma omp parallel for  if(n_rows > CS_THR_MIN)
+        for (ii = 0; ii < n_rows; ii++)
+          mc->_d_val[ii] = 0.0;
+        mc->d_val = mc->_d_val;
+      }
+      diag = mc->d_val;
+    }
+    break;
+
   default:
     assert(0);
     break;
@@ -7003,6 +8403,45 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
        cs_matrix_type_name[matrix->type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether matrix.vector products should overlap the halo
+ *        exchange with computation on halo-independent rows.
+ *
+ * \return  true if overlap mode is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_vector_multiply_overlap(void)
+{
+  return _vector_multiply_overlap;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set overlap of halo exchange and computation in matrix.vector
+ *        products.
+ *
+ * When this mode is active, cs_matrix_vector_multiply() partitions rows
+ * into halo-independent and halo-dependent sets, starts the halo exchange
+ * asynchronously, computes halo-independent rows while it progresses, and
+ * computes halo-dependent rows once it has finished.
+ *
+ * This is currently limited to scalar MSR matrices using the default
+ * product function, with no periodicity; the standard synchronous path
+ * is used in all other cases.
+ *
+ * \param[in]  overlap  true to activate overlap mode, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_vector_multiply_overlap(bool  overlap)
+{
+  _vector_multiply_overlap = overlap;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -7026,6 +8465,29 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
 {
   assert(matrix != NULL);
 
+#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+  if (_spmv_stats_id == -2)
+    _spmv_stats_id = cs_timer_stats_id_by_name("spmv");
+#endif
+
+  cs_timer_t t0 = cs_timer_time();
+
+  /* Split execution, overlapping the halo exchange with computation on
+     halo-independent rows; limited to scalar MSR matrices using the
+     default product function, with no periodicity */
+
+  if (   _vector_multiply_overlap
+      && matrix->halo != NULL
+      && matrix->halo->n_transforms == 0
+      && matrix->type == CS_MATRIX_MSR
+      && matrix->vector_multiply[matrix->fill_type][0] == _mat_vec_p_l_msr
+      && ((const cs_matrix_coeff_msr_t *)matrix->coeffs)->d_val != NULL) {
+    _pre_vector_multiply_sync_y(matrix, y);
+    _mat_vec_p_l_msr_overlap(matrix, x, y);
+    _spmv_stats_add(matrix, &t0);
+    return;
+  }
+
   if (matrix->halo != NULL)
     _pre_vector_multiply_sync(rotation_mode,
                               matrix,
@@ -7040,6 +8502,8 @@ cs_matrix_vector_multiply(cs_halo_rotation_t   rotation_mode,
       (__FILE__, __LINE__, 0,
        _("Matrix is missing a vector multiply function for fill type %s."),
        cs_matrix_fill_type_name[matrix->fill_type]);
+
+  _spmv_stats_add(matrix, &t0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7064,6 +8528,13 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
 {
   assert(matrix != NULL);
 
+#if !defined(_CS_UNIT_MATRIX_TEST) /* unit tests do not link with full library */
+  if (_spmv_stats_id == -2)
+    _spmv_stats_id = cs_timer_stats_id_by_name("spmv");
+#endif
+
+  cs_timer_t t0 = cs_timer_time();
+
   if (matrix->vector_multiply[matrix->fill_type][0] != NULL)
     matrix->vector_multiply[matrix->fill_type][0](false, matrix, x, y);
 
@@ -7072,6 +8543,8 @@ cs_matrix_vector_multiply_nosync(const cs_matrix_t  *matrix,
       (__FILE__, __LINE__, 0,
        _("Matrix is missing a vector multiply function for fill type %s."),
        cs_matrix_fill_type_name[matrix->fill_type]);
+
+  _spmv_stats_add(matrix, &t0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -7165,6 +8638,10 @@ cs_matrix_csr_assembler_values_init(void              *matrix_p,
 
   const cs_matrix_struct_csr_t  *ms = matrix->structure;
 
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_csr(matrix);
+#endif
+
   /* Initialize diagonal values */
 
   BFT_REALLOC(mc->_val, e_stride*ms->row_index[ms->n_rows], cs_real_t);
@@ -7320,6 +8797,12 @@ cs_matrix_msr_assembler_values_init(void              *matrix_p,
 
   /* Initialize diagonal values */
 
+#if defined(HAVE_OPENMP_TARGET)
+  _unmap_coeffs_from_device_msr(matrix);
+#endif
+
+  _release_coeffs_sp_msr(matrix);
+
   BFT_REALLOC(mc->_d_val, d_stride*n_rows, cs_real_t);
   mc->d_val = mc->_d_val;
   mc->max_db_size = d_stride;
@@ -7554,7 +9037,7 @@ cs_matrix_variant_build_list(int                      n_fill_types,
                  2, /* ed_flag */
                  NULL,
                  _b_mat_vec_p_l_native_fixed,
-                 NULL,
+                 _bb_mat_vec_p_l_native_fixed,
                  n_variants,
                  &n_variants_max,
                  m_variant);
@@ -7637,6 +9120,22 @@ cs_matrix_variant_build_list(int                      n_fill_types,
 
 #endif /* defined(HAVE_MKL) */
 
+#if defined(HAVE_OPENMP_TARGET)
+
+    _variant_add(_("CSR, OpenMP target offload"),
+                 CS_MATRIX_CSR,
+                 n_fill_types,
+                 fill_types,
+                 0, /* ed_flag */
+                 _mat_vec_p_l_csr_omp_target,
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
   }
 
   if (type_filter[CS_MATRIX_CSR_SYM]) {
@@ -7735,6 +9234,38 @@ cs_matrix_variant_build_list(int                      n_fill_types,
                  &n_variants_max,
                  m_variant);
 
+#if defined(HAVE_OPENMP_TARGET)
+
+    _variant_add(_("MSR, OpenMP target offload"),
+                 CS_MATRIX_MSR,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 _mat_vec_p_l_msr_omp_target,
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif /* defined(HAVE_OPENMP_TARGET) */
+
+  }
+
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add(_("SELL"),
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 2, /* ed_flag */
+                 _mat_vec_p_l_sell,
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
   }
 
   n_variants_max = *n_variants;
@@ -7782,6 +9313,9 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv)
  *     fixed           (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL    (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     standard
+ *
  * parameters:
  *   mv        <-> Pointer to matrix variant
  *   numbering <-- mesh numbering info, or NULL
@@ -7894,7 +9428,7 @@ cs_matrix_variant_test(cs_lnum_t              n_rows,
                        const cs_numbering_t  *numbering)
 {
   int  n_variants = 0;
-  bool type_filter[CS_MATRIX_N_TYPES] = {true, true, true, true};
+  bool type_filter[CS_MATRIX_N_TYPES] = {true, true, true, true, true};
   cs_matrix_fill_type_t  fill_types[] = {CS_MATRIX_SCALAR,
                                          CS_MATRIX_SCALAR_SYM,
                                          CS_MATRIX_BLOCK_D,
@@ -58,6 +58,8 @@ typedef enum {
   CS_MATRIX_CSR,        /* Compressed Sparse Row storage format */
   CS_MATRIX_CSR_SYM,    /* Compressed Symmetric Sparse Row storage format */
   CS_MATRIX_MSR,        /* Modified Compressed Sparse Row storage format */
+  CS_MATRIX_SELL,       /* Sliced ELLPACK (SELL-C) storage format, with
+                           separate diagonal */
   CS_MATRIX_N_TYPES     /* Number of known matrix types */
 
 } cs_matrix_type_t;
@@ -846,6 +848,36 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether matrix.vector products should overlap the halo exchange
+ * with computation on halo-independent rows.
+ *
+ * returns:
+ *   true if overlap mode is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_vector_multiply_overlap(void);
+
+/*----------------------------------------------------------------------------
+ * Set overlap of halo exchange and computation in matrix.vector products.
+ *
+ * When this mode is active, cs_matrix_vector_multiply() partitions rows
+ * into halo-independent and halo-dependent sets, starts the halo exchange
+ * asynchronously, computes halo-independent rows while it progresses, and
+ * computes halo-dependent rows once it has finished.
+ *
+ * This is currently limited to scalar MSR matrices using the default
+ * product function, with no periodicity; the standard synchronous path
+ * is used in all other cases.
+ *
+ * parameters:
+ *   overlap <-- true to activate overlap mode, false otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_vector_multiply_overlap(bool  overlap);
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x
  *
@@ -1135,6 +1167,82 @@ cs_matrix_msr_assembler_values_add_1_critic(void             *matrix_p,
                                             const cs_lnum_t   col_idx[],
                                             const cs_real_t   vals[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize MSR matrix coefficients and per-thread staging buffers
+ *        for lock-free threaded assembly.
+ *
+ * Intended for use with \ref cs_matrix_msr_assembler_values_add_1_staged
+ * and \ref cs_matrix_msr_assembler_values_end_staged, which must be called
+ * to merge the staged contributions before the matrix is used.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ * \param[in]       db_size   optional diagonal block sizes
+ * \param[in]       eb_size   optional extra-diagonal block sizes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_assembler_values_init_staged(void             *matrix_p,
+                                           const cs_lnum_t  *db_size,
+                                           const cs_lnum_t  *eb_size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function pointer for addition to MSR matrix coefficients using
+ *        local row ids and column indexes.
+ *        Specific case: OpenMP with per-thread staging buffers and stride = 1
+ *
+ * Contributions are accumulated in a buffer private to the calling thread,
+ * with no synchronization, and merged into the matrix coefficients by
+ * \ref cs_matrix_msr_assembler_values_end_staged.
+ *
+ * Values whose associated row index is negative should be ignored;
+ * Values whose column index is -1 are assumed to be assigned to a
+ * separately stored diagonal. Other indexes shoudl be valid.
+ *
+ * \warning  The matrix pointer must point to valid data when the selection
+ *           function is called, so the life cycle of the data pointed to
+ *           should be at least as long as that of the assembler values
+ *           structure.
+ *
+ * \remark  Note that we pass column indexes (not ids) here; as the
+ *          caller is already assumed to have identified the index
+ *          matching a given column id.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ * \param[in]       n         number of values to add
+ * \param[in]       stride    associated data block size
+ * \param[in]       row_id    associated local row ids
+ * \param[in]       col_idx   associated local column indexes
+ * \param[in]       val       pointer to values (size: n*stride)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_assembler_values_add_1_staged(void             *matrix_p,
+                                            cs_lnum_t         n,
+                                            cs_lnum_t         stride,
+                                            const cs_lnum_t   row_id[],
+                                            const cs_lnum_t   col_idx[],
+                                            const cs_real_t   vals[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Merge per-thread staging buffers into MSR matrix coefficients.
+ *
+ * Each thread of the merge handles a distinct range of coefficients,
+ * scanning the staging buffers in thread id order, so no synchronization
+ * is needed and the summation order for a given coefficient does not
+ * depend on the number of threads used for the merge.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_msr_assembler_values_end_staged(void  *matrix_p);
+
 /*----------------------------------------------------------------------------
  * Build list of variants for tuning or testing.
  *
@@ -1197,6 +1305,7 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv);
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     standard
  *     mkl             (with MKL)
+ *     omp_target      (with OpenMP target offload)
  *
  *   CS_MATRIX_CSR_SYM (for CS_MATRIX_SCALAR_SYM)
  *     standard
@@ -1206,6 +1315,13 @@ cs_matrix_variant_destroy(cs_matrix_variant_t  **mv);
  *     standard
  *     generic         (for CS_MATRIX_??_BLOCK_D or CS_MATRIX_??_BLOCK_D_SYM)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     omp_target      (with OpenMP target offload, for CS_MATRIX_SCALAR
+ *                      or CS_MATRIX_SCALAR_SYM)
+ *     single_prec     (single-precision coefficients, for CS_MATRIX_SCALAR
+ *                      or CS_MATRIX_SCALAR_SYM)
+ *
+ *   CS_MATRIX_SELL    (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     standard
  *
  * parameters:
  *   mv        <-> pointer to matrix variant
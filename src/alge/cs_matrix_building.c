@@ -372,6 +372,234 @@ cs_matrix_wrapper_scalar_conv_diff(int               iconvp,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Fused variant of cs_face_viscosity and cs_matrix_wrapper_scalar.
+ *
+ * The face diffusion velocities (i_visc, b_visc) are computed from the cell
+ * viscosity and the matrix coefficients are accumulated in the same face
+ * sweeps, so each face array is streamed once instead of twice per scalar;
+ * the face viscosities are returned for use by the right hand side.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_fused(int               iconvp,
+                               int               idiffp,
+                               int               ndircp,
+                               int               isym,
+                               double            thetap,
+                               int               imucpp,
+                               int               visc_mean_type,
+                               const cs_real_t   coefbp[],
+                               const cs_real_t   cofbfp[],
+                               const cs_real_t   rovsdt[],
+                               const cs_real_t   i_massflux[],
+                               const cs_real_t   b_massflux[],
+                               cs_real_t         c_visc[],
+                               const cs_real_t   xcpp[],
+                               cs_real_t         i_visc[],
+                               cs_real_t         b_visc[],
+                               cs_real_t         da[],
+                               cs_real_t         xa[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_halo_t *halo = m->halo;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_real_t *restrict weight = mq->weight;
+  const cs_real_t *restrict i_dist = mq->i_dist;
+  const cs_real_t *restrict i_f_face_surf = mq->i_f_face_surf;
+  const cs_real_t *restrict b_f_face_surf = mq->b_f_face_surf;
+
+  if (isym != 1 && isym != 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isym"));
+  }
+
+  /* Porosity field */
+  cs_field_t *fporo = cs_field_by_name_try("porosity");
+
+  cs_real_t *porosi = NULL;
+
+  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2) {
+    porosi = fporo->val;
+  }
+
+  /* ---> Periodicity and parallelism treatment */
+  if (halo != NULL) {
+    cs_halo_type_t halo_type = CS_HALO_STANDARD;
+    cs_halo_sync_var(halo, halo_type, c_visc);
+    if (porosi != NULL) cs_halo_sync_var(halo, halo_type, porosi);
+  }
+
+  /* Initialization */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] = rovsdt[cell_id];
+  }
+  if (n_cells_ext > n_cells) {
+#   pragma omp parallel for if (n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      da[cell_id] = 0.;
+    }
+  }
+
+  /* Face viscosity, extradiagonal terms and contribution to the diagonal,
+     in a single pass over interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp, \
+                                         visc_mean_type)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        double visci = c_visc[ii];
+        double viscj = c_visc[jj];
+        if (porosi != NULL) {
+          visci *= porosi[ii];
+          viscj *= porosi[jj];
+        }
+
+        double viscf;
+        if (visc_mean_type == 0)
+          viscf = 0.5*(visci+viscj);
+        else {
+          double pnd = weight[face_id];
+          viscf = visci*viscj/CS_MAX(pnd*visci+(1.-pnd)*viscj,
+                                     DBL_MIN);
+        }
+        viscf *= i_f_face_surf[face_id]/i_dist[face_id];
+
+        i_visc[face_id] = viscf;
+
+        /* Symmetric matrix */
+        if (isym == 1) {
+
+          cs_real_t aij = -thetap*idiffp*viscf;
+
+          xa[face_id] = aij;
+          da[ii] -= aij;
+          da[jj] -= aij;
+
+        /* Non-symmetric matrix */
+        } else {
+
+          /* When solving the temperature, the convective part is
+             multiplied by Cp */
+          double xcpi = 1., xcpj = 1.;
+          if (imucpp == 1) {
+            xcpi = xcpp[ii];
+            xcpj = xcpp[jj];
+          }
+
+          double flui = 0.5*(i_massflux[face_id] -fabs(i_massflux[face_id]));
+          double fluj =-0.5*(i_massflux[face_id] +fabs(i_massflux[face_id]));
+
+          xa[2*face_id]    = thetap*(iconvp*xcpi*flui -idiffp*viscf);
+          xa[2*face_id +1] = thetap*(iconvp*xcpj*fluj -idiffp*viscf);
+
+          /* D_ii =  theta (m_ij)^+ - m_ij
+           *      = -X_ij - (1-theta)*m_ij
+           * D_jj = -theta (m_ij)^- + m_ij
+           *      = -X_ji + (1-theta)*m_ij
+           */
+          da[ii] -= xa[2*face_id]
+                  + iconvp*(1. - thetap)*xcpi*i_massflux[face_id];
+          da[jj] -= xa[2*face_id +1]
+                  - iconvp*(1. - thetap)*xcpj*i_massflux[face_id];
+
+        }
+
+      }
+    }
+  }
+
+  /* Boundary face viscosity and contribution to the diagonal */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp) \
+                        if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        double viscb = b_f_face_surf[face_id];
+        if (porosi != NULL)
+          viscb *= porosi[ii];
+
+        b_visc[face_id] = viscb;
+
+        /* Symmetric matrix */
+        if (isym == 1) {
+
+          da[ii] += idiffp*thetap*viscb*cofbfp[face_id];
+
+        /* Non-symmetric matrix */
+        } else {
+
+          double xcpi = (imucpp == 1) ? xcpp[ii] : 1.;
+
+          double flui = 0.5*(b_massflux[face_id] - fabs(b_massflux[face_id]));
+
+          /* D_ii = theta (m_f)^+ + theta B (m_f)^- - m_f
+           *      = (theta B -1)*(m_f)^- - (1-theta)*(m_f)^+
+           *      = theta*(B -1)*(m_f)^- - (1-theta)*m_f
+           */
+          da[ii] += iconvp*xcpi*(flui*thetap*(coefbp[face_id]-1.)
+                                -(1.-thetap)*b_massflux[face_id])
+                  + idiffp*thetap*viscb*cofbfp[face_id];
+
+        }
+
+      }
+    }
+  }
+
+  /* Penalization if non invertible matrix */
+
+  /* If no Dirichlet condition, the diagonal is slightly increased in order
+     to shift the eigenvalues spectrum (if IDIRCL=0, we force NDIRCP to be at
+     least 1 in order not to shift the diagonal). */
+
+  if (ndircp <= 0) {
+    const double epsi = 1.e-7;
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] = (1.+epsi)*da[cell_id];
+    }
+  }
+
+  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] += mq->c_solid_flag[CS_MIN(cs_glob_porous_model, 1)*cell_id];
+  }
+
+}
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_vector (or its counterpart for
  * symmetric matrices)
@@ -149,6 +149,38 @@ cs_matrix_wrapper_scalar_conv_diff(int               iconvp,
                                    cs_real_t         da_diff[],
                                    cs_real_t         xa_diff[]);
 
+/*----------------------------------------------------------------------------
+ * Fused variant of cs_face_viscosity and cs_matrix_wrapper_scalar.
+ *
+ * The face diffusion velocities (i_visc, b_visc) are computed from the cell
+ * viscosity and the matrix coefficients are accumulated in the same face
+ * sweeps, so each face array is streamed once instead of twice per scalar;
+ * the face viscosities are returned for use by the right hand side.
+ *
+ * The c_visc array is synchronized at halo cells on entry, as with
+ * cs_face_viscosity.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_fused(int               iconvp,
+                               int               idiffp,
+                               int               ndircp,
+                               int               isym,
+                               double            thetap,
+                               int               imucpp,
+                               int               visc_mean_type,
+                               const cs_real_t   coefbp[],
+                               const cs_real_t   cofbfp[],
+                               const cs_real_t   rovsdt[],
+                               const cs_real_t   i_massflux[],
+                               const cs_real_t   b_massflux[],
+                               cs_real_t         c_visc[],
+                               const cs_real_t   xcpp[],
+                               cs_real_t         i_visc[],
+                               cs_real_t         b_visc[],
+                               cs_real_t         da[],
+                               cs_real_t         xa[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_vector (or its counterpart for
  * symmetric matrices)
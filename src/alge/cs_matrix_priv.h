@@ -55,6 +55,7 @@ BEGIN_C_DECLS
  *  - Compressed Sparse Row (CSR)
  *  - Modified Compressed Sparse Row (MSR), with separate diagonal
  *  - Symmetric Compressed Sparse Row (CSR_SYM)
+ *  - Sliced ELLPACK (SELL), with separate diagonal
  */
 
 /*----------------------------------------------------------------------------
@@ -233,8 +234,62 @@ typedef struct _cs_matrix_coeff_msr_t {
   cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
   cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients */
 
+  /* Optional single-precision coefficient copies, built on demand
+     for the matching SpMV variant (NULL if unused or out of date) */
+
+  float            *d_val_sp;         /* Diagonal matrix coefficients */
+  float            *x_val_sp;         /* Extra-diagonal matrix coefficients */
+
 } cs_matrix_coeff_msr_t;
 
+/* SELL (Sliced ELLPACK) matrix structure representation */
+/*-------------------------------------------------------*/
+
+/* Rows are grouped in slices of fixed height; inside a slice, entries
+   are stored column-major (position-interleaved across rows), padded
+   to the largest row size of the slice, so that consecutive entries
+   of a given position belong to consecutive rows. As with MSR, the
+   diagonal is stored separately. */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_lnum_t         n_rows;           /* Local number of rows */
+  cs_lnum_t         n_cols_ext;       /* Local number of columns + ghosts */
+
+  cs_lnum_t         slice_size;       /* Number of rows per slice */
+  cs_lnum_t         n_slices;         /* Number of slices
+                                         (ceil(n_rows/slice_size)) */
+
+  bool              direct_assembly;  /* True if each value corresponds to
+                                         a unique face ; false if multiple
+                                         faces contribute to the same
+                                         value (i.e. we have split faces) */
+
+  cs_lnum_t        *slice_index;      /* Start of each slice in col_id
+                                         and in the values array
+                                         (size: n_slices + 1) */
+  cs_lnum_t        *col_id;           /* Column ids, padded (unused entries
+                                         set to 0, with zero coefficients) */
+
+} cs_matrix_struct_sell_t;
+
+/* SELL matrix coefficients representation */
+/*-----------------------------------------*/
+
+typedef struct _cs_matrix_coeff_sell_t {
+
+  /* Pointers to possibly shared arrays */
+
+  const cs_real_t  *d_val;            /* Diagonal matrix coefficients */
+
+  /* Pointers to private arrays (NULL if shared) */
+
+  cs_real_t        *_d_val;           /* Diagonal matrix coefficients */
+  cs_real_t        *_x_val;           /* Extra-diagonal matrix coefficients,
+                                         in slice-interleaved order */
+
+} cs_matrix_coeff_sell_t;
+
 /* Matrix structure (representation-independent part) */
 /*----------------------------------------------------*/
 
@@ -308,6 +363,14 @@ struct _cs_matrix_t {
 
   const cs_real_t      *xa;            /* Extra-diagonal terms */
 
+  /* Partition of rows into halo-independent and halo-dependent sets,
+     for overlap of computation and communication (built lazily when
+     an overlapped matrix.vector product is first used) */
+
+  cs_lnum_t              n_h_rows;     /* Number of halo-dependent rows,
+                                          or -1 if not computed yet */
+  cs_lnum_t             *h_row_id;     /* Halo-dependent row ids, or NULL */
+
   /* Pointer to private data */
 
   void                  *coeffs;       /* Matrix coefficients */
@@ -126,6 +126,13 @@ static const char *_matrix_fill_name[CS_MATRIX_N_FILL_TYPES]
      N_("block 3 diagonal symmetric"),
      N_("block 3")};
 
+/* Name and format version of the tuning results cache file, in the
+   case's execution directory */
+
+static const char _tuning_cache_file_name[] = "matrix_tuning.dat";
+
+static const int _tuning_cache_version = 1;
+
 static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
   = {{N_("y <- A.x"),
       N_("y <- (A-D).x")},
@@ -667,6 +674,258 @@ _variant_init(cs_matrix_variant_t  *v)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Attempt to restore matrix tuning results from the tuning cache file.
+ *
+ * The cache is keyed by global mesh size, rank and thread counts, and the
+ * number of available variants, so cached results are only used when they
+ * match the current run's configuration; selected variants are identified
+ * by their index in the (deterministic) variant list.
+ *
+ * parameters:
+ *   n_variants   <-- number of variants in list
+ *   m_variant    <-- array of matrix variants
+ *   n_fill_types <-- number of fill types tuned for
+ *   fill_types   <-- array of fill types tuned for
+ *   n_cells      <-- number of local cells
+ *   n_faces      <-- local number of internal faces
+ *
+ * returns:
+ *   pointer to restored tuning results, or NULL if no usable cache
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_variant_t *
+_matrix_tune_restore(int                          n_variants,
+                     const cs_matrix_variant_t   *m_variant,
+                     int                          n_fill_types,
+                     const cs_matrix_fill_type_t  fill_types[],
+                     cs_lnum_t                    n_cells,
+                     cs_lnum_t                    n_faces)
+{
+  int i;
+
+  const int n_rec = 1 + CS_MATRIX_N_FILL_TYPES*2;
+
+  int rec[1 + CS_MATRIX_N_FILL_TYPES*2];
+  int header_ok = 0, valid = 1;
+  int *rec_all = NULL;
+
+  cs_matrix_variant_t  *r = NULL;
+
+  cs_gnum_t key_loc[2] = {(cs_gnum_t)n_cells, (cs_gnum_t)n_faces};
+  cs_gnum_t key[2] = {key_loc[0], key_loc[1]};
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(key_loc, key, 2, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+#endif
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(_tuning_cache_file_name, "r");
+
+    if (f != NULL) {
+
+      int version = -1, n_ranks = -1, n_threads = -1;
+      int f_n_variants = -1, f_n_fill_types = -1;
+      unsigned long long n_g_cells = 0, n_g_faces = 0;
+
+      if (   fscanf(f, "cs_matrix_tuning %d", &version) == 1
+          && version == _tuning_cache_version
+          && fscanf(f, "%d %d %llu %llu %d %d",
+                    &n_ranks, &n_threads, &n_g_cells, &n_g_faces,
+                    &f_n_variants, &f_n_fill_types) == 6
+          && n_ranks == cs_glob_n_ranks
+          && n_threads == cs_glob_n_threads
+          && n_g_cells == (unsigned long long)key[0]
+          && n_g_faces == (unsigned long long)key[1]
+          && f_n_variants == n_variants
+          && f_n_fill_types == n_fill_types) {
+
+        header_ok = 1;
+
+        for (i = 0; i < n_fill_types && header_ok; i++) {
+          int fill_id = -1;
+          if (   fscanf(f, "%d", &fill_id) != 1
+              || fill_id != (int)fill_types[i])
+            header_ok = 0;
+        }
+
+        if (header_ok) {
+          const int n_vals = CS_MAX(cs_glob_n_ranks, 1) * n_rec;
+          BFT_MALLOC(rec_all, n_vals, int);
+          for (i = 0; i < n_vals; i++) {
+            if (fscanf(f, "%d", rec_all + i) != 1) {
+              header_ok = 0;
+              break;
+            }
+          }
+        }
+
+      }
+
+      fclose(f);
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Bcast(&header_ok, 1, MPI_INT, 0, cs_glob_mpi_comm);
+    if (header_ok)
+      MPI_Scatter(rec_all, n_rec, MPI_INT, rec, n_rec, MPI_INT,
+                  0, cs_glob_mpi_comm);
+  }
+#endif
+
+  if (header_ok && cs_glob_n_ranks == 1)
+    memcpy(rec, rec_all, n_rec*sizeof(int));
+
+  BFT_FREE(rec_all);
+
+  if (!header_ok)
+    return NULL;
+
+  /* Check local records, and agree on validity across all ranks */
+
+  if (rec[0] < 0 || rec[0] >= CS_MATRIX_N_TYPES)
+    valid = 0;
+
+  for (i = 1; i < n_rec; i++) {
+    if (rec[i] < -1 || rec[i] >= n_variants)
+      valid = 0;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int valid_loc = valid;
+    MPI_Allreduce(&valid_loc, &valid, 1, MPI_INT, MPI_MIN, cs_glob_mpi_comm);
+  }
+#endif
+
+  if (!valid)
+    return NULL;
+
+  /* Build tuned variant from restored selection */
+
+  BFT_MALLOC(r, 1, cs_matrix_variant_t);
+
+  _variant_init(r);
+
+  strncpy(r->name, cs_matrix_type_name[rec[0]], 31);
+  r->name[31] = '\0';
+  r->type = (cs_matrix_type_t)rec[0];
+
+  for (cs_matrix_fill_type_t fill_type = 0;
+       fill_type < CS_MATRIX_N_FILL_TYPES;
+       fill_type++) {
+    for (int ed_flag = 0; ed_flag < 2; ed_flag++) {
+      int v_id = rec[1 + fill_type*2 + ed_flag];
+      if (v_id > -1)
+        r->vector_multiply[fill_type][ed_flag]
+          = m_variant[v_id].vector_multiply[fill_type][ed_flag];
+    }
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Matrix tuning results restored from file: %s\n"),
+                _tuning_cache_file_name);
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------
+ * Save matrix tuning results to the tuning cache file.
+ *
+ * Per-rank selections are gathered to rank 0, which writes the file in
+ * the case's execution directory; failure to write the file is silently
+ * ignored, as the cache is only a time-saving feature.
+ *
+ * parameters:
+ *   type_id      <-- selected matrix type id
+ *   cur_select   <-- per fill type and diagonal exclusion flag,
+ *                    selected variant id in list, or -1
+ *   n_variants   <-- number of variants in list
+ *   n_fill_types <-- number of fill types tuned for
+ *   fill_types   <-- array of fill types tuned for
+ *   n_cells      <-- number of local cells
+ *   n_faces      <-- local number of internal faces
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_tune_save(int                          type_id,
+                  int                          cur_select[][2],
+                  int                          n_variants,
+                  int                          n_fill_types,
+                  const cs_matrix_fill_type_t  fill_types[],
+                  cs_lnum_t                    n_cells,
+                  cs_lnum_t                    n_faces)
+{
+  int i;
+
+  const int n_rec = 1 + CS_MATRIX_N_FILL_TYPES*2;
+
+  int rec[1 + CS_MATRIX_N_FILL_TYPES*2];
+  int *rec_all = NULL;
+
+  cs_gnum_t key_loc[2] = {(cs_gnum_t)n_cells, (cs_gnum_t)n_faces};
+  cs_gnum_t key[2] = {key_loc[0], key_loc[1]};
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(key_loc, key, 2, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+#endif
+
+  rec[0] = type_id;
+  for (i = 1; i < n_rec; i++)
+    rec[i] = -1;
+
+  for (i = 0; i < n_fill_types; i++) {
+    for (int ed_flag = 0; ed_flag < 2; ed_flag++)
+      rec[1 + fill_types[i]*2 + ed_flag] = cur_select[i][ed_flag];
+  }
+
+  if (cs_glob_rank_id < 1)
+    BFT_MALLOC(rec_all, CS_MAX(cs_glob_n_ranks, 1)*n_rec, int);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Gather(rec, n_rec, MPI_INT, rec_all, n_rec, MPI_INT,
+               0, cs_glob_mpi_comm);
+#endif
+
+  if (cs_glob_n_ranks == 1)
+    memcpy(rec_all, rec, n_rec*sizeof(int));
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(_tuning_cache_file_name, "w");
+
+    if (f != NULL) {
+
+      fprintf(f, "cs_matrix_tuning %d\n", _tuning_cache_version);
+      fprintf(f, "%d %d %llu %llu %d %d\n",
+              cs_glob_n_ranks, cs_glob_n_threads,
+              (unsigned long long)key[0], (unsigned long long)key[1],
+              n_variants, n_fill_types);
+
+      for (i = 0; i < n_fill_types; i++)
+        fprintf(f, "%d ", (int)fill_types[i]);
+      fprintf(f, "\n");
+
+      for (int rank_id = 0; rank_id < CS_MAX(cs_glob_n_ranks, 1); rank_id++) {
+        for (i = 0; i < n_rec; i++)
+          fprintf(f, "%d ", rec_all[rank_id*n_rec + i]);
+        fprintf(f, "\n");
+      }
+
+      fclose(f);
+    }
+  }
+
+  BFT_FREE(rec_all);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -730,6 +989,7 @@ cs_matrix_variant_tuned(double                 t_measure,
   int cur_select[CS_MATRIX_N_FILL_TYPES][2];
 
   bool                   type_filter[CS_MATRIX_N_TYPES] = {true,
+                                                           true,
                                                            true,
                                                            true,
                                                            true};
@@ -791,6 +1051,21 @@ cs_matrix_variant_tuned(double                 t_measure,
                                &n_variants,
                                &m_variant);
 
+  /* If a usable tuning cache from a previous run of the same case is
+     present, restore its results rather than re-run the benchmark loop */
+
+  r = _matrix_tune_restore(n_variants,
+                           m_variant,
+                           _n_fill_types,
+                           _fill_types,
+                           n_cells,
+                           n_faces);
+
+  if (r != NULL) {
+    BFT_FREE(m_variant);
+    return r;
+  }
+
   /* Run tests on variants */
 
   _matrix_tune_test(t_measure,
@@ -924,6 +1199,16 @@ cs_matrix_variant_tuned(double                 t_measure,
 
   } /* End of loop on variants */
 
+  /* Save selection to the tuning cache for future runs of this case */
+
+  _matrix_tune_save(t_id_max,
+                    cur_select,
+                    n_variants,
+                    _n_fill_types,
+                    _fill_types,
+                    n_cells,
+                    n_faces);
+
   /* print info on selected variants */
 
   cs_log_printf(CS_LOG_PERFORMANCE,
@@ -248,6 +248,18 @@ struct _cs_multigrid_t {
 
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
 
+  int        merge_stride;       /* Rank multiple over which coarse grids
+                                    below the row thresholds are gathered
+                                    on a rank subset (1: no gathering) */
+  int        merge_rows_mean_threshold; /* mean number of rows per rank
+                                           under which gathering occurs */
+  cs_gnum_t  merge_rows_glob_threshold; /* global number of rows under
+                                           which gathering occurs */
+
+  bool       reuse_hierarchy;    /* If true, try to keep the grid hierarchy
+                                    (coarsening) across successive setups,
+                                    refreshing only matrix coefficients */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -287,6 +299,12 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  /* Grid hierarchy saved between setups when reuse_hierarchy is set */
+
+  unsigned                    n_saved_levels;   /* number of saved levels */
+  cs_grid_t                 **saved_hierarchy;  /* saved grid hierarchy,
+                                                   or NULL */
+
   char                       *plot_base_name;   /* base plot name, or NULL */
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   cs_time_plot_t            **sles_it_plot;     /* plotting if smoothers */
@@ -417,6 +435,16 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 mg->n_levels_max, (unsigned long long)(mg->n_g_rows_min),
                 mg->p0p1_relax, mg->info.n_max_cycles);
 
+  if (mg->merge_stride > 1)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse grid gathering:\n"
+                    "    Rank stride:                     %d\n"
+                    "    Mean rows per rank threshold:    %d\n"
+                    "    Global rows threshold:           %llu\n"),
+                  mg->merge_stride,
+                  mg->merge_rows_mean_threshold,
+                  (unsigned long long)(mg->merge_rows_glob_threshold));
+
   cs_log_printf(CS_LOG_SETUP,
                 _("  Cycle type:                        %s\n"),
                 _(cs_multigrid_type_name[mg->type]));
@@ -1263,6 +1291,136 @@ _multigrid_setup_sles_it(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy grid hierarchy saved for reuse between setups, if present.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid solver info and context
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_destroy_saved_hierarchy(cs_multigrid_t  *mg)
+{
+  if (mg->saved_hierarchy != NULL) {
+    for (int i = mg->n_saved_levels - 1; i > -1; i--)
+      cs_grid_destroy(mg->saved_hierarchy + i);
+    BFT_FREE(mg->saved_hierarchy);
+    mg->n_saved_levels = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Setup multigrid solver using a grid hierarchy saved by a previous setup.
+ *
+ * The coarsening is kept unchanged, and only matrix coefficients are
+ * refreshed, level by level, from the new system matrix.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid solver info and context
+ *   name      <-- linear system name
+ *   a         <-- associated matrix
+ *   a_conv    <-- associated matrix (convection)
+ *   a_diff    <-- associated matrix (diffusion)
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   true in case of success, false if the saved hierarchy could not be
+ *   reused (in which case the caller should destroy it and run the
+ *   standard setup)
+ *----------------------------------------------------------------------------*/
+
+static bool
+_multigrid_setup_reuse(cs_multigrid_t     *mg,
+                       const char         *name,
+                       const cs_matrix_t  *a,
+                       const cs_matrix_t  *a_conv,
+                       const cs_matrix_t  *a_diff,
+                       int                 verbosity)
+{
+  cs_timer_t t0, t1, t2;
+
+  t0 = cs_timer_time();
+
+  if (   mg->reuse_hierarchy == false
+      || mg->n_saved_levels < 1
+      || cs_grid_get_merge_stride() > 1)
+    return false;
+
+  if (verbosity > 1)
+    bft_printf(_("\n Reuse of grid hierarchy for \"%s\"\n"),
+               name);
+
+  /* Refresh coefficients, level by level */
+
+  if (cs_grid_update_from_shared(mg->saved_hierarchy[0],
+                                 a,
+                                 a_conv,
+                                 a_diff) == false)
+    return false;
+
+  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->lv_info->t_tot[0]), &t0, &t1);
+
+  for (unsigned i = 1; i < mg->n_saved_levels; i++) {
+
+    if (cs_grid_refresh_coarse_matrix(mg->saved_hierarchy[i-1],
+                                      mg->saved_hierarchy[i],
+                                      verbosity) == false)
+      return false;
+
+    t2 = cs_timer_time();
+    cs_timer_counter_add_diff(&(mg->lv_info[i].t_tot[0]), &t1, &t2);
+    t1 = t2;
+
+  }
+
+  /* Adopt saved hierarchy */
+
+  mg->setup_data = _multigrid_setup_data_create();
+
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  mgd->grid_hierarchy = mg->saved_hierarchy;
+  mgd->n_levels = mg->n_saved_levels;
+  mgd->n_levels_alloc = mg->n_saved_levels;
+
+  BFT_MALLOC(mgd->sles_hierarchy, mgd->n_levels_alloc*2, cs_sles_it_t *);
+
+  mg->saved_hierarchy = NULL;
+  mg->n_saved_levels = 0;
+
+  /* Update info */
+
+  int grid_lv = mgd->n_levels - 1;
+
+  mg->info.n_levels_tot += grid_lv;
+  mg->info.n_levels[0] = grid_lv;
+
+  if (mg->info.n_calls[0] > 0) {
+    if (mg->info.n_levels[0] < mg->info.n_levels[1])
+      mg->info.n_levels[1] = mg->info.n_levels[0];
+    if (mg->info.n_levels[0] > mg->info.n_levels[2])
+      mg->info.n_levels[2] = mg->info.n_levels[0];
+  }
+  else {
+    mg->info.n_levels[1] = mg->info.n_levels[0];
+    mg->info.n_levels[2] = mg->info.n_levels[0];
+  }
+
+  mg->info.n_calls[0] += 1;
+
+  /* Setup solvers */
+
+  _multigrid_setup_sles_it(mg, name, verbosity);
+
+  /* Update timers */
+
+  t2 = cs_timer_time();
+  cs_timer_counter_add_diff(&(mg->info.t_tot[0]), &t0, &t2);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute dot product, summing result over all ranks.
  *
@@ -2897,6 +3055,25 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->p0p1_relax = 0.95;
 
+  /* Coarse grids keeping the fine level's rank distribution end up with
+     a few rows per rank, so their smoothing is latency-dominated; on large
+     rank counts, gathering them on a rank subset is activated by default. */
+
+  {
+    int cells_mean_threshold;
+    cs_gnum_t cells_glob_threshold;
+    cs_grid_get_merge_options(&(mg->merge_stride),
+                              &cells_mean_threshold,
+                              &cells_glob_threshold,
+                              NULL);
+    mg->merge_rows_mean_threshold = cells_mean_threshold;
+    mg->merge_rows_glob_threshold = cells_glob_threshold;
+  }
+  if (mg->merge_stride < 2 && cs_glob_n_ranks > 512)
+    mg->merge_stride = 4;
+
+  mg->reuse_hierarchy = false;
+
   _multigrid_info_init(&(mg->info));
 
   if (mg->type == CS_MULTIGRID_K_CYCLE) {
@@ -2916,6 +3093,9 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->setup_data = NULL;
 
+  mg->n_saved_levels = 0;
+  mg->saved_hierarchy = NULL;
+
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
   for (ii = 0; ii < mg->n_levels_max; ii++)
@@ -2985,6 +3165,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  _multigrid_destroy_saved_hierarchy(mg);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != NULL) {
@@ -3115,6 +3297,79 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
   mg->p0p1_relax = p0p1_relax;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set coarse grid gathering options for a multigrid solver.
+ *
+ * Coarse levels keep the fine level's rank distribution until they fall
+ * below the given row thresholds, at which point they are redistributed
+ * on a subset of ranks (1 rank every \c rank_stride), so that the
+ * latency of coarse level smoothing and reduction operations does not
+ * dominate cycle cost on large rank counts. On ranks left without rows,
+ * cycling simply proceeds to the next level handled locally.
+ *
+ * By default, gathering is active with a rank stride of 4 when running
+ * on more than 512 ranks, and inactive otherwise.
+ *
+ * \param[in, out]  mg                    pointer to multigrid info
+ *                                        and context
+ * \param[in]       rank_stride           number of ranks over which grids
+ *                                        are gathered (1: no gathering)
+ * \param[in]       rows_mean_threshold   mean number of rows per rank under
+ *                                        which gathering should be applied
+ * \param[in]       rows_glob_threshold   global number of rows under which
+ *                                        gathering should be applied
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
+                               int              rank_stride,
+                               int              rows_mean_threshold,
+                               cs_gnum_t        rows_glob_threshold)
+{
+  if (mg == NULL)
+    return;
+
+  mg->merge_stride = rank_stride;
+  if (mg->merge_stride > cs_glob_n_ranks)
+    mg->merge_stride = cs_glob_n_ranks;
+  mg->merge_rows_mean_threshold = rows_mean_threshold;
+  mg->merge_rows_glob_threshold = rows_glob_threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the grid hierarchy reuse (freeze) behavior.
+ *
+ * If activated, the grid hierarchy (coarsening) built by a setup operation
+ * is kept across subsequent setups, and only matrix coefficients are
+ * refreshed. This saves most of the setup cost when the mesh and matrix
+ * structure do not change between time steps, at the expense of additional
+ * memory to retain the coarsening data between setups.
+ *
+ * If the structure of the system matrix changes, or grid merging
+ * (see \ref cs_grid_set_merge_options) is active, a full rebuild of the
+ * hierarchy occurs automatically.
+ *
+ * \param[in, out]  mg     pointer to multigrid info and context
+ * \param[in]       reuse  true to reuse the grid hierarchy across setups
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_hierarchy_reuse(cs_multigrid_t  *mg,
+                                 bool             reuse)
+{
+  if (mg == NULL)
+    return;
+
+  mg->reuse_hierarchy = reuse;
+
+  if (reuse == false)
+    _multigrid_destroy_saved_hierarchy(mg);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set multigrid parameters for associated iterative solvers.
@@ -3190,6 +3445,8 @@ cs_multigrid_set_solver_options(cs_multigrid_t     *mg,
     case CS_SLES_JACOBI:
     case CS_SLES_P_GAUSS_SEIDEL:
     case CS_SLES_P_SYM_GAUSS_SEIDEL:
+    case CS_SLES_P_MC_GAUSS_SEIDEL:
+    case CS_SLES_P_MC_SYM_GAUSS_SEIDEL:
       info->poly_degree[i] = -1;
       break;
     default:
@@ -3289,6 +3546,16 @@ cs_multigrid_setup_conv_diff(void               *context,
   if (mg->setup_data != NULL)
     cs_multigrid_free(mg);
 
+  /* Attempt to reuse a hierarchy saved by a previous setup, refreshing
+     only matrix coefficients; if this fails (changed structure or
+     missing data), fall through to a full rebuild */
+
+  if (mg->saved_hierarchy != NULL) {
+    if (_multigrid_setup_reuse(mg, name, a, a_conv, a_diff, verbosity))
+      return;
+    _multigrid_destroy_saved_hierarchy(mg);
+  }
+
   /* Initialization */
 
   t0 = cs_timer_time();
@@ -3302,6 +3569,18 @@ cs_multigrid_setup_conv_diff(void               *context,
   /* Build coarse grids hierarchy */
   /*------------------------------*/
 
+  /* Apply this solver's coarse grid gathering options (the matching
+     cs_grid settings are global, so they are pushed before each setup) */
+
+  {
+    int min_ranks;
+    cs_grid_get_merge_options(NULL, NULL, NULL, &min_ranks);
+    cs_grid_set_merge_options(mg->merge_stride,
+                              mg->merge_rows_mean_threshold,
+                              mg->merge_rows_glob_threshold,
+                              min_ranks);
+  }
+
   bool symmetric = cs_matrix_is_symmetric(a);
   const int *diag_block_size = cs_matrix_get_diag_block_size(a);
   const int *extra_diag_block_size = cs_matrix_get_extra_diag_block_size(a);
@@ -3537,10 +3816,13 @@ cs_multigrid_setup_conv_diff(void               *context,
 
   mg->info.n_calls[0] += 1;
 
-  /* Cleanup temperary interpolation arrays */
+  /* Cleanup temperary interpolation arrays, unless they may be needed
+     later for a coefficient-only refresh of a reused hierarchy */
 
-  for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
-    cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  if (mg->reuse_hierarchy == false) {
+    for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
+      cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
+  }
 
   /* Setup solvers */
 
@@ -3770,11 +4052,18 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
-    /* Destroy grid hierarchy */
+    /* Destroy grid hierarchy, or save it for possible reuse by the
+       next setup (coefficient-only refresh) */
 
-    for (int i = mgd->n_levels - 1; i > -1; i--)
-      cs_grid_destroy(mgd->grid_hierarchy + i);
-    BFT_FREE(mgd->grid_hierarchy);
+    if (mg->reuse_hierarchy && mg->saved_hierarchy == NULL) {
+      mg->saved_hierarchy = mgd->grid_hierarchy;
+      mg->n_saved_levels = mgd->n_levels;
+    }
+    else {
+      for (int i = mgd->n_levels - 1; i > -1; i--)
+        cs_grid_destroy(mgd->grid_hierarchy + i);
+      BFT_FREE(mgd->grid_hierarchy);
+    }
 
     /* Destroy peconditioning-only arrays */
 
@@ -202,6 +202,55 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
                                     double           p0p1_relax,
                                     int              postprocess_block_size);
 
+/*----------------------------------------------------------------------------
+ * Set coarse grid gathering options for a multigrid solver.
+ *
+ * Coarse levels keep the fine level's rank distribution until they fall
+ * below the given row thresholds, at which point they are redistributed
+ * on a subset of ranks (1 rank every rank_stride), so that the latency
+ * of coarse level smoothing and reduction operations does not dominate
+ * cycle cost on large rank counts.
+ *
+ * By default, gathering is active with a rank stride of 4 when running
+ * on more than 512 ranks, and inactive otherwise.
+ *
+ * parameters:
+ *   mg                  <-> pointer to multigrid info and context
+ *   rank_stride         <-- number of ranks over which grids are gathered
+ *                           (1: no gathering)
+ *   rows_mean_threshold <-- mean number of rows per rank under which
+ *                           gathering should be applied
+ *   rows_glob_threshold <-- global number of rows under which gathering
+ *                           should be applied
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_merge_options(cs_multigrid_t  *mg,
+                               int              rank_stride,
+                               int              rows_mean_threshold,
+                               cs_gnum_t        rows_glob_threshold);
+
+/*----------------------------------------------------------------------------
+ * Set the grid hierarchy reuse (freeze) behavior.
+ *
+ * If activated, the grid hierarchy (coarsening) built by a setup operation
+ * is kept across subsequent setups, and only matrix coefficients are
+ * refreshed. This saves most of the setup cost when the mesh and matrix
+ * structure do not change between time steps, at the expense of additional
+ * memory to retain the coarsening data between setups.
+ *
+ * If the structure of the system matrix changes, or grid merging is
+ * active, a full rebuild of the hierarchy occurs automatically.
+ *
+ * parameters:
+ *   mg    <-> pointer to multigrid info and context
+ *   reuse <-- true to reuse the grid hierarchy across setups
+ *----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_hierarchy_reuse(cs_multigrid_t  *mg,
+                                 bool             reuse);
+
 /*----------------------------------------------------------------------------
  * Set multigrid parameters for associated iterative solvers.
  *
@@ -302,6 +302,30 @@ typedef struct {
 
 } cs_sles_post_t;
 
+/* Initial guess extrapolation from previous solutions */
+/*-----------------------------------------------------*/
+
+#define CS_SLES_GUESS_N_MAX 4   /* maximum number of stored solutions */
+
+typedef struct {
+
+  int          n_prev;      /* number of stored previous solutions */
+  int          n_valid;     /* number of currently valid solutions */
+  int          head;        /* ring buffer index of most recent solution */
+
+  int          order;       /* currently preferred extrapolation order */
+  int          n_solves;    /* number of solves since activation */
+
+  double       iter_sum[CS_SLES_GUESS_N_MAX];  /* cumulative iterations
+                                                  per candidate order */
+  int          iter_wt[CS_SLES_GUESS_N_MAX];   /* samples per candidate
+                                                  order */
+
+  cs_lnum_t    n_vals;      /* size of each stored solution */
+  cs_real_t   *vals;        /* ring buffer (n_prev * n_vals) */
+
+} cs_sles_guess_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -327,6 +351,8 @@ struct _cs_sles_t {
 
   cs_sles_setup_t          *setup_func;    /* solver setup function */
   cs_sles_solve_t          *solve_func;    /* solve function */
+  cs_sles_solve_multi_t    *solve_multi_func;  /* optional batched
+                                                  multi-RHS solve function */
   cs_sles_free_t           *free_func;     /* free setup function */
 
   cs_sles_log_t            *log_func;      /* logging function */
@@ -339,6 +365,9 @@ struct _cs_sles_t {
 
   cs_sles_post_t           *post_info;     /* postprocessing info */
 
+  cs_sles_guess_t          *guess_info;    /* initial guess extrapolation
+                                              info, or NULL */
+
 };
 
 /*============================================================================
@@ -413,6 +442,7 @@ _sles_create(int          f_id,
   sles->context = NULL;
   sles->setup_func = NULL;
   sles->solve_func = NULL;
+  sles->solve_multi_func = NULL;
   sles->free_func = NULL;
   sles->log_func = NULL;
   sles->copy_func = NULL;
@@ -423,6 +453,7 @@ _sles_create(int          f_id,
   sles->n_no_op = 0;
 
   sles->post_info = NULL;
+  sles->guess_info = NULL;
 
   return sles;
 }
@@ -775,6 +806,147 @@ _value_type(size_t     n_vals,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Replace the initial guess by a polynomial extrapolation of previously
+ * stored solutions.
+ *
+ * The extrapolation order actually used is returned, and is based both
+ * on the number of valid stored solutions and on the iteration counts
+ * observed with the different candidate orders (order 0 simply reuses
+ * the most recent solution); every 16th solve, a round-robin candidate
+ * is probed instead, so the selection may adapt to the simulation.
+ *
+ * parameters
+ *   g  <-> initial guess extrapolation info
+ *   a  <-- matrix
+ *   vx <-> system solution (initial guess on entry)
+ *
+ * returns:
+ *   extrapolation order used, or -1 if the guess was left unchanged
+ *----------------------------------------------------------------------------*/
+
+static int
+_guess_apply(cs_sles_guess_t    *g,
+             const cs_matrix_t  *a,
+             cs_real_t          *vx)
+{
+  /* Extrapolation coefficients for polynomials of degree 0 to 3
+     through the most recent solutions, assuming uniform steps */
+
+  static const cs_real_t c[CS_SLES_GUESS_N_MAX][CS_SLES_GUESS_N_MAX]
+    = {{ 1.,  0.,  0.,  0.},
+       { 2., -1.,  0.,  0.},
+       { 3., -3.,  1.,  0.},
+       { 4., -6.,  4., -1.}};
+
+  const int *diag_block_size = cs_matrix_get_diag_block_size(a);
+
+  if (   g->n_valid < 1
+      || g->n_vals != cs_matrix_get_n_rows(a) * diag_block_size[1])
+    return -1;
+
+  int order_max = CS_MIN(g->n_valid, g->n_prev) - 1;
+
+  int order = g->order;
+
+  if (g->n_solves % 16 == 15)  /* periodic probing */
+    order = (g->n_solves / 16) % (order_max + 1);
+
+  order = CS_MIN(order, order_max);
+
+  const cs_lnum_t n_vals = g->n_vals;
+
+# pragma omp parallel for  if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    cs_real_t s = 0.;
+    for (int j = 0; j < order + 1; j++) {
+      const cs_real_t *x_j
+        = g->vals + (cs_lnum_t)((g->head + g->n_prev - j) % g->n_prev)*n_vals;
+      s += c[order][j] * x_j[i];
+    }
+    vx[i] = s;
+  }
+
+  return order;
+}
+
+/*----------------------------------------------------------------------------
+ * Store a newly computed solution in the initial guess history, and
+ * update the extrapolation order statistics.
+ *
+ * In case of solver error, the history is invalidated instead, as the
+ * error handler may have modified the solution.
+ *
+ * parameters
+ *   g      <-> initial guess extrapolation info
+ *   a      <-- matrix
+ *   vx     <-- system solution
+ *   order  <-- extrapolation order used, or -1
+ *   n_iter <-- number of iterations of associated solve
+ *   state  <-- convergence state of associated solve
+ *----------------------------------------------------------------------------*/
+
+static void
+_guess_update(cs_sles_guess_t              *g,
+              const cs_matrix_t            *a,
+              const cs_real_t              *vx,
+              int                           order,
+              int                           n_iter,
+              cs_sles_convergence_state_t   state)
+{
+  const int *diag_block_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_vals = cs_matrix_get_n_rows(a) * diag_block_size[1];
+
+  if (n_vals != g->n_vals) {  /* first call, or mesh/system change */
+    BFT_REALLOC(g->vals, n_vals*g->n_prev, cs_real_t);
+    g->n_vals = n_vals;
+    g->n_valid = 0;
+    g->head = 0;
+  }
+
+  if (state < CS_SLES_ITERATING) {
+    g->n_valid = 0;
+    return;
+  }
+
+  /* Update iteration statistics for the order used, with periodic
+     halving so the selection can follow the simulation's behavior */
+
+  if (order >= 0) {
+    g->iter_sum[order] += n_iter;
+    g->iter_wt[order] += 1;
+    if (g->iter_wt[order] >= 64) {
+      g->iter_sum[order] *= 0.5;
+      g->iter_wt[order] /= 2;
+    }
+
+    int best = g->order;
+    double best_mean = HUGE_VAL;
+    for (int i = 0; i < g->n_prev; i++) {
+      if (g->iter_wt[i] > 0) {
+        double mean = g->iter_sum[i] / g->iter_wt[i];
+        if (mean < best_mean) {
+          best = i;
+          best_mean = mean;
+        }
+      }
+    }
+    g->order = best;
+  }
+
+  g->n_solves += 1;
+
+  /* Store solution */
+
+  g->head = (g->head + 1) % g->n_prev;
+  memcpy(g->vals + (cs_lnum_t)(g->head)*n_vals,
+         vx,
+         n_vals*sizeof(cs_real_t));
+
+  if (g->n_valid < g->n_prev)
+    g->n_valid += 1;
+}
+
 /*----------------------------------------------------------------------------
  * Ensure array for postprocessing output of residuals is allocated
  *
@@ -921,6 +1093,10 @@ cs_sles_finalize(void)
           BFT_FREE(sles->post_info->row_residual);
           BFT_FREE(sles->post_info);
         }
+        if (sles->guess_info != NULL) {
+          BFT_FREE(sles->guess_info->vals);
+          BFT_FREE(sles->guess_info);
+        }
         BFT_FREE(sles->_name);
         BFT_FREE(_cs_sles_systems[i][j]);
       }
@@ -1309,6 +1485,7 @@ cs_sles_define(int                 f_id,
   sles->context = context;
   sles->setup_func = setup_func;
   sles->solve_func = solve_func;
+  sles->solve_multi_func = NULL;
   sles->free_func = free_func;
   sles->log_func = log_func;
   sles->copy_func = copy_func;
@@ -1408,6 +1585,61 @@ cs_sles_get_post_output(cs_sles_t  *sles)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate extrapolation of the initial guess from
+ *        previous solutions for a given linear equation solver.
+ *
+ * When active, the last \c n_prev solutions are stored, and each solve
+ * starts from a polynomial extrapolation of those solutions instead of
+ * the caller-provided initial guess, with the extrapolation order
+ * selected automatically based on observed iteration counts.
+ *
+ * This is only useful for systems solved repeatedly over time steps
+ * whose successive solutions are strongly correlated (such as pressure
+ * or potential corrections), and should not be used where the initial
+ * guess has a specific meaning for the caller.
+ *
+ * By default, extrapolation is not activated.
+ *
+ * \param[in, out]  sles    pointer to solver object
+ * \param[in]       n_prev  number of previous solutions stored
+ *                          (0 to 4, 0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_guess_extrapolation(cs_sles_t  *sles,
+                                int         n_prev)
+{
+  if (n_prev <= 0) {
+    if (sles->guess_info != NULL) {
+      BFT_FREE(sles->guess_info->vals);
+      BFT_FREE(sles->guess_info);
+    }
+    return;
+  }
+
+  if (sles->guess_info == NULL) {
+    BFT_MALLOC(sles->guess_info, 1, cs_sles_guess_t);
+    sles->guess_info->vals = NULL;
+  }
+
+  cs_sles_guess_t *g = sles->guess_info;
+
+  g->n_prev = CS_MIN(n_prev, CS_SLES_GUESS_N_MAX);
+  g->n_valid = 0;
+  g->head = 0;
+  g->order = 0;
+  g->n_solves = 0;
+  for (int i = 0; i < CS_SLES_GUESS_N_MAX; i++) {
+    g->iter_sum[i] = 0.;
+    g->iter_wt[i] = 0;
+  }
+  g->n_vals = 0;
+  BFT_FREE(g->vals);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return type name of solver context.
@@ -1601,6 +1833,10 @@ cs_sles_solve(cs_sles_t           *sles,
 
   cs_sles_convergence_state_t state;
 
+  int guess_order = -1;
+  if (sles->guess_info != NULL)
+    guess_order = _guess_apply(sles->guess_info, a, vx);
+
   bool do_solve = _needs_solving(sles_name,
                                  a,
                                  sles->verbosity,
@@ -1644,6 +1880,9 @@ cs_sles_solve(cs_sles_t           *sles,
 
   }
 
+  if (sles->guess_info != NULL)
+    _guess_update(sles->guess_info, a, vx, guess_order, *n_iter, state);
+
   /* Prepare postprocessing if needed */
 
   if (sles->post_info != NULL) {
@@ -1663,6 +1902,144 @@ cs_sles_solve(cs_sles_t           *sles,
   return state;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Resolution of several sparse linear systems sharing the same matrix.
+ *
+ * If the solver type associated with this system provides a batched
+ * multi-right-hand-side implementation, it is used, amortizing matrix
+ * traffic over the given right-hand sides; otherwise, the systems are
+ * simply solved one after the other.
+ *
+ * Each system is converged independently, using the same precision
+ * criteria as \ref cs_sles_solve.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[out]      n_iter         number of "equivalent" iterations per system
+ * \param[out]      residue        residue per system
+ * \param[in]       rhs            right hand side pointers (size: n_rhs)
+ * \param[in, out]  vx             system solution pointers (size: n_rhs)
+ * \param[in]       aux_size       size of aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state of least converged system
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t              *sles,
+                    const cs_matrix_t      *a,
+                    cs_halo_rotation_t      rotation_mode,
+                    double                  precision,
+                    double                  r_norm,
+                    int                     n_rhs,
+                    int                     n_iter[],
+                    double                  residue[],
+                    const cs_real_t *const  rhs[],
+                    cs_real_t *const        vx[],
+                    size_t                  aux_size,
+                    void                   *aux_vectors)
+{
+  if (sles->context == NULL)
+    _cs_sles_define_default(sles->f_id, sles->name, a);
+
+  cs_sles_convergence_state_t state = CS_SLES_CONVERGED;
+
+  /* Batched variant where available */
+
+  if (sles->solve_multi_func != NULL && n_rhs > 1) {
+
+    int t_top_id = cs_timer_stats_switch(_sles_stat_id);
+
+    sles->n_calls += 1;
+
+    const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+
+    state = sles->solve_multi_func(sles->context,
+                                   sles_name,
+                                   a,
+                                   sles->verbosity,
+                                   rotation_mode,
+                                   precision,
+                                   r_norm,
+                                   n_rhs,
+                                   n_iter,
+                                   residue,
+                                   rhs,
+                                   vx,
+                                   aux_size,
+                                   aux_vectors);
+
+    /* Prepare postprocessing if needed (last system solved) */
+
+    if (sles->post_info != NULL) {
+      _ensure_alloc_post(sles, a);
+      const cs_lnum_t n_vals
+        = sles->post_info->n_rows * sles->post_info->block_size;
+      _residual(n_vals,
+                rotation_mode,
+                a,
+                rhs[n_rhs-1],
+                vx[n_rhs-1],
+                sles->post_info->row_residual);
+    }
+
+    cs_timer_stats_switch(t_top_id);
+
+    /* In case of error, re-solve each system individually, so error
+       handling (postprocessing output, solver switch, ...) is applied
+       through the standard path */
+
+    if (state < CS_SLES_ITERATING && sles->error_func != NULL) {
+      state = CS_SLES_CONVERGED;
+      for (int i = 0; i < n_rhs; i++) {
+        cs_sles_convergence_state_t s = cs_sles_solve(sles,
+                                                      a,
+                                                      rotation_mode,
+                                                      precision,
+                                                      r_norm,
+                                                      n_iter + i,
+                                                      residue + i,
+                                                      rhs[i],
+                                                      vx[i],
+                                                      aux_size,
+                                                      aux_vectors);
+        if (s < state)
+          state = s;
+      }
+    }
+
+  }
+
+  /* Default: solve each system in turn */
+
+  else {
+    for (int i = 0; i < n_rhs; i++) {
+      cs_sles_convergence_state_t s = cs_sles_solve(sles,
+                                                    a,
+                                                    rotation_mode,
+                                                    precision,
+                                                    r_norm,
+                                                    n_iter + i,
+                                                    residue + i,
+                                                    rhs[i],
+                                                    vx[i],
+                                                    aux_size,
+                                                    aux_vectors);
+      if (s < state)
+        state = s;
+    }
+  }
+
+  return state;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup.
@@ -1736,6 +2113,7 @@ cs_sles_copy(cs_sles_t        *dest,
   dest->context = src->copy_func(src->context);
   dest->setup_func = src->setup_func;
   dest->solve_func = src->solve_func;
+  dest->solve_multi_func = src->solve_multi_func;
   dest->free_func = src->free_func;
   dest->log_func = src->log_func;
   dest->copy_func = src->copy_func;
@@ -1772,6 +2150,29 @@ cs_sles_set_error_handler(cs_sles_t                *sles,
     sles->error_func = error_handler_func;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a batched multi-right-hand-side solve function to a
+ *        given sparse linear equation solver.
+ *
+ * The associated function will be used by \ref cs_sles_solve_multi when
+ * several systems sharing the same matrix are solved together. To
+ * disassociate it, this function may be called with \p solve_multi_func
+ * = NULL.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to batched solve function
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi(cs_sles_t              *sles,
+                        cs_sles_solve_multi_t  *solve_multi_func)
+{
+  if (sles != NULL)
+    sles->solve_multi_func = solve_multi_func;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
@@ -142,6 +142,50 @@ typedef cs_sles_convergence_state_t
                    size_t               aux_size,
                    void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Function pointer for resolution of a linear system with multiple
+ * right-hand sides sharing the same matrix.
+ *
+ * This allows solver implementations to amortize matrix traffic over
+ * several right-hand sides (blocked matrix.vector products); each system
+ * is converged independently, with the same precision criteria.
+ *
+ * parameters:
+ *   context       <-> pointer to solver context
+ *   name          <-- pointer to name of linear system
+ *   a             <-- matrix
+ *   verbosity     <-- associated verbosity
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision
+ *   r_norm        <-- residue normalization
+ *   n_rhs         <-- number of right-hand sides
+ *   n_iter        --> number of "equivalent" iterations per system
+ *   residue       --> residue per system
+ *   rhs           <-- right hand side pointers (size: n_rhs)
+ *   vx            <-- system solution pointers (size: n_rhs)
+ *   aux_size      <-- number of elements in aux_vectors
+ *   aux_vectors   <-- optional working area (internal allocation if NULL)
+ *
+ * returns:
+ *   convergence status of least converged system
+ *----------------------------------------------------------------------------*/
+
+typedef cs_sles_convergence_state_t
+(cs_sles_solve_multi_t) (void                   *context,
+                         const char             *name,
+                         const cs_matrix_t      *a,
+                         int                     verbosity,
+                         cs_halo_rotation_t      rotation_mode,
+                         double                  precision,
+                         double                  r_norm,
+                         int                     n_rhs,
+                         int                     n_iter[],
+                         double                  residue[],
+                         const cs_real_t *const  rhs[],
+                         cs_real_t *const        vx[],
+                         size_t                  aux_size,
+                         void                   *aux_vectors);
+
 /*----------------------------------------------------------------------------
  * Function pointer for freeing of a linear system's context data.
  *
@@ -513,6 +557,33 @@ cs_sles_set_post_output(cs_sles_t  *sles,
 int
 cs_sles_get_post_output(cs_sles_t  *sles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate extrapolation of the initial guess from
+ *        previous solutions for a given linear equation solver.
+ *
+ * When active, the last \c n_prev solutions are stored, and each solve
+ * starts from a polynomial extrapolation of those solutions instead of
+ * the caller-provided initial guess, with the extrapolation order
+ * selected automatically based on observed iteration counts.
+ *
+ * This is only useful for systems solved repeatedly over time steps
+ * whose successive solutions are strongly correlated (such as pressure
+ * or potential corrections), and should not be used where the initial
+ * guess has a specific meaning for the caller.
+ *
+ * By default, extrapolation is not activated.
+ *
+ * \param[in, out]  sles    pointer to solver object
+ * \param[in]       n_prev  number of previous solutions stored
+ *                          (0 to 4, 0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_guess_extrapolation(cs_sles_t  *sles,
+                                int         n_prev);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return type name of solver context.
@@ -649,6 +720,50 @@ cs_sles_solve(cs_sles_t           *sles,
               size_t               aux_size,
               void                *aux_vectors);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Resolution of several sparse linear systems sharing the same matrix.
+ *
+ * If the solver type associated with this system provides a batched
+ * multi-right-hand-side implementation, it is used, amortizing matrix
+ * traffic over the given right-hand sides; otherwise, the systems are
+ * simply solved one after the other.
+ *
+ * Each system is converged independently, using the same precision
+ * criteria as \ref cs_sles_solve.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       rotation_mode  halo update option for rotational periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[out]      n_iter         number of "equivalent" iterations per system
+ * \param[out]      residue        residue per system
+ * \param[in]       rhs            right hand side pointers (size: n_rhs)
+ * \param[in, out]  vx             system solution pointers (size: n_rhs)
+ * \param[in]       aux_size       size of aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state of least converged system
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t              *sles,
+                    const cs_matrix_t      *a,
+                    cs_halo_rotation_t      rotation_mode,
+                    double                  precision,
+                    double                  r_norm,
+                    int                     n_rhs,
+                    int                     n_iter[],
+                    double                  residue[],
+                    const cs_real_t *const  rhs[],
+                    cs_real_t *const        vx[],
+                    size_t                  aux_size,
+                    void                   *aux_vectors);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup.
@@ -712,6 +827,25 @@ void
 cs_sles_set_error_handler(cs_sles_t                *sles,
                           cs_sles_error_handler_t  *error_handler_func);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a batched multi-right-hand-side solve function to a
+ *        given sparse linear equation solver.
+ *
+ * The associated function will be used by \ref cs_sles_solve_multi when
+ * several systems sharing the same matrix are solved together. To
+ * disassociate it, this function may be called with \p solve_multi_func
+ * = NULL.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to batched solve function
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi(cs_sles_t              *sles,
+                        cs_sles_solve_multi_t  *solve_multi_func);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
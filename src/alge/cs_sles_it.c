@@ -105,6 +105,12 @@ BEGIN_C_DECLS
        Process-local Gauss-Seidel
   \var CS_SLES_P_SYM_GAUSS_SEIDEL
        Process-local symmetric Gauss-Seidel
+  \var CS_SLES_P_MC_GAUSS_SEIDEL
+       Process-local multicolor Gauss-Seidel, based on an independent
+       cell coloring so that threads may update rows of a same color
+       concurrently without races
+  \var CS_SLES_P_MC_SYM_GAUSS_SEIDEL
+       Process-local multicolor symmetric Gauss-Seidel
   \var CS_SLES_TS_F_GAUSS_SEIDEL
        Truncated Gauss-Seidel smoother pass
   \var CS_SLES_TS_B_GAUSS_SEIDEL
@@ -206,6 +212,12 @@ typedef struct _cs_sles_it_setup_t {
   cs_real_t           *_ad_inv;          /* private pointer to
                                             diagonal inverse */
 
+  cs_lnum_t            n_colors;         /* number of independent row colors
+                                            (multicolor Gauss-Seidel only) */
+  cs_lnum_t           *color_index;      /* start of each color in color_order
+                                            (size: n_colors + 1) */
+  cs_lnum_t           *color_order;      /* row ids, grouped by color */
+
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
@@ -291,6 +303,18 @@ struct _cs_sles_it_t {
                                                  convergence */
   cs_sles_it_t                *fallback;   /* fallback solver */
 
+  /* Subspace recycling between successive solves: an A-orthonormal basis
+     of previous solutions is kept across solves (and matrix setups), and
+     the initial residual is projected on it before iterating */
+
+  int                  n_defl_max;        /* Maximum number of recycled
+                                             basis vectors (0: inactive) */
+  int                  n_defl;            /* Current number of vectors */
+  cs_lnum_t            defl_size;         /* Allocated size of each vector */
+  cs_real_t           *defl_v;            /* Basis vectors */
+  cs_real_t           *defl_av;           /* Matrix.vector products of
+                                             basis vectors */
+
 };
 
 /* Convergence testing and tracking */
@@ -321,18 +345,27 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Use a non-blocking reduction for the residue norm in Jacobi solvers,
+   deferring the convergence decision by one iteration so the reduction
+   overlaps with the next sweep (requires MPI-3) */
+
+static bool _jacobi_deferred_cv_test = false;
+
 /* Sparse linear equation solver type names */
 
 const char *cs_sles_it_type_name[]
   = {N_("Conjugate Gradient"),
      N_("Flexible Conjugate Gradient"),
      N_("Inexact Preconditioned Conjugate Gradient"),
+     N_("Pipelined Conjugate Gradient"),
      N_("Jacobi"),
      N_("BiCGstab"),
      N_("BiCGstab2"),
      N_("GMRES"),
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
+     N_("Multicolor Gauss-Seidel"),
+     N_("Multicolor symmetric Gauss-Seidel"),
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
      N_("3-layer conjugate residual")};
@@ -756,6 +789,89 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
   *s4 = s[3];
 }
 
+/*----------------------------------------------------------------------------
+ * Compute z = A.y and dot products x.y and y.z in a single pass over
+ * the matrix, summing results over all ranks.
+ *
+ * This fuses the matrix.vector product and the following dot products
+ * so the matrix and vectors are streamed from memory only once; it is
+ * restricted to scalar MSR matrices, for which the required arrays
+ * are directly accessible.
+ *
+ * The halo of y is synchronized first, as done by the non-fused
+ * matrix.vector product.
+ *
+ * parameters:
+ *   c             <-- pointer to solver context info
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   a             <-- matrix (scalar MSR)
+ *   x             <-- first vector
+ *   y             <-> second vector (ghost values updated)
+ *   z             --> result of z = A.y
+ *   s1            --> result of s1 = x.y
+ *   s2            --> result of s2 = y.z
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_dot_products_xy_yz(const cs_sles_it_t  *c,
+                            cs_halo_rotation_t   rotation_mode,
+                            const cs_matrix_t   *a,
+                            const cs_real_t     *restrict x,
+                            cs_real_t           *restrict y,
+                            cs_real_t           *restrict z,
+                            double              *s1,
+                            double              *s2)
+{
+  double s[2] = {0., 0.};
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  if (cs_matrix_get_halo(a) != NULL)
+    cs_matrix_pre_vector_multiply_sync(rotation_mode, a, y);
+
+  double s0 = 0., sz = 0.;
+
+# pragma omp parallel for reduction(+:s0, sz) if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+    const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+    const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+    cs_real_t zii = a_d_val[ii]*y[ii];
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      zii += (m_row[jj]*y[col_id[jj]]);
+
+    z[ii] = zii;
+
+    s0 += x[ii]*y[ii];
+    sz += y[ii]*zii;
+
+  }
+
+  s[0] = s0;
+  s[1] = sz;
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    double _sum[2];
+    MPI_Allreduce(s, _sum, 2, MPI_DOUBLE, MPI_SUM, c->comm);
+    s[0] = _sum[0];
+    s[1] = _sum[1];
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  *s1 = s[0];
+  *s2 = s[1];
+}
+
 /*----------------------------------------------------------------------------
  * Compute inverses of dense 3*3 matrices.
  *
@@ -878,6 +994,9 @@ _setup_sles_it(cs_sles_it_t       *c,
     sd = c->setup_data;
     sd->ad_inv = NULL;
     sd->_ad_inv = NULL;
+    sd->n_colors = 0;
+    sd->color_index = NULL;
+    sd->color_order = NULL;
     sd->pc_context = NULL;
     sd->pc_apply = NULL;
   }
@@ -957,6 +1076,122 @@ _setup_sles_it(cs_sles_it_t       *c,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Build an independent row coloring for multicolor Gauss-Seidel.
+ *
+ * A greedy first-fit coloring of the local matrix adjacency graph is
+ * computed, so that no two rows of a same color are coupled by an
+ * extra-diagonal term; rows of a same color may thus be updated
+ * concurrently by different threads with no race on the solution.
+ *
+ * Rows are regrouped by color in setup_data->color_order, with
+ * setup_data->color_index giving the bounds of each color, in a manner
+ * similar to the group indexes of cs_numbering_t threaded numberings
+ * (but with a single group range per color, as the inner loop over a
+ * color is simply distributed over threads).
+ *
+ * The coloring is based on the matrix structure only, so it is valid for
+ * any diagonal block size, and only needs to be recomputed when the
+ * solver setup is redone.
+ *
+ * parameters:
+ *   c <-> pointer to solver context info
+ *   a <-- matrix (MSR storage required)
+ *----------------------------------------------------------------------------*/
+
+static void
+_setup_gs_coloring(cs_sles_it_t       *c,
+                   const cs_matrix_t  *a)
+{
+  cs_sles_it_setup_t *sd = c->setup_data;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  int *color;
+  BFT_MALLOC(color, n_rows, int);
+
+  /* Upper bound on the number of colors: max degree + 1 */
+
+  cs_lnum_t degree_max = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t degree = a_row_index[ii+1] - a_row_index[ii];
+    if (degree > degree_max)
+      degree_max = degree;
+  }
+
+  cs_lnum_t n_colors_max = degree_max + 1;
+
+  /* Greedy first-fit coloring; c_stamp[k] == ii marks color k as used
+     by an already-colored neighbor of row ii, avoiding a reset of the
+     full flag array for each row. */
+
+  cs_lnum_t *c_stamp;
+  BFT_MALLOC(c_stamp, n_colors_max, cs_lnum_t);
+  for (cs_lnum_t k = 0; k < n_colors_max; k++)
+    c_stamp[k] = -1;
+
+  cs_lnum_t n_colors = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+    const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      cs_lnum_t kk = col_id[jj];
+      if (kk < ii) /* already colored local neighbor */
+        c_stamp[color[kk]] = ii;
+    }
+
+    int col = 0;
+    while (c_stamp[col] == ii)
+      col++;
+
+    assert(col < n_colors_max);
+
+    color[ii] = col;
+    if (col >= n_colors)
+      n_colors = col + 1;
+
+  }
+
+  BFT_FREE(c_stamp);
+
+  /* Regroup rows by color (stable counting sort) */
+
+  BFT_REALLOC(sd->color_index, n_colors + 1, cs_lnum_t);
+  BFT_REALLOC(sd->color_order, n_rows, cs_lnum_t);
+
+  for (cs_lnum_t k = 0; k < n_colors + 1; k++)
+    sd->color_index[k] = 0;
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    sd->color_index[color[ii] + 1] += 1;
+
+  for (cs_lnum_t k = 0; k < n_colors; k++)
+    sd->color_index[k+1] += sd->color_index[k];
+
+  cs_lnum_t *c_count;
+  BFT_MALLOC(c_count, n_colors, cs_lnum_t);
+  for (cs_lnum_t k = 0; k < n_colors; k++)
+    c_count[k] = sd->color_index[k];
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    sd->color_order[c_count[color[ii]]] = ii;
+    c_count[color[ii]] += 1;
+  }
+
+  BFT_FREE(c_count);
+  BFT_FREE(color);
+
+  sd->n_colors = n_colors;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned conjugate gradient.
  *
@@ -1006,6 +1241,12 @@ _conjugate_gradient(cs_sles_it_t              *c,
 
   const cs_lnum_t n_rows = c->setup_data->n_rows;
 
+  /* Fused matrix.vector product and dot products may be used
+     for scalar MSR matrices */
+
+  const bool fused_mv = (   cs_matrix_get_type(a) == CS_MATRIX_MSR
+                         && diag_block_size == 1);
+
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
     const size_t n_wa = 4;
@@ -1067,11 +1308,15 @@ _conjugate_gradient(cs_sles_it_t              *c,
 
     n_iter = 1;
 
-    cs_matrix_vector_multiply(rotation_mode, a, dk, zk);
-
-    /* Descent parameter */
+    /* Matrix.vector product and descent parameter */
 
-    _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+    if (fused_mv)
+      _mat_vec_dot_products_xy_yz(c, rotation_mode, a,
+                                  rk, dk, zk, &ro_0, &ro_1);
+    else {
+      cs_matrix_vector_multiply(rotation_mode, a, dk, zk);
+      _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+    }
 
     alpha =  - ro_0 / ro_1;
 
@@ -1130,9 +1375,13 @@ _conjugate_gradient(cs_sles_it_t              *c,
     for (cs_lnum_t ii = 0; ii < n_rows; ii++)
       dk[ii] = gk[ii] + (beta * dk[ii]);
 
-    cs_matrix_vector_multiply(rotation_mode, a, dk, zk);
-
-    _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+    if (fused_mv)
+      _mat_vec_dot_products_xy_yz(c, rotation_mode, a,
+                                  rk, dk, zk, &ro_0, &ro_1);
+    else {
+      cs_matrix_vector_multiply(rotation_mode, a, dk, zk);
+      _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+    }
 
     alpha =  - ro_0 / ro_1;
 
@@ -1532,6 +1781,211 @@ _conjugate_gradient_ip(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant, described in \cite Ghysels:2014, groups the 3 required
+ * dot products in a single reduction, which may additionally be overlapped
+ * with the preconditioner application and matrix.vector product (using a
+ * non-blocking reduction where MPI 3 is available), at the expense of
+ * 2 additional matrix.vector product results maintained by recurrence.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_pipelined_conjugate_gradient(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              int                        diag_block_size,
+                              cs_halo_rotation_t         rotation_mode,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk;
+  cs_real_t  *restrict mk, *restrict nk;
+  cs_real_t  *restrict zk, *restrict qk, *restrict sk, *restrict pk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, rk);  /* rk = A.x0 */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  /* uk = M^-1.rk, wk = A.uk */
+
+  c->setup_data->pc_apply(c->setup_data->pc_context,
+                          rotation_mode,
+                          rk,
+                          uk);
+
+  cs_matrix_vector_multiply(rotation_mode, a, uk, wk);
+
+  double gamma_km1 = 0., alpha_km1 = 0.;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    double s[3];
+
+    /* Local contributions to rk.rk, rk.uk and uk.wk; the global
+       reduction is overlapped with the preconditioner application
+       and matrix.vector product below. */
+
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+
+#if defined(HAVE_MPI)
+
+    double _sum[3];
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+    MPI_Request request = MPI_REQUEST_NULL;
+    if (c->comm != MPI_COMM_NULL)
+      MPI_Iallreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, c->comm, &request);
+#else
+    if (c->comm != MPI_COMM_NULL)
+      MPI_Allreduce(s, _sum, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+
+#endif /* defined(HAVE_MPI) */
+
+    /* mk = M^-1.wk, nk = A.mk */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context,
+                            rotation_mode,
+                            wk,
+                            mk);
+
+    cs_matrix_vector_multiply(rotation_mode, a, mk, nk);
+
+#if defined(HAVE_MPI)
+
+    if (c->comm != MPI_COMM_NULL) {
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+#endif
+      s[0] = _sum[0];
+      s[1] = _sum[1];
+      s[2] = _sum[2];
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    double residue = sqrt(s[0]);
+    double gamma_k = s[1];
+    double delta_k = s[2];
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameters and recurrences; all updates are elementwise,
+       so a single pass (and parallel region) is sufficient. */
+
+    if (n_iter > 0) {
+
+      double beta_k = gamma_k / gamma_km1;
+      double alpha_k = gamma_k / (delta_k - beta_k*gamma_k/alpha_km1);
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        zk[ii] = nk[ii] + beta_k*zk[ii];
+        qk[ii] = mk[ii] + beta_k*qk[ii];
+        sk[ii] = wk[ii] + beta_k*sk[ii];
+        pk[ii] = uk[ii] + beta_k*pk[ii];
+        vx[ii] += alpha_k*pk[ii];
+        rk[ii] -= alpha_k*sk[ii];
+        uk[ii] -= alpha_k*qk[ii];
+        wk[ii] -= alpha_k*zk[ii];
+      }
+
+      gamma_km1 = gamma_k;
+      alpha_km1 = alpha_k;
+
+    }
+    else { /* n_iter == 0 */
+
+      double alpha_k = gamma_k / delta_k;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        zk[ii] = nk[ii];
+        qk[ii] = mk[ii];
+        sk[ii] = wk[ii];
+        pk[ii] = uk[ii];
+        vx[ii] += alpha_k*pk[ii];
+        rk[ii] -= alpha_k*sk[ii];
+        uk[ii] -= alpha_k*qk[ii];
+        wk[ii] -= alpha_k*zk[ii];
+      }
+
+      gamma_km1 = gamma_k;
+      alpha_km1 = alpha_k;
+
+    }
+
+    n_iter += 1;
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned conjugate gradient
  * with single reduction.
@@ -2276,23 +2730,93 @@ _conjugate_residual_3(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using Jacobi.
+ * Single Jacobi sweep for a scalar MSR matrix.
  *
- * On entry, vx is considered initialized.
+ * This fuses the extra-diagonal matrix.vector product with the solution
+ * update and residue computation so the matrix and vectors are streamed
+ * from memory only once per sweep.
  *
- * parameters:
- *   c               <-- pointer to solver context info
- *   a               <-- linear equation matrix
- *   diag_block_size <-- diagonal block size
- *   rotation_mode   <-- halo update option for rotational periodicity
- *   convergence     <-- convergence information structure
- *   rhs             <-- right hand side
- *   vx              <-> system solution
- *   aux_size        <-- number of elements in aux_vectors (in bytes)
- *   aux_vectors     --- optional working area (allocation otherwise)
+ * The halo of rk is synchronized first, as done by the non-fused
+ * extra-diagonal matrix.vector product.
  *
- * returns:
- *   convergence state
+ * parameters:
+ *   c             <-- pointer to solver context info
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   a             <-- matrix (scalar MSR)
+ *   rhs           <-- right hand side
+ *   ad            <-- diagonal part of linear equation matrix
+ *   ad_inv        <-- inverse of diagonal part of linear equation matrix
+ *   rk            <-> solution at previous sweep (ghost values updated)
+ *   vx            --> updated solution
+ *
+ * returns:
+ *   local (non-summed) squared residue
+ *----------------------------------------------------------------------------*/
+
+static double
+_jacobi_sweep_msr(const cs_sles_it_t  *c,
+                  cs_halo_rotation_t   rotation_mode,
+                  const cs_matrix_t   *a,
+                  const cs_real_t     *restrict rhs,
+                  const cs_real_t     *restrict ad,
+                  const cs_real_t     *restrict ad_inv,
+                  cs_real_t           *restrict rk,
+                  cs_real_t           *restrict vx)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, NULL, &a_x_val);
+
+  if (cs_matrix_get_halo(a) != NULL)
+    cs_matrix_pre_vector_multiply_sync(rotation_mode, a, rk);
+
+  double res2 = 0.0;
+
+# pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+    const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+    const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+    cs_real_t vx0 = rhs[ii];
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      vx0 -= (m_row[jj]*rk[col_id[jj]]);
+
+    vx0 *= ad_inv[ii];
+
+    register double r = ad[ii] * (vx0-rk[ii]);
+
+    vx[ii] = vx0;
+
+    res2 += (r*r);
+
+  }
+
+  return res2;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Jacobi.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
@@ -2338,6 +2862,18 @@ _jacobi(cs_sles_it_t              *c,
 
   const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
 
+  /* Fused sweep may be used for scalar MSR matrices */
+
+  const bool fused_mv = (   cs_matrix_get_type(a) == CS_MATRIX_MSR
+                         && diag_block_size == 1);
+
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  const bool deferred_cv_test = (   _jacobi_deferred_cv_test
+                                 && c->comm != MPI_COMM_NULL);
+  MPI_Request cv_request = MPI_REQUEST_NULL;
+  double res2_loc = 0., res2_glob = 0.;
+#endif
+
   cvg = CS_SLES_ITERATING;
 
   /* Current iteration */
@@ -2361,19 +2897,60 @@ _jacobi(cs_sles_it_t              *c,
 
     /* Compute Vx <- Vx - (A-diag).Rk and residue. */
 
-    cs_matrix_exdiag_vector_multiply(rotation_mode, a, rk, vx);
+    if (fused_mv)
+      res2 = _jacobi_sweep_msr(c, rotation_mode, a, rhs, ad, ad_inv, rk, vx);
 
-    res2 = 0.0;
+    else {
+
+      cs_matrix_exdiag_vector_multiply(rotation_mode, a, rk, vx);
+
+      res2 = 0.0;
+
+#     pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
+      for (ii = 0; ii < n_rows; ii++) {
+        vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
+        double r = ad[ii] * (vx[ii]-rk[ii]);
+        res2 += (r*r);
+      }
 
-#   pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
-    for (ii = 0; ii < n_rows; ii++) {
-      vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
-      double r = ad[ii] * (vx[ii]-rk[ii]);
-      res2 += (r*r);
     }
 
 #if defined(HAVE_MPI)
 
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+    if (deferred_cv_test) {
+
+      /* Complete the reduction posted at the previous iteration, whose
+         latency is thus overlapped with the sweep just computed; the
+         convergence decision is taken one iteration late, at the cost
+         of one extra sweep (which can only improve the solution). */
+
+      if (n_iter > 1) {
+
+        MPI_Wait(&cv_request, MPI_STATUS_IGNORE);
+
+        residue = sqrt(res2_glob);
+
+        if (n_iter == 2)
+          c->setup_data->initial_residue = residue;
+
+        cvg = _convergence_test(c, n_iter-1, residue, convergence);
+
+      }
+
+      if (cvg == CS_SLES_ITERATING) {
+        res2_loc = res2;
+        MPI_Iallreduce(&res2_loc, &res2_glob, 1, MPI_DOUBLE, MPI_SUM,
+                       c->comm, &cv_request);
+      }
+
+      continue;
+
+    }
+
+#endif /* defined(MPI_VERSION) && (MPI_VERSION >= 3) */
+
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
@@ -2399,6 +2976,207 @@ _jacobi(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs for multiple right-hand sides using Jacobi.
+ *
+ * The matrix rows are read once per sweep and applied to all systems
+ * still iterating, so matrix traffic is amortized over the right-hand
+ * sides; each system is converged independently. The parallel sums of
+ * the residue norms are also grouped in a single reduction.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c             <-- pointer to solver context info
+ *   a             <-- linear equation matrix (scalar MSR)
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   n_rhs         <-- number of right-hand sides
+ *   convergence   <-> convergence information structures (size: n_rhs)
+ *   cvg           --> convergence state per system (size: n_rhs)
+ *   rhs           <-- right hand side pointers
+ *   vx            <-> system solution pointers
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state of least converged system
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_jacobi_multi(cs_sles_it_t                 *c,
+              const cs_matrix_t            *a,
+              cs_halo_rotation_t            rotation_mode,
+              int                           n_rhs,
+              cs_sles_it_convergence_t      convergence[],
+              cs_sles_convergence_state_t   cvg[],
+              const cs_real_t *const        rhs[],
+              cs_real_t *const              vx[],
+              size_t                        aux_size,
+              void                         *aux_vectors)
+{
+  cs_real_t *_aux_vectors;
+  size_t wa_size;
+
+  unsigned n_iter = 0;
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_x_val;
+
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, NULL, &a_x_val);
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+    const size_t n_wa = n_rhs;
+    wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+  }
+
+  /* List of systems still iterating, compacted as they converge */
+
+  int  *s_id;
+  double  *res2;
+
+  BFT_MALLOC(s_id, n_rhs, int);
+  BFT_MALLOC(res2, n_rhs*2, double);
+
+  int n_active = n_rhs;
+  for (int i = 0; i < n_rhs; i++) {
+    s_id[i] = i;
+    cvg[i] = CS_SLES_ITERATING;
+  }
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (n_active > 0) {
+
+    n_iter += 1;
+
+    /* Save previous iterates and update their ghost values */
+
+    for (int k = 0; k < n_active; k++) {
+
+      const cs_real_t *restrict vxr = vx[s_id[k]];
+      cs_real_t *restrict rk = _aux_vectors + wa_size*k;
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        rk[ii] = vxr[ii];
+
+      if (cs_matrix_get_halo(a) != NULL)
+        cs_matrix_pre_vector_multiply_sync(rotation_mode, a, rk);
+
+    }
+
+    /* Compute vx <- diag^-1 . (rhs - (a-diag).rk) for all active systems,
+       reading each matrix row only once */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      for (int k = 0; k < n_active; k++) {
+
+        const cs_real_t *restrict rk = _aux_vectors + wa_size*k;
+
+        cs_real_t vx0 = rhs[s_id[k]][ii];
+        for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+          vx0 -= (m_row[jj]*rk[col_id[jj]]);
+
+        vx[s_id[k]][ii] = vx0*ad_inv[ii];
+
+      }
+
+    }
+
+    /* Compute residues */
+
+    for (int k = 0; k < n_active; k++) {
+
+      const cs_real_t *restrict vxr = vx[s_id[k]];
+      const cs_real_t *restrict rk = _aux_vectors + wa_size*k;
+
+      double s = 0.0;
+
+#     pragma omp parallel for reduction(+:s) if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        register double r = ad[ii] * (vxr[ii]-rk[ii]);
+        s += (r*r);
+      }
+
+      res2[k] = s;
+
+    }
+
+#if defined(HAVE_MPI)
+
+    if (c->comm != MPI_COMM_NULL) {
+      double *_sum = res2 + n_rhs;
+      MPI_Allreduce(res2, _sum, n_active, MPI_DOUBLE, MPI_SUM, c->comm);
+      for (int k = 0; k < n_active; k++)
+        res2[k] = _sum[k];
+    }
+
+#endif /* defined(HAVE_MPI) */
+
+    /* Convergence tests, compacting the list of active systems;
+       the shared initial residue (used for divergence detection) is
+       based on the least advanced system */
+
+    if (n_iter == 1) {
+      double r_max = 0.;
+      for (int k = 0; k < n_active; k++)
+        r_max = CS_MAX(r_max, sqrt(res2[k]));
+      c->setup_data->initial_residue = r_max;
+    }
+
+    int n_active_new = 0;
+
+    for (int k = 0; k < n_active; k++) {
+
+      int i = s_id[k];
+      double residue = sqrt(res2[k]);
+
+      cvg[i] = _convergence_test(c, n_iter, residue, convergence + i);
+
+      if (cvg[i] == CS_SLES_ITERATING)
+        s_id[n_active_new++] = i;
+
+    }
+
+    n_active = n_active_new;
+
+  }
+
+  cs_sles_convergence_state_t cvg_min = CS_SLES_CONVERGED;
+  for (int i = 0; i < n_rhs; i++) {
+    if (cvg[i] < cvg_min)
+      cvg_min = cvg[i];
+  }
+
+  BFT_FREE(res2);
+  BFT_FREE(s_id);
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg_min;
+}
+
 /*----------------------------------------------------------------------------
  * Block Jacobi utilities.
  * Compute forward and backward to solve an LU 3*3 system.
@@ -2569,6 +3347,13 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
   const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
 
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  const bool deferred_cv_test = (   _jacobi_deferred_cv_test
+                                 && c->comm != MPI_COMM_NULL);
+  MPI_Request cv_request = MPI_REQUEST_NULL;
+  double res2_loc = 0., res2_glob = 0.;
+#endif
+
   cvg = CS_SLES_ITERATING;
 
   /* Current iteration */
@@ -2603,6 +3388,40 @@ _block_3_jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+    if (deferred_cv_test) {
+
+      /* Complete the reduction posted at the previous iteration, whose
+         latency is thus overlapped with the sweep just computed; the
+         convergence decision is taken one iteration late, at the cost
+         of one extra sweep (which can only improve the solution). */
+
+      if (n_iter > 1) {
+
+        MPI_Wait(&cv_request, MPI_STATUS_IGNORE);
+
+        residue = sqrt(res2_glob);
+
+        if (n_iter == 2)
+          c->setup_data->initial_residue = residue;
+
+        cvg = _convergence_test(c, n_iter-1, residue, convergence);
+
+      }
+
+      if (cvg == CS_SLES_ITERATING) {
+        res2_loc = res2;
+        MPI_Iallreduce(&res2_loc, &res2_glob, 1, MPI_DOUBLE, MPI_SUM,
+                       c->comm, &cv_request);
+      }
+
+      continue;
+
+    }
+
+#endif /* defined(MPI_VERSION) && (MPI_VERSION >= 3) */
+
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
@@ -2692,6 +3511,13 @@ _block_jacobi(cs_sles_it_t              *c,
 
   const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
 
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  const bool deferred_cv_test = (   _jacobi_deferred_cv_test
+                                 && c->comm != MPI_COMM_NULL);
+  MPI_Request cv_request = MPI_REQUEST_NULL;
+  double res2_loc = 0., res2_glob = 0.;
+#endif
+
   cvg = CS_SLES_ITERATING;
 
   /* Current iteration */
@@ -2726,6 +3552,40 @@ _block_jacobi(cs_sles_it_t              *c,
 
 #if defined(HAVE_MPI)
 
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+    if (deferred_cv_test) {
+
+      /* Complete the reduction posted at the previous iteration, whose
+         latency is thus overlapped with the sweep just computed; the
+         convergence decision is taken one iteration late, at the cost
+         of one extra sweep (which can only improve the solution). */
+
+      if (n_iter > 1) {
+
+        MPI_Wait(&cv_request, MPI_STATUS_IGNORE);
+
+        residue = sqrt(res2_glob);
+
+        if (n_iter == 2)
+          c->setup_data->initial_residue = residue;
+
+        cvg = _convergence_test(c, n_iter-1, residue, convergence);
+
+      }
+
+      if (cvg == CS_SLES_ITERATING) {
+        res2_loc = res2;
+        MPI_Iallreduce(&res2_loc, &res2_glob, 1, MPI_DOUBLE, MPI_SUM,
+                       c->comm, &cv_request);
+      }
+
+      continue;
+
+    }
+
+#endif /* defined(MPI_VERSION) && (MPI_VERSION >= 3) */
+
     if (c->comm != MPI_COMM_NULL) {
       double _sum;
       MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
@@ -4188,10 +5048,15 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using Truncated forward Gauss-Seidel.
+ * Solution of A.vx = Rhs using Process-local multicolor Gauss-Seidel.
  *
- * This variant is intended for smoothing with a fixed number of
- * iterations, so does not compute a residue or run a convergence test.
+ * Rows are visited color by color, based on the independent coloring
+ * built at setup; rows of a same color are not coupled, so each color's
+ * loop may be distributed over threads with no race on vx, making this
+ * a true Gauss-Seidel sweep even when threaded (contrary to the
+ * Gauss-Seidel/Jacobi hybrid behavior of the lexicographic variant).
+ *
+ * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
@@ -4209,7 +5074,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_ts_f_gauss_seidel_msr(cs_sles_it_t              *c,
+_p_mc_gauss_seidel_msr(cs_sles_it_t              *c,
                        const cs_matrix_t         *a,
                        int                        diag_block_size,
                        cs_halo_rotation_t         rotation_mode,
@@ -4219,28 +5084,482 @@ _ts_f_gauss_seidel_msr(cs_sles_it_t              *c,
                        size_t                     aux_size,
                        void                      *aux_vectors)
 {
-  CS_UNUSED(rotation_mode);
   CS_UNUSED(aux_size);
   CS_UNUSED(aux_vectors);
 
-  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
-  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
+
+  /* Check matrix storage type */
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Multicolor Gauss-Seidel solver only supported with a\n"
+         "matrix using %s (%s) storage."),
+       cs_matrix_type_name[CS_MATRIX_MSR],
+       _(cs_matrix_type_fullname[CS_MATRIX_MSR]));
+
+  unsigned n_iter = 0;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
 
   const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
 
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
   const cs_lnum_t  *a_row_index, *a_col_id;
   const cs_real_t  *a_d_val, *a_x_val;
 
   const int *db_size = cs_matrix_get_diag_block_size(a);
   cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
-  /* Single iteration */
-  /*------------------*/
+  const cs_lnum_t n_colors = c->setup_data->n_colors;
+  const cs_lnum_t  *restrict color_index = c->setup_data->color_index;
+  const cs_lnum_t  *restrict color_order = c->setup_data->color_order;
 
-  /* Zeroe ghost cell values first */
+  cvg = CS_SLES_ITERATING;
 
-  cs_lnum_t s_id = n_rows*diag_block_size;
-  cs_lnum_t e_id = n_cols_ext*diag_block_size;
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk and residue. */
+
+    res2 = 0.0;
+
+    for (cs_lnum_t g_id = 0; g_id < n_colors; g_id++) {
+
+      const cs_lnum_t s_id = color_index[g_id];
+      const cs_lnum_t e_id = color_index[g_id+1];
+
+      if (diag_block_size == 1) {
+
+#       pragma omp parallel for reduction(+:res2) \
+                            if(e_id - s_id > CS_THR_MIN)
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+
+          cs_lnum_t ii = color_order[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vxm1 = vx[ii];
+          cs_real_t vx0 = rhs[ii];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+          vx0 *= ad_inv[ii];
+
+          register double r = ad[ii] * (vx0-vxm1);
+          res2 += (r*r);
+
+          vx[ii] = vx0;
+        }
+
+      }
+      else {
+
+#       pragma omp parallel for reduction(+:res2) \
+                            if(e_id - s_id > CS_THR_MIN)
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+
+          cs_lnum_t ii = color_order[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
+
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            vxm1[kk] = vx[ii*db_size[1] + kk];
+            vx0[kk] = rhs[ii*db_size[1] + kk];
+          }
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+              vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          }
+
+          _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
+                           db_size[0],
+                           _vx,
+                           vx0);
+
+          double rr = 0;
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            register double r = ad[ii*db_size[1] + kk] * (_vx[kk]-vxm1[kk]);
+            rr += (r*r);
+            vx[ii*db_size[1] + kk] = _vx[kk];
+          }
+          res2 += rr;
+
+        }
+
+      }
+
+    }
+
+    if (convergence->precision > 0. || c->plot != NULL) {
+
+#if defined(HAVE_MPI)
+
+      if (c->comm != MPI_COMM_NULL) {
+        double _sum;
+        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        res2 = _sum;
+      }
+
+#endif /* defined(HAVE_MPI) */
+
+      residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+      /* Convergence test */
+
+      if (n_iter == 1)
+        c->setup_data->initial_residue = residue;
+
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    }
+    else if (n_iter >= convergence->n_iterations_max) {
+      convergence->n_iterations = n_iter;
+      cvg = CS_SLES_MAX_ITERATION;
+    }
+
+  }
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local multicolor symmetric
+ * Gauss-Seidel.
+ *
+ * The forward sweep visits colors in increasing order, the backward
+ * sweep in decreasing order; within a color, rows are independent, so
+ * each color's loop may be distributed over threads with no race on vx.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_mc_sym_gauss_seidel_msr(cs_sles_it_t              *c,
+                           const cs_matrix_t         *a,
+                           int                        diag_block_size,
+                           cs_halo_rotation_t         rotation_mode,
+                           cs_sles_it_convergence_t  *convergence,
+                           const cs_real_t           *rhs,
+                           cs_real_t                 *restrict vx,
+                           size_t                     aux_size,
+                           void                      *aux_vectors)
+{
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  cs_sles_convergence_state_t cvg;
+  double  res2, residue;
+
+  /* Check matrix storage type */
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Multicolor symmetric Gauss-Seidel solver only supported with a\n"
+         "matrix using %s (%s) storage."),
+       cs_matrix_type_name[CS_MATRIX_MSR],
+       _(cs_matrix_type_fullname[CS_MATRIX_MSR]));
+
+  unsigned n_iter = 0;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  const cs_lnum_t n_colors = c->setup_data->n_colors;
+  const cs_lnum_t  *restrict color_index = c->setup_data->color_index;
+  const cs_lnum_t  *restrict color_order = c->setup_data->color_order;
+
+  cvg = CS_SLES_ITERATING;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk: forward step */
+
+    for (cs_lnum_t g_id = 0; g_id < n_colors; g_id++) {
+
+      const cs_lnum_t s_id = color_index[g_id];
+      const cs_lnum_t e_id = color_index[g_id+1];
+
+      if (diag_block_size == 1) {
+
+#       pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+
+          cs_lnum_t ii = color_order[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0 = rhs[ii];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+          vx[ii] = vx0 * ad_inv[ii];
+
+        }
+
+      }
+      else {
+
+#       pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+
+          cs_lnum_t ii = color_order[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
+
+          for (cs_lnum_t kk = 0; kk < diag_block_size; kk++)
+            vx0[kk] = rhs[ii*db_size[1] + kk];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+            for (cs_lnum_t kk = 0; kk < diag_block_size; kk++)
+              vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          }
+
+          _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
+                           db_size[0],
+                           _vx,
+                           vx0);
+
+          for (cs_lnum_t kk = 0; kk < diag_block_size; kk++)
+            vx[ii*db_size[1] + kk] = _vx[kk];
+
+        }
+
+      }
+
+    }
+
+    /* Synchronize ghost cells again */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(rotation_mode, a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk and residue: backward step */
+
+    res2 = 0.0;
+
+    for (cs_lnum_t g_id = n_colors - 1; g_id > -1; g_id--) {
+
+      const cs_lnum_t s_id = color_index[g_id];
+      const cs_lnum_t e_id = color_index[g_id+1];
+
+      if (diag_block_size == 1) {
+
+#       pragma omp parallel for reduction(+:res2) \
+                            if(e_id - s_id > CS_THR_MIN)
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+
+          cs_lnum_t ii = color_order[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vxm1 = vx[ii];
+          cs_real_t vx0 = rhs[ii];
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+            vx0 -= (m_row[jj]*vx[col_id[jj]]);
+
+          vx0 *= ad_inv[ii];
+
+          register double r = ad[ii] * (vx0-vxm1);
+          res2 += (r*r);
+
+          vx[ii] = vx0;
+        }
+
+      }
+      else {
+
+#       pragma omp parallel for reduction(+:res2) \
+                            if(e_id - s_id > CS_THR_MIN)
+        for (cs_lnum_t ll = s_id; ll < e_id; ll++) {
+
+          cs_lnum_t ii = color_order[ll];
+
+          const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+          const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+          const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+          cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
+
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            vxm1[kk] = vx[ii*db_size[1] + kk];
+            vx0[kk] = rhs[ii*db_size[1] + kk];
+          }
+
+          for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+            for (cs_lnum_t kk = 0; kk < db_size[0]; kk++)
+              vx0[kk] -= (m_row[jj]*vx[col_id[jj]*db_size[1] + kk]);
+          }
+
+          _fw_and_bw_lu_gs(ad_inv + db_size[3]*ii,
+                           db_size[0],
+                           _vx,
+                           vx0);
+
+          double rr = 0;
+          for (cs_lnum_t kk = 0; kk < db_size[0]; kk++) {
+            register double r = ad[ii*db_size[1] + kk] * (_vx[kk]-vxm1[kk]);
+            rr += (r*r);
+            vx[ii*db_size[1] + kk] = _vx[kk];
+          }
+          res2 += rr;
+
+        }
+
+      }
+
+    }
+
+    if (convergence->precision > 0. || c->plot != NULL) {
+
+#if defined(HAVE_MPI)
+
+      if (c->comm != MPI_COMM_NULL) {
+        double _sum;
+        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        res2 = _sum;
+      }
+
+#endif /* defined(HAVE_MPI) */
+
+      residue = sqrt(res2); /* Actually, residue of previous iteration */
+
+      /* Convergence test */
+
+      if (n_iter == 1)
+        c->setup_data->initial_residue = residue;
+
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    }
+    else if (n_iter >= convergence->n_iterations_max) {
+      convergence->n_iterations = n_iter;
+      cvg = CS_SLES_MAX_ITERATION;
+    }
+
+  }
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Truncated forward Gauss-Seidel.
+ *
+ * This variant is intended for smoothing with a fixed number of
+ * iterations, so does not compute a residue or run a convergence test.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_ts_f_gauss_seidel_msr(cs_sles_it_t              *c,
+                       const cs_matrix_t         *a,
+                       int                        diag_block_size,
+                       cs_halo_rotation_t         rotation_mode,
+                       cs_sles_it_convergence_t  *convergence,
+                       const cs_real_t           *rhs,
+                       cs_real_t                 *restrict vx,
+                       size_t                     aux_size,
+                       void                      *aux_vectors)
+{
+  CS_UNUSED(rotation_mode);
+  CS_UNUSED(aux_size);
+  CS_UNUSED(aux_vectors);
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const cs_real_t  *a_d_val, *a_x_val;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  /* Single iteration */
+  /*------------------*/
+
+  /* Zeroe ghost cell values first */
+
+  cs_lnum_t s_id = n_rows*diag_block_size;
+  cs_lnum_t e_id = n_cols_ext*diag_block_size;
 
   for (cs_lnum_t ii = s_id; ii < e_id; ii++)
     vx[ii] = 0.0;
@@ -4594,6 +5913,148 @@ _fallback(cs_sles_it_t                    *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Project initial guess on the recycled solution subspace.
+ *
+ * As the basis vectors are A-orthonormal, the Galerkin projection of the
+ * initial residual reduces to a series of dot products, after which that
+ * residual is A-orthogonal to the subspace spanned by previous solutions.
+ *
+ * The basis is reset here if the system size has changed.
+ *
+ * parameters:
+ *   c               <-> pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution (initial guess on entry)
+ *----------------------------------------------------------------------------*/
+
+static void
+_defl_project_guess(cs_sles_it_t        *c,
+                    const cs_matrix_t   *a,
+                    cs_lnum_t            diag_block_size,
+                    cs_halo_rotation_t   rotation_mode,
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+  cs_real_t *r;
+
+  /* Reset basis if the system size has changed */
+
+  if (c->defl_size != n_cols) {
+    c->n_defl = 0;
+    c->defl_size = n_cols;
+    BFT_REALLOC(c->defl_v, (size_t)n_cols*c->n_defl_max, cs_real_t);
+    BFT_REALLOC(c->defl_av, (size_t)n_cols*c->n_defl_max, cs_real_t);
+  }
+
+  if (c->n_defl < 1)
+    return;
+
+  BFT_MALLOC(r, n_cols, cs_real_t);
+
+  cs_matrix_vector_multiply(rotation_mode, a, vx, r);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    r[ii] = rhs[ii] - r[ii];
+
+  for (int i = 0; i < c->n_defl; i++) {
+
+    const cs_real_t *restrict w = c->defl_v + (size_t)i*n_cols;
+
+    double alpha = _dot_product(c, r, w);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] += alpha*w[ii];
+
+  }
+
+  BFT_FREE(r);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a solution to the recycled subspace basis.
+ *
+ * The solution is A-orthogonalized relative to the current basis vectors
+ * using modified Gram-Schmidt, then normalized; near-zero contributions
+ * (i.e. solutions almost contained in the current subspace) are ignored.
+ * When the basis is full, it is restarted with the most recent solution.
+ *
+ * parameters:
+ *   c               <-> pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   rotation_mode   <-- halo update option for rotational periodicity
+ *   vx              <-- system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_defl_add_vector(cs_sles_it_t        *c,
+                 const cs_matrix_t   *a,
+                 cs_lnum_t            diag_block_size,
+                 cs_halo_rotation_t   rotation_mode,
+                 const cs_real_t     *vx)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+  if (c->defl_size != n_cols)
+    return;
+
+  /* When the basis is full, restart it with the most recent solution */
+
+  if (c->n_defl >= c->n_defl_max)
+    c->n_defl = 0;
+
+  cs_real_t *restrict v = c->defl_v + (size_t)c->n_defl*n_cols;
+  cs_real_t *restrict av = c->defl_av + (size_t)c->n_defl*n_cols;
+
+# pragma omp parallel for if(n_cols > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cols; ii++)
+    v[ii] = (ii < n_rows) ? vx[ii] : 0.;
+
+  /* Modified Gram-Schmidt A-orthogonalization relative to current basis
+     (for symmetric A, w.A.v may be computed using the saved A.w products) */
+
+  for (int i = 0; i < c->n_defl; i++) {
+
+    const cs_real_t *restrict wi = c->defl_v + (size_t)i*n_cols;
+    const cs_real_t *restrict awi = c->defl_av + (size_t)i*n_cols;
+
+    double beta = _dot_product(c, awi, v);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      v[ii] -= beta*wi[ii];
+
+  }
+
+  cs_matrix_vector_multiply(rotation_mode, a, v, av);
+
+  double gamma = _dot_product(c, v, av);
+
+  if (gamma > 1.e-60) {
+
+    double scale = 1./sqrt(gamma);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      v[ii] *= scale;
+      av[ii] *= scale;
+    }
+
+    c->n_defl += 1;
+
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -4666,6 +6127,9 @@ cs_sles_it_define(int                 f_id,
   cs_sles_set_error_handler(sc,
                             cs_sles_it_error_post_and_abort);
 
+  cs_sles_set_solve_multi(sc,
+                          cs_sles_it_solve_multi);
+
   return c;
 }
 
@@ -4701,6 +6165,8 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   case CS_SLES_JACOBI:
   case CS_SLES_P_GAUSS_SEIDEL:
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
+  case CS_SLES_P_MC_GAUSS_SEIDEL:
+  case CS_SLES_P_MC_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
     c->_pc = NULL;
@@ -4772,6 +6238,12 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
 
   c->fallback = NULL;
 
+  c->n_defl_max = 0;
+  c->n_defl = 0;
+  c->defl_size = 0;
+  c->defl_v = NULL;
+  c->defl_av = NULL;
+
   return c;
 }
 
@@ -4804,6 +6276,8 @@ cs_sles_it_destroy(void **context)
       BFT_FREE(c->add_data->order);
       BFT_FREE(c->add_data);
     }
+    BFT_FREE(c->defl_v);
+    BFT_FREE(c->defl_av);
     BFT_FREE(c);
     *context = c;
   }
@@ -4845,6 +6319,8 @@ cs_sles_it_copy(const void  *context)
 #if defined(HAVE_MPI)
     d->comm = c->comm;
 #endif
+
+    d->n_defl_max = c->n_defl_max;
   }
 
   return d;
@@ -5048,6 +6524,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _conjugate_gradient_ip;
     break;
 
+  case CS_SLES_PIPECG:
+    c->solve = _pipelined_conjugate_gradient;
+    break;
+
   case CS_SLES_JACOBI:
     if (diag_block_size == 1)
       c->solve = _jacobi;
@@ -5080,6 +6560,15 @@ cs_sles_it_setup(void               *context,
     c->solve = _p_sym_gauss_seidel_msr;
     break;
 
+  case CS_SLES_P_MC_GAUSS_SEIDEL:
+    _setup_gs_coloring(c, a);
+    c->solve = _p_mc_gauss_seidel_msr;
+    break;
+  case CS_SLES_P_MC_SYM_GAUSS_SEIDEL:
+    _setup_gs_coloring(c, a);
+    c->solve = _p_mc_sym_gauss_seidel_msr;
+    break;
+
   case CS_SLES_TS_F_GAUSS_SEIDEL:
     c->solve = _ts_f_gauss_seidel_msr;
     c->ignore_convergence = true;
@@ -5210,11 +6699,20 @@ cs_sles_it_solve(void                *context,
   if (c->caller_n_ranks < 2 || c->comm != MPI_COMM_NULL) {
 #endif
 
+    /* When subspace recycling is active, improve the initial guess by
+       projection on the basis built from previous solutions */
+
+    if (c->n_defl_max > 0)
+      _defl_project_guess(c, a, _diag_block_size, rotation_mode, rhs, vx);
+
     cvg = c->solve(c,
                    a, _diag_block_size, rotation_mode, &convergence,
                    rhs, vx,
                    aux_size, aux_vectors);
 
+    if (c->n_defl_max > 0 && cvg == CS_SLES_CONVERGED)
+      _defl_add_vector(c, a, _diag_block_size, rotation_mode, vx);
+
 #if defined(HAVE_MPI)
   }
 #endif
@@ -5282,6 +6780,223 @@ cs_sles_it_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call iterative sparse linear equation solver for several
+ *        right-hand sides sharing the same matrix.
+ *
+ * For Jacobi on scalar MSR matrices, a batched variant is used, reading
+ * each matrix row once per sweep for all systems still iterating, so
+ * matrix traffic is amortized over the right-hand sides; otherwise, the
+ * systems are simply solved one after the other.
+ *
+ * Each system is converged independently, with the same precision
+ * criteria.
+ *
+ * \param[in, out]  context        pointer to iterative solver info and context
+ *                                 (actual type: cs_sles_it_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       rotation_mode  halo update option for rotational
+ *                                 periodicity
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residue normalization
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[out]      n_iter         number of "equivalent" iterations per system
+ * \param[out]      residue        residue per system
+ * \param[in]       rhs            right hand side pointers (size: n_rhs)
+ * \param[in, out]  vx             system solution pointers (size: n_rhs)
+ * \param[in]       aux_size       number of elements in aux_vectors (in bytes)
+ * \param           aux_vectors    optional working area
+ *                                 (internal allocation if NULL)
+ *
+ * \return  convergence state of least converged system
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                   *context,
+                       const char             *name,
+                       const cs_matrix_t      *a,
+                       int                     verbosity,
+                       cs_halo_rotation_t      rotation_mode,
+                       double                  precision,
+                       double                  r_norm,
+                       int                     n_rhs,
+                       int                     n_iter[],
+                       double                  residue[],
+                       const cs_real_t *const  rhs[],
+                       cs_real_t *const        vx[],
+                       size_t                  aux_size,
+                       void                   *aux_vectors)
+{
+  cs_sles_it_t  *c = context;
+
+  cs_timer_t t0, t1;
+
+  const int *diag_block_size = cs_matrix_get_diag_block_size(a);
+
+  /* Check if the batched variant may be used; otherwise, simply
+     solve each system in turn */
+
+  bool batch = (   n_rhs > 1
+                && c->type == CS_SLES_JACOBI
+                && diag_block_size[0] == 1
+                && cs_matrix_get_type(a) == CS_MATRIX_MSR
+                && c->n_defl_max <= 0
+                && c->ignore_convergence == false);
+
+#if defined(HAVE_MPI)
+  if (c->caller_n_ranks > 1 && c->comm != c->caller_comm)
+    batch = false;
+#endif
+
+  if (batch == false) {
+
+    cs_sles_convergence_state_t cvg_min = CS_SLES_CONVERGED;
+
+    for (int i = 0; i < n_rhs; i++) {
+      cs_sles_convergence_state_t cvg = cs_sles_it_solve(context,
+                                                         name,
+                                                         a,
+                                                         verbosity,
+                                                         rotation_mode,
+                                                         precision,
+                                                         r_norm,
+                                                         n_iter + i,
+                                                         residue + i,
+                                                         rhs[i],
+                                                         vx[i],
+                                                         aux_size,
+                                                         aux_vectors);
+      if (cvg < cvg_min)
+        cvg_min = cvg;
+    }
+
+    return cvg_min;
+
+  }
+
+  if (c->update_stats == true)
+    t0 = cs_timer_time();
+
+  for (int i = 0; i < n_rhs; i++)
+    n_iter[i] = 0;
+
+  /* Setup if not already done */
+
+  if (c->setup_data == NULL) {
+
+    if (c->update_stats) { /* Stop solve timer to switch to setup timer */
+      t1 = cs_timer_time();
+      cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+    }
+
+    cs_sles_it_setup(c, name, a, verbosity);
+
+    if (c->update_stats) /* Restart solve timer */
+      t0 = cs_timer_time();
+
+  }
+
+  /* Solve sparse linear systems */
+
+  cs_sles_it_convergence_t  *convergence;
+  cs_sles_convergence_state_t  *cvg;
+
+  BFT_MALLOC(convergence, n_rhs, cs_sles_it_convergence_t);
+  BFT_MALLOC(cvg, n_rhs, cs_sles_convergence_state_t);
+
+  for (int i = 0; i < n_rhs; i++)
+    _convergence_init(convergence + i,
+                      name,
+                      verbosity,
+                      c->n_max_iter,
+                      precision,
+                      r_norm,
+                      residue + i);
+
+  c->setup_data->initial_residue = -1;
+
+  if (verbosity > 1)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _(" RHS norm:          %11.4e\n\n"), r_norm);
+
+  cs_sles_convergence_state_t cvg_min = _jacobi_multi(c,
+                                                      a,
+                                                      rotation_mode,
+                                                      n_rhs,
+                                                      convergence,
+                                                      cvg,
+                                                      rhs,
+                                                      vx,
+                                                      aux_size,
+                                                      aux_vectors);
+
+  /* Update return values */
+
+  for (int i = 0; i < n_rhs; i++) {
+    n_iter[i] = convergence[i].n_iterations;
+    residue[i] = convergence[i].residue;
+  }
+
+  if (c->update_stats == true) {
+
+    t1 = cs_timer_time();
+
+    c->n_solves += n_rhs;
+
+    for (int i = 0; i < n_rhs; i++) {
+      unsigned _n_iter = convergence[i].n_iterations;
+      if (c->n_iterations_tot == 0)
+        c->n_iterations_min = _n_iter;
+      else if (c->n_iterations_min > _n_iter)
+        c->n_iterations_min = _n_iter;
+      if (c->n_iterations_max < _n_iter)
+        c->n_iterations_max = _n_iter;
+      c->n_iterations_last = _n_iter;
+      c->n_iterations_tot += _n_iter;
+    }
+
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  }
+
+  /* Re-solve unconverged systems individually, so the standard
+     fallback mechanism may be applied */
+
+  if (cvg_min < c->fallback_cvg) {
+
+    cvg_min = CS_SLES_CONVERGED;
+
+    for (int i = 0; i < n_rhs; i++) {
+      if (cvg[i] < c->fallback_cvg)
+        cvg[i] = cs_sles_it_solve(context,
+                                  name,
+                                  a,
+                                  verbosity,
+                                  rotation_mode,
+                                  precision,
+                                  r_norm,
+                                  n_iter + i,
+                                  residue + i,
+                                  rhs[i],
+                                  vx[i],
+                                  aux_size,
+                                  aux_vectors);
+      if (cvg[i] < cvg_min)
+        cvg_min = cvg[i];
+    }
+
+  }
+
+  BFT_FREE(cvg);
+  BFT_FREE(convergence);
+
+  return cvg_min;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free iterative sparse linear equation solver setup context.
@@ -5312,6 +7027,8 @@ cs_sles_it_free(void  *context)
 
   if (c->setup_data != NULL) {
     BFT_FREE(c->setup_data->_ad_inv);
+    BFT_FREE(c->setup_data->color_index);
+    BFT_FREE(c->setup_data->color_order);
     BFT_FREE(c->setup_data);
   }
 
@@ -5605,6 +7322,41 @@ cs_sles_it_set_fallback_threshold(cs_sles_it_t                 *context,
   context->fallback_cvg = threshold;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of solution vectors recycled between successive
+ *        solves.
+ *
+ * When this number is greater than 0, an A-orthonormal basis of up to
+ * that many previous solutions is maintained across solves, and new
+ * right-hand sides are projected on it to improve the initial guess
+ * before iterating. This is intended for series of systems sharing the
+ * same (symmetric) matrix and differing mainly by their right-hand side,
+ * such as successive pressure solves over time steps.
+ *
+ * The basis is reset whenever the system size changes; recycled vectors
+ * require 2 vectors of additional storage each.
+ *
+ * \param[in, out]  context    pointer to iterative solver info and context
+ * \param[in]       n_vectors  maximum number of recycled solution vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_n_recycled_vectors(cs_sles_it_t  *context,
+                                  int            n_vectors)
+{
+  cs_sles_it_t  *c = context;
+
+  if (c->n_defl_max != n_vectors) {
+    c->n_defl_max = CS_MAX(n_vectors, 0);
+    c->n_defl = 0;
+    c->defl_size = 0;
+    BFT_FREE(c->defl_v);
+    BFT_FREE(c->defl_av);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Query mean number of rows under which Conjugate Gradient algorithm
@@ -5659,6 +7411,59 @@ cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether Jacobi solvers use a deferred convergence test.
+ *
+ * When this option is active, the parallel sum of the residue norm is
+ * computed using a non-blocking reduction, and the convergence decision
+ * is taken one iteration late, so the reduction latency is overlapped
+ * with the next sweep; this removes the only synchronization point per
+ * iteration of the Jacobi solvers, at the cost of one extra sweep.
+ *
+ * This option requires MPI-3, and is ignored for non-parallel runs,
+ * so false is returned in those cases.
+ *
+ * \returns  true if the deferred convergence test is used
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_get_deferred_convergence_test(void)
+{
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  return _jacobi_deferred_cv_test;
+#else
+  return false;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether Jacobi solvers should use a deferred convergence test.
+ *
+ * When this option is active, the parallel sum of the residue norm is
+ * computed using a non-blocking reduction, and the convergence decision
+ * is taken one iteration late, so the reduction latency is overlapped
+ * with the next sweep; this removes the only synchronization point per
+ * iteration of the Jacobi solvers, at the cost of one extra sweep.
+ *
+ * This option requires MPI-3, and is ignored for non-parallel runs.
+ *
+ * \param[in]  deferred  true to activate the deferred convergence test
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_deferred_convergence_test(bool  deferred)
+{
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  _jacobi_deferred_cv_test = deferred;
+#else
+  CS_UNUSED(deferred);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Log the current global settings relative to parallelism.
@@ -5673,8 +7478,10 @@ cs_sles_it_log_parallel_options(void)
     cs_log_printf(CS_LOG_SETUP,
                   _("\n"
                     "Iterative linear solvers parallel parameters:\n"
-                    "  PCG single-reduction threshold:     %d\n"),
-                 _pcg_sr_threshold);
+                    "  PCG single-reduction threshold:     %d\n"
+                    "  Jacobi deferred convergence test:   %d\n"),
+                 _pcg_sr_threshold,
+                 (int)cs_sles_it_get_deferred_convergence_test());
 #endif
 }
 
@@ -59,12 +59,17 @@ typedef enum {
   CS_SLES_PCG,                 /* Preconditionned conjugate gradient */
   CS_SLES_FCG,                 /* Preconditionned flexible conjugate gradient */
   CS_SLES_IPCG,                /* Preconditionned inexact conjugate gradient */
+  CS_SLES_PIPECG,              /* Pipelined preconditionned conjugate
+                                  gradient */
   CS_SLES_JACOBI,              /* Jacobi */
   CS_SLES_BICGSTAB,            /* Bi-conjugate gradient stabilized */
   CS_SLES_BICGSTAB2,           /* Bi-conjugate gradient stabilized - 2*/
   CS_SLES_GMRES,               /* Generalized minimal residual */
   CS_SLES_P_GAUSS_SEIDEL,      /* Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /* Process-local symmetric Gauss-Seidel */
+  CS_SLES_P_MC_GAUSS_SEIDEL,   /* Process-local multicolor Gauss-Seidel */
+  CS_SLES_P_MC_SYM_GAUSS_SEIDEL, /* Process-local multicolor symmetric
+                                  Gauss-Seidel */
   CS_SLES_TS_F_GAUSS_SEIDEL,   /* Truncated forward Gauss-Seidel
                                   smoothing */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /* Truncated backward Gauss-Seidel
@@ -227,6 +232,51 @@ cs_sles_it_solve(void                *context,
                  size_t               aux_size,
                  void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Call iterative sparse linear equation solver for several right-hand
+ * sides sharing the same matrix.
+ *
+ * For Jacobi on scalar MSR matrices, a batched variant is used, amortizing
+ * matrix traffic over the right-hand sides; otherwise, the systems are
+ * simply solved one after the other.
+ *
+ * parameters:
+ *   context       <-> pointer to iterative sparse linear solver info
+ *                     (actual type: cs_sles_it_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- verbosity level
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   precision     <-- solver precision
+ *   r_norm        <-- residue normalization
+ *   n_rhs         <-- number of right-hand sides
+ *   n_iter        --> number of iterations per system
+ *   residue       --> residue per system
+ *   rhs           <-- right hand side pointers (size: n_rhs)
+ *   vx            <-> system solution pointers (size: n_rhs)
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area (internal allocation if NULL)
+ *
+ * returns:
+ *   convergence state of least converged system
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                   *context,
+                       const char             *name,
+                       const cs_matrix_t      *a,
+                       int                     verbosity,
+                       cs_halo_rotation_t      rotation_mode,
+                       double                  precision,
+                       double                  r_norm,
+                       int                     n_rhs,
+                       int                     n_iter[],
+                       double                  residue[],
+                       const cs_real_t *const  rhs[],
+                       cs_real_t *const        vx[],
+                       size_t                  aux_size,
+                       void                   *aux_vectors);
+
 /*----------------------------------------------------------------------------
  * Free iterative sparse linear equation solver setup context.
  *
@@ -429,6 +479,25 @@ void
 cs_sles_it_set_fallback_threshold(cs_sles_it_t                 *context,
                                   cs_sles_convergence_state_t   threshold);
 
+/*----------------------------------------------------------------------------
+ * Set the number of solution vectors recycled between successive solves.
+ *
+ * When this number is greater than 0, an A-orthonormal basis of up to
+ * that many previous solutions is maintained across solves, and new
+ * right-hand sides are projected on it to improve the initial guess
+ * before iterating. This is intended for series of systems sharing the
+ * same (symmetric) matrix and differing mainly by their right-hand side,
+ * such as successive pressure solves over time steps.
+ *
+ * parameters:
+ *   context   <-> pointer to iterative solver info and context
+ *   n_vectors <-- maximum number of recycled solution vectors
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_n_recycled_vectors(cs_sles_it_t  *context,
+                                  int            n_vectors);
+
 /*----------------------------------------------------------------------------
  * Query mean number of rows under which Conjugate Gradient algorithm
  * uses the single-reduction variant.
@@ -469,6 +538,43 @@ cs_sles_it_get_pcg_single_reduction(void);
 void
 cs_sles_it_set_pcg_single_reduction(cs_lnum_t  threshold);
 
+/*----------------------------------------------------------------------------
+ * Query whether Jacobi solvers use a deferred convergence test.
+ *
+ * When this option is active, the parallel sum of the residue norm is
+ * computed using a non-blocking reduction, and the convergence decision
+ * is taken one iteration late, so the reduction latency is overlapped
+ * with the next sweep; this removes the only synchronization point per
+ * iteration of the Jacobi solvers, at the cost of one extra sweep.
+ *
+ * This option requires MPI-3, and is ignored for non-parallel runs,
+ * so false is returned in those cases.
+ *
+ * return:
+ *   true if the deferred convergence test is used
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_sles_it_get_deferred_convergence_test(void);
+
+/*----------------------------------------------------------------------------
+ * Set whether Jacobi solvers should use a deferred convergence test.
+ *
+ * When this option is active, the parallel sum of the residue norm is
+ * computed using a non-blocking reduction, and the convergence decision
+ * is taken one iteration late, so the reduction latency is overlapped
+ * with the next sweep; this removes the only synchronization point per
+ * iteration of the Jacobi solvers, at the cost of one extra sweep.
+ *
+ * This option requires MPI-3, and is ignored for non-parallel runs.
+ *
+ * parameters:
+ *   deferred <-- true to activate the deferred convergence test
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_deferred_convergence_test(bool  deferred);
+
 /*----------------------------------------------------------------------------
  * Log the current global settings relative to parallelism.
  *----------------------------------------------------------------------------*/
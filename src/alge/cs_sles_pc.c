@@ -296,6 +296,29 @@ typedef struct {
 
 } cs_sles_pc_poly_t;
 
+/* Structure for local ILU(0) preconditioner */
+/*-------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t            n_rows;            /* Number of associated rows */
+  cs_lnum_t            n_cols;            /* Number of associated columns */
+
+  const cs_matrix_t   *a;                 /* Pointer to associated matrix */
+  const cs_lnum_t     *row_index;         /* Pointer to MSR row index */
+  const cs_lnum_t     *col_id;            /* Pointer to MSR column ids */
+
+  cs_real_t           *d_inv;             /* Inverse of factored diagonal */
+  cs_real_t           *e_val;             /* Factored extra-diagonal values */
+
+  /* Level schedules for the triangular solves (0: lower, 1: upper) */
+
+  cs_lnum_t            n_levels[2];       /* Number of levels */
+  cs_lnum_t           *level_idx[2];      /* Start index of each level */
+  cs_lnum_t           *level_rows[2];     /* Row ids, grouped by level */
+
+} cs_sles_pc_ilu_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -661,6 +684,467 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create a local ILU(0) preconditioner structure.
+ *
+ * returns:
+ *   pointer to newly created preconditioner object.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_ilu_t *
+_sles_pc_ilu_create(void)
+{
+  cs_sles_pc_ilu_t *pc;
+
+  BFT_MALLOC(pc, 1, cs_sles_pc_ilu_t);
+
+  pc->n_rows = 0;
+  pc->n_cols = 0;
+
+  pc->a = NULL;
+  pc->row_index = NULL;
+  pc->col_id = NULL;
+
+  pc->d_inv = NULL;
+  pc->e_val = NULL;
+
+  for (int i = 0; i < 2; i++) {
+    pc->n_levels[i] = 0;
+    pc->level_idx[i] = NULL;
+    pc->level_rows[i] = NULL;
+  }
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_ilu_get_type(const void  *context,
+                      bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false)
+    return "ilu0";
+  else
+    return _("ILU(0), local");
+}
+
+/*----------------------------------------------------------------------------
+ * Find the position of a column in a row with ordered column ids.
+ *
+ * parameters:
+ *   col_id <-- MSR column ids
+ *   s_id   <-- start index of row
+ *   e_id   <-- past-the-end index of row
+ *   col    <-- column searched for
+ *
+ * returns:
+ *   index of matching entry, or -1 if not present
+ *----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_ilu_col_index(const cs_lnum_t  *col_id,
+               cs_lnum_t         s_id,
+               cs_lnum_t         e_id,
+               cs_lnum_t         col)
+{
+  while (s_id < e_id) {
+    cs_lnum_t m_id = s_id + (e_id - s_id)/2;
+    if (col_id[m_id] < col)
+      s_id = m_id + 1;
+    else if (col_id[m_id] > col)
+      e_id = m_id;
+    else
+      return m_id;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a level schedule for a triangular solve.
+ *
+ * Rows are grouped into levels such that rows of a same level have no
+ * dependencies between them, based on the local (renumbered) row ordering:
+ * for the lower (upper) solve, the level of a row is one more than the
+ * highest level of its lower (upper) local neighbors.
+ *
+ * parameters:
+ *   c  <-> pointer to preconditioner context
+ *   ud <-- 0 for the lower solve, 1 for the upper solve
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_order_levels(cs_sles_pc_ilu_t  *c,
+                          int                ud)
+{
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+
+  cs_lnum_t *lvl;
+  BFT_MALLOC(lvl, n_rows, cs_lnum_t);
+
+  cs_lnum_t n_levels = 0;
+
+  if (ud == 0) {
+
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_lnum_t l = 0;
+      for (cs_lnum_t kk = row_index[ii]; kk < row_index[ii+1]; kk++) {
+        cs_lnum_t jj = col_id[kk];
+        if (jj < ii && lvl[jj] >= l)
+          l = lvl[jj] + 1;
+      }
+      lvl[ii] = l;
+      if (l >= n_levels)
+        n_levels = l + 1;
+    }
+
+  }
+  else {
+
+    for (cs_lnum_t ii = n_rows-1; ii >= 0; ii--) {
+      cs_lnum_t l = 0;
+      for (cs_lnum_t kk = row_index[ii]; kk < row_index[ii+1]; kk++) {
+        cs_lnum_t jj = col_id[kk];
+        if (jj > ii && jj < n_rows && lvl[jj] >= l)
+          l = lvl[jj] + 1;
+      }
+      lvl[ii] = l;
+      if (l >= n_levels)
+        n_levels = l + 1;
+    }
+
+  }
+
+  c->n_levels[ud] = n_levels;
+  BFT_REALLOC(c->level_idx[ud], n_levels + 1, cs_lnum_t);
+  BFT_REALLOC(c->level_rows[ud], n_rows, cs_lnum_t);
+
+  cs_lnum_t *restrict level_idx = c->level_idx[ud];
+  cs_lnum_t *restrict level_rows = c->level_rows[ud];
+
+  for (cs_lnum_t l = 0; l < n_levels + 1; l++)
+    level_idx[l] = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    level_idx[lvl[ii] + 1] += 1;
+  for (cs_lnum_t l = 0; l < n_levels; l++)
+    level_idx[l+1] += level_idx[l];
+
+  cs_lnum_t *shift;
+  BFT_MALLOC(shift, n_levels, cs_lnum_t);
+  for (cs_lnum_t l = 0; l < n_levels; l++)
+    shift[l] = level_idx[l];
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    level_rows[shift[lvl[ii]]++] = ii;
+
+  BFT_FREE(shift);
+  BFT_FREE(lvl);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the in-place ILU(0) factorization of the local submatrix.
+ *
+ * The rows of a given level of the lower solve schedule have no
+ * dependencies between them, so the factorization itself is threaded
+ * level by level.
+ *
+ * parameters:
+ *   c    <-> pointer to preconditioner context
+ *   name <-- pointer to name of associated linear system
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_factor(cs_sles_pc_ilu_t  *c,
+                    const char        *name)
+{
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+
+  cs_real_t *restrict e_val = c->e_val;
+  cs_real_t *restrict d = c->d_inv;   /* holds diagonal until inverted */
+
+  const cs_lnum_t *level_idx = c->level_idx[0];
+  const cs_lnum_t *level_rows = c->level_rows[0];
+
+  for (cs_lnum_t l = 0; l < c->n_levels[0]; l++) {
+
+    const cs_lnum_t s_id = level_idx[l], e_id = level_idx[l+1];
+
+#   pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t r_id = s_id; r_id < e_id; r_id++) {
+
+      cs_lnum_t ii = level_rows[r_id];
+
+      for (cs_lnum_t kk = row_index[ii]; kk < row_index[ii+1]; kk++) {
+
+        cs_lnum_t jk = col_id[kk];
+        if (jk >= ii)   /* column ids are ordered */
+          break;
+
+        cs_real_t m = e_val[kk] / d[jk];
+        e_val[kk] = m;
+
+        /* Update row ii with the upper local part of row jk */
+
+        for (cs_lnum_t pp = row_index[jk]; pp < row_index[jk+1]; pp++) {
+          cs_lnum_t jj = col_id[pp];
+          if (jj <= jk || jj >= n_rows)
+            continue;
+          if (jj == ii)
+            d[ii] -= m * e_val[pp];
+          else {
+            cs_lnum_t qq = _ilu_col_index(col_id,
+                                          row_index[ii],
+                                          row_index[ii+1],
+                                          jj);
+            if (qq > -1)
+              e_val[qq] -= m * e_val[pp];
+          }
+        }
+
+      }
+
+    }
+
+  }
+
+  /* Invert factored diagonal */
+
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    if (fabs(d[ii]) <= 0.)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Zero pivot in ILU(0) factorization for system \"%s\"\n"
+                  "(row %ld)."), name, (long)ii);
+    d[ii] = 1. / d[ii];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_setup(void               *context,
+                   const char         *name,
+                   const cs_matrix_t  *a,
+                   int                 verbosity)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  const int *db_size = cs_matrix_get_diag_block_size(a);
+
+  if (cs_matrix_get_type(a) != CS_MATRIX_MSR || db_size[0] > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("ILU(0) preconditioning of system \"%s\" requires a matrix\n"
+                "in MSR format with scalar diagonal blocks."), name);
+
+  c->a = a;
+  c->n_rows = cs_matrix_get_n_rows(a);
+  c->n_cols = cs_matrix_get_n_columns(a);
+
+  const cs_real_t *d_val = NULL, *x_val = NULL;
+  cs_matrix_get_msr_arrays(a, &c->row_index, &c->col_id, &d_val, &x_val);
+
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t nnz = c->row_index[n_rows];
+
+  BFT_REALLOC(c->d_inv, n_rows, cs_real_t);
+  BFT_REALLOC(c->e_val, nnz, cs_real_t);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    c->d_inv[ii] = d_val[ii];
+
+# pragma omp parallel for if(nnz > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < nnz; ii++)
+    c->e_val[ii] = x_val[ii];
+
+  _sles_pc_ilu_order_levels(c, 0);
+  _sles_pc_ilu_order_levels(c, 1);
+
+  _sles_pc_ilu_factor(c, name);
+
+  if (verbosity > 2)
+    bft_printf(_(" ILU(0) preconditioner for \"%s\":\n"
+                 "   %ld lower, %ld upper solve levels for %ld rows\n"),
+               name, (long)c->n_levels[0], (long)c->n_levels[1],
+               (long)n_rows);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) preconditioner.
+ *
+ * The lower and upper triangular solves proceed one level at a time,
+ * rows of a same level being independent and handled in parallel.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_ilu_apply(void                *context,
+                   cs_halo_rotation_t   rotation_mode,
+                   const cs_real_t     *x_in,
+                   cs_real_t           *x_out)
+{
+  CS_UNUSED(rotation_mode);
+
+  cs_sles_pc_ilu_t  *c = context;
+
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_real_t *restrict e_val = c->e_val;
+  const cs_real_t *restrict d_inv = c->d_inv;
+
+  if (x_in != NULL) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      x_out[ii] = x_in[ii];
+  }
+
+  /* Forward solve with unit lower factor */
+
+  const cs_lnum_t *level_idx = c->level_idx[0];
+  const cs_lnum_t *level_rows = c->level_rows[0];
+
+  for (cs_lnum_t l = 0; l < c->n_levels[0]; l++) {
+
+    const cs_lnum_t s_id = level_idx[l], e_id = level_idx[l+1];
+
+#   pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t r_id = s_id; r_id < e_id; r_id++) {
+      cs_lnum_t ii = level_rows[r_id];
+      cs_real_t s = 0;
+      for (cs_lnum_t kk = row_index[ii]; kk < row_index[ii+1]; kk++) {
+        cs_lnum_t jj = col_id[kk];
+        if (jj >= ii)   /* column ids are ordered */
+          break;
+        s += e_val[kk] * x_out[jj];
+      }
+      x_out[ii] -= s;
+    }
+
+  }
+
+  /* Backward solve with upper factor */
+
+  level_idx = c->level_idx[1];
+  level_rows = c->level_rows[1];
+
+  for (cs_lnum_t l = 0; l < c->n_levels[1]; l++) {
+
+    const cs_lnum_t s_id = level_idx[l], e_id = level_idx[l+1];
+
+#   pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+    for (cs_lnum_t r_id = s_id; r_id < e_id; r_id++) {
+      cs_lnum_t ii = level_rows[r_id];
+      cs_real_t s = 0;
+      for (cs_lnum_t kk = row_index[ii]; kk < row_index[ii+1]; kk++) {
+        cs_lnum_t jj = col_id[kk];
+        if (jj > ii && jj < n_rows)
+          s += e_val[kk] * x_out[jj];
+      }
+      x_out[ii] = (x_out[ii] - s) * d_inv[ii];
+    }
+
+  }
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of an ILU(0) preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_free(void  *context)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  c->n_rows = 0;
+  c->n_cols = 0;
+
+  c->a = NULL;
+  c->row_index = NULL;
+  c->col_id = NULL;
+
+  BFT_FREE(c->d_inv);
+  BFT_FREE(c->e_val);
+
+  for (int i = 0; i < 2; i++) {
+    c->n_levels[i] = 0;
+    BFT_FREE(c->level_idx[i]);
+    BFT_FREE(c->level_rows[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of an ILU(0) preconditioner context based on the
+ * copy of another.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_ilu_clone(const void  *context)
+{
+  CS_UNUSED(context);
+
+  return _sles_pc_ilu_create();
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_destroy(void  **context)
+{
+  if (context != NULL) {
+    _sles_pc_ilu_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1123,6 +1607,38 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a local ILU(0) preconditioner.
+ *
+ * The associated matrix must be in MSR format, with scalar diagonal
+ * blocks. The factorization is restricted to the local submatrix
+ * (equivalent to block-Jacobi across MPI ranks), and the triangular
+ * solves are parallelized using level scheduling over the local
+ * (renumbered) row ordering.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void)
+{
+  cs_sles_pc_ilu_t *pci = _sles_pc_ilu_create();
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pci,
+                                       _sles_pc_ilu_get_type,
+                                       _sles_pc_ilu_setup,
+                                       NULL,
+                                       _sles_pc_ilu_apply,
+                                       _sles_pc_ilu_free,
+                                       NULL,
+                                       _sles_pc_ilu_clone,
+                                       _sles_pc_ilu_destroy);
+
+  return pc;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -508,6 +508,23 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a local ILU(0) preconditioner.
+ *
+ * The associated matrix must be in MSR format, with scalar diagonal
+ * blocks. The factorization is restricted to the local submatrix
+ * (equivalent to block-Jacobi across MPI ranks), and the triangular
+ * solves are parallelized using level scheduling over the local
+ * (renumbered) row ordering.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -174,6 +174,11 @@ typedef struct {
 
   cs_matrix_row_info_t   r;              /* Access buffer */
 
+  cs_real_t             *x;              /* Work array large enough for
+                                            ghost values, as the arrays of
+                                            PETSc work vectors only cover
+                                            local rows */
+
 } _mat_shell_t;
 
 /*============================================================================
@@ -290,7 +295,8 @@ _shell_mat_mult(Mat  a,
                 Vec  y)
 {
   _mat_shell_t *sh;
-  PetscScalar *ax, *ay;
+  const PetscScalar *ax;
+  PetscScalar *ay;
 
   assert(sizeof(PetscScalar) == sizeof(cs_real_t));
 
@@ -299,9 +305,17 @@ _shell_mat_mult(Mat  a,
   VecGetArrayRead(x, &ax);
   VecGetArray(y, &ay);
 
-  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, sh->a, ax, ay);
+  /* Stage x in a work array with room for ghost values, as the
+     matrix.vector product includes a halo update of x */
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(sh->a)[1];
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(sh->a) * db_size;
+
+  memcpy(sh->x, ax, n_rows*sizeof(cs_real_t));
 
-  VecRestoreArray(x, &ax);
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, sh->a, sh->x, ay);
+
+  VecRestoreArrayRead(x, &ax);
   VecRestoreArray(y, &ay);
 }
 
@@ -388,6 +402,8 @@ _shell_mat_duplicate(Mat                  a,
   MatShellGetContext(a, &sh);
 
   const cs_lnum_t n_rows = cs_matrix_get_n_rows(sh->a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(sh->a);
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(sh->a)[1];
 
   /* Shell matrix */
 
@@ -396,6 +412,7 @@ _shell_mat_duplicate(Mat                  a,
   BFT_MALLOC(shc, 1, _mat_shell_t);
   shc->a = sh->a;
   cs_matrix_row_init(&(shc->r));
+  BFT_MALLOC(shc->x, n_cols_ext*db_size, cs_real_t);
 
   MatCreateShell(PETSC_COMM_WORLD,
                  n_rows,
@@ -428,6 +445,7 @@ _shell_mat_destroy(Mat                  a,
 
   cs_matrix_row_finalize(&(sh->r));
 
+  BFT_FREE(sh->x);
   BFT_FREE(sh);
 }
 
@@ -515,6 +533,12 @@ cs_user_sles_petsc_hook(void               *context,
  * the matrix type will be forced to MATSHELL ("shell") regardless
  * of the option used.
  *
+ * A shell matrix wraps the code_saturne matrix without copying it, with
+ * matrix.vector products calling back into the native implementation;
+ * preconditioners requiring an assembled matrix (such as GAMG) need an
+ * assembled type instead, or a separate preconditioning matrix set
+ * through the setup hook.
+ *
  * Note that this function returns a pointer directly to the iterative solver
  * management structure. This may be used to set further options.
  * If needed, \ref cs_sles_find may be used to obtain a pointer to the matching
@@ -522,7 +546,8 @@ cs_user_sles_petsc_hook(void               *context,
  *
  * \param[in]      f_id          associated field id, or < 0
  * \param[in]      name          associated name if f_id < 0, or NULL
- * \param[in]      matrix_type   PETSc matrix type
+ * \param[in]      matrix_type   PETSc matrix type, or NULL for a zero-copy
+ *                               shell matrix (MATSHELL)
  * \param[in]      setup_hook    pointer to optional setup epilogue function
  * \param[in,out]  context       pointer to optional (untyped) value or
  *                               structure for setup_hook, or NULL
@@ -568,7 +593,8 @@ cs_sles_petsc_define(int                          f_id,
  * the matrix type will be forced to MATSHELL ("shell") regardless
  * of the option used.
  *
- * \param[in]      matrix_type   PETSc matrix type
+ * \param[in]      matrix_type   PETSc matrix type, or NULL for a zero-copy
+ *                               shell matrix (MATSHELL)
  * \param[in]      setup_hook    pointer to optional setup epilogue function
  * \param[in,out]  context       pointer to optional (untyped) value or
  *                               structure for setup_hook, or NULL
@@ -629,6 +655,9 @@ cs_sles_petsc_create(MatType                      matrix_type,
 
   /* Setup data */
 
+  if (matrix_type == NULL)  /* zero-copy default */
+    matrix_type = MATSHELL;
+
   PetscStrallocpy(matrix_type, &c->mat_type[0]);
   c->mat_type[1] = NULL;
 
@@ -762,9 +791,13 @@ cs_sles_petsc_setup(void               *context,
 
     _mat_shell_t *sh;
 
+    const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+    const cs_lnum_t vb_size = cs_matrix_get_diag_block_size(a)[1];
+
     BFT_MALLOC(sh, 1, _mat_shell_t);
     sh->a = a;
     cs_matrix_row_init(&(sh->r));
+    BFT_MALLOC(sh->x, n_cols_ext*vb_size, cs_real_t);
 
     MatCreateShell(PETSC_COMM_WORLD,
                    n_rows*db_size,
@@ -180,6 +180,12 @@ cs_sles_petsc_log_setup(KSP          ksp)
  * the matrix type will be forced to MATSHELL ("shell") regardless
  * of the option used.
  *
+ * A shell matrix wraps the code_saturne matrix without copying it, with
+ * matrix.vector products calling back into the native implementation;
+ * preconditioners requiring an assembled matrix (such as GAMG) need an
+ * assembled type instead, or a separate preconditioning matrix set
+ * through the setup hook.
+ *
  * Note that this function returns a pointer directly to the iterative solver
  * management structure. This may be used to set further options.
  * If needed, cs_sles_find() may be used to obtain a pointer to the matching
@@ -188,7 +194,8 @@ cs_sles_petsc_log_setup(KSP          ksp)
  * parameters:
  *   f_id         <-- associated field id, or < 0
  *   name         <-- associated name if f_id < 0, or NULL
- *   matrix_type  <-- PETSc matrix type
+ *   matrix_type  <-- PETSc matrix type, or NULL for a zero-copy
+ *                    shell matrix (MATSHELL)
  *   setup_hook   <-- pointer to optional setup epilogue function
  *   context      <-> pointer to optional (untyped) value or structure
  *                    for setup_hook, or NULL
@@ -212,7 +219,8 @@ cs_sles_petsc_define(int                          f_id,
  * of the option used.
  *
  * parameters:
- *   matrix_type  <-- PETSc matrix type
+ *   matrix_type  <-- PETSc matrix type, or NULL for a zero-copy
+ *                    shell matrix (MATSHELL)
  *   setup_hook   <-- pointer to optional setup epilogue function
  *   context      <-> pointer to optional (untyped) value or structure
  *                    for setup_hook, or NULL
@@ -51,11 +51,13 @@
 #include "cs_calcium.h"
 #include "cs_cdo_main.h"
 #include "cs_control.h"
+#include "cs_convection_diffusion.h"
 #include "cs_coupling.h"
 #include "cs_ctwr.h"
 #include "cs_domain_setup.h"
 #include "cs_fan.h"
 #include "cs_field.h"
+#include "cs_field_operator.h"
 #include "cs_field_pointer.h"
 #include "cs_file.h"
 #include "cs_fp_exception.h"
@@ -67,6 +69,7 @@
 #include "cs_gui_particles.h"
 #include "cs_gui_radiative_transfer.h"
 #include "cs_gui_util.h"
+#include "cs_interface.h"
 #include "cs_io.h"
 #include "cs_join.h"
 #include "cs_lagr.h"
@@ -86,6 +89,7 @@
 #include "cs_mesh_smoother.h"
 #include "cs_notebook.h"
 #include "cs_opts.h"
+#include "cs_parall.h"
 #include "cs_param_cdo.h"
 #include "cs_parameters.h"
 #include "cs_partition.h"
@@ -232,6 +236,13 @@ cs_run(void)
   cs_sles_initialize();
   cs_sles_set_default_verbosity(cs_sles_default_get_verbosity);
 
+  /* In benchmark mode, a generated mesh may replace the mesh input file */
+
+  if (opts.benchmark > 0 && opts.benchmark_mesh_size[0] > 0)
+    cs_preprocessor_data_add_generated_hex_mesh(opts.benchmark_mesh_size,
+                                                opts.benchmark_mesh_grading,
+                                                opts.benchmark_mesh_perturbation);
+
   cs_preprocessor_data_read_headers(cs_glob_mesh,
                                     cs_glob_mesh_builder);
 
@@ -367,6 +378,7 @@ cs_run(void)
                                  (opts.verif ? 1 : 0));
 
     cs_mesh_adjacencies_update_mesh();
+    cs_mesh_adjacencies_update_cell_cells_geom();
 
     /* Initialization related to CDO/HHO schemes */
 
@@ -459,6 +471,8 @@ cs_run(void)
 
     cs_gradient_perio_finalize();
     cs_gradient_finalize();
+    cs_field_gradient_cache_finalize();
+    cs_convection_diffusion_free_quantities();
 
     /* Finalize synthetic inlet condition generation */
 
@@ -521,6 +535,7 @@ cs_run(void)
 
   cs_turbomachinery_finalize();
   cs_join_finalize();
+  cs_interface_finalize();
 
   /* Free post processing or logging related structures */
 
@@ -545,6 +560,10 @@ cs_run(void)
 
   cs_lagr_finalize();
 
+  /* Stop the MPI progress helper thread if it was started */
+
+  cs_parall_progress_thread_finalize();
+
   /* Free main mesh after printing some statistics */
 
   cs_mesh_adjacencies_finalize();
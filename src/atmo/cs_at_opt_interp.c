@@ -87,6 +87,10 @@ BEGIN_C_DECLS
 /* maximum size of line in measures files */
 #define MAX_LINE_SIZE 1000
 
+/* influence cutoff for the model covariance kernel: beyond this scaled
+   distance, (1 + d)*exp(-d) is below machine precision relative to 1 */
+#define _OI_B_CUTOFF 40.
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -447,6 +451,112 @@ _b_matrix(cs_real_t  xi,
   return (1. + dist) * exp(-dist);
 }
 
+/*----------------------------------------------------------------------------
+ * Build a kd-tree over a set of points, given by scaled coordinates.
+ *
+ * The tree is stored implicitly in the ids array: the median of each
+ * subrange along the splitting axis is placed at its middle position,
+ * and the halves are recursively organized the same way.
+ *
+ * parameters:
+ *   coords <-- point coordinates, interlaced (scaled by influence radii)
+ *   ids    <-> point ids, reordered in kd-tree order
+ *   n      <-- number of points of the subrange
+ *   depth  <-- current tree depth (0 at the root)
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_build(const cs_real_t  *coords,
+          cs_lnum_t        *ids,
+          cs_lnum_t         n,
+          int               depth)
+{
+  if (n < 2)
+    return;
+
+  const cs_lnum_t m = n/2;
+  const int axis = depth % 3;
+
+  /* Partial quickselect: place the median along the axis at position m */
+
+  cs_lnum_t lo = 0, hi = n - 1;
+
+  while (lo < hi) {
+    cs_real_t pivot = coords[ids[(lo+hi)/2]*3 + axis];
+    cs_lnum_t i = lo, j = hi;
+    while (i <= j) {
+      while (coords[ids[i]*3 + axis] < pivot)
+        i++;
+      while (coords[ids[j]*3 + axis] > pivot)
+        j--;
+      if (i <= j) {
+        cs_lnum_t t = ids[i];
+        ids[i] = ids[j];
+        ids[j] = t;
+        i++;
+        j--;
+      }
+    }
+    if (m <= j)
+      hi = j;
+    else if (m >= i)
+      lo = i;
+    else
+      break;
+  }
+
+  _kd_build(coords, ids, m, depth+1);
+  _kd_build(coords, ids+m+1, n-m-1, depth+1);
+}
+
+/*----------------------------------------------------------------------------
+ * Collect the points of a kd-tree within a given radius of a query point.
+ *
+ * parameters:
+ *   coords <-- point coordinates, interlaced (scaled by influence radii)
+ *   ids    <-- point ids in kd-tree order (see _kd_build)
+ *   n      <-- number of points of the subrange
+ *   depth  <-- current tree depth (0 at the root)
+ *   q      <-- query point (scaled coordinates)
+ *   r2     <-- square of the search radius
+ *   sel    --> ids of selected points
+ *   n_sel  <-> number of selected points
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_query(const cs_real_t  *coords,
+          const cs_lnum_t  *ids,
+          cs_lnum_t         n,
+          int               depth,
+          const cs_real_t   q[3],
+          cs_real_t         r2,
+          cs_lnum_t        *sel,
+          cs_lnum_t        *n_sel)
+{
+  if (n < 1)
+    return;
+
+  const cs_lnum_t m = n/2;
+  const cs_real_t *p = coords + ids[m]*3;
+
+  cs_real_t d2 =   cs_math_sq(q[0] - p[0])
+                 + cs_math_sq(q[1] - p[1])
+                 + cs_math_sq(q[2] - p[2]);
+
+  if (d2 <= r2) {
+    sel[*n_sel] = ids[m];
+    *n_sel += 1;
+  }
+
+  const int axis = depth % 3;
+  const cs_real_t diff = q[axis] - p[axis];
+
+  if (diff <= 0. || diff*diff <= r2)
+    _kd_query(coords, ids, m, depth+1, q, r2, sel, n_sel);
+  if (diff >= 0. || diff*diff <= r2)
+    _kd_query(coords, ids+m+1, n-m-1, depth+1, q, r2, sel, n_sel);
+}
+
 /*----------------------------------------------------------------------------
  * Assemble full matrix HB(H)t+R.
  *----------------------------------------------------------------------------*/
@@ -1387,7 +1497,9 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
 
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  const cs_real_t cutoff2 = cs_math_sq(_OI_B_CUTOFF);
 
+# pragma omp parallel for
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
     for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
       for (int pp = 0; pp < dim; pp++)
@@ -1403,6 +1515,14 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
           cs_real_t y2 = (proj + ll*stride)[dim+1];
           cs_real_t z2 = (proj + ll*stride)[dim+2];
 
+          /* skip pairs beyond the kernel cutoff */
+
+          cs_real_t d2 = ( cs_math_sq(x1 - x2)
+                          +cs_math_sq(y1 - y2))/ir_xy2
+                        + cs_math_sq(z1 - z2)/ir_z2;
+          if (d2 > cutoff2)
+            continue;
+
           cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
 
           for (int pp = 0; pp < dim; pp++)
@@ -1719,29 +1839,77 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   BFT_FREE(alu);
   BFT_FREE(inc);
 
-  const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
-  const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  /* Spread increments to cells: gather the active projection points
+     (scaled by the influence radii) with their coefficients, index
+     them with a kd-tree, and only evaluate the covariance kernel for
+     the points within its cutoff radius of each cell */
+
+  const cs_real_t ir_xy = oi->ir[0];
+  const cs_real_t ir_z = oi->ir[1];
+  const cs_real_t cutoff2 = cs_math_sq(_OI_B_CUTOFF);
+
+  cs_lnum_t n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++)
+    n_pts += proj_idx[ao_idx[ll]+1] - proj_idx[ao_idx[ll]];
+
+  cs_real_t *pt_coords = NULL, *pt_coef = NULL;
+  cs_lnum_t *pt_order = NULL;
+  BFT_MALLOC(pt_coords, n_pts*3, cs_real_t);
+  BFT_MALLOC(pt_coef, n_pts, cs_real_t);
+  BFT_MALLOC(pt_order, n_pts, cs_lnum_t);
+
+  n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++) {
+    for (int mm = proj_idx[ao_idx[ll]];
+         mm < proj_idx[ao_idx[ll]+1];
+         mm++) {
+      pt_coords[n_pts*3    ] = (proj + mm*stride)[m_dim  ]/ir_xy;
+      pt_coords[n_pts*3 + 1] = (proj + mm*stride)[m_dim+1]/ir_xy;
+      pt_coords[n_pts*3 + 2] = (proj + mm*stride)[m_dim+2]/ir_z;
+      pt_coef[n_pts] = (proj + mm*stride)[mc_id] * vect[ll];
+      pt_order[n_pts] = n_pts;
+      n_pts += 1;
+    }
+  }
+
+  _kd_build(pt_coords, pt_order, n_pts, 0);
+
+# pragma omp parallel
+  {
+    cs_lnum_t *sel = NULL;
+    BFT_MALLOC(sel, n_pts, cs_lnum_t);
+
+#   pragma omp for
+    for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
+
+      const cs_real_t q[3] = {cell_cen[ii][0]/ir_xy,
+                              cell_cen[ii][1]/ir_xy,
+                              cell_cen[ii][2]/ir_z};
 
-  for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
-    f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
-      f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
-
-    for (int ll = 0; ll < n_active_obs; ll++) {
-      for (int mm = proj_idx[ao_idx[ll]];
-           mm < proj_idx[ao_idx[ll]+1];
-           mm++) {
-        cs_real_t x = (proj + mm*stride)[m_dim  ];
-        cs_real_t y = (proj + mm*stride)[m_dim+1];
-        cs_real_t z = (proj + mm*stride)[m_dim+2];
-        f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] +=  (proj + mm*stride)[mc_id] * vect[ll]
-                                                   * _b_matrix(cell_cen[ii][0],
-                                                               cell_cen[ii][1],
-                                                               cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
+      cs_lnum_t n_sel = 0;
+      _kd_query(pt_coords, pt_order, n_pts, 0, q, cutoff2, sel, &n_sel);
+
+      cs_real_t incr = 0.;
+
+      for (cs_lnum_t jj = 0; jj < n_sel; jj++) {
+        const cs_real_t *p = pt_coords + sel[jj]*3;
+        cs_real_t dist = sqrt(  cs_math_sq(q[0] - p[0])
+                              + cs_math_sq(q[1] - p[1])
+                              + cs_math_sq(q[2] - p[2]));
+        incr += pt_coef[sel[jj]] * (1. + dist) * exp(-dist);
       }
+
+      f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
+        f->val_pre[ii*f_dim+ms->comp_ids[mc_id]] + incr;
     }
+
+    BFT_FREE(sel);
   }
 
+  BFT_FREE(pt_order);
+  BFT_FREE(pt_coef);
+  BFT_FREE(pt_coords);
+
   BFT_FREE(vect);
 }
 
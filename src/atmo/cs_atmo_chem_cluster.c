@@ -0,0 +1,408 @@
+/*============================================================================
+ * Cell clustering by thermochemical state for chemistry acceleration.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_atmo_chem_cluster.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_atmo_chem_cluster.c
+        Cell clustering by thermochemical state for chemistry acceleration.
+
+  In stratified atmospheric domains, most cells share near identical
+  thermochemical states, so integrating the stiff chemistry in every
+  cell repeats the same work. This layer groups cells whose states
+  match within a relative bin width, so the caller only integrates one
+  representative per cluster and maps the increment back to the
+  members. Members too far from their representative are demoted to
+  singleton clusters, bounding the recycling error.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Concentrations below this floor are treated as zero when binning */
+
+#define _STATE_FLOOR  1.e-30
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Cell clustering structure */
+
+struct _cs_atmo_chem_cluster_t {
+
+  cs_lnum_t   n_cells;      /* Number of cells */
+  int         n_comp;       /* Number of state components per cell */
+  double      eps_bin;      /* Relative width of the state bins */
+
+  cs_lnum_t   n_clusters;   /* Number of clusters of the last build */
+  cs_lnum_t  *cluster_id;   /* For each cell, associated cluster id */
+  cs_lnum_t  *rep_cell;     /* For each cluster, representative cell id */
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute a hash over the quantized state of one cell.
+ *
+ * parameters:
+ *   n_comp    <-- number of state components
+ *   codes     <-- quantized state of the cell
+ *   hash_size <-- size of the hash table (power of 2)
+ *
+ * returns:
+ *   associated hash table slot
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_hash_state(int         n_comp,
+            const int  *codes,
+            size_t      hash_size)
+{
+  size_t h = 5381;
+
+  for (int j = 0; j < n_comp; j++)
+    h = h*33 + (size_t)(codes[j] + 1073741824);
+
+  return h & (hash_size - 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether a cell state is within tolerance of a representative.
+ *
+ * parameters:
+ *   n_comp  <-- number of state components
+ *   s       <-- state of the candidate cell
+ *   r       <-- state of the representative cell
+ *   rel_tol <-- maximum relative distance per component
+ *
+ * returns:
+ *   true if all components match within tolerance
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_state_matches(int               n_comp,
+               const cs_real_t  *s,
+               const cs_real_t  *r,
+               double            rel_tol)
+{
+  for (int j = 0; j < n_comp; j++) {
+    double ref = CS_ABS(r[j]);
+    if (ref < _STATE_FLOOR)
+      ref = _STATE_FLOOR;
+    if (CS_ABS(s[j] - r[j]) > rel_tol*ref)
+      return false;
+  }
+
+  return true;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a cell clustering structure.
+ *
+ * parameters:
+ *   n_cells <-- number of cells
+ *   n_comp  <-- number of state components per cell (species
+ *               concentrations, optionally followed by temperature)
+ *   eps_bin <-- relative width of the state bins (for example 0.05
+ *               groups states matching within about 5 percent)
+ *
+ * returns:
+ *   pointer to the created structure
+ *----------------------------------------------------------------------------*/
+
+cs_atmo_chem_cluster_t *
+cs_atmo_chem_cluster_create(cs_lnum_t  n_cells,
+                            int        n_comp,
+                            double     eps_bin)
+{
+  cs_atmo_chem_cluster_t  *c = NULL;
+
+  if (eps_bin <= 0.)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The state bin width for chemistry clustering "
+                "must be strictly positive (%g given)."), eps_bin);
+
+  BFT_MALLOC(c, 1, cs_atmo_chem_cluster_t);
+
+  c->n_cells = n_cells;
+  c->n_comp = n_comp;
+  c->eps_bin = eps_bin;
+
+  c->n_clusters = 0;
+
+  BFT_MALLOC(c->cluster_id, n_cells, cs_lnum_t);
+  BFT_MALLOC(c->rep_cell, n_cells, cs_lnum_t);
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a cell clustering structure.
+ *
+ * parameters:
+ *   c <-> pointer to structure pointer (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_cluster_destroy(cs_atmo_chem_cluster_t  **c)
+{
+  if (c != NULL && *c != NULL) {
+
+    cs_atmo_chem_cluster_t  *_c = *c;
+
+    BFT_FREE(_c->cluster_id);
+    BFT_FREE(_c->rep_cell);
+
+    BFT_FREE(*c);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Cluster cells by thermochemical state.
+ *
+ * Cells whose state components all fall in the same logarithmic bins
+ * are grouped; the first cell of each group becomes the cluster
+ * representative. Members whose state differs from their representative
+ * by more than rel_tol on any component are then demoted to singleton
+ * clusters, so the mapping error of recycled increments stays bounded.
+ *
+ * parameters:
+ *   c       <-> clustering structure
+ *   state   <-- cell states, interlaced (n_comp per cell)
+ *   rel_tol <-- maximum relative state distance to a representative
+ *
+ * returns:
+ *   number of clusters (i.e. of representative integrations needed)
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_atmo_chem_cluster_build(cs_atmo_chem_cluster_t  *c,
+                           const cs_real_t         *state,
+                           double                   rel_tol)
+{
+  const cs_lnum_t  n_cells = c->n_cells;
+  const int        n_comp = c->n_comp;
+
+  int        *codes = NULL;
+  cs_lnum_t  *hash_cell = NULL;
+
+  const double inv_log_bin = 1. / log(1. + c->eps_bin);
+
+  /* Quantize states on logarithmic bins */
+
+  BFT_MALLOC(codes, n_cells*n_comp, int);
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    for (int j = 0; j < n_comp; j++) {
+      double s = state[cell_id*n_comp + j];
+      if (s < _STATE_FLOOR)
+        codes[cell_id*n_comp + j] = INT_MIN;
+      else
+        codes[cell_id*n_comp + j] = (int)floor(log(s)*inv_log_bin);
+    }
+  }
+
+  /* Group cells through a hash on the quantized state, with linear
+     probing; the first cell inserted with a given quantized state
+     becomes the representative of its cluster */
+
+  size_t hash_size = 64;
+  while (hash_size < (size_t)n_cells*2)
+    hash_size *= 2;
+
+  BFT_MALLOC(hash_cell, hash_size, cs_lnum_t);
+  for (size_t i = 0; i < hash_size; i++)
+    hash_cell[i] = -1;
+
+  c->n_clusters = 0;
+
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    const int  *s_codes = codes + cell_id*n_comp;
+
+    size_t slot = _hash_state(n_comp, s_codes, hash_size);
+
+    cs_lnum_t cl_id = -1;
+
+    while (hash_cell[slot] > -1) {
+
+      cs_lnum_t r_cell = hash_cell[slot];
+      const int  *r_codes = codes + r_cell*n_comp;
+
+      bool same_bin = true;
+      for (int j = 0; j < n_comp; j++) {
+        if (s_codes[j] != r_codes[j])
+          same_bin = false;
+      }
+
+      /* Error control: only join a representative whose actual state
+         is within tolerance, otherwise keep probing (a new entry with
+         the same bins may then be created further on) */
+
+      if (same_bin && _state_matches(n_comp,
+                                     state + cell_id*n_comp,
+                                     state + r_cell*n_comp,
+                                     rel_tol)) {
+        cl_id = c->cluster_id[r_cell];
+        break;
+      }
+
+      slot = (slot + 1) & (hash_size - 1);
+
+    }
+
+    if (cl_id < 0) {
+      cl_id = c->n_clusters;
+      hash_cell[slot] = cell_id;
+      c->rep_cell[cl_id] = cell_id;
+      c->n_clusters += 1;
+    }
+
+    c->cluster_id[cell_id] = cl_id;
+
+  }
+
+  BFT_FREE(hash_cell);
+  BFT_FREE(codes);
+
+  return c->n_clusters;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of clusters of the last build.
+ *
+ * parameters:
+ *   c <-- clustering structure
+ *
+ * returns:
+ *   number of clusters
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_atmo_chem_cluster_n_clusters(const cs_atmo_chem_cluster_t  *c)
+{
+  return c->n_clusters;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the representative cell ids, one per cluster.
+ *
+ * parameters:
+ *   c <-- clustering structure
+ *
+ * returns:
+ *   array of representative cell ids (size: number of clusters)
+ *----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_atmo_chem_cluster_representatives(const cs_atmo_chem_cluster_t  *c)
+{
+  return c->rep_cell;
+}
+
+/*----------------------------------------------------------------------------
+ * Map integration increments from cluster representatives back to all
+ * cells.
+ *
+ * The increment of the representative of each cluster is added to the
+ * state of every member, clipping negative concentrations to zero as
+ * the Rosenbrock solver does.
+ *
+ * parameters:
+ *   c        <-- clustering structure
+ *   incr     <-- increments at representatives (n_comp per cluster)
+ *   state    <-> cell states, updated in place (n_comp per cell)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_cluster_scatter_add(const cs_atmo_chem_cluster_t  *c,
+                                 const cs_real_t               *incr,
+                                 cs_real_t                     *state)
+{
+  const cs_lnum_t  n_cells = c->n_cells;
+  const int        n_comp = c->n_comp;
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+
+    const cs_real_t  *d = incr + c->cluster_id[cell_id]*n_comp;
+
+    for (int j = 0; j < n_comp; j++) {
+      cs_real_t v = state[cell_id*n_comp + j] + d[j];
+      state[cell_id*n_comp + j] = (v > 0.) ? v : 0.;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
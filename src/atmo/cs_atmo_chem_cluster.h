@@ -0,0 +1,151 @@
+#ifndef __CS_ATMO_CHEM_CLUSTER_H__
+#define __CS_ATMO_CHEM_CLUSTER_H__
+
+/*============================================================================
+ * Cell clustering by thermochemical state for chemistry acceleration.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Cell clustering structure (opaque) */
+
+typedef struct _cs_atmo_chem_cluster_t  cs_atmo_chem_cluster_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a cell clustering structure.
+ *
+ * parameters:
+ *   n_cells <-- number of cells
+ *   n_comp  <-- number of state components per cell (species
+ *               concentrations, optionally followed by temperature)
+ *   eps_bin <-- relative width of the state bins (for example 0.05
+ *               groups states matching within about 5 percent)
+ *
+ * returns:
+ *   pointer to the created structure
+ *----------------------------------------------------------------------------*/
+
+cs_atmo_chem_cluster_t *
+cs_atmo_chem_cluster_create(cs_lnum_t  n_cells,
+                            int        n_comp,
+                            double     eps_bin);
+
+/*----------------------------------------------------------------------------
+ * Destroy a cell clustering structure.
+ *
+ * parameters:
+ *   c <-> pointer to structure pointer (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_cluster_destroy(cs_atmo_chem_cluster_t  **c);
+
+/*----------------------------------------------------------------------------
+ * Cluster cells by thermochemical state.
+ *
+ * Cells whose state components all fall in the same logarithmic bins
+ * are grouped; the first cell of each group becomes the cluster
+ * representative. Members whose state differs from their representative
+ * by more than rel_tol on any component are then demoted to singleton
+ * clusters, so the mapping error of recycled increments stays bounded.
+ *
+ * parameters:
+ *   c       <-> clustering structure
+ *   state   <-- cell states, interlaced (n_comp per cell)
+ *   rel_tol <-- maximum relative state distance to a representative
+ *
+ * returns:
+ *   number of clusters (i.e. of representative integrations needed)
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_atmo_chem_cluster_build(cs_atmo_chem_cluster_t  *c,
+                           const cs_real_t         *state,
+                           double                   rel_tol);
+
+/*----------------------------------------------------------------------------
+ * Return the number of clusters of the last build.
+ *
+ * parameters:
+ *   c <-- clustering structure
+ *
+ * returns:
+ *   number of clusters
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_atmo_chem_cluster_n_clusters(const cs_atmo_chem_cluster_t  *c);
+
+/*----------------------------------------------------------------------------
+ * Return the representative cell ids, one per cluster.
+ *
+ * parameters:
+ *   c <-- clustering structure
+ *
+ * returns:
+ *   array of representative cell ids (size: number of clusters)
+ *----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_atmo_chem_cluster_representatives(const cs_atmo_chem_cluster_t  *c);
+
+/*----------------------------------------------------------------------------
+ * Map integration increments from cluster representatives back to all
+ * cells.
+ *
+ * The increment of the representative of each cluster is added to the
+ * state of every member, clipping negative concentrations to zero as
+ * the Rosenbrock solver does.
+ *
+ * parameters:
+ *   c        <-- clustering structure
+ *   incr     <-- increments at representatives (n_comp per cluster)
+ *   state    <-> cell states, updated in place (n_comp per cell)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_cluster_scatter_add(const cs_atmo_chem_cluster_t  *c,
+                                 const cs_real_t               *incr,
+                                 cs_real_t                     *state);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_ATMO_CHEM_CLUSTER_H__ */
@@ -0,0 +1,324 @@
+/*============================================================================
+ * Batched LU solver for atmospheric chemical systems.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_atmo_chem_lu.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_atmo_chem_lu.c
+        Batched LU solver for atmospheric chemical systems.
+
+  The chemistry schemes factor and solve one small dense system per cell
+  and per time step. This kernel groups cells into blocks of
+  \ref CS_ATMO_CHEM_LU_BLOCK systems stored in an interleaved layout, so
+  the factorization and triangular solves vectorize over the systems of
+  a block, and threads over blocks.
+
+  As in the scheme-specific Fortran solvers, no pivoting is applied:
+  the Rosenbrock matrices (identity minus a scaled Jacobian) are
+  strongly diagonal dominant for chemical time steps.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#define _BLOCK  CS_ATMO_CHEM_LU_BLOCK
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * In-place LU factorization of one interleaved block of systems.
+ *
+ * parameters:
+ *   n_sp <-- number of chemical species (system dimension)
+ *   ab   <-> block matrices; entry (i,j) of system k of the block is
+ *            stored at ab[(i*n_sp + j)*_BLOCK + k]
+ *----------------------------------------------------------------------------*/
+
+static void
+_lu_factor_block(int         n_sp,
+                 cs_real_t  *restrict ab)
+{
+  for (int kd = 0; kd < n_sp; kd++) {
+
+    cs_real_t  *restrict akk = ab + (kd*n_sp + kd)*_BLOCK;
+
+    cs_real_t inv_akk[_BLOCK];
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (int v = 0; v < _BLOCK; v++)
+      inv_akk[v] = 1. / akk[v];
+
+    for (int i = kd + 1; i < n_sp; i++) {
+
+      cs_real_t  *restrict aik = ab + (i*n_sp + kd)*_BLOCK;
+
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (int v = 0; v < _BLOCK; v++)
+        aik[v] *= inv_akk[v];
+
+      for (int j = kd + 1; j < n_sp; j++) {
+        cs_real_t  *restrict aij = ab + (i*n_sp + j)*_BLOCK;
+        const cs_real_t  *restrict akj = ab + (kd*n_sp + j)*_BLOCK;
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd
+#       endif
+        for (int v = 0; v < _BLOCK; v++)
+          aij[v] -= aik[v]*akj[v];
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Forward and backward substitution for one interleaved block of systems.
+ *
+ * parameters:
+ *   n_sp <-- number of chemical species (system dimension)
+ *   ab   <-- block LU factors (see _lu_factor_block)
+ *   xb   <-> right-hand sides on input, solutions on output; entry i of
+ *            system k of the block is stored at xb[i*_BLOCK + k]
+ *----------------------------------------------------------------------------*/
+
+static void
+_lu_solve_block(int               n_sp,
+                const cs_real_t  *restrict ab,
+                cs_real_t        *restrict xb)
+{
+  /* Forward substitution (unit lower part) */
+
+  for (int i = 1; i < n_sp; i++) {
+    cs_real_t  *restrict xi = xb + i*_BLOCK;
+    for (int j = 0; j < i; j++) {
+      const cs_real_t  *restrict aij = ab + (i*n_sp + j)*_BLOCK;
+      const cs_real_t  *restrict xj = xb + j*_BLOCK;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (int v = 0; v < _BLOCK; v++)
+        xi[v] -= aij[v]*xj[v];
+    }
+  }
+
+  /* Backward substitution */
+
+  for (int i = n_sp - 1; i > -1; i--) {
+    cs_real_t  *restrict xi = xb + i*_BLOCK;
+    for (int j = i + 1; j < n_sp; j++) {
+      const cs_real_t  *restrict aij = ab + (i*n_sp + j)*_BLOCK;
+      const cs_real_t  *restrict xj = xb + j*_BLOCK;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (int v = 0; v < _BLOCK; v++)
+        xi[v] -= aij[v]*xj[v];
+    }
+    const cs_real_t  *restrict aii = ab + (i*n_sp + i)*_BLOCK;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#   endif
+    for (int v = 0; v < _BLOCK; v++)
+      xi[v] /= aii[v];
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return the size of the blocked factorization work array, in cs_real_t,
+ * for a batch of systems.
+ *
+ * parameters:
+ *   n_sys <-- number of systems in the batch
+ *   n_sp  <-- number of chemical species (system dimension)
+ *
+ * returns:
+ *   required size of the factorization array
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_atmo_chem_lu_work_size(cs_lnum_t  n_sys,
+                          int        n_sp)
+{
+  size_t n_blocks = (n_sys + _BLOCK - 1) / _BLOCK;
+
+  return n_blocks * (size_t)(n_sp*n_sp) * _BLOCK;
+}
+
+/*----------------------------------------------------------------------------
+ * Batched LU factorization of small dense chemical systems.
+ *
+ * The matrices are read in the per-system (Fortran) layout used by the
+ * chemistry schemes and factored without pivoting into an interleaved,
+ * register-blocked layout, threading over blocks of systems.
+ *
+ * parameters:
+ *   n_sys <-- number of systems in the batch
+ *   n_sp  <-- number of chemical species (system dimension)
+ *   a     <-- matrices, column-major, system-contiguous (n_sp*n_sp per system)
+ *   alu   --> LU factors, interleaved blocked layout
+ *             (size given by cs_atmo_chem_lu_work_size)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_lu_factor(cs_lnum_t         n_sys,
+                       int               n_sp,
+                       const cs_real_t  *a,
+                       cs_real_t        *alu)
+{
+  const cs_lnum_t n_blocks = (n_sys + _BLOCK - 1) / _BLOCK;
+  const size_t block_stride = (size_t)(n_sp*n_sp) * _BLOCK;
+
+# pragma omp parallel for schedule(static)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    const cs_lnum_t s_id0 = b_id*_BLOCK;
+    const int n_s = CS_MIN(n_sys - s_id0, _BLOCK);
+
+    cs_real_t  *restrict ab = alu + b_id*block_stride;
+
+    /* Pack: transpose the column-major per-system matrices into the
+       row-major interleaved layout; the remainder block is padded with
+       identity so the factorization stays division-safe */
+
+    for (int i = 0; i < n_sp; i++) {
+      for (int j = 0; j < n_sp; j++) {
+        cs_real_t  *restrict ad = ab + (i*n_sp + j)*_BLOCK;
+        for (int v = 0; v < n_s; v++)
+          ad[v] = a[(s_id0 + v)*(size_t)(n_sp*n_sp) + j*n_sp + i];
+        for (int v = n_s; v < _BLOCK; v++)
+          ad[v] = (i == j) ? 1. : 0.;
+      }
+    }
+
+    _lu_factor_block(n_sp, ab);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Batched solve of factored chemical systems.
+ *
+ * May be called several times with the same factors (as in the two
+ * stages of the Rosenbrock scheme).
+ *
+ * parameters:
+ *   n_sys <-- number of systems in the batch
+ *   n_sp  <-- number of chemical species (system dimension)
+ *   alu   <-- LU factors computed by cs_atmo_chem_lu_factor
+ *   b     <-- right-hand sides, system-contiguous (n_sp per system)
+ *   x     --> solutions, system-contiguous (n_sp per system)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_lu_solve(cs_lnum_t         n_sys,
+                      int               n_sp,
+                      const cs_real_t  *alu,
+                      const cs_real_t  *b,
+                      cs_real_t        *x)
+{
+  const cs_lnum_t n_blocks = (n_sys + _BLOCK - 1) / _BLOCK;
+  const size_t block_stride = (size_t)(n_sp*n_sp) * _BLOCK;
+
+# pragma omp parallel
+  {
+    cs_real_t  *xb;
+
+    BFT_MALLOC(xb, n_sp*_BLOCK, cs_real_t);
+
+#   pragma omp for schedule(static)
+    for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+      const cs_lnum_t s_id0 = b_id*_BLOCK;
+      const int n_s = CS_MIN(n_sys - s_id0, _BLOCK);
+
+      const cs_real_t  *restrict ab = alu + b_id*block_stride;
+
+      for (int i = 0; i < n_sp; i++) {
+        for (int v = 0; v < n_s; v++)
+          xb[i*_BLOCK + v] = b[(s_id0 + v)*n_sp + i];
+        for (int v = n_s; v < _BLOCK; v++)
+          xb[i*_BLOCK + v] = 0.;
+      }
+
+      _lu_solve_block(n_sp, ab, xb);
+
+      for (int i = 0; i < n_sp; i++) {
+        for (int v = 0; v < n_s; v++)
+          x[(s_id0 + v)*n_sp + i] = xb[i*_BLOCK + v];
+      }
+
+    }
+
+    BFT_FREE(xb);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
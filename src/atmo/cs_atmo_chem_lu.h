@@ -0,0 +1,112 @@
+#ifndef __CS_ATMO_CHEM_LU_H__
+#define __CS_ATMO_CHEM_LU_H__
+
+/*============================================================================
+ * Batched LU solver for atmospheric chemical systems.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/* Number of systems interleaved in one block (SIMD width in doubles) */
+
+#define CS_ATMO_CHEM_LU_BLOCK  8
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return the size of the blocked factorization work array, in cs_real_t,
+ * for a batch of systems.
+ *
+ * parameters:
+ *   n_sys <-- number of systems in the batch
+ *   n_sp  <-- number of chemical species (system dimension)
+ *
+ * returns:
+ *   required size of the factorization array
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_atmo_chem_lu_work_size(cs_lnum_t  n_sys,
+                          int        n_sp);
+
+/*----------------------------------------------------------------------------
+ * Batched LU factorization of small dense chemical systems.
+ *
+ * The matrices are read in the per-system (Fortran) layout used by the
+ * chemistry schemes and factored without pivoting into an interleaved,
+ * register-blocked layout, threading over blocks of systems.
+ *
+ * parameters:
+ *   n_sys <-- number of systems in the batch
+ *   n_sp  <-- number of chemical species (system dimension)
+ *   a     <-- matrices, column-major, system-contiguous (n_sp*n_sp per system)
+ *   alu   --> LU factors, interleaved blocked layout
+ *             (size given by cs_atmo_chem_lu_work_size)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_lu_factor(cs_lnum_t         n_sys,
+                       int               n_sp,
+                       const cs_real_t  *a,
+                       cs_real_t        *alu);
+
+/*----------------------------------------------------------------------------
+ * Batched solve of factored chemical systems.
+ *
+ * May be called several times with the same factors (as in the two
+ * stages of the Rosenbrock scheme).
+ *
+ * parameters:
+ *   n_sys <-- number of systems in the batch
+ *   n_sp  <-- number of chemical species (system dimension)
+ *   alu   <-- LU factors computed by cs_atmo_chem_lu_factor
+ *   b     <-- right-hand sides, system-contiguous (n_sp per system)
+ *   x     --> solutions, system-contiguous (n_sp per system)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chem_lu_solve(cs_lnum_t         n_sys,
+                      int               n_sp,
+                      const cs_real_t  *alu,
+                      const cs_real_t  *b,
+                      cs_real_t        *x);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_ATMO_CHEM_LU_H__ */
@@ -1026,15 +1026,28 @@ cs_ale_update_mesh(const int           itrale,
   cs_real_3_t *disale = (cs_real_3_t *)cs_field_by_name("disale")->val;
   cs_real_3_t *disala = (cs_real_3_t *)cs_field_by_name("disale")->val_pre;
 
-  /* Update geometry */
+  /* Update geometry, flagging vertices which actually moved so only
+     quantities depending on them are recomputed */
+
+  int *vtx_moved;
+  BFT_MALLOC(vtx_moved, n_vertices, int);
+
   for (int v_id = 0; v_id < n_vertices; v_id++) {
+    vtx_moved[v_id] = 0;
     for (int idim = 0; idim < ndim; idim++) {
+      cs_real_t xyz_prv = vtx_coord[v_id][idim];
       vtx_coord[v_id][idim] = xyzno0[v_id][idim] + disale[v_id][idim];
       disala[v_id][idim] = vtx_coord[v_id][idim] - xyzno0[v_id][idim];
+      if (CS_ABS(vtx_coord[v_id][idim] - xyz_prv) > 0)
+        vtx_moved[v_id] = 1;
     }
   }
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  cs_mesh_quantities_update_moved(m, mq, vtx_moved);
+
+  BFT_FREE(vtx_moved);
+
+  cs_mesh_bad_cells_detect(m, mq);
 
   /* Abort at the end of the current time-step if there is a negative volume */
   if (mq->min_vol <= 0.)
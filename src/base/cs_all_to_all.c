@@ -49,6 +49,7 @@
 #include "cs_crystal_router.h"
 #include "cs_log.h"
 #include "cs_order.h"
+#include "cs_rank_neighbors.h"
 #include "cs_timer.h"
 
 /*----------------------------------------------------------------------------
@@ -82,6 +83,11 @@ BEGIN_C_DECLS
   \var CS_ALL_TO_ALL_CRYSTAL_ROUTER
        Use crystal router algorithm
 
+  \var CS_ALL_TO_ALL_AUTO
+       Choose between the other algorithms on a per-distributor basis,
+       based on the measured sparsity of the communication pattern and
+       mean message size
+
   \paragraph all_to_all_flags Using flags
   \parblock
 
@@ -138,6 +144,10 @@ typedef struct {
   const void     *send_buffer;       /* Send buffer */
   unsigned char  *_send_buffer;      /* Send buffer */
 
+  bool            sparse_meta;       /* Use sparse point-to-point exchanges
+                                        rather than MPI_Alltoall for count
+                                        metadata */
+
   int            *send_count;        /* Send counts for MPI_Alltoall */
   int            *recv_count;        /* Receive counts for MPI_Alltoall */
   int            *send_displ;        /* Send displs for MPI_Alltoall */
@@ -300,6 +310,52 @@ _all_to_all_create_base(size_t    n_elts,
   return d;
 }
 
+/*----------------------------------------------------------------------------
+ * Select the communication protocol of an all-to-all distributor whose
+ * type is CS_ALL_TO_ALL_AUTO, based on the measured sparsity of the
+ * communication pattern and the mean message size.
+ *
+ * This is a collective operation on the distributor's communicator, and
+ * requires that the destination ranks be set.
+ *
+ * parameters:
+ *   d <-> pointer to associated all-to-all distributor
+ *
+ * returns:
+ *   true if count metadata should use sparse point-to-point exchanges
+ *---------------------------------------------------------------------------*/
+
+static bool
+_all_to_all_auto_type(cs_all_to_all_t  *d)
+{
+  cs_lnum_t loc[2], glob[2];
+
+  cs_rank_neighbors_t *nbr = cs_rank_neighbors_create(d->n_elts_src,
+                                                      d->dest_rank);
+
+  loc[0] = nbr->size;
+  loc[1] = (nbr->size > 0) ? d->n_elts_src / nbr->size : 0;
+
+  cs_rank_neighbors_destroy(&nbr);
+
+  MPI_Allreduce(loc, glob, 2, CS_MPI_LNUM, MPI_MAX, d->comm);
+
+  /* When all ranks communicate with a small subset of the others,
+     direct exchanges with sparse count metadata avoid both the dense
+     MPI_Alltoall and the Crystal Router's store and forward overhead;
+     for dense patterns, many small messages favor the Crystal Router's
+     log(p) staged exchanges, larger ones the direct MPI_Alltoallv. */
+
+  bool sparse = (glob[0]*4 < d->n_ranks);
+
+  if (sparse == false && glob[1] < 32 && d->n_ranks > 8)
+    d->type = CS_ALL_TO_ALL_CRYSTAL_ROUTER;
+  else
+    d->type = CS_ALL_TO_ALL_MPI_DEFAULT;
+
+  return sparse;
+}
+
 /*----------------------------------------------------------------------------
  * Compute rank displacement based on count.
  *
@@ -357,6 +413,8 @@ _alltoall_caller_create_meta(int        flags,
 
   dc->stride = 0;
 
+  dc->sparse_meta = false;
+
   dc->send_size = 0;
   dc->recv_size = 0;
 
@@ -821,9 +879,61 @@ _alltoall_caller_exchange_meta(_mpi_all_to_all_caller_t  *dc,
 
   cs_timer_t t0 = cs_timer_time();
 
-  MPI_Alltoall(dc->send_count, 1, MPI_INT,
-               dc->recv_count, 1, MPI_INT,
-               dc->comm);
+  if (dc->sparse_meta) {
+
+    /* Sparse variant: exchange counts among effective neighbors only,
+       using nonblocking point-to-point messages when available
+       rather than a dense MPI_Alltoall */
+
+    cs_rank_neighbors_t *n_send = cs_rank_neighbors_create(n_elts,
+                                                           dest_rank);
+
+    int *dest_rank_index;
+    BFT_MALLOC(dest_rank_index, CS_MAX(n_elts, 1), int);
+    memcpy(dest_rank_index, dest_rank, n_elts*sizeof(int));
+    cs_rank_neighbors_to_index(n_send, n_elts,
+                               dest_rank_index, dest_rank_index);
+
+    cs_lnum_t *nbr_send_count;
+    BFT_MALLOC(nbr_send_count, CS_MAX(n_send->size, 1), cs_lnum_t);
+    cs_rank_neighbors_count(n_send, n_elts, dest_rank_index, nbr_send_count);
+
+    BFT_FREE(dest_rank_index);
+
+    cs_rank_neighbors_t *n_recv = NULL;
+    cs_lnum_t *nbr_recv_count = NULL;
+
+#if defined(HAVE_MPI_IBARRIER)
+    cs_rank_neighbors_exchange_t t_save
+      = cs_rank_neighbors_get_exchange_type();
+    cs_rank_neighbors_set_exchange_type(CS_RANK_NEIGHBORS_NBX);
+#endif
+
+    cs_rank_neighbors_sync_count(n_send,
+                                 &n_recv,
+                                 nbr_send_count,
+                                 &nbr_recv_count,
+                                 dc->comm);
+
+#if defined(HAVE_MPI_IBARRIER)
+    cs_rank_neighbors_set_exchange_type(t_save);
+#endif
+
+    for (int i = 0; i < dc->n_ranks; i++)
+      dc->recv_count[i] = 0;
+    for (int i = 0; i < n_recv->size; i++)
+      dc->recv_count[n_recv->rank[i]] = nbr_recv_count[i];
+
+    BFT_FREE(nbr_recv_count);
+    BFT_FREE(nbr_send_count);
+    cs_rank_neighbors_destroy(&n_recv);
+    cs_rank_neighbors_destroy(&n_send);
+
+  }
+  else
+    MPI_Alltoall(dc->send_count, 1, MPI_INT,
+                 dc->recv_count, 1, MPI_INT,
+                 dc->comm);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_METADATA,
@@ -1299,8 +1409,14 @@ cs_all_to_all_create(size_t            n_elts,
   /* Create substructures based on info available at this stage
      (for Crystal Router, delay creation as data is not passed yet) */
 
-  if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT)
+  bool sparse_meta = false;
+  if (d->type == CS_ALL_TO_ALL_AUTO)
+    sparse_meta = _all_to_all_auto_type(d);
+
+  if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT) {
     d->dc = _alltoall_caller_create_meta(flags, comm);
+    d->dc->sparse_meta = sparse_meta;
+  }
 
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_TOTAL,
@@ -1388,8 +1504,14 @@ cs_all_to_all_create_from_block(size_t                 n_elts,
   /* Create substructures based on info available at this stage
      (for Crystal Router, delay creation as data is not passed yet) */
 
-  if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT)
+  bool sparse_meta = false;
+  if (d->type == CS_ALL_TO_ALL_AUTO)
+    sparse_meta = _all_to_all_auto_type(d);
+
+  if (d->type == CS_ALL_TO_ALL_MPI_DEFAULT) {
     d->dc = _alltoall_caller_create_meta(flags, comm);
+    d->dc->sparse_meta = sparse_meta;
+  }
 
   t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_TOTAL,
@@ -1589,6 +1711,9 @@ cs_all_to_all_n_elts_dest(cs_all_to_all_t  *d)
       }
       break;
 
+    default:  /* CS_ALL_TO_ALL_AUTO is resolved at creation */
+      assert(0);
+
     }
 
     t1 = cs_timer_time();
@@ -1751,6 +1876,9 @@ cs_all_to_all_copy_array(cs_all_to_all_t   *d,
     }
     break;
 
+  default:  /* CS_ALL_TO_ALL_AUTO is resolved at creation */
+    assert(0);
+
   }
 
   t1 = cs_timer_time();
@@ -2000,6 +2128,9 @@ cs_all_to_all_copy_indexed(cs_all_to_all_t  *d,
     }
     break;
 
+  default:  /* CS_ALL_TO_ALL_AUTO is resolved at creation */
+    assert(0);
+
   }
 
   t1 = cs_timer_time();
@@ -2076,6 +2207,10 @@ cs_all_to_all_get_src_rank(cs_all_to_all_t  *d)
       if (d->src_rank != NULL)
         memcpy(src_rank, d->src_rank, d->n_elts_dest*sizeof(int));
     }
+    break;
+
+  default:  /* CS_ALL_TO_ALL_AUTO is resolved at creation */
+    assert(0);
 
   }
 
@@ -2134,7 +2269,8 @@ cs_all_to_all_log_finalize(void)
   size_t name_width = 0;
 
   const char *method_name[] = {N_("MPI_Alltoall and MPI_Alltoallv"),
-                               N_("Crystal Router algorithm")};
+                               N_("Crystal Router algorithm"),
+                               N_("automatic choice per distributor")};
   const char *timer_name[] = {N_("Total:"),
                               N_("Metadata exchange:"),
                               N_("Data exchange:")};
@@ -65,7 +65,8 @@ BEGIN_C_DECLS
 typedef enum {
 
   CS_ALL_TO_ALL_MPI_DEFAULT,
-  CS_ALL_TO_ALL_CRYSTAL_ROUTER
+  CS_ALL_TO_ALL_CRYSTAL_ROUTER,
+  CS_ALL_TO_ALL_AUTO
 
 } cs_all_to_all_type_t;
 
@@ -68,6 +68,11 @@ BEGIN_C_DECLS
 
 #define CS_CL  (CS_CL_SIZE/8)
 
+/* Fixed block size for reproducible (pairwise) summation; the block
+   partition must not depend on the number of threads */
+
+#define CS_PAIRWISE_BLOCK_SIZE 64
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -76,6 +81,11 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Use reproducible (fixed-tree pairwise) summation, independent of the
+   number of threads ? */
+
+static bool _cs_array_reduce_reproducible = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -136,6 +146,205 @@ _sbloc_sizes(cs_lnum_t   n,
   *blocks_in_sblocks = (n + n_b - 1) / n_b;
 }
 
+/*----------------------------------------------------------------------------
+ * Reduce per-block partial sums using a fixed pairwise tree.
+ *
+ * As both the block partition and the reduction tree are independent of
+ * the number of threads, the result is identical for any thread count.
+ *
+ * parameters:
+ *   n_blocks <-- number of blocks
+ *   n_cols   <-- number of interleaved components per block
+ *   bsum     <-> block partial sums (size: n_blocks*n_cols, modified)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pairwise_tree_reduce(cs_lnum_t   n_blocks,
+                      int         n_cols,
+                      double      bsum[])
+{
+  cs_lnum_t nb = n_blocks;
+
+  while (nb > 1) {
+
+    cs_lnum_t nbh = nb / 2;
+
+    for (cs_lnum_t i = 0; i < nbh; i++) {
+      for (int j = 0; j < n_cols; j++)
+        bsum[i*n_cols + j] =   bsum[(2*i)*n_cols + j]
+                             + bsum[(2*i+1)*n_cols + j];
+    }
+
+    if (nb & 1) {
+      for (int j = 0; j < n_cols; j++)
+        bsum[nbh*n_cols + j] = bsum[(nb-1)*n_cols + j];
+    }
+
+    nb = nbh + (nb & 1);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute sum of a 1-dimensional array with reproducible
+ * (fixed-tree pairwise) summation.
+ *
+ * parameters:
+ *   n        <-- local number of elements
+ *   v        <-- pointer to values (size: n)
+ *
+ * returns:
+ *   resulting sum
+ *----------------------------------------------------------------------------*/
+
+static double
+_cs_real_sum_1d_pairwise(cs_lnum_t        n,
+                         const cs_real_t  v[])
+{
+  const cs_lnum_t block_size = CS_PAIRWISE_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double v_sum = 0.;
+  double *bsum;
+
+  if (n < 1)
+    return v_sum;
+
+  BFT_MALLOC(bsum, n_blocks, double);
+
+# pragma omp parallel for if (n > CS_THR_MIN)
+  for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+    cs_lnum_t start_id = bid*block_size;
+    cs_lnum_t end_id = CS_MIN(start_id + block_size, n);
+    double c = 0.;
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd reduction(+:c)
+#   endif
+    for (cs_lnum_t i = start_id; i < end_id; i++)
+      c += v[i];
+    bsum[bid] = c;
+  }
+
+  _pairwise_tree_reduce(n_blocks, 1, bsum);
+
+  v_sum = bsum[0];
+
+  BFT_FREE(bsum);
+
+  return v_sum;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute simple local stats (minima, maxima, sum) of an n-dimensional
+ * array with reproducible (fixed-tree pairwise) summation.
+ *
+ * The array is interleaved; for arrays of dimension 3, the statistics
+ * relative to the norm are also computed, and added at the end of the
+ * statistics arrays (which must be of size dim+1).
+ *
+ * parameters:
+ *   n        <-- local number of elements
+ *   dim      <-- local array dimension (max: 9)
+ *   vl       <-- optional list of parent elements, or NULL
+ *   v        <-- pointer to element values
+ *   vmin     --> resulting min array (size: dim, or 4 if dim = 3)
+ *   vmax     --> resulting max array (same size as vmin)
+ *   vsum     --> resulting sum array (same size as vmin)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_real_sstats_nd_pairwise(cs_lnum_t         n,
+                            int               dim,
+                            const cs_lnum_t   vl[],
+                            const cs_real_t   v[],
+                            double           *vmin,
+                            double           *vmax,
+                            double           *vsum)
+{
+  const int n_cols = (dim == 3) ? 4 : dim;
+  const cs_lnum_t block_size = CS_PAIRWISE_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n + block_size - 1) / block_size;
+
+  double *bsum;
+
+  assert(dim <= 9);
+
+  for (int j = 0; j < n_cols; j++) {
+    vmin[j] = HUGE_VAL;
+    vmax[j] = -HUGE_VAL;
+    vsum[j] = 0.;
+  }
+
+  if (n < 1)
+    return;
+
+  BFT_MALLOC(bsum, n_blocks*n_cols, double);
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    double lmin[10], lmax[10];
+    for (int j = 0; j < n_cols; j++) {
+      lmin[j] = HUGE_VAL;
+      lmax[j] = -HUGE_VAL;
+    }
+
+#   pragma omp for
+    for (cs_lnum_t bid = 0; bid < n_blocks; bid++) {
+
+      cs_lnum_t start_id = bid*block_size;
+      cs_lnum_t end_id = CS_MIN(start_id + block_size, n);
+
+      double c[10];
+      for (int j = 0; j < n_cols; j++)
+        c[j] = 0.;
+
+      for (cs_lnum_t li = start_id; li < end_id; li++) {
+        cs_lnum_t i = (vl != NULL) ? vl[li] : li;
+        for (int j = 0; j < dim; j++) {
+          double val = v[i*dim + j];
+          c[j] += val;
+          if (val < lmin[j])
+            lmin[j] = val;
+          if (val > lmax[j])
+            lmax[j] = val;
+        }
+        if (dim == 3) {
+          double vn = sqrt(  v[i*3]*v[i*3]
+                           + v[i*3+1]*v[i*3+1]
+                           + v[i*3+2]*v[i*3+2]);
+          c[3] += vn;
+          if (vn < lmin[3])
+            lmin[3] = vn;
+          if (vn > lmax[3])
+            lmax[3] = vn;
+        }
+      }
+
+      for (int j = 0; j < n_cols; j++)
+        bsum[bid*n_cols + j] = c[j];
+
+    }
+
+#   pragma omp critical
+    {
+      for (int j = 0; j < n_cols; j++) {
+        if (lmin[j] < vmin[j])
+          vmin[j] = lmin[j];
+        if (lmax[j] > vmax[j])
+          vmax[j] = lmax[j];
+      }
+    }
+
+  }
+
+  _pairwise_tree_reduce(n_blocks, n_cols, bsum);
+
+  for (int j = 0; j < n_cols; j++)
+    vsum[j] = bsum[j];
+
+  BFT_FREE(bsum);
+}
+
 /*----------------------------------------------------------------------------
  * Compute sum of a 1-dimensional array.
  *
@@ -178,6 +387,9 @@ _cs_real_sum_1d(cs_lnum_t        n,
         if (end_id > _n)
           end_id = _n;
         double c = 0.;
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd reduction(+:c)
+#       endif
         for (cs_lnum_t i = start_id; i < end_id; i++)
           c += _v[i];
         s += c;
@@ -224,6 +436,9 @@ _cs_real_minmax_1d(cs_lnum_t          n,
     cs_real_t lmin = HUGE_VAL;
     cs_real_t lmax = -HUGE_VAL;
 
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd reduction(min:lmin) reduction(max:lmax)
+#   endif
     for (cs_lnum_t i = 0; i < _n; i++) {
       if (_v[i] < lmin)
         lmin = _v[i];
@@ -295,6 +510,9 @@ _cs_real_sstats_1d(cs_lnum_t         n,
         if (end_id > _n)
           end_id = _n;
         double c = 0.;
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd reduction(+:c) reduction(min:lmin) reduction(max:lmax)
+#       endif
         for (cs_lnum_t i = start_id; i < end_id; i++) {
           c += _v[i];
           if (_v[i] < lmin)
@@ -2797,6 +3015,40 @@ _cs_real_sstats_nd_w(cs_lnum_t         n,
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether array reduction operations should use reproducible
+ *         (fixed-tree pairwise) summation.
+ *
+ * With this option, results are identical for any number of threads,
+ * at the cost of a slightly more expensive summation; minima and maxima
+ * are not affected, as they do not depend on operation order.
+ *
+ * \param[in]  reproducible  true to activate reproducible summation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_array_reduce_set_reproducible(bool  reproducible)
+{
+  _cs_array_reduce_reproducible = reproducible;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether array reduction operations use reproducible
+ *         (fixed-tree pairwise) summation.
+ *
+ * \return  true if reproducible summation is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_array_reduce_get_reproducible(void)
+{
+  return _cs_array_reduce_reproducible;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute sums of an n-dimensional cs_real_t array's components.
@@ -2830,7 +3082,8 @@ cs_array_reduce_sum_l(cs_lnum_t         n_elts,
 
   if (v_elt_list == NULL) {
     if (dim == 1)
-      vsum[0] = _cs_real_sum_1d(n_elts, v);
+      vsum[0] = (_cs_array_reduce_reproducible) ?
+        _cs_real_sum_1d_pairwise(n_elts, v) : _cs_real_sum_1d(n_elts, v);
     else if (dim == 3)
       bft_error(__FILE__, __LINE__, 0,
                 _("_cs_real_sum_3d not implemented yet\n"));
@@ -2948,6 +3201,15 @@ cs_array_reduce_simple_stats_l(cs_lnum_t         n_elts,
                                double            vmax[],
                                double            vsum[])
 {
+  /* Reproducible mode: a fixed block partition and reduction tree give
+     results independent of the number of threads */
+
+  if (_cs_array_reduce_reproducible) {
+    _cs_real_sstats_nd_pairwise(n_elts, dim, v_elt_list, v,
+                                vmin, vmax, vsum);
+    return;
+  }
+
   /* If all values are defined on same list */
 
   if (v_elt_list == NULL) {
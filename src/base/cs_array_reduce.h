@@ -59,6 +59,32 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Define whether array reduction operations should use reproducible
+ * (fixed-tree pairwise) summation.
+ *
+ * With this option, results are identical for any number of threads,
+ * at the cost of a slightly more expensive summation; minima and maxima
+ * are not affected, as they do not depend on operation order.
+ *
+ * parameters:
+ *   reproducible <-- true to activate reproducible summation
+ *----------------------------------------------------------------------------*/
+
+void
+cs_array_reduce_set_reproducible(bool  reproducible);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether array reduction operations use reproducible
+ * (fixed-tree pairwise) summation.
+ *
+ * returns:
+ *   true if reproducible summation is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_array_reduce_get_reproducible(void);
+
 /*----------------------------------------------------------------------------
  * Compute sums of an n-dimensional cs_real_t array's components.
  *
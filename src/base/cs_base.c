@@ -181,6 +181,7 @@ static bool   _cs_trace = false;
 /* Additional cleanup steps */
 
 static cs_base_atexit_t  * _cs_base_atexit = NULL;
+static cs_base_atexit_t  * _cs_base_sig_flush = NULL;
 
 /*============================================================================
  * Private function definitions
@@ -344,8 +345,10 @@ _cs_base_err_printf(const char  *format,
 static void
 _cs_base_exit(int status)
 {
-  if (status == EXIT_SUCCESS)
+  if (status == EXIT_SUCCESS) {
+    cs_file_staging_wait();
     cs_base_update_status(NULL);
+  }
 
 #if defined(HAVE_MPI)
   {
@@ -564,6 +567,12 @@ _cs_base_backtrace_print(int  niv_debut)
 static void
 _cs_base_sig_fatal(int  signum)
 {
+  if (_cs_base_sig_flush != NULL) {
+    cs_base_atexit_t *flush_fct = _cs_base_sig_flush;
+    _cs_base_sig_flush = NULL;  /* avoid recursion in case of error */
+    flush_fct();
+  }
+
   if (_cs_base_atexit != NULL) {
     _cs_base_atexit();
     _cs_base_atexit = NULL;
@@ -1227,7 +1236,10 @@ cs_base_mpi_init(int    *argc,
     if (!flag) {
 #if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      int mpi_threads_wanted = MPI_THREAD_FUNNELED;
+      if (getenv("CS_MPI_PROGRESS_THREAD") != NULL)
+        mpi_threads_wanted = MPI_THREAD_MULTIPLE;
+      MPI_Init_thread(argc, argv, mpi_threads_wanted, &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1255,7 +1267,10 @@ cs_base_mpi_init(int    *argc,
     if (!flag) {
 #if (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
       int mpi_threads;
-      MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &mpi_threads);
+      int mpi_threads_wanted = MPI_THREAD_FUNNELED;
+      if (getenv("CS_MPI_PROGRESS_THREAD") != NULL)
+        mpi_threads_wanted = MPI_THREAD_MULTIPLE;
+      MPI_Init_thread(argc, argv, mpi_threads_wanted, &mpi_threads);
 #else
       MPI_Init(argc, argv);
 #endif
@@ -1943,6 +1958,24 @@ cs_base_atexit_set(cs_base_atexit_t  *const fct)
   _cs_base_atexit = fct;
 }
 
+/*----------------------------------------------------------------------------
+ * Define a function to be called when a fatal signal is intercepted.
+ *
+ * Only one function may be set (latest setting wins); it is called once
+ * from the signal handler, before error output, and is intended for
+ * flushing of output data buffered in memory so as to minimize data loss
+ * in case of computation failure.
+ *
+ * parameters:
+ *   fct <-- pointer to function to be called
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_signal_flush_set(cs_base_atexit_t  *const fct)
+{
+  _cs_base_sig_flush = fct;
+}
+
 /*----------------------------------------------------------------------------
  * Convert a character string from the Fortran API to the C API.
  *
@@ -320,6 +320,21 @@ cs_base_warn(const char  *file_name,
 void
 cs_base_atexit_set(cs_base_atexit_t  *const fct);
 
+/*----------------------------------------------------------------------------
+ * Define a function to be called when a fatal signal is intercepted.
+ *
+ * Only one function may be set (latest setting wins); it is called once
+ * from the signal handler, before error output, and is intended for
+ * flushing of output data buffered in memory so as to minimize data loss
+ * in case of computation failure.
+ *
+ * parameters:
+ *   fct <-- pointer to function to be called
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_signal_flush_set(cs_base_atexit_t  *const fct);
+
 /*----------------------------------------------------------------------------
  * Convert a character string from the Fortran API to the C API.
  *
@@ -81,6 +81,8 @@
 #include "cs_sat_coupling.h"
 #include "cs_selector.h"
 #include "cs_stokes_model.h"
+#include "cs_tabulation.h"
+#include "cs_task_scheduler.h"
 #include "cs_time_moment.h"
 #include "cs_time_plot.h"
 #include "cs_time_step.h"
@@ -77,6 +77,8 @@ struct _cs_block_to_part_t {
   int          n_ranks;      /* Number of ranks associated with
                                 communicator */
 
+  cs_block_dist_info_t  bi;  /* Source block information */
+
   size_t       n_block_ents; /* Number of entities to send (block) */
   size_t       n_part_ents;  /* Number of entities to receive (partition) */
   size_t       send_size;    /* Size of send buffer for MPI_Alltoall
@@ -102,6 +104,19 @@ struct _cs_block_to_part_t {
 
 #endif /* defined(HAVE_MPI) */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Use one-sided communication (MPI_Get with passive target synchronization)
+   instead of two-sided collectives for array data movement ? */
+
+static bool _cs_block_to_part_use_rma = false;
+
+#endif
+
 /*============================================================================
  * Local function defintions
  *============================================================================*/
@@ -290,6 +305,8 @@ _block_to_part_create(MPI_Comm comm)
 
   MPI_Comm_size(comm, &(d->n_ranks));
 
+  memset(&(d->bi), 0, sizeof(cs_block_dist_info_t));
+
   d->n_block_ents = 0;
   d->n_part_ents = 0;
   d->send_size = 0;
@@ -311,6 +328,97 @@ _block_to_part_create(MPI_Comm comm)
   return d;
 }
 
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Copy array data from block distribution to general domain partition,
+ * using one-sided communication.
+ *
+ * As the block distribution is defined by a simple arithmetic relation,
+ * the owning rank and offset of each entity may be computed directly from
+ * its global number, so values are read in place from the source block
+ * using MPI_Get with passive target synchronization, with no sender-side
+ * packing; runs of entities with consecutive global numbers are grouped
+ * in a single access.
+ *
+ * arguments:
+ *   d            <-- block to partition distributor
+ *   datatype     <-- type of data considered
+ *   stride       <-- number of values per entity (interlaced)
+ *   block_values <-- values in block distribution
+ *   part_values  --> values in general domain partition
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_array_rma(cs_block_to_part_t  *d,
+                cs_datatype_t        datatype,
+                int                  stride,
+                const void          *block_values,
+                void                *part_values)
+{
+  size_t j;
+
+  MPI_Win win;
+
+  size_t type_size = cs_datatype_size[datatype];
+  MPI_Datatype mpi_type = cs_datatype_to_mpi[datatype];
+
+  unsigned char *_part_values = part_values;
+
+  const cs_gnum_t block_size = d->bi.block_size;
+  const int rank_step = d->bi.rank_step;
+  const cs_gnum_t *recv_global_num = d->recv_global_num;
+
+  /* Expose local block array, then read from remote blocks;
+     the const qualifier on the window base must be dropped for
+     MPI_Win_create, but the array is only read */
+
+  void *win_base;
+  memcpy(&win_base, &block_values, sizeof(void *));
+
+  MPI_Win_create(win_base,
+                 (MPI_Aint)(d->n_block_ents*stride*type_size),
+                 type_size,
+                 MPI_INFO_NULL,
+                 d->comm,
+                 &win);
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+  for (j = 0; j < d->n_part_ents; ) {
+
+    cs_gnum_t g_id = recv_global_num[j] - 1;
+    cs_gnum_t block_end = (g_id/block_size + 1)*block_size;
+    int src_rank = (g_id/block_size)*rank_step;
+
+    size_t n = 1;
+    while (   j+n < d->n_part_ents
+           && recv_global_num[j+n] == recv_global_num[j+n-1] + 1
+           && recv_global_num[j+n] - 1 < block_end)
+      n++;
+
+    MPI_Get(_part_values + j*stride*type_size,
+            n*stride,
+            mpi_type,
+            src_rank,
+            (MPI_Aint)((g_id % block_size)*stride),
+            n*stride,
+            mpi_type,
+            win);
+
+    j += n;
+  }
+
+  MPI_Win_unlock_all(win);
+
+  /* Freeing the window is collective, so all accesses are complete
+     once it returns, and the block array may be modified again */
+
+  MPI_Win_free(&win);
+}
+
+#endif /* defined(MPI_VERSION) && (MPI_VERSION >= 3) */
+
 #endif /* defined(HAVE_MPI) */
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -346,6 +454,8 @@ cs_block_to_part_create_by_rank(MPI_Comm              comm,
 
   const int n_ranks = d->n_ranks;
 
+  d->bi = block;
+
   d->n_block_ents = block.gnum_range[1] - block.gnum_range[0];
 
   /* Count values to send and receive */
@@ -438,6 +548,9 @@ cs_block_to_part_create_by_adj_s(MPI_Comm              comm,
 
   const cs_lnum_t n_ents = block.gnum_range[1] - block.gnum_range[0];
 
+  d->bi = block;
+  d->n_block_ents = n_ents;
+
   MPI_Comm_rank(comm, &rank);
 
   /* Determine an entity's adjacent entities, and use their
@@ -648,6 +761,10 @@ cs_block_to_part_create_adj(MPI_Comm              comm,
 
   const int n_ranks = d->n_ranks;
 
+  d->bi = adjacent_block;
+  d->n_block_ents =   adjacent_block.gnum_range[1]
+                    - adjacent_block.gnum_range[0];
+
   /* Sort adjacency list so as to remove duplicates */
 
   _ordered_list(adjacency_size,
@@ -779,6 +896,9 @@ cs_block_to_part_create_by_gnum(MPI_Comm               comm,
 
   const int n_ranks = d->n_ranks;
 
+  d->bi = bi;
+  d->n_block_ents = bi.gnum_range[1] - bi.gnum_range[0];
+
   d->n_part_ents = n_part_ents;
 
   /* Use adjacent global number to determine to which ranks they will
@@ -950,6 +1070,14 @@ cs_block_to_part_copy_array(cs_block_to_part_t  *d,
   unsigned char *send_buf = NULL;
   unsigned char *recv_buf = NULL;
 
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  if (   _cs_block_to_part_use_rma
+      && d->recv_global_num != NULL && d->bi.block_size > 0) {
+    _copy_array_rma(d, datatype, stride, block_values, part_values);
+    return;
+  }
+#endif
+
   size_t stride_size = cs_datatype_size[datatype]*stride;
   MPI_Datatype mpi_type = cs_datatype_to_mpi[datatype];
 
@@ -1230,6 +1358,41 @@ cs_block_to_part_copy_indexed(cs_block_to_part_t  *d,
   BFT_FREE(recv_val_index);
 }
 
+/*----------------------------------------------------------------------------
+ * Get current status of one-sided communication use for array copies.
+ *
+ * returns:
+ *   true if one-sided communication is enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_block_to_part_get_use_rma(void)
+{
+  return _cs_block_to_part_use_rma;
+}
+
+/*----------------------------------------------------------------------------
+ * Set one-sided communication use for array copies.
+ *
+ * When this option is enabled (and the MPI library supports MPI-3 one-sided
+ * communication with passive target synchronization), array data is read
+ * directly from remote block arrays using MPI_Get instead of being exchanged
+ * through two-sided collectives, avoiding sender-side packing and full
+ * synchronization of all ranks during operations such as mesh or
+ * restart reads.
+ *
+ * It only applies to array (i.e. non-indexed) data.
+ *
+ * arguments:
+ *   use_rma <-- true to enable one-sided communication, false to disable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_block_to_part_set_use_rma(bool  use_rma)
+{
+  _cs_block_to_part_use_rma = use_rma;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
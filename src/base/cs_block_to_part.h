@@ -259,6 +259,35 @@ cs_block_to_part_copy_indexed(cs_block_to_part_t  *d,
                               const cs_lnum_t     *part_index,
                               void                *part_val);
 
+/*----------------------------------------------------------------------------
+ * Get current status of one-sided communication use for array copies.
+ *
+ * returns:
+ *   true if one-sided communication is enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_block_to_part_get_use_rma(void);
+
+/*----------------------------------------------------------------------------
+ * Set one-sided communication use for array copies.
+ *
+ * When this option is enabled (and the MPI library supports MPI-3 one-sided
+ * communication with passive target synchronization), array data is read
+ * directly from remote block arrays using MPI_Get instead of being exchanged
+ * through two-sided collectives, avoiding sender-side packing and full
+ * synchronization of all ranks during operations such as mesh or
+ * restart reads.
+ *
+ * It only applies to array (i.e. non-indexed) data.
+ *
+ * arguments:
+ *   use_rma <-- true to enable one-sided communication, false to disable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_block_to_part_set_use_rma(bool  use_rma);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
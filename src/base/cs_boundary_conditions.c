@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
 #include <math.h>
 
 #if defined(HAVE_MPI)
@@ -115,6 +116,17 @@ static int *_bc_face_zone;
 
 const int *cs_glob_bc_face_zone = NULL;
 
+/* Grouping of boundary faces by BC type and zone: faces with the same
+   (type, zone) couple are stored contiguously, so each BC kind may be
+   applied as a single loop over its face block instead of a per-face
+   dispatch over all boundary faces. */
+
+static int         _bc_group_n = 0;
+static int        *_bc_group_type = NULL;   /* BC type code of each group */
+static int        *_bc_group_zone = NULL;   /* zone id of each group */
+static cs_lnum_t  *_bc_group_index = NULL;  /* group start (size _bc_group_n+1) */
+static cs_lnum_t  *_bc_group_faces = NULL;  /* face ids, grouped */
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -778,6 +790,268 @@ cs_boundary_conditions_free(void)
       || cs_gui_file_is_loaded()) {
     BFT_FREE(_bc_face_zone);
   }
+
+  _bc_group_n = 0;
+  BFT_FREE(_bc_group_type);
+  BFT_FREE(_bc_group_zone);
+  BFT_FREE(_bc_group_index);
+  BFT_FREE(_bc_group_faces);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the grouping of boundary faces by BC type and zone.
+ *
+ * Faces sharing the same (type, zone) couple are stored contiguously, in
+ * increasing zone then type order; within a group, faces are in increasing
+ * face id order. The grouping is based on the current contents of the
+ * \ref cs_glob_bc_type and \ref cs_glob_bc_face_zone arrays, so it should
+ * be rebuilt after boundary condition types are updated (its cost is
+ * linear in the number of boundary faces).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_build_type_index(void)
+{
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const int *f_type = cs_glob_bc_type;
+  const int *f_zone = cs_glob_bc_face_zone;
+
+  cs_lnum_t ii;
+  int k_min, k_max, n_keys;
+  cs_lnum_t *count = NULL, *order = NULL;
+
+  assert(f_type != NULL);
+
+  if (_bc_group_faces == NULL)
+    BFT_MALLOC(_bc_group_faces, n_b_faces, cs_lnum_t);
+
+  BFT_MALLOC(order, n_b_faces, cs_lnum_t);
+
+  /* Stable counting sort by zone id (optional), then by type code;
+     faces are thus grouped by type, and by zone inside each type. */
+
+  for (ii = 0; ii < n_b_faces; ii++)
+    _bc_group_faces[ii] = ii;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    const int *key = (pass == 0) ? f_zone : f_type;
+
+    if (key == NULL)  /* no zone array outside specific physics / GUI */
+      continue;
+
+    k_min = INT_MAX; k_max = INT_MIN;
+    for (ii = 0; ii < n_b_faces; ii++) {
+      if (key[ii] < k_min) k_min = key[ii];
+      if (key[ii] > k_max) k_max = key[ii];
+    }
+    if (n_b_faces == 0) {
+      k_min = 0; k_max = 0;
+    }
+    n_keys = k_max - k_min + 1;
+
+    BFT_REALLOC(count, n_keys + 1, cs_lnum_t);
+    for (ii = 0; ii < n_keys + 1; ii++)
+      count[ii] = 0;
+
+    for (ii = 0; ii < n_b_faces; ii++)
+      count[key[_bc_group_faces[ii]] - k_min + 1] += 1;
+
+    for (ii = 0; ii < n_keys; ii++)
+      count[ii+1] += count[ii];
+
+    for (ii = 0; ii < n_b_faces; ii++) {
+      const cs_lnum_t f_id = _bc_group_faces[ii];
+      order[count[key[f_id] - k_min]] = f_id;
+      count[key[f_id] - k_min] += 1;
+    }
+
+    memcpy(_bc_group_faces, order, n_b_faces*sizeof(cs_lnum_t));
+
+  }
+
+  BFT_FREE(count);
+  BFT_FREE(order);
+
+  /* Build group index on (type, zone) value changes */
+
+  _bc_group_n = 0;
+
+  for (ii = 0; ii < n_b_faces; ii++) {
+    const cs_lnum_t f_id = _bc_group_faces[ii];
+    const int z_id = (f_zone != NULL) ? f_zone[f_id] : 0;
+    if (   ii == 0
+        || f_type[f_id] != _bc_group_type[_bc_group_n - 1]
+        || z_id != _bc_group_zone[_bc_group_n - 1]) {
+      BFT_REALLOC(_bc_group_type, _bc_group_n + 1, int);
+      BFT_REALLOC(_bc_group_zone, _bc_group_n + 1, int);
+      BFT_REALLOC(_bc_group_index, _bc_group_n + 2, cs_lnum_t);
+      _bc_group_type[_bc_group_n] = f_type[f_id];
+      _bc_group_zone[_bc_group_n] = z_id;
+      _bc_group_index[_bc_group_n] = ii;
+      _bc_group_n += 1;
+    }
+  }
+
+  if (_bc_group_n > 0)
+    _bc_group_index[_bc_group_n] = n_b_faces;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the grouping of boundary faces by BC type and zone.
+ *
+ * The returned arrays are built by
+ * \ref cs_boundary_conditions_build_type_index and are owned by this
+ * module; group g contains faces
+ * face_ids[index[g]] to face_ids[index[g+1] - 1].
+ *
+ * \param[out]  type_code  BC type code of each group, or NULL
+ * \param[out]  zone_id    zone id of each group, or NULL
+ * \param[out]  index      start of each group (size n_groups + 1), or NULL
+ * \param[out]  face_ids   boundary face ids, grouped, or NULL
+ *
+ * \return number of (type, zone) groups
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_boundary_conditions_get_type_index(const int        **type_code,
+                                      const int        **zone_id,
+                                      const cs_lnum_t  **index,
+                                      const cs_lnum_t  **face_ids)
+{
+  if (type_code != NULL)
+    *type_code = _bc_group_type;
+  if (zone_id != NULL)
+    *zone_id = _bc_group_zone;
+  if (index != NULL)
+    *index = _bc_group_index;
+  if (face_ids != NULL)
+    *face_ids = _bc_group_faces;
+
+  return _bc_group_n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set Dirichlet boundary conditions for a scalar on a block of faces.
+ *
+ * This is the block form of the per-face Dirichlet setting used by the
+ * legacy boundary condition code: coefficients for all listed faces are
+ * computed in branch-free loops, so it is intended to be applied per
+ * (type, zone) group built by
+ * \ref cs_boundary_conditions_build_type_index.
+ *
+ * \param[in]     n_faces       number of faces in the block
+ * \param[in]     face_ids      list of boundary face ids
+ * \param[in]     hint          internal exchange coefficient, per face
+ * \param[in]     hext          external exchange coefficient, per face,
+ *                              or NULL for an infinite coefficient
+ *                              (true Dirichlet condition)
+ * \param[in]     pimp          imposed value, per face
+ * \param[out]    coefa         explicit BC coefficients for gradients
+ * \param[out]    cofaf         explicit BC coefficients for diffusive flux
+ * \param[out]    coefb         implicit BC coefficients for gradients
+ * \param[out]    cofbf         implicit BC coefficients for diffusive flux
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_set_dirichlet_scalar_faces(cs_lnum_t         n_faces,
+                                                  const cs_lnum_t  *face_ids,
+                                                  const cs_real_t  *hint,
+                                                  const cs_real_t  *hext,
+                                                  const cs_real_t  *pimp,
+                                                  cs_real_t        *coefa,
+                                                  cs_real_t        *cofaf,
+                                                  cs_real_t        *coefb,
+                                                  cs_real_t        *cofbf)
+{
+  if (hext == NULL) {
+
+#   pragma omp parallel for if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_faces; ii++) {
+
+      const cs_lnum_t f_id = face_ids[ii];
+
+      /* Gradient BCs */
+      coefa[f_id] = pimp[ii];
+      coefb[f_id] = 0.;
+
+      /* Flux BCs */
+      cofaf[f_id] = -hint[ii]*pimp[ii];
+      cofbf[f_id] =  hint[ii];
+
+    }
+
+  }
+  else {
+
+#   pragma omp parallel for if (n_faces > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_faces; ii++) {
+
+      const cs_lnum_t f_id = face_ids[ii];
+      const cs_real_t heq = hint[ii]*hext[ii] / (hint[ii] + hext[ii]);
+
+      /* Gradient BCs */
+      coefa[f_id] = hext[ii]*pimp[ii] / (hint[ii] + hext[ii]);
+      coefb[f_id] = hint[ii] / (hint[ii] + hext[ii]);
+
+      /* Flux BCs */
+      cofaf[f_id] = -heq*pimp[ii];
+      cofbf[f_id] =  heq;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set Neumann boundary conditions for a scalar on a block of faces.
+ *
+ * Block form of the per-face Neumann setting used by the legacy boundary
+ * condition code; see
+ * \ref cs_boundary_conditions_set_dirichlet_scalar_faces.
+ *
+ * \param[in]     n_faces       number of faces in the block
+ * \param[in]     face_ids      list of boundary face ids
+ * \param[in]     hint          internal exchange coefficient, per face
+ * \param[in]     dimp          imposed flux value, per face
+ * \param[out]    coefa         explicit BC coefficients for gradients
+ * \param[out]    cofaf         explicit BC coefficients for diffusive flux
+ * \param[out]    coefb         implicit BC coefficients for gradients
+ * \param[out]    cofbf         implicit BC coefficients for diffusive flux
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_set_neumann_scalar_faces(cs_lnum_t         n_faces,
+                                                const cs_lnum_t  *face_ids,
+                                                const cs_real_t  *hint,
+                                                const cs_real_t  *dimp,
+                                                cs_real_t        *coefa,
+                                                cs_real_t        *cofaf,
+                                                cs_real_t        *coefb,
+                                                cs_real_t        *cofbf)
+{
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_faces; ii++) {
+
+    const cs_lnum_t f_id = face_ids[ii];
+
+    /* Gradient BCs */
+    coefa[f_id] = -dimp[ii] / CS_MAX(hint[ii], 1.e-300);
+    coefb[f_id] = 1.;
+
+    /* Flux BCs */
+    cofaf[f_id] = dimp[ii];
+    cofbf[f_id] = 0.;
+
+  }
 }
 
 /*----------------------------------------------------------------------------*/
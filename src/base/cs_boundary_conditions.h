@@ -192,6 +192,99 @@ cs_boundary_conditions_create(void);
 void
 cs_boundary_conditions_free(void);
 
+/*----------------------------------------------------------------------------
+ * Build the grouping of boundary faces by BC type and zone.
+ *
+ * Faces sharing the same (type, zone) couple are stored contiguously, so
+ * each BC kind may be applied as a single loop over its face block. The
+ * grouping is based on the current contents of the cs_glob_bc_type and
+ * cs_glob_bc_face_zone arrays, and should be rebuilt after boundary
+ * condition types are updated.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_build_type_index(void);
+
+/*----------------------------------------------------------------------------
+ * Return the grouping of boundary faces by BC type and zone.
+ *
+ * The returned arrays are owned by this module; group g contains faces
+ * face_ids[index[g]] to face_ids[index[g+1] - 1].
+ *
+ * parameters:
+ *   type_code --> BC type code of each group, or NULL
+ *   zone_id   --> zone id of each group, or NULL
+ *   index     --> start of each group (size n_groups + 1), or NULL
+ *   face_ids  --> boundary face ids, grouped, or NULL
+ *
+ * returns:
+ *   number of (type, zone) groups
+ *----------------------------------------------------------------------------*/
+
+int
+cs_boundary_conditions_get_type_index(const int        **type_code,
+                                      const int        **zone_id,
+                                      const cs_lnum_t  **index,
+                                      const cs_lnum_t  **face_ids);
+
+/*----------------------------------------------------------------------------
+ * Set Dirichlet boundary conditions for a scalar on a block of faces.
+ *
+ * Block form of cs_boundary_conditions_set_dirichlet_scalar, intended to
+ * be applied per (type, zone) group built by
+ * cs_boundary_conditions_build_type_index.
+ *
+ * parameters:
+ *   n_faces  <-- number of faces in the block
+ *   face_ids <-- list of boundary face ids
+ *   hint     <-- internal exchange coefficient, per face
+ *   hext     <-- external exchange coefficient, per face, or NULL for an
+ *                infinite coefficient (true Dirichlet condition)
+ *   pimp     <-- imposed value, per face
+ *   coefa    --> explicit BC coefficients for gradients
+ *   cofaf    --> explicit BC coefficients for diffusive flux
+ *   coefb    --> implicit BC coefficients for gradients
+ *   cofbf    --> implicit BC coefficients for diffusive flux
+ *----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_set_dirichlet_scalar_faces(cs_lnum_t         n_faces,
+                                                  const cs_lnum_t  *face_ids,
+                                                  const cs_real_t  *hint,
+                                                  const cs_real_t  *hext,
+                                                  const cs_real_t  *pimp,
+                                                  cs_real_t        *coefa,
+                                                  cs_real_t        *cofaf,
+                                                  cs_real_t        *coefb,
+                                                  cs_real_t        *cofbf);
+
+/*----------------------------------------------------------------------------
+ * Set Neumann boundary conditions for a scalar on a block of faces.
+ *
+ * Block form of cs_boundary_conditions_set_neumann_scalar; see
+ * cs_boundary_conditions_set_dirichlet_scalar_faces.
+ *
+ * parameters:
+ *   n_faces  <-- number of faces in the block
+ *   face_ids <-- list of boundary face ids
+ *   hint     <-- internal exchange coefficient, per face
+ *   dimp     <-- imposed flux value, per face
+ *   coefa    --> explicit BC coefficients for gradients
+ *   cofaf    --> explicit BC coefficients for diffusive flux
+ *   coefb    --> implicit BC coefficients for gradients
+ *   cofbf    --> implicit BC coefficients for diffusive flux
+ *----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_set_neumann_scalar_faces(cs_lnum_t         n_faces,
+                                                const cs_lnum_t  *face_ids,
+                                                const cs_real_t  *hint,
+                                                const cs_real_t  *dimp,
+                                                cs_real_t        *coefa,
+                                                cs_real_t        *cofaf,
+                                                cs_real_t        *coefb,
+                                                cs_real_t        *cofbf);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set Neumann BC for a scalar for a given face.
@@ -3118,6 +3118,7 @@ contains
     integer        :: hyd_p_flag
     integer        :: idimtr, ipond
     type(c_ptr)    :: f
+    double precision rvoid(1)
 
     ! Preparation for periodicity of rotation
 
@@ -3151,8 +3152,8 @@ contains
 
     call cgdcel(f_id, imrgra, inc, recompute_cocg, nswrgp,                     &
                 idimtr, hyd_p_flag, ipond, iwarnp, imligp, epsrgp, extrap,     &
-                climgp, c_null_ptr, coefap, coefbp,                            &
-                pvar, c_null_ptr, grad)
+                climgp, rvoid, coefap, coefbp,                                 &
+                pvar, rvoid, grad)
 
   end subroutine gradient_s
 
@@ -3206,6 +3207,7 @@ contains
 
     integer          :: imrgrp
     integer          :: idimtr, ipond
+    double precision rvoid(1)
 
     ! Use iterative gradient
 
@@ -3223,7 +3225,7 @@ contains
     call cgdcel(f_id, imrgrp, inc, recompute_cocg, nswrgp,                     &
                 idimtr, hyd_p_flag, ipond, iwarnp, imligp, epsrgp, extrap,     &
                 climgp, f_ext, coefap, coefbp,                                 &
-                pvar, c_null_ptr, grad)
+                pvar, rvoid, grad)
 
   end subroutine gradient_potential_s
 
@@ -52,6 +52,10 @@
 #include <arpa/inet.h>
 #endif
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -162,10 +166,73 @@ static double  _control_file_wt_last = -1.;
 static int     _control_advance_steps = -1;
 static int     _flush_nt = -1;
 
+#if defined(HAVE_PTHREAD)
+static bool       _checker_active = false;
+static pthread_t  _checker_thread;
+static long       _checker_f_size = -1;
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Check for presence of the control file, returning its size.
+ *
+ * returns:
+ *   size of the control file, or -1 if not present
+ *----------------------------------------------------------------------------*/
+
+static long
+_check_file_size(void)
+{
+  long f_size = -1;
+
+  const char path[] = "control_file";
+
+#if defined(HAVE_UNISTD_H) && defined(HAVE_ACCESS)
+
+  /* Test existence of file using access() before stat(),
+     as this may be less costly on some filesytems
+     (such as on LUSTRE, due to metadata handling aspects). */
+
+  if (access(path, F_OK) == 0)
+    f_size = cs_file_size(path);
+
+#else
+
+  f_size = cs_file_size(path);
+
+#endif
+
+  return f_size;
+}
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Run a control file presence check from a helper thread.
+ *
+ * This allows moving the filesystem metadata access off the time stepping
+ * path, as it may be slow on some parallel filesystems; the result is
+ * harvested at the next step boundary.
+ *
+ * parameters:
+ *   arg <-- unused
+ *----------------------------------------------------------------------------*/
+
+static void *
+_check_file_size_thread(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  _checker_f_size = _check_file_size();
+
+  return NULL;
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
 /*----------------------------------------------------------------------------
  * Initialize a control queue
  *
@@ -1260,6 +1327,13 @@ _parse_control_buffer(const char         *name,
 void
 cs_control_finalize(void)
 {
+#if defined(HAVE_PTHREAD)
+  if (_checker_active) {
+    pthread_join(_checker_thread, NULL);
+    _checker_active = false;
+  }
+#endif
+
   _comm_finalize(&_cs_glob_control_comm);
   _queue_finalize(&_cs_glob_control_queue);
 }
@@ -1288,18 +1362,30 @@ cs_control_check_file(void)
         ||(    cs_timer_wtime() - _control_file_wt_last
            >= _control_file_wt_interval)) {
 
-#if defined(HAVE_UNISTD_H) && defined(HAVE_ACCESS)
+#if defined(HAVE_PTHREAD)
 
-      /* Test existence of file using access() before stat(),
-         as this may be less costly on some filesytems
-         (such as on LUSTRE, due to metadata handling aspects). */
+      /* When available, run the check from a helper thread between step
+         boundaries, so the time stepping path only harvests the result
+         of the previous (asynchronous) check; this check is thus one
+         step late, which is not an issue for interactive control. */
 
-      if (access(path, F_OK) == 0)
-        f_size = cs_file_size(path);
+      if (_checker_active) {
+        pthread_join(_checker_thread, NULL);
+        _checker_active = false;
+        f_size = _checker_f_size;
+      }
+      else
+        f_size = _check_file_size();
+
+      if (f_size < 0) {
+        if (pthread_create(&_checker_thread, NULL,
+                           _check_file_size_thread, NULL) == 0)
+          _checker_active = true;
+      }
 
 #else
 
-      f_size = cs_file_size(path);
+      f_size = _check_file_size();
 
 #endif
 
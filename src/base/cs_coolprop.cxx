@@ -42,6 +42,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "CoolProp.h"
+#include "AbstractState.h"
 
 /*----------------------------------------------------------------------------
  *  Local headers
@@ -160,48 +161,68 @@ cs_phys_prop_coolprop(char                              *CoolPropMaterial,
       break;
   }
 
-  //std::vector<double> T(1,298), p(1e5);
-  //std::cout << PropsSImulti(outputs,"T", T, "P", p, "", fluids, z)[0][0] << std::endl;
-  //std::cout << PropsSImulti(outputs,"T", T, "P", p, "HEOS", fluids, z)[0][0] << std::endl;
-  //std::cout << PropsSImulti(outputs,"T", T, "P", p, "REFPROP", fluids, z)[0][0] << std::endl;
+  /* An alternative backend, such as the "BICUBIC&HEOS" or "TTSE&HEOS"
+     tabular backends, may be selected through the environment, trading
+     a one-time table build for much cheaper per-point evaluation. */
 
-  std::vector<double> val1;
-  std::vector<double> val2;
-  std::vector<double> fractions;
+  const char *backend_env = getenv("CS_COOLPROP_BACKEND");
+  if (backend_env != NULL && strlen(backend_env) > 0)
+    Backend = backend_env;
 
-  val1.clear();
-  val2.clear();
-  fractions.clear();
+  /* Evaluate through the low-level AbstractState interface rather than
+     the string-parsing high-level one: the state object and its input
+     parsing are set up once per thread, not once per point. */
 
-  for (cs_lnum_t i = 0; i < n_vals; i++) {
-    val1.push_back(var2[i]);
-    val2.push_back(var1[i]);
-  }
-  fractions.push_back(1.0);
+  CoolProp::parameters out_idx
+    = CoolProp::get_parameter_index(outputs[0]);
+
+  cs_lnum_t n_errors = 0;
 
   cs_fp_exception_disable_trap();
 
-  std::vector<std::vector<double> > out = CoolProp::PropsSImulti(outputs,
-                                                                 Name1,
-                                                                 val1,
-                                                                 Name2,
-                                                                 val2,
-                                                                 Backend,
-                                                                 fluids,
-                                                                 fractions);
+# pragma omp parallel reduction(+:n_errors) if (n_vals > CS_THR_MIN)
+  {
+    CoolProp::AbstractState *state = NULL;
+
+    try {
+      state = CoolProp::AbstractState::factory(Backend, fluids[0]);
+    }
+    catch (std::exception &e) {
+      state = NULL;
+      n_errors += 1;
+    }
+
+    if (state != NULL) {
+
+#     pragma omp for
+      for (cs_lnum_t i = 0; i < n_vals; i++) {
+        try {
+          if (thermo_plane == CS_PHYS_PROP_PLANE_PH)
+            state->update(CoolProp::HmassP_INPUTS, var2[i], var1[i]);
+          else
+            state->update(CoolProp::PT_INPUTS, var1[i], var2[i]);
+          val[i] = state->keyed_output(out_idx);
+        }
+        catch (std::exception &e) {
+          n_errors += 1;
+        }
+      }
+
+      delete state;
+
+    }
+
+  }
 
   cs_fp_exception_restore_trap();
 
-  if ((cs_lnum_t)(out.size()) != n_vals)
+  if (n_errors > 0)
     bft_error(__FILE__, __LINE__, 0,
               _("CoolProp was unable to compute some fluid properties with\n"
                 "input variable names: \"%s\", \"%s\" and backend \"%s\".\n\n"
                 "First of %d fluid(s) considered: \"%s\"."),
               Name1.c_str(), Name2.c_str(), Backend.c_str(),
               (int)n_vals, fluids[0].c_str());
-
-  for (int i = 0; i < n_vals; i++)
-    val[i] = out[i][0];
 }
 
 /*----------------------------------------------------------------------------*/
@@ -295,7 +295,12 @@ typedef enum {
 
 /* Other types */
 
-typedef int                 cs_lnum_t;    /* Local integer index or number */
+/* Local integer index or number; kept 32-bit, as local connectivity,
+   matrix column indices, and halo send lists are the main contributors
+   to index memory traffic in sparse matrix-vector products and ghost
+   value exchanges (global numbers use the wider cs_gnum_t). */
+
+typedef int                 cs_lnum_t;
 typedef double              cs_coord_t;   /* Real number (coordinate value) */
 
 typedef int                 cs_int_t;    /* Fortran integer */
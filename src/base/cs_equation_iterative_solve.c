@@ -87,10 +87,482 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* List of field ids for which a matrix-free solve has been requested */
+
+static int   _n_matrix_free_fields = 0;
+static int  *_matrix_free_field_ids = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Indicate if a matrix-free solve has been requested for a given field.
+ *
+ * parameters:
+ *   f_id <-- field id
+ *
+ * returns:
+ *   true if a matrix-free solve has been requested, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_matrix_free_is_set(int  f_id)
+{
+  for (int i = 0; i < _n_matrix_free_fields; i++) {
+    if (_matrix_free_field_ids[i] == f_id)
+      return true;
+  }
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute the diagonal of the "simplified" advection/diffusion matrix for
+ * a scalar variable, without assembling its extradiagonal part.
+ *
+ * The diagonal obtained is identical to the one built by
+ * cs_matrix_wrapper_scalar, including the penalization of non invertible
+ * matrices; as the advection is upwind and the diffusion not reconstructed,
+ * the extradiagonal coefficients may be recomputed on the fly from the mass
+ * flux and the face diffusion velocity, so they are not stored.
+ *
+ * parameters:
+ *   iconvp     <-- advection flag (1: advection, 0: otherwise)
+ *   idiffp     <-- diffusion flag (1: diffusion, 0: otherwise)
+ *   ndircp     <-- number of Dirichlet BCs
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   imucpp     <-- 1 if the convective term is multiplied by Cp
+ *   coefbp     <-- boundary condition array for the variable (implicit part)
+ *   cofbfp     <-- boundary condition array for the variable flux
+ *                  (implicit part)
+ *   rovsdt     <-- contribution of the unsteady term to the diagonal
+ *   i_massflux <-- mass flux at interior faces
+ *   b_massflux <-- mass flux at boundary faces
+ *   i_visc     <-- diffusion velocity at interior faces for the matrix
+ *   b_visc     <-- surface at boundary faces for the matrix
+ *   xcpp       <-- array of specific heat (Cp)
+ *   da         --> diagonal part of the matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_free_diag_scalar(int               iconvp,
+                         int               idiffp,
+                         int               ndircp,
+                         double            thetap,
+                         int               imucpp,
+                         const cs_real_t   coefbp[],
+                         const cs_real_t   cofbfp[],
+                         const cs_real_t   rovsdt[],
+                         const cs_real_t   i_massflux[],
+                         const cs_real_t   b_massflux[],
+                         const cs_real_t   i_visc[],
+                         const cs_real_t   b_visc[],
+                         const cs_real_t   xcpp[],
+                         cs_real_t         da[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_groups = m->b_face_numbering->n_groups;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+
+  /* Initialization */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] = rovsdt[cell_id];
+  }
+  if (n_cells_ext > n_cells) {
+#   pragma omp parallel for if (n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = n_cells; cell_id < n_cells_ext; cell_id++) {
+      da[cell_id] = 0.;
+    }
+  }
+
+  /* Contribution of the extra-diagonal terms to the diagonal
+     (same formulas as in cs_matrix_scalar, with xcpp replaced by 1
+     when the convective term is not multiplied by Cp) */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t xcpi = (imucpp == 1) ? xcpp[ii] : 1.;
+        cs_real_t xcpj = (imucpp == 1) ? xcpp[jj] : 1.;
+
+        double flui = 0.5*(i_massflux[face_id] -fabs(i_massflux[face_id]));
+        double fluj =-0.5*(i_massflux[face_id] +fabs(i_massflux[face_id]));
+
+        double xa0 = thetap*(iconvp*xcpi*flui -idiffp*i_visc[face_id]);
+        double xa1 = thetap*(iconvp*xcpj*fluj -idiffp*i_visc[face_id]);
+
+        da[ii] -= xa0 + iconvp*(1. - thetap)*xcpi*i_massflux[face_id];
+        da[jj] -= xa1 - iconvp*(1. - thetap)*xcpj*i_massflux[face_id];
+
+      }
+    }
+  }
+
+  /* Contribution of boundary faces to the diagonal */
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp) \
+                        if(m->n_b_faces > CS_THR_MIN)
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = b_face_cells[face_id];
+
+        cs_real_t xcpi = (imucpp == 1) ? xcpp[ii] : 1.;
+
+        double flui = 0.5*(b_massflux[face_id] - fabs(b_massflux[face_id]));
+
+        da[ii] += iconvp*xcpi*(flui*thetap*(coefbp[face_id]-1.)
+                              -(1.-thetap)*b_massflux[face_id])
+                + idiffp*thetap*b_visc[face_id]*cofbfp[face_id];
+
+      }
+    }
+  }
+
+  /* Penalization if non invertible matrix */
+
+  if (ndircp <= 0) {
+    const double epsi = 1.e-7;
+
+#   pragma omp parallel for
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      da[cell_id] = (1.+epsi)*da[cell_id];
+    }
+  }
+
+  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    da[cell_id] += mq->c_solid_flag[CS_MIN(cs_glob_porous_model, 1)*cell_id];
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix-free product y = A.x with the "simplified" advection/diffusion
+ * matrix for a scalar variable.
+ *
+ * The extradiagonal coefficients are recomputed on the fly; the formulas
+ * must remain identical to those of cs_matrix_scalar, so that the operator
+ * matches the assembled matrix exactly.
+ *
+ * parameters:
+ *   iconvp     <-- advection flag (1: advection, 0: otherwise)
+ *   idiffp     <-- diffusion flag (1: diffusion, 0: otherwise)
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   imucpp     <-- 1 if the convective term is multiplied by Cp
+ *   i_massflux <-- mass flux at interior faces
+ *   i_visc     <-- diffusion velocity at interior faces for the matrix
+ *   xcpp       <-- array of specific heat (Cp)
+ *   da         <-- diagonal part of the matrix
+ *   x          <-> multiplying vector values (ghost values updated)
+ *   y          --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_free_vector_multiply(int               iconvp,
+                             int               idiffp,
+                             double            thetap,
+                             int               imucpp,
+                             const cs_real_t   i_massflux[],
+                             const cs_real_t   i_visc[],
+                             const cs_real_t   xcpp[],
+                             const cs_real_t   da[],
+                             cs_real_t         x[],
+                             cs_real_t         y[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+
+  /* Ghost values of x are needed by the face sweep */
+
+  if (m->halo != NULL)
+    cs_halo_sync_var(m->halo, CS_HALO_STANDARD, x);
+
+  /* Diagonal part of matrix.vector product */
+
+# pragma omp parallel for
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    y[cell_id] = da[cell_id]*x[cell_id];
+  }
+
+  /* Extradiagonal part, recomputed on the fly */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for firstprivate(thetap, iconvp, idiffp)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t xcpi = (imucpp == 1) ? xcpp[ii] : 1.;
+        cs_real_t xcpj = (imucpp == 1) ? xcpp[jj] : 1.;
+
+        double flui = 0.5*(i_massflux[face_id] -fabs(i_massflux[face_id]));
+        double fluj =-0.5*(i_massflux[face_id] +fabs(i_massflux[face_id]));
+
+        double xa0 = thetap*(iconvp*xcpi*flui -idiffp*i_visc[face_id]);
+        double xa1 = thetap*(iconvp*xcpj*fluj -idiffp*i_visc[face_id]);
+
+        y[ii] += xa0*x[jj];
+        y[jj] += xa1*x[ii];
+
+      }
+    }
+  }
+
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = rhs with the matrix-free operator, using a
+ * Jacobi-preconditioned Bi-CGSTAB algorithm (same variant as the one of
+ * cs_sles_it, with grouped dot products).
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   var_name   <-- variable name
+ *   iwarnp     <-- verbosity
+ *   iconvp     <-- advection flag (1: advection, 0: otherwise)
+ *   idiffp     <-- diffusion flag (1: diffusion, 0: otherwise)
+ *   thetap     <-- weighting coefficient for the theta-scheme
+ *   imucpp     <-- 1 if the convective term is multiplied by Cp
+ *   i_massflux <-- mass flux at interior faces
+ *   i_visc     <-- diffusion velocity at interior faces for the matrix
+ *   xcpp       <-- array of specific heat (Cp)
+ *   da         <-- diagonal part of the matrix
+ *   precision  <-- solver precision
+ *   r_norm     <-- residue normalization
+ *   n_iter     --> number of iterations
+ *   residue    <-> residue
+ *   rhs        <-- right hand side
+ *   vx         <-> system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_free_solve(const char       *var_name,
+                   int               iwarnp,
+                   int               iconvp,
+                   int               idiffp,
+                   double            thetap,
+                   int               imucpp,
+                   const cs_real_t   i_massflux[],
+                   const cs_real_t   i_visc[],
+                   const cs_real_t   xcpp[],
+                   const cs_real_t   da[],
+                   double            precision,
+                   double            r_norm,
+                   int              *n_iter,
+                   double           *residue,
+                   const cs_real_t   rhs[],
+                   cs_real_t        *restrict vx)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const double _epzero = 1.e-30; /* smaller than epzero */
+  const int n_max_iter = 10000;
+
+  double  ro_0, ro_1, alpha, beta, betam1, gamma, omega, ukres0;
+
+  cs_real_t  *restrict res0, *restrict rk, *restrict pk, *restrict zk;
+  cs_real_t  *restrict uk, *restrict vk;
+
+  /* Allocate work arrays (zk is fed to the matrix-free product,
+     whose halo exchange requires ghost values) */
+
+  BFT_MALLOC(res0, n_cells, cs_real_t);
+  BFT_MALLOC(rk, n_cells, cs_real_t);
+  BFT_MALLOC(pk, n_cells, cs_real_t);
+  BFT_MALLOC(zk, n_cells_ext, cs_real_t);
+  BFT_MALLOC(uk, n_cells, cs_real_t);
+  BFT_MALLOC(vk, n_cells, cs_real_t);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    pk[ii] = 0.0;
+    uk[ii] = 0.0;
+  }
+
+  /* Initialize iterative calculation */
+
+  _matrix_free_vector_multiply(iconvp, idiffp, thetap, imucpp,
+                               i_massflux, i_visc, xcpp, da,
+                               vx, res0);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    res0[ii] = -res0[ii] + rhs[ii];
+    rk[ii] = res0[ii];
+  }
+
+  alpha = 1.0;
+  betam1 = 1.0;
+  gamma = 1.0;
+
+  *n_iter = 0;
+
+  /* Current iteration */
+
+  while (true) {
+
+    if (*n_iter == 0) {
+      beta = cs_gdot(n_cells, rk, rk); /* rk == res0 here */
+      *residue = sqrt(beta);
+    }
+    else {
+      double s[2];
+      cs_dot_xx_xy(n_cells, rk, res0, s, s+1);
+      cs_parall_sum(2, CS_DOUBLE, s);
+      *residue = sqrt(s[0]);
+      beta = s[1];
+    }
+
+    /* Convergence test */
+
+    if (*residue <= precision*r_norm || *n_iter >= n_max_iter)
+      break;
+
+    /* Breakdown tests */
+
+    if (CS_ABS(beta) < _epzero || CS_ABS(alpha) < _epzero)
+      break;
+
+    *n_iter += 1;
+
+    omega = beta*gamma / (alpha*betam1);
+    betam1 = beta;
+
+    /* Compute pk */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+      pk[ii] = rk[ii] + omega*(pk[ii] - alpha*uk[ii]);
+
+    /* Compute zk = c.pk (Jacobi preconditioning) */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+      zk[ii] = pk[ii] / da[ii];
+
+    /* Compute uk = A.zk */
+
+    _matrix_free_vector_multiply(iconvp, idiffp, thetap, imucpp,
+                                 i_massflux, i_visc, xcpp, da,
+                                 zk, uk);
+
+    /* Compute uk.res0 and gamma */
+
+    ukres0 = cs_gdot(n_cells, uk, res0);
+
+    gamma = beta / ukres0;
+
+    /* First update of vx and rk */
+
+#   pragma omp parallel if(n_cells > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+        vx[ii] += (gamma * zk[ii]);
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+        rk[ii] -= (gamma * uk[ii]);
+    }
+
+    /* Compute zk = c.rk */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+      zk[ii] = rk[ii] / da[ii];
+
+    /* Compute vk = A.zk and alpha */
+
+    _matrix_free_vector_multiply(iconvp, idiffp, thetap, imucpp,
+                                 i_massflux, i_visc, xcpp, da,
+                                 zk, vk);
+
+    {
+      double s[2];
+      cs_dot_xx_xy(n_cells, vk, rk, s, s+1);
+      cs_parall_sum(2, CS_DOUBLE, s);
+      ro_1 = s[0];
+      ro_0 = s[1];
+    }
+
+    if (CS_ABS(ro_1) < _epzero)
+      break;
+
+    alpha = ro_0 / ro_1;
+
+    /* Final update of vx and rk */
+
+#   pragma omp parallel if(n_cells > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+        vx[ii] += (alpha * zk[ii]);
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+        rk[ii] -= (alpha * vk[ii]);
+    }
+
+  }
+
+  if (iwarnp >= 2)
+    bft_printf(_("%s [matrix-free BiCGstab]: %d iterations, residual %11.4e\n"),
+               var_name, *n_iter, *residue);
+
+  BFT_FREE(vk);
+  BFT_FREE(uk);
+  BFT_FREE(zk);
+  BFT_FREE(pk);
+  BFT_FREE(rk);
+  BFT_FREE(res0);
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -272,9 +744,11 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   int coupling_id = -1;
 
   cs_real_t *dam, *xam, *smbini, *w1, *adxk, *adxkm1, *dpvarm1, *rhs0;
-  cs_real_t *dam_conv, *xam_conv, *dam_diff, *xam_diff;
+  cs_real_t *dam_conv = NULL, *xam_conv = NULL;
+  cs_real_t *dam_diff = NULL, *xam_diff = NULL;
 
   bool conv_diff_mg = false;
+  bool matrix_free = false;
 
   /*============================================================================
    * 0.  Initialization
@@ -322,7 +796,7 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   bool symmetric = (isym == 1) ? true : false;
 
-  BFT_MALLOC(xam,isym*n_faces,cs_real_t);
+  xam = NULL;
   if (conv_diff_mg) {
     BFT_MALLOC(xam_conv, 2*n_faces, cs_real_t);
     BFT_MALLOC(xam_diff,   n_faces, cs_real_t);
@@ -377,6 +851,19 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
     }
   }
 
+  /* Determine if a matrix-free solve may be used for this variable;
+     cases requiring a specific solver setup or halo handling
+     (convection-diffusion multigrid, code coupling, rotational periodicity
+     of Reynolds stress components) keep the assembled path. */
+
+  if (f_id > -1 && _matrix_free_is_set(f_id)) {
+    if (!conv_diff_mg && coupling_id < 0 && iinvpe != 2)
+      matrix_free = true;
+  }
+
+  if (!matrix_free)
+    BFT_MALLOC(xam, isym*n_faces, cs_real_t);
+
   /*============================================================================
    * 1.  Building of the "simplified" matrix
    *==========================================================================*/
@@ -402,6 +889,22 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                        dam_diff,
                                        xam_diff);
   }
+  else if (matrix_free) {
+    _matrix_free_diag_scalar(iconvp,
+                             idiffp,
+                             ndircp,
+                             thetap,
+                             imucpp,
+                             coefbp,
+                             cofbfp,
+                             rovsdt,
+                             i_massflux,
+                             b_massflux,
+                             i_viscm,
+                             b_viscm,
+                             xcpp,
+                             dam);
+  }
   else {
     cs_matrix_wrapper_scalar(iconvp,
                              idiffp,
@@ -590,15 +1093,27 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   if (iinvpe == 2)
     rotation_mode = CS_HALO_ROTATION_IGNORE;
 
-  cs_matrix_vector_native_multiply(symmetric,
-                                   db_size,
-                                   eb_size,
-                                   rotation_mode,
-                                   f_id,
-                                   dam,
-                                   xam,
-                                   pvar,
-                                   w1);
+  if (matrix_free)
+    _matrix_free_vector_multiply(iconvp,
+                                 idiffp,
+                                 thetap,
+                                 imucpp,
+                                 i_massflux,
+                                 i_viscm,
+                                 xcpp,
+                                 dam,
+                                 pvar,
+                                 w1);
+  else
+    cs_matrix_vector_native_multiply(symmetric,
+                                     db_size,
+                                     eb_size,
+                                     rotation_mode,
+                                     f_id,
+                                     dam,
+                                     xam,
+                                     pvar,
+                                     w1);
 
 # pragma omp parallel for
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
@@ -650,35 +1165,18 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
     if (iinvpe == 2)
       rotation_mode = CS_HALO_ROTATION_ZERO;
 
-    if (conv_diff_mg)
-      cs_sles_setup_native_conv_diff(f_id,
-                                     var_name,
-                                     db_size,
-                                     eb_size,
-                                     dam,
-                                     xam,
-                                     dam_conv,
-                                     xam_conv,
-                                     dam_diff,
-                                     xam_diff);
-
-    else if (coupling_id > -1)
-      cs_sles_setup_native_coupling(f_id,
-                                    var_name,
-                                    symmetric,
-                                    db_size,
-                                    eb_size,
-                                    dam,
-                                    xam);
-
-    cs_sles_solve_native(f_id,
-                         var_name,
-                         symmetric,
-                         db_size,
-                         eb_size,
+    if (matrix_free) {
+
+      _matrix_free_solve(var_name,
+                         iwarnp,
+                         iconvp,
+                         idiffp,
+                         thetap,
+                         imucpp,
+                         i_massflux,
+                         i_viscm,
+                         xcpp,
                          dam,
-                         xam,
-                         rotation_mode,
                          epsilp,
                          rnorm,
                          &niterf,
@@ -686,6 +1184,47 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                          smbrp,
                          dpvar);
 
+    }
+    else {
+
+      if (conv_diff_mg)
+        cs_sles_setup_native_conv_diff(f_id,
+                                       var_name,
+                                       db_size,
+                                       eb_size,
+                                       dam,
+                                       xam,
+                                       dam_conv,
+                                       xam_conv,
+                                       dam_diff,
+                                       xam_diff);
+
+      else if (coupling_id > -1)
+        cs_sles_setup_native_coupling(f_id,
+                                      var_name,
+                                      symmetric,
+                                      db_size,
+                                      eb_size,
+                                      dam,
+                                      xam);
+
+      cs_sles_solve_native(f_id,
+                           var_name,
+                           symmetric,
+                           db_size,
+                           eb_size,
+                           dam,
+                           xam,
+                           rotation_mode,
+                           epsilp,
+                           rnorm,
+                           &niterf,
+                           &ressol,
+                           smbrp,
+                           dpvar);
+
+    }
+
     /* Dynamic relaxation of the system */
     if (iswdyp >= 1) {
 
@@ -2593,6 +3132,39 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Request a matrix-free solve for a given variable.
+ *
+ * The "simplified" (upwind, non-reconstructed) matrix of the iterative
+ * process is then not assembled for this variable: only its diagonal is
+ * stored, and the solver's operator recomputes the extradiagonal
+ * contributions on the fly from the mass flux and the face diffusion
+ * velocity, saving the memory of the extradiagonal coefficient arrays.
+ * The system is solved with a Jacobi-preconditioned BiCGstab algorithm,
+ * so the linear solver options otherwise selected for the field do not
+ * apply.
+ *
+ * Only scalar variable solves are handled; the assembled path is also
+ * kept for cases requiring a specific solver setup (convection-diffusion
+ * multigrid, code coupling, or rotational periodicity with Reynolds
+ * stress components).
+ *
+ * \param[in]     f_id          field id of the variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_iterative_solve_set_matrix_free(int  f_id)
+{
+  if (_matrix_free_is_set(f_id))
+    return;
+
+  BFT_REALLOC(_matrix_free_field_ids, _n_matrix_free_fields + 1, int);
+
+  _matrix_free_field_ids[_n_matrix_free_fields] = f_id;
+  _n_matrix_free_fields += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -430,6 +430,30 @@ cs_equation_iterative_solve_tensor(int                   idtvar,
                                    cs_real_6_t           smbrp[],
                                    cs_real_6_t           pvar[]);
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Request a matrix-free solve for a given variable.
+ *
+ * The "simplified" (upwind, non-reconstructed) matrix of the iterative
+ * process is then not assembled for this variable: only its diagonal is
+ * stored, and the solver's operator recomputes the extradiagonal
+ * contributions on the fly from the mass flux and the face diffusion
+ * velocity, saving the memory of the extradiagonal coefficient arrays.
+ * The system is solved with a Jacobi-preconditioned BiCGstab algorithm,
+ * so the linear solver options otherwise selected for the field do not
+ * apply.
+ *
+ * Only scalar variable solves are handled; the assembled path is also
+ * kept for cases requiring a specific solver setup (convection-diffusion
+ * multigrid, code coupling, or rotational periodicity with Reynolds
+ * stress components).
+ *
+ * \param[in]     f_id          field id of the variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_iterative_solve_set_matrix_free(int  f_id);
+
 END_C_DECLS
 
 #endif /* __CS_EQUATION_ITERATIVE_SOLVE_H__ */
@@ -139,6 +139,12 @@ BEGIN_C_DECLS
 
 #define _CS_FIELD_S_ALLOC_SIZE       16
 
+/* Alignment of field value arrays: one or several full memory pages, so
+   that the page placement decided by the first touch below is never
+   shared with a neighboring allocation touched by another thread */
+
+#define _CS_FIELD_VAL_ALIGN          4096
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -504,6 +510,9 @@ _field_create(const char   *name,
 
   f->is_owner = true;
 
+  f->single_precision = false;
+  f->val_f = NULL;
+
   /* Mark key values as not set */
 
   for (key_id = 0; key_id < _n_keys_max; key_id++) {
@@ -537,12 +546,22 @@ _add_val(cs_lnum_t   n_elts,
   cs_lnum_t  ii;
   cs_real_t  *val = val_old;
 
-  BFT_REALLOC(val, n_elts*dim, cs_real_t);
+  /* Align fresh arrays on page boundaries when aligned allocation is
+     available so that no page is shared with another allocation; on NUMA
+     nodes, the pages then belong to the threads touching them below */
+
+  if (val == NULL && bft_mem_have_memalign())
+    BFT_MEMALIGN(val, _CS_FIELD_VAL_ALIGN, n_elts*dim, cs_real_t);
+  else
+    BFT_REALLOC(val, n_elts*dim, cs_real_t);
 
   /* Initialize field. This should not be necessary, but when using
      threads with Open MP, this should help ensure that the memory will
      first be touched by the same core that will later operate on
-     this memory, usually leading to better core/memory affinity. */
+     this memory, usually leading to better core/memory affinity. The
+     loops below use the same (static) scheduling as the main loops
+     working on fields so that each page is mapped close to the core
+     which accesses it most. */
 
   if (dim == 1) {
 #   pragma omp parallel for
@@ -1714,6 +1733,24 @@ cs_field_allocate_values(cs_field_t  *f)
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
     int ii;
 
+    /* Single-precision storage: val remains NULL, and access goes through
+       cs_field_export_values / cs_field_import_values */
+
+    if (f->single_precision) {
+
+      assert(f->n_time_vals == 1);
+
+      const cs_lnum_t _n_vals = n_elts[2]*(cs_lnum_t)(f->dim);
+
+      BFT_REALLOC(f->val_f, _n_vals, float);
+
+#     pragma omp parallel for
+      for (cs_lnum_t i = 0; i < _n_vals; i++)
+        f->val_f[i] = 0.f;
+
+      return;
+    }
+
     /* Initialization */
 
     for (ii = 0; ii < f->n_time_vals; ii++)
@@ -1725,6 +1762,114 @@ cs_field_allocate_values(cs_field_t  *f)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Switch a field to single-precision storage.
+ *
+ * This is reserved for fields which never enter the numerics
+ * (postprocessing auxiliaries, statistics, ...): variable fields and
+ * fields with previous time values are not allowed. It must be called
+ * before values are allocated; the field's \c val pointer then remains
+ * NULL, and values are accessed through \ref cs_field_export_values and
+ * \ref cs_field_import_values, which convert transparently.
+ *
+ * \param[in, out]  f  pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_set_single_precision(cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  if (f->val != NULL || f->val_f != NULL || f->is_owner == false)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field \"%s\"\n"
+                " can no longer switch to single-precision storage, as its"
+                " values are already allocated or mapped."),
+              f->name);
+  else if (f->type & CS_FIELD_VARIABLE)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field \"%s\"\n"
+                " may not use single-precision storage, as this is reserved"
+                " for fields which never enter the numerics."),
+              f->name);
+  else if (f->n_time_vals > 1)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Field \"%s\"\n"
+                " may not use single-precision storage, as it maintains"
+                " previous time values."),
+              f->name);
+
+  f->single_precision = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy the current values of a field to a double-precision buffer.
+ *
+ * For single-precision fields, values are converted; for other fields,
+ * they are simply copied, so callers may handle both storage modes in a
+ * uniform manner.
+ *
+ * \param[in]   f     pointer to field structure
+ * \param[out]  vals  destination buffer (size: dim * number of elements,
+ *                    including ghosts, of the field's location)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_export_values(const cs_field_t  *f,
+                       cs_real_t          vals[])
+{
+  assert(f != NULL);
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t _n_vals = n_elts[2]*(cs_lnum_t)(f->dim);
+
+  if (f->single_precision) {
+    const float *val_f = f->val_f;
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
+      vals[ii] = val_f[ii];
+  }
+  else
+    memcpy(vals, f->val, _n_vals*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the current values of a field from a double-precision buffer.
+ *
+ * For single-precision fields, values are converted; for other fields,
+ * they are simply copied, so callers may handle both storage modes in a
+ * uniform manner.
+ *
+ * \param[in, out]  f     pointer to field structure
+ * \param[in]       vals  source buffer (size: dim * number of elements,
+ *                        including ghosts, of the field's location)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_import_values(cs_field_t       *f,
+                       const cs_real_t   vals[])
+{
+  assert(f != NULL);
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t _n_vals = n_elts[2]*(cs_lnum_t)(f->dim);
+
+  if (f->single_precision) {
+    float *val_f = f->val_f;
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
+      val_f[ii] = vals[ii];
+  }
+  else
+    memcpy(f->val, vals, _n_vals*sizeof(cs_real_t));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Map existing value arrays to field descriptor.
@@ -1774,6 +1919,10 @@ cs_field_map_values(cs_field_t   *f,
  * coefficient arrays are arrays of block matrices, not vectors, so the
  * number of entries for each boundary face is dim*dim instead of dim.
  *
+ * The coefficient arrays of a given field are contiguous in memory, in
+ * the a, b, af, bf, ad, bd, ac, bc, hint, hext order of the structure
+ * members present.
+ *
  * \param[in, out]  f             pointer to field structure
  * \param[in]       have_flux_bc  if true, flux bc coefficients (af and bf)
  *                                are added
@@ -1816,94 +1965,79 @@ cs_field_allocate_bc_coeffs(cs_field_t  *f,
     const int location_id = CS_MESH_LOCATION_BOUNDARY_FACES;
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(location_id);
 
-    if (f->bc_coeffs == NULL) {
+    cs_real_t *p;
+    cs_lnum_t block_size = n_elts[0]*(a_mult + b_mult);
 
-      BFT_MALLOC(f->bc_coeffs, 1, cs_field_bc_coeffs_t);
+    if (have_flux_bc)
+      block_size += n_elts[0]*(a_mult + b_mult);
+    if (have_mom_bc)
+      block_size += n_elts[0]*(a_mult + b_mult);
+    if (have_conv_bc)
+      block_size += n_elts[0]*(a_mult + b_mult);
+    if (have_exch_bc)
+      block_size += n_elts[0]*2;
 
-      f->bc_coeffs->location_id = location_id;
+    /* All coefficient arrays of a field are carved out of a single
+       contiguous block anchored at bc_coeffs->a, so that boundary loops
+       accessing several coefficients of a field walk one memory block;
+       only that anchor may be freed or reallocated. */
 
-      BFT_MALLOC(f->bc_coeffs->a, n_elts[0]*a_mult, cs_real_t);
-      BFT_MALLOC(f->bc_coeffs->b, n_elts[0]*b_mult, cs_real_t);
+    if (f->bc_coeffs == NULL) {
+      BFT_MALLOC(f->bc_coeffs, 1, cs_field_bc_coeffs_t);
+      f->bc_coeffs->a = NULL;
+    }
+    else
+      BFT_FREE(f->bc_coeffs->a);
 
-      if (have_flux_bc) {
-        BFT_MALLOC(f->bc_coeffs->af, n_elts[0]*a_mult, cs_real_t);
-        BFT_MALLOC(f->bc_coeffs->bf, n_elts[0]*b_mult, cs_real_t);
-      }
-      else {
-        f->bc_coeffs->af = NULL;
-        f->bc_coeffs->bf = NULL;
-      }
+    f->bc_coeffs->location_id = location_id;
 
-      if (have_mom_bc) {
-        BFT_MALLOC(f->bc_coeffs->ad, n_elts[0]*a_mult, cs_real_t);
-        BFT_MALLOC(f->bc_coeffs->bd, n_elts[0]*b_mult, cs_real_t);
-      }
-      else {
-        f->bc_coeffs->ad = NULL;
-        f->bc_coeffs->bd = NULL;
-      }
+    BFT_MALLOC(f->bc_coeffs->a, block_size, cs_real_t);
 
-      if (have_conv_bc) {
-        BFT_MALLOC(f->bc_coeffs->ac, n_elts[0]*a_mult, cs_real_t);
-        BFT_MALLOC(f->bc_coeffs->bc, n_elts[0]*b_mult, cs_real_t);
-      }
-      else {
-        f->bc_coeffs->ac = NULL;
-        f->bc_coeffs->bc = NULL;
-      }
+    p = f->bc_coeffs->a + n_elts[0]*a_mult;
 
-      if (have_exch_bc) {
-        BFT_MALLOC(f->bc_coeffs->hint, n_elts[0], cs_real_t);
-        BFT_MALLOC(f->bc_coeffs->hext, n_elts[0], cs_real_t);
-      }
-      else {
-        f->bc_coeffs->hint = NULL;
-        f->bc_coeffs->hext = NULL;
-      }
+    f->bc_coeffs->b = p;
+    p += n_elts[0]*b_mult;
 
+    if (have_flux_bc) {
+      f->bc_coeffs->af = p;
+      p += n_elts[0]*a_mult;
+      f->bc_coeffs->bf = p;
+      p += n_elts[0]*b_mult;
     }
-
     else {
+      f->bc_coeffs->af = NULL;
+      f->bc_coeffs->bf = NULL;
+    }
 
-      BFT_REALLOC(f->bc_coeffs->a, n_elts[0]*a_mult, cs_real_t);
-      BFT_REALLOC(f->bc_coeffs->b, n_elts[0]*b_mult, cs_real_t);
-
-      if (have_flux_bc) {
-        BFT_REALLOC(f->bc_coeffs->af, n_elts[0]*a_mult, cs_real_t);
-        BFT_REALLOC(f->bc_coeffs->bf, n_elts[0]*b_mult, cs_real_t);
-      }
-      else {
-        BFT_FREE(f->bc_coeffs->af);
-        BFT_FREE(f->bc_coeffs->bf);
-      }
-
-      if (have_mom_bc) {
-        BFT_REALLOC(f->bc_coeffs->ad, n_elts[0]*a_mult, cs_real_t);
-        BFT_REALLOC(f->bc_coeffs->bd, n_elts[0]*b_mult, cs_real_t);
-      }
-      else {
-        BFT_FREE(f->bc_coeffs->ad);
-        BFT_FREE(f->bc_coeffs->bd);
-      }
-
-      if (have_conv_bc) {
-        BFT_REALLOC(f->bc_coeffs->ac, n_elts[0]*a_mult, cs_real_t);
-        BFT_REALLOC(f->bc_coeffs->bc, n_elts[0]*b_mult, cs_real_t);
-      }
-      else {
-        BFT_FREE(f->bc_coeffs->ac);
-        BFT_FREE(f->bc_coeffs->bc);
-      }
+    if (have_mom_bc) {
+      f->bc_coeffs->ad = p;
+      p += n_elts[0]*a_mult;
+      f->bc_coeffs->bd = p;
+      p += n_elts[0]*b_mult;
+    }
+    else {
+      f->bc_coeffs->ad = NULL;
+      f->bc_coeffs->bd = NULL;
+    }
 
-      if (have_exch_bc) {
-        BFT_MALLOC(f->bc_coeffs->hint, n_elts[0], cs_real_t);
-        BFT_MALLOC(f->bc_coeffs->hext, n_elts[0], cs_real_t);
-      }
-      else {
-        BFT_FREE(f->bc_coeffs->hint);
-        BFT_FREE(f->bc_coeffs->hext);
-      }
+    if (have_conv_bc) {
+      f->bc_coeffs->ac = p;
+      p += n_elts[0]*a_mult;
+      f->bc_coeffs->bc = p;
+      p += n_elts[0]*b_mult;
+    }
+    else {
+      f->bc_coeffs->ac = NULL;
+      f->bc_coeffs->bc = NULL;
+    }
 
+    if (have_exch_bc) {
+      f->bc_coeffs->hint = p;
+      f->bc_coeffs->hext = p + n_elts[0];
+    }
+    else {
+      f->bc_coeffs->hint = NULL;
+      f->bc_coeffs->hext = NULL;
     }
 
   }
@@ -2139,11 +2273,133 @@ cs_field_set_values(cs_field_t  *f,
   const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
   const cs_lnum_t _n_vals = n_elts[2]*f->dim;
 
+  if (f->single_precision) {
+    const float _c = c;
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
+      f->val_f[ii] = _c;
+    return;
+  }
+
 # pragma omp parallel for
   for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
     f->val[ii] = c;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the number of values required to store the current values
+ *         of a field using the AoSoA (block interleaved) layout.
+ *
+ * The element count is rounded up to a multiple of
+ * \ref CS_FIELD_AOSOA_BLOCK so that each block is complete.
+ *
+ * \param[in]  f  pointer to field structure
+ *
+ * \return number of cs_real_t values of the matching AoSoA buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_field_aosoa_size(const cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t b = CS_FIELD_AOSOA_BLOCK;
+  const cs_lnum_t n_blocks = (n_elts[2] + b - 1) / b;
+
+  return n_blocks * b * f->dim;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Copy the current values of a field to a buffer using the AoSoA
+ *         (block interleaved) layout.
+ *
+ * With a block size b and a field of dimension d, component j of element i
+ * is stored at (i/b)*d*b + j*b + i%b: inside a block, each component is
+ * contiguous over b elements, so SIMD kernels can load full vector
+ * registers with unit stride. The buffer must provide at least
+ * \ref cs_field_aosoa_size values; the padding of the last block is
+ * zeroed.
+ *
+ * \param[in]   f    pointer to field structure
+ * \param[out]  buf  buffer using the AoSoA layout
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gather_aosoa(const cs_field_t  *f,
+                      cs_real_t         *buf)
+{
+  assert(f != NULL && buf != NULL);
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t _n_elts = n_elts[2];
+  const cs_lnum_t dim = f->dim;
+  const cs_lnum_t b = CS_FIELD_AOSOA_BLOCK;
+  const cs_lnum_t n_blocks = (_n_elts + b - 1) / b;
+  const cs_real_t *val = f->val;
+
+# pragma omp parallel for
+  for (cs_lnum_t ib = 0; ib < n_blocks; ib++) {
+
+    const cs_lnum_t i_s = ib*b;
+    const cs_lnum_t i_e = CS_MIN(i_s + b, _n_elts);
+    cs_real_t  *_buf = buf + ib*dim*b;
+
+    for (cs_lnum_t jj = 0; jj < dim; jj++) {
+      for (cs_lnum_t ii = i_s; ii < i_e; ii++)
+        _buf[jj*b + ii-i_s] = val[ii*dim + jj];
+      for (cs_lnum_t ii = i_e; ii < i_s + b; ii++)
+        _buf[jj*b + ii-i_s] = 0.;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set the current values of a field from a buffer using the AoSoA
+ *         (block interleaved) layout.
+ *
+ * Reverse operation of \ref cs_field_gather_aosoa; the padding of the
+ * last block is ignored.
+ *
+ * \param[in]       buf  buffer using the AoSoA layout
+ * \param[in, out]  f    pointer to field structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_scatter_aosoa(const cs_real_t   *buf,
+                       cs_field_t        *f)
+{
+  assert(f != NULL && buf != NULL);
+
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t _n_elts = n_elts[2];
+  const cs_lnum_t dim = f->dim;
+  const cs_lnum_t b = CS_FIELD_AOSOA_BLOCK;
+  const cs_lnum_t n_blocks = (_n_elts + b - 1) / b;
+  cs_real_t *val = f->val;
+
+# pragma omp parallel for
+  for (cs_lnum_t ib = 0; ib < n_blocks; ib++) {
+
+    const cs_lnum_t i_s = ib*b;
+    const cs_lnum_t i_e = CS_MIN(i_s + b, _n_elts);
+    const cs_real_t  *_buf = buf + ib*dim*b;
+
+    for (cs_lnum_t jj = 0; jj < dim; jj++) {
+      for (cs_lnum_t ii = i_s; ii < i_e; ii++)
+        val[ii*dim + jj] = _buf[jj*b + ii-i_s];
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Copy current field values to previous values if applicable.
@@ -2207,6 +2463,55 @@ cs_field_current_to_previous(cs_field_t  *f)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a checksum of the current values of a given field.
+ *
+ * The checksum is based on the local values associated with the field's
+ * location (ghost values excluded), and is summed over MPI ranks, so it
+ * is identical on all ranks; it may be used to cheaply detect fields
+ * whose values have not changed between successive outputs. It is not
+ * independent of the partitioning or element renumbering.
+ *
+ * \param[in]  f  pointer to field structure
+ *
+ * \return  checksum of the field's current values
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_field_checksum(const cs_field_t  *f)
+{
+  assert(f != NULL);
+
+  /* 64-bit FNV-1a over the value array bytes */
+
+  unsigned long long h = 0xcbf29ce484222325ULL;
+
+  if (f->val != NULL) {
+
+    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+    size_t n_bytes = (size_t)(n_elts[0]) * f->dim * sizeof(cs_real_t);
+
+    const unsigned char *v = (const unsigned char *)f->val;
+
+    for (size_t i = 0; i < n_bytes; i++) {
+      h = h ^ v[i];
+      h = h * 0x100000001b3ULL;
+    }
+
+  }
+
+  /* Fold so the value also fits a 32-bit cs_gnum_t, and sum
+     contributions over ranks */
+
+  cs_gnum_t retval = (cs_gnum_t)(h ^ (h >> 32));
+
+  cs_parall_counter(&retval, 1);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy all defined fields.
@@ -2226,17 +2531,10 @@ cs_field_destroy_all(void)
         BFT_FREE(f->vals[ii]);
     }
     BFT_FREE(f->vals);
+    BFT_FREE(f->val_f);
     if (f->bc_coeffs != NULL) {
+      /* All coefficient arrays share the block anchored at a */
       BFT_FREE(f->bc_coeffs->a);
-      BFT_FREE(f->bc_coeffs->b);
-      BFT_FREE(f->bc_coeffs->af);
-      BFT_FREE(f->bc_coeffs->bf);
-      BFT_FREE(f->bc_coeffs->ad);
-      BFT_FREE(f->bc_coeffs->bd);
-      BFT_FREE(f->bc_coeffs->ac);
-      BFT_FREE(f->bc_coeffs->bc);
-      BFT_FREE(f->bc_coeffs->hint);
-      BFT_FREE(f->bc_coeffs->hext);
       BFT_FREE(f->bc_coeffs);
     }
   }
@@ -3774,6 +4072,10 @@ cs_field_log_info(const cs_field_t  *f,
     cs_log_printf(CS_LOG_SETUP,
                   _("    Values mapped from external definition\n"));
 
+  if (f->single_precision)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("    Single-precision storage\n"));
+
   if (_n_keys > 0 && log_keywords > 0) {
     int i;
     const char null_str[] = "(null)";
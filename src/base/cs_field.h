@@ -76,6 +76,10 @@ BEGIN_C_DECLS
 
 /*! @} */
 
+/*! Block size of the AoSoA (block interleaved) layout handled by
+    \ref cs_field_gather_aosoa and \ref cs_field_scatter_aosoa */
+#define CS_FIELD_AOSOA_BLOCK         8
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -151,6 +155,14 @@ typedef struct {
 
   bool                    is_owner;     /* Ownership flag for values */
 
+  bool                    single_precision; /* Use single-precision storage
+                                               (allowed only for fields which
+                                               never enter the numerics) */
+
+  float                  *val_f;        /* Pointer to single-precision values
+                                           array when single-precision storage
+                                           is used (val is then NULL) */
+
 } cs_field_t;
 
 /*----------------------------------------------------------------------------
@@ -260,6 +272,55 @@ cs_field_set_n_time_vals(cs_field_t  *f,
 void
 cs_field_allocate_values(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Request single-precision storage for a field's values.
+ *
+ * This is allowed only for fields which never enter the numerics
+ * (i.e. not of type CS_FIELD_VARIABLE), own their values, maintain a
+ * single time value, and whose values have not been allocated yet.
+ *
+ * For such fields, the "val" pointer remains NULL, and values are
+ * accessed through cs_field_export_values and cs_field_import_values.
+ *
+ * parameters:
+ *   f <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_set_single_precision(cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Export a field's current values to a double-precision array.
+ *
+ * For single-precision fields, values are converted; otherwise, they
+ * are simply copied. The vals array must be of size f->dim * number of
+ * elements (including ghosts) on the field's location.
+ *
+ * parameters:
+ *   f    <-- pointer to field structure
+ *   vals --> destination array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_export_values(const cs_field_t  *f,
+                       cs_real_t          vals[]);
+
+/*----------------------------------------------------------------------------
+ * Import a field's current values from a double-precision array.
+ *
+ * For single-precision fields, values are converted; otherwise, they
+ * are simply copied. The vals array must be of size f->dim * number of
+ * elements (including ghosts) on the field's location.
+ *
+ * parameters:
+ *   f    <-> pointer to field structure
+ *   vals <-- source array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_import_values(cs_field_t       *f,
+                       const cs_real_t   vals[]);
+
 /*----------------------------------------------------------------------------
  * Map existing value arrays to field descriptor.
  *
@@ -337,6 +398,53 @@ void
 cs_field_set_values(cs_field_t  *f,
                     cs_real_t    c);
 
+/*----------------------------------------------------------------------------
+ * Return the number of values required to store the current values of a
+ * field using the AoSoA (block interleaved) layout.
+ *
+ * The element count is rounded up to a multiple of CS_FIELD_AOSOA_BLOCK
+ * so that each block is complete.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   number of cs_real_t values of the matching AoSoA buffer
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_field_aosoa_size(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Copy the current values of a field to a buffer using the AoSoA (block
+ * interleaved) layout.
+ *
+ * With a block size b and a field of dimension d, component j of element i
+ * is stored at (i/b)*d*b + j*b + i%b, so each component is contiguous over
+ * b elements inside a block.
+ *
+ * parameters:
+ *   f   <-- pointer to field structure
+ *   buf --> buffer using the AoSoA layout
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gather_aosoa(const cs_field_t  *f,
+                      cs_real_t         *buf);
+
+/*----------------------------------------------------------------------------
+ * Set the current values of a field from a buffer using the AoSoA (block
+ * interleaved) layout.
+ *
+ * parameters:
+ *   buf <-- buffer using the AoSoA layout
+ *   f   <-> pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_scatter_aosoa(const cs_real_t   *buf,
+                       cs_field_t        *f);
+
 /*----------------------------------------------------------------------------
  * Copy current field values to previous values if applicable.
  *
@@ -350,6 +458,25 @@ cs_field_set_values(cs_field_t  *f,
 void
 cs_field_current_to_previous(cs_field_t  *f);
 
+/*----------------------------------------------------------------------------
+ * Compute a checksum of the current values of a given field.
+ *
+ * The checksum is based on the local values associated with the field's
+ * location (ghost values excluded), and is summed over MPI ranks, so it
+ * is identical on all ranks; it may be used to cheaply detect fields
+ * whose values have not changed between successive outputs. It is not
+ * independent of the partitioning or element renumbering.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *
+ * returns:
+ *   checksum of the field's current values
+ *----------------------------------------------------------------------------*/
+
+cs_gnum_t
+cs_field_checksum(const cs_field_t  *f);
+
 /*----------------------------------------------------------------------------
  * Destroy all defined fields.
  *----------------------------------------------------------------------------*/
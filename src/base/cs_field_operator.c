@@ -56,9 +56,11 @@
 #include "cs_parameters.h"
 #include "cs_parall.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_internal_coupling.h"
+#include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -98,10 +100,38 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Cached gradient values for a given field, with a validity tag, so
+   successive gradient computations with identical inputs in the same
+   time step may reuse the previous result */
+
+typedef struct {
+
+  bool        active;          /* caching requested for this field ? */
+  int         nt_cur;          /* time step id of cached values */
+  int         use_previous_t;  /* tag: previous time step values used ? */
+  int         inc;             /* tag: increment flag */
+  cs_lnum_t   n_vals;          /* size of cached array */
+  cs_real_t  *grad;            /* cached gradient values, including
+                                  ghost values */
+
+} _gradient_cache_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Gradient cache entries, indexed by field id */
+
+static int                 _n_grad_caches = 0;
+static _gradient_cache_t  *_grad_caches = NULL;
+
+/* Field whose halo exchange is in progress, for split-phase
+   synchronization (the shared halo communication buffers allow
+   only one active exchange at a given time) */
+
+static const cs_field_t  *_sync_pending_f = NULL;
+static cs_halo_type_t     _sync_pending_halo_type = CS_HALO_STANDARD;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -143,12 +173,127 @@ void
 cs_f_field_set_volume_average(int       f_id,
                               cs_real_t va);
 
+void
+cs_f_field_sync_begin(int  f_id);
+
+void
+cs_f_field_sync_end(int  f_id);
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return the gradient cache entry matching a given field, creating
+ * default (inactive) entries if needed.
+ *
+ * parameters:
+ *   f <-- pointer to field
+ *
+ * returns:
+ *   pointer to matching gradient cache entry
+ *----------------------------------------------------------------------------*/
+
+static _gradient_cache_t *
+_gradient_cache_entry(const cs_field_t  *f)
+{
+  const int n_fields = cs_field_n_fields();
+
+  if (_n_grad_caches < n_fields) {
+    BFT_REALLOC(_grad_caches, n_fields, _gradient_cache_t);
+    for (int i = _n_grad_caches; i < n_fields; i++) {
+      _grad_caches[i].active = false;
+      _grad_caches[i].nt_cur = -1;
+      _grad_caches[i].use_previous_t = -1;
+      _grad_caches[i].inc = -1;
+      _grad_caches[i].n_vals = 0;
+      _grad_caches[i].grad = NULL;
+    }
+    _n_grad_caches = n_fields;
+  }
+
+  return _grad_caches + f->id;
+}
+
+/*----------------------------------------------------------------------------
+ * Copy cached gradient values for a given field if they are valid for
+ * the current time step and computation options.
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   n_vals         <-- number of gradient values, including ghost values
+ *   grad           --> gradient if cached values are valid
+ *
+ * returns:
+ *   true if valid cached values were copied to grad, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_retrieve(const cs_field_t    *f,
+                         bool                 use_previous_t,
+                         int                  inc,
+                         cs_lnum_t            n_vals,
+                         cs_real_t  *restrict grad)
+{
+  if (f->id >= _n_grad_caches)
+    return false;
+
+  const _gradient_cache_t *c = _grad_caches + f->id;
+
+  if (c->active == false || c->grad == NULL)
+    return false;
+
+  if (   c->nt_cur != cs_glob_time_step->nt_cur
+      || c->use_previous_t != (int)use_previous_t
+      || c->inc != inc
+      || c->n_vals != n_vals)
+    return false;
+
+  memcpy(grad, c->grad, n_vals*sizeof(cs_real_t));
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Save freshly-computed gradient values for a given field if caching is
+ * active for that field.
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   n_vals         <-- number of gradient values, including ghost values
+ *   grad           <-- computed gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_store(const cs_field_t  *f,
+                      bool               use_previous_t,
+                      int                inc,
+                      cs_lnum_t          n_vals,
+                      const cs_real_t   *grad)
+{
+  _gradient_cache_t *c = _gradient_cache_entry(f);
+
+  if (c->active == false)
+    return;
+
+  if (c->n_vals != n_vals) {
+    BFT_REALLOC(c->grad, n_vals, cs_real_t);
+    c->n_vals = n_vals;
+  }
+
+  memcpy(c->grad, grad, n_vals*sizeof(cs_real_t));
+
+  c->nt_cur = cs_glob_time_step->nt_cur;
+  c->use_previous_t = (int)use_previous_t;
+  c->inc = inc;
+}
+
 /*----------------------------------------------------------------------------
  * Interpolate field values at a given set of points using P0 interpolation.
  *
@@ -261,6 +406,11 @@ _field_interpolate_by_gradient(const cs_field_t   *f,
  * For each mesh cell this function finds the local extrema of a
  * scalar field.
  *
+ * When the mesh adjacencies helper arrays are available, both extrema are
+ * gathered in a single pass over each cell's neighborhood, with no write
+ * conflicts, so the inner loops may be vectorized; otherwise, the legacy
+ * face-based sweeps are used.
+ *
  * parameters:
  *   pvar            <-- scalar values
  *   halo_type       <-- halo type
@@ -277,6 +427,56 @@ _local_extrema_scalar(const cs_real_t *restrict pvar,
   const cs_mesh_t *m = cs_glob_mesh;
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  const cs_mesh_adjacencies_t *madj = cs_glob_mesh_adjacencies;
+
+  if (madj != NULL && madj->cell_cells_idx != NULL) {
+
+    const cs_lnum_t *restrict c_c_idx
+      = (const cs_lnum_t *restrict)madj->cell_cells_idx;
+    const cs_lnum_t *restrict c_c
+      = (const cs_lnum_t *restrict)madj->cell_cells;
+    const cs_lnum_t *restrict c_c_e_idx
+      = (const cs_lnum_t *restrict)madj->cell_cells_e_idx;
+    const cs_lnum_t *restrict c_c_e
+      = (const cs_lnum_t *restrict)madj->cell_cells_e;
+
+    const bool e_nbr = (   halo_type == CS_HALO_EXTENDED
+                        && c_c_e_idx != NULL);
+
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+      cs_real_t p_max = pvar[ii];
+      cs_real_t p_min = pvar[ii];
+
+      for (cs_lnum_t i = c_c_idx[ii]; i < c_c_idx[ii+1]; i++) {
+        cs_real_t pj = pvar[c_c[i]];
+        p_max = CS_MAX(p_max, pj);
+        p_min = CS_MIN(p_min, pj);
+      }
+
+      if (e_nbr) {
+        for (cs_lnum_t i = c_c_e_idx[ii]; i < c_c_e_idx[ii+1]; i++) {
+          cs_real_t pj = pvar[c_c_e[i]];
+          p_max = CS_MAX(p_max, pj);
+          p_min = CS_MIN(p_min, pj);
+        }
+      }
+
+      local_max[ii] = p_max;
+      local_min[ii] = p_min;
+
+    }
+
+    /* Synchronisation */
+    if (m->halo != NULL) {
+      cs_halo_sync_var(m->halo, halo_type, local_min);
+      cs_halo_sync_var(m->halo, halo_type, local_max);
+    }
+
+    return;
+  }
   const int n_i_groups = m->i_face_numbering->n_groups;
   const int n_i_threads = m->i_face_numbering->n_threads;
   const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
@@ -505,6 +705,36 @@ cs_f_field_set_volume_average(int       f_id,
                               va);
 }
 
+/*----------------------------------------------------------------------------
+ * Start halo synchronization of field values.
+ *
+ * parameters:
+ *   f_id <-- field id
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_field_sync_begin(int  f_id)
+{
+  cs_field_t *f = cs_field_by_id(f_id);
+
+  cs_field_sync_begin(f, CS_HALO_STANDARD);
+}
+
+/*----------------------------------------------------------------------------
+ * Finish halo synchronization of field values.
+ *
+ * parameters:
+ *   f_id <-- field id
+ *----------------------------------------------------------------------------*/
+
+void
+cs_f_field_sync_end(int  f_id)
+{
+  cs_field_t *f = cs_field_by_id(f_id);
+
+  cs_field_sync_end(f);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -535,6 +765,12 @@ cs_field_gradient_scalar(const cs_field_t          *f,
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_ITER;
 
+  const cs_lnum_t n_vals = cs_glob_mesh->n_cells_with_ghosts * 3;
+
+  if (_gradient_cache_retrieve(f, use_previous_t, inc, n_vals,
+                               (cs_real_t *)grad))
+    return;
+
   static int key_cal_opt_id = -1;
   if (key_cal_opt_id < 0)
     key_cal_opt_id = cs_field_key_id("var_cal_opt");
@@ -601,6 +837,8 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  _gradient_cache_store(f, use_previous_t, inc, n_vals, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -718,6 +956,12 @@ cs_field_gradient_vector(const cs_field_t          *f,
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_ITER;
 
+  const cs_lnum_t n_vals = cs_glob_mesh->n_cells_with_ghosts * 9;
+
+  if (_gradient_cache_retrieve(f, use_previous_t, inc, n_vals,
+                               (cs_real_t *)grad))
+    return;
+
   static int key_cal_opt_id = -1;
   if (key_cal_opt_id < 0)
     key_cal_opt_id = cs_field_key_id("var_cal_opt");
@@ -773,6 +1017,8 @@ cs_field_gradient_vector(const cs_field_t          *f,
                      c_weight,
                      cpl,
                      grad);
+
+  _gradient_cache_store(f, use_previous_t, inc, n_vals, (const cs_real_t *)grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -825,6 +1071,67 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                      grad);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate lazy gradient caching for a given field.
+ *
+ * Once caching is active, calls to \ref cs_field_gradient_scalar or
+ * \ref cs_field_gradient_vector reuse the last computed gradient as long
+ * as the time step id and computation options are unchanged, avoiding
+ * recomputation when the same gradient is required by several models in
+ * the same time step.
+ *
+ * If the field values are modified between gradient computations inside
+ * a given time step, \ref cs_field_gradient_cache_invalidate must be
+ * called so as to force an actual recomputation.
+ *
+ * \param[in]  f  pointer to field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_activate(const cs_field_t  *f)
+{
+  _gradient_cache_t *c = _gradient_cache_entry(f);
+
+  c->active = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Invalidate cached gradient values for a given field.
+ *
+ * This should be called whenever the field values are modified outside
+ * the regular time stepping (or several times inside a time step), so
+ * that the next gradient computation does not reuse stale values.
+ *
+ * \param[in]  f  pointer to field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_invalidate(const cs_field_t  *f)
+{
+  if (f->id < _n_grad_caches)
+    _grad_caches[f->id].nt_cur = -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all gradient caching structures.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_finalize(void)
+{
+  for (int i = 0; i < _n_grad_caches; i++)
+    BFT_FREE(_grad_caches[i].grad);
+
+  BFT_FREE(_grad_caches);
+  _n_grad_caches = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Interpolate field values at a given set of points.
@@ -1008,6 +1315,110 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start synchronization of current parallel and periodic field values.
+ *
+ * This function posts the halo exchange of \ref cs_field_synchronize but
+ * does not wait for its completion, so that computation not depending on
+ * the field's ghost values may overlap with the communication. It must be
+ * matched by a call to \ref cs_field_sync_end on the same field before its
+ * ghost values are accessed; as the halo communication buffers are shared,
+ * only one such exchange may be in progress at a given time.
+ *
+ * This function currently only updates fields based on
+ * CS_MESH_LOCATION_CELLS.
+ *
+ * \param[in, out]   f           pointer to field
+ * \param[in]        halo_type   halo type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_begin(cs_field_t      *f,
+                    cs_halo_type_t   halo_type)
+{
+  if (f->location_id == CS_MESH_LOCATION_CELLS) {
+
+    const cs_halo_t *halo = cs_glob_mesh->halo;
+
+    if (halo != NULL) {
+
+      if (_sync_pending_f != NULL)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s: the halo exchange of field \"%s\" is still in\n"
+                    "progress; only one field synchronization may be "
+                    "active at a given time."),
+                  __func__, _sync_pending_f->name);
+
+      if (f->dim == 1)
+        cs_halo_sync_var_start(halo, halo_type, f->val);
+      else
+        cs_halo_sync_var_strided_start(halo, halo_type, f->val, f->dim);
+
+      _sync_pending_f = f;
+      _sync_pending_halo_type = halo_type;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finish synchronization of current parallel and periodic field
+ *        values started by \ref cs_field_sync_begin.
+ *
+ * Upon return, the field's ghost values are up to date, as after a call
+ * to \ref cs_field_synchronize.
+ *
+ * If no exchange is in progress for the given field (for example if the
+ * matching call to \ref cs_field_sync_begin was conditional), this
+ * function does nothing, so begin and end calls do not need to share
+ * the same control flow.
+ *
+ * \param[in, out]   f   pointer to field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_end(cs_field_t  *f)
+{
+  if (_sync_pending_f != f)
+    return;
+
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+  cs_halo_type_t halo_type = _sync_pending_halo_type;
+
+  _sync_pending_f = NULL;
+
+  if (f->dim == 1)
+    cs_halo_sync_var_finish(halo, halo_type, f->val);
+
+  else {
+
+    cs_halo_sync_var_strided_finish(halo, halo_type, f->val, f->dim);
+
+    if (cs_glob_mesh->n_init_perio > 0) {
+      switch(f->dim) {
+      case 9:
+        cs_halo_perio_sync_var_tens(halo, halo_type, f->val);
+        break;
+      case 6:
+        cs_halo_perio_sync_var_sym_tens(halo, halo_type, f->val);
+        break;
+      case 3:
+        cs_halo_perio_sync_var_vect(halo, halo_type, f->val, 3);
+        break;
+      default:
+        break;
+      }
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -137,6 +137,40 @@ cs_field_gradient_tensor(const cs_field_t          *f,
                          int                        inc,
                          cs_real_63_t     *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Activate lazy gradient caching for a given field.
+ *
+ * Once caching is active, calls to cs_field_gradient_scalar or
+ * cs_field_gradient_vector reuse the last computed gradient as long as
+ * the time step id and computation options are unchanged.
+ *
+ * parameters:
+ *   f <-- pointer to field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_activate(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Invalidate cached gradient values for a given field.
+ *
+ * This should be called whenever the field values are modified outside
+ * the regular time stepping (or several times inside a time step).
+ *
+ * parameters:
+ *   f <-- pointer to field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_invalidate(const cs_field_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Free all gradient caching structures.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_finalize(void);
+
 /*----------------------------------------------------------------------------
  * Interpolate field values at a given set of points.
  *
@@ -207,6 +241,49 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start synchronization of current parallel and periodic field values.
+ *
+ * This function posts the halo exchange of \ref cs_field_synchronize but
+ * does not wait for its completion, so that computation not depending on
+ * the field's ghost values may overlap with the communication. It must be
+ * matched by a call to \ref cs_field_sync_end on the same field before its
+ * ghost values are accessed; as the halo communication buffers are shared,
+ * only one such exchange may be in progress at a given time.
+ *
+ * This function currently only updates fields based on
+ * CS_MESH_LOCATION_CELLS.
+ *
+ * \param[in, out]   f           pointer to field
+ * \param[in]        halo_type   halo type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_begin(cs_field_t      *f,
+                    cs_halo_type_t   halo_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finish synchronization of current parallel and periodic field
+ *        values started by \ref cs_field_sync_begin.
+ *
+ * Upon return, the field's ghost values are up to date, as after a call
+ * to \ref cs_field_synchronize.
+ *
+ * If no exchange is in progress for the given field (for example if the
+ * matching call to \ref cs_field_sync_begin was conditional), this
+ * function does nothing, so begin and end calls do not need to share
+ * the same control flow.
+ *
+ * \param[in, out]   f   pointer to field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_sync_end(cs_field_t  *f);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -57,6 +57,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
+#if defined(HAVE_ZLIB)
+#include <zlib.h>
+#endif
+
 #if defined(HAVE_SYS_TYPES_H) && defined(HAVE_SYS_STAT_H)
 # include <sys/stat.h>
 # include <sys/types.h>
@@ -69,6 +77,12 @@
 #include <dirent.h>
 #endif
 
+#if defined(HAVE_SYS_TYPES_H) && defined(HAVE_SYS_STAT_H) \
+ && defined(HAVE_UNISTD_H) && !defined(WIN32) && !defined(_WIN32)
+#include <sys/mman.h>
+#define CS_FILE_HAVE_MMAP 1
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -175,10 +189,72 @@ BEGIN_C_DECLS
 /* MPI tag for file operations */
 #define CS_FILE_MPI_TAG  (int)('C'+'S'+'_'+'F'+'I'+'L'+'E')
 
+/* Buffer size for draining staged (burst-buffer) files */
+
+#define CS_FILE_STAGING_BUF_SIZE  (1 << 23)
+
+/* Maximum number of bytes queued for a background I/O thread */
+
+#define CS_FILE_WQUEUE_MAX_BYTES  (1 << 28)
+
+/* Nonblocking collective file IO requires MPI-IO 3.1 */
+
+#if defined(HAVE_MPI_IO) && defined(MPI_VERSION)
+#  if (MPI_VERSION > 3) || (MPI_VERSION == 3 && MPI_SUBVERSION > 0)
+#    define HAVE_MPI_IO_NONBLOCKING_COLL 1
+#  endif
+#endif
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
 
+#if defined(HAVE_PTHREAD)
+
+/* Block queued for writing by a background I/O thread */
+
+typedef struct _cs_file_wblock_t {
+
+  void                     *buf;      /* copy of the data to write */
+  size_t                    n_bytes;  /* number of bytes to write */
+
+  struct _cs_file_wblock_t *next;     /* next queued block */
+
+} _cs_file_wblock_t;
+
+/* Write queue consumed by a background I/O thread; blocks are written
+   in queuing order, so the destination stream's position always matches
+   that of an equivalent sequence of direct writes once the queue is
+   empty. */
+
+typedef struct _cs_file_wqueue_t {
+
+  FILE               *sh;        /* destination stream */
+#if defined(HAVE_ZLIB)
+  gzFile              zf;        /* compressed destination stream, or NULL */
+#endif
+  char               *name;      /* destination name (when close deferred) */
+
+  _cs_file_wblock_t  *head;      /* oldest queued block */
+  _cs_file_wblock_t  *tail;      /* newest queued block */
+
+  size_t              n_bytes;   /* total bytes currently queued */
+
+  bool                done;      /* no more blocks will be queued */
+  bool                close_sh;  /* close stream once drained ? */
+  int                 error;     /* errno of first failed write, or 0 */
+
+  pthread_mutex_t     lock;      /* queue access lock */
+  pthread_cond_t      cond;      /* queue state change notification */
+
+  pthread_t           thread;    /* consuming I/O thread */
+
+  struct _cs_file_wqueue_t  *next;  /* next queue with deferred close */
+
+} _cs_file_wqueue_t;
+
+#endif /* defined(HAVE_PTHREAD) */
+
 /* File descriptor */
 
 struct _cs_file_t {
@@ -192,6 +268,24 @@ struct _cs_file_t {
 
   FILE              *sh;           /* Serial file handle */
 
+#if defined(HAVE_ZLIB)
+  gzFile             zf;           /* Compressed serial file handle */
+#endif
+
+  FILE              *stage_sh;     /* Node-local staging file handle */
+  char              *stage_name;   /* Node-local staging file name */
+
+#if defined(CS_FILE_HAVE_MMAP)
+  void              *map;          /* Read-only memory-mapping of file
+                                      contents, or NULL */
+  cs_file_off_t      map_size;     /* Size of mapped region */
+  cs_file_off_t      map_offset;   /* Current position in mapped region */
+#endif
+
+#if defined(HAVE_PTHREAD)
+  _cs_file_wqueue_t *wq;           /* Background write queue, or NULL */
+#endif
+
 #if defined(HAVE_MPI)
   MPI_Comm           comm;         /* Associated MPI communicator */
   MPI_Comm           io_comm;      /* Associated MPI-IO communicator */
@@ -200,6 +294,12 @@ struct _cs_file_t {
   MPI_File           fh;           /* MPI file handle */
   MPI_Info           info;         /* MPI file info */
   MPI_Offset         offset;       /* MPI file offset */
+  _Bool              async_write;  /* Use asynchronous (double-buffered)
+                                      block writes ? */
+  _Bool              awrite_pending;  /* Write in progress ? */
+  size_t             awrite_buf_size; /* Size of staging buffer */
+  unsigned char     *awrite_buf;      /* Staging buffer for pending write */
+  MPI_Request        awrite_request;  /* Pending write request */
 #else
   cs_file_off_t      offset;       /* File offset */
 #endif
@@ -268,6 +368,45 @@ static MPI_Info _mpi_io_hints_w = MPI_INFO_NULL;
 
 #endif
 
+/* Node-local staging (burst-buffer) directory for file output */
+
+static char  *_staging_dir = NULL;
+
+#if defined(CS_FILE_HAVE_MMAP)
+
+/* Use memory-mapping for serial (rank 0) reads when possible ? */
+
+static int  _use_mmap = 0;
+
+#endif
+
+#if defined(HAVE_PTHREAD)
+
+/* Pending background drains of staged files */
+
+typedef struct _staging_drain_t {
+
+  char                     *name;        /* destination file name */
+  char                     *stage_name;  /* staged file name */
+
+  pthread_t                 thread;      /* draining thread */
+
+  struct _staging_drain_t  *next;        /* next pending drain */
+
+} _staging_drain_t;
+
+static _staging_drain_t  *_staging_drains = NULL;
+
+/* Use a dedicated I/O thread for serialized (rank 0) block writes ? */
+
+static int  _use_io_thread = 0;
+
+/* Write queues whose file close has been deferred to the I/O thread */
+
+static _cs_file_wqueue_t  *_wqueue_closes = NULL;
+
+#endif
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -348,6 +487,615 @@ _access_method(cs_file_access_t  m,
   return _m;
 }
 
+/*----------------------------------------------------------------------------
+ * Build the name of the node-local staging file matching a given file.
+ *
+ * parameters:
+ *   name <-- destination file name (possibly includng a directory part)
+ *   rank <-- rank id in the file's main communicator
+ *
+ * returns:
+ *   allocated staging file name
+ *----------------------------------------------------------------------------*/
+
+static char *
+_staging_file_name(const char  *name,
+                   int          rank)
+{
+  char *stage_name = NULL;
+  size_t l;
+
+  const char *base = name;
+  const char *p;
+
+  for (p = name; *p != '\0'; p++) {
+    if (*p == '/' || *p == '\\')
+      base = p + 1;
+  }
+
+  l = strlen(_staging_dir) + strlen(base) + 16;
+  BFT_MALLOC(stage_name, l, char);
+  snprintf(stage_name, l, "%s/%s_p%04d", _staging_dir, base, rank);
+  stage_name[l-1] = '\0';
+
+  return stage_name;
+}
+
+/*----------------------------------------------------------------------------
+ * Set the position in a staged or destination file handle.
+ *
+ * parameters:
+ *   sh     <-> stdio file handle
+ *   name   <-- associated file name (for error messages)
+ *   offset <-- position relative to the beginning of the file
+ *----------------------------------------------------------------------------*/
+
+static void
+_staging_seek(FILE           *sh,
+              const char     *name,
+              cs_file_off_t   offset)
+{
+  int retval = 0;
+
+#if (SIZEOF_LONG < 8)
+
+  /* For 32-bit systems, large file support may be necessary */
+
+# if defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+
+  retval = fseeko(sh, (off_t)offset, SEEK_SET);
+
+# else
+
+  long _offset = offset;
+
+  if (_offset == offset)
+    retval = fseek(sh, _offset, SEEK_SET);
+  else
+    retval = -1;
+
+# endif
+
+#else /* SIZEOF_LONG >= 8 */
+
+  retval = fseek(sh, (long)offset, SEEK_SET);
+
+#endif /* SIZEOF_LONG */
+
+  if (retval != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error setting position in file \"%s\":\n\n  %s"),
+              name, strerror(errno));
+}
+
+/*----------------------------------------------------------------------------
+ * Append a record to a file's staging file.
+ *
+ * Each record is prefixed by its destination displacement and its size,
+ * so the staged data may be drained to the destination file later with
+ * no additional metadata.
+ *
+ * parameters:
+ *   f       <-> file with active staging
+ *   buf     <-- data to write
+ *   n_bytes <-- number of bytes to write
+ *   disp    <-- displacement in the destination file
+ *
+ * returns:
+ *   number of payload bytes written (errors are fatal)
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_staging_write(cs_file_t      *f,
+               const void     *buf,
+               size_t          n_bytes,
+               cs_file_off_t   disp)
+{
+  cs_file_off_t header[2];
+  size_t retval = 0;
+
+  if (n_bytes == 0)
+    return retval;
+
+  header[0] = disp;
+  header[1] = (cs_file_off_t)n_bytes;
+
+  if (fwrite(header, sizeof(cs_file_off_t), 2, f->stage_sh) == 2)
+    retval = fwrite(buf, 1, n_bytes, f->stage_sh);
+
+  if (retval != n_bytes)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error writing to staging file \"%s\":\n\n  %s"),
+              f->stage_name, strerror(errno));
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Drain a staged file to its destination file, then remove it.
+ *
+ * This function may run in a helper thread, so it uses no shared state
+ * other than read-only strings, and plain malloc/free rather than the
+ * (instrumented) BFT equivalents.
+ *
+ * parameters:
+ *   name       <-- destination file name
+ *   stage_name <-- staged file name
+ *----------------------------------------------------------------------------*/
+
+static void
+_staging_drain(const char  *name,
+               const char  *stage_name)
+{
+  unsigned char *buf;
+
+  FILE *ssh = fopen(stage_name, "rb");
+  FILE *dsh = fopen(name, "r+b");
+
+  if (ssh == NULL || dsh == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file \"%s\":\n\n  %s"),
+              (ssh == NULL) ? stage_name : name, strerror(errno));
+
+  buf = malloc(CS_FILE_STAGING_BUF_SIZE);
+  if (buf == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error draining staging file \"%s\":\n\n  %s"),
+              stage_name, strerror(errno));
+
+  while (true) {
+
+    cs_file_off_t header[2], n_left;
+
+    if (fread(header, sizeof(cs_file_off_t), 2, ssh) < 2)
+      break;
+
+    _staging_seek(dsh, name, header[0]);
+
+    for (n_left = header[1]; n_left > 0; ) {
+
+      size_t block_size = CS_FILE_STAGING_BUF_SIZE;
+      if ((cs_file_off_t)block_size > n_left)
+        block_size = n_left;
+
+      if (   fread(buf, 1, block_size, ssh) != block_size
+          || fwrite(buf, 1, block_size, dsh) != block_size)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error draining staging file \"%s\":\n\n  %s"),
+                  stage_name, strerror(errno));
+
+      n_left -= block_size;
+
+    }
+
+  }
+
+  free(buf);
+
+  if (fclose(ssh) != 0 || fclose(dsh) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file \"%s\":\n\n  %s"),
+              name, strerror(errno));
+
+  remove(stage_name);
+}
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Thread entry point draining one staged file.
+ *
+ * parameters:
+ *   arg <-> pointer to associated _staging_drain_t structure
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_staging_drain_thread(void  *arg)
+{
+  _staging_drain_t *d = arg;
+
+  _staging_drain(d->name, d->stage_name);
+
+  return NULL;
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
+/*----------------------------------------------------------------------------
+ * Close a file's staging file and drain it to its destination, using a
+ * helper thread if available so the caller regains control immediately.
+ *
+ * parameters:
+ *   f <-> file with active staging
+ *----------------------------------------------------------------------------*/
+
+static void
+_staging_drain_start(cs_file_t  *f)
+{
+  if (fclose(f->stage_sh) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file \"%s\":\n\n  %s"),
+              f->stage_name, strerror(errno));
+  f->stage_sh = NULL;
+
+#if defined(HAVE_PTHREAD)
+  {
+    _staging_drain_t *d;
+
+    BFT_MALLOC(d, 1, _staging_drain_t);
+    BFT_MALLOC(d->name, strlen(f->name) + 1, char);
+    strcpy(d->name, f->name);
+    d->stage_name = f->stage_name; /* ownership transferred to drain */
+    f->stage_name = NULL;
+    d->next = _staging_drains;
+
+    if (pthread_create(&(d->thread), NULL, _staging_drain_thread, d) == 0) {
+      _staging_drains = d;
+      return;
+    }
+
+    /* In case of thread creation failure, fall back to immediate drain */
+
+    f->stage_name = d->stage_name;
+    BFT_FREE(d->name);
+    BFT_FREE(d);
+  }
+#endif
+
+  _staging_drain(f->name, f->stage_name);
+  BFT_FREE(f->stage_name);
+}
+
+#if defined(HAVE_ZLIB)
+
+/*----------------------------------------------------------------------------
+ * Write data to a gzip-compressed file, chunking writes so sizes larger
+ * than the int range handled by gzwrite() are supported.
+ *
+ * parameters:
+ *   zf      <-> compressed file handle
+ *   buf     <-- pointer to data to write
+ *   n_bytes <-- number of bytes to write
+ *
+ * returns:
+ *   the number of bytes successfully written
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_gzwrite_bytes(gzFile       zf,
+               const void  *buf,
+               size_t       n_bytes)
+{
+  size_t n_written = 0;
+
+  const unsigned char *_buf = buf;
+
+  while (n_written < n_bytes) {
+    size_t n_remain = n_bytes - n_written;
+    unsigned n = (n_remain > (1<<30)) ? (unsigned)(1<<30) : (unsigned)n_remain;
+    int ret = gzwrite(zf, _buf + n_written, n);
+    if (ret <= 0)
+      break;
+    n_written += ret;
+  }
+
+  return n_written;
+}
+
+#endif /* defined(HAVE_ZLIB) */
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Thread entry point consuming a file's write queue.
+ *
+ * Queued blocks are written in order; in case of error, remaining blocks
+ * are dequeued without being written, and the error is reported when the
+ * queue is flushed or finalized.
+ *
+ * parameters:
+ *   arg <-> pointer to associated _cs_file_wqueue_t structure
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_file_wqueue_thread(void  *arg)
+{
+  _cs_file_wqueue_t *wq = arg;
+
+  pthread_mutex_lock(&wq->lock);
+
+  while (true) {
+
+    _cs_file_wblock_t *wb;
+
+    while (wq->head == NULL && wq->done == false)
+      pthread_cond_wait(&wq->cond, &wq->lock);
+
+    wb = wq->head;
+    if (wb == NULL)
+      break;
+
+    wq->head = wb->next;
+    if (wq->head == NULL)
+      wq->tail = NULL;
+
+    pthread_mutex_unlock(&wq->lock);
+
+    size_t n_written = 0;
+    if (wq->error == 0) {
+#if defined(HAVE_ZLIB)
+      if (wq->zf != NULL)
+        n_written = _gzwrite_bytes(wq->zf, wb->buf, wb->n_bytes);
+      else
+#endif
+        n_written = fwrite(wb->buf, 1, wb->n_bytes, wq->sh);
+    }
+
+    pthread_mutex_lock(&wq->lock);
+
+    if (wq->error == 0 && n_written != wb->n_bytes)
+      wq->error = (errno != 0) ? errno : EIO;
+
+    wq->n_bytes -= wb->n_bytes;
+    free(wb->buf);
+    free(wb);
+
+    pthread_cond_broadcast(&wq->cond);
+  }
+
+  pthread_mutex_unlock(&wq->lock);
+
+  /* When the associated file has already been "closed" by the caller,
+     the stream is closed here, once all queued data has been written. */
+
+  if (wq->close_sh) {
+#if defined(HAVE_ZLIB)
+    if (wq->zf != NULL) {
+      if (gzclose(wq->zf) != Z_OK && wq->error == 0)
+        wq->error = EIO;
+      wq->zf = NULL;
+    }
+    else
+#endif
+    if (fclose(wq->sh) != 0 && wq->error == 0)
+      wq->error = (errno != 0) ? errno : EIO;
+    wq->sh = NULL;
+  }
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Start a background write queue for a file.
+ *
+ * The file's serial handle must already be open. In case of thread
+ * creation failure, no queue is associated, and writes remain direct.
+ *
+ * parameters:
+ *   f <-> file for which background writes are to be used
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_wqueue_start(cs_file_t  *f)
+{
+  _cs_file_wqueue_t *wq;
+
+#if defined(HAVE_ZLIB)
+  assert(f->sh != NULL || f->zf != NULL);
+#else
+  assert(f->sh != NULL);
+#endif
+
+  BFT_MALLOC(wq, 1, _cs_file_wqueue_t);
+
+  wq->sh = f->sh;
+#if defined(HAVE_ZLIB)
+  wq->zf = f->zf;
+#endif
+  wq->name = NULL;
+  wq->head = NULL;
+  wq->tail = NULL;
+  wq->n_bytes = 0;
+  wq->done = false;
+  wq->close_sh = false;
+  wq->error = 0;
+  wq->next = NULL;
+
+  pthread_mutex_init(&wq->lock, NULL);
+  pthread_cond_init(&wq->cond, NULL);
+
+  if (pthread_create(&wq->thread, NULL, _file_wqueue_thread, wq) == 0)
+    f->wq = wq;
+
+  else {
+    pthread_mutex_destroy(&wq->lock);
+    pthread_cond_destroy(&wq->cond);
+    BFT_FREE(wq);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Append a block to a file's write queue.
+ *
+ * The data is copied, so the caller's buffer may be reused immediately.
+ * To bound memory usage, the call blocks while more than
+ * CS_FILE_WQUEUE_MAX_BYTES are already queued.
+ *
+ * Write errors are reported (as fatal errors) when the queue is flushed
+ * or finalized.
+ *
+ * parameters:
+ *   f       <-> file with an active write queue
+ *   buf     <-- pointer to data to write
+ *   n_bytes <-- number of bytes to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_wqueue_push(cs_file_t   *f,
+                  const void  *buf,
+                  size_t       n_bytes)
+{
+  _cs_file_wqueue_t *wq = f->wq;
+  _cs_file_wblock_t *wb;
+
+  if (n_bytes == 0)
+    return;
+
+  /* The queue's consumer thread uses matching free() calls, so BFT
+     memory management functions are not used here. */
+
+  wb = malloc(sizeof(_cs_file_wblock_t));
+  if (wb != NULL)
+    wb->buf = malloc(n_bytes);
+  if (wb == NULL || wb->buf == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Failure to allocate \"%s\" (%llu bytes)."),
+              "write queue block", (unsigned long long)n_bytes);
+
+  memcpy(wb->buf, buf, n_bytes);
+  wb->n_bytes = n_bytes;
+  wb->next = NULL;
+
+  pthread_mutex_lock(&wq->lock);
+
+  while (wq->n_bytes + n_bytes > CS_FILE_WQUEUE_MAX_BYTES
+         && wq->head != NULL)
+    pthread_cond_wait(&wq->cond, &wq->lock);
+
+  if (wq->tail != NULL)
+    wq->tail->next = wb;
+  else
+    wq->head = wb;
+  wq->tail = wb;
+  wq->n_bytes += n_bytes;
+
+  pthread_cond_broadcast(&wq->cond);
+  pthread_mutex_unlock(&wq->lock);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait until a file's write queue (if present) is empty.
+ *
+ * This must be called before any direct access to the file's serial
+ * handle (read, write, seek, or tell), so the stream position is
+ * identical to that of an equivalent sequence of direct writes.
+ *
+ * parameters:
+ *   f <-> file descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_wqueue_flush(cs_file_t  *f)
+{
+  _cs_file_wqueue_t *wq = f->wq;
+  int error;
+
+  if (wq == NULL)
+    return;
+
+  pthread_mutex_lock(&wq->lock);
+  while (wq->head != NULL)
+    pthread_cond_wait(&wq->cond, &wq->lock);
+  error = wq->error;
+  pthread_mutex_unlock(&wq->lock);
+
+  if (error != 0)
+    bft_error(__FILE__, __LINE__, error,
+              _("Error writing file \"%s\":\n\n  %s"),
+              f->name, strerror(error));
+}
+
+/*----------------------------------------------------------------------------
+ * Detach a file's write queue, deferring the stream's close to the
+ * I/O thread.
+ *
+ * The caller regains control immediately, while remaining queued blocks
+ * are written and the stream is closed in the background; the queue is
+ * added to the pending list, so completion may be checked later with
+ * _file_wqueue_close_wait().
+ *
+ * parameters:
+ *   f <-> file descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_wqueue_detach(cs_file_t  *f)
+{
+  _cs_file_wqueue_t *wq = f->wq;
+
+  BFT_MALLOC(wq->name, strlen(f->name) + 1, char);
+  strcpy(wq->name, f->name);
+
+  pthread_mutex_lock(&wq->lock);
+  wq->close_sh = true;
+  wq->done = true;
+  pthread_cond_broadcast(&wq->cond);
+  pthread_mutex_unlock(&wq->lock);
+
+  wq->next = _wqueue_closes;
+  _wqueue_closes = wq;
+
+  f->wq = NULL;
+  f->sh = NULL;
+#if defined(HAVE_ZLIB)
+  f->zf = NULL;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for pending background writes and deferred file closes.
+ *
+ * parameters:
+ *   name <-- if non-NULL, only wait for queues associated with this
+ *            file name; otherwise, wait for all pending queues
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_wqueue_close_wait(const char  *name)
+{
+  _cs_file_wqueue_t *wq = _wqueue_closes;
+  _cs_file_wqueue_t *prev = NULL;
+
+  while (wq != NULL) {
+
+    _cs_file_wqueue_t *next = wq->next;
+
+    if (name == NULL || strcmp(wq->name, name) == 0) {
+
+      pthread_join(wq->thread, NULL);
+
+      if (wq->error != 0)
+        bft_error(__FILE__, __LINE__, wq->error,
+                  _("Error writing file \"%s\":\n\n  %s"),
+                  wq->name, strerror(wq->error));
+
+      pthread_mutex_destroy(&wq->lock);
+      pthread_cond_destroy(&wq->cond);
+
+      if (prev != NULL)
+        prev->next = next;
+      else
+        _wqueue_closes = next;
+
+      BFT_FREE(wq->name);
+      BFT_FREE(wq);
+
+    }
+    else
+      prev = wq;
+
+    wq = next;
+  }
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -513,6 +1261,68 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+#if defined(CS_FILE_HAVE_MMAP)
+
+/*----------------------------------------------------------------------------
+ * Map a file opened for reading into memory.
+ *
+ * Subsequent reads are served directly from the (page-cache backed)
+ * mapping, avoiding per-block read system calls and buffer copies
+ * through the C library. In case of failure, the mapping is simply
+ * not used, and reads fall back to standard C IO.
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_map(cs_file_t  *f)
+{
+  struct stat  s;
+
+  int fd = fileno(f->sh);
+
+  assert(f->mode == CS_FILE_MODE_READ);
+
+  f->map = NULL;
+  f->map_size = 0;
+  f->map_offset = 0;
+
+  if (fd < 0 || fstat(fd, &s) != 0)
+    return;
+
+  if (s.st_size <= 0)
+    return;
+
+  void  *map = mmap(NULL, s.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  if (map == MAP_FAILED)
+    return;
+
+  f->map = map;
+  f->map_size = s.st_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Unmap a previously memory-mapped file.
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_unmap(cs_file_t  *f)
+{
+  if (f->map != NULL)
+    munmap(f->map, (size_t)f->map_size);
+
+  f->map = NULL;
+  f->map_size = 0;
+  f->map_offset = 0;
+}
+
+#endif /* defined(CS_FILE_HAVE_MMAP) */
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -578,9 +1388,22 @@ _file_close(cs_file_t  *f)
 {
   int retval = 0;
 
+#if defined(CS_FILE_HAVE_MMAP)
+  if (f->map != NULL)
+    _file_unmap(f);
+#endif
+
   if (f->sh != NULL)
     retval = fclose(f->sh);
 
+#if defined(HAVE_ZLIB)
+  if (f->zf != NULL) {
+    if (gzclose(f->zf) != Z_OK)
+      retval = -1;
+    f->zf = NULL;
+  }
+#endif
+
   if (retval != 0) {
     bft_error(__FILE__, __LINE__, 0,
               _("Error closing file \"%s\":\n\n"
@@ -615,6 +1438,24 @@ _file_read(cs_file_t  *f,
 
   assert(f->sh != NULL);
 
+#if defined(CS_FILE_HAVE_MMAP)
+
+  /* Serve reads directly from the memory-mapping when available */
+
+  if (f->map != NULL) {
+    size_t n_bytes = size*ni;
+    if (f->map_offset + (cs_file_off_t)n_bytes > f->map_size)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Premature end of file \"%s\""), f->name);
+    if (n_bytes > 0) {
+      memcpy(buf, (const char *)f->map + f->map_offset, n_bytes);
+      f->map_offset += n_bytes;
+    }
+    return ni;
+  }
+
+#endif
+
   if (ni != 0)
     retval = fread(buf, size, ni, f->sh);
 
@@ -658,6 +1499,31 @@ _file_write(cs_file_t   *f,
 {
   size_t retval = 0;
 
+#if defined(HAVE_PTHREAD)
+
+  /* When a background I/O thread is active, queue the data instead of
+     writing it directly; errors are then checked (and are fatal, as
+     below) when the queue is flushed, at the latest at close. */
+
+  if (f->wq != NULL) {
+    _file_wqueue_push(f, buf, size*ni);
+    return ni;
+  }
+
+#endif
+
+#if defined(HAVE_ZLIB)
+
+  if (f->zf != NULL) {
+    retval = _gzwrite_bytes(f->zf, buf, size*ni) / size;
+    if (retval != ni)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error writing file \"%s\""), f->name);
+    return retval;
+  }
+
+#endif
+
   assert(f->sh != NULL);
 
   if (ni != 0)
@@ -716,6 +1582,43 @@ _file_seek(cs_file_t       *f,
 
   assert(f != NULL);
 
+#if defined(HAVE_PTHREAD)
+  if (f->wq != NULL)
+    _file_wqueue_flush(f);
+#endif
+
+#if defined(HAVE_ZLIB)
+  if (f->zf != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error setting position in file \"%s\":\n\n  %s"),
+              f->name, _("not supported for gzip-compressed output"));
+#endif
+
+#if defined(CS_FILE_HAVE_MMAP)
+
+  if (f->map != NULL) {
+
+    cs_file_off_t _offset = offset;
+
+    if (whence == CS_FILE_SEEK_CUR)
+      _offset += f->map_offset;
+    else if (whence == CS_FILE_SEEK_END)
+      _offset += f->map_size;
+
+    if (_offset < 0 || _offset > f->map_size) {
+      retval = -1;
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error setting position in file \"%s\":\n\n  %s"),
+                f->name, strerror(EINVAL));
+    }
+    else
+      f->map_offset = _offset;
+
+    return retval;
+  }
+
+#endif
+
   if (f->sh != NULL) {
 
 #if (SIZEOF_LONG < 8)
@@ -787,6 +1690,23 @@ _file_tell(cs_file_t  *f)
 
   assert(f != NULL);
 
+#if defined(HAVE_PTHREAD)
+  if (f->wq != NULL)
+    _file_wqueue_flush(f);
+#endif
+
+#if defined(HAVE_ZLIB)
+  if (f->zf != NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error obtaining position in file \"%s\":\n\n  %s"),
+              f->name, _("not supported for gzip-compressed output"));
+#endif
+
+#if defined(CS_FILE_HAVE_MMAP)
+  if (f->map != NULL)
+    return f->map_offset;
+#endif
+
   if (f->sh != NULL) {
 
     /* For 32-bit systems, large file support may be necessary */
@@ -1044,6 +1964,21 @@ _file_write_block_s(cs_file_t  *f,
     cs_lnum_t *count = NULL;
     void  *write_buf = NULL;
 
+#if defined(HAVE_PTHREAD)
+
+    /* When a dedicated I/O thread is requested, rank 0 queues received
+       blocks for background writing, so other ranks are released as soon
+       as their data has been received rather than once it has reached the
+       filesystem; errors are then checked when the queue is flushed. */
+
+    if (_use_io_thread && f->rank == 0 && f->wq == NULL) {
+      if (f->sh == NULL)
+        _file_open(f);
+      _file_wqueue_start(f);
+    }
+
+#endif
+
     _serializer_init(&s,
                      size,
                      global_num_start,
@@ -1278,13 +2213,47 @@ _mpi_file_ensure_isopen(cs_file_t *f)
     else if (f->mode == CS_FILE_MODE_READ)
       amode = MPI_MODE_RDONLY;
 
-    retval = MPI_File_open(MPI_COMM_SELF, f->name, amode, f->info, &(f->fh));
-    if (retval != MPI_SUCCESS)
-      _mpi_io_error_message(f->name, retval);
+    retval = MPI_File_open(MPI_COMM_SELF, f->name, amode, f->info, &(f->fh));
+    if (retval != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, retval);
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Complete a pending asynchronous write, if present.
+ *
+ * This must be called before any file operation which could conflict with
+ * the staged data or its destination region, and before closing the file.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_file_write_complete(cs_file_t  *f)
+{
+#if defined(HAVE_MPI_IO_NONBLOCKING_COLL)
+
+  if (f->awrite_pending) {
+
+    MPI_Status status;
+    int errcode = MPI_Wait(&(f->awrite_request), &status);
+
+    if (errcode != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, errcode);
+
+    f->awrite_pending = false;
 
   }
 
-  return retval;
+#else
+
+  CS_UNUSED(f);
+
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -1309,6 +2278,12 @@ _mpi_file_close(cs_file_t  *f)
 
   /* Close file */
 
+  _mpi_file_write_complete(f);
+
+  if (f->awrite_buf != NULL)
+    BFT_FREE(f->awrite_buf);
+  f->awrite_buf_size = 0;
+
   retval = MPI_File_close(&(f->fh));
 
   if (retval != MPI_SUCCESS)
@@ -1356,6 +2331,8 @@ _mpi_file_read_block_noncoll(cs_file_t  *f,
   if (f->fh == MPI_FILE_NULL)
     return retval;
 
+  _mpi_file_write_complete(f);
+
   if (gcount > 0) {
 
     int errcode, count;
@@ -1424,6 +2401,8 @@ _mpi_file_read_block_eo(cs_file_t  *f,
   if (f->fh == MPI_FILE_NULL)
     return retval;
 
+  _mpi_file_write_complete(f);
+
   if (gcount > INT_MAX) {
     MPI_Type_contiguous(size, MPI_BYTE, &ent_type);
     MPI_Type_commit(&ent_type);
@@ -1476,6 +2455,8 @@ _mpi_file_read_block_ip(cs_file_t  *f,
   if (f->fh == MPI_FILE_NULL)
     return retval;
 
+  _mpi_file_write_complete(f);
+
   if (gcount > INT_MAX || gdisp > INT_MAX) {
     MPI_Type_contiguous(size, MPI_BYTE, &ent_type);
     MPI_Type_commit(&ent_type);
@@ -1552,6 +2533,8 @@ _mpi_file_write_block_noncoll(cs_file_t  *f,
   if (f->fh == MPI_FILE_NULL)
     return retval;
 
+  _mpi_file_write_complete(f);
+
   if (gcount > 0) {
 
     int errcode, count;
@@ -1629,6 +2612,46 @@ _mpi_file_write_block_eo(cs_file_t  *f,
   else
     count = gcount;
 
+#if defined(HAVE_MPI_IO_NONBLOCKING_COLL)
+
+  /* In asynchronous mode, stage the data in a second buffer and issue a
+     nonblocking collective write, so that draining to the filesystem may
+     overlap with the computation and redistribution of the next sections;
+     the previous write is completed before the staging buffer is reused. */
+
+  if (f->async_write) {
+
+    _mpi_file_write_complete(f);
+
+    if (gcount > f->awrite_buf_size) {
+      f->awrite_buf_size = gcount;
+      BFT_REALLOC(f->awrite_buf, f->awrite_buf_size, unsigned char);
+    }
+    memcpy(f->awrite_buf, buf, gcount);
+
+    errcode = MPI_File_iwrite_at_all(f->fh, disp, f->awrite_buf, count,
+                                     ent_type, &(f->awrite_request));
+    f->awrite_pending = true;
+
+    if (errcode != MPI_SUCCESS)
+      _mpi_io_error_message(f->name, errcode);
+
+    /* As the write is not completed yet, errors will only be detected
+       at completion time (and are fatal), so assume full success here. */
+
+    if (ent_type != MPI_BYTE) {
+      MPI_Type_free(&ent_type);
+      retval = count;
+    }
+    else
+      retval = count / size;
+
+    return retval;
+
+  }
+
+#endif /* defined(HAVE_MPI_IO_NONBLOCKING_COLL) */
+
   errcode = MPI_File_write_at_all(f->fh, disp, buf, count, ent_type, &status);
 
   if (errcode != MPI_SUCCESS)
@@ -1801,16 +2824,48 @@ cs_file_open(const char        *name,
   int errcode = 0;
   cs_file_t * f = NULL;
 
+#if defined(HAVE_PTHREAD)
+
+  /* If a deferred (background) close of a file with the same name is
+     still pending, wait for it, so the file is not accessed while the
+     I/O thread may still be writing to it. */
+
+  if (_wqueue_closes != NULL)
+    _file_wqueue_close_wait(name);
+
+#endif
+
   BFT_MALLOC(f, 1, cs_file_t);
 
   f->sh = NULL;
 
+#if defined(HAVE_ZLIB)
+  f->zf = NULL;
+#endif
+
+  f->stage_sh = NULL;
+  f->stage_name = NULL;
+
+#if defined(CS_FILE_HAVE_MMAP)
+  f->map = NULL;
+  f->map_size = 0;
+  f->map_offset = 0;
+#endif
+
+#if defined(HAVE_PTHREAD)
+  f->wq = NULL;
+#endif
+
 #if defined(HAVE_MPI)
   f->comm = MPI_COMM_NULL;
   f->io_comm = MPI_COMM_NULL;
 #if defined(HAVE_MPI_IO)
   f->fh = MPI_FILE_NULL;
   f->info = hints;
+  f->async_write = false;
+  f->awrite_pending = false;
+  f->awrite_buf_size = 0;
+  f->awrite_buf = NULL;
 #endif
 #endif
 
@@ -1860,6 +2915,36 @@ cs_file_open(const char        *name,
               name);
 #endif
 
+  /* When a staging directory is defined, files opened for writing with
+     MPI-IO are staged on (node-)local storage instead, and drained to
+     their final destination in the background once closed; only the
+     (empty) destination file is created here, so draining may write to
+     it directly. */
+
+  if (   _staging_dir != NULL
+      && f->mode == CS_FILE_MODE_WRITE
+      && f->method > CS_FILE_STDIO_PARALLEL) {
+
+    if (f->rank == 0) {
+      FILE *dsh;
+      cs_file_remove(f->name);
+      dsh = fopen(f->name, "wb");
+      if (dsh == NULL || fclose(dsh) != 0)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error opening file \"%s\":\n\n  %s"),
+                  f->name, strerror(errno));
+    }
+
+    f->stage_name = _staging_file_name(f->name, f->rank);
+    f->stage_sh = fopen(f->stage_name, "wb");
+    if (f->stage_sh == NULL)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file \"%s\":\n\n  %s"),
+                f->stage_name, strerror(errno));
+
+    return f;
+  }
+
   /* Open file. In case of failure, destroy the allocated structure;
      this is only useful with a non-default error handler,
      as the program is terminated by default */
@@ -1867,6 +2952,24 @@ cs_file_open(const char        *name,
   if (f->method <= CS_FILE_STDIO_PARALLEL && f->rank == 0)
     errcode = _file_open(f);
 
+#if defined(CS_FILE_HAVE_MMAP)
+  if (   _use_mmap
+      && f->mode == CS_FILE_MODE_READ
+      && errcode == 0
+      && f->sh != NULL)
+    _file_map(f);
+#endif
+
+#if defined(HAVE_PTHREAD)
+  if (   _use_io_thread
+      && f->method == CS_FILE_STDIO_SERIAL
+      && f->mode != CS_FILE_MODE_READ
+      && f->rank == 0
+      && errcode == 0
+      && f->sh != NULL)
+    _file_wqueue_start(f);
+#endif
+
 #if defined(HAVE_MPI_IO)
   if (f->method == CS_FILE_MPI_INDEPENDENT) {
     f->io_comm = MPI_COMM_SELF;
@@ -1988,14 +3091,28 @@ cs_file_free(cs_file_t  *f)
 {
   cs_file_t  *_f = f;
 
+  if (_f->stage_sh != NULL)
+    _staging_drain_start(_f);
+
+#if defined(HAVE_PTHREAD)
+  if (_f->wq != NULL)
+    _file_wqueue_detach(_f); /* also defers the stream's close */
+#endif
+
   if (_f->sh != NULL)
     _file_close(_f);
 
+#if defined(HAVE_ZLIB)
+  else if (_f->zf != NULL)
+    _file_close(_f);
+#endif
+
 #if defined(HAVE_MPI_IO)
   else if (_f->fh != MPI_FILE_NULL)
     _mpi_file_close(_f);
 #endif
 
+  BFT_FREE(_f->stage_name);
   BFT_FREE(_f->name);
   BFT_FREE(_f);
 
@@ -2089,6 +3206,253 @@ cs_file_set_swap_endian(cs_file_t  *f,
   f->swap_endian = swap;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set a file's asynchronous (double-buffered) write behavior.
+ *
+ * When this mode is active, block writes stage their data in a second
+ * buffer and are issued as nonblocking collective MPI-IO writes, which
+ * drain to the filesystem while the caller continues; a pending write is
+ * completed before the next write (or any other operation on the file),
+ * and at the latest when the file is closed. Errors are thus only
+ * detected at completion time (and are fatal, as with blocking writes).
+ *
+ * This mode requires collective MPI-IO with explicit offsets and an
+ * MPI 3.1 library, and only applies to files opened in write or append
+ * mode; the request is ignored (writes remain blocking) otherwise.
+ *
+ * \param[in, out]  f      cs_file_t descriptor
+ * \param[in]       async  1 to enable asynchronous writes, 0 to disable
+ *                         (completing any pending write)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write(cs_file_t  *f,
+                        int         async)
+{
+  assert(f != NULL);
+
+#if defined(HAVE_MPI_IO_NONBLOCKING_COLL)
+
+  if (   f->method == CS_FILE_MPI_COLLECTIVE
+      && _mpi_io_positionning == CS_FILE_MPI_EXPLICIT_OFFSETS
+      && f->mode != CS_FILE_MODE_READ) {
+
+    if (f->async_write && !async)
+      _mpi_file_write_complete(f);
+
+    f->async_write = async;
+
+  }
+
+#else
+
+  CS_UNUSED(async);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define whether serialized (rank 0) block writes are handled by a
+ *        dedicated I/O thread.
+ *
+ * When this mode is active and POSIX threads are available, the rank
+ * aggregating serialized writes queues the data and a background thread
+ * performs the actual filesystem writes, so compute ranks are released
+ * as soon as their data has been received rather than once it has
+ * reached the filesystem. Closing such a file is also deferred to the
+ * I/O thread, so output may continue draining while computation
+ * proceeds; completion may be forced with cs_file_staging_wait(), and
+ * is automatic before a file with the same name is re-opened and at
+ * normal program exit. Errors are detected at those points (and are
+ * fatal, as with direct writes).
+ *
+ * This only affects files opened for writing with CS_FILE_STDIO_SERIAL
+ * while the mode is active; MPI-IO accessed files may use
+ * cs_file_set_async_write() and cs_file_set_staging_dir() for a
+ * similar effect.
+ *
+ * \param[in]  use_thread  1 to use a background I/O thread for serialized
+ *                         writes, 0 for direct writes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_io_thread(int  use_thread)
+{
+#if defined(HAVE_PTHREAD)
+  _use_io_thread = use_thread;
+#else
+  CS_UNUSED(use_thread);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if serialized block writes use a dedicated I/O thread.
+ *
+ * \return 1 if a background I/O thread is used for serialized writes,
+ *         0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_file_get_io_thread(void)
+{
+#if defined(HAVE_PTHREAD)
+  return _use_io_thread;
+#else
+  return 0;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set use of memory-mapping for files opened in read mode.
+ *
+ * When enabled, files read with serial (rank 0) standard IO (such as
+ * mesh and restart input) are mapped read-only into memory at open, and
+ * reads are served directly from the mapping rather than through
+ * buffered read system calls. This is mainly of interest when input
+ * resides on node-local or DAX storage, or is already present in the
+ * page cache, in which case reads reduce to memory copies.
+ *
+ * If a file cannot be mapped, buffered reads are used as usual; on
+ * systems without memory-mapping support, this setting is ignored.
+ *
+ * \param[in]  use_mmap  1 to map files opened for reading, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_mmap(int  use_mmap)
+{
+#if defined(CS_FILE_HAVE_MMAP)
+  _use_mmap = use_mmap;
+#else
+  CS_UNUSED(use_mmap);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if memory-mapping is used for files opened in read mode.
+ *
+ * \return 1 if files opened for reading are memory-mapped, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_file_get_mmap(void)
+{
+#if defined(CS_FILE_HAVE_MMAP)
+  return _use_mmap;
+#else
+  return 0;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Switch a file opened for writing to gzip-compressed output.
+ *
+ * The destination file is renamed by appending a ".gz" suffix, and all
+ * subsequent data is written to it as a gzip stream, so it may be
+ * decompressed with standard tools; the uncompressed file created at
+ * open is removed. When a background I/O thread is associated with the
+ * file, compression runs on that thread.
+ *
+ * This must be called before any data is written, and is only available
+ * for files opened in write mode with serial (rank 0) standard IO when
+ * built with zlib; in other cases, the file is left unchanged and
+ * output remains uncompressed. Seeking is not possible on compressed
+ * output.
+ *
+ * \param[in, out]  f      cs_file_t descriptor
+ * \param[in]       level  compression level (1 to 9), or -1 for the
+ *                         zlib default
+ *
+ * \return 0 if compression is active for this file, 1 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_file_set_gzip(cs_file_t  *f,
+                 int         level)
+{
+  int retval = 1;
+
+  assert(f != NULL);
+
+#if defined(HAVE_ZLIB)
+
+  if (   f->method != CS_FILE_STDIO_SERIAL
+      || f->mode != CS_FILE_MODE_WRITE
+      || f->offset != 0)
+    return retval;
+
+  if (f->rank == 0) {
+
+    char mode_str[8];
+
+    if (f->zf != NULL)  /* already active */
+      return 0;
+
+    if (f->sh == NULL)
+      return retval;
+
+#if defined(HAVE_PTHREAD)
+    if (f->wq != NULL)
+      _file_wqueue_flush(f);  /* no data should be queued yet */
+#endif
+
+    /* Replace the file created at open by its compressed counterpart */
+
+    if (fclose(f->sh) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error closing file \"%s\":\n\n"
+                  "  %s"), f->name, strerror(errno));
+    f->sh = NULL;
+    cs_file_remove(f->name);
+
+    BFT_REALLOC(f->name, strlen(f->name) + strlen(".gz") + 1, char);
+    strcat(f->name, ".gz");
+
+    if (level > 0 && level <= 9)
+      snprintf(mode_str, 8, "wb%d", level);
+    else
+      strcpy(mode_str, "wb");
+
+    f->zf = gzopen(f->name, mode_str);
+    if (f->zf == NULL)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error opening file \"%s\":\n\n"
+                  "  %s"), f->name, strerror(errno));
+
+#if defined(HAVE_PTHREAD)
+    if (f->wq != NULL) {
+      pthread_mutex_lock(&f->wq->lock);
+      f->wq->sh = NULL;
+      f->wq->zf = f->zf;
+      pthread_mutex_unlock(&f->wq->lock);
+    }
+#endif
+
+  }
+
+  retval = 0;
+
+#else
+
+  CS_UNUSED(level);
+
+#endif /* defined(HAVE_ZLIB) */
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read global data from a file, distributing it to all processes
@@ -2230,7 +3594,13 @@ cs_file_write_global(cs_file_t   *f,
     _buf = copybuf;
   }
 
-  if (f->rank == 0 && f->sh != NULL && f->method <= CS_FILE_STDIO_PARALLEL) {
+  if (f->stage_sh != NULL) {
+    if (f->rank == 0)
+      _staging_write(f, _buf, size*ni, f->offset);
+  }
+
+  else if (   f->rank == 0 && f->sh != NULL
+           && f->method <= CS_FILE_STDIO_PARALLEL) {
     if (f->method == CS_FILE_STDIO_PARALLEL) {
       if (_file_seek(f, f->offset, CS_FILE_SEEK_SET) != 0)
         retval = 0;
@@ -2571,6 +3941,27 @@ cs_file_write_block_buffer(cs_file_t  *f,
                  size,
                  (_global_num_end - _global_num_start));
 
+  /* If staging to local storage is active, intercept the write */
+
+  if (f->stage_sh != NULL) {
+
+    size_t n_bytes = (_global_num_end - _global_num_start)*size;
+    cs_file_off_t disp = f->offset + ((_global_num_start - 1) * size);
+
+    retval = _staging_write(f, buf, n_bytes, disp) / size;
+
+    /* Update offset */
+
+#if defined(HAVE_MPI)
+    if (f->n_ranks > 1)
+      MPI_Bcast(&global_num_end_last, 1, CS_MPI_GNUM, f->n_ranks-1, f->comm);
+#endif
+
+    f->offset += ((global_num_end_last - 1) * size * stride);
+
+    return retval;
+  }
+
   /* Write to file using chosen method */
 
   switch(f->method) {
@@ -2658,6 +4049,11 @@ cs_file_seek(cs_file_t       *f,
 {
   int retval = 0;
 
+#if defined(HAVE_MPI_IO)
+  if (f->fh != MPI_FILE_NULL)
+    _mpi_file_write_complete(f);
+#endif
+
   /* Always update f->offset, regardless of mode */
 
   switch(whence) {
@@ -3258,6 +4654,88 @@ cs_file_set_mpi_io_positionning(cs_file_mpi_positionning_t  positionning)
   _mpi_io_positionning = positionning;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a node-local staging (burst-buffer) directory for output.
+ *
+ * When a staging directory is set, files opened for writing with MPI-IO
+ * methods write their data to one local file per rank in this directory
+ * instead, and that data is drained to the destination file on the
+ * parallel filesystem by a helper thread once the file is closed, so the
+ * solver does not wait on that filesystem.
+ *
+ * The directory should be on fast node-local storage (such as NVMe); it
+ * is created if needed on each rank. Background drains are completed by
+ * \ref cs_file_staging_wait, which should be called before re-opening or
+ * reading the matching files, and is called at normal program exit.
+ *
+ * This function should be called by all ranks, with NULL or an empty
+ * string reverting to direct writes.
+ *
+ * \param[in]  dir  staging directory path, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_staging_dir(const char  *dir)
+{
+  /* Complete pending drains before changing the setting */
+
+  cs_file_staging_wait();
+
+  BFT_FREE(_staging_dir);
+
+  if (dir != NULL) {
+    if (strlen(dir) > 0) {
+      BFT_MALLOC(_staging_dir, strlen(dir) + 1, char);
+      strcpy(_staging_dir, dir);
+      if (cs_file_mkdir_default(dir) != 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("The %s directory cannot be created"), dir);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for all background drains of staged files and all deferred
+ *        file closes to complete.
+ *
+ * This function must be called by all ranks before a staged file is
+ * re-opened, read, or overwritten, and before normal program exit; it is
+ * a no-op when no background output is pending.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_staging_wait(void)
+{
+#if defined(HAVE_PTHREAD)
+
+  _file_wqueue_close_wait(NULL);
+
+  while (_staging_drains != NULL) {
+    _staging_drain_t *d = _staging_drains;
+    _staging_drains = d->next;
+    pthread_join(d->thread, NULL);
+    BFT_FREE(d->name);
+    BFT_FREE(d->stage_name);
+    BFT_FREE(d);
+  }
+
+#endif
+
+#if defined(HAVE_MPI)
+
+  /* Ensure no rank truncates or reads a file which another rank's
+     drain may still have been writing */
+
+  if (_staging_dir != NULL && cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print information on default options for file access.
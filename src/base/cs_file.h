@@ -270,6 +270,118 @@ void
 cs_file_set_swap_endian(cs_file_t  *f,
                         int         swap);
 
+/*----------------------------------------------------------------------------
+ * Set a file's asynchronous (double-buffered) write behavior.
+ *
+ * In this mode, block writes stage their data in a second buffer and are
+ * issued as nonblocking collective MPI-IO writes, which drain to the
+ * filesystem while the caller continues; a pending write is completed
+ * before the next operation on the file, and at the latest at close.
+ *
+ * This mode requires collective MPI-IO with explicit offsets and an
+ * MPI 3.1 library, and only applies to files opened in write or append
+ * mode; the request is ignored (writes remain blocking) otherwise.
+ *
+ * parameters:
+ *   f     <-> cs_file_t descriptor
+ *   async <-- 1 to enable asynchronous writes, 0 to disable
+ *             (completing any pending write)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write(cs_file_t  *f,
+                        int         async);
+
+/*----------------------------------------------------------------------------
+ * Define whether serialized (rank 0) block writes are handled by a
+ * dedicated I/O thread.
+ *
+ * When this mode is active and POSIX threads are available, the rank
+ * aggregating serialized writes queues the data and a background thread
+ * performs the actual filesystem writes, so compute ranks are released
+ * as soon as their data has been received rather than once it has
+ * reached the filesystem. Closing such a file is also deferred to the
+ * I/O thread; completion may be forced with cs_file_staging_wait(), and
+ * is automatic before a file with the same name is re-opened and at
+ * normal program exit.
+ *
+ * This only affects files opened for writing with CS_FILE_STDIO_SERIAL
+ * while the mode is active.
+ *
+ * parameters:
+ *   use_thread <-- 1 to use a background I/O thread for serialized
+ *                  writes, 0 for direct writes
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_io_thread(int  use_thread);
+
+/*----------------------------------------------------------------------------
+ * Indicate if serialized block writes use a dedicated I/O thread.
+ *
+ * returns:
+ *   1 if a background I/O thread is used for serialized writes,
+ *   0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+cs_file_get_io_thread(void);
+
+/*----------------------------------------------------------------------------
+ * Switch a file opened for writing to gzip-compressed output.
+ *
+ * The destination file is renamed by appending a ".gz" suffix, and all
+ * subsequent data is written to it as a gzip stream, so it may be
+ * decompressed with standard tools. When a background I/O thread is
+ * associated with the file, compression runs on that thread.
+ *
+ * This must be called before any data is written, and is only available
+ * for files opened in write mode with serial (rank 0) standard IO when
+ * built with zlib; in other cases, the file is left unchanged and output
+ * remains uncompressed. Seeking is not possible on compressed output.
+ *
+ * parameters:
+ *   f     <-> cs_file_t descriptor
+ *   level <-- compression level (1 to 9), or -1 for the zlib default
+ *
+ * returns:
+ *   0 if compression is active for this file, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+cs_file_set_gzip(cs_file_t  *f,
+                 int         level);
+
+/*----------------------------------------------------------------------------
+ * Set use of memory-mapping for files opened in read mode.
+ *
+ * When enabled, files read with serial (rank 0) standard IO (such as
+ * mesh and restart input) are mapped read-only into memory at open, and
+ * reads are served directly from the mapping rather than through
+ * buffered read system calls. This is mainly of interest when input
+ * resides on node-local or DAX storage, or is already present in the
+ * page cache, in which case reads reduce to memory copies.
+ *
+ * If a file cannot be mapped, buffered reads are used as usual; on
+ * systems without memory-mapping support, this setting is ignored.
+ *
+ * parameters:
+ *   use_mmap <-- 1 to map files opened for reading, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_mmap(int  use_mmap);
+
+/*----------------------------------------------------------------------------
+ * Indicate if memory-mapping is used for files opened in read mode.
+ *
+ * returns:
+ *   1 if files opened for reading are memory-mapped, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+cs_file_get_mmap(void);
+
 /*----------------------------------------------------------------------------
  * Read global data from a file, distributing it to all processes
  * associated with that file.
@@ -643,6 +755,42 @@ cs_file_get_mpi_io_positionning(void);
 void
 cs_file_set_mpi_io_positionning(cs_file_mpi_positionning_t  positionning);
 
+/*----------------------------------------------------------------------------
+ * Define a node-local staging (burst-buffer) directory for output.
+ *
+ * When a staging directory is set, files opened for writing with MPI-IO
+ * methods write their data to one local file per rank in this directory
+ * instead, and that data is drained to the destination file on the
+ * parallel filesystem by a helper thread once the file is closed, so the
+ * solver does not wait on that filesystem.
+ *
+ * The directory should be on fast node-local storage (such as NVMe); it
+ * is created if needed on each rank. Background drains are completed by
+ * cs_file_staging_wait(), which should be called before re-opening or
+ * reading the matching files, and is called at normal program exit.
+ *
+ * This function should be called by all ranks, with NULL or an empty
+ * string reverting to direct writes.
+ *
+ * parameters:
+ *   dir <-- staging directory path, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_staging_dir(const char  *dir);
+
+/*----------------------------------------------------------------------------
+ * Wait for all background drains of staged files and all deferred file
+ * closes to complete.
+ *
+ * This function must be called by all ranks before a staged file is
+ * re-opened, read, or overwritten, and before normal program exit; it is
+ * a no-op when no background output is pending.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_staging_wait(void);
+
 /*----------------------------------------------------------------------------
  * Print information on default options for file access.
  *----------------------------------------------------------------------------*/
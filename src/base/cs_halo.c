@@ -44,6 +44,7 @@
 
 #include "cs_base.h"
 #include "cs_order.h"
+#include "cs_parall.h"
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
@@ -95,6 +96,37 @@ static cs_real_t  *_cs_glob_halo_rot_backup = NULL;
 
 static int _cs_glob_halo_use_barrier = false;
 
+/* State of a split (start/finish) halo exchange; as the associated send
+   buffer and request arrays are shared, only one such exchange may be
+   active at a given time. */
+
+#if defined(HAVE_MPI)
+static int _cs_glob_halo_split_request_count = -1;
+#endif
+
+/* Should halo exchanges use neighborhood collectives on a distributed
+   graph communicator rather than point-to-point send/receive loops ?
+   (only effective with MPI-3 or above) */
+
+static int _cs_glob_halo_use_neighbor_coll = false;
+
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+/* Cache of distributed graph communicators matching halo neighbor
+   lists; communicators are built lazily upon first use of a halo,
+   and freed when the matching halo is destroyed. */
+
+#define CS_HALO_N_GRAPH_COMMS  4
+
+static int  _cs_glob_halo_n_graph_comms = 0;
+
+static struct {
+  const cs_halo_t  *halo;
+  MPI_Comm          comm;
+} _cs_glob_halo_graph_comm[CS_HALO_N_GRAPH_COMMS];
+
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -311,6 +343,211 @@ _zero_rotation_values(const cs_halo_t  *halo,
   }
 }
 
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Return the distributed graph communicator matching a halo's neighbor
+ * list, building and caching it upon first use.
+ *
+ * As communicator creation is a collective operation, this function must
+ * be called simultaneously on all ranks, which is the case when it is
+ * called through the (collective) halo exchange functions.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *
+ * returns:
+ *   distributed graph communicator associated with the halo
+ *----------------------------------------------------------------------------*/
+
+static MPI_Comm
+_halo_graph_comm(const cs_halo_t  *halo)
+{
+  int i;
+
+  for (i = 0; i < _cs_glob_halo_n_graph_comms; i++) {
+    if (_cs_glob_halo_graph_comm[i].halo == halo)
+      return _cs_glob_halo_graph_comm[i].comm;
+  }
+
+  /* Make room if the cache is full, dropping the oldest entry */
+
+  if (_cs_glob_halo_n_graph_comms >= CS_HALO_N_GRAPH_COMMS) {
+    MPI_Comm_free(&(_cs_glob_halo_graph_comm[0].comm));
+    for (i = 1; i < _cs_glob_halo_n_graph_comms; i++)
+      _cs_glob_halo_graph_comm[i-1] = _cs_glob_halo_graph_comm[i];
+    _cs_glob_halo_n_graph_comms -= 1;
+  }
+
+  /* Build communicator, excluding the local rank from the neighbor
+     list (local periodicity values are copied directly) */
+
+  int n_nbrs = 0;
+  int *nbrs;
+  MPI_Comm comm;
+
+  BFT_MALLOC(nbrs, CS_MAX(halo->n_c_domains, 1), int);
+
+  for (i = 0; i < halo->n_c_domains; i++) {
+    if (halo->c_domain_rank[i] != cs_glob_rank_id)
+      nbrs[n_nbrs++] = halo->c_domain_rank[i];
+  }
+
+  MPI_Dist_graph_create_adjacent(cs_glob_mpi_comm,
+                                 n_nbrs, nbrs, MPI_UNWEIGHTED,
+                                 n_nbrs, nbrs, MPI_UNWEIGHTED,
+                                 MPI_INFO_NULL,
+                                 0, /* no reordering */
+                                 &comm);
+
+  BFT_FREE(nbrs);
+
+  i = _cs_glob_halo_n_graph_comms;
+  _cs_glob_halo_graph_comm[i].halo = halo;
+  _cs_glob_halo_graph_comm[i].comm = comm;
+  _cs_glob_halo_n_graph_comms += 1;
+
+  return comm;
+}
+
+/*----------------------------------------------------------------------------
+ * Free the cached distributed graph communicator associated with a halo,
+ * if present.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_graph_comm_release(const cs_halo_t  *halo)
+{
+  int i, j;
+
+  for (i = 0; i < _cs_glob_halo_n_graph_comms; i++) {
+    if (_cs_glob_halo_graph_comm[i].halo == halo) {
+      MPI_Comm_free(&(_cs_glob_halo_graph_comm[i].comm));
+      for (j = i+1; j < _cs_glob_halo_n_graph_comms; j++)
+        _cs_glob_halo_graph_comm[j-1] = _cs_glob_halo_graph_comm[j];
+      _cs_glob_halo_n_graph_comms -= 1;
+      break;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update array of strided variable (floating-point) values using a
+ * neighborhood collective on the halo's distributed graph communicator.
+ *
+ * The exchange pattern is declared to the MPI library once per halo
+ * through the graph communicator, which may optimize message scheduling
+ * for large neighbor counts, and replaces the per-neighbor request
+ * setup of the send/receive loops by a single call.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+static void
+_halo_sync_var_strided_coll(const cs_halo_t  *halo,
+                            cs_halo_type_t    sync_mode,
+                            cs_real_t         var[],
+                            int               stride)
+{
+  cs_lnum_t i, j, start, length;
+  int rank_id;
+
+  int n_nbrs = 0;
+  int local_rank_id = -1;
+  int *counts = NULL;
+  cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+  const int local_rank = cs_glob_rank_id;
+
+  MPI_Comm comm = _halo_graph_comm(halo);
+
+  /* Counts and displacements in the order of the communicator's
+     neighbor list (local rank excluded) */
+
+  BFT_MALLOC(counts, halo->n_c_domains*4, int);
+
+  int *send_counts = counts;
+  int *send_displs = counts + halo->n_c_domains;
+  int *recv_counts = counts + halo->n_c_domains*2;
+  int *recv_displs = counts + halo->n_c_domains*3;
+
+  for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] != local_rank) {
+
+      start = halo->send_index[2*rank_id];
+      length =   halo->send_index[2*rank_id + end_shift]
+               - halo->send_index[2*rank_id];
+
+      send_counts[n_nbrs] = length*stride;
+      send_displs[n_nbrs] = start*stride;
+      recv_counts[n_nbrs] = (  halo->index[2*rank_id + end_shift]
+                             - halo->index[2*rank_id])*stride;
+      recv_displs[n_nbrs] = halo->index[2*rank_id]*stride;
+      n_nbrs += 1;
+
+      /* Assemble send buffer segment for this rank */
+
+      if (stride == 3) { /* Unroll loop for this case */
+        for (i = 0; i < length; i++) {
+          build_buffer[(start + i)*3]
+            = var[(halo->send_list[start + i])*3];
+          build_buffer[(start + i)*3 + 1]
+            = var[(halo->send_list[start + i])*3 + 1];
+          build_buffer[(start + i)*3 + 2]
+            = var[(halo->send_list[start + i])*3 + 2];
+        }
+      }
+      else {
+        for (i = 0; i < length; i++) {
+          for (j = 0; j < stride; j++)
+            build_buffer[(start + i)*stride + j]
+              = var[(halo->send_list[start + i])*stride + j];
+        }
+      }
+
+    }
+    else
+      local_rank_id = rank_id;
+
+  }
+
+  MPI_Neighbor_alltoallv(build_buffer, send_counts, send_displs, CS_MPI_REAL,
+                         var + halo->n_local_elts*stride,
+                         recv_counts, recv_displs, CS_MPI_REAL,
+                         comm);
+
+  BFT_FREE(counts);
+
+  /* Copy local values in case of periodicity */
+
+  if (halo->n_transforms > 0 && local_rank_id > -1) {
+
+    cs_real_t *recv_var
+      = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+
+    start = halo->send_index[2*local_rank_id];
+    length =   halo->send_index[2*local_rank_id + end_shift]
+             - halo->send_index[2*local_rank_id];
+
+    for (i = 0; i < length; i++) {
+      for (j = 0; j < stride; j++)
+        recv_var[i*stride + j]
+          = var[(halo->send_list[start + i])*stride + j];
+    }
+
+  }
+}
+
+#endif /* defined(HAVE_MPI) && (MPI_VERSION >= 3) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -767,6 +1004,10 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   cs_halo_t  *_halo = *halo;
 
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  _halo_graph_comm_release(_halo);
+#endif
+
   BFT_FREE(_halo->c_domain_rank);
 
   BFT_FREE(_halo->send_perio_lst);
@@ -1405,6 +1646,13 @@ cs_halo_sync_var(const cs_halo_t  *halo,
   int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
   const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
 
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_neighbor_coll) {
+    _halo_sync_var_strided_coll(halo, sync_mode, var, 1);
+    return;
+  }
+#endif
+
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
@@ -1512,108 +1760,76 @@ cs_halo_sync_var(const cs_halo_t  *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Update array of strided variable (floating-point) values in case
- * of parallelism or periodicity.
+ * Start update of an array of variable (floating-point) halo values
+ * in case of parallelism or periodicity.
  *
- * This function aims at copying main values from local elements
- * (id between 1 and n_local_elements) to ghost elements on distant ranks
- * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ * This function posts the sends and receives of cs_halo_sync_var() but does
+ * not wait for their completion, so that computation not depending on halo
+ * values may overlap with the exchange. It must be matched by a call to
+ * cs_halo_sync_var_finish() with the same arguments before the ghost values
+ * of var are accessed; as the associated communication buffers are shared,
+ * only one such exchange may be active at a given time.
  *
  * parameters:
  *   halo      <-- pointer to halo structure
  *   sync_mode <-- synchronization mode (standard or extended)
  *   var       <-> pointer to variable value array
- *   stride    <-- number of (interlaced) values by entity
  *----------------------------------------------------------------------------*/
 
 void
-cs_halo_sync_var_strided(const cs_halo_t  *halo,
-                         cs_halo_type_t    sync_mode,
-                         cs_real_t         var[],
-                         int               stride)
+cs_halo_sync_var_start(const cs_halo_t  *halo,
+                       cs_halo_type_t    sync_mode,
+                       cs_real_t         var[])
 {
-  cs_lnum_t i, j, start, length;
-
-  cs_lnum_t end_shift = 0;
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-
-  if (stride > _cs_glob_halo_max_stride)
-    _cs_glob_halo_max_stride = stride;
-  cs_halo_update_buffers(halo);
-
-  if (sync_mode == CS_HALO_STANDARD)
-    end_shift = 1;
-
-  else if (sync_mode == CS_HALO_EXTENDED)
-    end_shift = 2;
-
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
 
+    cs_lnum_t i, start, length;
+
     int rank_id;
     int request_count = 0;
     cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
-    cs_real_t *buffer = NULL;
+    const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
     const int local_rank = cs_glob_rank_id;
 
+    if (_cs_glob_halo_split_request_count > -1)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: a previous halo exchange has not been finished.",
+                __func__);
+
     /* Receive data from distant ranks */
 
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-      length = (  halo->index[2*rank_id + end_shift]
-                - halo->index[2*rank_id]) * stride;
+      start = halo->index[2*rank_id];
+      length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        if (length > 0) {
-
-          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
-
-          MPI_Irecv(buffer,
+        if (length > 0)
+          MPI_Irecv(var + halo->n_local_elts + start,
                     length,
                     CS_MPI_REAL,
                     halo->c_domain_rank[rank_id],
                     halo->c_domain_rank[rank_id],
                     cs_glob_mpi_comm,
                     &(_cs_glob_halo_request[request_count++]));
-
-        }
       }
-      else
-        local_rank_id = rank_id;
 
     }
 
-    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
-       scheduling led to slightly higher cost here, and even static scheduling
-       might lead to false sharing for small halos. */
+    /* Assemble buffers for halo exchange */
 
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
         start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
+        length =   halo->send_index[2*rank_id + end_shift]
+                 - halo->send_index[2*rank_id];
 
-        if (stride == 3) { /* Unroll loop for this case */
-          for (i = 0; i < length; i++) {
-            build_buffer[(start + i)*3]
-              = var[(halo->send_list[start + i])*3];
-            build_buffer[(start + i)*3 + 1]
-              = var[(halo->send_list[start + i])*3 + 1];
-            build_buffer[(start + i)*3 + 2]
-              = var[(halo->send_list[start + i])*3 + 2];
-          }
-        }
-        else {
-          for (i = 0; i < length; i++) {
-            for (j = 0; j < stride; j++)
-              build_buffer[(start + i)*stride + j]
-                = var[(halo->send_list[start + i])*stride + j];
-          }
-        }
+        for (i = 0; i < length; i++)
+          build_buffer[start + i] = var[halo->send_list[start + i]];
 
       }
 
@@ -1628,17 +1844,15 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
-      /* If this is not the local rank */
-
       if (halo->c_domain_rank[rank_id] != local_rank) {
 
         start = halo->send_index[2*rank_id];
-        length = (  halo->send_index[2*rank_id + end_shift]
-                  - halo->send_index[2*rank_id]);
+        length =   halo->send_index[2*rank_id + end_shift]
+                 - halo->send_index[2*rank_id];
 
         if (length > 0)
-          MPI_Isend(build_buffer + start*stride,
-                    length*stride,
+          MPI_Isend(build_buffer + start,
+                    length,
                     CS_MPI_REAL,
                     halo->c_domain_rank[rank_id],
                     local_rank,
@@ -1649,9 +1863,73 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 
     }
 
+    _cs_glob_halo_split_request_count = request_count;
+
+    cs_parall_progress_thread_begin(  (  halo->n_send_elts[end_shift-1]
+                                       + halo->n_elts[end_shift-1])
+                                    * sizeof(cs_real_t));
+  }
+
+#else
+
+  CS_UNUSED(halo);
+  CS_UNUSED(sync_mode);
+  CS_UNUSED(var);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Finish update of an array of variable (floating-point) halo values
+ * started by cs_halo_sync_var_start().
+ *
+ * This function waits for the completion of the posted exchanges and
+ * handles copy of local values in case of periodicity; upon return, the
+ * ghost values of var are up to date, as after a call to cs_halo_sync_var().
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_finish(const cs_halo_t  *halo,
+                        cs_halo_type_t    sync_mode,
+                        cs_real_t         var[])
+{
+  cs_lnum_t i, start, length;
+
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int rank_id;
+    const int local_rank = cs_glob_rank_id;
+
+    if (_cs_glob_halo_split_request_count < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: no halo exchange has been started.",
+                __func__);
+
+    cs_parall_progress_thread_end();
+
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+    MPI_Waitall(_cs_glob_halo_split_request_count,
+                _cs_glob_halo_request,
+                _cs_glob_halo_status);
+
+    _cs_glob_halo_split_request_count = -1;
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      if (halo->c_domain_rank[rank_id] == local_rank)
+        local_rank_id = rank_id;
+    }
+
   }
 
 #endif /* defined(HAVE_MPI) */
@@ -1663,26 +1941,14 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
     if (local_rank_id > -1) {
 
       cs_real_t *recv_var
-        = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+        = var + halo->n_local_elts + halo->index[2*local_rank_id];
 
       start = halo->send_index[2*local_rank_id];
       length =   halo->send_index[2*local_rank_id + end_shift]
                - halo->send_index[2*local_rank_id];
 
-      if (stride == 3) { /* Unroll loop for this case */
-        for (i = 0; i < length; i++) {
-          recv_var[i*3]     = var[(halo->send_list[start + i])*3];
-          recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
-          recv_var[i*3 + 2] = var[(halo->send_list[start + i])*3 + 2];
-        }
-      }
-      else {
-        for (i = 0; i < length; i++) {
-          for (j = 0; j < stride; j++)
-            recv_var[i*stride + j]
-              = var[(halo->send_list[start + i])*stride + j];
-        }
-      }
+      for (i = 0; i < length; i++)
+        recv_var[i] = var[halo->send_list[start + i]];
 
     }
 
@@ -1690,15 +1956,623 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Update array of vector variable component (floating-point) halo values
- * in case of parallelism or periodicity.
+ * Update array of strided variable (floating-point) values in case
+ * of parallelism or periodicity.
  *
  * This function aims at copying main values from local elements
  * (id between 1 and n_local_elements) to ghost elements on distant ranks
  * (id between n_local_elements + 1 to n_local_elements_with_halo).
  *
- * If rotation_op is equal to CS_HALO_ROTATION_IGNORE, halo values
- * corresponding to periodicity with rotation are left unchanged from their
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided(const cs_halo_t  *halo,
+                         cs_halo_type_t    sync_mode,
+                         cs_real_t         var[],
+                         int               stride)
+{
+  cs_lnum_t i, j, start, length;
+
+  cs_lnum_t end_shift = 0;
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+  if (stride > _cs_glob_halo_max_stride)
+    _cs_glob_halo_max_stride = stride;
+  cs_halo_update_buffers(halo);
+
+  if (sync_mode == CS_HALO_STANDARD)
+    end_shift = 1;
+
+  else if (sync_mode == CS_HALO_EXTENDED)
+    end_shift = 2;
+
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  if (cs_glob_n_ranks > 1 && _cs_glob_halo_use_neighbor_coll) {
+    _halo_sync_var_strided_coll(halo, sync_mode, var, stride);
+    return;
+  }
+#endif
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int rank_id;
+    int request_count = 0;
+    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    cs_real_t *buffer = NULL;
+    const int local_rank = cs_glob_rank_id;
+
+    /* Receive data from distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      length = (  halo->index[2*rank_id + end_shift]
+                - halo->index[2*rank_id]) * stride;
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        if (length > 0) {
+
+          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
+
+          MPI_Irecv(buffer,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+        }
+      }
+      else
+        local_rank_id = rank_id;
+
+    }
+
+    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
+       scheduling led to slightly higher cost here, and even static scheduling
+       might lead to false sharing for small halos. */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
+
+        if (stride == 3) { /* Unroll loop for this case */
+          for (i = 0; i < length; i++) {
+            build_buffer[(start + i)*3]
+              = var[(halo->send_list[start + i])*3];
+            build_buffer[(start + i)*3 + 1]
+              = var[(halo->send_list[start + i])*3 + 1];
+            build_buffer[(start + i)*3 + 2]
+              = var[(halo->send_list[start + i])*3 + 2];
+          }
+        }
+        else {
+          for (i = 0; i < length; i++) {
+            for (j = 0; j < stride; j++)
+              build_buffer[(start + i)*stride + j]
+                = var[(halo->send_list[start + i])*stride + j];
+          }
+        }
+
+      }
+
+    }
+
+    /* We wait for posting all receives (often recommended) */
+
+    if (_cs_glob_halo_use_barrier)
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Send data to distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      /* If this is not the local rank */
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
+
+        if (length > 0)
+          MPI_Isend(build_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+      }
+
+    }
+
+    /* Wait for all exchanges */
+
+    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity */
+
+  if (halo->n_transforms > 0) {
+
+    if (local_rank_id > -1) {
+
+      cs_real_t *recv_var
+        = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+
+      start = halo->send_index[2*local_rank_id];
+      length =   halo->send_index[2*local_rank_id + end_shift]
+               - halo->send_index[2*local_rank_id];
+
+      if (stride == 3) { /* Unroll loop for this case */
+        for (i = 0; i < length; i++) {
+          recv_var[i*3]     = var[(halo->send_list[start + i])*3];
+          recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
+          recv_var[i*3 + 2] = var[(halo->send_list[start + i])*3 + 2];
+        }
+      }
+      else {
+        for (i = 0; i < length; i++) {
+          for (j = 0; j < stride; j++)
+            recv_var[i*stride + j]
+              = var[(halo->send_list[start + i])*stride + j];
+        }
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update several arrays of variable (floating-point) values in case
+ * of parallelism or periodicity, using a single message per neighbor.
+ *
+ * The values of all variables bound for a given neighboring rank are
+ * packed into a single send buffer and exchanged in one message, so the
+ * per-message latency is paid once for the group rather than once per
+ * variable; this is mostly useful when several scalar variables must be
+ * synchronized at the same point of an algorithm.
+ *
+ * As with cs_halo_sync_var(), values rotated by periodicity transforms
+ * are not handled here, and must be updated separately.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   n_vars    <-- number of variables
+ *   var       <-> array of pointers to variable value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_pack(const cs_halo_t   *halo,
+                  cs_halo_type_t     sync_mode,
+                  int                n_vars,
+                  cs_real_t  *const  var[])
+{
+  cs_lnum_t i, start, length;
+  int v;
+
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+  if (n_vars < 1)
+    return;
+
+  if (n_vars > _cs_glob_halo_max_stride)
+    _cs_glob_halo_max_stride = n_vars;
+  cs_halo_update_buffers(halo);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int rank_id;
+    int request_count = 0;
+    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    cs_real_t *recv_buffer = NULL;
+    const int local_rank = cs_glob_rank_id;
+
+    /* As the ghost zones of the different variables are not contiguous,
+       distant values are received in a packed buffer, laid out as the
+       send buffer: per neighboring rank, values of variable 0, then
+       those of variable 1, ... */
+
+    BFT_MALLOC(recv_buffer,
+               (size_t)(halo->n_elts[CS_HALO_EXTENDED])*n_vars,
+               cs_real_t);
+
+    /* Receive data from distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      start = halo->index[2*rank_id];
+      length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+        if (length > 0)
+          MPI_Irecv(recv_buffer + start*n_vars,
+                    length*n_vars,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+      }
+      else
+        local_rank_id = rank_id;
+
+    }
+
+    /* Assemble buffers for halo exchange; avoid threading for now, as dynamic
+       scheduling led to slightly higher cost here, and even static scheduling
+       might lead to false sharing for small halos. */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length =   halo->send_index[2*rank_id + end_shift]
+                 - halo->send_index[2*rank_id];
+
+        for (v = 0; v < n_vars; v++) {
+          const cs_real_t *_var = var[v];
+          cs_real_t *_buffer = build_buffer + start*n_vars + v*length;
+          for (i = 0; i < length; i++)
+            _buffer[i] = _var[halo->send_list[start + i]];
+        }
+
+      }
+
+    }
+
+    /* We wait for posting all receives (often recommended) */
+
+    if (_cs_glob_halo_use_barrier)
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Send data to distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length =   halo->send_index[2*rank_id + end_shift]
+                 - halo->send_index[2*rank_id];
+
+        if (length > 0)
+          MPI_Isend(build_buffer + start*n_vars,
+                    length*n_vars,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+      }
+
+    }
+
+    /* Wait for all exchanges */
+
+    MPI_Waitall(request_count, _cs_glob_halo_request, _cs_glob_halo_status);
+
+    /* Scatter received values to the ghost zones of each variable */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->index[2*rank_id];
+        length = halo->index[2*rank_id + end_shift] - halo->index[2*rank_id];
+
+        for (v = 0; v < n_vars; v++) {
+          const cs_real_t *_buffer = recv_buffer + start*n_vars + v*length;
+          cs_real_t *recv_var = var[v] + halo->n_local_elts + start;
+          for (i = 0; i < length; i++)
+            recv_var[i] = _buffer[i];
+        }
+
+      }
+
+    }
+
+    BFT_FREE(recv_buffer);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity */
+
+  if (halo->n_transforms > 0) {
+
+    if (local_rank_id > -1) {
+
+      start = halo->send_index[2*local_rank_id];
+      length =   halo->send_index[2*local_rank_id + end_shift]
+               - halo->send_index[2*local_rank_id];
+
+      for (v = 0; v < n_vars; v++) {
+
+        cs_real_t *recv_var
+          = var[v] + halo->n_local_elts + halo->index[2*local_rank_id];
+
+        for (i = 0; i < length; i++)
+          recv_var[i] = var[v][halo->send_list[start + i]];
+
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Start update of an array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function posts the sends and receives of cs_halo_sync_var_strided()
+ * but does not wait for their completion, so that computation not depending
+ * on halo values may overlap with the exchange. It must be matched by a call
+ * to cs_halo_sync_var_strided_finish() with the same arguments before the
+ * ghost values of var are accessed; as the associated communication buffers
+ * are shared, only one such exchange may be active at a given time.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided_start(const cs_halo_t  *halo,
+                               cs_halo_type_t    sync_mode,
+                               cs_real_t         var[],
+                               int               stride)
+{
+  if (stride > _cs_glob_halo_max_stride)
+    _cs_glob_halo_max_stride = stride;
+  cs_halo_update_buffers(halo);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_lnum_t i, j, start, length;
+
+    int rank_id;
+    int request_count = 0;
+    cs_real_t *build_buffer = (cs_real_t *)_cs_glob_halo_send_buffer;
+    cs_real_t *buffer = NULL;
+    const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+    const int local_rank = cs_glob_rank_id;
+
+    if (_cs_glob_halo_split_request_count > -1)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: a previous halo exchange has not been finished.",
+                __func__);
+
+    /* Receive data from distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      length = (  halo->index[2*rank_id + end_shift]
+                - halo->index[2*rank_id]) * stride;
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        if (length > 0) {
+
+          buffer = var + (halo->n_local_elts + halo->index[2*rank_id])*stride;
+
+          MPI_Irecv(buffer,
+                    length,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    halo->c_domain_rank[rank_id],
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+        }
+      }
+
+    }
+
+    /* Assemble buffers for halo exchange */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
+
+        if (stride == 3) { /* Unroll loop for this case */
+          for (i = 0; i < length; i++) {
+            build_buffer[(start + i)*3]
+              = var[(halo->send_list[start + i])*3];
+            build_buffer[(start + i)*3 + 1]
+              = var[(halo->send_list[start + i])*3 + 1];
+            build_buffer[(start + i)*3 + 2]
+              = var[(halo->send_list[start + i])*3 + 2];
+          }
+        }
+        else {
+          for (i = 0; i < length; i++) {
+            for (j = 0; j < stride; j++)
+              build_buffer[(start + i)*stride + j]
+                = var[(halo->send_list[start + i])*stride + j];
+          }
+        }
+
+      }
+
+    }
+
+    /* We wait for posting all receives (often recommended) */
+
+    if (_cs_glob_halo_use_barrier)
+      MPI_Barrier(cs_glob_mpi_comm);
+
+    /* Send data to distant ranks */
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        start = halo->send_index[2*rank_id];
+        length = (  halo->send_index[2*rank_id + end_shift]
+                  - halo->send_index[2*rank_id]);
+
+        if (length > 0)
+          MPI_Isend(build_buffer + start*stride,
+                    length*stride,
+                    CS_MPI_REAL,
+                    halo->c_domain_rank[rank_id],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    &(_cs_glob_halo_request[request_count++]));
+
+      }
+
+    }
+
+    _cs_glob_halo_split_request_count = request_count;
+
+    cs_parall_progress_thread_begin(  (  halo->n_send_elts[end_shift-1]
+                                       + halo->n_elts[end_shift-1])
+                                    * stride * sizeof(cs_real_t));
+  }
+
+#else
+
+  CS_UNUSED(sync_mode);
+  CS_UNUSED(var);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Finish update of an array of strided variable (floating-point) halo values
+ * started by cs_halo_sync_var_strided_start().
+ *
+ * This function waits for the completion of the posted exchanges and
+ * handles copy of local values in case of periodicity; upon return, the
+ * ghost values of var are up to date, as after a call to
+ * cs_halo_sync_var_strided().
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided_finish(const cs_halo_t  *halo,
+                                cs_halo_type_t    sync_mode,
+                                cs_real_t         var[],
+                                int               stride)
+{
+  cs_lnum_t i, j, start, length;
+
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_STANDARD) ? 1 : 2;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    int rank_id;
+    const int local_rank = cs_glob_rank_id;
+
+    if (_cs_glob_halo_split_request_count < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: no halo exchange has been started.",
+                __func__);
+
+    cs_parall_progress_thread_end();
+
+    /* Wait for all exchanges */
+
+    MPI_Waitall(_cs_glob_halo_split_request_count,
+                _cs_glob_halo_request,
+                _cs_glob_halo_status);
+
+    _cs_glob_halo_split_request_count = -1;
+
+    for (rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+      if (halo->c_domain_rank[rank_id] == local_rank)
+        local_rank_id = rank_id;
+    }
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Copy local values in case of periodicity */
+
+  if (halo->n_transforms > 0) {
+
+    if (local_rank_id > -1) {
+
+      cs_real_t *recv_var
+        = var + (halo->n_local_elts + halo->index[2*local_rank_id])*stride;
+
+      start = halo->send_index[2*local_rank_id];
+      length =   halo->send_index[2*local_rank_id + end_shift]
+               - halo->send_index[2*local_rank_id];
+
+      if (stride == 3) { /* Unroll loop for this case */
+        for (i = 0; i < length; i++) {
+          recv_var[i*3]     = var[(halo->send_list[start + i])*3];
+          recv_var[i*3 + 1] = var[(halo->send_list[start + i])*3 + 1];
+          recv_var[i*3 + 2] = var[(halo->send_list[start + i])*3 + 2];
+        }
+      }
+      else {
+        for (i = 0; i < length; i++) {
+          for (j = 0; j < stride; j++)
+            recv_var[i*stride + j]
+              = var[(halo->send_list[start + i])*stride + j];
+        }
+      }
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update array of vector variable component (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function aims at copying main values from local elements
+ * (id between 1 and n_local_elements) to ghost elements on distant ranks
+ * (id between n_local_elements + 1 to n_local_elements_with_halo).
+ *
+ * If rotation_op is equal to CS_HALO_ROTATION_IGNORE, halo values
+ * corresponding to periodicity with rotation are left unchanged from their
  * previous values.
  *
  * If rotation_op is set to CS_HALO_ROTATION_ZERO, halo values
@@ -1812,6 +2686,40 @@ cs_halo_set_use_barrier(bool use_barrier)
   _cs_glob_halo_use_barrier = use_barrier;
 }
 
+/*----------------------------------------------------------------------------
+ * Return neighborhood collectives usage flag.
+ *
+ * returns:
+ *   true if neighborhood collectives on a distributed graph communicator
+ *   are used for halo exchanges, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_neighbor_coll(void)
+{
+  return _cs_glob_halo_use_neighbor_coll;
+}
+
+/*----------------------------------------------------------------------------
+ * Set neighborhood collectives usage flag.
+ *
+ * When this option is enabled, halo exchanges use MPI_Neighbor_alltoallv
+ * on a distributed graph communicator built (once per halo) from the
+ * halo's neighbor list, instead of per-neighbor send/receive loops; the
+ * MPI library may thus optimize message scheduling for the pattern.
+ * This option requires MPI-3 or above, and is ignored otherwise.
+ *
+ * parameters:
+ *   use_neighbor_coll <-- true if neighborhood collectives should be used
+ *                         for halo exchanges, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_neighbor_coll(bool use_neighbor_coll)
+{
+  _cs_glob_halo_use_neighbor_coll = use_neighbor_coll;
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
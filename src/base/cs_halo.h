@@ -351,6 +351,47 @@ cs_halo_sync_var(const cs_halo_t  *halo,
                  cs_halo_type_t    sync_mode,
                  cs_real_t         var[]);
 
+/*----------------------------------------------------------------------------
+ * Start update of an array of variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function posts the sends and receives of cs_halo_sync_var() but does
+ * not wait for their completion, so that computation not depending on halo
+ * values may overlap with the exchange. It must be matched by a call to
+ * cs_halo_sync_var_finish() with the same arguments before the ghost values
+ * of var are accessed; as the associated communication buffers are shared,
+ * only one such exchange may be active at a given time.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_start(const cs_halo_t  *halo,
+                       cs_halo_type_t    sync_mode,
+                       cs_real_t         var[]);
+
+/*----------------------------------------------------------------------------
+ * Finish update of an array of variable (floating-point) halo values
+ * started by cs_halo_sync_var_start().
+ *
+ * This function waits for the completion of the posted exchanges and
+ * handles copy of local values in case of periodicity; upon return, the
+ * ghost values of var are up to date, as after a call to cs_halo_sync_var().
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_finish(const cs_halo_t  *halo,
+                        cs_halo_type_t    sync_mode,
+                        cs_real_t         var[]);
+
 /*----------------------------------------------------------------------------
  * Update array of strided variable (floating-point) halo values in case
  * of parallelism or periodicity.
@@ -372,6 +413,78 @@ cs_halo_sync_var_strided(const cs_halo_t  *halo,
                          cs_real_t         var[],
                          int               stride);
 
+/*----------------------------------------------------------------------------
+ * Update several arrays of variable (floating-point) values in case
+ * of parallelism or periodicity, using a single message per neighbor.
+ *
+ * The values of all variables bound for a given neighboring rank are
+ * packed into a single send buffer and exchanged in one message, so the
+ * per-message latency is paid once for the group rather than once per
+ * variable; this is mostly useful when several scalar variables must be
+ * synchronized at the same point of an algorithm.
+ *
+ * As with cs_halo_sync_var(), values rotated by periodicity transforms
+ * are not handled here, and must be updated separately.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   n_vars    <-- number of variables
+ *   var       <-> array of pointers to variable value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_pack(const cs_halo_t   *halo,
+                  cs_halo_type_t     sync_mode,
+                  int                n_vars,
+                  cs_real_t  *const  var[]);
+
+/*----------------------------------------------------------------------------
+ * Start update of an array of strided variable (floating-point) halo values
+ * in case of parallelism or periodicity.
+ *
+ * This function posts the sends and receives of cs_halo_sync_var_strided()
+ * but does not wait for their completion, so that computation not depending
+ * on halo values may overlap with the exchange. It must be matched by a call
+ * to cs_halo_sync_var_strided_finish() with the same arguments before the
+ * ghost values of var are accessed; as the associated communication buffers
+ * are shared, only one such exchange may be active at a given time.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided_start(const cs_halo_t  *halo,
+                               cs_halo_type_t    sync_mode,
+                               cs_real_t         var[],
+                               int               stride);
+
+/*----------------------------------------------------------------------------
+ * Finish update of an array of strided variable (floating-point) halo values
+ * started by cs_halo_sync_var_strided_start().
+ *
+ * This function waits for the completion of the posted exchanges and
+ * handles copy of local values in case of periodicity; upon return, the
+ * ghost values of var are up to date, as after a call to
+ * cs_halo_sync_var_strided().
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   var       <-> pointer to variable value array
+ *   stride    <-- number of (interlaced) values by entity
+ *----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_var_strided_finish(const cs_halo_t  *halo,
+                                cs_halo_type_t    sync_mode,
+                                cs_real_t         var[],
+                                int               stride);
+
 /*----------------------------------------------------------------------------
  * Update array of vector variable component (floating-point) halo values
  * in case of parallelism or periodicity.
@@ -460,6 +573,34 @@ cs_halo_get_use_barrier(void);
 void
 cs_halo_set_use_barrier(bool use_barrier);
 
+/*----------------------------------------------------------------------------
+ * Return neighborhood collectives usage flag.
+ *
+ * returns:
+ *   true if neighborhood collectives on a distributed graph communicator
+ *   are used for halo exchanges, false otherwise
+ *---------------------------------------------------------------------------*/
+
+bool
+cs_halo_get_use_neighbor_coll(void);
+
+/*----------------------------------------------------------------------------
+ * Set neighborhood collectives usage flag.
+ *
+ * When this option is enabled, halo exchanges use MPI_Neighbor_alltoallv
+ * on a distributed graph communicator built (once per halo) from the
+ * halo's neighbor list, instead of per-neighbor send/receive loops; the
+ * MPI library may thus optimize message scheduling for the pattern.
+ * This option requires MPI-3 or above, and is ignored otherwise.
+ *
+ * parameters:
+ *   use_neighbor_coll <-- true if neighborhood collectives should be used
+ *                         for halo exchanges, false otherwise.
+ *---------------------------------------------------------------------------*/
+
+void
+cs_halo_set_use_neighbor_coll(bool use_neighbor_coll);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
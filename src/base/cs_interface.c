@@ -116,6 +116,67 @@ struct _cs_interface_set_t {
 #endif
 };
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Cache of interface set match results
+ *
+ * Interface set construction requires global communication to match
+ * elements across ranks, and is often repeated with identical inputs
+ * during mesh preprocessing (joining, periodicity, halo construction).
+ * Recently built sets are kept here, keyed by a hash of the creation
+ * inputs, so that a new request with the same inputs may be served by
+ * a local copy instead of a new global match.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  unsigned long long        input_hash;    /* Hash of creation inputs */
+  cs_lnum_t                 n_elts;        /* Number of elements of inputs */
+  const fvm_periodicity_t  *periodicity;   /* Associated periodicity */
+  MPI_Comm                  comm;          /* Associated communicator */
+
+  unsigned long long        age;           /* Insertion or last use date */
+
+  cs_interface_set_t       *ifs;           /* Cached interface set */
+
+} _ifs_cache_entry_t;
+
+#define CS_INTERFACE_CACHE_SIZE 4
+
+static _ifs_cache_entry_t  _ifs_cache[CS_INTERFACE_CACHE_SIZE];
+static int                 _ifs_cache_size = 0;
+static unsigned long long  _ifs_cache_date = 0;
+
+/*----------------------------------------------------------------------------
+ * Cache of persistent exchange state for cs_interface_set_sum
+ *
+ * Sums on a given interface set are usually repeated many times per
+ * time step with the same datatype and stride, so the associated
+ * buffers and persistent MPI requests are worth keeping between calls.
+ * The cache is invalidated when its interface set is renumbered or
+ * destroyed.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  const cs_interface_set_t  *ifs;          /* Associated interface set */
+  cs_datatype_t              datatype;     /* Exchanged datatype */
+  int                        stride;       /* Number of values per element */
+
+  unsigned char             *send_buf;     /* Persistent send buffer */
+  unsigned char             *recv_buf;     /* Persistent receive buffer */
+
+  int                        request_count;
+  MPI_Request               *request;      /* Persistent requests */
+
+} _sum_exchange_t;
+
+static _sum_exchange_t _sum_exchange = {NULL, CS_DATATYPE_NULL, 0,
+                                        NULL, NULL, 0, NULL};
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Local structure defining a temporary list of interfaces
  *----------------------------------------------------------------------------*/
@@ -208,6 +269,293 @@ _cs_interface_destroy(cs_interface_t  **itf)
   *itf = _itf;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Duplication of an interface.
+ *
+ * parameters:
+ *   itf <-- pointer to structure to duplicate
+ *
+ * returns:
+ *   pointer to new interface structure
+ *----------------------------------------------------------------------------*/
+
+static cs_interface_t *
+_cs_interface_dup(const cs_interface_t  *itf)
+{
+  cs_interface_t  *new_itf = _cs_interface_create();
+
+  new_itf->rank = itf->rank;
+  new_itf->size = itf->size;
+
+  new_itf->tr_index_size = itf->tr_index_size;
+
+  if (itf->tr_index != NULL) {
+    BFT_MALLOC(new_itf->tr_index, itf->tr_index_size, cs_lnum_t);
+    memcpy(new_itf->tr_index, itf->tr_index,
+           itf->tr_index_size*sizeof(cs_lnum_t));
+  }
+
+  if (itf->elt_id != NULL) {
+    BFT_MALLOC(new_itf->elt_id, itf->size, cs_lnum_t);
+    memcpy(new_itf->elt_id, itf->elt_id, itf->size*sizeof(cs_lnum_t));
+  }
+
+  if (itf->match_id != NULL) {
+    BFT_MALLOC(new_itf->match_id, itf->size, cs_lnum_t);
+    memcpy(new_itf->match_id, itf->match_id, itf->size*sizeof(cs_lnum_t));
+  }
+
+  if (itf->send_order != NULL) {
+    BFT_MALLOC(new_itf->send_order, itf->size, cs_lnum_t);
+    memcpy(new_itf->send_order, itf->send_order, itf->size*sizeof(cs_lnum_t));
+  }
+
+  return new_itf;
+}
+
+/*----------------------------------------------------------------------------
+ * Duplication of an interface set.
+ *
+ * parameters:
+ *   ifs <-- pointer to structure to duplicate
+ *
+ * returns:
+ *   pointer to new interface set structure
+ *----------------------------------------------------------------------------*/
+
+static cs_interface_set_t *
+_interface_set_dup(const cs_interface_set_t  *ifs)
+{
+  int i;
+  cs_interface_set_t  *new_ifs;
+
+  BFT_MALLOC(new_ifs, 1, cs_interface_set_t);
+
+  new_ifs->size = ifs->size;
+  new_ifs->periodicity = ifs->periodicity;
+  new_ifs->comm = ifs->comm;
+
+  BFT_MALLOC(new_ifs->interfaces, new_ifs->size, cs_interface_t *);
+
+  for (i = 0; i < ifs->size; i++)
+    new_ifs->interfaces[i] = _cs_interface_dup(ifs->interfaces[i]);
+
+  return new_ifs;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a hash of interface set creation inputs.
+ *
+ * The hash is based on local data only, so matching hashes on one rank
+ * do not imply matching hashes on another; callers must check for
+ * global agreement before reusing a cached match result.
+ *
+ * parameters:
+ *   n_elts             <-- number of local elements considered
+ *   global_num         <-- global number associated with each element
+ *   n_periodic_lists   <-- number of periodic lists (may be local)
+ *   periodicity_num    <-- periodicity number associated with each list
+ *   n_periodic_couples <-- number of periodic couples per list
+ *   periodic_couples   <-- periodic couples (using global numberings)
+ *
+ * returns:
+ *   hash of creation inputs
+ *----------------------------------------------------------------------------*/
+
+static unsigned long long
+_ifs_input_hash(cs_lnum_t                 n_elts,
+                const cs_gnum_t           global_num[],
+                int                       n_periodic_lists,
+                const int                 periodicity_num[],
+                const cs_lnum_t           n_periodic_couples[],
+                const cs_gnum_t    *const periodic_couples[])
+{
+  int i;
+  size_t j;
+
+  unsigned long long h = 0xcbf29ce484222325ULL;  /* FNV-1a basis and prime */
+  const unsigned long long p = 0x100000001b3ULL;
+
+  h = (h ^ (unsigned long long)n_elts) * p;
+  h = (h ^ (unsigned long long)n_periodic_lists) * p;
+
+  for (j = 0; j < (size_t)n_elts; j++)
+    h = (h ^ (unsigned long long)(global_num[j])) * p;
+
+  for (i = 0; i < n_periodic_lists; i++) {
+    h = (h ^ (unsigned long long)(periodicity_num[i])) * p;
+    h = (h ^ (unsigned long long)(n_periodic_couples[i])) * p;
+    for (j = 0; j < (size_t)(n_periodic_couples[i]*2); j++)
+      h = (h ^ (unsigned long long)(periodic_couples[i][j])) * p;
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Search the interface set cache for a given input signature.
+ *
+ * parameters:
+ *   input_hash  <-- hash of creation inputs
+ *   n_elts      <-- number of local elements considered
+ *   periodicity <-- periodicity information (NULL if none)
+ *   comm        <-- associated communicator
+ *
+ * returns:
+ *   matching cache entry id, or -1
+ *----------------------------------------------------------------------------*/
+
+static int
+_ifs_cache_lookup(unsigned long long        input_hash,
+                  cs_lnum_t                 n_elts,
+                  const fvm_periodicity_t  *periodicity,
+                  MPI_Comm                  comm)
+{
+  int i;
+
+  for (i = 0; i < _ifs_cache_size; i++) {
+    if (   _ifs_cache[i].input_hash == input_hash
+        && _ifs_cache[i].n_elts == n_elts
+        && _ifs_cache[i].periodicity == periodicity
+        && _ifs_cache[i].comm == comm)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Insert an interface set copy in the cache.
+ *
+ * The least recently used entry is evicted if the cache is full.
+ *
+ * parameters:
+ *   ifs         <-- interface set to cache (a copy is made)
+ *   input_hash  <-- hash of creation inputs
+ *   n_elts      <-- number of local elements considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_ifs_cache_insert(const cs_interface_set_t  *ifs,
+                  unsigned long long         input_hash,
+                  cs_lnum_t                  n_elts)
+{
+  int i = _ifs_cache_size;
+
+  if (i >= CS_INTERFACE_CACHE_SIZE) {
+    int j;
+    i = 0;
+    for (j = 1; j < _ifs_cache_size; j++) {
+      if (_ifs_cache[j].age < _ifs_cache[i].age)
+        i = j;
+    }
+    cs_interface_set_destroy(&(_ifs_cache[i].ifs));
+  }
+  else
+    _ifs_cache_size += 1;
+
+  _ifs_cache[i].input_hash = input_hash;
+  _ifs_cache[i].n_elts = n_elts;
+  _ifs_cache[i].periodicity = ifs->periodicity;
+  _ifs_cache[i].comm = ifs->comm;
+  _ifs_cache[i].age = _ifs_cache_date++;
+  _ifs_cache[i].ifs = _interface_set_dup(ifs);
+}
+
+/*----------------------------------------------------------------------------
+ * Free cached persistent exchange state.
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_exchange_free(void)
+{
+  int i;
+
+  if (_sum_exchange.ifs == NULL)
+    return;
+
+  for (i = 0; i < _sum_exchange.request_count; i++)
+    MPI_Request_free(&(_sum_exchange.request[i]));
+
+  BFT_FREE(_sum_exchange.request);
+  BFT_FREE(_sum_exchange.send_buf);
+  BFT_FREE(_sum_exchange.recv_buf);
+
+  _sum_exchange.ifs = NULL;
+  _sum_exchange.datatype = CS_DATATYPE_NULL;
+  _sum_exchange.stride = 0;
+  _sum_exchange.request_count = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Update cached persistent exchange state for a given interface set,
+ * datatype, and stride.
+ *
+ * parameters:
+ *   ifs      <-- pointer to interface set structure
+ *   datatype <-- type of data considered
+ *   stride   <-- number of values per entity (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_exchange_update(const cs_interface_set_t  *ifs,
+                     cs_datatype_t              datatype,
+                     int                        stride)
+{
+  int i, local_rank;
+  cs_lnum_t j;
+  int request_count = 0;
+  cs_lnum_t stride_size = cs_datatype_size[datatype]*stride;
+  MPI_Datatype mpi_type = cs_datatype_to_mpi[datatype];
+
+  if (   _sum_exchange.ifs == ifs
+      && _sum_exchange.datatype == datatype
+      && _sum_exchange.stride == stride)
+    return;
+
+  _sum_exchange_free();
+
+  MPI_Comm_rank(ifs->comm, &local_rank);
+
+  BFT_MALLOC(_sum_exchange.send_buf,
+             cs_interface_set_n_elts(ifs)*stride_size,
+             unsigned char);
+  BFT_MALLOC(_sum_exchange.recv_buf,
+             cs_interface_set_n_elts(ifs)*stride_size,
+             unsigned char);
+  BFT_MALLOC(_sum_exchange.request, ifs->size*2, MPI_Request);
+
+  for (i = 0, j = 0; i < ifs->size; i++) {
+    cs_interface_t *itf = ifs->interfaces[i];
+    if (itf->rank != local_rank) {
+      MPI_Recv_init(_sum_exchange.recv_buf + j*stride_size,
+                    itf->size*stride,
+                    mpi_type,
+                    itf->rank,
+                    itf->rank,
+                    ifs->comm,
+                    &(_sum_exchange.request[request_count++]));
+      MPI_Send_init(_sum_exchange.send_buf + j*stride_size,
+                    itf->size*stride,
+                    mpi_type,
+                    itf->rank,
+                    local_rank,
+                    ifs->comm,
+                    &(_sum_exchange.request[request_count++]));
+    }
+    j += itf->size;
+  }
+
+  _sum_exchange.ifs = ifs;
+  _sum_exchange.datatype = datatype;
+  _sum_exchange.stride = stride;
+  _sum_exchange.request_count = request_count;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Dump printout of an interface.
  *
@@ -3615,6 +3963,11 @@ cs_interface_set_create(cs_lnum_t                 n_elts,
 {
   cs_interface_set_t  *ifs;
 
+#if defined(HAVE_MPI)
+  bool cache_insert = false;
+  unsigned long long input_hash = 0;
+#endif
+
   /* Initial checks */
 
   if (   (cs_glob_n_ranks < 2)
@@ -3654,6 +4007,38 @@ cs_interface_set_create(cs_lnum_t                 n_elts,
 
     }
 
+    /* Check if an identical interface set was built recently; as cached
+       hashes are based on local data only, reuse further requires
+       agreement on a common cache entry across all ranks */
+
+    input_hash = _ifs_input_hash(n_elts,
+                                 global_num,
+                                 n_periodic_lists,
+                                 periodicity_num,
+                                 n_periodic_couples,
+                                 periodic_couples);
+
+    {
+      int cache_id = _ifs_cache_lookup(input_hash,
+                                       n_elts,
+                                       periodicity,
+                                       ifs->comm);
+      int agree[2] = {cache_id, -cache_id};
+
+      MPI_Allreduce(MPI_IN_PLACE, agree, 2, MPI_INT, MPI_MIN, ifs->comm);
+
+      if (agree[0] > -1 && agree[0] == -agree[1]) {
+        cs_interface_set_t *cached_ifs
+          = _interface_set_dup(_ifs_cache[agree[0]].ifs);
+        _ifs_cache[agree[0]].age = _ifs_cache_date++;
+        BFT_FREE(global_num);
+        BFT_FREE(ifs);
+        return cached_ifs;
+      }
+    }
+
+    cache_insert = true;
+
     /* Build interfaces */
 
     if (periodicity == NULL)
@@ -3696,6 +4081,11 @@ cs_interface_set_create(cs_lnum_t                 n_elts,
   _order_by_elt_id(ifs);
   _match_id_to_send_order(ifs);
 
+#if defined(HAVE_MPI)
+  if (cache_insert)
+    _ifs_cache_insert(ifs, input_hash, n_elts);
+#endif
+
   return ifs;
 }
 
@@ -3714,6 +4104,10 @@ cs_interface_set_destroy(cs_interface_set_t  **ifs)
   cs_interface_set_t  *itfs = *ifs;
 
   if (itfs != NULL) {
+#if defined(HAVE_MPI)
+    if (_sum_exchange.ifs == itfs)
+      _sum_exchange_free();
+#endif
     for (i = 0; i < itfs->size; i++) {
       _cs_interface_destroy(&(itfs->interfaces[i]));
     }
@@ -3839,6 +4233,11 @@ cs_interface_set_renumber(cs_interface_set_t  *ifs,
   assert(ifs != NULL);
   assert(old_to_new != NULL);
 
+#if defined(HAVE_MPI)
+  if (_sum_exchange.ifs == ifs)
+    _sum_exchange_free();
+#endif
+
   /* Compute new element and match ids */
 
   _set_renumber_update_ids(ifs, old_to_new);
@@ -4310,24 +4709,81 @@ cs_interface_set_sum(const cs_interface_set_t  *ifs,
   cs_lnum_t j, k, l;
   cs_lnum_t stride_size = cs_datatype_size[datatype]*stride;
   unsigned char *buf = NULL;
+  unsigned char *_buf = NULL;
 
-  BFT_MALLOC(buf, cs_interface_set_n_elts(ifs)*stride_size, unsigned char);
+#if defined(HAVE_MPI)
 
-  if (stride < 2 || interlace)
-    cs_interface_set_copy_array(ifs,
-                                datatype,
-                                stride,
-                                true, /* src_on_parent */
-                                var,
-                                buf);
+  int n_ranks = 1;
 
-  else
-    _interface_set_copy_array_ni(ifs,
-                                 datatype,
-                                 n_elts,
-                                 stride,
-                                 var,
-                                 buf);
+  if (ifs->comm != MPI_COMM_NULL)
+    MPI_Comm_size(ifs->comm, &n_ranks);
+
+  /* In the common (interlaced) parallel case, use persistent requests
+     and buffers, kept between the many sums usually done on a same
+     interface set with a same datatype and stride */
+
+  if ((stride < 2 || interlace) && n_ranks > 1) {
+
+    int local_rank;
+    const unsigned char *_src = var;
+
+    _sum_exchange_update(ifs, datatype, stride);
+
+    MPI_Comm_rank(ifs->comm, &local_rank);
+
+    for (i = 0, j = 0; i < ifs->size; i++) {
+
+      cs_interface_t *itf = ifs->interfaces[i];
+      unsigned char *p = _sum_exchange.send_buf + j*stride_size;
+
+      for (k = 0; k < itf->size; k++) {
+        cs_lnum_t send_id = itf->elt_id[itf->send_order[k]];
+        for (l = 0; l < stride_size; l++)
+          p[k*stride_size + l] = _src[send_id*stride_size + l];
+      }
+
+      if (itf->rank == local_rank)
+        memcpy(_sum_exchange.recv_buf + j*stride_size,
+               p,
+               itf->size*stride_size);
+
+      j += itf->size;
+
+    }
+
+    MPI_Startall(_sum_exchange.request_count, _sum_exchange.request);
+    MPI_Waitall(_sum_exchange.request_count, _sum_exchange.request,
+                MPI_STATUSES_IGNORE);
+
+    buf = _sum_exchange.recv_buf;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (buf == NULL) {
+
+    BFT_MALLOC(_buf, cs_interface_set_n_elts(ifs)*stride_size, unsigned char);
+
+    if (stride < 2 || interlace)
+      cs_interface_set_copy_array(ifs,
+                                  datatype,
+                                  stride,
+                                  true, /* src_on_parent */
+                                  var,
+                                  _buf);
+
+    else
+      _interface_set_copy_array_ni(ifs,
+                                   datatype,
+                                   n_elts,
+                                   stride,
+                                   var,
+                                   _buf);
+
+    buf = _buf;
+
+  }
 
   /* Now increment values */
 
@@ -4523,7 +4979,7 @@ cs_interface_set_sum(const cs_interface_set_t  *ifs,
               (int)datatype);
   }
 
-  BFT_FREE(buf);
+  BFT_FREE(_buf);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -5200,6 +5656,35 @@ cs_interface_set_free_match_ids(cs_interface_set_t  *ifs)
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free module-level caches.
+ *
+ * This frees cached interface set match results (kept to avoid repeating
+ * global matching communication on identical inputs) and persistent
+ * exchange state. It may be called when no more interface sets are
+ * expected to be built or used for some time, such as at the end of
+ * mesh preprocessing, and must be called before MPI is finalized.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_interface_finalize(void)
+{
+#if defined(HAVE_MPI)
+
+  int i;
+
+  for (i = 0; i < _ifs_cache_size; i++)
+    cs_interface_set_destroy(&(_ifs_cache[i].ifs));
+
+  _ifs_cache_size = 0;
+
+  _sum_exchange_free();
+
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump printout of an interface list.
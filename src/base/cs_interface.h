@@ -323,6 +323,19 @@ cs_interface_set_add_match_ids(cs_interface_set_t  *ifs);
 void
 cs_interface_set_free_match_ids(cs_interface_set_t  *ifs);
 
+/*----------------------------------------------------------------------------
+ * Free module-level caches.
+ *
+ * This frees cached interface set match results (kept to avoid repeating
+ * global matching communication on identical inputs) and persistent
+ * exchange state. It may be called when no more interface sets are
+ * expected to be built or used for some time, such as at the end of
+ * mesh preprocessing, and must be called before MPI is finalized.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_interface_finalize(void);
+
 /*----------------------------------------------------------------------------
  * Copy array from distant or matching interface elements to local elements.
  *
@@ -56,6 +56,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "fvm_convert_array.h"
+
 #include "cs_base.h"
 #include "cs_log.h"
 #include "cs_map.h"
@@ -680,6 +682,14 @@ _file_open(cs_io_t           *cs_io,
 
   cs_file_set_big_endian(cs_io->f);
 
+  /* For output (checkpoint, mesh save), stage block data and write it
+     asynchronously when possible, so draining to the filesystem overlaps
+     with the redistribution of the next sections; this is a no-op when
+     the access method or MPI library does not allow it. */
+
+  if (cs_io->mode == CS_IO_MODE_WRITE)
+    cs_file_set_async_write(cs_io->f, 1);
+
 #if defined(HAVE_MPI)
   cs_io->comm = comm;
 #endif
@@ -1251,27 +1261,24 @@ _cs_io_convert_read(void           *buffer,
     break;
 
   case CS_FLOAT:
-    {
-      cs_real_t *_dest = dest;
-      double * _buffer = buffer;
 
-      assert(buffer_type == CS_DOUBLE);
+    /* Floating-point conversion is delegated to the blocked, threaded
+       engine shared with the postprocessing output path. */
 
-      for (ii = 0; ii < n_elts; ii++)
-        _dest[ii] = _buffer[ii];
-    }
+    assert(buffer_type == CS_DOUBLE);
+
+    fvm_convert_array_contiguous((size_t)n_elts,
+                                 buffer_type, dest_type,
+                                 buffer, dest);
     break;
 
   case CS_DOUBLE:
-    {
-      cs_real_t *_dest = dest;
-      float * _buffer = buffer;
 
-      assert(buffer_type == CS_FLOAT);
+    assert(buffer_type == CS_FLOAT);
 
-      for (ii = 0; ii < n_elts; ii++)
-        _dest[ii] = _buffer[ii];
-    }
+    fvm_convert_array_contiguous((size_t)n_elts,
+                                 buffer_type, dest_type,
+                                 buffer, dest);
     break;
 
   default:
@@ -3026,6 +3033,122 @@ cs_io_write_block_buffer(const char     *sec_name,
                elt_type, elts);
 }
 
+/*----------------------------------------------------------------------------
+ * Start writing a section whose body will be output in one or more parts.
+ *
+ * This writes the section header and positions the file at the start of
+ * the section body; the body must then be provided by one or more calls
+ * to cs_io_write_block_part(), covering all of the section's values in
+ * ascending global order, before any other section is written.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_write_block_start(const char     *sec_name,
+                        cs_gnum_t       n_g_elts,
+                        size_t          location_id,
+                        size_t          index_id,
+                        size_t          n_location_vals,
+                        cs_datatype_t   elt_type,
+                        cs_io_t        *outp)
+{
+  size_t n_g_vals = n_g_elts;
+
+  if (n_location_vals > 1)
+    n_g_vals *= n_location_vals;
+
+  _write_header(sec_name,
+                n_g_vals,
+                location_id,
+                index_id,
+                n_location_vals,
+                elt_type,
+                NULL,
+                outp);
+
+  _write_padding(outp->body_align, outp);
+}
+
+/*----------------------------------------------------------------------------
+ * Write one part of a section started with cs_io_write_block_start().
+ *
+ * Each call is collective, and writes a contiguous part of the section
+ * body; parts must be provided in ascending global order. Within a part,
+ * each process should provide a (possibly empty) block of the data, with
+ * numbers relative to the start of that part, and we should have:
+ *   part_num_start at rank 0 = 1
+ *   part_num_start at rank i+1 = part_num_end at rank i.
+ *
+ * As with cs_io_write_block_buffer(), the input buffer contains temporary
+ * values, and may be modified (notably to convert from little-endian to
+ * big-endian or vice-versa if necessary).
+ *
+ * parameters:
+ *   part_num_start   <-- number of first part item (1 to n numbering)
+ *   part_num_end     <-- number of past-the end part item
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_write_block_part(cs_gnum_t       part_num_start,
+                       cs_gnum_t       part_num_end,
+                       size_t          n_location_vals,
+                       cs_datatype_t   elt_type,
+                       void           *elts,
+                       cs_io_t        *outp)
+{
+  double t_start = 0.;
+  size_t n_written = 0;
+  size_t n_vals = part_num_end - part_num_start;
+  size_t stride = 1;
+  cs_io_log_t  *log = NULL;
+
+  if (n_location_vals > 1) {
+    stride = n_location_vals;
+    n_vals *= n_location_vals;
+  }
+
+  if (outp->log_id > -1) {
+    log = _cs_io_log[outp->mode] + outp->log_id;
+    t_start = cs_timer_wtime();
+  }
+
+  n_written = cs_file_write_block_buffer(outp->f,
+                                         elts,
+                                         cs_datatype_size[elt_type],
+                                         stride,
+                                         part_num_start,
+                                         part_num_end);
+
+  if (n_vals != (cs_gnum_t)n_written)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error writing %llu bytes to file \"%s\"."),
+              (unsigned long long)n_vals, cs_file_get_name(outp->f));
+
+  if (log != NULL) {
+    double t_end = cs_timer_wtime();
+    log->wtimes[1] += t_end - t_start;
+    log->data_size[1] += n_written*cs_datatype_size[elt_type];
+  }
+
+  if (n_vals != 0 && outp->echo > CS_IO_ECHO_HEADERS)
+    _echo_data(outp->echo, n_vals,
+               (part_num_start-1)*stride + 1,
+               (part_num_end -1)*stride + 1,
+               elt_type, elts);
+}
+
 /*----------------------------------------------------------------------------
  * Skip a message.
  *
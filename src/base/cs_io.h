@@ -549,6 +549,64 @@ cs_io_write_block_buffer(const char     *sec_name,
                          void           *elts,
                          cs_io_t        *outp);
 
+/*----------------------------------------------------------------------------
+ * Start writing a section whose body will be output in one or more parts.
+ *
+ * This writes the section header and positions the file at the start of
+ * the section body; the body must then be provided by one or more calls
+ * to cs_io_write_block_part(), covering all of the section's values in
+ * ascending global order, before any other section is written.
+ *
+ * parameters:
+ *   section_name     <-- section name
+ *   n_g_elts         <-- number of global elements (locations)
+ *   location_id      <-- id of associated location, or 0
+ *   index_id         <-- id of associated index, or 0
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_write_block_start(const char     *sec_name,
+                        cs_gnum_t       n_g_elts,
+                        size_t          location_id,
+                        size_t          index_id,
+                        size_t          n_location_vals,
+                        cs_datatype_t   elt_type,
+                        cs_io_t        *outp);
+
+/*----------------------------------------------------------------------------
+ * Write one part of a section started with cs_io_write_block_start().
+ *
+ * Each call is collective, and writes a contiguous part of the section
+ * body; parts must be provided in ascending global order. Within a part,
+ * each process should provide a (possibly empty) block of the data, with
+ * numbers relative to the start of that part, and we should have:
+ *   part_num_start at rank 0 = 1
+ *   part_num_start at rank i+1 = part_num_end at rank i.
+ *
+ * As with cs_io_write_block_buffer(), the input buffer contains temporary
+ * values, and may be modified (notably to convert from little-endian to
+ * big-endian or vice-versa if necessary).
+ *
+ * parameters:
+ *   part_num_start   <-- number of first part item (1 to n numbering)
+ *   part_num_end     <-- number of past-the end part item
+ *   n_location_vals  <-- number of values per location
+ *   elt_type         <-- element type
+ *   elts             <-- pointer to element data
+ *   outp             <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_io_write_block_part(cs_gnum_t       part_num_start,
+                       cs_gnum_t       part_num_end,
+                       size_t          n_location_vals,
+                       cs_datatype_t   elt_type,
+                       void           *elts,
+                       cs_io_t        *outp);
+
 /*----------------------------------------------------------------------------
  * Skip a message.
  *
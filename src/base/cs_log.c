@@ -38,6 +38,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -77,6 +81,35 @@ static const char* _cs_log_name[] = {"",
                                      "performance.log"};
 int cs_glob_log_frequency = 1;
 
+/* Deferred logging: when active, records for the setup and performance
+   logs are staged in memory instead of being formatted straight to their
+   files, and written out in batches (by a background thread when POSIX
+   threads are available), so file I/O leaves the time step's critical
+   path. */
+
+static bool    _cs_log_deferred = false;
+
+static char   *_log_buf[] = {NULL, NULL, NULL};
+static size_t  _log_buf_size[] = {0, 0, 0};
+static size_t  _log_buf_max[] = {0, 0, 0};
+
+/* Staged data is handed to the writer in batches beyond this size */
+
+static const size_t _log_buf_flush_size = 65536;
+
+#if defined(HAVE_PTHREAD)
+
+/* Background writer thread state; the buffer being written is swapped
+   with the staging buffer, so staging may continue while writing */
+
+static bool       _log_writer_active = false;
+static pthread_t  _log_writer_thread;
+static char      *_log_writer_buf = NULL;
+static size_t     _log_writer_size = 0;
+static FILE      *_log_writer_file = NULL;
+
+#endif
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -89,6 +122,46 @@ cs_f_log_frequency_get_pointer(int     **ntlist);
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Close all log files.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * Background writer thread function: write the handed-over staged records.
+ *
+ * parameters:
+ *   arg <-- unused
+ *----------------------------------------------------------------------------*/
+
+static void *
+_log_writer(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  fwrite(_log_writer_buf, 1, _log_writer_size, _log_writer_file);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for the background writer thread and free its buffer.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_writer_join(void)
+{
+  if (_log_writer_active) {
+    pthread_join(_log_writer_thread, NULL);
+    _log_writer_active = false;
+    BFT_FREE(_log_writer_buf);
+    _log_writer_size = 0;
+  }
+}
+
+#endif /* defined(HAVE_PTHREAD) */
+
 /*----------------------------------------------------------------------------
  * Close all log files.
  *----------------------------------------------------------------------------*/
@@ -98,7 +171,20 @@ _close_log_files(void)
 {
   int i;
 
+#if defined(HAVE_PTHREAD)
+  _log_writer_join();
+#endif
+
   for (i = 0; i < CS_LOG_N_TYPES; i++) {
+    if (_log_buf_size[i] > 0) {
+      if (_cs_log[i] == NULL)
+        _cs_log[i] = fopen(_cs_log_name[i], "w");
+      if (_cs_log[i] != NULL)
+        fwrite(_log_buf[i], 1, _log_buf_size[i], _cs_log[i]);
+      _log_buf_size[i] = 0;
+    }
+    BFT_FREE(_log_buf[i]);
+    _log_buf_max[i] = 0;
     if (_cs_log[i] != NULL)
       fclose(_cs_log[i]);
   }
@@ -127,6 +213,113 @@ _open_log(cs_log_t log)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Write the staged records of a log file out.
+ *
+ * When a background write is allowed and POSIX threads are available, the
+ * staging buffer is handed over to the writer thread and replaced by a
+ * fresh one, so staging may continue while the records are written.
+ *
+ * parameters:
+ *   log          <-- log file type
+ *   allow_thread <-- allow handing the buffer to the writer thread
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_buf_write(cs_log_t  log,
+               bool      allow_thread)
+{
+#if defined(HAVE_PTHREAD)
+  _log_writer_join();
+#endif
+
+  if (_log_buf_size[log] == 0)
+    return;
+
+  _open_log(log);
+
+#if defined(HAVE_PTHREAD)
+
+  if (allow_thread) {
+
+    _log_writer_buf = _log_buf[log];
+    _log_writer_size = _log_buf_size[log];
+    _log_writer_file = _cs_log[log];
+
+    _log_buf[log] = NULL;
+    _log_buf_size[log] = 0;
+    _log_buf_max[log] = 0;
+
+    if (pthread_create(&_log_writer_thread, NULL, _log_writer, NULL) == 0)
+      _log_writer_active = true;
+    else {
+      fwrite(_log_writer_buf, 1, _log_writer_size, _log_writer_file);
+      BFT_FREE(_log_writer_buf);
+      _log_writer_size = 0;
+    }
+
+    return;
+
+  }
+
+#else
+
+  CS_UNUSED(allow_thread);
+
+#endif
+
+  fwrite(_log_buf[log], 1, _log_buf_size[log], _cs_log[log]);
+  _log_buf_size[log] = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Stage a log record in memory.
+ *
+ * The staged records are written out in batches once they exceed the
+ * flush size, and drained by cs_log_printf_flush and at exit.
+ *
+ * parameters:
+ *   log     <-- log file type
+ *   format  <-- format string, as printf() and family
+ *   arg_ptr <-- variable arguments list pointer
+ *
+ * returns:
+ *   number of characters staged, not counting the trailing '\0'
+ *----------------------------------------------------------------------------*/
+
+static int
+_log_buf_append(cs_log_t     log,
+                const char  *format,
+                va_list      arg_ptr)
+{
+  va_list arg_copy;
+
+  va_copy(arg_copy, arg_ptr);
+  int n = vsnprintf(NULL, 0, format, arg_copy);
+  va_end(arg_copy);
+
+  if (n < 1)
+    return n;
+
+  if (_log_buf_size[log] + (size_t)n + 1 > _log_buf_max[log]) {
+    size_t new_max = _log_buf_max[log]*2;
+    if (new_max < _log_buf_size[log] + (size_t)n + 1)
+      new_max = _log_buf_size[log] + (size_t)n + 1;
+    if (new_max < 4096)
+      new_max = 4096;
+    _log_buf_max[log] = new_max;
+    BFT_REALLOC(_log_buf[log], _log_buf_max[log], char);
+  }
+
+  vsnprintf(_log_buf[log] + _log_buf_size[log], n+1, format, arg_ptr);
+  _log_buf_size[log] += n;
+
+  if (_log_buf_size[log] > _log_buf_flush_size)
+    _log_buf_write(log, true);
+
+  return n;
+}
+
 /*----------------------------------------------------------------------------*
  * Pad a string so that its printable length is the required length.
  *
@@ -423,10 +616,17 @@ cs_log_vprintf(cs_log_t     log,
 
   if (log != CS_LOG_DEFAULT) {
 
-    if (_cs_log[log] == NULL && log != CS_LOG_DEFAULT)
-      _open_log(log);
+    if (_cs_log_deferred)
+      retval = _log_buf_append(log, format, arg_ptr);
+
+    else {
 
-    retval = vfprintf(_cs_log[log], format, arg_ptr);
+      if (_cs_log[log] == NULL)
+        _open_log(log);
+
+      retval = vfprintf(_cs_log[log], format, arg_ptr);
+
+    }
 
   }
 
@@ -472,14 +672,28 @@ cs_log_printf(cs_log_t     log,
 
   if (log != CS_LOG_DEFAULT) {
 
-    if (_cs_log[log] == NULL && log != CS_LOG_DEFAULT)
-      _open_log(log);
+    if (_cs_log_deferred) {
 
-    va_start(arg_ptr, format);
+      va_start(arg_ptr, format);
 
-    retval = vfprintf(_cs_log[log], format, arg_ptr);
+      retval = _log_buf_append(log, format, arg_ptr);
 
-    va_end(arg_ptr);
+      va_end(arg_ptr);
+
+    }
+
+    else {
+
+      if (_cs_log[log] == NULL)
+        _open_log(log);
+
+      va_start(arg_ptr, format);
+
+      retval = vfprintf(_cs_log[log], format, arg_ptr);
+
+      va_end(arg_ptr);
+
+    }
 
   }
 
@@ -522,12 +736,17 @@ cs_log_printf_flush(cs_log_t log)
   if (log < CS_LOG_N_TYPES) {
     if (log == CS_LOG_DEFAULT)
       retval = bft_printf_flush();
-    else if (_cs_log[log] != NULL)
-      retval = fflush(_cs_log[log]);
+    else {
+      _log_buf_write(log, false);
+      if (_cs_log[log] != NULL)
+        retval = fflush(_cs_log[log]);
+    }
   }
 
   else {
     for (i = 0; i < CS_LOG_N_TYPES; i++) {
+      if (i != CS_LOG_DEFAULT)
+        _log_buf_write((cs_log_t)i, false);
       if (_cs_log[i] != NULL)
         retval = fflush(_cs_log[i]);
       if (retval != 0)
@@ -539,6 +758,52 @@ cs_log_printf_flush(cs_log_t log)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate deferred logging.
+ *
+ * When active, records for the setup and performance logs are staged in
+ * memory instead of being formatted straight to their files, and written
+ * out in batches (by a background thread when POSIX threads are
+ * available), so per-time-step file output leaves the critical path.
+ * Staged records are drained by \ref cs_log_printf_flush and at exit;
+ * until then, the log files on disk lag behind the computation.
+ *
+ * \param[in]  deferred  true to activate deferred logging
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_log_set_deferred(bool  deferred)
+{
+  if (_cs_log_deferred && deferred == false)
+    cs_log_printf_flush(CS_LOG_N_TYPES);
+
+  _cs_log_deferred = deferred;
+
+  /* Ensure staged records are written at exit even if no log file
+     has been opened yet */
+
+  if (deferred && _cs_log_atexit_set == false) {
+    atexit(_close_log_files);
+    _cs_log_atexit_set = true;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if deferred logging is active.
+ *
+ * \return true if deferred logging is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_log_get_deferred(void)
+{
+  return _cs_log_deferred;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print a separator line in a log file
@@ -210,6 +210,33 @@ cs_log_printf(cs_log_t     log,
 int
 cs_log_printf_flush(cs_log_t log);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate deferred logging.
+ *
+ * When active, records for the setup and performance logs are staged in
+ * memory instead of being formatted straight to their files, and written
+ * out in batches (by a background thread when POSIX threads are
+ * available), so per-time-step file output leaves the critical path.
+ * Staged records are drained by cs_log_printf_flush and at exit; until
+ * then, the log files on disk lag behind the computation.
+ *
+ * parameters:
+ *   deferred <-- true to activate deferred logging
+ *----------------------------------------------------------------------------*/
+
+void
+cs_log_set_deferred(bool  deferred);
+
+/*----------------------------------------------------------------------------
+ * Indicate if deferred logging is active.
+ *
+ * returns:
+ *   true if deferred logging is active, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_log_get_deferred(void);
+
 /*----------------------------------------------------------------------------
  * Print a separator line in a log file
  *
@@ -65,6 +65,11 @@ BEGIN_C_DECLS
 
 #define CS_ALIGN_SIZE(s) (((s-1)/8+1)*8)
 
+/* Minimum size of auxiliary hash index (must be a power of 2);
+   the load factor is kept at 1/2 or less */
+
+#define CS_MAP_HASH_SIZE_MIN 64
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -84,6 +89,10 @@ struct _cs_map_name_to_id_t {
   char      **key;              /* Pointer to keys */
   int        *id;               /* Matching id */
   int        *reverse_id;       /* Reverse id mapping */
+
+  size_t      hash_size;        /* Number of hash index slots
+                                   (0 if index not built yet) */
+  int        *hash_id;          /* Id associated with each slot, or -1 */
 };
 
 /*============================================================================
@@ -94,6 +103,112 @@ struct _cs_map_name_to_id_t {
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute the hash index slot associated with a key.
+ *
+ * parameters:
+ *   key       <-- character string (key)
+ *   hash_size <-- number of hash slots (must be a power of 2)
+ *
+ * returns:
+ *   matching slot
+ *----------------------------------------------------------------------------*/
+
+static inline size_t
+_hash_slot(const char  *key,
+           size_t       hash_size)
+{
+  size_t h = 5381;
+
+  for (const char *s = key; *s != '\0'; s++)
+    h = h*33 + (size_t)(*s);
+
+  return h & (hash_size - 1);
+}
+
+/*----------------------------------------------------------------------------
+ * Insert an id in the hash index, using open adressing.
+ *
+ * parameters:
+ *   m   <-> pointer to map structure
+ *   key <-- character string (key)
+ *   id  <-- id associated with key
+ *----------------------------------------------------------------------------*/
+
+static void
+_hash_insert_id(cs_map_name_to_id_t  *m,
+                const char           *key,
+                int                   id)
+{
+  size_t slot = _hash_slot(key, m->hash_size);
+
+  while (m->hash_id[slot] > -1)
+    slot = (slot + 1) & (m->hash_size - 1);
+
+  m->hash_id[slot] = id;
+}
+
+/*----------------------------------------------------------------------------
+ * Build or rebuild the hash index, doubling its size if needed so that
+ * the load factor remains 1/2 or less.
+ *
+ * parameters:
+ *   m <-> pointer to map structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_hash_rebuild(cs_map_name_to_id_t  *m)
+{
+  size_t hash_size = CS_MAP_HASH_SIZE_MIN;
+
+  while (hash_size < m->size*2)
+    hash_size *= 2;
+
+  m->hash_size = hash_size;
+  BFT_REALLOC(m->hash_id, hash_size, int);
+
+  for (size_t i = 0; i < hash_size; i++)
+    m->hash_id[i] = -1;
+
+  for (size_t i = 0; i < m->size; i++)
+    _hash_insert_id(m, m->key[i], m->id[i]);
+}
+
+/*----------------------------------------------------------------------------
+ * Return the id matching a key using the hash index, or -1 if not present.
+ *
+ * As ids and key contents are stable under insertion (only the sorted key
+ * order changes), the index does not require rebuilding on insertions
+ * other than to limit its load factor.
+ *
+ * parameters:
+ *   m   <-- pointer to map structure
+ *   key <-- character string (key)
+ *
+ * returns:
+ *   id matching key, or -1.
+ *----------------------------------------------------------------------------*/
+
+static int
+_hash_lookup(const cs_map_name_to_id_t  *m,
+             const char                 *key)
+{
+  int id;
+
+  if (m->hash_size == 0)
+    return -1;
+
+  size_t slot = _hash_slot(key, m->hash_size);
+
+  while ((id = m->hash_id[slot]) > -1) {
+    if (strcmp(m->key[m->reverse_id[id]], key) == 0)
+      return id;
+    slot = (slot + 1) & (m->hash_size - 1);
+  }
+
+  return -1;
+}
+
 /*----------------------------------------------------------------------------
  * Insert new key.
  *
@@ -172,6 +287,13 @@ _name_to_id_insert_key(cs_map_name_to_id_t  *m,
   m->keys_size += key_size;
 
   m->size += 1;
+
+  /* Keep the hash index in step */
+
+  if (m->size*2 > m->hash_size)
+    _hash_rebuild(m);
+  else
+    _hash_insert_id(m, m->key[index], id);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -210,6 +332,9 @@ cs_map_name_to_id_create(void)
   BFT_MALLOC(m->id, m->max_size, int);
   BFT_MALLOC(m->reverse_id, m->max_size, int);
 
+  m->hash_size = 0;
+  m->hash_id = NULL;
+
   return m;
 }
 
@@ -229,6 +354,8 @@ cs_map_name_to_id_destroy(cs_map_name_to_id_t **m)
 
       cs_map_name_to_id_t *_m = *m;
 
+      BFT_FREE(_m->hash_id);
+
       BFT_FREE(_m->reverse_id);
       BFT_FREE(_m->id);
       BFT_FREE(_m->key);
@@ -259,7 +386,14 @@ cs_map_name_to_id(cs_map_name_to_id_t  *m,
   int start_id, end_id, mid_id;
   int cmp_ret = 1;
 
-  /* Use binary search to find entry */
+  /* Use hash index first */
+
+  int prev_id = _hash_lookup(m, key);
+  if (prev_id > -1)
+    return prev_id;
+
+  /* Use binary search to find the insertion point
+     (the key may only be absent at this stage) */
 
   start_id = 0;
   end_id = m->size - 1;
@@ -300,34 +434,13 @@ int
 cs_map_name_to_id_try(const cs_map_name_to_id_t  *m,
                       const char                 *key)
 {
-  int start_id, end_id, mid_id;
-  int cmp_ret = 1;
-
   int retval = -1;
 
-  /* Use binary search to find entry */
+  /* Use hash index to find entry (the index covers all entries,
+     as it is maintained on each insertion) */
 
-  if (m != NULL) {
-
-    start_id = 0;
-    end_id = m->size - 1;
-    mid_id = start_id + ((end_id -start_id) / 2);
-
-    while (start_id <= end_id) {
-      cmp_ret = strcmp(m->key[mid_id], key);
-      if (cmp_ret < 0)
-        start_id = mid_id + 1;
-      else if (cmp_ret > 0)
-        end_id = mid_id - 1;
-      else
-        break;
-      mid_id = start_id + ((end_id -start_id) / 2);
-    }
-
-    if (cmp_ret == 0)
-      retval = m->id[mid_id];
-
-  }
+  if (m != NULL)
+    retval = _hash_lookup(m, key);
 
   return retval;
 }
@@ -0,0 +1,290 @@
+/*============================================================================
+ * Adaptive mesh refinement during a computation.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_boundary_zone.h"
+#include "cs_field.h"
+#include "cs_gradient_perio.h"
+#include "cs_halo.h"
+#include "cs_halo_perio.h"
+#include "cs_matrix_default.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_bad_cells.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_mesh_refine.h"
+#include "cs_numbering.h"
+#include "cs_preprocess.h"
+#include "cs_prototypes.h"
+#include "cs_renumber.h"
+#include "cs_volume_zone.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_adapt.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_mesh_adapt.c
+        Adaptive mesh refinement during a computation.
+
+  The function here allows refining flagged cells of the global mesh
+  between time steps, rebuilding dependent mesh structures and
+  transferring field values to the refined mesh, so that resolution may
+  track moving features (such as flame fronts) instead of being fixed
+  at setup.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Transfer cell-based field values to a refined mesh.
+ *
+ * Each new cell inherits the value of the cell it was subdivided from,
+ * which is conservative for intensive quantities; values on ghost cells
+ * are then updated.
+ *
+ * parameters:
+ *   n_c_old    <-- number of cells before refinement
+ *   cell_o2n_idx <-- old to new cells index
+ *---------------------------------------------------------------------------*/
+
+static void
+_refine_cell_fields(cs_lnum_t         n_c_old,
+                    const cs_lnum_t   cell_o2n_idx[])
+{
+  const int n_fields = cs_field_n_fields();
+
+  const cs_halo_t *halo = cs_glob_mesh->halo;
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(CS_MESH_LOCATION_CELLS);
+  cs_lnum_t _n_cells_ext = n_elts[2];
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    if (f->location_id != CS_MESH_LOCATION_CELLS || f->is_owner == false)
+      continue;
+
+    const cs_lnum_t dim = f->dim;
+
+    for (int kk = 0; kk < f->n_time_vals; kk++) {
+
+      cs_real_t *val_old = f->vals[kk];
+      cs_real_t *val_new;
+
+      BFT_MALLOC(val_new, _n_cells_ext*dim, cs_real_t);
+
+      for (cs_lnum_t i = 0; i < n_c_old; i++) {
+        for (cs_lnum_t j = cell_o2n_idx[i]; j < cell_o2n_idx[i+1]; j++) {
+          for (cs_lnum_t k = 0; k < dim; k++)
+            val_new[j*dim + k] = val_old[i*dim + k];
+        }
+      }
+
+      BFT_FREE(val_old);
+      f->vals[kk] = val_new;
+
+      if (halo != NULL) {
+        cs_halo_sync_untyped(halo,
+                             CS_HALO_EXTENDED,
+                             dim*sizeof(cs_real_t),
+                             f->vals[kk]);
+        if (dim == 3)
+          cs_halo_perio_sync_var_vect(halo,
+                                      CS_HALO_EXTENDED,
+                                      f->vals[kk],
+                                      dim);
+      }
+
+    }
+
+    f->val = f->vals[0];
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Re-allocate face-based field values and boundary condition coefficients
+ * on a refined mesh.
+ *
+ * Face counts change with refinement and no old to new face mapping is
+ * kept here, so face-based values are reset to 0 and boundary condition
+ * coefficients are re-allocated; both are re-assigned at the start of the
+ * next time step.
+ *---------------------------------------------------------------------------*/
+
+static void
+_refine_face_fields(void)
+{
+  const int n_fields = cs_field_n_fields();
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+
+    cs_field_t *f = cs_field_by_id(f_id);
+
+    cs_mesh_location_type_t loc_type
+      = cs_mesh_location_get_type(f->location_id);
+
+    if (   loc_type == CS_MESH_LOCATION_INTERIOR_FACES
+        || loc_type == CS_MESH_LOCATION_BOUNDARY_FACES)
+      cs_field_allocate_values(f);
+
+    if (f->bc_coeffs != NULL)
+      cs_field_allocate_bc_coeffs(f,
+                                  (f->bc_coeffs->af != NULL),
+                                  (f->bc_coeffs->ad != NULL),
+                                  (f->bc_coeffs->ac != NULL),
+                                  (f->bc_coeffs->hint != NULL));
+
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged cells of the global mesh and update dependent
+ *        structures and fields.
+ *
+ * Flagged cells are subdivided (conformally, so refinement may propagate
+ * to neighboring cells), ghost cells and parallel structures are rebuilt,
+ * geometric quantities, mesh locations and zones are recomputed, and
+ * cell-based field values are transferred to the refined mesh, each new
+ * cell inheriting the value of its parent cell.
+ *
+ * Cells are not renumbered, so as to preserve the parent/child mapping
+ * used for the transfer of cell-based values; interior and boundary
+ * faces are. Face-based field values and boundary condition coefficients
+ * are reset, and are expected to be re-assigned at the start of the next
+ * time step; coarsening of previously refined cells is not available.
+ *
+ * \param[in]  cell_flag  subdivision type for each cell
+ *                        (0: none; 1: isotropic)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adapt_refine(const int  cell_flag[])
+{
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  cs_lnum_t n_c_old = m->n_cells;
+  cs_gnum_t n_g_c_old = m->n_g_cells;
+  cs_lnum_t *cell_o2n_idx = NULL;
+
+  /* Refine the mesh itself (ghost cells and auxiliary mesh data are
+     rebuilt at the end of this step) */
+
+  cs_mesh_refine_simple_map(m, true, cell_flag, &cell_o2n_idx);
+
+  /* Renumber faces for vectorization or threading; cells keep their
+     refinement ordering so cell_o2n_idx remains valid */
+
+  cs_renumber_i_faces(m);
+  cs_renumber_b_faces(m);
+
+  if (m->cell_numbering == NULL)
+    m->cell_numbering = cs_numbering_create_default(m->n_cells);
+
+  /* Recompute geometric quantities and rebuild locations, zones,
+     and selectors */
+
+  cs_mesh_quantities_compute(m, mq);
+  cs_mesh_bad_cells_detect(m, mq);
+  cs_user_mesh_bad_cells_tag(m, mq);
+
+  cs_mesh_init_selectors();
+  cs_mesh_location_build(m, -1);
+  cs_volume_zone_build_all(true);
+  cs_boundary_zone_build_all(true);
+
+  /* Update Fortran mesh sizes and quantities */
+
+  cs_preprocess_mesh_update_fortran();
+
+  /* Transfer cell-based field values and re-allocate face-based values
+     and boundary condition coefficients */
+
+  _refine_cell_fields(n_c_old, cell_o2n_idx);
+  _refine_face_fields();
+
+  BFT_FREE(cell_o2n_idx);
+
+  /* Update structures depending on the mesh */
+
+  cs_mesh_adjacencies_update_mesh();
+
+  cs_gradient_perio_update_mesh();
+  cs_matrix_update_mesh();
+
+  if (m->verbosity > 0) {
+    bft_printf(_("\n"
+                 " Mesh refinement: %llu cells (previously %llu)\n"),
+               (unsigned long long)m->n_g_cells,
+               (unsigned long long)n_g_c_old);
+    bft_printf_flush();
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -117,7 +117,13 @@ _arg_env_help(const char  *name)
   fprintf
     (e, _(" --benchmark       elementary operations performance\n"
           "                   [--mpitrace] operations done only once\n"
-          "                                for light MPI traces\n"));
+          "                                for light MPI traces\n"
+          "                   [--mesh <nx:ny:nz[:rx:ry:rz[:p]]>]\n"
+          "                                generated hexahedral test mesh\n"
+          "                                with nx*ny*nz cells, optional\n"
+          "                                grading ratios, and optional\n"
+          "                                vertex perturbation, instead\n"
+          "                                of a mesh input file\n"));
   fprintf
     (e, _(" -h, --help        this help message\n\n"));
 
@@ -209,6 +215,12 @@ cs_opts_define(int         argc,
   opts->verif = false;
   opts->benchmark = 0;
 
+  for (int i = 0; i < 3; i++) {
+    opts->benchmark_mesh_size[i] = 0;
+    opts->benchmark_mesh_grading[i] = 1.;
+  }
+  opts->benchmark_mesh_perturbation = 0.;
+
   opts->yacs_module = NULL;
 
   /* Parse command line arguments */
@@ -227,11 +239,33 @@ cs_opts_define(int         argc,
 
     else if (strcmp(s, "--benchmark") == 0) {
       opts->benchmark = 1;
-      if (arg_id + 1 < argc) {
+      while (arg_id + 1 < argc && argerr == 0) {
         if (strcmp(argv[arg_id + 1], "--mpitrace") == 0) {
           opts->benchmark = 2;
           arg_id++;
         }
+        else if (strcmp(argv[arg_id + 1], "--mesh") == 0
+                 && arg_id + 2 < argc) {
+          unsigned long long n[3] = {0, 0, 0};
+          double r[3] = {1., 1., 1.};
+          double p = 0.;
+          int n_read = sscanf(argv[arg_id + 2],
+                              "%llu:%llu:%llu:%lf:%lf:%lf:%lf",
+                              n, n+1, n+2, r, r+1, r+2, &p);
+          if (   (n_read != 3 && n_read != 6 && n_read != 7)
+              || n[0] < 1 || n[1] < 1 || n[2] < 1)
+            argerr = 1;
+          else {
+            for (int i = 0; i < 3; i++) {
+              opts->benchmark_mesh_size[i] = n[i];
+              opts->benchmark_mesh_grading[i] = r[i];
+            }
+            opts->benchmark_mesh_perturbation = p;
+          }
+          arg_id += 2;
+        }
+        else
+          break;
       }
     }
 
@@ -73,6 +73,13 @@ typedef struct {
                                    1: timing (CPU + Walltime) mode
                                    2: MPI trace-friendly mode */
 
+  cs_gnum_t      benchmark_mesh_size[3];  /* Generated benchmark mesh cells
+                                             per direction (0: none) */
+  double         benchmark_mesh_grading[3];      /* Generated benchmark mesh
+                                                    cell size ratios */
+  double         benchmark_mesh_perturbation;    /* Generated benchmark mesh
+                                                    vertex perturbation */
+
   /* Connection with YACS */
 
   char          *yacs_module;   /* Path to YACS module */
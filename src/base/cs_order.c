@@ -110,27 +110,32 @@ _order_gnum_descend_tree(const cs_gnum_t   number[],
 }
 
 /*----------------------------------------------------------------------------
- * Order an array of global numbers.
+ * Order a sub-range of an array of global numbers.
  *
  * parameters:
  *   number   <-- array of entity numbers (if NULL, a default 1 to n
  *                numbering is considered)
  *   order    <-- pre-allocated ordering table
- *   nb_ent   <-- number of entities considered
+ *   start_id <-- id of first entity of the sub-range
+ *   end_id   <-- id past the last entity of the sub-range
  *----------------------------------------------------------------------------*/
 
 static void
-_order_gnum(const cs_gnum_t   number[],
-            cs_lnum_t         order[],
-            const size_t      nb_ent)
+_order_gnum_range(const cs_gnum_t   number[],
+                  cs_lnum_t         order[],
+                  const size_t      start_id,
+                  const size_t      end_id)
 {
   size_t i;
   cs_lnum_t o_save;
 
+  size_t nb_ent = end_id - start_id;
+  cs_lnum_t *_order = order + start_id;
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
-    order[i] = i;
+    _order[i] = start_id + i;
 
   if (nb_ent < 2)
     return;
@@ -140,19 +145,138 @@ _order_gnum(const cs_gnum_t   number[],
   i = (nb_ent / 2) ;
   do {
     i--;
-    _order_gnum_descend_tree(number, i, nb_ent, order);
+    _order_gnum_descend_tree(number, i, nb_ent, _order);
   } while (i > 0);
 
   /* Sort binary tree */
 
   for (i = nb_ent - 1 ; i > 0 ; i--) {
-    o_save   = order[0];
-    order[0] = order[i];
-    order[i] = o_save;
-    _order_gnum_descend_tree(number, 0, i, order);
+    o_save   = _order[0];
+    _order[0] = _order[i];
+    _order[i] = o_save;
+    _order_gnum_descend_tree(number, 0, i, _order);
   }
 }
 
+#if defined(HAVE_OPENMP)
+
+/*----------------------------------------------------------------------------
+ * Merge two contiguous pre-ordered ranges of an ordering table.
+ *
+ * parameters:
+ *   number    <-- array of entity numbers
+ *   order_in  <-- ordering table, ordered on [i0, i1[ and [i1, i2[
+ *   order_out --> ordering table, ordered on [i0, i2[
+ *   i0        <-- id of first entity of the first range
+ *   i1        <-- id of first entity of the second range
+ *   i2        <-- id past the last entity of the second range
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_merge(const cs_gnum_t   number[],
+                  const cs_lnum_t   order_in[],
+                  cs_lnum_t         order_out[],
+                  const size_t      i0,
+                  const size_t      i1,
+                  const size_t      i2)
+{
+  size_t i = i0, j = i1, k = i0;
+
+  while (i < i1 && j < i2) {
+    if (number[order_in[i]] <= number[order_in[j]])
+      order_out[k++] = order_in[i++];
+    else
+      order_out[k++] = order_in[j++];
+  }
+  while (i < i1)
+    order_out[k++] = order_in[i++];
+  while (j < i2)
+    order_out[k++] = order_in[j++];
+}
+
+#endif /* defined(HAVE_OPENMP) */
+
+/*----------------------------------------------------------------------------
+ * Order an array of global numbers.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers (if NULL, a default 1 to n
+ *                numbering is considered)
+ *   order    <-- pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum(const cs_gnum_t   number[],
+            cs_lnum_t         order[],
+            const size_t      nb_ent)
+{
+#if defined(HAVE_OPENMP)
+
+  /* For large arrays, order chunks in parallel, then merge the
+     pre-ordered chunks pairwise; each merge pass halves the number of
+     chunks and runs its merges in parallel. */
+
+  int n_chunks = cs_glob_n_threads;
+
+  if (n_chunks > 1 && nb_ent > (size_t)(CS_THR_MIN*n_chunks)) {
+
+    int t;
+    size_t c_size;
+    size_t chunk_size = (nb_ent + n_chunks - 1) / n_chunks;
+    cs_lnum_t *order_tmp = NULL, *o_in = order, *o_out = NULL;
+
+    BFT_MALLOC(order_tmp, nb_ent, cs_lnum_t);
+    o_out = order_tmp;
+
+#   pragma omp parallel for schedule(static, 1)
+    for (t = 0; t < n_chunks; t++) {
+      size_t s_id = (size_t)t * chunk_size;
+      size_t e_id = s_id + chunk_size;
+      if (e_id > nb_ent)
+        e_id = nb_ent;
+      if (s_id < e_id)
+        _order_gnum_range(number, o_in, s_id, e_id);
+    }
+
+    for (c_size = chunk_size; c_size < nb_ent; c_size *= 2) {
+
+      int p;
+      int n_merges = (nb_ent + 2*c_size - 1) / (2*c_size);
+      cs_lnum_t *o_swap;
+
+#     pragma omp parallel for schedule(static, 1)
+      for (p = 0; p < n_merges; p++) {
+        size_t i0 = (size_t)p * c_size * 2;
+        size_t i1 = i0 + c_size;
+        size_t i2 = i1 + c_size;
+        if (i1 > nb_ent)
+          i1 = nb_ent;
+        if (i2 > nb_ent)
+          i2 = nb_ent;
+        _order_gnum_merge(number, o_in, o_out, i0, i1, i2);
+      }
+
+      o_swap = o_in;
+      o_in = o_out;
+      o_out = o_swap;
+
+    }
+
+    if (o_in != order)
+      memcpy(order, o_in, nb_ent*sizeof(cs_lnum_t));
+
+    BFT_FREE(order_tmp);
+
+    return;
+
+  }
+
+#endif /* defined(HAVE_OPENMP) */
+
+  _order_gnum_range(number, order, 0, nb_ent);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the lexicographical ordering of a strided
  * cs_gnum_t array.
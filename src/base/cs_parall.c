@@ -32,14 +32,21 @@
 
 #include <assert.h>
 #include <stdarg.h>
+#include <stdlib.h>
 #include <string.h>
 
+#if defined(HAVE_MPI) && defined(HAVE_PTHREAD)
+#include <pthread.h>
+#include <time.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
 
 #include "bft_error.h"
 #include "bft_mem.h"
+#include "bft_printf.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -151,6 +158,29 @@ typedef struct
 
 static size_t _cs_parall_min_coll_buf_size = 1024*1024*8;
 
+#if defined(HAVE_PTHREAD)
+
+/* MPI progress helper thread.
+
+   Some MPI stacks make no asynchronous progress on non-blocking
+   exchanges unless the application re-enters the MPI library, defeating
+   communication/computation overlap. When enabled (through the
+   CS_MPI_PROGRESS_THREAD environment variable, whose value gives the
+   minimum exchanged size in bytes), a helper thread polls the library
+   while exchange windows are open, and sleeps on a condition variable
+   otherwise; MPI_THREAD_MULTIPLE support is required. */
+
+static long             _cs_parall_progress_threshold = -1;  /* -1: unchecked;
+                                                                 0: disabled */
+static bool             _cs_parall_progress_started = false;
+static int              _cs_parall_progress_windows = 0;
+static int              _cs_parall_progress_exit = 0;
+static pthread_t        _cs_parall_progress_thread;
+static pthread_mutex_t  _cs_parall_progress_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   _cs_parall_progress_cond = PTHREAD_COND_INITIALIZER;
+
+#endif /* defined(HAVE_PTHREAD) */
+
 #endif
 
 /*============================================================================
@@ -225,6 +255,100 @@ cs_f_parall_barrier(void);
  * Private function definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI) && defined(HAVE_PTHREAD)
+
+/*----------------------------------------------------------------------------
+ * MPI progress helper thread main loop.
+ *
+ * While at least one exchange window is open, the MPI library is polled
+ * at short intervals so non-blocking operations progress; otherwise the
+ * thread sleeps on the associated condition variable.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_cs_parall_progress_main(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  struct timespec ts;
+  ts.tv_sec = 0;
+  ts.tv_nsec = 100000;  /* 100 microseconds between polls */
+
+  pthread_mutex_lock(&_cs_parall_progress_lock);
+
+  while (_cs_parall_progress_exit == 0) {
+
+    if (_cs_parall_progress_windows == 0) {
+      pthread_cond_wait(&_cs_parall_progress_cond,
+                        &_cs_parall_progress_lock);
+      continue;
+    }
+
+    pthread_mutex_unlock(&_cs_parall_progress_lock);
+
+    int flag;
+    MPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, cs_glob_mpi_comm,
+               &flag, MPI_STATUS_IGNORE);
+    nanosleep(&ts, NULL);
+
+    pthread_mutex_lock(&_cs_parall_progress_lock);
+
+  }
+
+  pthread_mutex_unlock(&_cs_parall_progress_lock);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * One-time setup of the MPI progress helper thread.
+ *
+ * The activation threshold is read from the CS_MPI_PROGRESS_THREAD
+ * environment variable; the thread is only created when it is positive
+ * and the MPI library was initialized with MPI_THREAD_MULTIPLE support.
+ *----------------------------------------------------------------------------*/
+
+static void
+_cs_parall_progress_setup(void)
+{
+  long threshold = 0;
+
+  const char *s = getenv("CS_MPI_PROGRESS_THREAD");
+
+  if (s != NULL)
+    threshold = atol(s);
+
+  if (threshold > 0) {
+
+    int level = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&level);
+
+    if (level < MPI_THREAD_MULTIPLE) {
+      bft_printf
+        (_("\nCS_MPI_PROGRESS_THREAD is set, but the MPI library was not\n"
+           "initialized with MPI_THREAD_MULTIPLE support;\n"
+           "no progress thread will be used.\n"));
+      threshold = 0;
+    }
+    else if (pthread_create(&_cs_parall_progress_thread, NULL,
+                            _cs_parall_progress_main, NULL) == 0)
+      _cs_parall_progress_started = true;
+    else
+      threshold = 0;
+
+  }
+
+  _cs_parall_progress_threshold = threshold;
+}
+
+#endif /* defined(HAVE_MPI) && defined(HAVE_PTHREAD) */
+
 /*----------------------------------------------------------------------------
  * Call MPI_Allreduce for a given Code_Saturne datatype and MPI
  * operation on all default communicator processes.
@@ -970,6 +1094,105 @@ cs_parall_set_min_coll_buf_size(size_t buffer_size)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Open an MPI progress window for a non-blocking exchange.
+ *
+ * When the progress helper thread is enabled (CS_MPI_PROGRESS_THREAD
+ * environment variable, whose value gives the minimum exchanged size in
+ * bytes) and the given size reaches the configured threshold, the helper
+ * thread polls the MPI library until the window is closed by a matching
+ * call to \ref cs_parall_progress_thread_end, so that non-blocking
+ * operations progress while the calling thread computes. Below the
+ * threshold, or when the facility is disabled, this is a no-op.
+ *
+ * \param[in]  size  size of the associated exchange (in bytes)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_progress_thread_begin(size_t  size)
+{
+#if defined(HAVE_MPI) && defined(HAVE_PTHREAD)
+
+  if (cs_glob_n_ranks < 2)
+    return;
+
+  if (_cs_parall_progress_threshold < 0)
+    _cs_parall_progress_setup();
+
+  if (   _cs_parall_progress_started == false
+      || size < (size_t)_cs_parall_progress_threshold)
+    return;
+
+  pthread_mutex_lock(&_cs_parall_progress_lock);
+  _cs_parall_progress_windows += 1;
+  pthread_cond_signal(&_cs_parall_progress_cond);
+  pthread_mutex_unlock(&_cs_parall_progress_lock);
+
+#else
+
+  CS_UNUSED(size);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Close an MPI progress window opened by
+ *        \ref cs_parall_progress_thread_begin.
+ *
+ * Calling this function when no window is open is a no-op, so it may be
+ * called unconditionally once the associated exchange is complete.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_progress_thread_end(void)
+{
+#if defined(HAVE_MPI) && defined(HAVE_PTHREAD)
+
+  if (_cs_parall_progress_started == false)
+    return;
+
+  pthread_mutex_lock(&_cs_parall_progress_lock);
+  if (_cs_parall_progress_windows > 0)
+    _cs_parall_progress_windows -= 1;
+  pthread_mutex_unlock(&_cs_parall_progress_lock);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Stop and join the MPI progress helper thread if it was started.
+ *
+ * Should be called before MPI is finalized.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_progress_thread_finalize(void)
+{
+#if defined(HAVE_MPI) && defined(HAVE_PTHREAD)
+
+  if (_cs_parall_progress_started == false)
+    return;
+
+  pthread_mutex_lock(&_cs_parall_progress_lock);
+  _cs_parall_progress_windows = 0;
+  _cs_parall_progress_exit = 1;
+  pthread_cond_signal(&_cs_parall_progress_cond);
+  pthread_mutex_unlock(&_cs_parall_progress_lock);
+
+  pthread_join(_cs_parall_progress_thread, NULL);
+
+  _cs_parall_progress_started = false;
+  _cs_parall_progress_threshold = 0;
+
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -366,6 +366,43 @@ cs_parall_get_min_coll_buf_size(void);
 void
 cs_parall_set_min_coll_buf_size(size_t buffer_size);
 
+/*----------------------------------------------------------------------------
+ * Open an MPI progress window for a non-blocking exchange.
+ *
+ * When the progress helper thread is enabled (CS_MPI_PROGRESS_THREAD
+ * environment variable, whose value gives the minimum exchanged size in
+ * bytes) and the given size reaches the configured threshold, the helper
+ * thread polls the MPI library until the window is closed by a matching
+ * call to cs_parall_progress_thread_end(), so that non-blocking
+ * operations progress while the calling thread computes. Below the
+ * threshold, or when the facility is disabled, this is a no-op.
+ *
+ * parameters:
+ *   size <-- size of the associated exchange (in bytes)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_progress_thread_begin(size_t  size);
+
+/*----------------------------------------------------------------------------
+ * Close an MPI progress window opened by cs_parall_progress_thread_begin().
+ *
+ * Calling this function when no window is open is a no-op, so it may be
+ * called unconditionally once the associated exchange is complete.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_progress_thread_end(void);
+
+/*----------------------------------------------------------------------------
+ * Stop and join the MPI progress helper thread if it was started.
+ *
+ * Should be called before MPI is finalized.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_parall_progress_thread_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -980,6 +980,14 @@ cs_parameters_define_field_keys(void)
    */
   cs_field_define_key_int("time_extrapolated", -1, 0);
 
+  /*! Update interval, in time steps, for property fields evaluated
+   * through a physical law (user formula or tabulated law); with a
+   * value n > 1, the law is only re-evaluated every n time steps,
+   * which may be chosen for costly laws (such as table lookups) whose
+   * inputs evolve slowly. The property is always evaluated at the
+   * first time step of a run. */
+  cs_field_define_key_int("property_update_interval", 1, CS_FIELD_PROPERTY);
+
   cs_field_define_key_int("measures_set_id", -1, CS_FIELD_VARIABLE);
   cs_field_define_key_int("opt_interp_id", -1, CS_FIELD_VARIABLE);
   cs_field_define_key_int("opt_interp_analysis_id", -1, CS_FIELD_VARIABLE);
@@ -1020,6 +1028,7 @@ cs_parameters_define_field_keys(void)
 
   /* Restart options */
   cs_field_define_key_int("restart_file", CS_RESTART_DISABLED, 0);
+  cs_field_define_key_int("restart_precision", 0, 0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -104,6 +104,19 @@ struct _cs_part_to_block_t {
 
 #endif /* defined(HAVE_MPI) */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_MPI)
+
+/* Use one-sided communication (MPI_Put with passive target synchronization)
+   instead of two-sided collectives for array data movement ? */
+
+static bool _cs_part_to_block_use_rma = false;
+
+#endif
+
 /*============================================================================
  * Local function defintions
  *============================================================================*/
@@ -524,6 +537,96 @@ _copy_indexed_gatherv(cs_part_to_block_t  *d,
   }
 }
 
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Copy array data from general domain partition to block distribution,
+ * using one-sided communication.
+ *
+ * As the block distribution is defined by a simple arithmetic relation,
+ * the owning rank and offset of each entity may be computed directly from
+ * its global number, so values are written in place on the target using
+ * MPI_Put with passive target synchronization, with no metadata exchange;
+ * runs of entities with consecutive global numbers are grouped in a
+ * single access.
+ *
+ * If the same entity appears in multiple partitions, the values put
+ * should be identical, as with the two-sided exchange, the "last writer"
+ * is not deterministic.
+ *
+ * arguments:
+ *   d            <-- partition to block distributor
+ *   datatype     <-- type of data considered
+ *   stride       <-- number of values per entity (interlaced)
+ *   part_values  <-- values in general domain partition
+ *   block_values --> values in block distribution
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_array_rma(cs_part_to_block_t  *d,
+                cs_datatype_t        datatype,
+                int                  stride,
+                const void          *part_values,
+                void                *block_values)
+{
+  size_t j;
+
+  MPI_Win win;
+
+  size_t type_size = cs_datatype_size[datatype];
+  MPI_Datatype mpi_type = cs_datatype_to_mpi[datatype];
+
+  const unsigned char *_part_values = part_values;
+
+  const cs_gnum_t block_size = d->bi.block_size;
+  const int rank_step = d->bi.rank_step;
+  const cs_gnum_t *global_ent_num = d->global_ent_num;
+
+  /* Expose local block array, then write into remote blocks */
+
+  MPI_Win_create(block_values,
+                 (MPI_Aint)(d->n_block_ents*stride*type_size),
+                 type_size,
+                 MPI_INFO_NULL,
+                 d->comm,
+                 &win);
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+
+  for (j = 0; j < d->n_part_ents; ) {
+
+    cs_gnum_t g_id = global_ent_num[j] - 1;
+    cs_gnum_t block_end = (g_id/block_size + 1)*block_size;
+    int dest_rank = (g_id/block_size)*rank_step;
+
+    size_t n = 1;
+    while (   j+n < d->n_part_ents
+           && global_ent_num[j+n] == global_ent_num[j+n-1] + 1
+           && global_ent_num[j+n] - 1 < block_end)
+      n++;
+
+    MPI_Put(_part_values + j*stride*type_size,
+            n*stride,
+            mpi_type,
+            dest_rank,
+            (MPI_Aint)((g_id % block_size)*stride),
+            n*stride,
+            mpi_type,
+            win);
+
+    j += n;
+  }
+
+  MPI_Win_unlock_all(win);
+
+  /* Freeing the window is collective, so all accesses are complete
+     once it returns, and the block array may be read locally */
+
+  MPI_Win_free(&win);
+}
+
+#endif /* defined(MPI_VERSION) && (MPI_VERSION >= 3) */
+
 #endif /* defined(HAVE_MPI) */
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -671,6 +774,14 @@ cs_part_to_block_copy_array(cs_part_to_block_t  *d,
                         stride,
                         part_values,
                         block_values);
+#if defined(MPI_VERSION) && (MPI_VERSION >= 3)
+  else if (_cs_part_to_block_use_rma && d->global_ent_num != NULL)
+    _copy_array_rma(d,
+                    datatype,
+                    stride,
+                    part_values,
+                    block_values);
+#endif
   else
     cs_all_to_all_copy_array(d->d,
                              datatype,
@@ -748,6 +859,41 @@ cs_part_to_block_copy_indexed(cs_part_to_block_t  *d,
                                block_val);
 }
 
+/*----------------------------------------------------------------------------
+ * Get current status of one-sided communication use for array copies.
+ *
+ * returns:
+ *   true if one-sided communication is enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_part_to_block_get_use_rma(void)
+{
+  return _cs_part_to_block_use_rma;
+}
+
+/*----------------------------------------------------------------------------
+ * Set one-sided communication use for array copies.
+ *
+ * When this option is enabled (and the MPI library supports MPI-3 one-sided
+ * communication with passive target synchronization), array data is written
+ * directly into remote block arrays using MPI_Put instead of being exchanged
+ * through two-sided collectives, avoiding full synchronization of all ranks
+ * during operations such as checkpoint writes.
+ *
+ * It only applies to distributors based on global entity numbers using
+ * more than one block, and to array (i.e. non-indexed) data.
+ *
+ * arguments:
+ *   use_rma <-- true to enable one-sided communication, false to disable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_part_to_block_set_use_rma(bool  use_rma)
+{
+  _cs_part_to_block_use_rma = use_rma;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
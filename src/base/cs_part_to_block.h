@@ -181,6 +181,35 @@ cs_part_to_block_copy_indexed(cs_part_to_block_t   *d,
                               const cs_lnum_t      *block_index,
                               void                 *block_val);
 
+/*----------------------------------------------------------------------------
+ * Get current status of one-sided communication use for array copies.
+ *
+ * returns:
+ *   true if one-sided communication is enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_part_to_block_get_use_rma(void);
+
+/*----------------------------------------------------------------------------
+ * Set one-sided communication use for array copies.
+ *
+ * When this option is enabled (and the MPI library supports MPI-3 one-sided
+ * communication with passive target synchronization), array data is written
+ * directly into remote block arrays using MPI_Put instead of being exchanged
+ * through two-sided collectives, avoiding full synchronization of all ranks
+ * during operations such as checkpoint writes.
+ *
+ * It only applies to distributors based on global entity numbers using
+ * more than one block, and to array (i.e. non-indexed) data.
+ *
+ * arguments:
+ *   use_rma <-- true to enable one-sided communication, false to disable
+ *----------------------------------------------------------------------------*/
+
+void
+cs_part_to_block_set_use_rma(bool  use_rma);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,251 @@
+/*============================================================================
+ * Cell partitioning weights based on active physical models.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <float.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_mem.h"
+
+#include "cs_field.h"
+#include "cs_lagr_particle.h"
+#include "cs_lagr_query.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_parall.h"
+#include "cs_partition.h"
+#include "cs_physical_model.h"
+#include "cs_rad_transfer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_partition_weight.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_partition_weight.c
+        Cell partitioning weights based on active physical models.
+
+  Space-filling curve partitionings assume uniform per-cell cost by
+  default, which may lead to strong load imbalance when the cost of some
+  models is localized: radiative transfer in participating media,
+  Lagrangian particle tracking, or stiff chemistry in reacting zones.
+  The functions here estimate a per-cell computational cost from the
+  models active on the current partition, and register it as cell
+  weights for the next (re)partitioning
+  (see \ref cs_partition_set_cell_weight).
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Model costs relative to the base (flow) cost of one cell; defaults are
+   rough orders of magnitude, and may be tuned for a given case based on
+   timings (for pulverized coal, reacting cells are typically about 5x
+   the cost of inert ones) */
+
+static double  _rad_cost_ratio = 1.;
+static double  _particle_cost_ratio = 0.1;
+static double  _reaction_cost_ratio = 4.;
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set relative costs used when building partitioning weights from
+ *        active physical models.
+ *
+ * \param[in]  rad_cost       cost of radiative transfer in a fully
+ *                            participating cell, relative to base flow cost
+ * \param[in]  particle_cost  tracking cost of one particle, relative to
+ *                            base flow cost of one cell
+ * \param[in]  reaction_cost  extra chemistry cost of a fully reacting cell,
+ *                            relative to base flow cost
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_weight_set_cost_ratios(double  rad_cost,
+                                    double  particle_cost,
+                                    double  reaction_cost)
+{
+  _rad_cost_ratio = rad_cost;
+  _particle_cost_ratio = particle_cost;
+  _reaction_cost_ratio = reaction_cost;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell partitioning weights based on active physical models.
+ *
+ * The estimated cost of each cell combines a base (flow) cost with
+ * contributions from active models on the current partition:
+ *
+ * - radiative transfer, weighted by the cell's normalized absorption
+ *   coefficient when available (uniform otherwise);
+ * - Lagrangian particle tracking, proportional to the number of particles
+ *   currently in the cell;
+ * - combustion chemistry, using the cell temperature relative to the
+ *   domain extrema as a reaction zone indicator.
+ *
+ * Weights are registered with \ref cs_partition_set_cell_weight, so apply
+ * at the next (re)partitioning of the mesh; this function does nothing
+ * in serial mode.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_weight_from_physics(void)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+
+  if (cs_glob_n_ranks < 2 || m->global_cell_num == NULL)
+    return;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  cs_real_t *w;
+  BFT_MALLOC(w, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    w[i] = 1.;
+
+  /* Radiative transfer: weight participating cells by their normalized
+     absorption coefficient when available */
+
+  if (cs_glob_rad_transfer_params->type != CS_RAD_TRANSFER_NONE) {
+
+    const cs_field_t *f_ck = cs_field_by_name_try("rad_absorption_coeff");
+
+    if (f_ck != NULL && f_ck->location_id == CS_MESH_LOCATION_CELLS) {
+      cs_real_t ck_max = 0.;
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        ck_max = CS_MAX(ck_max, f_ck->val[i]);
+      cs_parall_max(1, CS_REAL_TYPE, &ck_max);
+      if (ck_max > 0.) {
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          w[i] += _rad_cost_ratio * f_ck->val[i] / ck_max;
+      }
+    }
+    else {
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        w[i] += _rad_cost_ratio;
+    }
+
+  }
+
+  /* Lagrangian module: tracking cost proportional to the number of
+     particles currently in each cell */
+
+  if (cs_lagr_model_type() > 0) {
+
+    const cs_lagr_particle_set_t *p_set = cs_lagr_get_particle_set();
+
+    if (p_set != NULL) {
+      for (cs_lnum_t j = 0; j < p_set->n_particles; j++) {
+        cs_lnum_t cell_num
+          = cs_lagr_particles_get_lnum(p_set, j, CS_LAGR_CELL_NUM);
+        if (cell_num > 0)
+          w[cell_num - 1] += _particle_cost_ratio;
+      }
+    }
+
+  }
+
+  /* Combustion models: stiff chemistry source terms make reacting cells
+     more expensive; use the cell temperature relative to the domain
+     extrema as a reaction zone indicator */
+
+  bool have_combustion = false;
+
+  {
+    const cs_physical_model_type_t combustion_models[]
+      = {CS_COMBUSTION_3PT, CS_COMBUSTION_EBU, CS_COMBUSTION_LW,
+         CS_COMBUSTION_PCLC, CS_COMBUSTION_COAL, CS_COMBUSTION_FUEL};
+
+    for (int k = 0; k < 6; k++) {
+      if (cs_glob_physical_model_flag[combustion_models[k]] >= 0)
+        have_combustion = true;
+    }
+  }
+
+  if (have_combustion) {
+
+    const cs_field_t *f_t = cs_field_by_name_try("temperature");
+
+    if (f_t != NULL && f_t->location_id == CS_MESH_LOCATION_CELLS) {
+
+      cs_real_t t_min = DBL_MAX, t_max = -DBL_MAX;
+      for (cs_lnum_t i = 0; i < n_cells; i++) {
+        t_min = CS_MIN(t_min, f_t->val[i]);
+        t_max = CS_MAX(t_max, f_t->val[i]);
+      }
+      cs_parall_min(1, CS_REAL_TYPE, &t_min);
+      cs_parall_max(1, CS_REAL_TYPE, &t_max);
+
+      if (t_max > t_min) {
+        for (cs_lnum_t i = 0; i < n_cells; i++)
+          w[i] +=   _reaction_cost_ratio
+                  * (f_t->val[i] - t_min) / (t_max - t_min);
+      }
+
+    }
+
+  }
+
+  cs_partition_set_cell_weight(n_cells, m->global_cell_num, w);
+
+  BFT_FREE(w);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
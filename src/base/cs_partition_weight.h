@@ -0,0 +1,74 @@
+#ifndef __CS_PARTITION_WEIGHT_H__
+#define __CS_PARTITION_WEIGHT_H__
+
+/*============================================================================
+ * Cell partitioning weights based on active physical models.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set relative costs used when building partitioning weights from
+ *        active physical models.
+ *
+ * \param[in]  rad_cost       cost of radiative transfer in a fully
+ *                            participating cell, relative to base flow cost
+ * \param[in]  particle_cost  tracking cost of one particle, relative to
+ *                            base flow cost of one cell
+ * \param[in]  reaction_cost  extra chemistry cost of a fully reacting cell,
+ *                            relative to base flow cost
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_weight_set_cost_ratios(double  rad_cost,
+                                    double  particle_cost,
+                                    double  reaction_cost);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell partitioning weights based on active physical models.
+ *
+ * \sa cs_partition_set_cell_weight
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_weight_from_physics(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PARTITION_WEIGHT_H__ */
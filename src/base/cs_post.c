@@ -46,6 +46,7 @@
 #include "fvm_nodal.h"
 #include "fvm_nodal_append.h"
 #include "fvm_nodal_extract.h"
+#include "fvm_to_histogram.h"
 
 #include "cs_base.h"
 #include "cs_boundary_zone.h"
@@ -60,6 +61,8 @@
 #include "cs_parall.h"
 #include "cs_prototypes.h"
 #include "cs_selector.h"
+#include "cs_task_scheduler.h"
+#include "cs_time_plot.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
 #include "cs_volume_zone.h"
@@ -322,6 +325,14 @@ typedef struct {
   double                  density;       /* Particles density in case
                                             of particle mesh */
 
+  cs_lnum_t               n_sel_elts[3]; /* Number of cells, interior, and
+                                            boundary faces of the last
+                                            selection, saved for transient-
+                                            connectivity meshes (-1 when
+                                            no selection is saved) */
+  cs_lnum_t              *sel_elts[3];   /* Matching selection lists,
+                                            NULL for a full range */
+
   const fvm_nodal_t      *exp_mesh;      /* Associated exportable mesh */
   fvm_nodal_t            *_exp_mesh;     /* Associated exportable mesh,
                                             if owner */
@@ -329,8 +340,43 @@ typedef struct {
   fvm_writer_time_dep_t   mod_flag_min;  /* Minimum mesh time dependency */
   fvm_writer_time_dep_t   mod_flag_max;  /* Maximum mesh time dependency */
 
+  int                     n_tracked_fields; /* Size of field output tracking
+                                               arrays (0 if not used yet) */
+  cs_gnum_t              *field_checksum;   /* Checksum of each field at its
+                                               last output on this mesh */
+  int                    *field_uptodate;   /* Mask of associated writers
+                                               whose last output of each field
+                                               matches field_checksum */
+
 } cs_post_mesh_t;
 
+/* Registered in-situ analysis */
+/*-----------------------------*/
+
+/* This object associates an analysis function with the fields it monitors,
+   tracking a checksum per field so unchanged fields may be flagged. */
+
+typedef struct {
+
+  cs_post_analysis_t     *function;   /* Associated analysis function */
+  void                   *input;      /* Pointer to optional structure */
+
+  int                     n_fields;   /* Number of monitored fields */
+  int                    *field_ids;  /* Ids of monitored fields */
+
+  cs_gnum_t              *checksum;   /* Checksum of each monitored field
+                                         at its last analysis */
+  bool                   *dirty;      /* Current dirty flag of each
+                                         monitored field */
+
+  int                     n_calls;    /* Number of calls (the first call
+                                         always runs the analysis) */
+
+  const cs_time_step_t   *ts;         /* Time step structure for the
+                                         current call */
+
+} cs_post_analysis_reg_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -384,6 +430,12 @@ static void                       **_cs_post_i_output_tp = NULL;
 static cs_post_time_mesh_dep_output_t  **_cs_post_f_output_mtp = NULL;
 static void                            **_cs_post_i_output_mtp = NULL;
 
+/* Array of registered in-situ analyses */
+
+static int                      _cs_post_n_analyses = 0;
+static int                      _cs_post_n_analyses_max = 0;
+static cs_post_analysis_reg_t  *_cs_post_analyses = NULL;
+
 /* Default directory name */
 
 static const char  _cs_post_dirname[] = "postprocessing";
@@ -1231,6 +1283,11 @@ _predefine_mesh(int        mesh_id,
 
   post_mesh->density = 1.;
 
+  for (j = 0; j < 3; j++) {
+    post_mesh->n_sel_elts[j] = -1;
+    post_mesh->sel_elts[j] = NULL;
+  }
+
   post_mesh->exp_mesh = NULL;
   post_mesh->_exp_mesh = NULL;
 
@@ -1243,6 +1300,10 @@ _predefine_mesh(int        mesh_id,
     post_mesh->mod_flag_min = _cs_post_mod_flag_min;
   post_mesh->mod_flag_max = FVM_WRITER_FIXED_MESH;
 
+  post_mesh->n_tracked_fields = 0;
+  post_mesh->field_checksum = NULL;
+  post_mesh->field_uptodate = NULL;
+
   /* Associate mesh with writers */
 
   post_mesh->n_writers = n_writers;
@@ -1282,9 +1343,16 @@ _free_mesh(int _mesh_id)
   BFT_FREE(post_mesh->writer_id);
   post_mesh->n_writers = 0;
 
+  BFT_FREE(post_mesh->field_checksum);
+  BFT_FREE(post_mesh->field_uptodate);
+  post_mesh->n_tracked_fields = 0;
+
   for (i = 0; i < 5; i++)
     BFT_FREE(post_mesh->criteria[i]);
 
+  for (i = 0; i < 3; i++)
+    BFT_FREE(post_mesh->sel_elts[i]);
+
   BFT_FREE(post_mesh->name);
 
   /* Shift remaining meshes */
@@ -1596,29 +1664,29 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Initialize a volume or surface post-processing mesh based on its
- * selection criteria or selection functions.
+ * Compute the element lists of a volume or surface post-processing mesh
+ * based on its selection criteria or selection functions.
+ *
+ * The returned lists use 1 to n numbering, and are NULL when a full range
+ * is selected; they must be freed by the caller.
  *
  * parameters:
- *   post_mesh <-> pointer to partially initialized post-processing mesh
- *   ts        <-- time step structure
+ *   post_mesh <-> pointer to post-processing mesh
+ *   n_elts    --> number of selected cells, interior, and boundary faces
+ *   elt_list  --> selected cell, interior, and boundary face lists
  *----------------------------------------------------------------------------*/
 
 static void
-_define_regular_mesh(cs_post_mesh_t  *post_mesh)
+_select_mesh_elements(cs_post_mesh_t  *post_mesh,
+                      cs_lnum_t        n_elts[3],
+                      cs_lnum_t       *elt_list[3])
 {
   const cs_mesh_t *mesh = cs_glob_mesh;
 
-  assert(post_mesh != NULL);
-
-  assert(post_mesh->exp_mesh == NULL);
-
   cs_lnum_t i;
   cs_lnum_t n_cells = 0, n_i_faces = 0, n_b_faces = 0;
   cs_lnum_t *cell_list = NULL, *i_face_list = NULL, *b_face_list = NULL;
 
-  /* Define element lists based on selection criteria */
-
   if (post_mesh->criteria[0] != NULL) {
     const char *criteria = post_mesh->criteria[0];
     if (!strcmp(criteria, "all[]"))
@@ -1667,19 +1735,118 @@ _define_regular_mesh(cs_post_mesh_t  *post_mesh)
       b_face_list[i] += 1;
   }
 
+  n_elts[0] = n_cells;
+  n_elts[1] = n_i_faces;
+  n_elts[2] = n_b_faces;
+
+  elt_list[0] = cell_list;
+  elt_list[1] = i_face_list;
+  elt_list[2] = b_face_list;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the element selection of a regular post-processing mesh is
+ * unchanged relative to the one saved at its last (re)definition.
+ *
+ * The check is collective, so the return value is identical on all ranks.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to post-processing mesh
+ *
+ * returns:
+ *   true if the selection is unchanged, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_mesh_selection_unchanged(cs_post_mesh_t  *post_mesh)
+{
+  int j;
+  cs_lnum_t n_elts[3];
+  cs_lnum_t *elt_list[3];
+
+  int same = 1;
+
+  if (   post_mesh->edges_ref > -1
+      || post_mesh->ent_flag[3] != 0
+      || post_mesh->ent_flag[4] != 0
+      || post_mesh->n_sel_elts[0] < 0)
+    return false;
+
+  _select_mesh_elements(post_mesh, n_elts, elt_list);
+
+  for (j = 0; j < 3; j++) {
+    if (n_elts[j] != post_mesh->n_sel_elts[j])
+      same = 0;
+    else if ((elt_list[j] != NULL) != (post_mesh->sel_elts[j] != NULL))
+      same = 0;
+    else if (   elt_list[j] != NULL
+             && memcmp(elt_list[j],
+                       post_mesh->sel_elts[j],
+                       n_elts[j]*sizeof(cs_lnum_t)) != 0)
+      same = 0;
+  }
+
+  for (j = 0; j < 3; j++)
+    BFT_FREE(elt_list[j]);
+
+  cs_parall_min(1, CS_INT_TYPE, &same);
+
+  return (same == 1) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a post-processing mesh based on its selection criteria
+ * or selection functions.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to partially initialized post-processing mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_regular_mesh(cs_post_mesh_t  *post_mesh)
+{
+  int j;
+  cs_lnum_t n_elts[3];
+  cs_lnum_t *elt_list[3];
+
+  assert(post_mesh != NULL);
+
+  assert(post_mesh->exp_mesh == NULL);
+
+  /* Define element lists based on selection criteria */
+
+  _select_mesh_elements(post_mesh, n_elts, elt_list);
+
+  /* For transient-connectivity meshes, save the selection (before it is
+     sorted building the exportable mesh), so later redefinitions may
+     detect an unchanged selection and keep the current mesh */
+
+  if (post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+    for (j = 0; j < 3; j++) {
+      BFT_FREE(post_mesh->sel_elts[j]);
+      post_mesh->n_sel_elts[j] = n_elts[j];
+      if (elt_list[j] != NULL) {
+        BFT_MALLOC(post_mesh->sel_elts[j], n_elts[j], cs_lnum_t);
+        memcpy(post_mesh->sel_elts[j],
+               elt_list[j],
+               n_elts[j]*sizeof(cs_lnum_t));
+      }
+    }
+  }
+
   /* Define mesh based on current arguments */
 
   _define_export_mesh(post_mesh,
-                      n_cells,
-                      n_i_faces,
-                      n_b_faces,
-                      cell_list,
-                      i_face_list,
-                      b_face_list);
-
-  BFT_FREE(cell_list);
-  BFT_FREE(i_face_list);
-  BFT_FREE(b_face_list);
+                      n_elts[0],
+                      n_elts[1],
+                      n_elts[2],
+                      elt_list[0],
+                      elt_list[1],
+                      elt_list[2]);
+
+  BFT_FREE(elt_list[0]);
+  BFT_FREE(elt_list[1]);
+  BFT_FREE(elt_list[2]);
 }
 
 /*----------------------------------------------------------------------------
@@ -1861,8 +2028,16 @@ _redefine_mesh(cs_post_mesh_t        *post_mesh,
   if (post_mesh->exp_mesh != NULL) {
     if (post_mesh->_exp_mesh == NULL)
       return;
-    else
-      post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
+
+    /* If the new selection is identical to the saved one, keep the
+       current exportable mesh rather than re-extracting it; vertex
+       coordinates are shared with the main mesh, so possible
+       deformation is still seen by the writers. */
+
+    if (_mesh_selection_unchanged(post_mesh))
+      return;
+
+    post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
   }
   post_mesh->exp_mesh = NULL;
 
@@ -2977,6 +3152,145 @@ _field_interpolate(void                *input,
                                   point_vals);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if output of a field on a given post-processing mesh may be
+ * skipped, and update the mesh's field checksum tracking.
+ *
+ * A field is skipped when its values have not changed since its last
+ * output, and every writer active at this time step already received
+ * those values; this is only allowed when all active associated writers
+ * use formats accepting fields at a subset of the output time steps.
+ * The checksum is parallel-coherent, so all ranks take the same decision.
+ *
+ * parameters:
+ *   post_mesh <-> pointer to post-processing mesh structure
+ *   f         <-- pointer to field structure
+ *
+ * returns:
+ *   true if output of the field may be skipped, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_output_unchanged_field_skip(cs_post_mesh_t    *post_mesh,
+                             const cs_field_t  *f)
+{
+  int i;
+  int a_mask = 0;
+
+  if (post_mesh->n_writers > (int)(sizeof(int)*8 - 1))
+    return false;
+
+  for (i = 0; i < post_mesh->n_writers; i++) {
+    const cs_post_writer_t  *writer
+      = _cs_post_writers + post_mesh->writer_id[i];
+    if (writer->active == 1) {
+      if (   writer->writer == NULL
+          || fvm_writer_supports_sparse_fields(writer->writer) == 0)
+        return false;
+      a_mask |= (1 << i);
+    }
+  }
+
+  if (a_mask == 0)
+    return false;
+
+  /* Allocate or extend tracking arrays as needed */
+
+  const int n_fields = cs_field_n_fields();
+  if (post_mesh->n_tracked_fields < n_fields) {
+    BFT_REALLOC(post_mesh->field_checksum, n_fields, cs_gnum_t);
+    BFT_REALLOC(post_mesh->field_uptodate, n_fields, int);
+    for (i = post_mesh->n_tracked_fields; i < n_fields; i++) {
+      post_mesh->field_checksum[i] = 0;
+      post_mesh->field_uptodate[i] = 0;
+    }
+    post_mesh->n_tracked_fields = n_fields;
+  }
+
+  cs_gnum_t cks = cs_field_checksum(f);
+
+  if (cks == post_mesh->field_checksum[f->id]) {
+    if ((post_mesh->field_uptodate[f->id] & a_mask) == a_mask)
+      return true;
+    post_mesh->field_uptodate[f->id] |= a_mask;
+  }
+  else {
+    post_mesh->field_checksum[f->id] = cks;
+    post_mesh->field_uptodate[f->id] = a_mask;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Task scheduler wrapper calling a registered in-situ analysis.
+ *
+ * parameters:
+ *   input <-> pointer to analysis registration structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_analysis_task(void  *input)
+{
+  cs_post_analysis_reg_t  *a = input;
+
+  a->function(a->input, a->n_fields, a->field_ids, a->dirty, a->ts);
+}
+
+/*----------------------------------------------------------------------------
+ * Run registered in-situ analyses for the current time step.
+ *
+ * Dirty flags are updated from the parallel-coherent field checksums, so
+ * all ranks take the same decisions; an analysis whose monitored fields
+ * are all unchanged is skipped, except on its first call. Analyses with
+ * no common monitored field may run concurrently, as they are submitted
+ * to the task scheduler with their monitored fields as read dependencies.
+ *
+ * parameters:
+ *   ts <-- time step status structure, or NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_run_analyses(const cs_time_step_t  *ts)
+{
+  int  n_scheduled = 0;
+
+  for (int i = 0; i < _cs_post_n_analyses; i++) {
+
+    cs_post_analysis_reg_t  *a = _cs_post_analyses + i;
+
+    bool  changed = (a->n_calls == 0) ? true : false;
+
+    for (int j = 0; j < a->n_fields; j++) {
+      cs_gnum_t cks = cs_field_checksum(cs_field_by_id(a->field_ids[j]));
+      a->dirty[j] = (cks != a->checksum[j]) ? true : false;
+      a->checksum[j] = cks;
+      if (a->dirty[j])
+        changed = true;
+    }
+
+    a->n_calls += 1;
+
+    if (changed == false)
+      continue;
+
+    a->ts = ts;
+
+    cs_task_scheduler_add("postprocessing analysis",
+                          _analysis_task,
+                          a,
+                          a->n_fields,
+                          a->field_ids,
+                          0,
+                          NULL);
+    n_scheduled += 1;
+
+  }
+
+  if (n_scheduled > 0)
+    cs_task_scheduler_run();
+}
+
 /*----------------------------------------------------------------------------
  * Main post-processing output of variables.
  *
@@ -3047,6 +3361,9 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
       if (! (cs_field_get_key_int(f, vis_key_id) & CS_POST_ON_LOCATION))
         continue;
 
+      if (_output_unchanged_field_skip(post_mesh, f))
+        continue;
+
       name = cs_field_get_key_str(f, label_key_id);
       if (name == NULL)
         name = f->name;
@@ -3116,6 +3433,9 @@ _cs_post_output_fields(cs_post_mesh_t        *post_mesh,
       if (! (cs_field_get_key_int(f, vis_key_id) & CS_POST_MONITOR))
         continue;
 
+      if (_output_unchanged_field_skip(post_mesh, f))
+        continue;
+
       const char *name = cs_field_get_key_str(f, label_key_id);
       if (name == NULL)
         name = f->name;
@@ -3358,6 +3678,23 @@ _check_non_transient(const cs_post_writer_t  *writer,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Flush output data buffered in memory.
+ *
+ * This function is registered as a handler for fatal signals, so that
+ * aggregated (not yet written) time plot and histogram records are
+ * written to disk before the computation exits.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_flush_buffered_output(void)
+{
+  cs_time_plot_flush_all();
+  fvm_to_histogram_flush_all();
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -5673,7 +6010,11 @@ cs_post_write_probe_values(int                              mesh_id,
                n_points*cs_datatype_size[datatype]*var_dim,
                unsigned char);
 
-    if (_interpolate_func != cs_interpolate_from_location_p0) {
+    /* The probe set interpolation operator is persistent and does not
+       use point coordinates, so avoid re-extracting them at each output */
+
+    if (   _interpolate_func != cs_interpolate_from_location_p0
+        && _interpolate_func != cs_probe_set_interpolate) {
       BFT_MALLOC(point_coords, n_points*3, cs_coord_t);
       fvm_nodal_get_vertex_coords(post_mesh->exp_mesh,
                                   CS_INTERLACE,
@@ -5947,6 +6288,11 @@ cs_post_set_changing_connectivity(void)
 void
 cs_post_init_writers(void)
 {
+  /* Flush buffered output in case of fatal signal,
+     so as to minimize data loss */
+
+  cs_base_signal_flush_set(_flush_buffered_output);
+
   /* Ensure default is defined */
 
   if (!cs_post_writer_exists(CS_POST_WRITER_DEFAULT))
@@ -6271,6 +6617,11 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
   int  j;
   bool  active;
 
+  /* Registered in-situ analyses access field values directly,
+     so they do not depend on writer activation */
+
+  _run_analyses(ts);
+
   /* Loop on writers to check if something must be done */
   /*----------------------------------------------------*/
 
@@ -6576,6 +6927,13 @@ cs_post_time_step_end(void)
 void
 cs_post_write_vars(const cs_time_step_t  *ts)
 {
+  /* Let a background I/O thread handle the filesystem side of
+     serialized writes, so only data movement remains on the critical
+     path and output files drain while the next time steps compute */
+
+  int prev_io_thread = cs_file_get_io_thread();
+  cs_file_set_io_thread(1);
+
   /* Output meshes if needed */
 
   _update_meshes(ts);
@@ -6588,6 +6946,7 @@ cs_post_write_vars(const cs_time_step_t  *ts)
 
   cs_post_time_step_end();
 
+  cs_file_set_io_thread(prev_io_thread);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -6690,6 +7049,18 @@ cs_post_finalize(void)
     BFT_FREE(_cs_post_i_output_mtp);
   }
 
+  /* Registered in-situ analyses */
+
+  for (i = 0; i < _cs_post_n_analyses; i++) {
+    cs_post_analysis_reg_t  *a = _cs_post_analyses + i;
+    BFT_FREE(a->field_ids);
+    BFT_FREE(a->checksum);
+    BFT_FREE(a->dirty);
+  }
+  BFT_FREE(_cs_post_analyses);
+  _cs_post_n_analyses = 0;
+  _cs_post_n_analyses_max = 0;
+
   /* Options */
 
   BFT_FREE(_cs_post_default_format_options);
@@ -7070,6 +7441,87 @@ cs_post_add_time_mesh_dep_output(cs_post_time_mesh_dep_output_t  *function,
   _cs_post_n_output_mtp += 1;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Register an in-situ analysis of field values.
+ *
+ * The analysis function is called at each post-processing output time step,
+ * with direct (zero-copy) access to the monitored fields and a dirty flag
+ * per field indicating whether its values have changed since the previous
+ * call; an analysis whose monitored fields are all unchanged is skipped.
+ *
+ * Analyses with no common monitored field may be run concurrently using
+ * the task scheduler, so the registered function must be thread-safe.
+ *
+ * Note: if the input pointer is non-NULL, it must point to valid data
+ * as long as analyses may be run, so that value or structure should
+ * not be temporary (i.e. local).
+ *
+ * \param[in]       function   function to register
+ * \param[in, out]  input      pointer to optional (untyped) value or structure
+ * \param[in]       n_fields   number of monitored fields, or < 1 to monitor
+ *                             all fields defined at registration time
+ * \param[in]       field_ids  ids of monitored fields, or NULL
+ *
+ * \return  id of the registered analysis
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_post_add_analysis(cs_post_analysis_t  *function,
+                     void                *input,
+                     int                  n_fields,
+                     const int            field_ids[])
+{
+  /* Resize array of registered analyses if necessary */
+
+  if (_cs_post_n_analyses >= _cs_post_n_analyses_max) {
+    if (_cs_post_n_analyses_max == 0)
+      _cs_post_n_analyses_max = 8;
+    else
+      _cs_post_n_analyses_max *= 2;
+    BFT_REALLOC(_cs_post_analyses,
+                _cs_post_n_analyses_max,
+                cs_post_analysis_reg_t);
+  }
+
+  /* Add an analysis */
+
+  cs_post_analysis_reg_t  *a = _cs_post_analyses + _cs_post_n_analyses;
+
+  a->function = function;
+  a->input = input;
+
+  if (n_fields > 0)
+    a->n_fields = n_fields;
+  else
+    a->n_fields = cs_field_n_fields();
+
+  a->field_ids = NULL;
+  a->checksum = NULL;
+  a->dirty = NULL;
+
+  BFT_MALLOC(a->field_ids, a->n_fields, int);
+  BFT_MALLOC(a->checksum, a->n_fields, cs_gnum_t);
+  BFT_MALLOC(a->dirty, a->n_fields, bool);
+
+  for (int i = 0; i < a->n_fields; i++) {
+    if (n_fields > 0)
+      a->field_ids[i] = field_ids[i];
+    else
+      a->field_ids[i] = i;
+    a->checksum[i] = 0;
+    a->dirty[i] = false;
+  }
+
+  a->n_calls = 0;
+  a->ts = NULL;
+
+  _cs_post_n_analyses += 1;
+
+  return _cs_post_n_analyses - 1;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -193,6 +193,35 @@ typedef void
                                   const cs_lnum_t        b_face_ids[],
                                   const cs_time_step_t  *ts);
 
+/*----------------------------------------------------------------------------
+ * Function pointer associated with an in-situ analysis of field values.
+ *
+ * Such functions are registered using cs_post_add_analysis(), and all
+ * registered functions are automatically called at each post-processing
+ * output time step.
+ *
+ * Unlike writer-based output, no copy of field values is made: an analysis
+ * accesses the monitored fields directly (using cs_field_by_id() and the
+ * field's "val" array), and must treat those values as read-only.
+ * Analyses with no common monitored field may be run concurrently, so
+ * registered functions must be safe to call from different threads.
+ *
+ * parameters:
+ *   input          <-> pointer to optional (untyped) value or structure.
+ *   n_fields       <-- number of monitored fields
+ *   field_ids      <-- ids of monitored fields
+ *   field_is_dirty <-- for each monitored field, true if its values have
+ *                      changed since the previous analysis call
+ *   ts             <-- time step status structure, or NULL
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_post_analysis_t) (void                  *input,
+                      int                    n_fields,
+                      const int              field_ids[],
+                      const bool             field_is_dirty[],
+                      const cs_time_step_t  *ts);
+
 /*=============================================================================
  * Global variables
  *============================================================================*/
@@ -1365,6 +1394,38 @@ void
 cs_post_add_time_mesh_dep_output(cs_post_time_mesh_dep_output_t  *function,
                                  void                            *input);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Register an in-situ analysis of field values.
+ *
+ * The analysis function is called at each post-processing output time step,
+ * with direct (zero-copy) access to the monitored fields and a dirty flag
+ * per field indicating whether its values have changed since the previous
+ * call; an analysis whose monitored fields are all unchanged is skipped.
+ *
+ * Analyses with no common monitored field may be run concurrently using
+ * the task scheduler, so the registered function must be thread-safe.
+ *
+ * Note: if the input pointer is non-NULL, it must point to valid data
+ * as long as analyses may be run, so that value or structure should
+ * not be temporary (i.e. local).
+ *
+ * \param[in]       function   function to register
+ * \param[in, out]  input      pointer to optional (untyped) value or structure
+ * \param[in]       n_fields   number of monitored fields, or < 1 to monitor
+ *                             all fields defined at registration time
+ * \param[in]       field_ids  ids of monitored fields, or NULL
+ *
+ * \return  id of the registered analysis
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_post_add_analysis(cs_post_analysis_t  *function,
+                     void                *input,
+                     int                  n_fields,
+                     const int            field_ids[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
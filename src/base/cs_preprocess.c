@@ -48,6 +48,7 @@
 #include "cs_boundary_zone.h"
 #include "cs_gui.h"
 #include "cs_gui_mesh.h"
+#include "cs_interface.h"
 #include "cs_internal_coupling.h"
 #include "cs_join.h"
 #include "cs_log.h"
@@ -418,6 +419,10 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   cs_mesh_quantities_dump(cs_glob_mesh, cs_glob_mesh_quantities);
 #endif
 
+  /* Free interface set caches used during preprocessing */
+
+  cs_interface_finalize();
+
   /* Re-enable writers disabled when entering this stage */
 
   cs_post_enable_writer(0);
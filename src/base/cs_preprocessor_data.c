@@ -143,6 +143,14 @@ int _n_mesh_files = 0;
 int _n_max_mesh_files = 0;
 _mesh_file_info_t  *_mesh_file_info = NULL;
 
+/* Parameters for an optional generated mesh, replacing file input
+   (mainly useful for benchmarking without an external mesh file) */
+
+static bool       _gen_mesh_active = false;
+static cs_gnum_t  _gen_mesh_size[3] = {0, 0, 0};
+static double     _gen_mesh_grading[3] = {1., 1., 1.};
+static double     _gen_mesh_perturbation = 0.;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1818,6 +1826,327 @@ _read_data(int                 file_id,
   cs_io_finalize(&pp_in);
 }
 
+/*----------------------------------------------------------------------------
+ * Return a pseudo-random value in [-0.5, 0.5] based on a global number.
+ *
+ * The same (number, variant) couple always maps to the same value,
+ * independently of the number of ranks, so a generated mesh is
+ * reproducible across partitionings.
+ *
+ * parameters:
+ *   gnum    <-- global entity number
+ *   variant <-- independent variant (such as a coordinate direction)
+ *
+ * returns:
+ *   pseudo-random value in [-0.5, 0.5]
+ *----------------------------------------------------------------------------*/
+
+static double
+_gen_mesh_rand(cs_gnum_t  gnum,
+               int        variant)
+{
+  unsigned long long h
+    = (unsigned long long)gnum + 0x9e3779b97f4a7c15ULL*(variant + 1);
+
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+
+  return (double)(h >> 11) * (1./9007199254740992.) - 0.5;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute 1d vertex coordinates for a generated mesh direction.
+ *
+ * Coordinates span [0, 1], with cell sizes in geometric progression
+ * of the given ratio (1 for a uniform spacing).
+ *
+ * parameters:
+ *   n     <-- number of cells in this direction
+ *   ratio <-- geometric progression ratio between successive cell sizes
+ *
+ * returns:
+ *   array of n+1 coordinates (to be freed by caller)
+ *----------------------------------------------------------------------------*/
+
+static double *
+_gen_mesh_coords_1d(cs_gnum_t  n,
+                    double     ratio)
+{
+  double *x = NULL;
+
+  BFT_MALLOC(x, n+1, double);
+
+  x[0] = 0.;
+
+  if (fabs(ratio - 1.) < 1.e-12) {
+    for (cs_gnum_t i = 1; i < n; i++)
+      x[i] = (double)i / (double)n;
+  }
+  else {
+    double l = 0., s = 1.;
+    for (cs_gnum_t i = 0; i < n; i++) {
+      l += s;
+      s *= ratio;
+    }
+    s = 1. / l;  /* first cell size for a total length of 1 */
+    l = 0.;
+    for (cs_gnum_t i = 1; i < n; i++) {
+      l += s;
+      x[i] = l;
+      s *= ratio;
+    }
+  }
+
+  x[n] = 1.;
+
+  return x;
+}
+
+/*----------------------------------------------------------------------------
+ * Define mesh dimensions, group classes, and group names for a
+ * generated hexahedral mesh.
+ *
+ * This replaces the reading of mesh file dimensions.
+ *
+ * parameters:
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_gen_mesh_dimensions(cs_mesh_t          *mesh,
+                     cs_mesh_builder_t  *mb)
+{
+  const cs_gnum_t nx = _gen_mesh_size[0];
+  const cs_gnum_t ny = _gen_mesh_size[1];
+  const cs_gnum_t nz = _gen_mesh_size[2];
+
+  const char *group_names[] = {"X0", "X1", "Y0", "Y1", "Z0", "Z1"};
+  const int n_b_groups = 6;
+
+  mesh->n_g_cells = nx*ny*nz;
+  mesh->n_g_vertices = (nx+1)*(ny+1)*(nz+1);
+
+  mb->n_g_faces = (nx+1)*ny*nz + nx*(ny+1)*nz + nx*ny*(nz+1);
+  mb->n_g_face_connect_size = mb->n_g_faces*4;
+
+  /* One group (and group class) per box side, plus a default
+     group class for cells */
+
+  mesh->n_groups = n_b_groups;
+  BFT_MALLOC(mesh->group_idx, mesh->n_groups + 1, int);
+  mesh->group_idx[0] = 0;
+  for (int i = 0; i < mesh->n_groups; i++)
+    mesh->group_idx[i+1] = mesh->group_idx[i] + strlen(group_names[i]) + 1;
+  BFT_MALLOC(mesh->group, mesh->group_idx[mesh->n_groups], char);
+  for (int i = 0; i < mesh->n_groups; i++)
+    strcpy(mesh->group + mesh->group_idx[i], group_names[i]);
+
+  mesh->n_families = n_b_groups + 1;
+  mesh->n_max_family_items = 1;
+  BFT_MALLOC(mesh->family_item, mesh->n_families, int);
+  for (int i = 0; i < n_b_groups; i++)
+    mesh->family_item[i] = -(i+1);
+  mesh->family_item[n_b_groups] = 0;
+
+  if (cs_glob_rank_id < 1)
+    bft_printf(_(" Generated mesh:            %llu x %llu x %llu cells\n"
+                 "   grading ratios:          %g x %g x %g\n"
+                 "   vertex perturbation:     %g\n\n"),
+               (unsigned long long)nx,
+               (unsigned long long)ny,
+               (unsigned long long)nz,
+               _gen_mesh_grading[0],
+               _gen_mesh_grading[1],
+               _gen_mesh_grading[2],
+               _gen_mesh_perturbation);
+}
+
+/*----------------------------------------------------------------------------
+ * Build mesh data for a generated hexahedral mesh.
+ *
+ * This replaces the reading of mesh file data: each rank builds the
+ * cell, face, and vertex data matching its own block range, in the same
+ * form as data read from a preprocessor output file; partitioning and
+ * distribution then proceed as for read data.
+ *
+ * The mesh is a box of size 1 in each direction, with nx*ny*nz
+ * hexahedral cells; cell sizes in each direction may follow a geometric
+ * progression (anisotropy/grading), and interior vertices may be
+ * perturbed randomly relative to their local spacing.
+ *
+ * Faces are numbered by normal direction (x, then y, then z planes);
+ * each boundary face is assigned a group class matching its box side
+ * (X0/X1/Y0/Y1/Z0/Z1).
+ *
+ * parameters:
+ *   mesh <-> pointer to mesh structure
+ *   mb   <-> pointer to mesh builder structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_gen_mesh_data(cs_mesh_t          *mesh,
+               cs_mesh_builder_t  *mb)
+{
+  const cs_gnum_t nx = _gen_mesh_size[0];
+  const cs_gnum_t ny = _gen_mesh_size[1];
+  const cs_gnum_t nz = _gen_mesh_size[2];
+
+  const cs_gnum_t n_xf = (nx+1)*ny*nz;   /* number of x-normal faces */
+  const cs_gnum_t n_yf = nx*(ny+1)*nz;   /* number of y-normal faces */
+
+  const double perturb = _gen_mesh_perturbation;
+
+  double *coo[3];
+
+  for (int dir = 0; dir < 3; dir++)
+    coo[dir] = _gen_mesh_coords_1d(_gen_mesh_size[dir],
+                                   _gen_mesh_grading[dir]);
+
+  /* Vertices: regular grid position, plus optional perturbation of
+     interior vertices relative to the smaller adjacent spacing */
+
+  {
+    cs_gnum_t b_s = mb->vertex_bi.gnum_range[0];
+    cs_gnum_t b_e = mb->vertex_bi.gnum_range[1];
+    cs_lnum_t n_loc = (b_e > b_s) ? b_e - b_s : 0;
+
+    BFT_MALLOC(mb->vertex_coords, n_loc*3, cs_real_t);
+
+    for (cs_lnum_t l_id = 0; l_id < n_loc; l_id++) {
+
+      cs_gnum_t v = b_s + l_id - 1;
+      cs_gnum_t ijk[3];
+      ijk[0] = v % (nx+1);
+      ijk[1] = (v / (nx+1)) % (ny+1);
+      ijk[2] = v / ((nx+1)*(ny+1));
+
+      for (int dir = 0; dir < 3; dir++) {
+        cs_gnum_t i = ijk[dir];
+        double c = coo[dir][i];
+        if (perturb > 0. && i > 0 && i < _gen_mesh_size[dir]) {
+          double step = CS_MIN(coo[dir][i+1] - coo[dir][i],
+                               coo[dir][i] - coo[dir][i-1]);
+          c += perturb * step * _gen_mesh_rand(b_s + l_id, dir);
+        }
+        mb->vertex_coords[l_id*3 + dir] = c;
+      }
+
+    }
+  }
+
+  /* Cells: all assigned to the default group class */
+
+  {
+    cs_gnum_t b_s = mb->cell_bi.gnum_range[0];
+    cs_gnum_t b_e = mb->cell_bi.gnum_range[1];
+    cs_lnum_t n_loc = (b_e > b_s) ? b_e - b_s : 0;
+
+    BFT_MALLOC(mb->cell_gc_id, n_loc, cs_int_t);
+
+    for (cs_lnum_t l_id = 0; l_id < n_loc; l_id++)
+      mb->cell_gc_id[l_id] = mesh->n_families;
+  }
+
+  /* Faces: cell and vertex adjacency, plus group classes for box sides.
+
+     Face -> cell and face -> vertex orientations match: for a face of
+     normal direction d at plane index i, the adjacent cells are those
+     at positions i-1 and i (0 on the box sides), with the quadrangle
+     oriented so that the normal points towards increasing coordinates. */
+
+  {
+    cs_gnum_t b_s = mb->face_bi.gnum_range[0];
+    cs_gnum_t b_e = mb->face_bi.gnum_range[1];
+    cs_lnum_t n_loc = (b_e > b_s) ? b_e - b_s : 0;
+
+    const cs_gnum_t nxv = nx+1, nyv = ny+1;  /* vertex grid dimensions */
+
+    BFT_MALLOC(mb->face_cells, n_loc*2, cs_gnum_t);
+    BFT_MALLOC(mb->face_gc_id, n_loc, cs_int_t);
+    BFT_MALLOC(mb->face_vertices_idx, n_loc + 1, cs_lnum_t);
+    BFT_MALLOC(mb->face_vertices, n_loc*4, cs_gnum_t);
+
+    mb->face_vertices_idx[0] = 0;
+
+    for (cs_lnum_t l_id = 0; l_id < n_loc; l_id++) {
+
+      cs_gnum_t f = b_s + l_id - 1;
+      cs_gnum_t i, j, k;
+      cs_gnum_t c0 = 0, c1 = 0, v[4];
+      int gc_id = 0;
+
+      if (f < n_xf) {                       /* x-normal face */
+        i = f % (nx+1);
+        j = (f / (nx+1)) % ny;
+        k = f / ((nx+1)*ny);
+        if (i > 0)
+          c0 = 1 + (i-1) + j*nx + k*nx*ny;
+        else
+          gc_id = 1;
+        if (i < nx)
+          c1 = 1 + i + j*nx + k*nx*ny;
+        else
+          gc_id = 2;
+        v[0] = 1 + i +  j   *nxv +  k   *nxv*nyv;
+        v[1] = 1 + i + (j+1)*nxv +  k   *nxv*nyv;
+        v[2] = 1 + i + (j+1)*nxv + (k+1)*nxv*nyv;
+        v[3] = 1 + i +  j   *nxv + (k+1)*nxv*nyv;
+      }
+      else if (f < n_xf + n_yf) {           /* y-normal face */
+        cs_gnum_t _f = f - n_xf;
+        i = _f % nx;
+        j = (_f / nx) % (ny+1);
+        k = _f / (nx*(ny+1));
+        if (j > 0)
+          c0 = 1 + i + (j-1)*nx + k*nx*ny;
+        else
+          gc_id = 3;
+        if (j < ny)
+          c1 = 1 + i + j*nx + k*nx*ny;
+        else
+          gc_id = 4;
+        v[0] = 1 +  i    + j*nxv +  k   *nxv*nyv;
+        v[1] = 1 +  i    + j*nxv + (k+1)*nxv*nyv;
+        v[2] = 1 + (i+1) + j*nxv + (k+1)*nxv*nyv;
+        v[3] = 1 + (i+1) + j*nxv +  k   *nxv*nyv;
+      }
+      else {                                /* z-normal face */
+        cs_gnum_t _f = f - n_xf - n_yf;
+        i = _f % nx;
+        j = (_f / nx) % ny;
+        k = _f / (nx*ny);
+        if (k > 0)
+          c0 = 1 + i + j*nx + (k-1)*nx*ny;
+        else
+          gc_id = 5;
+        if (k < nz)
+          c1 = 1 + i + j*nx + k*nx*ny;
+        else
+          gc_id = 6;
+        v[0] = 1 +  i    +  j   *nxv + k*nxv*nyv;
+        v[1] = 1 + (i+1) +  j   *nxv + k*nxv*nyv;
+        v[2] = 1 + (i+1) + (j+1)*nxv + k*nxv*nyv;
+        v[3] = 1 +  i    + (j+1)*nxv + k*nxv*nyv;
+      }
+
+      mb->face_cells[l_id*2] = c0;
+      mb->face_cells[l_id*2 + 1] = c1;
+      mb->face_gc_id[l_id] = gc_id;
+      mb->face_vertices_idx[l_id + 1] = (l_id + 1)*4;
+      for (int n = 0; n < 4; n++)
+        mb->face_vertices[l_id*4 + n] = v[n];
+
+    }
+  }
+
+  for (int dir = 0; dir < 3; dir++)
+    BFT_FREE(coo[dir]);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1980,6 +2309,52 @@ cs_preprocessor_data_add_file(const char     *file_name,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Define a generated hexahedral mesh, replacing file input.
+ *
+ * The mesh is a box of unit length in each direction, filled with a
+ * structured grid of n_cells[0] x n_cells[1] x n_cells[2] hexahedra;
+ * cell sizes in each direction may follow a geometric progression of
+ * the given ratio (anisotropy), and interior vertices may be perturbed
+ * randomly relative to the local spacing, so as to obtain less regular
+ * face and cell quantities.
+ *
+ * Each side of the box is assigned a boundary group, named X0, X1, Y0,
+ * Y1, Z0, or Z1 based on its normal direction and position.
+ *
+ * This is mainly intended for benchmarking, so that operator performance
+ * may be measured on meshes of chosen size and regularity without
+ * requiring an external mesh file.
+ *
+ * parameters:
+ *   n_cells      <-- number of cells in each direction
+ *   grading      <-- cell size progression ratio in each direction
+ *                    (1 for uniform spacing; ignored if <= 0)
+ *   perturbation <-- relative perturbation of interior vertex positions
+ *                    (0 for a regular grid)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_add_generated_hex_mesh(const cs_gnum_t  n_cells[3],
+                                            const double     grading[3],
+                                            double           perturbation)
+{
+  for (int i = 0; i < 3; i++) {
+    if (n_cells[i] < 1)
+      bft_error(__FILE__, __LINE__, 0,
+                _("The number of cells per direction of a generated mesh\n"
+                  "must be at least 1 (here %llu in direction %d)."),
+                (unsigned long long)(n_cells[i]), i);
+    _gen_mesh_size[i] = n_cells[i];
+    _gen_mesh_grading[i] = (grading != NULL && grading[i] > 0.)
+                             ? grading[i] : 1.;
+  }
+
+  _gen_mesh_perturbation = CS_MAX(perturbation, 0.);
+
+  _gen_mesh_active = true;
+}
+
 /*----------------------------------------------------------------------------
  * Check for periodicity information in mesh meta-data.
  *
@@ -1997,6 +2372,11 @@ cs_preprocessor_check_perio(void)
 
   int perio_flag = 0;
 
+  /* A generated mesh has no periodicity */
+
+  if (_gen_mesh_active)
+    return 0;
+
   /* Initialize reading of Preprocessor output */
 
   _set_default_input_if_needed();
@@ -2036,19 +2416,26 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
   _mesh_reader_t *mr = NULL;
 
-  /* Initialize reading of Preprocessor output */
+  if (_gen_mesh_active)
+    _gen_mesh_dimensions(mesh, mesh_builder);
 
-  _set_default_input_if_needed();
+  else {
 
-  _cs_glob_mesh_reader = _mesh_reader_create(&_n_mesh_files,
-                                             &_mesh_file_info);
+    /* Initialize reading of Preprocessor output */
 
-  _n_max_mesh_files = 0;
+    _set_default_input_if_needed();
 
-  mr = _cs_glob_mesh_reader;
+    _cs_glob_mesh_reader = _mesh_reader_create(&_n_mesh_files,
+                                               &_mesh_file_info);
 
-  for (file_id = 0; file_id < mr->n_files; file_id++)
-    _read_dimensions(mesh, mesh_builder, mr, file_id);
+    _n_max_mesh_files = 0;
+
+    mr = _cs_glob_mesh_reader;
+
+    for (file_id = 0; file_id < mr->n_files; file_id++)
+      _read_dimensions(mesh, mesh_builder, mr, file_id);
+
+  }
 
   /* Return values */
 
@@ -2103,6 +2490,25 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
 
   bool pre_partitioned = false;
 
+  /* Generated mesh: build block data directly, then partition and
+     distribute it as if it had been read */
+
+  if (_gen_mesh_active) {
+
+    _set_block_ranges(mesh, mesh_builder);
+    _gen_mesh_data(mesh, mesh_builder);
+
+    cs_partition(mesh, mesh_builder, partition_stage);
+
+    bft_printf("\n");
+
+    cs_mesh_from_builder(mesh, mesh_builder);
+
+    cs_mesh_clean_families(mesh);
+
+    return;
+  }
+
   /* Check for existing partitioning and cell block info (set by
      cs_mesh_to_builder_partition and valid if the global number of
      cells has not changed), in which case the existing
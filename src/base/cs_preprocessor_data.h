@@ -75,6 +75,11 @@ CS_PROCF(ledevi, LEDEVI)(cs_int_t  *iperio,
  * The first time this function is called,  this default is overriden by the
  * defined file, and all subsequent calls define additional meshes to read.
  *
+ * As the file name may be any path, a file staged on node-local or burst
+ * buffer storage by the run script may be given here (for example from
+ * cs_user_mesh_input), avoiding a parallel filesystem round trip when
+ * iterating on mesh studies.
+ *
  * parameters:
  *   file_name       <-- name of file to read
  *   n_group_renames <-- number of groups to rename
@@ -89,6 +94,33 @@ cs_preprocessor_data_add_file(const char     *file_name,
                               const char    **group_rename,
                               const double    transf_matrix[3][4]);
 
+/*----------------------------------------------------------------------------
+ * Define a generated hexahedral mesh, replacing file input.
+ *
+ * The mesh is a box of unit length in each direction, filled with a
+ * structured grid of n_cells[0] x n_cells[1] x n_cells[2] hexahedra;
+ * cell sizes in each direction may follow a geometric progression of
+ * the given ratio (anisotropy), and interior vertices may be perturbed
+ * randomly relative to the local spacing. Each side of the box is
+ * assigned a boundary group (X0, X1, Y0, Y1, Z0, or Z1).
+ *
+ * This is mainly intended for benchmarking, so that operator performance
+ * may be measured on meshes of chosen size and regularity without
+ * requiring an external mesh file.
+ *
+ * parameters:
+ *   n_cells      <-- number of cells in each direction
+ *   grading      <-- cell size progression ratio in each direction
+ *                    (1 for uniform spacing; ignored if <= 0)
+ *   perturbation <-- relative perturbation of interior vertex positions
+ *                    (0 for a regular grid)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_add_generated_hex_mesh(const cs_gnum_t  n_cells[3],
+                                            const double     grading[3],
+                                            double           perturbation);
+
 /*----------------------------------------------------------------------------
  * Check for periodicity information in mesh meta-data.
  *
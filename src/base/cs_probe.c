@@ -47,6 +47,7 @@
 #include "fvm_point_location.h"
 
 #include "cs_base.h"
+#include "cs_interpolate.h"
 #include "cs_map.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
@@ -137,6 +138,13 @@ struct _cs_probe_set_t {
 
   char         *located;        /* 1 for located probes, 0 for unlocated */
 
+  /* Persistent interpolation operator (CSR storage); built lazily after
+     each (re)location, so it is built only once for static meshes */
+
+  cs_lnum_t    *interp_idx;     /* NULL or index on local probes */
+  cs_lnum_t    *interp_cell_ids;/* cell ids of the interpolation stencils */
+  cs_real_t    *interp_weights; /* weights of the interpolation stencils */
+
   /* User-defined writers associated to this set of probes */
 
   int           n_writers;      /* Number of writers (-1 if unset) */
@@ -258,6 +266,143 @@ _copy_label(const char  *name)
   return label;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the persistent interpolation operator for a set of probes
+ *         located on cells.
+ *
+ * For each probe located on the local domain, the stencil combines the
+ * matching cell and its face-adjacent neighbors (restricted to local cells
+ * so that no halo synchronization is required), with inverse-distance
+ * weights relative to the cell centers. A probe snapped to a cell center
+ * collapses to the matching cell only, so the operator then matches a P0
+ * interpolation.
+ *
+ * \param[in, out]  pset          pointer to a cs_probe_set_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_cell_interpolation(cs_probe_set_t   *pset)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t  n_cells = m->n_cells;
+  const cs_lnum_t  n_loc_probes = pset->n_loc_probes;
+
+  /* Chain probes sharing a cell so that a single sweep on interior faces
+     suffices to collect all neighbor contributions */
+
+  cs_lnum_t  *head = NULL, *next = NULL;
+  BFT_MALLOC(head, n_cells, cs_lnum_t);
+  BFT_MALLOC(next, n_loc_probes, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    head[c_id] = -1;
+
+  for (cs_lnum_t i = 0; i < n_loc_probes; i++) {
+    next[i] = -1;
+    cs_lnum_t  e_id = pset->elt_id[i];
+    if (e_id > -1) {
+      next[i] = head[e_id];
+      head[e_id] = i;
+    }
+  }
+
+  /* Count stencil sizes */
+
+  BFT_REALLOC(pset->interp_idx, n_loc_probes + 1, cs_lnum_t);
+  cs_lnum_t  *idx = pset->interp_idx;
+
+  for (cs_lnum_t i = 0; i < n_loc_probes + 1; i++)
+    idx[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_loc_probes; i++)
+    if (pset->elt_id[i] > -1)
+      idx[i+1] = 1;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    const cs_lnum_t  c0 = m->i_face_cells[f_id][0];
+    const cs_lnum_t  c1 = m->i_face_cells[f_id][1];
+    if (c0 < n_cells && c1 < n_cells) {
+      for (cs_lnum_t i = head[c0]; i > -1; i = next[i])
+        idx[i+1] += 1;
+      for (cs_lnum_t i = head[c1]; i > -1; i = next[i])
+        idx[i+1] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_loc_probes; i++)
+    idx[i+1] += idx[i];
+
+  /* Fill the stencils: matching cell first, then its neighbors */
+
+  BFT_REALLOC(pset->interp_cell_ids, idx[n_loc_probes], cs_lnum_t);
+  BFT_REALLOC(pset->interp_weights, idx[n_loc_probes], cs_real_t);
+
+  cs_lnum_t  *cell_ids = pset->interp_cell_ids;
+  cs_lnum_t  *shift = NULL;
+  BFT_MALLOC(shift, n_loc_probes, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_loc_probes; i++) {
+    shift[i] = idx[i];
+    if (pset->elt_id[i] > -1)
+      cell_ids[shift[i]++] = pset->elt_id[i];
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    const cs_lnum_t  c0 = m->i_face_cells[f_id][0];
+    const cs_lnum_t  c1 = m->i_face_cells[f_id][1];
+    if (c0 < n_cells && c1 < n_cells) {
+      for (cs_lnum_t i = head[c0]; i > -1; i = next[i])
+        cell_ids[shift[i]++] = c1;
+      for (cs_lnum_t i = head[c1]; i > -1; i = next[i])
+        cell_ids[shift[i]++] = c0;
+    }
+  }
+
+  BFT_FREE(shift);
+  BFT_FREE(next);
+  BFT_FREE(head);
+
+  /* Compute inverse-distance weights relative to the cell centers */
+
+  cs_real_t  *weights = pset->interp_weights;
+
+  for (cs_lnum_t i = 0; i < n_loc_probes; i++) {
+
+    const cs_real_t  *xp = pset->coords[pset->loc_id[i]];
+
+    double  wsum = 0.;
+    cs_lnum_t  s_id = idx[i], e_id = idx[i+1];
+
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+
+      const cs_real_t  *xc = mq->cell_cen + 3*cell_ids[j];
+      const cs_real_t  d = cs_math_3_distance(xp, xc);
+
+      if (d < 1e-30) { /* Probe snapped to this cell center */
+        for (cs_lnum_t k = s_id; k < e_id; k++)
+          weights[k] = 0.;
+        weights[j] = 1.;
+        wsum = 1.;
+        break;
+      }
+
+      weights[j] = 1./d;
+      wsum += weights[j];
+
+    }
+
+    if (wsum > 0.) {
+      const double  iws = 1./wsum;
+      for (cs_lnum_t j = s_id; j < e_id; j++)
+        weights[j] *= iws;
+    }
+
+  } /* Loop on local probes */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Free a cs_probe_set_t structure
@@ -279,6 +424,9 @@ _probe_set_free(cs_probe_set_t   *pset)
   BFT_FREE(pset->elt_id);
   BFT_FREE(pset->vtx_id);
   BFT_FREE(pset->located);
+  BFT_FREE(pset->interp_idx);
+  BFT_FREE(pset->interp_cell_ids);
+  BFT_FREE(pset->interp_weights);
 
   if (pset->labels != NULL) {
     for (int i = 0; i < pset->n_probes; i++)
@@ -360,6 +508,10 @@ _probe_set_create(const char    *name,
   pset->vtx_id = NULL;
   pset->located = NULL;
 
+  pset->interp_idx = NULL;
+  pset->interp_cell_ids = NULL;
+  pset->interp_weights = NULL;
+
   pset->n_writers = -1;
   pset->writer_ids = NULL;
 
@@ -1285,6 +1437,13 @@ cs_probe_set_locate(cs_probe_set_t     *pset,
   }
 
   assert(n_loc_probes == pset->n_loc_probes);
+
+  /* Invalidate the persistent interpolation operator; it will be rebuilt
+     lazily at the next interpolation request */
+
+  BFT_FREE(pset->interp_idx);
+  BFT_FREE(pset->interp_cell_ids);
+  BFT_FREE(pset->interp_weights);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1663,6 +1822,90 @@ cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Interpolate values defined on cells at the probes of a given set
+ *         using the persistent interpolation operator of that set.
+ *
+ * The operator is built at the first call following a (re)location of the
+ * probe set, so for static meshes, the location and weight computations are
+ * done only once for the whole computation. The stencil of a probe combines
+ * the matching cell and its face-adjacent neighbors with inverse-distance
+ * weights, and reduces to the matching cell when the probe is snapped to
+ * a cell center.
+ *
+ * This function matches the \ref cs_interpolate_from_location_t signature,
+ * so it may be passed directly to \ref cs_post_write_probe_values with the
+ * probe set as interpolation input. For probe sets located on the boundary
+ * or non-floating-point values, it falls back to a P0 interpolation.
+ *
+ * \param[in, out]  input           pointer to a cs_probe_set_t structure
+ * \param[in]       datatype        associated datatype
+ * \param[in]       val_dim         dimension of data values
+ * \param[in]       n_points        number of interpolation points
+ * \param[in]       point_location  location of points in mesh elements
+ * \param[in]       point_coords    point coordinates
+ * \param[in]       location_vals   values at mesh location
+ * \param[out]      point_vals      interpolated values at points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_set_interpolate(void                *input,
+                         cs_datatype_t        datatype,
+                         int                  val_dim,
+                         cs_lnum_t            n_points,
+                         const cs_lnum_t      point_location[],
+                         const cs_real_3_t    point_coords[],
+                         const void          *location_vals,
+                         void                *point_vals)
+{
+  cs_probe_set_t  *pset = input;
+
+  bool on_boundary = (pset != NULL && (pset->flags & CS_PROBE_BOUNDARY)) ?
+    true : false;
+
+  if (pset == NULL || on_boundary || datatype != CS_DOUBLE) {
+    cs_interpolate_from_location_p0(NULL,
+                                    datatype,
+                                    val_dim,
+                                    n_points,
+                                    point_location,
+                                    point_coords,
+                                    location_vals,
+                                    point_vals);
+    return;
+  }
+
+  assert(n_points == pset->n_loc_probes);
+
+  /* Build the operator if not available (first call after a location) */
+
+  if (pset->interp_idx == NULL)
+    _build_cell_interpolation(pset);
+
+  const cs_lnum_t  *idx = pset->interp_idx;
+  const cs_lnum_t  *cell_ids = pset->interp_cell_ids;
+  const cs_real_t  *weights = pset->interp_weights;
+  const cs_real_t  *c_vals = (const cs_real_t *)location_vals;
+
+  cs_real_t  *p_vals = point_vals;
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+
+    for (cs_lnum_t k = 0; k < val_dim; k++)
+      p_vals[i*val_dim + k] = 0.;
+
+    for (cs_lnum_t j = idx[i]; j < idx[i+1]; j++) {
+      const cs_real_t  w = weights[j];
+      const cs_real_t  *cv = c_vals + val_dim*cell_ids[j];
+      for (cs_lnum_t k = 0; k < val_dim; k++)
+        p_vals[i*val_dim + k] += w*cv[k];
+    }
+
+  } /* Loop on probes */
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -495,6 +495,44 @@ const cs_lnum_t *
 cs_probe_set_get_elt_ids(const cs_probe_set_t  *pset,
                          int                    mesh_location_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Interpolate values defined on cells at the probes of a given set
+ *         using the persistent interpolation operator of that set.
+ *
+ * The operator is built at the first call following a (re)location of the
+ * probe set, so for static meshes, the location and weight computations are
+ * done only once for the whole computation. The stencil of a probe combines
+ * the matching cell and its face-adjacent neighbors with inverse-distance
+ * weights, and reduces to the matching cell when the probe is snapped to
+ * a cell center.
+ *
+ * This function matches the \ref cs_interpolate_from_location_t signature,
+ * so it may be passed directly to \ref cs_post_write_probe_values with the
+ * probe set as interpolation input. For probe sets located on the boundary
+ * or non-floating-point values, it falls back to a P0 interpolation.
+ *
+ * \param[in, out]  input           pointer to a cs_probe_set_t structure
+ * \param[in]       datatype        associated datatype
+ * \param[in]       val_dim         dimension of data values
+ * \param[in]       n_points        number of interpolation points
+ * \param[in]       point_location  location of points in mesh elements
+ * \param[in]       point_coords    point coordinates
+ * \param[in]       location_vals   values at mesh location
+ * \param[out]      point_vals      interpolated values at points
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_probe_set_interpolate(void                *input,
+                         cs_datatype_t        datatype,
+                         int                  val_dim,
+                         cs_lnum_t            n_points,
+                         const cs_lnum_t      point_location[],
+                         const cs_real_3_t    point_coords[],
+                         const void          *location_vals,
+                         void                *point_vals);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -68,6 +68,14 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Multiplication and Weyl constants for the Philox-4x32-10
+   counter-based generator (Salmon et al., SC'11) */
+
+#define _PHILOX_M0  0xD2511F53u
+#define _PHILOX_M1  0xCD9E8D57u
+#define _PHILOX_W0  0x9E3779B9u
+#define _PHILOX_W1  0xBB67AE85u
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -90,6 +98,11 @@ static struct {
   double   e_3;
 } klotz1_1 = {{0}, 0, 0, 0.};
 
+/* Key of the counter-based generator; mixed with the seed
+   in cs_random_seed */
+
+static uint32_t _cbrng_key[2] = {1802u, 9373u};
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -146,6 +159,44 @@ _random_uniform_restore(cs_real_t  save_block[608])
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox-4x32 keyed bijection, 10 rounds.
+ *
+ * Maps a 128-bit counter to 128 pseudo-random bits under a 64-bit key;
+ * the function is pure, so distinct counters may be evaluated in any
+ * order (or concurrently) and always yield the same values.
+ *
+ * \param[in]   key  generator key (2 x 32 bits)
+ * \param[in]   ctr  counter (4 x 32 bits)
+ * \param[out]  r    pseudo-random output (4 x 32 bits)
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_philox4x32(const uint32_t  key[2],
+            const uint32_t  ctr[4],
+            uint32_t        r[4])
+{
+  uint32_t k0 = key[0], k1 = key[1];
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+
+  for (int round = 0; round < 10; round++) {
+    uint64_t p0 = (uint64_t)_PHILOX_M0 * c0;
+    uint64_t p1 = (uint64_t)_PHILOX_M1 * c2;
+    uint32_t hi0 = (uint32_t)(p0 >> 32), lo0 = (uint32_t)p0;
+    uint32_t hi1 = (uint32_t)(p1 >> 32), lo1 = (uint32_t)p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += _PHILOX_W0;
+    k1 += _PHILOX_W1;
+  }
+
+  r[0] = c0; r[1] = c1; r[2] = c2; r[3] = c3;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Internal function for Box_Muller normal distribution.
@@ -202,6 +253,11 @@ cs_random_seed(int  seed)
   if (seed > 0)
     ij = seed % 31328;
 
+  /* Key the counter-based generator on the same seed */
+
+  _cbrng_key[0] = (uint32_t)ij;
+  _cbrng_key[1] = (uint32_t)kl;
+
   int i = ij / 177 % 177 + 2;
   int j = ij % 177 + 2;
   int k = kl / 169 % 178 + 1;
@@ -447,6 +503,56 @@ L1:
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Philox-4x32-10 counter-based generator with Box-Muller transform.
+ * Unlike \ref cs_random_normal, this generator carries no internal
+ * state: value i depends only on keys[i] and on the seed set through
+ * \ref cs_random_seed, so a draw keyed on a stable id (for example a
+ * global particle number combined with the time step) is reproducible
+ * independently of call order, batch boundaries, or the number of
+ * values drawn elsewhere; the loop over keys also vectorizes.
+ *
+ * \param[in]   n     number of values to compute
+ * \param[in]   keys  key associated with each value (for example built
+ *                    from an element id and the time step)
+ * \param[out]  x     pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_normal_n(cs_lnum_t        n,
+                   const cs_gnum_t  keys[],
+                   cs_real_t        x[])
+{
+  const double twopi = 6.2831853071795862;
+  const double two_pow_m64 = 5.421010862427522e-20;  /* 2^-64 */
+
+# pragma omp simd
+  for (cs_lnum_t i = 0; i < n; i++) {
+
+    uint32_t ctr[4], r[4];
+
+    ctr[0] = (uint32_t)(keys[i]);
+    ctr[1] = (uint32_t)(keys[i] >> 32);
+    ctr[2] = 0;
+    ctr[3] = 0;
+
+    _philox4x32(_cbrng_key, ctr, r);
+
+    /* Map two 64-bit words to uniforms in (0,1); the 0.5 offset
+       keeps the log argument away from 0 */
+
+    double u1 = (((uint64_t)r[0] << 32 | r[1]) + 0.5) * two_pow_m64;
+    double u2 = (((uint64_t)r[2] << 32 | r[3]) + 0.5) * two_pow_m64;
+
+    x[i] = sqrt(-2.*log(u1)) * cos(twopi*u2);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Poisson distribution random number generator.
@@ -103,6 +103,30 @@ void
 cs_random_normal(cs_lnum_t  n,
                  cs_real_t  x[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based normal distribution random number generator.
+ *
+ * Philox-4x32-10 counter-based generator with Box-Muller transform.
+ * Unlike \ref cs_random_normal, this generator carries no internal
+ * state: value i depends only on keys[i] and on the seed set through
+ * \ref cs_random_seed, so a draw keyed on a stable id (for example a
+ * global particle number combined with the time step) is reproducible
+ * independently of call order, batch boundaries, or the number of
+ * values drawn elsewhere; the loop over keys also vectorizes.
+ *
+ * \param[in]   n     number of values to compute
+ * \param[in]   keys  key associated with each value (for example built
+ *                    from an element id and the time step)
+ * \param[out]  x     pseudo-random numbers following normal distribution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_normal_n(cs_lnum_t        n,
+                   const cs_gnum_t  keys[],
+                   cs_real_t        x[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Poisson distribution random number generator.
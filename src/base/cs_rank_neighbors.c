@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -939,6 +940,101 @@ cs_rank_neighbors_sync_count(const cs_rank_neighbors_t   *n_send,
   _rank_neighbors_calls[2] += 1;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a communicator whose ranks are reordered to match the
+ *        node and network topology, based on a rank neighborhood and
+ *        associated exchange weights.
+ *
+ * Each rank declares weighted edges towards its neighbors (for example
+ * using halo or exchange sizes as weights) in a distributed graph
+ * communicator with reordering allowed, so the MPI library may remap
+ * ranks such that heavily communicating ranks are placed close to each
+ * other (on the same node when possible), independently of scheduler
+ * placement.
+ *
+ * As rank ids may differ between the initial and reordered communicators,
+ * this is only useful as a startup phase, before data is read or
+ * distributed based on rank ids; data distributed using the initial
+ * communicator's rank ids would otherwise need to be migrated.
+ *
+ * The caller is responsible for freeing the returned communicator
+ * (using MPI_Comm_free) when it is no longer needed.
+ *
+ * \param[in]   n               pointer to rank neighborhood
+ * \param[in]   weight          exchange weight for each neighbor
+ *                              (same ordering as n->rank), or NULL for
+ *                              uniform weights
+ * \param[in]   comm            associated communicator
+ * \param[out]  reordered_comm  communicator with reordered ranks
+ *
+ * \return  true if the local rank id in the reordered communicator
+ *          differs from that in the initial communicator on at least
+ *          one rank, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_rank_neighbors_topology_reorder(const cs_rank_neighbors_t  *n,
+                                   const cs_lnum_t             weight[],
+                                   MPI_Comm                    comm,
+                                   MPI_Comm                   *reordered_comm)
+{
+  int i, rank, new_rank;
+  int sources[1], degrees[1];
+  int *weights = NULL;
+  int rank_changed[2] = {0, 0};
+
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  /* Initialize timers if required */
+
+  if (_rank_neighbors_calls[0] == 0)
+    CS_TIMER_COUNTER_INIT(_rank_neighbors_timer[0]);
+
+  MPI_Comm_rank(comm, &rank);
+
+  /* Edge weights must be positive integers; a zero weight could lead
+     the library to ignore the edge altogether */
+
+  BFT_MALLOC(weights, CS_MAX(n->size, 1), int);
+
+  for (i = 0; i < n->size; i++) {
+    long long w = (weight != NULL) ? (long long)(weight[i]) : 1;
+    if (w < 1)
+      w = 1;
+    else if (w > INT_MAX)
+      w = INT_MAX;
+    weights[i] = w;
+  }
+
+  sources[0] = rank;
+  degrees[0] = n->size;
+
+  MPI_Dist_graph_create(comm,
+                        1, sources, degrees, n->rank, weights,
+                        MPI_INFO_NULL,
+                        1, /* allow reordering */
+                        reordered_comm);
+
+  BFT_FREE(weights);
+
+  MPI_Comm_rank(*reordered_comm, &new_rank);
+
+  rank_changed[0] = (new_rank != rank) ? 1 : 0;
+  MPI_Allreduce(rank_changed, rank_changed + 1, 1, MPI_INT, MPI_MAX, comm);
+
+  /* timing */
+
+  t1 = cs_timer_time();
+  cs_timer_counter_add_diff(_rank_neighbors_timer, &t0, &t1);
+  _rank_neighbors_calls[0] += 1;
+
+  return (rank_changed[1] > 0) ? true : false;
+}
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
@@ -191,6 +191,46 @@ cs_rank_neighbors_sync_count(const cs_rank_neighbors_t   *n_send,
                              cs_lnum_t                  **recv_count,
                              MPI_Comm                     comm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a communicator whose ranks are reordered to match the
+ *        node and network topology, based on a rank neighborhood and
+ *        associated exchange weights.
+ *
+ * Each rank declares weighted edges towards its neighbors (for example
+ * using halo or exchange sizes as weights) in a distributed graph
+ * communicator with reordering allowed, so the MPI library may remap
+ * ranks such that heavily communicating ranks are placed close to each
+ * other (on the same node when possible), independently of scheduler
+ * placement.
+ *
+ * As rank ids may differ between the initial and reordered communicators,
+ * this is only useful as a startup phase, before data is read or
+ * distributed based on rank ids; data distributed using the initial
+ * communicator's rank ids would otherwise need to be migrated.
+ *
+ * The caller is responsible for freeing the returned communicator
+ * (using MPI_Comm_free) when it is no longer needed.
+ *
+ * \param[in]   n               pointer to rank neighborhood
+ * \param[in]   weight          exchange weight for each neighbor
+ *                              (same ordering as n->rank), or NULL for
+ *                              uniform weights
+ * \param[in]   comm            associated communicator
+ * \param[out]  reordered_comm  communicator with reordered ranks
+ *
+ * \return  true if the local rank id in the reordered communicator
+ *          differs from that in the initial communicator on at least
+ *          one rank, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_rank_neighbors_topology_reorder(const cs_rank_neighbors_t  *n,
+                                   const cs_lnum_t             weight[],
+                                   MPI_Comm                    comm,
+                                   MPI_Comm                   *reordered_comm);
+
 #endif /* defined(HAVE_MPI) */
 
 /*----------------------------------------------------------------------------*/
@@ -151,6 +151,12 @@ BEGIN_C_DECLS
        Use multipass face numbering.
        This should produce a smaller number of blocks, with a diminishing
        number of faces per thread group.
+  \var CS_RENUMBER_I_FACES_CELL_BLOCKS
+       Partition cells (in their current, locality-optimized order) into
+       one contiguous block per thread; faces interior to a block are
+       processed by the matching thread with no synchronization, and the
+       smaller set of inter-block faces is distributed over additional
+       groups using an edge coloring of the block adjacency graph.
   \var CS_RENUMBER_I_FACES_SIMD
        Renumber to allow SIMD operations in interior face->cell gather
        operations (such as SpMV products with native matrix representation).
@@ -258,6 +264,7 @@ static const char *_cell_renum_name[]
 static const char *_i_face_renum_name[]
   = {N_("coloring, no shared cell in block"),
      N_("multipass"),
+     N_("contiguous cell blocks"),
      N_("vectorizing"),
      N_("adjacent cells")};
 
@@ -1583,6 +1590,16 @@ _renumber_b_faces_by_cell_adjacency(cs_mesh_t  *mesh)
 /*----------------------------------------------------------------------------
  * Build groups including independent faces.
  *
+ * Each face is assigned to the smallest (not full) group in which neither
+ * of its adjacent cells already appears, so group sizes remain balanced;
+ * uniform group sizes lead to more regular blocks for SIMD operations
+ * than filling each group completely before starting the next one.
+ *
+ * Since each group contains at most one face adjacent to a given cell,
+ * the groups a cell appears in may be tracked using a list whose size is
+ * bounded by the number of faces adjacent to that cell, allowing constant
+ * time (relative to group size) conflict checks.
+ *
  * parameters:
  *   max_group_size  <-- max group size
  *   n_faces         <-- number of faces
@@ -1603,105 +1620,144 @@ _independent_face_groups(cs_lnum_t            max_group_size,
                          cs_lnum_t           *n_groups,
                          cs_lnum_t          **group_size)
 {
-  cs_lnum_t f_id, i, j, k;
-  cs_lnum_t *group_face_ids = NULL, *face_marker = NULL;
-  cs_lnum_t *old_to_new = NULL;
+  cs_lnum_t f_id, i, j;
+  cs_lnum_t *face_group = NULL, *old_to_new = NULL;
+  cs_lnum_t *cell_groups = NULL, *n_cell_groups = NULL, *group_last_face;
 
-  cs_lnum_t first_unmarked_face_id = 0;
   cs_lnum_t _n_groups_max = 4;
-  cs_lnum_t n_marked_faces = 0;
-  cs_lnum_t group_id = 0;
+  cs_lnum_t n_groups_cur = 0;
 
   cs_lnum_t *_group_size = NULL;
 
   BFT_MALLOC(_group_size, _n_groups_max, cs_lnum_t);
+  BFT_MALLOC(group_last_face, _n_groups_max, cs_lnum_t);
 
   BFT_MALLOC(old_to_new, n_faces, cs_lnum_t);
-  BFT_MALLOC(face_marker, n_faces, cs_lnum_t);
-  BFT_MALLOC(group_face_ids, max_group_size, cs_lnum_t);
+  BFT_MALLOC(face_group, n_faces, cs_lnum_t);
 
-  /* Create CSR cells -> faces graph */
+  /* Create CSR cells -> faces graph, whose index bounds the number of
+     groups each cell may appear in */
 
   cs_adjacency_t *cell_faces = _c2f_from_face_cell(n_cells_ext,
                                                    n_faces,
                                                    face_cell);
 
-  /* mark cell in a group */
+  BFT_MALLOC(cell_groups, cell_faces->idx[n_cells_ext], cs_lnum_t);
+  BFT_MALLOC(n_cell_groups, n_cells_ext, cs_lnum_t);
 
-  for (f_id = 0; f_id < n_faces; f_id++) {
-    face_marker[f_id] = -1;
-    old_to_new[f_id] = f_id;
-  }
+  /* Assign each face to the smallest compatible group; a second pass
+     with the group size limit lowered to the mean size obtained on the
+     first pass makes group sizes nearly uniform */
+
+  cs_lnum_t _max_group_size = max_group_size;
+  cs_lnum_t n_groups_target = n_faces + 1;
 
-  while (n_marked_faces != n_faces) {
+  for (int pass = 0; pass < 2; pass++) {
 
-    cs_lnum_t  g_size = 0;
+    n_groups_cur = 0;
 
-    /* Start a new group */
+    for (i = 0; i < n_cells_ext; i++)
+      n_cell_groups[i] = 0;
 
-    for (f_id = 0; f_id < max_group_size; f_id++)
-      group_face_ids[f_id] = -1;
+    for (f_id = 0; f_id < n_faces; f_id++) {
 
-    for (f_id = first_unmarked_face_id; f_id < n_faces; f_id++) {
+      cs_lnum_t c_id[2] = {face_cell[f_id][0], face_cell[f_id][1]};
+      cs_lnum_t group_id = -1;
 
-      /* Search for next free face and check if it can be added
-         in the current group */
+      /* Mark groups already containing a face adjacent to either cell
+         (stamping with the current face id avoids resetting markers) */
 
-      if (face_marker[f_id] == -1) {
+      for (j = 0; j < 2; j++) {
+        cs_lnum_t start_id = cell_faces->idx[c_id[j]];
+        cs_lnum_t end_id = start_id + n_cell_groups[c_id[j]];
+        for (i = start_id; i < end_id; i++)
+          group_last_face[cell_groups[i]] = f_id;
+      }
 
-        bool f_ok = true;
+      /* Select smallest unmarked group not yet full */
 
-        for (i = 0; i < g_size && f_ok; i++) {
+      for (i = 0; i < n_groups_cur; i++) {
+        if (group_last_face[i] != f_id && _group_size[i] < _max_group_size) {
+          if (group_id < 0 || _group_size[i] < _group_size[group_id])
+            group_id = i;
+        }
+      }
 
-          cs_lnum_t f_cmp = group_face_ids[i];
-          cs_lnum_t c_id[2] = {face_cell[f_cmp][0], face_cell[f_cmp][1]};
+      /* On the second pass, when all compatible groups have reached the
+         target size, slightly overfill the smallest one rather than
+         create a small extra group */
 
-          for (j = 0; j < 2; j++) {
-            cs_lnum_t start_id = cell_faces->idx[c_id[j]];
-            cs_lnum_t end_id = cell_faces->idx[c_id[j] + 1];
-            for (k = start_id; k < end_id; k++) {
-              if (cell_faces->ids[k] == f_id) {
-                f_ok = false;
-                break;
-              }
-            }
+      if (group_id < 0 && n_groups_cur >= n_groups_target) {
+        for (i = 0; i < n_groups_cur; i++) {
+          if (group_last_face[i] != f_id) {
+            if (group_id < 0 || _group_size[i] < _group_size[group_id])
+              group_id = i;
           }
-
         }
+      }
 
-        /* Add the face to the group */
+      /* Start a new group if none is compatible */
 
-        if (f_ok == 1) {
-          if (first_unmarked_face_id == f_id)
-            first_unmarked_face_id = f_id + 1;
-          face_marker[f_id] = group_id;
-          group_face_ids[g_size++] = f_id;
-          old_to_new[f_id] = n_marked_faces++;
+      if (group_id < 0) {
+        if (n_groups_cur + 1 > _n_groups_max) {
+          _n_groups_max *= 2;
+          BFT_REALLOC(_group_size, _n_groups_max, cs_lnum_t);
+          BFT_REALLOC(group_last_face, _n_groups_max, cs_lnum_t);
         }
+        group_id = n_groups_cur++;
+        _group_size[group_id] = 0;
+        group_last_face[group_id] = -1;
+      }
 
-        /* Prepare to start new group if complete */
+      face_group[f_id] = group_id;
+      _group_size[group_id] += 1;
 
-        if (g_size == max_group_size)
-          break;
+      for (j = 0; j < 2; j++) {
+        cs_lnum_t l_id = cell_faces->idx[c_id[j]] + n_cell_groups[c_id[j]];
+        cell_groups[l_id] = group_id;
+        n_cell_groups[c_id[j]] += 1;
+      }
 
-      } /* End of test on face_marker */
+    }
 
-    } /* End of loop on faces */
+    if (n_faces < 1)
+      break;
 
-    if (group_id + 1 >= _n_groups_max) {
-      _n_groups_max *= 2;
-      BFT_REALLOC(_group_size, _n_groups_max, cs_lnum_t);
-    }
-    _group_size[group_id++] = g_size;
+    cs_lnum_t mean_size = (n_faces + n_groups_cur - 1) / n_groups_cur;
+    if (mean_size >= _max_group_size)
+      break;
+    _max_group_size = mean_size;
+    n_groups_target = n_groups_cur;
 
   }
 
   cs_adjacency_destroy(&cell_faces);
 
-  BFT_FREE(face_marker);
-  BFT_FREE(group_face_ids);
+  BFT_FREE(n_cell_groups);
+  BFT_FREE(cell_groups);
+  BFT_FREE(group_last_face);
+
+  BFT_REALLOC(_group_size, n_groups_cur, cs_lnum_t);
+
+  /* Order faces by group, keeping the initial ordering inside a group */
 
-  BFT_REALLOC(_group_size, group_id, cs_lnum_t);
+  {
+    cs_lnum_t *group_shift;
+    BFT_MALLOC(group_shift, n_groups_cur, cs_lnum_t);
+
+    cs_lnum_t shift = 0;
+    for (i = 0; i < n_groups_cur; i++) {
+      group_shift[i] = shift;
+      shift += _group_size[i];
+    }
+
+    for (f_id = 0; f_id < n_faces; f_id++)
+      old_to_new[f_id] = group_shift[face_group[f_id]]++;
+
+    BFT_FREE(group_shift);
+  }
+
+  BFT_FREE(face_group);
 
   /* Set return values */
 
@@ -1710,7 +1766,7 @@ _independent_face_groups(cs_lnum_t            max_group_size,
 
   BFT_FREE(old_to_new);
 
-  *n_groups = group_id;
+  *n_groups = n_groups_cur;
   *group_size = _group_size;
 }
 
@@ -2542,6 +2598,194 @@ _renum_i_faces_no_share_cell_in_block(cs_mesh_t    *mesh,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute renumbering of interior faces based on contiguous cell blocks.
+ *
+ * Cells (in their current, locality-optimized order) are partitioned into
+ * one contiguous block per thread, and ghost cells into additional blocks.
+ * Faces with both cells in the same block form a first group, in which
+ * each thread accesses only its own block, with no synchronization.
+ * Inter-block faces are gathered into additional groups based on an edge
+ * coloring of the block adjacency graph, all faces joining a same pair of
+ * blocks being assigned to a single thread; within a group, pairs share
+ * no block, so no two threads may update a same cell.
+ *
+ * Groups containing faces adjacent to ghost cells are ordered last, so
+ * the matching numbering info may be used to overlap halo exchanges.
+ *
+ * parameters:
+ *   mesh                 <-> pointer to global mesh structure
+ *   n_i_threads          <-- number of threads required for interior faces
+ *   new_to_old_i         --> interior faces renumbering array
+ *   n_i_groups           --> number of groups of interior faces
+ *   n_no_adj_halo_groups --> number of groups not adjacent to halo cells
+ *   i_group_index        --> group/thread index
+ *
+ * returns:
+ *   0 on success, -1 otherwise
+  *----------------------------------------------------------------------------*/
+
+static int
+_renum_i_faces_cell_blocks(cs_mesh_t    *mesh,
+                           int           n_i_threads,
+                           cs_lnum_t     new_to_old_i[],
+                           cs_lnum_t    *n_i_groups,
+                           int          *n_no_adj_halo_groups,
+                           cs_lnum_t   **i_group_index)
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_ghosts = mesh->n_cells_with_ghosts - n_cells;
+  const cs_lnum_2_t *i_face_cells
+    = (const cs_lnum_2_t *)(mesh->i_face_cells);
+
+  if (n_cells < n_i_threads*2 || n_i_faces < 1)
+    return -1;
+
+  /* Contiguous cell blocks: one per thread for local cells, plus as
+     many for ghost cells, so faces sharing a ghost cell are also
+     guaranteed to be handled by a single thread per group */
+
+  const int n_l_blocks = n_i_threads;
+  const int n_g_blocks = (n_ghosts > 0) ? n_i_threads : 0;
+  const int n_blocks = n_l_blocks + n_g_blocks;
+
+  const cs_lnum_t l_block_size = (n_cells + n_l_blocks - 1) / n_l_blocks;
+  const cs_lnum_t g_block_size
+    = (n_g_blocks > 0) ? (n_ghosts + n_g_blocks - 1) / n_g_blocks : 1;
+
+  /* Classify faces by block pair */
+
+  int  *f_b0, *f_b1;
+  BFT_MALLOC(f_b0, n_i_faces, int);
+  BFT_MALLOC(f_b1, n_i_faces, int);
+
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    int b[2];
+    for (int i = 0; i < 2; i++) {
+      cs_lnum_t c_id = i_face_cells[f_id][i];
+      if (c_id < n_cells)
+        b[i] = c_id / l_block_size;
+      else
+        b[i] = n_l_blocks + (c_id - n_cells) / g_block_size;
+    }
+    f_b0[f_id] = CS_MIN(b[0], b[1]);
+    f_b1[f_id] = CS_MAX(b[0], b[1]);
+  }
+
+  /* Edge coloring of the block adjacency graph; local-local pairs are
+     colored first, pairs involving a ghost block use a separate range
+     of colors, so halo-adjacent groups come last */
+
+  cs_lnum_t *pair_color;
+  char *b_color_used;
+
+  /* The greedy coloring uses at most deg(b0)+deg(b1)-1 colors past its
+     starting offset, so 4*n_blocks colors per block are sufficient */
+
+  const int c_stride = 4*n_blocks;
+
+  BFT_MALLOC(pair_color, n_blocks*n_blocks, cs_lnum_t);
+  BFT_MALLOC(b_color_used, n_blocks*c_stride, char);
+
+  for (cs_lnum_t i = 0; i < n_blocks*n_blocks; i++)
+    pair_color[i] = -2;
+  memset(b_color_used, 0, n_blocks*c_stride);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (f_b0[f_id] != f_b1[f_id])
+      pair_color[f_b0[f_id]*n_blocks + f_b1[f_id]] = -1;
+  }
+
+  int n_colors = 0, n_l_colors = 0;
+
+  for (int phase = 0; phase < 2; phase++) {
+
+    int c_s_id = (phase == 0) ? 0 : n_l_colors;
+
+    for (int b0 = 0; b0 < n_blocks; b0++) {
+      for (int b1 = b0+1; b1 < n_blocks; b1++) {
+
+        if (pair_color[b0*n_blocks + b1] != -1)
+          continue;
+        if ((phase == 0) != (b1 < n_l_blocks))
+          continue;
+
+        int color = c_s_id;
+        while (   b_color_used[b0*c_stride + color]
+               || b_color_used[b1*c_stride + color])
+          color++;
+
+        pair_color[b0*n_blocks + b1] = color;
+        b_color_used[b0*c_stride + color] = 1;
+        b_color_used[b1*c_stride + color] = 1;
+
+        if (color + 1 > n_colors)
+          n_colors = color + 1;
+
+      }
+    }
+
+    if (phase == 0)
+      n_l_colors = n_colors;
+
+  }
+
+  BFT_FREE(b_color_used);
+
+  /* Group and thread of each face: block-interior faces form group 0,
+     each color an additional group; within a group, all faces of a
+     given block pair go to a single thread */
+
+  const cs_lnum_t _n_groups = n_colors + 1;
+
+  cs_lnum_t *count;
+  BFT_MALLOC(count, _n_groups*n_i_threads, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < _n_groups*n_i_threads; i++)
+    count[i] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    int g_id = 0, t_id = f_b0[f_id];
+    if (f_b0[f_id] != f_b1[f_id])
+      g_id = pair_color[f_b0[f_id]*n_blocks + f_b1[f_id]] + 1;
+    count[g_id*n_i_threads + t_id] += 1;
+  }
+
+  /* Build group/thread index, then renumber (stable counting sort) */
+
+  BFT_MALLOC(*i_group_index, n_i_threads*_n_groups*2, cs_lnum_t);
+
+  cs_lnum_t shift = 0;
+  for (cs_lnum_t g_id = 0; g_id < _n_groups; g_id++) {
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      (*i_group_index)[(t_id*_n_groups + g_id)*2] = shift;
+      shift += count[g_id*n_i_threads + t_id];
+      (*i_group_index)[(t_id*_n_groups + g_id)*2 + 1] = shift;
+      count[g_id*n_i_threads + t_id]
+        = (*i_group_index)[(t_id*_n_groups + g_id)*2];
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    int g_id = 0, t_id = f_b0[f_id];
+    if (f_b0[f_id] != f_b1[f_id])
+      g_id = pair_color[f_b0[f_id]*n_blocks + f_b1[f_id]] + 1;
+    new_to_old_i[count[g_id*n_i_threads + t_id]] = f_id;
+    count[g_id*n_i_threads + t_id] += 1;
+  }
+
+  BFT_FREE(count);
+  BFT_FREE(pair_color);
+  BFT_FREE(f_b1);
+  BFT_FREE(f_b0);
+
+  *n_i_groups = _n_groups;
+  *n_no_adj_halo_groups = n_l_colors + 1;
+
+  return 0;
+}
+
 /*----------------------------------------------------------------------------
  * Compute renumbering of boundary faces for threads.
  *
@@ -3134,6 +3378,184 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Log a data layout audit for the main face-based loops, with
+ * renumbering recommendations.
+ *
+ * The interior face loop in numbering order is the access pattern shared
+ * by the convection-diffusion and gradient face kernels as well as the
+ * native matrix-vector products, so cell reuse distances measured on that
+ * loop characterize the cache behavior of those kernels for the current
+ * numbering, without requiring instrumentation of the kernels themselves.
+ *
+ * The reuse distance of a cell access is the number of faces processed
+ * since the last face adjacent to the same cell; when it exceeds the
+ * number of face updates fitting in a given cache level, the cell values
+ * are unlikely to still be resident at that level.
+ *
+ * parameters:
+ *   mesh      <-- associated mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_layout_audit(const cs_mesh_t  *mesh)
+{
+  /* Approximate face updates resident per cache level, assuming about
+     64 bytes moved per face update (2 cell values and ids, face
+     coefficients): roughly 32KB L1, 1MB L2, 32MB shared L3. */
+
+  const cs_lnum_t window[3] = {500, 16000, 500000};
+
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  cs_lnum_t *last_access = NULL;
+  BFT_MALLOC(last_access, mesh->n_cells_with_ghosts, cs_lnum_t);
+  for (cs_lnum_t ii = 0; ii < mesh->n_cells_with_ghosts; ii++)
+    last_access[ii] = -1;
+
+  /* cnt: {reuse count, reuse distance sum,
+           count per reuse window (first fit)} */
+
+  cs_gnum_t cnt[5] = {0, 0, 0, 0, 0};
+  cs_lnum_t bandwidth = 0, reuse_max = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+    cs_lnum_t d01 = CS_ABS(  i_face_cells[f_id][1]
+                           - i_face_cells[f_id][0]);
+    if (d01 > bandwidth)
+      bandwidth = d01;
+
+    for (int j = 0; j < 2; j++) {
+
+      cs_lnum_t c_id = i_face_cells[f_id][j];
+
+      if (last_access[c_id] > -1) {
+        cs_lnum_t d = f_id - last_access[c_id];
+        cnt[0] += 1;
+        cnt[1] += d;
+        if (d > reuse_max)
+          reuse_max = d;
+        for (int k = 0; k < 3; k++) {
+          if (d <= window[k]) {
+            cnt[2+k] += 1;
+            break;
+          }
+        }
+      }
+
+      last_access[c_id] = f_id;
+
+    }
+
+  }
+
+  BFT_FREE(last_access);
+
+  double rel_bandwidth = 0;
+  if (mesh->n_cells > 0)
+    rel_bandwidth = (double)bandwidth / mesh->n_cells;
+
+  cs_parall_counter(cnt, 5);
+  cs_parall_max(1, CS_LNUM_TYPE, &reuse_max);
+  cs_parall_max(1, CS_DOUBLE, &rel_bandwidth);
+
+  double mean_reuse = 0, frac[3] = {0, 0, 0};
+  if (cnt[0] > 0) {
+    mean_reuse = (double)cnt[1] / cnt[0];
+    cs_gnum_t cum = 0;
+    for (int k = 0; k < 3; k++) {
+      cum += cnt[2+k];
+      frac[k] = (double)cum / cnt[0] * 100.;
+    }
+  }
+
+  bft_printf
+    (_("\n"
+       " Mesh data layout audit\n"
+       " ----------------------\n"));
+
+  if (mesh->cell_numbering != NULL)
+    cs_numbering_log_info(CS_LOG_DEFAULT, _("cells"),
+                          mesh->cell_numbering);
+  if (mesh->i_face_numbering != NULL)
+    cs_numbering_log_info(CS_LOG_DEFAULT, _("interior faces"),
+                          mesh->i_face_numbering);
+
+  bft_printf
+    (_("\n"
+       " Interior face sweep in numbering order (access pattern of the\n"
+       " convection-diffusion, gradient, and matrix-vector face kernels):\n"
+       "\n"
+       "   maximum relative matrix bandwidth:    %12.4f\n"
+       "   mean cell reuse distance:             %12.1f faces\n"
+       "   maximum cell reuse distance:          %12llu faces\n"
+       "   accesses within ~L1 reuse window:     %12.2f %%\n"
+       "   accesses within ~L2 reuse window:     %12.2f %%\n"
+       "   accesses within ~L3 reuse window:     %12.2f %%\n"),
+     rel_bandwidth, mean_reuse, (unsigned long long)reuse_max,
+     frac[0], frac[1], frac[2]);
+
+  /* Recommendations, based on the measurements above; these are
+     starting points for cs_renumber_set_algorithm, not guarantees. */
+
+  bft_printf
+    (_("\n"
+       " Recommended starting points for cs_renumber_set_algorithm:\n"));
+
+  if (   rel_bandwidth > 0.05
+      && _cells_algorithm[1] == CS_RENUMBER_CELLS_NONE)
+    bft_printf
+      (_("\n"
+         "   Cells: the relative matrix bandwidth is high and no cell\n"
+         "   renumbering is active; a space-filling curve\n"
+         "   (CS_RENUMBER_CELLS_MORTON or CS_RENUMBER_CELLS_HILBERT)\n"
+         "   should improve locality.\n"));
+  else if (rel_bandwidth > 0.2)
+    bft_printf
+      (_("\n"
+         "   Cells: the relative matrix bandwidth remains high with the\n"
+         "   current numbering (%s);\n"
+         "   CS_RENUMBER_CELLS_RCM may reduce it.\n"),
+       _(_cell_renum_name[_cells_algorithm[1]]));
+  else
+    bft_printf
+      (_("\n"
+         "   Cells: the relative matrix bandwidth is low; the current\n"
+         "   numbering (%s) seems adequate.\n"),
+       _(_cell_renum_name[_cells_algorithm[1]]));
+
+  if (frac[1] < 90.) {
+    if (_i_faces_algorithm != CS_RENUMBER_I_FACES_MULTIPASS)
+      bft_printf
+        (_("\n"
+           "   Interior faces: only %.1f%% of cell accesses fall within a\n"
+           "   cache-sized reuse window; CS_RENUMBER_I_FACES_MULTIPASS\n"
+           "   usually improves face-loop locality.\n"),
+         frac[1]);
+    else
+      bft_printf
+        (_("\n"
+           "   Interior faces: only %.1f%% of cell accesses fall within a\n"
+           "   cache-sized reuse window; CS_RENUMBER_I_FACES_CELL_BLOCKS\n"
+           "   with CS_RENUMBER_ADJACENT_LOW base ordering may help, at\n"
+           "   the cost of more thread groups.\n"),
+         frac[1]);
+  }
+  else
+    bft_printf
+      (_("\n"
+         "   Interior faces: %.1f%% of cell accesses fall within a\n"
+         "   cache-sized reuse window; the current numbering (%s)\n"
+         "   seems adequate.\n"),
+       frac[1], _(_i_face_renum_name[_i_faces_algorithm]));
+
+  bft_printf
+    ("\n ----------------------------------------------------------\n");
+}
+
 /*----------------------------------------------------------------------------
  * Compute local cell centers.
  *
@@ -4903,6 +5325,17 @@ _renumber_i_faces(cs_mesh_t  *mesh)
                                    &i_group_index);
     break;
 
+  case CS_RENUMBER_I_FACES_CELL_BLOCKS:
+    numbering_type = CS_NUMBERING_THREADS;
+    _renumber_i_faces_by_cell_adjacency(mesh);
+    retval = _renum_i_faces_cell_blocks(mesh,
+                                        n_i_threads,
+                                        new_to_old_i,
+                                        &n_i_groups,
+                                        &n_i_no_adj_halo_groups,
+                                        &i_group_index);
+    break;
+
   case CS_RENUMBER_I_FACES_SIMD:
     numbering_type = CS_NUMBERING_VECTORIZE;
     _renumber_i_faces_by_cell_adjacency(mesh);
@@ -5813,6 +6246,11 @@ cs_renumber_mesh(cs_mesh_t  *mesh)
 
   if (mesh->verbosity > 0)
     _log_bandwidth_info(mesh, _("volume mesh"));
+
+  /* Optional data layout audit, with renumbering recommendations */
+
+  if (getenv("CS_RENUMBER_AUDIT") != NULL)
+    _log_layout_audit(mesh);
 }
 
 /*----------------------------------------------------------------------------*/
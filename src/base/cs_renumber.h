@@ -65,6 +65,7 @@ typedef enum {
 
   CS_RENUMBER_I_FACES_BLOCK,         /* No shared cell in block */
   CS_RENUMBER_I_FACES_MULTIPASS,     /* Use multipass face numbering */
+  CS_RENUMBER_I_FACES_CELL_BLOCKS,   /* Contiguous cell blocks per thread */
   CS_RENUMBER_I_FACES_SIMD,          /* Renumber for vector (SIMD) operations */
   CS_RENUMBER_I_FACES_NONE           /* No interior face numbering */
 
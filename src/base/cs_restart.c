@@ -189,6 +189,21 @@ static double _checkpoint_t_next = -1.;      /* next forced time value */
 static double _checkpoint_t_last = 0.;       /* last forced time value */
 static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
+
+static int    _checkpoint_n_deltas = 0;      /* number of incremental
+                                                (differential) checkpoints
+                                                between full checkpoints
+                                                (0: always full) */
+static double _checkpoint_delta_tol = 0.;    /* relative tolerance under which
+                                                a field is considered
+                                                unchanged for differential
+                                                checkpoints */
+static int    _checkpoint_delta_count = 0;   /* checkpoints written since
+                                                the last full checkpoint */
+
+static int    _write_single_precision = 0;   /* write real values on mesh
+                                                locations in single precision
+                                                if 1 */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
 /* Are we restarting from a NCFD file ? */
@@ -538,6 +553,23 @@ _write_ent_values(const cs_restart_t     *r,
     assert(0);
   }
 
+  /* Convert real values to single precision if requested; conversion
+     must be done before redistribution, as cs_part_to_block_copy_array
+     assumes source and destination types match. */
+
+  float  *val_f = NULL;
+
+  if (_write_single_precision && elt_type == CS_DOUBLE) {
+    cs_lnum_t n_vals = n_ents * n_location_vals;
+    const cs_real_t *val_r = (const cs_real_t *)vals;
+    BFT_MALLOC(val_f, n_vals, float);
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      val_f[ii] = val_r[ii];
+    vals = (const cs_byte_t *)val_f;
+    elt_type = CS_FLOAT;
+    nbr_byte_ent = n_location_vals * sizeof(float);
+  }
+
   bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
                                    cs_glob_n_ranks,
                                    r->rank_step,
@@ -577,9 +609,10 @@ _write_ent_values(const cs_restart_t     *r,
                            buffer,
                            r->fh);
 
-  /* Free buffer */
+  /* Free buffers */
 
   BFT_FREE(buffer);
+  BFT_FREE(val_f);
 
   cs_part_to_block_destroy(&d);
 }
@@ -1405,6 +1438,15 @@ _write_section(cs_restart_t           *restart,
     assert(0);
   }
 
+  /* Real values on mesh locations may optionally be written in single
+     precision; global (location 0) values such as time step info are
+     always kept in full precision. */
+
+  if (   _write_single_precision
+      && location_id > 0
+      && elt_type == CS_DOUBLE)
+    elt_type = CS_FLOAT;
+
   /* Section contents */
   /*------------------*/
 
@@ -1431,6 +1473,23 @@ _write_section(cs_restart_t           *restart,
                                        _n_location_vals,
                                        val_type,
                                        val);
+
+    /* Single-precision conversion, after permutation (which is based
+       on the in-memory type) */
+
+    if (elt_type == CS_FLOAT && sizeof(cs_real_t) != sizeof(float)) {
+      cs_lnum_t n_vals = n_ents * _n_location_vals;
+      const cs_real_t *val_r
+        = (val_tmp != NULL) ? (const cs_real_t *)val_tmp
+                            : (const cs_real_t *)val;
+      float *val_f = NULL;
+      BFT_MALLOC(val_f, n_vals, float);
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        val_f[ii] = val_r[ii];
+      BFT_FREE(val_tmp);
+      val_tmp = (cs_byte_t *)val_f;
+    }
+
     cs_io_write_global(sec_name,
                        n_tot_vals,
                        location_id,
@@ -1793,6 +1852,102 @@ cs_restart_checkpoint_set_next_wt(double  wt_next)
   _checkpoint_wt_next = wt_next;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define incremental (differential) checkpoint behavior.
+ *
+ * When incremental checkpointing is active, full checkpoints are written
+ * at a low cadence, and checkpoints in between may skip field values
+ * which have not changed beyond the given relative tolerance since the
+ * last full checkpoint (see \ref cs_restart_write_fields). This allows
+ * checkpointing more frequently at a reduced I/O volume.
+ *
+ * Restarting from an incremental checkpoint requires the last full
+ * checkpoint for fields not present in it, so run scripts should retain
+ * that file when this mode is active.
+ *
+ * \param[in]  n_deltas   number of incremental checkpoints between full
+ *                        checkpoints (0: always full)
+ * \param[in]  tolerance  relative tolerance (based on the maximum norm)
+ *                        under which a field is considered unchanged
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_incremental(int     n_deltas,
+                                      double  tolerance)
+{
+  _checkpoint_n_deltas = CS_MAX(n_deltas, 0);
+  _checkpoint_delta_tol = CS_MAX(tolerance, 0.);
+  _checkpoint_delta_count = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate if incremental checkpointing is active.
+ *
+ * \return  true if incremental checkpointing is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_restart_checkpoint_incremental_active(void)
+{
+  return (_checkpoint_n_deltas > 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate if the checkpoint being written may be incremental.
+ *
+ * \return  true if the current checkpoint may skip unchanged fields,
+ *          false if a full checkpoint is required
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_restart_checkpoint_is_incremental(void)
+{
+  if (_checkpoint_n_deltas < 1)
+    return false;
+
+  return (_checkpoint_delta_count % (_checkpoint_n_deltas + 1) != 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the tolerance for incremental checkpoints.
+ *
+ * \return  relative tolerance under which a field is considered unchanged
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_restart_checkpoint_get_incremental_tol(void)
+{
+  return _checkpoint_delta_tol;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether subsequent real-valued sections on mesh locations
+ *         are written in single precision.
+ *
+ * Sections written in single precision are converted back transparently
+ * to \ref cs_real_t when read, so files remain readable by all restart
+ * readers, at the cost of truncation to about 7 significant digits.
+ * Global (location-independent) values are not affected.
+ *
+ * \param[in]  s  true to write in single precision, false for full precision
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_single_precision(bool  s)
+{
+  _write_single_precision = (s) ? 1 : 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if checkpointing is recommended at a given time.
@@ -1900,6 +2055,10 @@ cs_restart_checkpoint_done(const cs_time_step_t  *ts)
     if (wt - _checkpoint_wt_last >= _checkpoint_wt_interval)
       _checkpoint_wt_last = cs_timer_wtime();
   }
+
+  if (_checkpoint_n_deltas > 0)
+    _checkpoint_delta_count
+      = (_checkpoint_delta_count + 1) % (_checkpoint_n_deltas + 1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1952,6 +2111,12 @@ cs_restart_create(const char         *name,
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+  /* Ensure background drains of previously written checkpoint files
+     are complete before the same files are rewritten */
+
+  if (mode == CS_RESTART_MODE_WRITE)
+    cs_file_staging_wait();
+
   /* Ensure mesh checkpoint is updated on first call */
 
   if (    mode == CS_RESTART_MODE_WRITE
@@ -358,6 +358,82 @@ cs_restart_checkpoint_set_next_tv(double  t_next);
 void
 cs_restart_checkpoint_set_next_wt(double  wt_next);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define incremental (differential) checkpoint behavior.
+ *
+ * When incremental checkpointing is active, full checkpoints are written
+ * at a low cadence, and checkpoints in between may skip field values
+ * which have not changed beyond the given relative tolerance since the
+ * last full checkpoint (see \ref cs_restart_write_fields). This allows
+ * checkpointing more frequently at a reduced I/O volume.
+ *
+ * Restarting from an incremental checkpoint requires the last full
+ * checkpoint for fields not present in it, so run scripts should retain
+ * that file when this mode is active.
+ *
+ * \param[in]  n_deltas   number of incremental checkpoints between full
+ *                        checkpoints (0: always full)
+ * \param[in]  tolerance  relative tolerance (based on the maximum norm)
+ *                        under which a field is considered unchanged
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_incremental(int     n_deltas,
+                                      double  tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate if incremental checkpointing is active.
+ *
+ * \return  true if incremental checkpointing is active, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_restart_checkpoint_incremental_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate if the checkpoint being written may be incremental.
+ *
+ * \return  true if the current checkpoint may skip unchanged fields,
+ *          false if a full checkpoint is required
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_restart_checkpoint_is_incremental(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the tolerance for incremental checkpoints.
+ *
+ * \return  relative tolerance under which a field is considered unchanged
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_restart_checkpoint_get_incremental_tol(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether subsequent real-valued sections on mesh locations
+ *         are written in single precision.
+ *
+ * Sections written in single precision are converted back transparently
+ * to \ref cs_real_t when read, so files remain readable by all restart
+ * readers, at the cost of truncation to about 7 significant digits.
+ * Global (location-independent) values are not affected.
+ *
+ * \param[in]  s  true to write in single precision, false for full precision
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_single_precision(bool  s);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if checkpointing is recommended at a given time.
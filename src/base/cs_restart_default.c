@@ -102,6 +102,12 @@ const char *_coeff_name[] = {"bc_coeffs::a", "bc_coeffs::b",
                              "bc_coeffs::ad", "bc_coeffs::bd",
                              "bc_coeffs::ac", "bc_coeffs::bc"};
 
+/* Reference field values at the last full checkpoint, for incremental
+   (differential) checkpoint writes */
+
+static int          _n_ref_fields = 0;
+static cs_real_t  **_ref_vals = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1504,6 +1510,80 @@ _read_and_convert_turb_variables(cs_restart_t  *r,
   BFT_FREE(v_tmp);
 }
 
+/*----------------------------------------------------------------------------
+ * Update the reference (last full checkpoint) snapshot of a field's values.
+ *
+ * parameters:
+ *   f <-- pointer to field
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_ref_vals(const cs_field_t  *f)
+{
+  const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+  const cs_lnum_t n_vals = n_elts[0] * f->dim;
+
+  if (f->id >= _n_ref_fields) {
+    int n_fields = cs_field_n_fields();
+    BFT_REALLOC(_ref_vals, n_fields, cs_real_t *);
+    for (int i = _n_ref_fields; i < n_fields; i++)
+      _ref_vals[i] = NULL;
+    _n_ref_fields = n_fields;
+  }
+
+  BFT_REALLOC(_ref_vals[f->id], n_vals, cs_real_t);
+  memcpy(_ref_vals[f->id], f->vals[0], n_vals*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a field's current values have changed beyond a given relative
+ * tolerance since the last full checkpoint.
+ *
+ * If they have (or if no reference snapshot is available yet), the
+ * snapshot is updated with the current values, so the reference always
+ * matches the values present in a previously written checkpoint.
+ *
+ * parameters:
+ *   f         <-- pointer to field
+ *   tolerance <-- relative tolerance (based on the maximum norm)
+ *
+ * returns:
+ *   true if the field's values must be written, false if unchanged
+ *----------------------------------------------------------------------------*/
+
+static bool
+_field_vals_changed(const cs_field_t  *f,
+                    double             tolerance)
+{
+  bool changed = true;
+
+  if (f->id < _n_ref_fields && _ref_vals[f->id] != NULL) {
+
+    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+    const cs_lnum_t n_vals = n_elts[0] * f->dim;
+
+    const cs_real_t *vals = f->vals[0];
+    const cs_real_t *ref = _ref_vals[f->id];
+
+    double vd[2] = {0., 0.};
+
+    for (cs_lnum_t i = 0; i < n_vals; i++) {
+      vd[0] = CS_MAX(vd[0], CS_ABS(ref[i]));
+      vd[1] = CS_MAX(vd[1], CS_ABS(vals[i] - ref[i]));
+    }
+
+    cs_parall_max(2, CS_DOUBLE, vd);
+
+    changed = (vd[1] > tolerance*vd[0]);
+
+  }
+
+  if (changed)
+    _update_ref_vals(f);
+
+  return changed;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -2743,12 +2823,26 @@ cs_restart_write_field_vals(cs_restart_t  *r,
 
   snprintf(sec_name, 127, "%s::vals::%d", f->name, t_id);
 
+  /* Optional lossy reduction to single precision, on a per-field basis;
+     such sections are converted back transparently when read. */
+
+  const int kp = cs_field_key_id_try("restart_precision");
+  bool single = false;
+  if (kp > -1)
+    single = (cs_field_get_key_int(f, kp) > 0);
+
+  if (single)
+    cs_restart_set_single_precision(true);
+
   cs_restart_write_section(r,
                            sec_name,
                            f->location_id,
                            f->dim,
                            CS_TYPE_cs_real_t,
                            f->vals[t_id]);
+
+  if (single)
+    cs_restart_set_single_precision(false);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2809,6 +2903,14 @@ cs_restart_read_time_step_info(cs_restart_t  *r)
  * \brief Loop over all fields and save them in the restart file which id is
  *        passed in argument if it matches their "restart_file" key value.
  *
+ * When incremental checkpointing is active
+ * (see \ref cs_restart_checkpoint_set_incremental), checkpoints between
+ * full checkpoints only contain the values of the main variables and of
+ * fields which have changed beyond the given tolerance since the last
+ * full checkpoint; for other (slowly-varying, usually property) fields,
+ * a marker section is written instead, and their values must be obtained
+ * from the last full checkpoint upon restart.
+ *
  * \param[in, out]  r        associated restart file pointer
  * \param[in]       r_id     value of the key "restart_file"
  */
@@ -2821,10 +2923,43 @@ cs_restart_write_fields(cs_restart_t        *r,
   int n_fields = cs_field_n_fields();
   const int restart_file_key_id = cs_field_key_id("restart_file");
 
+  const bool incremental_active = cs_restart_checkpoint_incremental_active();
+  const bool is_delta = cs_restart_checkpoint_is_incremental();
+  const double tolerance = cs_restart_checkpoint_get_incremental_tol();
+
   for (int f_id = 0; f_id < n_fields; f_id++) {
     cs_field_t *f = cs_field_by_id(f_id);
     if (cs_field_get_key_int(f, restart_file_key_id) == r_id) {
-      cs_restart_write_field_vals(r, f_id, 0);
+
+      bool write_vals = true;
+
+      /* Main variables are always-changing state, so only other
+         (usually slowly-varying property) fields may be skipped
+         in incremental checkpoints. */
+
+      if (incremental_active && !(f->type & CS_FIELD_VARIABLE)) {
+        if (is_delta)
+          write_vals = _field_vals_changed(f, tolerance);
+        else
+          _update_ref_vals(f); /* full checkpoint: refresh reference */
+      }
+
+      if (write_vals)
+        cs_restart_write_field_vals(r, f_id, 0);
+
+      else {
+        char sec_name[128];
+        cs_int_t flag = 1;
+        snprintf(sec_name, 127, "%s::vals::0::unchanged", f->name);
+        sec_name[127] = '\0';
+        cs_restart_write_section(r,
+                                 sec_name,
+                                 CS_MESH_LOCATION_NONE,
+                                 1,
+                                 CS_TYPE_cs_int_t,
+                                 &flag);
+      }
+
     }
   }
 }
@@ -2849,7 +2984,29 @@ cs_restart_read_fields(cs_restart_t       *r,
   for (int f_id = 0; f_id < n_fields; f_id++) {
     cs_field_t *f = cs_field_by_id(f_id);
     if (cs_field_get_key_int(f, restart_file_key_id) == r_id) {
-      cs_restart_read_field_vals(r, f_id, 0);
+
+      int retcode = cs_restart_read_field_vals(r, f_id, 0);
+
+      /* When restarting from an incremental checkpoint, fields marked
+         as unchanged are not present; their values must be obtained
+         from the last full checkpoint (if the run scripts provide it),
+         or are left at their current (initialized) values. */
+
+      if (retcode != CS_RESTART_SUCCESS) {
+        char sec_name[128];
+        snprintf(sec_name, 127, "%s::vals::0::unchanged", f->name);
+        sec_name[127] = '\0';
+        retcode = cs_restart_check_section(r,
+                                           sec_name,
+                                           CS_MESH_LOCATION_NONE,
+                                           1,
+                                           CS_TYPE_cs_int_t);
+        if (retcode == CS_RESTART_SUCCESS)
+          bft_printf(_("  Field \"%s\" unchanged in incremental checkpoint;\n"
+                       "    values from the last full checkpoint should be"
+                       " used.\n"), f->name);
+      }
+
     }
   }
 }
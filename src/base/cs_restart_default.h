@@ -246,6 +246,11 @@ cs_restart_read_time_step_info(cs_restart_t  *r);
  * Loop over all fields and save them in the restart file which id is
  * passed in argument if it matches their "restart_file" key value.
  *
+ * When incremental checkpointing is active (see
+ * cs_restart_checkpoint_set_incremental), checkpoints between full
+ * checkpoints skip fields unchanged beyond the given tolerance since
+ * the last full checkpoint, writing a marker section instead.
+ *
  * parameters:
  *   r      <-> associated restart file pointer
  *   r_id   <-- value of the key "restart_file"
@@ -31,6 +31,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -49,7 +50,9 @@
 
 #include "cs_base.h"
 
+#include "fvm_hilbert.h"
 #include "fvm_nodal.h"
+#include "fvm_nodal_extract.h"
 #include "ple_locator.h"
 
 #include "cs_io.h"
@@ -95,6 +98,12 @@ BEGIN_C_DECLS
 static char *_mesh_input_path = NULL;
 static float _tolerance[2] = {0, 0.1};
 
+/* Indicate if location should be based on closest cell centers rather
+   than on exact (and more costly) point-in-element tests; for the P0
+   interpolation used here, both options lead to very similar results */
+
+static bool _use_cell_center_search = true;
+
 /* Save previous section read function */
 static cs_restart_read_section_t   *_read_section_f  = NULL;
 
@@ -139,6 +148,313 @@ _type_size(cs_restart_val_type_t   val_type)
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Swap 2 entries of a cell centers search structure.
+ *
+ * parameters:
+ *   coords   <-> cell center coordinates (interlaced)
+ *   cell_num <-> matching parent cell numbers
+ *   id_0     <-- id of first entry
+ *   id_1     <-- id of second entry
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_kd_tree_swap(cs_coord_t  coords[],
+              cs_lnum_t   cell_num[],
+              cs_lnum_t   id_0,
+              cs_lnum_t   id_1)
+{
+  for (cs_lnum_t k = 0; k < 3; k++) {
+    cs_coord_t c_swap = coords[id_0*3 + k];
+    coords[id_0*3 + k] = coords[id_1*3 + k];
+    coords[id_1*3 + k] = c_swap;
+  }
+
+  cs_lnum_t n_swap = cell_num[id_0];
+  cell_num[id_0] = cell_num[id_1];
+  cell_num[id_1] = n_swap;
+}
+
+/*----------------------------------------------------------------------------
+ * Partition a sub-range of a cell centers search structure so that the
+ * entry at a given position is the median of the range relative to a
+ * given coordinate axis (quickselect).
+ *
+ * parameters:
+ *   coords   <-> cell center coordinates (interlaced)
+ *   cell_num <-> matching parent cell numbers
+ *   l        <-- start id of sub-range
+ *   r        <-- past-the-end id of sub-range
+ *   m        <-- id at which the median should be placed
+ *   axis     <-- associated coordinate axis (0, 1, or 2)
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_tree_select(cs_coord_t  coords[],
+                cs_lnum_t   cell_num[],
+                cs_lnum_t   l,
+                cs_lnum_t   r,
+                cs_lnum_t   m,
+                int         axis)
+{
+  while (r - l > 1) {
+
+    /* Use mid-range entry as pivot (entries are pre-ordered along
+       a Hilbert curve, so this is expected to be well-balanced) */
+
+    cs_lnum_t p = l + (r-l)/2;
+    cs_coord_t p_coord = coords[p*3 + axis];
+
+    _kd_tree_swap(coords, cell_num, p, r-1);
+
+    cs_lnum_t store = l;
+    for (cs_lnum_t i = l; i < r-1; i++) {
+      if (coords[i*3 + axis] < p_coord) {
+        _kd_tree_swap(coords, cell_num, i, store);
+        store++;
+      }
+    }
+
+    _kd_tree_swap(coords, cell_num, store, r-1);
+
+    if (store == m)
+      return;
+    else if (m < store)
+      r = store;
+    else
+      l = store + 1;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build an implicit (median-based) kd-tree over cell centers.
+ *
+ * The entry at the middle of each sub-range is the median of that range
+ * relative to the axis associated with the recursion depth, and its
+ * children are the two halves on each side of it.
+ *
+ * parameters:
+ *   coords   <-> cell center coordinates (interlaced)
+ *   cell_num <-> matching parent cell numbers
+ *   l        <-- start id of sub-range
+ *   r        <-- past-the-end id of sub-range
+ *   depth    <-- current recursion depth
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_tree_build(cs_coord_t  coords[],
+               cs_lnum_t   cell_num[],
+               cs_lnum_t   l,
+               cs_lnum_t   r,
+               int         depth)
+{
+  if (r - l < 2)
+    return;
+
+  cs_lnum_t m = l + (r-l)/2;
+
+  _kd_tree_select(coords, cell_num, l, r, m, depth % 3);
+
+  _kd_tree_build(coords, cell_num, l, m, depth+1);
+  _kd_tree_build(coords, cell_num, m+1, r, depth+1);
+}
+
+/*----------------------------------------------------------------------------
+ * Search a kd-tree over cell centers for the center closest to a
+ * given point.
+ *
+ * parameters:
+ *   coords     <-- cell center coordinates (interlaced)
+ *   l          <-- start id of sub-range
+ *   r          <-- past-the-end id of sub-range
+ *   depth      <-- current recursion depth
+ *   point      <-- point coordinates (size: 3)
+ *   closest_id <-> id of closest center encountered so far, or -1
+ *   d2_min     <-> squared distance to that center
+ *----------------------------------------------------------------------------*/
+
+static void
+_kd_tree_query(const cs_coord_t   coords[],
+               cs_lnum_t          l,
+               cs_lnum_t          r,
+               int                depth,
+               const cs_coord_t   point[],
+               cs_lnum_t         *closest_id,
+               double            *d2_min)
+{
+  if (r <= l)
+    return;
+
+  cs_lnum_t m = l + (r-l)/2;
+
+  double d2 = 0.;
+  for (cs_lnum_t k = 0; k < 3; k++) {
+    double delta = point[k] - coords[m*3 + k];
+    d2 += delta*delta;
+  }
+
+  if (d2 < *d2_min) {
+    *d2_min = d2;
+    *closest_id = m;
+  }
+
+  if (r - l == 1)
+    return;
+
+  /* Search the half-space containing the point first, then the
+     other one only if it may contain a closer center */
+
+  double a_delta = point[depth % 3] - coords[m*3 + depth % 3];
+
+  if (a_delta < 0) {
+    _kd_tree_query(coords, l, m, depth+1, point, closest_id, d2_min);
+    if (a_delta*a_delta < *d2_min)
+      _kd_tree_query(coords, m+1, r, depth+1, point, closest_id, d2_min);
+  }
+  else {
+    _kd_tree_query(coords, m+1, r, depth+1, point, closest_id, d2_min);
+    if (a_delta*a_delta < *d2_min)
+      _kd_tree_query(coords, l, m, depth+1, point, closest_id, d2_min);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find cells of a given mesh whose centers are closest to points:
+ * updates the location[] and distance[] arrays associated with a set
+ * of points.
+ *
+ * This is an alternative to cs_coupling_point_in_mesh_p, much faster for
+ * large meshes as no point-in-element test is required, and sufficient
+ * for the P0 interpolation used for restart mapping: the cell containing
+ * a point is almost always also the cell whose center is closest to it.
+ *
+ * So that closest centers may be compared across overlapping ranks,
+ * the reported distance is 1 + the distance to the closest center
+ * (a distance > 1 indicates a point outside an element to the locator,
+ * so candidate ranks are always compared).
+ *
+ * Location is relative to parent element numbers.
+ *
+ * \param[in]       mesh                pointer to mesh representation structure
+ * \param[in]       tolerance_base      unused here
+ * \param[in]       tolerance_fraction  unused here
+ * \param[in]       n_points            number of points to locate
+ * \param[in]       point_coords        point coordinates
+ * \param[in]       point_tag           optional point tag
+ * \param[in, out]  location            number of cell with center closest
+ *                                      to each point (size: n_points)
+ * \param[in, out]  distance            1 + distance from point to cell
+ *                                      center indicated by location[]
+ *                                      (size: n_points)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_locate_from_cell_centers(const void         *mesh,
+                          float               tolerance_base,
+                          float               tolerance_fraction,
+                          ple_lnum_t          n_points,
+                          const ple_coord_t   point_coords[],
+                          const int           point_tag[],
+                          ple_lnum_t          location[],
+                          float               distance[])
+{
+  CS_UNUSED(tolerance_base);
+  CS_UNUSED(tolerance_fraction);
+  CS_UNUSED(point_tag);
+
+  const fvm_nodal_t  *m = mesh;
+
+  cs_lnum_t n_cells = (m != NULL) ? fvm_nodal_get_n_entities(m, 3) : 0;
+
+  if (n_cells < 1 || n_points < 1)
+    return;
+
+  /* Extract cell centers and matching parent cell numbers */
+
+  cs_coord_t  *cell_cen;
+  cs_lnum_t   *cell_num;
+
+  BFT_MALLOC(cell_cen, n_cells*3, cs_coord_t);
+  BFT_MALLOC(cell_num, n_cells, cs_lnum_t);
+
+  fvm_nodal_get_element_centers(m, CS_INTERLACE, 3, cell_cen);
+  fvm_nodal_get_parent_num(m, 3, cell_num);
+
+  /* Pre-order centers along a Hilbert curve, so that entries close in
+     the storage are also close in space (pivot-based sub-range
+     partitioning below mostly maintains this locality) */
+
+  {
+    cs_coord_t extents[6] = {HUGE_VAL, HUGE_VAL, HUGE_VAL,
+                             -HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      for (cs_lnum_t k = 0; k < 3; k++) {
+        if (cell_cen[i*3 + k] < extents[k])
+          extents[k] = cell_cen[i*3 + k];
+        if (cell_cen[i*3 + k] > extents[k + 3])
+          extents[k + 3] = cell_cen[i*3 + k];
+      }
+    }
+
+    cs_lnum_t *h_order;
+    cs_coord_t *cen_s;
+    cs_lnum_t *num_s;
+
+    BFT_MALLOC(h_order, n_cells, cs_lnum_t);
+    BFT_MALLOC(cen_s, n_cells*3, cs_coord_t);
+    BFT_MALLOC(num_s, n_cells, cs_lnum_t);
+
+    fvm_hilbert_local_order_coords(3, extents, n_cells, cell_cen, h_order);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      for (cs_lnum_t k = 0; k < 3; k++)
+        cen_s[i*3 + k] = cell_cen[h_order[i]*3 + k];
+      num_s[i] = cell_num[h_order[i]];
+    }
+
+    BFT_FREE(h_order);
+    BFT_FREE(cell_cen);
+    BFT_FREE(cell_num);
+
+    cell_cen = cen_s;
+    cell_num = num_s;
+  }
+
+  /* Build search structure, then query it for each point */
+
+  _kd_tree_build(cell_cen, cell_num, 0, n_cells, 0);
+
+  for (ple_lnum_t i = 0; i < n_points; i++) {
+
+    cs_lnum_t closest_id = -1;
+    double d2_min = HUGE_VAL;
+
+    cs_coord_t p[3] = {point_coords[i*3],
+                       point_coords[i*3 + 1],
+                       point_coords[i*3 + 2]};
+
+    if (location[i] > -1 && distance[i] >= 1) {
+      double d_prev = distance[i] - 1;
+      d2_min = d_prev*d_prev;
+    }
+
+    _kd_tree_query(cell_cen, 0, n_cells, 0, p, &closest_id, &d2_min);
+
+    if (closest_id > -1) {
+      location[i] = cell_num[closest_id];
+      distance[i] = 1. + sqrt(d2_min);
+    }
+
+  }
+
+  BFT_FREE(cell_cen);
+  BFT_FREE(cell_num);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Use P0 interpolation (projection) from source to destination
@@ -311,6 +627,27 @@ cs_restart_map_set_options(float  tolerance_base,
   _tolerance[1] = tolerance_fraction;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether location for restart file mapping should be
+ *         based on closest cell centers.
+ *
+ * This is the default, and much faster on large meshes than the exact
+ * (point-in-element) location it replaces, with very similar results
+ * for the P0 interpolation used. Exact location may be restored by
+ * passing "false" here.
+ *
+ * \param[in]  use_cell_centers  if true, use closest cell centers;
+ *                               if false, use exact element location
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cell_center_search(bool  use_cell_centers)
+{
+  _use_cell_center_search = use_cell_centers;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -405,6 +742,10 @@ cs_restart_map_build(void)
   _locator = ple_locator_create();
 #endif
 
+  ple_mesh_elements_locate_t *locate_f
+    = (_use_cell_center_search) ?
+       _locate_from_cell_centers : cs_coupling_point_in_mesh_p;
+
   ple_locator_set_mesh(_locator,
                        nm,
                        options,
@@ -417,7 +758,7 @@ cs_restart_map_build(void)
                        mq->cell_cen,
                        NULL, /* distance */
                        cs_coupling_mesh_extents,
-                       cs_coupling_point_in_mesh_p);
+                       locate_f);
 
   /* Shift from 1-base to 0-based locations */
 
@@ -452,6 +793,7 @@ cs_restart_map_free(void)
   BFT_FREE(_mesh_input_path);
   _tolerance[0] = 0;
   _tolerance[1] = 0.1;
+  _use_cell_center_search = true;
 
   (void)cs_restart_set_read_section_func(_read_section_f);
   _read_section_f = NULL;
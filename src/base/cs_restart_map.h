@@ -87,6 +87,24 @@ void
 cs_restart_map_set_options(float  tolerance_base,
                            float  tolerance_fraction);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate whether location for restart file mapping should be
+ *         based on closest cell centers.
+ *
+ * This is the default, and much faster on large meshes than the exact
+ * (point-in-element) location it replaces, with very similar results
+ * for the P0 interpolation used. Exact location may be restored by
+ * passing "false" here.
+ *
+ * \param[in]  use_cell_centers  if true, use closest cell centers;
+ *                               if false, use exact element location
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cell_center_search(bool  use_cell_centers);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -1022,12 +1022,17 @@ void CS_PROCF (defloc, DEFLOC)
                     point_tag);
   }
 
-  ple_locator_set_mesh(coupl->localis_cel,
+  /* On repeated localizations (moving meshes), update locations
+     incrementally from the previous host cells; a full search is done
+     automatically on the first pass or when tags are used */
+
+  ple_locator_relocate(coupl->localis_cel,
                        coupl->cells_sup,
                        locator_options,
                        0.,
                        coupl->tolerance,
                        3,
+                       1.0,
                        nbr_cel_cpl,
                        c_elt_list,
                        point_tag,
@@ -1065,12 +1070,13 @@ void CS_PROCF (defloc, DEFLOC)
                     point_tag);
   }
 
-  ple_locator_set_mesh(coupl->localis_fbr,
+  ple_locator_relocate(coupl->localis_fbr,
                        support_fbr,
                        locator_options,
                        0.,
                        coupl->tolerance,
                        3,
+                       1.0,
                        nbr_fbr_cpl,
                        f_elt_list,
                        point_tag,
@@ -1582,6 +1588,8 @@ void CS_PROCF (pondcp, PONDCP)
  *                                 :     : 2 : variables defined at faces
  * INTEGER          STRIDE         : --> : 1 : for scalars
  *                                 :     : 3 : for vectors
+ *                                 :     : n : for interleaved arrays
+ *                                 :     :   : of n variables
  * DOUBLE PRECISION VARDIS(*)      : --> : distant variable(to send)
  * DOUBLE PRECISION VARLOC(*)      : <-- : local variable (to receive)
  *----------------------------------------------------------------------------*/
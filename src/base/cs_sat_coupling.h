@@ -315,6 +315,8 @@ void CS_PROCF (pondcp, PONDCP)
  *                                 :     : 2 : variables defined at faces
  * INTEGER          STRIDE         : --> : 1 : for scalars
  *                                 :     : 3 : for vectors
+ *                                 :     : n : for interleaved arrays
+ *                                 :     :   : of n variables
  * DOUBLE PRECISION VARDIS(*)      : --> : distant variable(to send)
  * DOUBLE PRECISION VARLOC(*)      : <-- : local variable (to receive)
  *----------------------------------------------------------------------------*/
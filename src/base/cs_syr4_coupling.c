@@ -124,6 +124,13 @@ typedef struct _cs_syr4_coupling_ent_t {
 
   double            *hvol;           /* Volumetric exchange coefficient. */
 
+  /* Asynchronous exchange */
+
+  double            *send_buf;       /* Buffer of an in-flight send to
+                                        SYRTHES, or NULL; the matching
+                                        exchange completion is deferred
+                                        to the next receive */
+
 } cs_syr4_coupling_ent_t;
 
 /* Structure associated with Syrthes coupling */
@@ -555,6 +562,8 @@ _create_coupled_ent(cs_syr4_coupling_t  *syr_coupling,
 
   coupling_ent->hvol = NULL;
 
+  coupling_ent->send_buf = NULL;
+
   if (syr_coupling->verbosity > 0) {
     bft_printf(_("\nExtracting coupled mesh             ..."));
     bft_printf_flush();
@@ -1074,6 +1083,11 @@ _destroy_coupled_ent(cs_syr4_coupling_ent_t **coupling_ent)
   if (ce == NULL)
     return;
 
+  if (ce->send_buf != NULL) {
+    ple_locator_exchange_point_var_end(ce->locator);
+    BFT_FREE(ce->send_buf);
+  }
+
   if (ce->locator != NULL)
     ce->locator = ple_locator_destroy(ce->locator);
 
@@ -1739,6 +1753,13 @@ cs_syr4_coupling_recv_tsolid(cs_syr4_coupling_t  *syr_coupling,
   if (coupling_ent == NULL)
     return;
 
+  /* Complete the send of the previous coupling instant if still pending */
+
+  if (coupling_ent->send_buf != NULL) {
+    ple_locator_exchange_point_var_end(coupling_ent->locator);
+    BFT_FREE(coupling_ent->send_buf);
+  }
+
   /* Receive data */
 
   ple_locator_exchange_point_var(coupling_ent->locator,
@@ -1802,7 +1823,11 @@ cs_syr4_coupling_send_tf_hf(cs_syr4_coupling_t  *syr_coupling,
   n_dist = ple_locator_get_n_dist_points(coupling_ent->locator);
   dist_loc = ple_locator_get_dist_locations(coupling_ent->locator);
 
-  /* Prepare and send data */
+  /* Prepare and send data; when no other exchange follows on this
+     locator before the next receive, the send is posted asynchronously
+     and completed there, so the fluid side does not stall on the solid
+     solver's slower cadence (the buffer must remain valid until
+     completion). */
 
   BFT_MALLOC(send_var, n_dist*2, double);
 
@@ -1811,15 +1836,37 @@ cs_syr4_coupling_send_tf_hf(cs_syr4_coupling_t  *syr_coupling,
     send_var[ii*2 + 1] = hf[dist_loc[ii] - 1];
   }
 
-  ple_locator_exchange_point_var(coupling_ent->locator,
-                                 send_var,
-                                 NULL,
-                                 NULL,
-                                 sizeof(double),
-                                 2,
-                                 0);
+  if (cs_syr4_coupling_conservativity > 0 && mode == 0) {
 
-  BFT_FREE(send_var);
+    ple_locator_exchange_point_var(coupling_ent->locator,
+                                   send_var,
+                                   NULL,
+                                   NULL,
+                                   sizeof(double),
+                                   2,
+                                   0);
+
+    BFT_FREE(send_var);
+
+  }
+  else {
+
+    if (coupling_ent->send_buf != NULL) {
+      ple_locator_exchange_point_var_end(coupling_ent->locator);
+      BFT_FREE(coupling_ent->send_buf);
+    }
+
+    ple_locator_exchange_point_var_begin(coupling_ent->locator,
+                                         send_var,
+                                         NULL,
+                                         NULL,
+                                         sizeof(double),
+                                         2,
+                                         0);
+
+    coupling_ent->send_buf = send_var;
+
+  }
 
   if (mode == 1 && coupling_ent->n_elts > 0) {
 
@@ -0,0 +1,421 @@
+/*============================================================================
+ * Tabulated property evaluation with node-shared tables.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_base.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_tabulation.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_tabulation.c
+        Tabulated property evaluation with node-shared tables.
+
+  Thermochemical property laws used by the combustion models are often
+  evaluated cell by cell through relatively costly functions, while
+  their inputs span a small-dimensional space. This module builds
+  multidimensional tables of such properties once at setup and replaces
+  the per-cell evaluations by vectorized multilinear interpolation.
+
+  With MPI-3, table values are placed in shared memory so that all
+  ranks of a given compute node share a single copy; only the first
+  rank of each node fills the table.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+#if defined(HAVE_MPI) && defined(MPI_VERSION) && (MPI_VERSION >= 3)
+#define HAVE_MPI_SHARED_WINDOW 1
+#endif
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Tabulation structure */
+
+struct _cs_tabulation_t {
+
+  char        *name;                          /* Tabulation name */
+
+  int          n_dim;                         /* Number of dimensions */
+  int          n_props;                       /* Properties per point */
+
+  cs_lnum_t    n_axis_p[CS_TABULATION_MAX_DIM];  /* Points per axis */
+  cs_real_t    axis_min[CS_TABULATION_MAX_DIM];  /* Axis lower bounds */
+  cs_real_t    inv_step[CS_TABULATION_MAX_DIM];  /* Inverse axis steps */
+
+  cs_lnum_t    stride[CS_TABULATION_MAX_DIM]; /* Value stride per axis
+                                                 (in property groups) */
+
+  cs_gnum_t    n_vals;                        /* Total number of values */
+  cs_real_t   *vals;                          /* Table values, interlaced
+                                                 by property */
+
+  bool         fill_rank;                     /* Fill table on this rank ? */
+
+#if defined(HAVE_MPI_SHARED_WINDOW)
+  MPI_Comm     node_comm;                     /* Per-node communicator */
+  MPI_Win      win;                           /* Shared-memory window */
+#endif
+
+};
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a property tabulation on regular axes.
+ *
+ * The table values are placed once per node in MPI-3 shared memory when
+ * available, so ranks of a same node share a single copy.
+ *
+ * parameters:
+ *   name     <-- tabulation name (for logging)
+ *   n_dim    <-- number of table dimensions (at most CS_TABULATION_MAX_DIM)
+ *   n_props  <-- number of properties tabulated per point
+ *   n_axis_p <-- number of points per axis (at least 2 each)
+ *   axis_min <-- lower bound of each axis
+ *   axis_max <-- upper bound of each axis
+ *
+ * returns:
+ *   pointer to the created tabulation
+ *----------------------------------------------------------------------------*/
+
+cs_tabulation_t *
+cs_tabulation_create(const char       *name,
+                     int               n_dim,
+                     int               n_props,
+                     const cs_lnum_t   n_axis_p[],
+                     const cs_real_t   axis_min[],
+                     const cs_real_t   axis_max[])
+{
+  cs_tabulation_t  *t = NULL;
+
+  if (n_dim < 1 || n_dim > CS_TABULATION_MAX_DIM)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The number of dimensions of tabulation \"%s\" must be "
+                "between 1 and %d (%d given)."),
+              name, CS_TABULATION_MAX_DIM, n_dim);
+
+  BFT_MALLOC(t, 1, cs_tabulation_t);
+
+  BFT_MALLOC(t->name, strlen(name) + 1, char);
+  strcpy(t->name, name);
+
+  t->n_dim = n_dim;
+  t->n_props = n_props;
+
+  t->n_vals = n_props;
+
+  for (int i = 0; i < n_dim; i++) {
+
+    if (n_axis_p[i] < 2 || axis_max[i] <= axis_min[i])
+      bft_error(__FILE__, __LINE__, 0,
+                _("Axis %d of tabulation \"%s\" must have at least 2 points "
+                  "and increasing bounds."), i, name);
+
+    t->n_axis_p[i] = n_axis_p[i];
+    t->axis_min[i] = axis_min[i];
+    t->inv_step[i] = (n_axis_p[i] - 1) / (axis_max[i] - axis_min[i]);
+
+    t->stride[i] = 1;
+    for (int j = 0; j < i; j++)
+      t->stride[i] *= n_axis_p[j];
+
+    t->n_vals *= (cs_gnum_t)n_axis_p[i];
+
+  }
+
+  t->vals = NULL;
+  t->fill_rank = true;
+
+  /* Allocate the values once per node in MPI-3 shared memory when
+     running in parallel; all ranks of a node then map the same
+     physical pages, and only the first rank of the node fills them. */
+
+#if defined(HAVE_MPI_SHARED_WINDOW)
+
+  t->node_comm = MPI_COMM_NULL;
+  t->win = MPI_WIN_NULL;
+
+  if (cs_glob_n_ranks > 1) {
+
+    int  node_rank;
+    MPI_Aint  win_size;
+    int  disp_unit;
+    void  *base = NULL;
+
+    MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &(t->node_comm));
+    MPI_Comm_rank(t->node_comm, &node_rank);
+
+    t->fill_rank = (node_rank == 0) ? true : false;
+
+    win_size = (node_rank == 0) ? t->n_vals*sizeof(cs_real_t) : 0;
+
+    MPI_Win_allocate_shared(win_size, sizeof(cs_real_t), MPI_INFO_NULL,
+                            t->node_comm, &base, &(t->win));
+
+    /* All ranks address the values through the node-root's segment */
+
+    MPI_Win_shared_query(t->win, 0, &win_size, &disp_unit, &base);
+
+    t->vals = base;
+
+  }
+
+#endif /* defined(HAVE_MPI_SHARED_WINDOW) */
+
+  if (t->vals == NULL)
+    BFT_MALLOC(t->vals, t->n_vals, cs_real_t);
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a tabulation.
+ *
+ * parameters:
+ *   t <-> pointer to tabulation pointer (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_tabulation_destroy(cs_tabulation_t  **t)
+{
+  if (t != NULL && *t != NULL) {
+
+    cs_tabulation_t  *_t = *t;
+
+#if defined(HAVE_MPI_SHARED_WINDOW)
+
+    if (_t->win != MPI_WIN_NULL) {
+      MPI_Win_free(&(_t->win));
+      _t->vals = NULL;
+    }
+    if (_t->node_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&(_t->node_comm));
+
+#endif
+
+    BFT_FREE(_t->vals);
+    BFT_FREE(_t->name);
+
+    BFT_FREE(*t);
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Indicate whether the local rank should fill the table values.
+ *
+ * With node-shared tables, only one rank per node fills the values;
+ * other ranks skip the (possibly costly) property evaluations.
+ *
+ * parameters:
+ *   t <-- tabulation
+ *
+ * returns:
+ *   true if the local rank should fill the table
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_tabulation_needs_fill(const cs_tabulation_t  *t)
+{
+  return t->fill_rank;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the table values array, for filling or direct access.
+ *
+ * Values are interlaced by property; the first axis varies fastest
+ * (Fortran-like ordering of the grid points).
+ *
+ * parameters:
+ *   t <-- tabulation
+ *
+ * returns:
+ *   pointer to table values (size: product of axis sizes * n_props)
+ *----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_tabulation_vals(cs_tabulation_t  *t)
+{
+  return t->vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Commit the table values after filling.
+ *
+ * Must be called on all ranks once the filling ranks are done; it
+ * synchronizes the node-shared memory so all ranks may evaluate.
+ *
+ * parameters:
+ *   t <-> tabulation
+ *----------------------------------------------------------------------------*/
+
+void
+cs_tabulation_commit(cs_tabulation_t  *t)
+{
+#if defined(HAVE_MPI_SHARED_WINDOW)
+
+  if (t->win != MPI_WIN_NULL) {
+    MPI_Win_sync(t->win);
+    MPI_Barrier(t->node_comm);
+    MPI_Win_sync(t->win);
+  }
+
+#else
+
+  CS_UNUSED(t);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate tabulated properties at a set of points by multilinear
+ * interpolation.
+ *
+ * Coordinates outside the table bounds are clamped to them.
+ *
+ * parameters:
+ *   t        <-- tabulation
+ *   n_points <-- number of evaluation points
+ *   coords   <-- point coordinates, interlaced (n_dim per point)
+ *   props    --> interpolated properties, interlaced (n_props per point)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_tabulation_evaluate(const cs_tabulation_t  *t,
+                       cs_lnum_t               n_points,
+                       const cs_real_t        *coords,
+                       cs_real_t              *props)
+{
+  const int  n_dim = t->n_dim;
+  const int  n_props = t->n_props;
+  const int  n_corners = 1 << n_dim;
+
+  const cs_real_t  *vals = t->vals;
+
+# pragma omp parallel for  if (n_points > CS_THR_MIN)
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+    cs_lnum_t  id_0[CS_TABULATION_MAX_DIM];
+    cs_real_t  frac[CS_TABULATION_MAX_DIM];
+
+    /* Cell containing the point along each axis, clamped to bounds */
+
+    for (int i = 0; i < n_dim; i++) {
+
+      cs_real_t x = (coords[p_id*n_dim + i] - t->axis_min[i])*t->inv_step[i];
+
+      if (x < 0.)
+        x = 0.;
+      else if (x > t->n_axis_p[i] - 1)
+        x = t->n_axis_p[i] - 1;
+
+      cs_lnum_t k = (cs_lnum_t)x;
+      if (k > t->n_axis_p[i] - 2)
+        k = t->n_axis_p[i] - 2;
+
+      id_0[i] = k;
+      frac[i] = x - k;
+
+    }
+
+    /* Accumulate the 2^n_dim corner contributions */
+
+    cs_real_t  *p = props + p_id*n_props;
+    for (int j = 0; j < n_props; j++)
+      p[j] = 0.;
+
+    for (int c_id = 0; c_id < n_corners; c_id++) {
+
+      cs_lnum_t v_id = 0;
+      cs_real_t w = 1.;
+
+      for (int i = 0; i < n_dim; i++) {
+        if (c_id & (1 << i)) {
+          v_id += (id_0[i] + 1)*t->stride[i];
+          w *= frac[i];
+        }
+        else {
+          v_id += id_0[i]*t->stride[i];
+          w *= 1. - frac[i];
+        }
+      }
+
+      const cs_real_t  *v = vals + (cs_gnum_t)v_id*n_props;
+
+#     if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd
+#     endif
+      for (int j = 0; j < n_props; j++)
+        p[j] += w*v[j];
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
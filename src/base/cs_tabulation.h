@@ -0,0 +1,162 @@
+#ifndef __CS_TABULATION_H__
+#define __CS_TABULATION_H__
+
+/*============================================================================
+ * Tabulated property evaluation with node-shared tables.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/* Maximum number of table dimensions */
+
+#define CS_TABULATION_MAX_DIM  6
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Tabulation structure (opaque) */
+
+typedef struct _cs_tabulation_t  cs_tabulation_t;
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Create a property tabulation on regular axes.
+ *
+ * The table values are placed once per node in MPI-3 shared memory when
+ * available, so ranks of a same node share a single copy.
+ *
+ * parameters:
+ *   name     <-- tabulation name (for logging)
+ *   n_dim    <-- number of table dimensions (at most CS_TABULATION_MAX_DIM)
+ *   n_props  <-- number of properties tabulated per point
+ *   n_axis_p <-- number of points per axis (at least 2 each)
+ *   axis_min <-- lower bound of each axis
+ *   axis_max <-- upper bound of each axis
+ *
+ * returns:
+ *   pointer to the created tabulation
+ *----------------------------------------------------------------------------*/
+
+cs_tabulation_t *
+cs_tabulation_create(const char       *name,
+                     int               n_dim,
+                     int               n_props,
+                     const cs_lnum_t   n_axis_p[],
+                     const cs_real_t   axis_min[],
+                     const cs_real_t   axis_max[]);
+
+/*----------------------------------------------------------------------------
+ * Destroy a tabulation.
+ *
+ * parameters:
+ *   t <-> pointer to tabulation pointer (set to NULL)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_tabulation_destroy(cs_tabulation_t  **t);
+
+/*----------------------------------------------------------------------------
+ * Indicate whether the local rank should fill the table values.
+ *
+ * With node-shared tables, only one rank per node fills the values;
+ * other ranks skip the (possibly costly) property evaluations.
+ *
+ * parameters:
+ *   t <-- tabulation
+ *
+ * returns:
+ *   true if the local rank should fill the table
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_tabulation_needs_fill(const cs_tabulation_t  *t);
+
+/*----------------------------------------------------------------------------
+ * Return the table values array, for filling or direct access.
+ *
+ * Values are interlaced by property; the first axis varies fastest
+ * (Fortran-like ordering of the grid points).
+ *
+ * parameters:
+ *   t <-- tabulation
+ *
+ * returns:
+ *   pointer to table values (size: product of axis sizes * n_props)
+ *----------------------------------------------------------------------------*/
+
+cs_real_t *
+cs_tabulation_vals(cs_tabulation_t  *t);
+
+/*----------------------------------------------------------------------------
+ * Commit the table values after filling.
+ *
+ * Must be called on all ranks once the filling ranks are done; it
+ * synchronizes the node-shared memory so all ranks may evaluate.
+ *
+ * parameters:
+ *   t <-> tabulation
+ *----------------------------------------------------------------------------*/
+
+void
+cs_tabulation_commit(cs_tabulation_t  *t);
+
+/*----------------------------------------------------------------------------
+ * Evaluate tabulated properties at a set of points by multilinear
+ * interpolation.
+ *
+ * Coordinates outside the table bounds are clamped to them.
+ *
+ * parameters:
+ *   t        <-- tabulation
+ *   n_points <-- number of evaluation points
+ *   coords   <-- point coordinates, interlaced (n_dim per point)
+ *   props    --> interpolated properties, interlaced (n_props per point)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_tabulation_evaluate(const cs_tabulation_t  *t,
+                       cs_lnum_t               n_points,
+                       const cs_real_t        *coords,
+                       cs_real_t              *props);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_TABULATION_H__ */
@@ -0,0 +1,364 @@
+/*============================================================================
+ * Task scheduler for independent explicit stages.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+/*----------------------------------------------------------------------------
+ * Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_task_scheduler.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_task_scheduler.c
+        Task scheduler for independent explicit stages.
+
+  Independent explicit stages of a time step (for example turbulence
+  source terms, property updates, time moment accumulation, or
+  postprocessing snapshots) may be registered as tasks with field-level
+  dependencies, then executed together. Tasks whose field accesses do
+  not conflict are run concurrently when OpenMP is available, allowing
+  such stages to overlap with each other (and with MPI waits occurring
+  inside tasks, provided the MPI library is initialized with adequate
+  thread support).
+
+  Registered functions are responsible for their own thread safety:
+  only stages which do not share work arrays or global state outside
+  their declared fields should be scheduled together.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Registered task */
+
+typedef struct {
+
+  char                *name;            /* Task name (for logging) */
+
+  cs_task_function_t  *func;            /* Function to call */
+  void                *input;           /* Associated input pointer */
+
+  int                  n_read_fields;   /* Number of fields read */
+  int                  n_write_fields;  /* Number of fields written */
+  int                 *read_fields;     /* Ids of fields read */
+  int                 *write_fields;    /* Ids of fields written */
+
+  int                  level;           /* Dependency level: all tasks this
+                                           one depends on have a strictly
+                                           lower level */
+
+} cs_task_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int         _n_tasks = 0;
+static int         _n_tasks_max = 0;
+static cs_task_t  *_tasks = NULL;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Check whether a field id appears in a list.
+ *
+ * parameters:
+ *   f_id     <-- field id
+ *   n_fields <-- number of list entries
+ *   fields   <-- list of field ids
+ *
+ * returns:
+ *   true if the id is present
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_in_field_list(int        f_id,
+               int        n_fields,
+               const int  fields[])
+{
+  for (int i = 0; i < n_fields; i++) {
+    if (fields[i] == f_id)
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether two tasks conflict, so that their relative order
+ * must be preserved.
+ *
+ * Tasks conflict if one writes a field the other reads or writes.
+ *
+ * parameters:
+ *   t_0 <-- pointer to first task
+ *   t_1 <-- pointer to second task
+ *
+ * returns:
+ *   true in case of conflict
+ *----------------------------------------------------------------------------*/
+
+static bool
+_tasks_conflict(const cs_task_t  *t_0,
+                const cs_task_t  *t_1)
+{
+  for (int i = 0; i < t_0->n_write_fields; i++) {
+    int f_id = t_0->write_fields[i];
+    if (   _in_field_list(f_id, t_1->n_read_fields, t_1->read_fields)
+        || _in_field_list(f_id, t_1->n_write_fields, t_1->write_fields))
+      return true;
+  }
+
+  for (int i = 0; i < t_1->n_write_fields; i++) {
+    if (_in_field_list(t_1->write_fields[i],
+                       t_0->n_read_fields,
+                       t_0->read_fields))
+      return true;
+  }
+
+  return false;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Register a task with field-level dependencies.
+ *
+ * Dependencies on previously registered tasks are deduced from the field
+ * ids read and written: a task is ordered after any earlier task writing
+ * a field it reads or writes, or reading a field it writes. Tasks with
+ * no such conflict may run concurrently, so registered functions must
+ * be safe to call from different threads.
+ *
+ * parameters:
+ *   name           <-- task name (for logging)
+ *   func           <-- function to call
+ *   input          <-> pointer passed to the function, or NULL
+ *   n_read_fields  <-- number of fields read by the task
+ *   read_fields    <-- ids of fields read, or NULL
+ *   n_write_fields <-- number of fields written by the task
+ *   write_fields   <-- ids of fields written, or NULL
+ *
+ * returns:
+ *   id of the registered task
+ *----------------------------------------------------------------------------*/
+
+int
+cs_task_scheduler_add(const char          *name,
+                      cs_task_function_t  *func,
+                      void                *input,
+                      int                  n_read_fields,
+                      const int            read_fields[],
+                      int                  n_write_fields,
+                      const int            write_fields[])
+{
+  if (func == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Task \"%s\" has no associated function."),
+              (name != NULL) ? name : "");
+
+  if (_n_tasks >= _n_tasks_max) {
+    _n_tasks_max = (_n_tasks_max > 0) ? _n_tasks_max*2 : 8;
+    BFT_REALLOC(_tasks, _n_tasks_max, cs_task_t);
+  }
+
+  int t_id = _n_tasks;
+  cs_task_t  *t = _tasks + t_id;
+
+  t->name = NULL;
+  if (name != NULL) {
+    BFT_MALLOC(t->name, strlen(name) + 1, char);
+    strcpy(t->name, name);
+  }
+
+  t->func = func;
+  t->input = input;
+
+  t->n_read_fields = n_read_fields;
+  t->n_write_fields = n_write_fields;
+
+  t->read_fields = NULL;
+  t->write_fields = NULL;
+
+  if (n_read_fields > 0) {
+    BFT_MALLOC(t->read_fields, n_read_fields, int);
+    memcpy(t->read_fields, read_fields, n_read_fields*sizeof(int));
+  }
+  if (n_write_fields > 0) {
+    BFT_MALLOC(t->write_fields, n_write_fields, int);
+    memcpy(t->write_fields, write_fields, n_write_fields*sizeof(int));
+  }
+
+  /* Place the task one level after the last conflicting task;
+     registration order between conflicting tasks is preserved */
+
+  t->level = 0;
+
+  for (int i = 0; i < t_id; i++) {
+    const cs_task_t  *t_prev = _tasks + i;
+    if (   t_prev->level >= t->level
+        && _tasks_conflict(t_prev, t))
+      t->level = t_prev->level + 1;
+  }
+
+  _n_tasks += 1;
+
+  return t_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Execute all registered tasks and clear the task list.
+ *
+ * Tasks are grouped by dependency level; tasks of a same level are
+ * submitted together and may run concurrently when OpenMP is available.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_task_scheduler_run(void)
+{
+  int  n_levels = 0;
+
+  for (int i = 0; i < _n_tasks; i++) {
+    if (_tasks[i].level >= n_levels)
+      n_levels = _tasks[i].level + 1;
+  }
+
+  for (int l_id = 0; l_id < n_levels; l_id++) {
+
+#if defined(HAVE_OPENMP)
+
+#   pragma omp parallel
+    {
+#     pragma omp single
+      {
+        for (int i = 0; i < _n_tasks; i++) {
+          cs_task_t  *t = _tasks + i;
+          if (t->level == l_id) {
+#           pragma omp task firstprivate(t)
+            t->func(t->input);
+          }
+        }
+      } /* implicit barrier waits for all tasks of this level */
+    }
+
+#else
+
+    for (int i = 0; i < _n_tasks; i++) {
+      cs_task_t  *t = _tasks + i;
+      if (t->level == l_id)
+        t->func(t->input);
+    }
+
+#endif
+
+  }
+
+  /* Clear task list */
+
+  for (int i = 0; i < _n_tasks; i++) {
+    cs_task_t  *t = _tasks + i;
+    BFT_FREE(t->name);
+    BFT_FREE(t->read_fields);
+    BFT_FREE(t->write_fields);
+  }
+
+  _n_tasks = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the number of currently registered (not yet run) tasks.
+ *
+ * returns:
+ *   number of registered tasks
+ *----------------------------------------------------------------------------*/
+
+int
+cs_task_scheduler_n_tasks(void)
+{
+  return _n_tasks;
+}
+
+/*----------------------------------------------------------------------------
+ * Free all memory associated with the task scheduler.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_task_scheduler_finalize(void)
+{
+  for (int i = 0; i < _n_tasks; i++) {
+    cs_task_t  *t = _tasks + i;
+    BFT_FREE(t->name);
+    BFT_FREE(t->read_fields);
+    BFT_FREE(t->write_fields);
+  }
+
+  BFT_FREE(_tasks);
+
+  _n_tasks = 0;
+  _n_tasks_max = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,120 @@
+#ifndef __CS_TASK_SCHEDULER_H__
+#define __CS_TASK_SCHEDULER_H__
+
+/*============================================================================
+ * Task scheduler for independent explicit stages.
+ *============================================================================*/
+
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Function pointer for a scheduled task.
+ *
+ * parameters:
+ *   input <-> pointer to optional (untyped) value or structure
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_task_function_t) (void  *input);
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Register a task with field-level dependencies.
+ *
+ * Dependencies on previously registered tasks are deduced from the field
+ * ids read and written: a task is ordered after any earlier task writing
+ * a field it reads or writes, or reading a field it writes. Tasks with
+ * no such conflict may run concurrently, so registered functions must
+ * be safe to call from different threads.
+ *
+ * parameters:
+ *   name           <-- task name (for logging)
+ *   func           <-- function to call
+ *   input          <-> pointer passed to the function, or NULL
+ *   n_read_fields  <-- number of fields read by the task
+ *   read_fields    <-- ids of fields read, or NULL
+ *   n_write_fields <-- number of fields written by the task
+ *   write_fields   <-- ids of fields written, or NULL
+ *
+ * returns:
+ *   id of the registered task
+ *----------------------------------------------------------------------------*/
+
+int
+cs_task_scheduler_add(const char          *name,
+                      cs_task_function_t  *func,
+                      void                *input,
+                      int                  n_read_fields,
+                      const int            read_fields[],
+                      int                  n_write_fields,
+                      const int            write_fields[]);
+
+/*----------------------------------------------------------------------------
+ * Execute all registered tasks and clear the task list.
+ *
+ * Tasks are grouped by dependency level; tasks of a same level are
+ * submitted together and may run concurrently when OpenMP is available.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_task_scheduler_run(void);
+
+/*----------------------------------------------------------------------------
+ * Return the number of currently registered (not yet run) tasks.
+ *
+ * returns:
+ *   number of registered tasks
+ *----------------------------------------------------------------------------*/
+
+int
+cs_task_scheduler_n_tasks(void);
+
+/*----------------------------------------------------------------------------
+ * Free all memory associated with the task scheduler.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_task_scheduler_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_TASK_SCHEDULER_H__ */
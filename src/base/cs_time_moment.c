@@ -2006,6 +2006,33 @@ cs_time_moment_update_all(void)
   BFT_MALLOC(wa_cur_data, _n_moment_wa, cs_real_t *);
   BFT_MALLOC(wa_cur_data0, _n_moment_wa, cs_real_t);
 
+  /* Group moments sharing the same source data, so that the associated
+     data function is evaluated in a single pass per source and its values
+     are streamed to all matching accumulators (a mean and its variance
+     are already handled jointly through l_id). */
+
+  int *m_group;
+  cs_real_t **group_x;
+
+  BFT_MALLOC(m_group, _n_moments, int);
+  BFT_MALLOC(group_x, _n_moments, cs_real_t *);
+
+  for (i = 0; i < _n_moments; i++) {
+    cs_time_moment_t *mt = _moment + i;
+    group_x[i] = NULL;
+    m_group[i] = i;
+    for (int j = 0; j < i; j++) {
+      cs_time_moment_t *mtj = _moment + j;
+      if (   mtj->data_func == mt->data_func
+          && mtj->data_input == mt->data_input
+          && mtj->data_dim == mt->data_dim
+          && mtj->location_id == mt->location_id) {
+        m_group[i] = m_group[j];
+        break;
+      }
+    }
+  }
+
   /* Compute current weight data */
 
   for (i = 0; i < _n_moment_wa; i++) {
@@ -2038,7 +2065,8 @@ cs_time_moment_update_all(void)
         /* Current and accumulated weight */
 
         cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+        cs_real_t *restrict wa_sum;
+        const cs_real_t *restrict x;
 
         cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
 
@@ -2057,9 +2085,14 @@ cs_time_moment_update_all(void)
           = cs_mesh_location_get_n_elts(mt->location_id)[0];
         const cs_lnum_t nd = n_elts * mt->dim;
 
-        BFT_MALLOC(x, nd, cs_real_t);
+        const int g_id = m_group[i];
+
+        if (group_x[g_id] == NULL) {
+          BFT_MALLOC(group_x[g_id], n_elts * mt->data_dim, cs_real_t);
+          mt->data_func(mt->data_input, group_x[g_id]);
+        }
 
-        mt->data_func(mt->data_input, x);
+        x = group_x[g_id];
 
         _ensure_init_moment(mt);
 
@@ -2084,6 +2117,7 @@ cs_time_moment_update_all(void)
 
           if (mt->dim == 6) { /* variance-covariance matrix */
             assert(mt->data_dim == 3);
+#           pragma omp parallel for if (n_elts > CS_THR_MIN)
             for (cs_lnum_t je = 0; je < n_elts; je++) {
               double delta[3], delta_n[3], r[3], m_n[3];
               const cs_lnum_t k = je*wa_stride;
@@ -2118,6 +2152,7 @@ cs_time_moment_update_all(void)
           }
 
           else { /* simple variance */
+#           pragma omp parallel for if (nd > CS_THR_MIN)
             for (cs_lnum_t j = 0; j < nd; j++) {
               const cs_lnum_t k = (j*wa_stride) / mt->dim;
               double wa_sum_n = w[k] + wa_sum[k];
@@ -2134,6 +2169,7 @@ cs_time_moment_update_all(void)
 
         else if (mt->type == CS_TIME_MOMENT_MEAN) {
 
+#         pragma omp parallel for if (nd > CS_THR_MIN)
           for (cs_lnum_t j = 0; j < nd; j++) {
             const cs_lnum_t k = (j*wa_stride) / mt->dim;
             val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
@@ -2143,14 +2179,22 @@ cs_time_moment_update_all(void)
 
         mt->nt_cur = ts->nt_cur;
 
-        BFT_FREE(x);
-
       } /* End of test if moment is active */
 
     } /* End of loop on moments */
 
   } /* End of loop on moment types */
 
+  /* Free cached source data */
+
+  for (i = 0; i < _n_moments; i++) {
+    if (group_x[i] != NULL)
+      BFT_FREE(group_x[i]);
+  }
+
+  BFT_FREE(group_x);
+  BFT_FREE(m_group);
+
   /* Update and free weight data */
 
   for (i = 0; i < _n_moment_wa; i++) {
@@ -53,7 +53,9 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 
+#include "cs_log.h"
 #include "cs_map.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 
@@ -108,8 +110,23 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  long                 n_work_calls;    /* Number of calls with declared
+                                           work (0 if not instrumented) */
+  double               work_bytes;      /* Theoretical bytes moved */
+  double               work_flops;      /* Theoretical flop count */
+
 } cs_timer_stats_t;
 
+/* Recorded scope event, for optional trace export */
+
+typedef struct {
+
+  int        id;               /* Associated statistic id */
+  char       type;             /* 'B' (begin) or 'E' (end) */
+  long long  t_nsec;           /* Associated wall-clock time stamp */
+
+} cs_timer_stats_event_t;
+
 /*-------------------------------------------------------------------------------
  * Local macro documentation
  *-----------------------------------------------------------------------------*/
@@ -140,6 +157,18 @@ static cs_timer_stats_t  *_stats= NULL;
 
 static cs_map_name_to_id_t  *_name_map = NULL;
 
+/* Roofline reference values (0 if unset) */
+
+static double  _roofline_mem_bw = 0.;     /* peak memory bandwidth (GB/s) */
+static double  _roofline_flop_rate = 0.;  /* peak flop rate (GFlop/s) */
+
+/* Optional event trace */
+
+static bool                     _trace = false;
+static cs_timer_stats_event_t  *_trace_events = NULL;
+static size_t                   _n_trace_events = 0;
+static size_t                   _n_trace_events_max = 0;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -277,6 +306,227 @@ _output_time_plot(void)
   BFT_FREE(vals);
 }
 
+/*----------------------------------------------------------------------------
+ * Record a scope begin or end event for trace export.
+ *
+ * parameters:
+ *   id   <-- id of statistic
+ *   type <-- 'B' (begin) or 'E' (end)
+ *   t    <-- associated timer value
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_add_event(int                id,
+                 char               type,
+                 const cs_timer_t  *t)
+{
+  if (_n_trace_events >= _n_trace_events_max) {
+    _n_trace_events_max = (_n_trace_events_max > 0) ?
+      _n_trace_events_max*2 : 4096;
+    BFT_REALLOC(_trace_events, _n_trace_events_max, cs_timer_stats_event_t);
+  }
+
+  cs_timer_stats_event_t  *e = _trace_events + _n_trace_events;
+
+  e->id = id;
+  e->type = type;
+  e->t_nsec = t->wall_sec * (long long)1000000000 + t->wall_nsec;
+
+  _n_trace_events += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Export recorded events in Chrome tracing (JSON) format.
+ *
+ * Each rank writes its own trace file, which may be loaded in a
+ * chrome://tracing or compatible viewer; scopes still open when this
+ * function is called are closed at the last recorded time stamp.
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_export(void)
+{
+  char file_name[64];
+
+  if (_n_trace_events < 1)
+    return;
+
+  if (cs_glob_n_ranks > 1)
+    snprintf(file_name, 63, "timer_stats_trace_r%04d.json",
+             cs_glob_rank_id);
+  else
+    snprintf(file_name, 63, "timer_stats_trace.json");
+  file_name[63] = '\0';
+
+  FILE *f = fopen(file_name, "w");
+
+  if (f == NULL)
+    return;
+
+  const long long t_shift = _trace_events[0].t_nsec;
+
+  fprintf(f, "{\"traceEvents\":[\n");
+
+  for (size_t i = 0; i < _n_trace_events; i++) {
+    const cs_timer_stats_event_t  *e = _trace_events + i;
+    fprintf(f,
+            "{\"name\":\"%s\",\"cat\":\"timer_stats\",\"ph\":\"%c\","
+            "\"ts\":%.3f,\"pid\":%d,\"tid\":0}%s\n",
+            (_stats + e->id)->label,
+            e->type,
+            (e->t_nsec - t_shift)*1e-3,
+            CS_MAX(cs_glob_rank_id, 0),
+            (i+1 < _n_trace_events) ? "," : "");
+  }
+
+  fprintf(f, "]}\n");
+
+  fclose(f);
+}
+
+/*----------------------------------------------------------------------------
+ * Log per-rank imbalance of total timer statistics times.
+ *
+ * For each statistic, the mean, minimum, and maximum total wall-clock
+ * times over all ranks are reported in the performance log.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_imbalance(void)
+{
+  if (_n_stats < 1)
+    return;
+
+  double  *t_mean, *t_min, *t_max;
+
+  BFT_MALLOC(t_mean, _n_stats*3, double);
+  t_min = t_mean + _n_stats;
+  t_max = t_mean + _n_stats*2;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    double t = s->t_tot.wall_nsec*1e-9;
+    t_mean[stats_id] = t;
+    t_min[stats_id] = t;
+    t_max[stats_id] = t;
+  }
+
+  cs_parall_sum(_n_stats, CS_DOUBLE, t_mean);
+  cs_parall_min(_n_stats, CS_DOUBLE, t_min);
+  cs_parall_max(_n_stats, CS_DOUBLE, t_max);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nTimer statistics per rank:\n\n"));
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("  %-32s %12s %12s %12s\n"),
+                "", "mean", "minimum", "maximum");
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-32s %12.5f %12.5f %12.5f\n",
+                  s->label,
+                  t_mean[stats_id] / cs_glob_n_ranks,
+                  t_min[stats_id],
+                  t_max[stats_id]);
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+  BFT_FREE(t_mean);
+}
+
+/*----------------------------------------------------------------------------
+ * Log per-kernel achieved performance relative to the roofline.
+ *
+ * For each statistic with declared work, the achieved bandwidth and flop
+ * rate (global work over the slowest rank's time) and the arithmetic
+ * intensity are reported in the performance log; when roofline reference
+ * values have been set with cs_timer_stats_set_roofline, the percentage
+ * of the attainable rate at that intensity is also given.
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_roofline(void)
+{
+  if (_n_stats < 1)
+    return;
+
+  double  *wb, *wf, *wt, *wc;
+
+  BFT_MALLOC(wb, _n_stats*4, double);
+  wf = wb + _n_stats;
+  wt = wb + _n_stats*2;
+  wc = wb + _n_stats*3;
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    wb[stats_id] = s->work_bytes;
+    wf[stats_id] = s->work_flops;
+    wt[stats_id] = s->t_tot.wall_nsec*1e-9;
+    wc[stats_id] = s->n_work_calls;
+  }
+
+  cs_parall_sum(_n_stats*2, CS_DOUBLE, wb);  /* bytes and flops */
+  cs_parall_max(_n_stats*2, CS_DOUBLE, wt);  /* time and calls */
+
+  int n_work = 0;
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    if (wc[stats_id] > 0)
+      n_work++;
+  }
+
+  if (n_work > 0) {
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("\nKernel work statistics (theoretical traffic and"
+                    " flop counts):\n\n"));
+
+    if (_roofline_mem_bw > 0. && _roofline_flop_rate > 0.)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  roofline reference: %g GB/s, %g GFlop/s\n\n"),
+                    _roofline_mem_bw, _roofline_flop_rate);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  %-24s %10s %10s %9s %9s %10s %7s\n"),
+                  "", "calls", "time/s", "GB/s", "GFlop/s",
+                  "flop/byte", "% roof");
+
+    for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+      if (wc[stats_id] <= 0)
+        continue;
+
+      cs_timer_stats_t  *s = _stats + stats_id;
+
+      double t = wt[stats_id];
+      double gbs = (t > 0.) ? wb[stats_id]*1e-9 / t : 0.;
+      double gfs = (t > 0.) ? wf[stats_id]*1e-9 / t : 0.;
+      double ai = (wb[stats_id] > 0.) ? wf[stats_id]/wb[stats_id] : 0.;
+
+      if (_roofline_mem_bw > 0. && _roofline_flop_rate > 0.) {
+        double attainable = (ai > 0.) ?
+          CS_MIN(_roofline_flop_rate, _roofline_mem_bw*ai) : 0.;
+        double pct = (attainable > 0.) ?
+          gfs/attainable*100. : gbs/_roofline_mem_bw*100.;
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      "  %-24s %10ld %10.3f %9.2f %9.2f %10.3f %7.1f\n",
+                      s->label, (long)wc[stats_id], t, gbs, gfs, ai, pct);
+      }
+      else
+        cs_log_printf(CS_LOG_PERFORMANCE,
+                      "  %-24s %10ld %10.3f %9.2f %9.2f %10.3f %7s\n",
+                      s->label, (long)wc[stats_id], t, gbs, gfs, ai, "-");
+
+    }
+
+    cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+
+  }
+
+  BFT_FREE(wb);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -329,6 +579,21 @@ cs_timer_stats_finalize(void)
   if (_time_plot != NULL)
     cs_time_plot_finalize(&_time_plot);
 
+  /* Per-rank imbalance summary, per-kernel work summary,
+     and optional trace export */
+
+  _log_imbalance();
+
+  _log_roofline();
+
+  if (_trace) {
+    _trace_export();
+    BFT_FREE(_trace_events);
+    _n_trace_events = 0;
+    _n_trace_events_max = 0;
+    _trace = false;
+  }
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
@@ -396,6 +661,26 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
   _plot_flush_wtime = flush_wtime;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate timer statistics event tracing.
+ *
+ * When tracing is active, every start and stop of a timer scope is
+ * recorded, and a trace file in Chrome tracing (JSON) format is written
+ * by each rank when statistics are finalized. The overhead per event is
+ * a few tens of nanoseconds, so tracing may remain active on production
+ * runs.
+ *
+ * \param[in]  trace  1 to activate, 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace(int  trace)
+{
+  _trace = (trace != 0) ? true : false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -538,6 +823,10 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  s->n_work_calls = 0;
+  s->work_bytes = 0.;
+  s->work_flops = 0.;
+
   return stats_id;
 }
 
@@ -648,6 +937,8 @@ cs_timer_stats_start(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_start;
+      if (_trace)
+        _trace_add_event(p_id, 'B', &t_start);
     }
 
   }
@@ -680,12 +971,15 @@ cs_timer_stats_stop(int  id)
 
   while (_is_parent(id, _active_id[root_id])) {
 
-    s = _stats + _active_id[root_id];
+    int s_id = _active_id[root_id];
+    s = _stats + s_id;
 
     if (s->active == true) {
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
+      if (_trace)
+        _trace_add_event(s_id, 'E', &t_stop);
     }
 
   }
@@ -728,12 +1022,15 @@ cs_timer_stats_switch(int  id)
 
   while (parent_id != _active_id[root_id]) {
 
-    s = _stats + _active_id[root_id];
+    int s_id = _active_id[root_id];
+    s = _stats + s_id;
 
     if (s->active == true) {
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
+      if (_trace)
+        _trace_add_event(s_id, 'E', &t_switch);
     }
 
   }
@@ -748,6 +1045,8 @@ cs_timer_stats_switch(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_switch;
+      if (_trace)
+        _trace_add_event(p_id, 'B', &t_switch);
     }
 
   }
@@ -783,6 +1082,57 @@ cs_timer_stats_add_diff(int                id,
     cs_timer_counter_add_diff(&(s->t_cur), t0, t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a kernel call's theoretical work to a timer statistic.
+ *
+ * The declared bytes moved and floating-point operations are accumulated
+ * with the statistic's time so that the achieved bandwidth and flop rate
+ * of the associated kernel may be reported relative to the roofline at
+ * the end of the run (see \ref cs_timer_stats_set_roofline).
+ *
+ * \param[in]  id       id of statistic
+ * \param[in]  n_bytes  theoretical bytes moved by the call
+ * \param[in]  n_flops  theoretical floating-point operations of the call
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_work(int     id,
+                        double  n_bytes,
+                        double  n_flops)
+{
+  if (id < 0 || id > _n_stats) return;
+
+  cs_timer_stats_t  *s = _stats + id;
+
+  s->n_work_calls += 1;
+  s->work_bytes += n_bytes;
+  s->work_flops += n_flops;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set roofline reference values for kernel work statistics.
+ *
+ * When both values are set, the per-kernel work summary in the
+ * performance log also reports the percentage of the attainable rate,
+ * i.e. of min(flop_rate, mem_bw * arithmetic intensity), reached by
+ * each instrumented kernel.
+ *
+ * \param[in]  mem_bw     peak memory bandwidth, in GB/s
+ * \param[in]  flop_rate  peak floating-point rate, in GFlop/s
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_roofline(double  mem_bw,
+                            double  flop_rate)
+{
+  _roofline_mem_bw = mem_bw;
+  _roofline_flop_rate = flop_rate;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define default timer statistics
@@ -814,6 +1164,11 @@ cs_timer_stats_define_defaults(void)
                              "post-processing output");
   cs_timer_stats_set_plot(id, 0);
 
+  id = cs_timer_stats_create("operations",
+                             "spmv",
+                             "sparse matrix-vector product");
+  cs_timer_stats_set_plot(id, 0);
+
   /* Stages */
 
   id = cs_timer_stats_create ("stages",
@@ -105,6 +105,23 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
                                 int                     n_buffer_steps,
                                 double                  flush_wtime);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate timer statistics event tracing.
+ *
+ * When tracing is active, every start and stop of a timer scope is
+ * recorded, and a trace file in Chrome tracing (JSON) format is written
+ * by each rank when statistics are finalized. The overhead per event is
+ * a few tens of nanoseconds, so tracing may remain active on production
+ * runs.
+ *
+ * \param[in]  trace  1 to activate, 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace(int  trace);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -241,6 +258,44 @@ cs_timer_stats_add_diff(int  id,
                         const cs_timer_t    *t0,
                         const cs_timer_t    *t1);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a kernel call's theoretical work to a timer statistic.
+ *
+ * The declared bytes moved and floating-point operations are accumulated
+ * with the statistic's time so that the achieved bandwidth and flop rate
+ * of the associated kernel may be reported relative to the roofline at
+ * the end of the run (see \ref cs_timer_stats_set_roofline).
+ *
+ * \param[in]  id       id of statistic
+ * \param[in]  n_bytes  theoretical bytes moved by the call
+ * \param[in]  n_flops  theoretical floating-point operations of the call
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_add_work(int     id,
+                        double  n_bytes,
+                        double  n_flops);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set roofline reference values for kernel work statistics.
+ *
+ * When both values are set, the per-kernel work summary in the
+ * performance log also reports the percentage of the attainable rate,
+ * i.e. of min(flop_rate, mem_bw * arithmetic intensity), reached by
+ * each instrumented kernel.
+ *
+ * \param[in]  mem_bw     peak memory bandwidth, in GB/s
+ * \param[in]  flop_rate  peak floating-point rate, in GFlop/s
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_roofline(double  mem_bw,
+                            double  flop_rate);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define default timer statistics
@@ -122,6 +122,11 @@ typedef struct {
 
   int                       *cell_rotor_num;    /* cell rotation axis number */
 
+  cs_lnum_t                  n_rotor_vtx_ref;   /* size of cached vertex
+                                                   marking, or -1 */
+  cs_lnum_t                 *vtx_rotor_num;     /* cached vertex rotation
+                                                   axis number */
+
   bool active;
 
 } cs_turbomachinery_t;
@@ -279,6 +284,8 @@ _turbomachinery_create(void)
   tbm->reference_mesh = cs_mesh_create();
   tbm->n_b_faces_ref = -1;
   tbm->cell_rotor_num = NULL;
+  tbm->n_rotor_vtx_ref = -1;
+  tbm->vtx_rotor_num = NULL;
   tbm->model = CS_TURBOMACHINERY_NONE;
   tbm->n_couplings = 0;
 
@@ -619,6 +626,10 @@ _update_angle(cs_real_t  t)
 /*----------------------------------------------------------------------------
  * Update mesh vertex positions
  *
+ * The rotor vertex marking depends only on the unjoined mesh topology
+ * and the rotor cell selection, which do not change over a computation,
+ * so it is computed on the first call and replayed on subsequent ones.
+ *
  * parameters:
  *   mesh <-> mesh to update
  *   dt   <-- associated time delta (0 for current, unmodified time)
@@ -630,52 +641,64 @@ _update_geometry(cs_mesh_t  *mesh,
 {
   cs_turbomachinery_t *tbm = _turbomachinery;
 
-  cs_lnum_t  f_id, v_id;
-
-  cs_lnum_t  *vtx_rotor_num = NULL;
+  const cs_lnum_t  n_vertices = mesh->n_vertices;
 
   const int  *cell_flag = tbm->cell_rotor_num;
 
-  BFT_MALLOC(vtx_rotor_num, mesh->n_vertices, cs_lnum_t);
+  /* Build or rebuild cached vertex marking if needed */
 
-  for (v_id = 0; v_id < mesh->n_vertices; v_id++)
-    vtx_rotor_num[v_id] = 0;
+  if (tbm->vtx_rotor_num == NULL || tbm->n_rotor_vtx_ref != n_vertices) {
 
-  /* Mark from interior faces */
+    cs_lnum_t  f_id, v_id;
 
-  for (f_id = 0; f_id < mesh->n_i_faces; f_id++) {
-    cs_lnum_t c_id_0 = mesh->i_face_cells[f_id][0];
-    cs_lnum_t c_id_1 = mesh->i_face_cells[f_id][1];
-    assert(c_id_0 > -1);
-    assert(c_id_1 > -1);
-    if (c_id_0 < mesh->n_cells && cell_flag[c_id_0] != 0) {
-      for (cs_lnum_t i = mesh->i_face_vtx_idx[f_id];
-           i < mesh->i_face_vtx_idx[f_id+1];
-           i++)
-        vtx_rotor_num[mesh->i_face_vtx_lst[i]] = cell_flag[c_id_0];
-    }
-    else if (c_id_1 < mesh->n_cells && cell_flag[c_id_1] != 0) {
-      for (cs_lnum_t i = mesh->i_face_vtx_idx[f_id];
-           i < mesh->i_face_vtx_idx[f_id+1];
-           i++)
-        vtx_rotor_num[mesh->i_face_vtx_lst[i]] = cell_flag[c_id_1];
+    BFT_REALLOC(tbm->vtx_rotor_num, n_vertices, cs_lnum_t);
+
+    cs_lnum_t  *vtx_rotor_num = tbm->vtx_rotor_num;
+
+    for (v_id = 0; v_id < n_vertices; v_id++)
+      vtx_rotor_num[v_id] = 0;
+
+    /* Mark from interior faces */
+
+    for (f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+      cs_lnum_t c_id_0 = mesh->i_face_cells[f_id][0];
+      cs_lnum_t c_id_1 = mesh->i_face_cells[f_id][1];
+      assert(c_id_0 > -1);
+      assert(c_id_1 > -1);
+      if (c_id_0 < mesh->n_cells && cell_flag[c_id_0] != 0) {
+        for (cs_lnum_t i = mesh->i_face_vtx_idx[f_id];
+             i < mesh->i_face_vtx_idx[f_id+1];
+             i++)
+          vtx_rotor_num[mesh->i_face_vtx_lst[i]] = cell_flag[c_id_0];
+      }
+      else if (c_id_1 < mesh->n_cells && cell_flag[c_id_1] != 0) {
+        for (cs_lnum_t i = mesh->i_face_vtx_idx[f_id];
+             i < mesh->i_face_vtx_idx[f_id+1];
+             i++)
+          vtx_rotor_num[mesh->i_face_vtx_lst[i]] = cell_flag[c_id_1];
+      }
     }
-  }
 
-  /* Mark from boundary faces */
+    /* Mark from boundary faces */
 
-  for (f_id = 0; f_id < mesh->n_b_faces; f_id++) {
-    cs_lnum_t c_id = mesh->b_face_cells[f_id];
-    if (cell_flag[c_id] != 0) {
-      for (cs_lnum_t i = mesh->b_face_vtx_idx[f_id];
-           i < mesh->b_face_vtx_idx[f_id+1];
-           i++)
-        vtx_rotor_num[mesh->b_face_vtx_lst[i]] = cell_flag[c_id];
+    for (f_id = 0; f_id < mesh->n_b_faces; f_id++) {
+      cs_lnum_t c_id = mesh->b_face_cells[f_id];
+      if (cell_flag[c_id] != 0) {
+        for (cs_lnum_t i = mesh->b_face_vtx_idx[f_id];
+             i < mesh->b_face_vtx_idx[f_id+1];
+             i++)
+          vtx_rotor_num[mesh->b_face_vtx_lst[i]] = cell_flag[c_id];
+      }
     }
+
+    tbm->n_rotor_vtx_ref = n_vertices;
+
   }
 
   /* Now update coordinates */
 
+  const cs_lnum_t  *vtx_rotor_num = tbm->vtx_rotor_num;
+
   cs_real_34_t  *m;
 
   BFT_MALLOC(m, tbm->n_rotors+1, cs_real_34_t);
@@ -689,14 +712,14 @@ _update_geometry(cs_mesh_t  *mesh,
                        m[j]);
   }
 
-  for (v_id = 0; v_id < mesh->n_vertices; v_id++) {
+# pragma omp parallel for if (n_vertices > CS_THR_MIN)
+  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
     if (vtx_rotor_num[v_id] > 0)
       _apply_vector_transfo(m[vtx_rotor_num[v_id]],
                             &(mesh->vtx_coord[3*v_id]));
   }
 
   BFT_FREE(m);
-  BFT_FREE(vtx_rotor_num);
 }
 
 /*----------------------------------------------------------------------------
@@ -1480,6 +1503,8 @@ cs_turbomachinery_finalize(void)
 
     BFT_FREE(tbm->cell_rotor_num);
 
+    BFT_FREE(tbm->vtx_rotor_num);
+
     if (tbm->reference_mesh != NULL)
       cs_mesh_destroy(tbm->reference_mesh);
 
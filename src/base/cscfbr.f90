@@ -102,7 +102,7 @@ double precision rcodcl(nfabor,nvar,3)
 
 ! Local variables
 
-integer          numcpl , ivarcp
+integer          numcpl , ivarcp , ipt
 integer          ncesup , nfbsup
 integer          ncecpl , nfbcpl , ncencp , nfbncp
 integer          ncedis , nfbdis
@@ -118,6 +118,7 @@ double precision, allocatable, dimension(:,:) :: dofcpl
 double precision, allocatable, dimension(:) :: pndpts
 double precision, allocatable, dimension(:) :: pndcpl
 double precision, allocatable, dimension(:,:) :: rvdis , rvfbr
+double precision, allocatable, dimension(:,:) :: rvdsi , rvfbi
 
 !===============================================================================
 
@@ -138,14 +139,14 @@ do numcpl = 1, nbrcpl
   allocate(lcecpl(ncecpl), lcencp(ncencp))
   allocate(lfbcpl(nfbcpl), lfbncp(nfbncp))
 
-!       Liste des cellules et faces de bord localis�es
+!       Liste des cellules et faces de bord localis�es
   call lelcpl                                                     &
   !==========
  ( numcpl ,                                                       &
    ncecpl , nfbcpl ,                                              &
    lcecpl , lfbcpl )
 
-!       Liste des cellules et faces de bord non localis�es
+!       Liste des cellules et faces de bord non localis�es
   call lencpl                                                     &
   !==========
  ( numcpl ,                                                       &
@@ -161,7 +162,7 @@ do numcpl = 1, nbrcpl
 
   ityvar = 2
 
-! --- Informations g�om�triques de localisation
+! --- Informations g�om�triques de localisation
 
   call npdcpl(numcpl, ncedis, nfbdis)
   !==========
@@ -195,8 +196,8 @@ do numcpl = 1, nbrcpl
     !==========
   endif
 
-!       On v�rifie qu'il faut bien �changer quelque chose
-!       de mani�re globale (� cause des appels � GRDCEL notamment)
+!       On v�rifie qu'il faut bien �changer quelque chose
+!       de mani�re globale (� cause des appels � GRDCEL notamment)
   nfbcpg = nfbcpl
   nfbdig = nfbdis
   if (irangp.ge.0) then
@@ -226,22 +227,40 @@ do numcpl = 1, nbrcpl
   deallocate(coopts, djppts, dofpts)
   deallocate(pndpts)
 
-!       Cet appel est sym�trique, donc on teste sur NFBDIG et NFBCPG
+!       Cet appel est sym�trique, donc on teste sur NFBDIG et NFBCPG
 !       (rien a envoyer, rien a recevoir)
   if (nfbdig.gt.0.or.nfbcpg.gt.0) then
 
-    do ivarcp = 1, nvarto(numcpl)
+    ! All variables are exchanged in a single message, through an
+    ! interleaved copy of the (face, variable) arrays, rather than with
+    ! one exchange per variable: the cost of distributed couplings is
+    ! dominated by message latency, not by copy bandwidth.
 
-      stride = 1
+    stride = nvarto(numcpl)
 
-      call varcpl &
-      !==========
-    ( numcpl , nfbdis , nfbcpl , ityvar , stride , &
-      rvdis(1, ivarcp) ,                           &
-      rvfbr(1, ivarcp) )
+    allocate(rvdsi(stride, max(nfbdis, 1)))
+    allocate(rvfbi(stride, max(nfbcpl, 1)))
 
+    do ivarcp = 1, stride
+      do ipt = 1, nfbdis
+        rvdsi(ivarcp, ipt) = rvdis(ipt, ivarcp)
+      enddo
     enddo
 
+    call varcpl &
+    !==========
+  ( numcpl , nfbdis , nfbcpl , ityvar , stride , &
+    rvdsi  ,                                     &
+    rvfbi  )
+
+    do ivarcp = 1, stride
+      do ipt = 1, nfbcpl
+        rvfbr(ipt, ivarcp) = rvfbi(ivarcp, ipt)
+      enddo
+    enddo
+
+    deallocate(rvdsi, rvfbi)
+
   endif
 
   ! Free memory
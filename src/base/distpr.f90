@@ -95,6 +95,7 @@ double precision, allocatable, dimension(:) :: dpvar, smbrp, rovsdt
 double precision, allocatable, dimension(:,:) :: grad
 double precision, allocatable, dimension(:) :: w1
 double precision, allocatable, dimension(:) :: imasfl, bmasfl
+double precision, allocatable, dimension(:), save :: phi_prev
 double precision, pointer, dimension(:)   :: cvar_var
 double precision, pointer, dimension(:)   :: cvara_var
 double precision, pointer, dimension(:) :: coefap, coefbp
@@ -247,6 +248,18 @@ icvflb = 0
 init   = 1
 normp = -1.d0
 
+! When the distance is recomputed during the run (moving meshes), seed the
+! solve with the diffusion potential of the previous computation, so only
+! the correction due to the geometry change remains to be converged.
+
+if (allocated(phi_prev)) then
+  if (size(phi_prev).eq.ncelet) then
+    do iel = 1, ncelet
+      cvar_var(iel) = phi_prev(iel)
+    enddo
+  endif
+endif
+
 110 continue
 
 do iel = 1, ncelet
@@ -321,6 +334,17 @@ do iel = 1, ncel
   dpvar(iel) = max(cvar_var(iel), 0.d0)
 enddo
 
+! Save the potential for use as an initial guess at the next computation
+
+if (allocated(phi_prev)) then
+  if (size(phi_prev).ne.ncelet) deallocate(phi_prev)
+endif
+if (.not.allocated(phi_prev)) allocate(phi_prev(ncelet))
+
+do iel = 1, ncelet
+  phi_prev(iel) = cvar_var(iel)
+enddo
+
 !===============================================================================
 ! 5. Compute distance to wall
 !===============================================================================
@@ -120,6 +120,11 @@ double precision xyzmax(3), xyzmin(3), vmin(1), vmax(1)
 double precision dtsdtm
 double precision hint
 double precision mult
+double precision errpid, fpid
+double precision kpdt, kidt, kddt
+parameter       (kpdt = 0.4d0, kidt = 0.1d0, kddt = 0.2d0)
+
+double precision, save :: errpr = 0.d0, erint = 0.d0
 
 double precision, allocatable, dimension(:) :: viscf, viscb
 double precision, allocatable, dimension(:) :: dam
@@ -473,7 +478,7 @@ if (idtvar.ge.0) then
     endif
 
     !     En compressible, on prend obligatoirement
-    !     en compte la limitation associee � la masse volumique.
+    !     en compte la limitation associee � la masse volumique.
 
     if (icoucf.eq.1) then
       do iel = 1, ncel
@@ -487,14 +492,45 @@ if (idtvar.ge.0) then
     ! --->  MONTEE           PROGRESSIVE DU PAS DE TEMPS
     !              DESCENTE  IMMEDIATE   DU PAS DE TEMPS
 
-    do iel = 1, ncel
-      if (w1(iel).ge.dt(iel)) then
-        unpvdt = 1.d0+varrdt
-        dt(iel) = min(unpvdt*dt(iel), w1(iel))
+    if (idtvar.eq.1) then
+
+      ! For a spatially uniform time step, the progressive increase is
+      ! driven by a PID controller on the margin to the Courant/Fourier
+      ! limit, so that the time step settles close to the limit instead
+      ! of cycling between growth at (1+varrdt) and hard clipping. The
+      ! controller output is bounded by the (1+varrdt) growth cap and
+      ! by the instantaneous limit, so it can only be more conservative
+      ! than the historical rule; any decrease remains immediate.
+
+      if (w1(1).ge.dt(1)) then
+        errpid = log(w1(1)/max(dt(1), epzero))
+        erint = min(erint + errpid, varrdt/kidt)
+        fpid = exp(kpdt*errpid + kidt*erint + kddt*(errpid - errpr))
+        fpid = min(max(fpid, 1.d0), 1.d0 + varrdt)
+        errpr = errpid
+        dtloc = min(fpid*dt(1), w1(1))
       else
-        dt(iel) =                     w1(iel)
+        errpr = 0.d0
+        erint = 0.d0
+        dtloc = w1(1)
       endif
-    enddo
+
+      do iel = 1, ncel
+        dt(iel) = dtloc
+      enddo
+
+    else
+
+      do iel = 1, ncel
+        if (w1(iel).ge.dt(iel)) then
+          unpvdt = 1.d0+varrdt
+          dt(iel) = min(unpvdt*dt(iel), w1(iel))
+        else
+          dt(iel) =                     w1(iel)
+        endif
+      enddo
+
+    endif
 
 
     ! 4.1.6 ON LIMITE PAR LE PAS DE TEMPS "THERMIQUE" MAX
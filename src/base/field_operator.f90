@@ -145,6 +145,37 @@ module field_operator
 
     !---------------------------------------------------------------------------
 
+    !> \brief  Start halo synchronization of field values, so that local
+    !>         computation not requiring ghost values may overlap with the
+    !>         exchange; must be matched by a call to field_sync_end before
+    !>         ghost values are used.
+
+    !> \param[in]   f_id  field id
+
+    subroutine field_sync_begin(f_id)                                          &
+      bind(C, name='cs_f_field_sync_begin')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value      :: f_id
+    end subroutine field_sync_begin
+
+    !---------------------------------------------------------------------------
+
+    !> \brief  Finish halo synchronization of field values started by
+    !>         field_sync_begin (does nothing if no exchange is in progress
+    !>         for the given field).
+
+    !> \param[in]   f_id  field id
+
+    subroutine field_sync_end(f_id)                                            &
+      bind(C, name='cs_f_field_sync_end')
+      use, intrinsic :: iso_c_binding
+      implicit none
+      integer(c_int), value      :: f_id
+    end subroutine field_sync_end
+
+    !---------------------------------------------------------------------------
+
     !> \cond DOXYGEN_SHOULD_SKIP_THIS
 
     !---------------------------------------------------------------------------
@@ -1196,16 +1196,17 @@ if (ippmod(icompf).lt.0) then
 
     endif
 
-    call synvin(vel)
+    ! Start the halo update of the corrected velocity here; it is
+    ! finished by field_sync_end below, so that it overlaps with the
+    ! purely local mass flux initialization.
+    call field_sync_begin(ivarfl(iu))
 
   endif
 
 endif
 
-! Bad cells regularisation
-call cs_bad_cells_regularisation_vector(vel, 1)
-
 ! Mass flux initialization for VOF algorithm
+! (local to faces, so it may overlap with the velocity halo update)
 if (ivofmt.ge.0) then
   do ifac = 1, nfac
     imasfl(ifac) = 0.d0
@@ -1215,6 +1216,11 @@ if (ivofmt.ge.0) then
   enddo
 endif
 
+call field_sync_end(ivarfl(iu))
+
+! Bad cells regularisation
+call cs_bad_cells_regularisation_vector(vel, 1)
+
 ! In the ALE framework, we add the mesh velocity
 if (iale.ge.1) then
 
@@ -195,6 +195,8 @@ double precision drom  , dronm1, relaxp
 double precision hint, qimp, qimpv(3), epsrsp, blencp
 double precision ressol, rnorm2
 double precision nadxkm1, nadxk, paxm1ax, paxm1rk, paxkrk, alph, beta
+double precision nphik, pkm1k, nphkm1, aitnum, aitden, omgait, resold
+logical          laitkn
 double precision visci(3,3), fikis, viscis, distfi
 double precision cfl, kpdc, rho, pimp, bpmasf
 double precision normp
@@ -268,8 +270,8 @@ allocate(iflux(nfac), bflux(ndimfb))
 allocate(dphi(ncelet))
 allocate(trav(3, ncelet))
 iswdyp = vcopt_p%iswdyn
-if (iswdyp.ge.1) allocate(adxk(ncelet), adxkm1(ncelet),   &
-                          dphim1(ncelet), rhs0(ncelet))
+if (iswdyp.ge.1) allocate(adxk(ncelet), adxkm1(ncelet), rhs0(ncelet))
+allocate(dphim1(ncelet))
 if (icalhy.eq.1) allocate(frchy(ndim,ncelet),             &
                           dfrchy(ndim,ncelet), hydro_pres(ncelet))
 
@@ -1200,6 +1202,7 @@ nswmpr = vcopt_p%nswrsm
 do iel = 1, ncel
   phi(iel)  = 0.d0
   dphi(iel) = 0.d0
+  dphim1(iel) = 0.d0
   phia(iel) = 0.d0
 enddo
 
@@ -1513,6 +1516,15 @@ if (iswdyp.ge.1) then
 
 endif
 
+! Aitken acceleration of the sweeps initialization (see the increment
+! update below)
+!--------------------------------------------------------------------
+if (iswdyp.eq.0) then
+  rnorm2 = rnormp**2
+  omgait = 1.d0
+  laitkn = .true.
+endif
+
 ! Reconstruction loop (beginning)
 !--------------------------------
 
@@ -1520,16 +1532,12 @@ do while (isweep.le.nswmpr.and.residu.gt.vcopt_p%epsrsm*rnormp)
 
   ! Solving on the increment dphi
   !-------------------------------
-  if (iswdyp.eq.0) then
-    do iel = 1, ncel
-      dphi(iel) = 0.d0
-    enddo
-  else
-    do iel = 1, ncel
-      dphim1(iel) = dphi(iel)
-      dphi(iel) = 0.d0
-    enddo
-  endif
+  resold = residu
+
+  do iel = 1, ncel
+    dphim1(iel) = dphi(iel)
+    dphi(iel) = 0.d0
+  enddo
 
   iwarnp = vcopt_p%iwarni
   epsilp = vcopt_p%epsilo
@@ -1660,9 +1668,30 @@ do while (isweep.le.nswmpr.and.residu.gt.vcopt_p%epsrsm*rnormp)
 
   if (iswdyp.eq.0) then
     if (idtvar.ge.0.and.isweep.le.nswmpr.and.residu.gt.vcopt_p%epsrsm*rnormp) then
+
+      ! Aitken acceleration of the pressure increments: when the sweeps
+      ! converge linearly, the increments form a quasi-geometric sequence,
+      ! and the Irons-Tuck extrapolation built on the last two increments
+      ! approaches the limit of the sequence in fewer sweeps. The
+      ! extrapolation factor is bounded, and acceleration is dropped for
+      ! the remaining sweeps if an extrapolated sweep increased the
+      ! residual.
+
+      omgait = 1.d0
+      if (laitkn.and.isweep.ge.2) then
+        nphik  = cs_gdot(ncel, dphi, dphi)
+        pkm1k  = cs_gdot(ncel, dphim1, dphi)
+        nphkm1 = cs_gdot(ncel, dphim1, dphim1)
+        aitnum = nphik - pkm1k
+        aitden = nphik - 2.d0*pkm1k + nphkm1
+        if (aitden.gt.1.d-30*rnorm2) then
+          omgait = min(max(1.d0 - aitnum/aitden, 0.5d0), 10.d0)
+        endif
+      endif
+
       do iel = 1, ncel
         phia(iel) = phi(iel)
-        phi(iel) = phi(iel) + vcopt_p%relaxv*dphi(iel)
+        phi(iel) = phi(iel) + omgait*vcopt_p%relaxv*dphi(iel)
       enddo
     ! If it is the last sweep, update with the total increment
     else
@@ -1740,6 +1769,12 @@ do while (isweep.le.nswmpr.and.residu.gt.vcopt_p%epsrsm*rnormp)
   ! --- Convergence test
   residu = sqrt(cs_gdot(ncel,rhs,rhs))
 
+  ! Aitken fallback: drop the acceleration if an extrapolated sweep
+  ! increased the residual
+  if (iswdyp.eq.0.and.omgait.gt.1.d0.and.residu.gt.resold) then
+    laitkn = .false.
+  endif
+
   ! Writing
   sinfo%nbivar = sinfo%nbivar + niterf
 
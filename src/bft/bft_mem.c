@@ -48,6 +48,10 @@
 #include <string.h>
 #include <stdlib.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 /*
  * Optional library and BFT headers
  */
@@ -143,6 +147,22 @@ BEGIN_C_DECLS
 
 #define DIR_SEPARATOR '/'
 
+/* Size-class pools for small transient allocations.
+
+   Class c serves blocks of at most (_BFT_MEM_POOL_MIN << c) bytes;
+   recycled blocks are kept on per-class free lists carved from larger
+   slabs, so repeated small allocations (connectivity and joining
+   work arrays, cellwise builders, ...) avoid the C library allocator. */
+
+#define _BFT_MEM_POOL_MIN        32      /* smallest class size, in bytes */
+#define _BFT_MEM_POOL_N_CLASSES   6      /* 32, 64, 128, 256, 512, 1024 */
+#define _BFT_MEM_POOL_SLAB_SIZE  (256*1024)
+
+/* Explicit hugepage backing of large allocations (Linux only);
+   mapped sizes are rounded up to a multiple of this value. */
+
+#define _BFT_MEM_HUGEPAGE_SIZE   (2*1024*1024)
+
 /*-------------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
@@ -211,6 +231,26 @@ static bft_error_handler_t  *_bft_mem_error_handler
 static omp_lock_t _bft_mem_lock;
 #endif
 
+/* Size-class pool state (inactive unless requested at initialization) */
+
+static int     _bft_mem_pool_active = 0;
+
+static void   *_bft_mem_pool_free_list[_BFT_MEM_POOL_N_CLASSES]
+                 = {NULL, NULL, NULL, NULL, NULL, NULL};
+
+static char          **_bft_mem_pool_slab = NULL;
+static unsigned char  *_bft_mem_pool_slab_class = NULL;
+static int             _bft_mem_pool_n_slabs = 0;
+static int             _bft_mem_pool_n_slabs_max = 0;
+
+/* Hugepage-backed block state (threshold 0 means disabled) */
+
+static size_t  _bft_mem_hugepage_threshold = 0;
+
+static struct _bft_mem_block_t  *_bft_mem_huge_array = NULL;
+static unsigned long             _bft_mem_huge_nbr = 0;
+static unsigned long             _bft_mem_huge_max = 0;
+
 /*-----------------------------------------------------------------------------
  * Local function definitions
  *-----------------------------------------------------------------------------*/
@@ -568,6 +608,235 @@ _bft_mem_block_free(const void *p_free)
   }
 }
 
+/*
+ * Return the size-class index matching a requested allocation size,
+ * or -1 if the size is too large to be served by the pools.
+ *
+ * parameters:
+ *   alloc_size <-- requested size in bytes.
+ *
+ * returns:
+ *   size-class index, or -1.
+ */
+
+static int
+_bft_mem_pool_class(size_t  alloc_size)
+{
+  int c;
+  size_t class_size = _BFT_MEM_POOL_MIN;
+
+  for (c = 0; c < _BFT_MEM_POOL_N_CLASSES; c++) {
+    if (alloc_size <= class_size)
+      return c;
+    class_size *= 2;
+  }
+
+  return -1;
+}
+
+/*
+ * Allocate a block from a size-class pool, carving a new slab into
+ * blocks of the matching class if the free list is empty.
+ *
+ * The caller is responsible for serializing access to the pool state
+ * (same locking discipline as for the allocation counters).
+ *
+ * parameters:
+ *   p_class <-- size-class index.
+ *
+ * returns:
+ *   pointer to block, or NULL in case of slab allocation failure
+ *   (the caller should then fall back to a plain allocation).
+ */
+
+static void *
+_bft_mem_pool_alloc(int  p_class)
+{
+  void  *p_loc;
+
+  if (_bft_mem_pool_free_list[p_class] == NULL) {
+
+    char  *slab;
+    size_t  i, class_size = (size_t)_BFT_MEM_POOL_MIN << p_class;
+    size_t  n_blocks = _BFT_MEM_POOL_SLAB_SIZE / class_size;
+
+    if (_bft_mem_pool_n_slabs >= _bft_mem_pool_n_slabs_max) {
+      _bft_mem_pool_n_slabs_max = (_bft_mem_pool_n_slabs_max > 0) ?
+        _bft_mem_pool_n_slabs_max*2 : 16;
+      _bft_mem_pool_slab
+        = realloc(_bft_mem_pool_slab,
+                  sizeof(char *) * _bft_mem_pool_n_slabs_max);
+      _bft_mem_pool_slab_class
+        = realloc(_bft_mem_pool_slab_class,
+                  sizeof(unsigned char) * _bft_mem_pool_n_slabs_max);
+      if (_bft_mem_pool_slab == NULL || _bft_mem_pool_slab_class == NULL)
+        return NULL;
+    }
+
+    slab = malloc(_BFT_MEM_POOL_SLAB_SIZE);
+    if (slab == NULL)
+      return NULL;
+
+    _bft_mem_pool_slab[_bft_mem_pool_n_slabs] = slab;
+    _bft_mem_pool_slab_class[_bft_mem_pool_n_slabs] = (unsigned char)p_class;
+    _bft_mem_pool_n_slabs += 1;
+
+    /* Thread the new blocks onto the class free list */
+
+    for (i = 0; i < n_blocks; i++) {
+      void  *b = slab + i*class_size;
+      *((void **)b) = _bft_mem_pool_free_list[p_class];
+      _bft_mem_pool_free_list[p_class] = b;
+    }
+
+  }
+
+  p_loc = _bft_mem_pool_free_list[p_class];
+  _bft_mem_pool_free_list[p_class] = *((void **)p_loc);
+
+  return p_loc;
+}
+
+/*
+ * Return the size-class of a pool-managed block, based on the slab
+ * it was carved from, or -1 if the pointer is not pool-managed.
+ *
+ * The caller is responsible for serializing access to the pool state.
+ *
+ * parameters:
+ *   ptr <-- allocated block's start adress.
+ *
+ * returns:
+ *   size-class index, or -1.
+ */
+
+static int
+_bft_mem_pool_query(const void  *ptr)
+{
+  int i;
+  const char  *p = ptr;
+
+  for (i = 0; i < _bft_mem_pool_n_slabs; i++) {
+    if (p >= _bft_mem_pool_slab[i]
+        && p < _bft_mem_pool_slab[i] + _BFT_MEM_POOL_SLAB_SIZE)
+      return (int)_bft_mem_pool_slab_class[i];
+  }
+
+  return -1;
+}
+
+/*
+ * Try to allocate a block backed by explicit hugepages.
+ *
+ * The caller is responsible for serializing access to the mapped
+ * block registry.
+ *
+ * parameters:
+ *   alloc_size <-- requested size in bytes.
+ *
+ * returns:
+ *   pointer to mapped memory, or NULL if no hugepages are available
+ *   (the caller should then fall back to a plain allocation).
+ */
+
+static void *
+_bft_mem_huge_alloc(size_t  alloc_size)
+{
+#if defined(__linux__) && defined(MAP_HUGETLB)
+
+  void  *p_loc;
+  struct _bft_mem_block_t  *pinfo;
+
+  size_t  map_size =   ((alloc_size + _BFT_MEM_HUGEPAGE_SIZE - 1)
+                        / _BFT_MEM_HUGEPAGE_SIZE) * _BFT_MEM_HUGEPAGE_SIZE;
+
+  p_loc = mmap(NULL, map_size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+  if (p_loc == MAP_FAILED)
+    return NULL;
+
+  if (_bft_mem_huge_nbr >= _bft_mem_huge_max) {
+    _bft_mem_huge_max = (_bft_mem_huge_max > 0) ? _bft_mem_huge_max*2 : 16;
+    _bft_mem_huge_array
+      = realloc(_bft_mem_huge_array,
+                sizeof(struct _bft_mem_block_t) * _bft_mem_huge_max);
+    if (_bft_mem_huge_array == NULL) {
+      munmap(p_loc, map_size);
+      return NULL;
+    }
+  }
+
+  pinfo = _bft_mem_huge_array + _bft_mem_huge_nbr;
+  pinfo->p_bloc = p_loc;
+  pinfo->size = map_size;
+  _bft_mem_huge_nbr += 1;
+
+  return p_loc;
+
+#else
+
+  return NULL;
+
+#endif
+}
+
+/*
+ * Release a block if it is pool-managed or hugepage-backed.
+ *
+ * parameters:
+ *   ptr <-- allocated block's start adress.
+ *
+ * returns:
+ *   1 if the block was handled here, 0 if it should be passed to free().
+ */
+
+static int
+_bft_mem_special_free(void  *ptr)
+{
+  int  retval = 0;
+
+  if (_bft_mem_pool_active == 0 && _bft_mem_hugepage_threshold == 0)
+    return retval;
+
+#if defined(HAVE_OPENMP)
+  int in_parallel = omp_in_parallel();
+  if (in_parallel)
+    omp_set_lock(&_bft_mem_lock);
+#endif
+
+  if (_bft_mem_pool_active) {
+    int  p_class = _bft_mem_pool_query(ptr);
+    if (p_class > -1) {
+      *((void **)ptr) = _bft_mem_pool_free_list[p_class];
+      _bft_mem_pool_free_list[p_class] = ptr;
+      retval = 1;
+    }
+  }
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  if (retval == 0 && _bft_mem_huge_nbr > 0) {
+    unsigned long  i;
+    for (i = 0; i < _bft_mem_huge_nbr; i++) {
+      if (_bft_mem_huge_array[i].p_bloc == ptr) {
+        munmap(ptr, _bft_mem_huge_array[i].size);
+        _bft_mem_huge_array[i] = _bft_mem_huge_array[_bft_mem_huge_nbr - 1];
+        _bft_mem_huge_nbr -= 1;
+        retval = 1;
+        break;
+      }
+    }
+  }
+#endif
+
+#if defined(HAVE_OPENMP)
+  if (in_parallel)
+    omp_unset_lock(&_bft_mem_lock);
+#endif
+
+  return retval;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -583,6 +852,13 @@ _bft_mem_block_free(const void *p_free)
  * be a regular, local file. If this file cannot be opened for
  * some reason, logging is silently de-activated.
  *
+ * Two optional allocation tunings may be requested through the
+ * environment: setting BFT_MEM_POOL to a nonzero value activates
+ * size-class pools recycling small blocks, and setting
+ * BFT_MEM_HUGEPAGES to n > 0 backs allocations of at least
+ * n megabytes with explicit 2MB hugepages where supported
+ * (falling back to plain allocation when no hugepages are available).
+ *
  * \param log_file_name name of optional log_file (if NULL, no log).
  */
 
@@ -605,6 +881,16 @@ bft_mem_init(const char *log_file_name)
   }
   _bft_mem_global_initialized = 1;
 
+  {
+    const char  *s = getenv("BFT_MEM_POOL");
+    if (s != NULL && atoi(s) > 0)
+      _bft_mem_pool_active = 1;
+
+    s = getenv("BFT_MEM_HUGEPAGES");
+    if (s != NULL && atoi(s) > 0)
+      _bft_mem_hugepage_threshold = (size_t)atoi(s) * 1024*1024;
+  }
+
   alloc_size = sizeof(struct _bft_mem_block_t) * _bft_mem_global_block_max;
 
   _bft_mem_global_block_array
@@ -712,6 +998,40 @@ void bft_mem_end(void)
     fclose(_bft_mem_global_file);
   }
 
+  /* Release pool slabs and hugepage mappings; any block still
+     allocated from these at this point would appear in the list of
+     non-freed pointers above. */
+
+  if (_bft_mem_pool_n_slabs > 0) {
+    int i;
+    for (i = 0; i < _bft_mem_pool_n_slabs; i++)
+      free(_bft_mem_pool_slab[i]);
+    for (i = 0; i < _BFT_MEM_POOL_N_CLASSES; i++)
+      _bft_mem_pool_free_list[i] = NULL;
+  }
+
+  free(_bft_mem_pool_slab);
+  free(_bft_mem_pool_slab_class);
+  _bft_mem_pool_slab = NULL;
+  _bft_mem_pool_slab_class = NULL;
+  _bft_mem_pool_n_slabs = 0;
+  _bft_mem_pool_n_slabs_max = 0;
+  _bft_mem_pool_active = 0;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+  {
+    unsigned long i;
+    for (i = 0; i < _bft_mem_huge_nbr; i++)
+      munmap(_bft_mem_huge_array[i].p_bloc, _bft_mem_huge_array[i].size);
+  }
+#endif
+
+  free(_bft_mem_huge_array);
+  _bft_mem_huge_array = NULL;
+  _bft_mem_huge_nbr = 0;
+  _bft_mem_huge_max = 0;
+  _bft_mem_hugepage_threshold = 0;
+
   /* Reset defaults in case of later initialization */
 
   if (_bft_mem_global_block_array != NULL) {
@@ -772,9 +1092,45 @@ bft_mem_malloc(size_t       ni,
   if (ni == 0)
     return NULL;
 
+  /* Pool and hugepage paths, when activated at initialization */
+
+  p_loc = NULL;
+
+  if (_bft_mem_pool_active || _bft_mem_hugepage_threshold > 0) {
+
+    int p_class = -1;
+
+    if (_bft_mem_pool_active)
+      p_class = _bft_mem_pool_class(alloc_size);
+
+    if (   p_class > -1
+        || (   _bft_mem_hugepage_threshold > 0
+            && alloc_size >= _bft_mem_hugepage_threshold)) {
+
+#if defined(HAVE_OPENMP)
+      int in_parallel_l = omp_in_parallel();
+      if (in_parallel_l)
+        omp_set_lock(&_bft_mem_lock);
+#endif
+
+      if (p_class > -1)
+        p_loc = _bft_mem_pool_alloc(p_class);
+      else
+        p_loc = _bft_mem_huge_alloc(alloc_size);
+
+#if defined(HAVE_OPENMP)
+      if (in_parallel_l)
+        omp_unset_lock(&_bft_mem_lock);
+#endif
+
+    }
+
+  }
+
   /* Allocate memory and check return */
 
-  p_loc = malloc(alloc_size);
+  if (p_loc == NULL)
+    p_loc = malloc(alloc_size);
 
   if (p_loc == NULL) {
     _bft_mem_error(file_name, line_num, errno,
@@ -903,6 +1259,56 @@ bft_mem_realloc(void        *ptr,
 
   else {
 
+    /* Pool-managed and hugepage-backed blocks may not be passed to
+       realloc(); move them through the standard allocation and free
+       paths (the copied data never exceeds a pool class size or the
+       previously mapped size, so this stays cheap relative to the
+       reallocation itself). */
+
+    int is_special = 0;
+
+    if (_bft_mem_pool_active || _bft_mem_hugepage_threshold > 0) {
+
+#if defined(HAVE_OPENMP)
+      if (in_parallel)
+        omp_set_lock(&_bft_mem_lock);
+#endif
+
+      if (_bft_mem_pool_active && _bft_mem_pool_query(ptr) > -1)
+        is_special = 1;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+      if (is_special == 0) {
+        unsigned long i;
+        for (i = 0; i < _bft_mem_huge_nbr; i++) {
+          if (_bft_mem_huge_array[i].p_bloc == ptr) {
+            is_special = 1;
+            break;
+          }
+        }
+      }
+#endif
+
+#if defined(HAVE_OPENMP)
+      if (in_parallel)
+        omp_unset_lock(&_bft_mem_lock);
+#endif
+
+    }
+
+    if (is_special) {
+
+      p_loc = bft_mem_malloc(ni, size, var_name, file_name, line_num);
+
+      if (p_loc != NULL)
+        memcpy(p_loc, ptr, (old_size < new_size) ? old_size : new_size);
+
+      bft_mem_free(ptr, var_name, file_name, line_num);
+
+      return p_loc;
+
+    }
+
     size_diff = new_size - old_size;
 
     p_loc = realloc(ptr, new_size);
@@ -1022,6 +1428,12 @@ bft_mem_free(void        *ptr,
 #endif
   }
 
+  /* Pool-managed blocks return to their class free list, and
+     hugepage-backed blocks are unmapped, instead of calling free() */
+
+  if (_bft_mem_special_free(ptr))
+    return NULL;
+
   free(ptr);
 
   return NULL;
@@ -111,6 +111,14 @@ static const cs_flag_t  cs_cdo_local_flag_ef =
 static double     **cs_cdo_local_dbuf = NULL;
 static short int  **cs_cdo_local_kbuf = NULL;
 
+/* Per-thread arena: one contiguous cache-aligned slab gathering the small
+   work arrays requested by the cell builders. A slab is allocated once and
+   then shared by all the equations so that the buffers used in the tight
+   cellwise loops stay close to each other in memory */
+static size_t       cs_cdo_local_arena_size = 0;
+static size_t      *cs_cdo_local_arena_used = NULL;
+static char       **cs_cdo_local_arena_slab = NULL;
+
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
 /*============================================================================
@@ -148,6 +156,28 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect)
   BFT_MALLOC(cs_cdo_local_dbuf, size, double *);
   BFT_MALLOC(cs_cdo_local_kbuf, size, short int *);
 
+  /* Size the per-thread arena from the connectivity maxima. A low-order
+     builder requests at most O(n_dofs^2) reals with n_dofs the max. number
+     of DoFs in a cell (3*(n_fbyc+1) for vector-valued face-based schemes).
+     Keep room for several equations sharing the arena; a request exceeding
+     the remaining room falls back to a regular allocation */
+  const size_t  n_max_dofs = 3*(connect->n_max_fbyc + 1);
+  const size_t  n_max_ent = CS_MAX((size_t)(connect->n_max_vbyc +
+                                            connect->n_max_ebyc),
+                                   n_max_dofs);
+  size_t  builder_bytes =
+    n_max_dofs*n_max_dofs*sizeof(double)            /* values */
+    + 2*connect->n_max_fbyc*sizeof(cs_real_3_t)     /* vectors */
+    + 2*n_max_ent*sizeof(double)                    /* adv. fluxes... */
+    + n_max_ent*sizeof(short int)                   /* ids */
+    + 4*CS_CL_SIZE;                                 /* padding */
+
+  cs_cdo_local_arena_size =
+    8 * CS_CL_SIZE * ((builder_bytes + CS_CL_SIZE - 1)/CS_CL_SIZE);
+
+  BFT_MALLOC(cs_cdo_local_arena_used, size, size_t);
+  BFT_MALLOC(cs_cdo_local_arena_slab, size, char *);
+
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
 #pragma omp parallel
   {
@@ -163,6 +193,17 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect)
     BFT_MALLOC(cs_cdo_local_kbuf[t_id], CS_MAX(connect->v_max_cell_range,
                                                connect->e_max_cell_range) + 1,
                short int);
+
+    /* Allocation inside the OpenMP region so that the first touch maps the
+       slab close to the thread which will use it */
+    cs_cdo_local_arena_used[t_id] = 0;
+    if (bft_mem_have_memalign())
+      BFT_MEMALIGN(cs_cdo_local_arena_slab[t_id], CS_CL_SIZE,
+                   cs_cdo_local_arena_size, char);
+    else
+      BFT_MALLOC(cs_cdo_local_arena_slab[t_id],
+                 cs_cdo_local_arena_size, char);
+    memset(cs_cdo_local_arena_slab[t_id], 0, cs_cdo_local_arena_size);
   }
 #else
 
@@ -178,6 +219,14 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect)
                                           connect->e_max_cell_range) + 1,
              short int);
 
+  cs_cdo_local_arena_used[0] = 0;
+  if (bft_mem_have_memalign())
+    BFT_MEMALIGN(cs_cdo_local_arena_slab[0], CS_CL_SIZE,
+                 cs_cdo_local_arena_size, char);
+  else
+    BFT_MALLOC(cs_cdo_local_arena_slab[0], cs_cdo_local_arena_size, char);
+  memset(cs_cdo_local_arena_slab[0], 0, cs_cdo_local_arena_size);
+
 #endif /* openMP */
 }
 
@@ -207,6 +256,7 @@ cs_cdo_local_finalize(void)
     cs_face_mesh_light_free(&(cs_cdo_local_face_meshes_light[t_id]));
     BFT_FREE(cs_cdo_local_dbuf[t_id]);
     BFT_FREE(cs_cdo_local_kbuf[t_id]);
+    BFT_FREE(cs_cdo_local_arena_slab[t_id]);
 
   }
 #else
@@ -216,6 +266,7 @@ cs_cdo_local_finalize(void)
   cs_face_mesh_light_free(&(cs_cdo_local_face_meshes_light[0]));
   BFT_FREE(cs_cdo_local_dbuf[0]);
   BFT_FREE(cs_cdo_local_kbuf[0]);
+  BFT_FREE(cs_cdo_local_arena_slab[0]);
 #endif /* openMP */
 
   BFT_FREE(cs_cdo_local_cell_meshes);
@@ -223,6 +274,74 @@ cs_cdo_local_finalize(void)
   BFT_FREE(cs_cdo_local_face_meshes_light);
   BFT_FREE(cs_cdo_local_dbuf);
   BFT_FREE(cs_cdo_local_kbuf);
+  BFT_FREE(cs_cdo_local_arena_used);
+  BFT_FREE(cs_cdo_local_arena_slab);
+  cs_cdo_local_arena_size = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a work buffer inside the arena attached to the current
+ *         thread. Each buffer starts on its own cache line and remains
+ *         valid until \ref cs_cdo_local_finalize is called. If the arena
+ *         is exhausted or not allocated, NULL is returned and the caller
+ *         has to switch to a regular allocation.
+ *
+ * \param[in]  n_bytes   requested size in bytes
+ *
+ * \return a pointer to the beginning of the buffer or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_cdo_local_arena_alloc(size_t   n_bytes)
+{
+#if defined(HAVE_OPENMP)
+  const int  t_id = omp_get_thread_num();
+#else
+  const int  t_id = 0;
+#endif /* openMP */
+
+  if (cs_cdo_local_arena_slab == NULL || t_id >= cs_cdo_local_n_structures)
+    return NULL;
+
+  /* Round up to a cache line so that two buffers never share one */
+  const size_t  padded = CS_CL_SIZE * ((n_bytes + CS_CL_SIZE - 1)/CS_CL_SIZE);
+
+  if (cs_cdo_local_arena_used[t_id] + padded > cs_cdo_local_arena_size)
+    return NULL; /* Fallback managed by the caller */
+
+  void  *p = cs_cdo_local_arena_slab[t_id] + cs_cdo_local_arena_used[t_id];
+  cs_cdo_local_arena_used[t_id] += padded;
+
+  return p;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if a pointer has been handed out by the work-buffer arena.
+ *         Useful to know whether a buffer has to be freed on its own or is
+ *         released along with the arena.
+ *
+ * \param[in]  p    pointer to test (NULL returns false)
+ *
+ * \return true if the pointer lies inside one of the per-thread slabs
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_cdo_local_arena_contains(const void   *p)
+{
+  if (p == NULL || cs_cdo_local_arena_slab == NULL)
+    return false;
+
+  for (int i = 0; i < cs_cdo_local_n_structures; i++) {
+    const char  *s = cs_cdo_local_arena_slab[i];
+    if ((const char *)p >= s && (const char *)p < s + cs_cdo_local_arena_size)
+      return true;
+  }
+
+  return false;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -527,6 +646,16 @@ cs_cell_builder_free(cs_cell_builder_t     **p_cb)
   if (cb == NULL)
     return;
 
+  /* Buffers carved from the arena are released with the arena itself */
+  if (cs_cdo_local_arena_contains(cb->adv_fluxes))
+    cb->adv_fluxes = NULL;
+  if (cs_cdo_local_arena_contains(cb->ids))
+    cb->ids = NULL;
+  if (cs_cdo_local_arena_contains(cb->values))
+    cb->values = NULL;
+  if (cs_cdo_local_arena_contains(cb->vectors))
+    cb->vectors = NULL;
+
   BFT_FREE(cb->adv_fluxes);
   BFT_FREE(cb->ids);
   BFT_FREE(cb->values);
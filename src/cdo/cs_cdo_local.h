@@ -438,6 +438,38 @@ cs_cdo_local_initialize(const cs_cdo_connect_t     *connect);
 void
 cs_cdo_local_finalize(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate a work buffer inside the arena attached to the current
+ *         thread. Each buffer starts on its own cache line and remains
+ *         valid until \ref cs_cdo_local_finalize is called. If the arena
+ *         is exhausted or not allocated, NULL is returned and the caller
+ *         has to switch to a regular allocation.
+ *
+ * \param[in]  n_bytes   requested size in bytes
+ *
+ * \return a pointer to the beginning of the buffer or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_cdo_local_arena_alloc(size_t   n_bytes);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if a pointer has been handed out by the work-buffer arena.
+ *         Useful to know whether a buffer has to be freed on its own or is
+ *         released along with the arena.
+ *
+ * \param[in]  p    pointer to test (NULL returns false)
+ *
+ * \return true if the pointer lies inside one of the per-thread slabs
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_cdo_local_arena_contains(const void   *p);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Allocate a \ref cs_cell_sys_t structure
@@ -66,10 +66,13 @@
 #include "cs_evaluate.h"
 #include "cs_log.h"
 #include "cs_math.h"
+#include "cs_multigrid.h"
 #include "cs_navsto_coupling.h"
 #include "cs_param.h"
 #include "cs_post.h"
 #include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
 #include "cs_source_term.h"
 #include "cs_static_condensation.h"
 #include "cs_timer.h"
@@ -211,6 +214,33 @@ typedef struct {
 
 #define CS_CDOFB_MONOLITHIC_DBG      0
 
+/* Context related to the native block preconditioner: the velocity block is
+   handled by the in-house algebraic multigrid while the pressure block relies
+   on a diagonal approximation of the Schur complement (pressure mass matrix
+   scaled by the laminar viscosity) */
+
+typedef struct {
+
+  const cs_navsto_param_t   *nsp;          /* Set of parameters (shared) */
+
+  cs_lnum_t                  n_u_dofs;     /* 3 * n_faces */
+  cs_lnum_t                  n_p_dofs;     /* n_cells */
+
+  /* Velocity-velocity coupling extracted from the monolithic matrix */
+  cs_matrix_structure_t     *u_ms;
+  cs_matrix_t               *u_matrix;
+
+  cs_multigrid_t            *mg;           /* AMG for the velocity block */
+
+  cs_real_t                 *schur_diag_inv; /* Inverse of the diagonal
+                                                approx. of the Schur compl. */
+
+  cs_real_t                 *pc_aux;       /* Buffer for "in-place" apply */
+
+  int                        verbosity;
+
+} cs_cdofb_monolithic_pc_t;
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -636,6 +666,339 @@ _upper_schur_gmres_hook(void     *context,
 }
 #endif  /* HAVE_PETSC */
 
+/*----------------------------------------------------------------------------
+ * Return the type name of the native block preconditioner
+ *
+ * parameters:
+ *   context <-- pointer to preconditioner context
+ *   logging <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_block_amg_schur_pc_get_type(const void  *context,
+                             bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false) {
+    static const char t[] = "block_amg_schur";
+    return t;
+  }
+  else {
+    static const char t[] = N_("Block AMG-Schur");
+    return _(t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Free the setup of the native block preconditioner.
+ *
+ * The multigrid context is kept (only its hierarchy is freed) so that
+ * performance data remain available for logging.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_amg_schur_pc_free(void  *context)
+{
+  cs_cdofb_monolithic_pc_t  *pcc = context;
+
+  if (pcc == NULL)
+    return;
+
+  if (pcc->mg != NULL)
+    cs_multigrid_free(pcc->mg);
+
+  if (pcc->u_matrix != NULL)
+    cs_matrix_destroy(&(pcc->u_matrix));
+  if (pcc->u_ms != NULL)
+    cs_matrix_structure_destroy(&(pcc->u_ms));
+
+  BFT_FREE(pcc->schur_diag_inv);
+  BFT_FREE(pcc->pc_aux);
+}
+
+/*----------------------------------------------------------------------------
+ * Setup the native block preconditioner.
+ *
+ * The rank-local part of the velocity-velocity coupling is extracted from
+ * the monolithic matrix and handed over to the in-house algebraic multigrid.
+ * The diagonal approximation of the Schur complement is built from the cell
+ * volumes and the laminar viscosity.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_amg_schur_pc_setup(void               *context,
+                          const char         *name,
+                          const cs_matrix_t  *a,
+                          int                 verbosity)
+{
+  cs_cdofb_monolithic_pc_t  *pcc = context;
+
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_real_t  t_eval = cs_shared_time_step->t_cur;
+  const cs_lnum_t  n_u_dofs = 3*quant->n_faces;
+  const cs_lnum_t  n_p_dofs = quant->n_cells;
+
+  /* Free a possible previous setup */
+  _block_amg_schur_pc_free(pcc);
+
+  pcc->n_u_dofs = n_u_dofs;
+  pcc->n_p_dofs = n_p_dofs;
+  pcc->verbosity = verbosity;
+
+  assert(cs_matrix_get_n_rows(a) == n_u_dofs + n_p_dofs);
+
+  /* Extract the velocity-velocity coupling from the monolithic matrix.
+     Column ids remain sorted row by row since one keeps the original
+     ordering */
+  const cs_lnum_t  *row_index = NULL, *col_id = NULL;
+  const cs_real_t  *d_val = NULL, *x_val = NULL;
+
+  cs_matrix_get_msr_arrays(a, &row_index, &col_id, &d_val, &x_val);
+
+  cs_lnum_t  *u_row_index = NULL, *u_col_id = NULL;
+  cs_real_t  *u_d_val = NULL, *u_x_val = NULL;
+
+  BFT_MALLOC(u_row_index, n_u_dofs + 1, cs_lnum_t);
+  BFT_MALLOC(u_col_id, row_index[n_u_dofs], cs_lnum_t);
+  BFT_MALLOC(u_x_val, row_index[n_u_dofs], cs_real_t);
+  BFT_MALLOC(u_d_val, n_u_dofs, cs_real_t);
+
+  memcpy(u_d_val, d_val, n_u_dofs*sizeof(cs_real_t));
+
+  cs_lnum_t  nnz = 0;
+  u_row_index[0] = 0;
+  for (cs_lnum_t r = 0; r < n_u_dofs; r++) {
+    for (cs_lnum_t j = row_index[r]; j < row_index[r+1]; j++) {
+      if (col_id[j] < n_u_dofs) {
+        u_col_id[nnz] = col_id[j];
+        u_x_val[nnz] = x_val[j];
+        nnz++;
+      }
+    }
+    u_row_index[r+1] = nnz;
+  }
+
+  BFT_REALLOC(u_col_id, nnz, cs_lnum_t);
+  BFT_REALLOC(u_x_val, nnz, cs_real_t);
+
+  pcc->u_ms = cs_matrix_structure_create_msr(CS_MATRIX_MSR,
+                                             true, /* transfer ownership */
+                                             true, /* have_diag */
+                                             n_u_dofs,
+                                             n_u_dofs,
+                                             &u_row_index,
+                                             &u_col_id,
+                                             NULL,  /* no halo */
+                                             NULL); /* no numbering */
+
+  pcc->u_matrix = cs_matrix_create(pcc->u_ms);
+
+  cs_matrix_transfer_coefficients_msr(pcc->u_matrix,
+                                      false, /* not symmetric */
+                                      NULL, NULL,
+                                      NULL, NULL, /* checked for MSR */
+                                      &u_d_val,
+                                      &u_x_val);
+
+  /* Build the grid hierarchy for the velocity block */
+  cs_multigrid_setup(pcc->mg, name, pcc->u_matrix, verbosity);
+
+  /* Diagonal approximation of the Schur complement: pressure mass matrix
+     scaled by the laminar viscosity */
+  BFT_MALLOC(pcc->schur_diag_inv, n_p_dofs, cs_real_t);
+
+  const cs_property_t  *visc = pcc->nsp->lami_viscosity;
+
+# pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_p_dofs; c_id++)
+    pcc->schur_diag_inv[c_id] =
+      cs_property_get_cell_value(c_id, t_eval, visc)/quant->cell_vol[c_id];
+}
+
+/*----------------------------------------------------------------------------
+ * Apply the native block preconditioner: one multigrid cycle on the velocity
+ * block and a diagonal scaling on the pressure block.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified.
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   rotation_mode <-- halo update option for rotational periodicity
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_block_amg_schur_pc_apply(void                *context,
+                          cs_halo_rotation_t   rotation_mode,
+                          const cs_real_t     *x_in,
+                          cs_real_t           *x_out)
+{
+  int  n_iter;
+  double  residue;
+
+  cs_cdofb_monolithic_pc_t  *pcc = context;
+
+  const cs_lnum_t  n_u_dofs = pcc->n_u_dofs;
+  const cs_lnum_t  n_p_dofs = pcc->n_p_dofs;
+  const cs_real_t  *r = x_in;
+
+  /* If preconditioner is "in-place", use an additional buffer */
+  if (x_in == NULL) {
+    if (pcc->pc_aux == NULL)
+      BFT_MALLOC(pcc->pc_aux, n_u_dofs + n_p_dofs, cs_real_t);
+    memcpy(pcc->pc_aux, x_out, (n_u_dofs + n_p_dofs)*sizeof(cs_real_t));
+    r = pcc->pc_aux;
+  }
+
+  /* Pressure block: diagonal approximation of the Schur complement */
+# pragma omp parallel for if (n_p_dofs > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_p_dofs; c_id++)
+    x_out[n_u_dofs + c_id] = pcc->schur_diag_inv[c_id]*r[n_u_dofs + c_id];
+
+  /* Velocity block: one multigrid cycle starting from a zero guess */
+# pragma omp parallel for if (n_u_dofs > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_u_dofs; i++)
+    x_out[i] = 0.;
+
+  cs_sles_convergence_state_t  cvg = cs_multigrid_solve(pcc->mg,
+                                                        "velocity_block",
+                                                        pcc->u_matrix,
+                                                        pcc->verbosity,
+                                                        rotation_mode,
+                                                        1e-1, /* precision */
+                                                        1.0,  /* r_norm */
+                                                        &n_iter,
+                                                        &residue,
+                                                        r,
+                                                        x_out,
+                                                        0,
+                                                        NULL);
+
+  cs_sles_pc_state_t state;
+
+  switch(cvg) {
+  case CS_SLES_DIVERGED:
+    state = CS_SLES_PC_DIVERGED;
+    break;
+  case CS_SLES_BREAKDOWN:
+    state = CS_SLES_PC_BREAKDOWN;
+    break;
+  case CS_SLES_CONVERGED:
+    state = CS_SLES_PC_CONVERGED;
+    break;
+  default:
+    state = CS_SLES_PC_MAX_ITERATION;
+  }
+
+  return state;
+}
+
+/*----------------------------------------------------------------------------
+ * Create the multigrid context used for the velocity block and define its
+ * settings (one cycle with symmetric Gauss-Seidel smoothers since it acts
+ * as a preconditioner)
+ *
+ * returns:
+ *   pointer to a new cs_multigrid_t context
+ *----------------------------------------------------------------------------*/
+
+static cs_multigrid_t *
+_block_amg_schur_pc_create_mg(void)
+{
+  cs_multigrid_t  *mg = cs_multigrid_create(CS_MULTIGRID_V_CYCLE);
+
+  cs_multigrid_set_solver_options
+    (mg,
+     CS_SLES_P_SYM_GAUSS_SEIDEL, /* descent smoother */
+     CS_SLES_P_SYM_GAUSS_SEIDEL, /* ascent smoother */
+     CS_SLES_PCG,                /* coarse solver */
+     1,                          /* n_max_cycles */
+     1,                          /* n_max_iter_descent */
+     1,                          /* n_max_iter_ascent */
+     500,                        /* n_max_iter_coarse */
+     0,                          /* poly_degree_descent */
+     0,                          /* poly_degree_ascent */
+     0,                          /* poly_degree_coarse */
+     -1.0,                       /* precision_mult_descent */
+     -1.0,                       /* precision_mult_ascent */
+     1.0);                       /* precision_mult_coarse */
+
+  return mg;
+}
+
+/*----------------------------------------------------------------------------
+ * Duplicate the settings of a native block preconditioner context
+ *
+ * parameters:
+ *   context <-- pointer to preconditioner context to clone
+ *
+ * returns:
+ *   pointer to newly created preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_block_amg_schur_pc_clone(const void  *context)
+{
+  const cs_cdofb_monolithic_pc_t  *pcc = context;
+
+  cs_cdofb_monolithic_pc_t  *pcc_clone = NULL;
+  BFT_MALLOC(pcc_clone, 1, cs_cdofb_monolithic_pc_t);
+
+  pcc_clone->nsp = pcc->nsp;
+  pcc_clone->n_u_dofs = 0;
+  pcc_clone->n_p_dofs = 0;
+  pcc_clone->u_ms = NULL;
+  pcc_clone->u_matrix = NULL;
+  pcc_clone->mg = _block_amg_schur_pc_create_mg();
+  pcc_clone->schur_diag_inv = NULL;
+  pcc_clone->pc_aux = NULL;
+  pcc_clone->verbosity = pcc->verbosity;
+
+  return pcc_clone;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a native block preconditioner context
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_block_amg_schur_pc_destroy(void  **context)
+{
+  if (context == NULL)
+    return;
+
+  cs_cdofb_monolithic_pc_t  *pcc = *context;
+
+  if (pcc == NULL)
+    return;
+
+  _block_amg_schur_pc_free(pcc);
+
+  if (pcc->mg != NULL)
+    cs_multigrid_destroy((void **)&(pcc->mg));
+
+  BFT_FREE(*context);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define the cs_range_set_t, cs_interface_set_t, cs_matrix_assembler_t
@@ -1227,7 +1590,7 @@ _solve_system(cs_sles_t                     *sles,
   BFT_MALLOC(b, n_scatter_elts, cs_real_t);
 
   /* De-interlace the velocity array and the rhs for the face DoFs */
-# pragma omp parallel for if (CS_THR_MIN > n_faces) default(none) \
+# pragma omp parallel for if (CS_THR_MIN > n_faces) \
   shared(vel_f, b_f, xsol, b)
   for (cs_lnum_t f = 0; f < n_faces; f++) {
 
@@ -1295,7 +1658,7 @@ _solve_system(cs_sles_t                     *sles,
 #endif
 
   /* Interlace xsol --> vel_f and pre_c */
-# pragma omp parallel for if (CS_THR_MIN > n_faces) default(none) \
+# pragma omp parallel for if (CS_THR_MIN > n_faces) \
   shared(vel_f, xsol)
   for (cs_lnum_t f = 0; f < n_faces; f++) {
 
@@ -1363,19 +1726,14 @@ _compute_and_update_fields(const cs_matrix_t             *matrix,
   t_upd = cs_timer_time();
 
   /* Compute values at cells vel_c from values at faces vel_f
-     vel_c = acc^-1*(RHS - Acf*vel_f) */
-  cs_static_condensation_recover_vector(connect->c2f,
-                                        mom_eqc->rc_tilda,
-                                        mom_eqc->acf_tilda,
-                                        vel_f, vel_fld->val);
-
-  /* Update the divergence of the velocity field */
-  cs_real_t  *div = sc->divergence->val;
-
-# pragma omp parallel for if (quant->n_cells > CS_THR_MIN)
-  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++)
-    div[c_id] = cs_cdofb_navsto_cell_divergence(c_id,
-                                                quant, connect->c2f, vel_f);
+     vel_c = acc^-1*(RHS - Acf*vel_f)
+     and update the divergence of the velocity field in the same sweep */
+  cs_static_condensation_recover_vector_div(connect->c2f,
+                                            quant,
+                                            mom_eqc->rc_tilda,
+                                            mom_eqc->acf_tilda,
+                                            vel_f, vel_fld->val,
+                                            sc->divergence->val);
 
   /* Rescale pressure */
   cs_cdofb_navsto_set_zero_mean_pressure(quant, pr_fld->val);
@@ -1584,6 +1942,49 @@ cs_cdofb_monolithic_set_sles(const cs_navsto_param_t    *nsp,
     cs_equation_param_set_sles(mom_eqp, field_id);
     break;
 
+  case CS_NAVSTO_SLES_BLOCK_AMG_SCHUR: /* In-house block preconditioner */
+    {
+      if (cs_glob_n_ranks > 1)
+        bft_error(__FILE__, __LINE__, 0,
+                  "%s: Invalid strategy for solving the linear system %s\n"
+                  " The \"block_amg_schur\" strategy is not available yet in"
+                  " parallel computations.\n"
+                  " Please use one of the PETSc-based strategies instead.",
+                  __func__, mom_eqp->name);
+
+      cs_cdofb_monolithic_pc_t  *pcc = NULL;
+      BFT_MALLOC(pcc, 1, cs_cdofb_monolithic_pc_t);
+
+      pcc->nsp = nsp;
+      pcc->n_u_dofs = 0;
+      pcc->n_p_dofs = 0;
+      pcc->u_ms = NULL;
+      pcc->u_matrix = NULL;
+      pcc->mg = _block_amg_schur_pc_create_mg();
+      pcc->schur_diag_inv = NULL;
+      pcc->pc_aux = NULL;
+      pcc->verbosity = mom_eqp->sles_param.verbosity;
+
+      cs_sles_it_t  *it = cs_sles_it_define(field_id,
+                                            NULL,
+                                            CS_SLES_GMRES,
+                                            -1, /* preconditioner below */
+                                            mom_eqp->sles_param.n_max_iter);
+
+      cs_sles_pc_t  *pc = cs_sles_pc_define(pcc,
+                                            _block_amg_schur_pc_get_type,
+                                            _block_amg_schur_pc_setup,
+                                            NULL, /* tolerance */
+                                            _block_amg_schur_pc_apply,
+                                            _block_amg_schur_pc_free,
+                                            NULL, /* log */
+                                            _block_amg_schur_pc_clone,
+                                            _block_amg_schur_pc_destroy);
+
+      cs_sles_it_transfer_pc(it, &pc);
+    }
+    break;
+
 #if defined(HAVE_PETSC)
   case CS_NAVSTO_SLES_ADDITIVE_GMRES_BY_BLOCK:
     cs_sles_petsc_init();
@@ -1703,7 +2104,7 @@ cs_cdofb_monolithic_compute_steady(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav =
     cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, mom_eqp, mom_eqb, mom_eqc, rhs, matrix, nsp,   \
          mass_rhs, mav, dir_values, vel_c, sc)
   {
@@ -1936,7 +2337,7 @@ cs_cdofb_monolithic_compute_implicit(const cs_mesh_t          *mesh,
   cs_matrix_assembler_values_t  *mav =
     cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, mom_eqp, mom_eqb, mom_eqc, rhs, matrix, nsp,   \
          mass_rhs, mav, dir_values, vel_c, sc)
   {
@@ -2199,7 +2600,7 @@ cs_cdofb_monolithic_compute_theta(const cs_mesh_t          *mesh,
   cs_matrix_assembler_values_t  *mav =
     cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, mom_eqp, mom_eqb, mom_eqc, rhs, matrix, nsp,   \
          mass_rhs, mav, dir_values, vel_c, sc, compute_initial_source)
   {
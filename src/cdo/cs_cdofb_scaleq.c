@@ -129,18 +129,28 @@ _cell_builder_create(const cs_cdo_connect_t   *connect)
 
   cs_cell_builder_t *cb = cs_cell_builder_create();
 
-  BFT_MALLOC(cb->adv_fluxes, n_fc, double);
+  /* Carve the work arrays from the per-thread arena so that they lie in one
+     contiguous cache-aligned slab (cf. \ref cs_cdo_local_arena_alloc) */
+  cb->adv_fluxes = cs_cdo_local_arena_alloc(n_fc*sizeof(double));
+  if (cb->adv_fluxes == NULL)
+    BFT_MALLOC(cb->adv_fluxes, n_fc, double);
   memset(cb->adv_fluxes, 0, n_fc*sizeof(double));
 
-  BFT_MALLOC(cb->ids, n_fc, short int);
+  cb->ids = cs_cdo_local_arena_alloc(n_fc*sizeof(short int));
+  if (cb->ids == NULL)
+    BFT_MALLOC(cb->ids, n_fc, short int);
   memset(cb->ids, 0, n_fc*sizeof(short int));
 
   int  size = n_fc*(n_fc+1);
-  BFT_MALLOC(cb->values, size, double);
+  cb->values = cs_cdo_local_arena_alloc(size*sizeof(double));
+  if (cb->values == NULL)
+    BFT_MALLOC(cb->values, size, double);
   memset(cb->values, 0, size*sizeof(double));
 
   size = 2*n_fc;
-  BFT_MALLOC(cb->vectors, size, cs_real_3_t);
+  cb->vectors = cs_cdo_local_arena_alloc(size*sizeof(cs_real_3_t));
+  if (cb->vectors == NULL)
+    BFT_MALLOC(cb->vectors, size, cs_real_3_t);
   memset(cb->vectors, 0, size*sizeof(cs_real_3_t));
 
   /* Local square dense matrices used during the construction of
@@ -1181,7 +1191,7 @@ cs_cdofb_scaleq_solve_steady_state(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, rs,           \
          dir_values, fld, cs_cdofb_cell_sys, cs_cdofb_cell_bld)
   {
@@ -1390,7 +1400,7 @@ cs_cdofb_scaleq_solve_implicit(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, rs,           \
          dir_values, fld, cs_cdofb_cell_sys, cs_cdofb_cell_bld)
   {
@@ -1641,7 +1651,7 @@ cs_cdofb_scaleq_solve_theta(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, rs,           \
          dir_values, fld, cs_cdofb_cell_sys, cs_cdofb_cell_bld,         \
          compute_initial_source)
@@ -1895,7 +1905,7 @@ cs_cdofb_scaleq_balance(const cs_equation_param_t     *eqp,
   cs_equation_balance_t  *eb = cs_equation_balance_create(cs_flag_primal_cell,
                                                           quant->n_cells);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, pot, eb, cs_cdofb_cell_bld)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -2119,7 +2129,7 @@ cs_cdofb_scaleq_boundary_diff_flux(const cs_real_t              t_eval,
     return;
   }
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, bflux, pot_c, pot_f,                 \
          cs_cdofb_cell_bld)
   {
@@ -941,7 +941,7 @@ cs_cdofb_uzawa_compute_steady(const cs_mesh_t              *mesh,
   cs_matrix_assembler_values_t  *mav =
     cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
-# pragma omp parallel if (n_cells > CS_THR_MIN) default(none)           \
+# pragma omp parallel if (n_cells > CS_THR_MIN)           \
   shared(quant, connect, mom_eqp, mom_eqb, mom_eqc, rhs, matrix, nsp,   \
          mav, rs, dir_values, zeta, vel_c, pr, sc)
   {
@@ -1398,7 +1398,7 @@ cs_cdofb_uzawa_compute_implicit(const cs_mesh_t              *mesh,
   cs_matrix_assembler_values_t  *mav =
     cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
-# pragma omp parallel if (n_cells > CS_THR_MIN) default(none)           \
+# pragma omp parallel if (n_cells > CS_THR_MIN)           \
   shared(quant, connect, mom_eqp, mom_eqb, mom_eqc, rhs, matrix, nsp,   \
          mav, rs, dir_values, zeta, vel_c, pr, sc)
   {
@@ -1876,7 +1876,7 @@ cs_cdofb_uzawa_compute_theta(const cs_mesh_t              *mesh,
   cs_matrix_assembler_values_t  *mav =
     cs_matrix_assembler_values_init(matrix, NULL, NULL);
 
-# pragma omp parallel if (n_cells > CS_THR_MIN) default(none)           \
+# pragma omp parallel if (n_cells > CS_THR_MIN)           \
   shared(quant, connect, mom_eqp, mom_eqb, mom_eqc, rhs, matrix, nsp,   \
          mav, rs, dir_values, zeta, vel_c, pr, sc, compute_initial_source)
   {
@@ -122,15 +122,23 @@ _cell_builder_create(const cs_cdo_connect_t   *connect)
 
   cs_cell_builder_t *cb = cs_cell_builder_create();
 
-  BFT_MALLOC(cb->ids, n_dofs, short int);
+  /* Carve the work arrays from the per-thread arena so that they lie in one
+     contiguous cache-aligned slab (cf. \ref cs_cdo_local_arena_alloc) */
+  cb->ids = cs_cdo_local_arena_alloc(n_dofs*sizeof(short int));
+  if (cb->ids == NULL)
+    BFT_MALLOC(cb->ids, n_dofs, short int);
   memset(cb->ids, 0, n_dofs*sizeof(short int));
 
   int  size = CS_MAX(n_fc*n_dofs, 6*n_dofs);
-  BFT_MALLOC(cb->values, size, double);
+  cb->values = cs_cdo_local_arena_alloc(size*sizeof(double));
+  if (cb->values == NULL)
+    BFT_MALLOC(cb->values, size, double);
   memset(cb->values, 0, size*sizeof(cs_real_t));
 
   size = 2*n_fc;
-  BFT_MALLOC(cb->vectors, size, cs_real_3_t);
+  cb->vectors = cs_cdo_local_arena_alloc(size*sizeof(cs_real_3_t));
+  if (cb->vectors == NULL)
+    BFT_MALLOC(cb->vectors, size, cs_real_3_t);
   memset(cb->vectors, 0, size*sizeof(cs_real_3_t));
 
   short int  *block_sizes = cb->ids;
@@ -590,7 +598,7 @@ cs_cdofb_vecteq_solve_steady_state(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, rs,           \
          dir_values, fld, cs_cdofb_cell_sys, cs_cdofb_cell_bld)
   {
@@ -789,7 +797,7 @@ cs_cdofb_vecteq_solve_implicit(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, rs,           \
          dir_values, fld, cs_cdofb_cell_sys, cs_cdofb_cell_bld)
   {
@@ -1020,7 +1028,7 @@ cs_cdofb_vecteq_solve_theta(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)    \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)    \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, rs, dir_values, \
          fld, cs_cdofb_cell_sys, cs_cdofb_cell_bld, compute_initial_source)
   {
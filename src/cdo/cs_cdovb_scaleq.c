@@ -671,6 +671,64 @@ _vbs_solve_system(cs_sles_t                    *sles,
   return n_iters;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Allocate and reset per-thread staging slices used to scatter the
+ *         cellwise RHS contributions without atomic updates
+ *
+ * \param[in] n_dofs     number of degrees of freedom
+ *
+ * \return a pointer to the staging array or NULL when single-threaded
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_vbs_init_rhs_staging(cs_lnum_t    n_dofs)
+{
+  if (cs_glob_n_threads < 2)
+    return NULL;
+
+  cs_real_t  *stage = NULL;
+  const cs_lnum_t  size = cs_glob_n_threads * n_dofs;
+
+  BFT_MALLOC(stage, size, cs_real_t);
+# pragma omp parallel for if (size > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < size; i++) stage[i] = 0.;
+
+  return stage;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Merge the per-thread staged contributions into a global array.
+ *         To be called inside an OpenMP parallel region after the main loop
+ *         on cells: rows are partitioned into thread-owned ranges so that no
+ *         synchronization is needed and the thread-ordered summation makes
+ *         the result independent of the scheduling
+ *
+ * \param[in]      n_dofs     number of degrees of freedom
+ * \param[in]      stage      per-thread staged contributions (may be NULL)
+ * \param[in, out] values     global array to update
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_vbs_merge_rhs_staging(cs_lnum_t           n_dofs,
+                       const cs_real_t    *stage,
+                       cs_real_t          *values)
+{
+  if (stage == NULL)
+    return;
+
+# pragma omp for
+  for (cs_lnum_t i = 0; i < n_dofs; i++) {
+    cs_real_t  sum = 0.;
+    for (int t = 0; t < cs_glob_n_threads; t++)
+      sum += stage[t*n_dofs + i];
+    values[i] += sum;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -892,6 +950,15 @@ cs_cdovb_scaleq_init_context(const cs_equation_param_t   *eqp,
 
     } /* Switch on Hodge algo. */
 
+    /* A steady diffusion property on a static mesh yields time-independent
+       local stiffness matrices: claim the cellwise cache so that the
+       matrices built during the first pass are reused at the subsequent
+       time steps */
+    if (cs_property_is_steady(eqp->diffusion_property))
+      cs_hodge_set_stiffness_cache(eqc,
+                                   connect->n_cells,
+                                   connect->n_max_vbyc);
+
   } /* Diffusion */
 
   /* Boundary conditions */
@@ -1156,6 +1223,9 @@ cs_cdovb_scaleq_free_context(void   *builder)
   BFT_FREE(eqc->cell_values);
   BFT_FREE(eqc->vtx_bc_flag);
 
+  /* Release the stiffness cache if this context owns it */
+  cs_hodge_free_stiffness_cache(eqc);
+
   /* Last free */
   BFT_FREE(eqc);
 
@@ -1309,15 +1379,23 @@ cs_cdovb_scaleq_solve_steady_state(const cs_mesh_t            *mesh,
 # pragma omp parallel for if  (n_vertices > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
 
+  /* Per-thread staging slices to scatter the cellwise RHS contributions
+     without atomic updates */
+  cs_real_t  *rhs_stage = _vbs_init_rhs_staging(n_vertices);
+
   /* Initialize the structure to assemble values */
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
+  /* Activate the stiffness cache if this context owns it (no-op
+     otherwise) */
+  cs_hodge_open_stiffness_cache(eqc);
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, dir_values,   \
          forced_ids, fld, rs, _vbs_cell_system, _vbs_cell_builder)
   {
@@ -1338,6 +1416,10 @@ cs_cdovb_scaleq_solve_steady_state(const cs_mesh_t            *mesh,
     cs_cell_sys_t  *csys = _vbs_cell_system[t_id];
     cs_cell_builder_t  *cb = _vbs_cell_builder[t_id];
 
+    /* Where to accumulate the cellwise RHS contributions */
+    cs_real_t  *rhs_acc = (rhs_stage != NULL) ?
+      rhs_stage + (cs_lnum_t)t_id * n_vertices : rhs;
+
     /* Store the shift to access border faces (first interior faces and
        then border faces: shift = n_i_faces */
     csys->face_shift = connect->n_faces[CS_INT_FACES];
@@ -1407,15 +1489,20 @@ cs_cdovb_scaleq_solve_steady_state(const cs_mesh_t            *mesh,
       eqc->assemble(csys, rs, mab, mav);       /* Matrix assembly */
 
       for (short int v = 0; v < cm->n_vc; v++) /* RHS assembly*/
-#       pragma omp atomic
-        rhs[cm->v_ids[v]] += csys->rhs[v];
+        rhs_acc[cm->v_ids[v]] += csys->rhs[v];
 
       /* **********************  END OF ASSEMBLY PROCESS  ******************* */
 
     } /* Main loop on cells */
 
+    /* Merge the RHS contributions staged by each thread (implicit barrier
+       at the end of the previous loop) */
+    _vbs_merge_rhs_staging(n_vertices, rhs_stage, rhs);
+
   } /* OPENMP Block */
 
+  cs_hodge_close_stiffness_cache();
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
@@ -1438,6 +1525,7 @@ cs_cdovb_scaleq_solve_steady_state(const cs_mesh_t            *mesh,
 
   /* Free remaining buffers */
   BFT_FREE(rhs);
+  BFT_FREE(rhs_stage);
   cs_matrix_destroy(&matrix);
 }
 
@@ -1496,15 +1584,23 @@ cs_cdovb_scaleq_solve_implicit(const cs_mesh_t            *mesh,
 # pragma omp parallel for if  (n_vertices > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
 
+  /* Per-thread staging slices to scatter the cellwise RHS contributions
+     without atomic updates */
+  cs_real_t  *rhs_stage = _vbs_init_rhs_staging(n_vertices);
+
   /* Initialize the structure to assemble values */
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
+  /* Activate the stiffness cache if this context owns it (no-op
+     otherwise) */
+  cs_hodge_open_stiffness_cache(eqc);
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, dir_values,   \
          forced_ids, fld, rs, _vbs_cell_system, _vbs_cell_builder)
   {
@@ -1525,6 +1621,10 @@ cs_cdovb_scaleq_solve_implicit(const cs_mesh_t            *mesh,
     cs_cell_sys_t  *csys = _vbs_cell_system[t_id];
     cs_cell_builder_t  *cb = _vbs_cell_builder[t_id];
 
+    /* Where to accumulate the cellwise RHS contributions */
+    cs_real_t  *rhs_acc = (rhs_stage != NULL) ?
+      rhs_stage + (cs_lnum_t)t_id * n_vertices : rhs;
+
     /* Store the shift to access border faces (first interior faces and
        then border faces: shift = n_i_faces */
     csys->face_shift = connect->n_faces[CS_INT_FACES];
@@ -1644,15 +1744,20 @@ cs_cdovb_scaleq_solve_implicit(const cs_mesh_t            *mesh,
       eqc->assemble(csys, rs, mab, mav);       /* Matrix assembly */
 
       for (short int v = 0; v < cm->n_vc; v++) /* RHS assembly */
-#       pragma omp atomic
-        rhs[cm->v_ids[v]] += csys->rhs[v];
+        rhs_acc[cm->v_ids[v]] += csys->rhs[v];
 
       /* **********************  END OF ASSEMBLY PROCESS  ******************* */
 
     } /* Main loop on cells */
 
+    /* Merge the RHS contributions staged by each thread (implicit barrier
+       at the end of the previous loop) */
+    _vbs_merge_rhs_staging(n_vertices, rhs_stage, rhs);
+
   } /* OPENMP Block */
 
+  cs_hodge_close_stiffness_cache();
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
@@ -1674,6 +1779,7 @@ cs_cdovb_scaleq_solve_implicit(const cs_mesh_t            *mesh,
 
   /* Free remaining buffers */
   BFT_FREE(rhs);
+  BFT_FREE(rhs_stage);
   cs_matrix_destroy(&matrix);
 }
 
@@ -1733,6 +1839,10 @@ cs_cdovb_scaleq_solve_theta(const cs_mesh_t            *mesh,
 # pragma omp parallel for if  (n_vertices > CS_THR_MIN)
   for (cs_lnum_t i = 0; i < n_vertices; i++) rhs[i] = 0.0;
 
+  /* Per-thread staging slices to scatter the cellwise RHS contributions
+     without atomic updates */
+  cs_real_t  *rhs_stage = _vbs_init_rhs_staging(n_vertices);
+
   /* Detect the first call (in this case, we compute the initial source term)*/
   _Bool  compute_initial_source = false;
   if (ts->nt_cur == ts->nt_prev || ts->nt_prev == 0) {
@@ -1763,6 +1873,10 @@ cs_cdovb_scaleq_solve_theta(const cs_mesh_t            *mesh,
 
   }
 
+  /* Same staging mechanism for the source term array */
+  cs_real_t  *st_stage = (eqc->source_terms != NULL) ?
+    _vbs_init_rhs_staging(n_vertices) : NULL;
+
   /* Initialize the local system: matrix */
   cs_matrix_t  *matrix = cs_matrix_create(cs_shared_ms);
 
@@ -1770,11 +1884,15 @@ cs_cdovb_scaleq_solve_theta(const cs_mesh_t            *mesh,
   cs_matrix_assembler_values_t  *mav
     = cs_equation_get_mav(matrix, eqp->omp_assembly_choice, 1);
 
+  /* Activate the stiffness cache if this context owns it (no-op
+     otherwise) */
+  cs_hodge_open_stiffness_cache(eqc);
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav,               \
          dir_values, fld, forced_ids, rs, compute_initial_source,       \
          _vbs_cell_system, _vbs_cell_builder)
@@ -1798,6 +1916,12 @@ cs_cdovb_scaleq_solve_theta(const cs_mesh_t            *mesh,
     cs_cell_sys_t  *csys = _vbs_cell_system[t_id];
     cs_cell_builder_t  *cb = _vbs_cell_builder[t_id];
 
+    /* Where to accumulate the cellwise RHS and source term contributions */
+    cs_real_t  *rhs_acc = (rhs_stage != NULL) ?
+      rhs_stage + (cs_lnum_t)t_id * n_vertices : rhs;
+    cs_real_t  *st_acc = (st_stage != NULL) ?
+      st_stage + (cs_lnum_t)t_id * n_vertices : eqc->source_terms;
+
     /* Store the shift to access border faces (first interior faces and
        then border faces: shift = n_i_faces */
     csys->face_shift = connect->n_faces[CS_INT_FACES];
@@ -1952,26 +2076,32 @@ cs_cdovb_scaleq_solve_theta(const cs_mesh_t            *mesh,
       eqc->assemble(csys, rs, mab, mav);         /* Matrix assembly */
 
       for (short int v = 0; v < cm->n_vc; v++)   /* RHS assembly */
-#       pragma omp atomic
-        rhs[cm->v_ids[v]] += csys->rhs[v];
+        rhs_acc[cm->v_ids[v]] += csys->rhs[v];
 
       if (eqc->source_terms != NULL) {
         for (short int v = 0; v < cm->n_vc; v++) /* Source term assembly */
-#         pragma omp atomic
-          eqc->source_terms[cm->v_ids[v]] += csys->source[v];
+          st_acc[cm->v_ids[v]] += csys->source[v];
       }
 
       /* **********************  END OF ASSEMBLY PROCESS  ******************* */
 
     } /* Main loop on cells */
 
+    /* Merge the contributions staged by each thread (implicit barrier
+       at the end of the previous loop) */
+    _vbs_merge_rhs_staging(n_vertices, rhs_stage, rhs);
+    _vbs_merge_rhs_staging(n_vertices, st_stage, eqc->source_terms);
+
   } /* OPENMP Block */
 
+  cs_hodge_close_stiffness_cache();
+
   cs_matrix_assembler_values_done(mav); /* optional */
 
   /* Free temporary buffers and structures */
   BFT_FREE(dir_values);
   BFT_FREE(forced_ids);
+  BFT_FREE(st_stage);
   cs_matrix_assembler_values_finalize(&mav);
 
   /* End of the system building */
@@ -1988,6 +2118,7 @@ cs_cdovb_scaleq_solve_theta(const cs_mesh_t            *mesh,
 
   /* Free remaining buffers */
   BFT_FREE(rhs);
+  BFT_FREE(rhs_stage);
   cs_matrix_destroy(&matrix);
 }
 
@@ -2086,7 +2217,7 @@ cs_cdovb_scaleq_balance(const cs_equation_param_t     *eqp,
                                                           quant->n_vertices);
 
   /* OpenMP block */
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, eqc, pot, eb, _vbs_cell_builder)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -2397,7 +2528,7 @@ cs_cdovb_scaleq_boundary_diff_flux(const cs_real_t              t_eval,
     return;
   }
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, vf_flux, pdi, _vbs_cell_builder)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -2789,7 +2920,7 @@ cs_cdovb_scaleq_diff_flux_in_cells(const cs_real_t             *values,
 
   cs_timer_t  t0 = cs_timer_time();
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)        \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)        \
   shared(t_eval, quant, connect, eqp, eqb, diff_flux, values, _vbs_cell_builder)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -2922,7 +3053,7 @@ cs_cdovb_scaleq_diff_flux_dfaces(const cs_real_t             *values,
 
   cs_timer_t  t0 = cs_timer_time();
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(t_eval, quant, connect, eqp, eqb, diff_flux, values,           \
          _vbs_cell_builder)
   {
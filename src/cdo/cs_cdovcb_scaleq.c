@@ -1239,7 +1239,7 @@ cs_cdovcb_scaleq_solve_steady_state(const cs_mesh_t            *mesh,
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, dir_values,   \
          fld, rs, _vcbs_cell_system, _vcbs_cell_builder)
   {
@@ -1451,7 +1451,7 @@ cs_cdovcb_scaleq_solve_implicit(const cs_mesh_t            *mesh,
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)     \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)     \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, dir_values,   \
          fld, rs, _vcbs_cell_system, _vcbs_cell_builder)
   {
@@ -1747,7 +1747,7 @@ cs_cdovcb_scaleq_solve_theta(const cs_mesh_t            *mesh,
   /* Main OpenMP block on cell */
   /* ------------------------- */
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)   \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)   \
   shared(quant, connect, eqp, eqb, eqc, rhs, matrix, mav, dir_values, \
          fld, rs, _vcbs_cell_system,                                  \
          _vcbs_cell_builder, compute_initial_source)
@@ -2088,7 +2088,7 @@ cs_cdovcb_scaleq_boundary_diff_flux(const cs_real_t              t_eval,
     return;
   }
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)        \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)        \
   shared(quant, connect, eqp, eqb, vf_flux, pot_v, pot_c, _vcbs_cell_builder)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -2465,7 +2465,7 @@ cs_cdovcb_scaleq_diff_flux_in_cells(const cs_real_t             *values,
 
   cs_timer_t  t0 = cs_timer_time();
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)   \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)   \
   shared(quant, connect, eqp, eqb, eqc, diff_flux, values,            \
          t_eval, _vcbs_cell_builder)
   {
@@ -2557,7 +2557,7 @@ cs_cdovcb_scaleq_diff_flux_dfaces(const cs_real_t             *values,
 
   cs_timer_t  t0 = cs_timer_time();
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)   \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)   \
   shared(quant, connect, eqp, eqb, eqc, diff_flux, values,            \
          t_eval, _vcbs_cell_builder)
   {
@@ -2647,7 +2647,7 @@ cs_cdovcb_scaleq_vtx_gradient(const cs_real_t         *v_values,
 
   cs_timer_t  t0 = cs_timer_time();
 
-# pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)  \
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)  \
   shared(quant, connect, eqc, v_gradient, v_values, dualcell_vol, \
          _vcbs_cell_builder, cs_glob_n_ranks)
   {
@@ -245,6 +245,8 @@ cs_domain_free(cs_domain_t   **p_domain)
   domain->cdo_quantities = cs_cdo_quantities_free(domain->cdo_quantities);
   domain->connect = cs_cdo_connect_free(domain->connect);
 
+  cs_quadrature_finalize();
+
   BFT_FREE(domain);
   *p_domain = NULL;
 }
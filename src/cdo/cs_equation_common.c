@@ -269,6 +269,15 @@ cs_equation_get_mav(cs_matrix_t                        *matrix,
                                    cs_matrix_msr_assembler_values_add_1_critic,
                                            NULL,
                                            NULL, NULL); /* Optional pointers */
+    else if (omp_choice == CS_PARAM_OMP_ASSEMBLY_STAGED)
+      mav
+        = cs_matrix_assembler_values_initx(matrix, NULL, NULL,
+                                           true,  /* MSR */
+                                   cs_matrix_msr_assembler_values_init_staged,
+                                   cs_matrix_msr_assembler_values_add_1_staged,
+                                           NULL,
+                                           NULL,
+                                   cs_matrix_msr_assembler_values_end_staged);
     else
       bft_error(__FILE__, __LINE__, 0, "%s: Invalid OpenMP choice", __func__);
     break;
@@ -654,7 +654,9 @@ _set_key(const char            *label,
     if (strcmp(keyval, "critical") == 0)
       eqp->omp_assembly_choice = CS_PARAM_OMP_ASSEMBLY_CRITICAL;
     else if (strcmp(keyval, "atomic") == 0)
-      eqp->sles_param.precond = CS_PARAM_OMP_ASSEMBLY_ATOMIC;
+      eqp->omp_assembly_choice = CS_PARAM_OMP_ASSEMBLY_ATOMIC;
+    else if (strcmp(keyval, "staged") == 0)
+      eqp->omp_assembly_choice = CS_PARAM_OMP_ASSEMBLY_STAGED;
     else {
       const char *_val = keyval;
       bft_error(__FILE__, __LINE__, 0,
@@ -1796,6 +1798,9 @@ cs_equation_summary_param(const cs_equation_param_t   *eqp)
     else if (eqp->omp_assembly_choice == CS_PARAM_OMP_ASSEMBLY_ATOMIC)
       cs_log_printf(CS_LOG_SETUP, "    <%s/SLES> OpenMP.Assembly.Choice  %s\n",
                     eqname, "atomic");
+    else if (eqp->omp_assembly_choice == CS_PARAM_OMP_ASSEMBLY_STAGED)
+      cs_log_printf(CS_LOG_SETUP, "    <%s/SLES> OpenMP.Assembly.Choice  %s\n",
+                    eqname, "staged");
   }
 }
 
@@ -572,7 +572,7 @@ typedef struct {
  * \var CS_EQKEY_OMP_ASSEMBLY_STRATEGY
  * Choice of the way to perform the assembly when OpenMP is active
  * Available choices are:
- * - "atomic" or "critical"
+ * - "atomic", "critical" or "staged"
  *
  * \var CS_EQKEY_PRECOND
  * Specify the preconditionner associated to an iterative solver. Available
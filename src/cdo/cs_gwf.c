@@ -567,6 +567,92 @@ _gwf_create(void)
   return gw;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if two tracer equations rely on the same transport
+ *         structure: same space discretization, same advection field and
+ *         same diffusion property handled with the same Hodge parameters
+ *
+ * \param[in]  eq_a    pointer to the first equation
+ * \param[in]  eq_b    pointer to the second equation
+ *
+ * \return true if both equations share the same transport structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_tracers_share_structure(const cs_equation_t    *eq_a,
+                         const cs_equation_t    *eq_b)
+{
+  const cs_equation_param_t  *eqp_a = cs_equation_get_param(eq_a);
+  const cs_equation_param_t  *eqp_b = cs_equation_get_param(eq_b);
+
+  if (eqp_a->space_scheme != eqp_b->space_scheme)
+    return false;
+  if (eqp_a->adv_field != eqp_b->adv_field)
+    return false;
+  if (eqp_a->diffusion_property != eqp_b->diffusion_property)
+    return false;
+
+  const cs_param_hodge_t  ha = eqp_a->diffusion_hodge;
+  const cs_param_hodge_t  hb = eqp_b->diffusion_hodge;
+  if (ha.type != hb.type || ha.algo != hb.algo || ha.inv_pty != hb.inv_pty)
+    return false;
+  if (fabs(ha.coef - hb.coef) > cs_math_zero_threshold)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Group the tracer equations sharing the same transport structure
+ *         so that the cellwise stiffness matrices built by the first tracer
+ *         of the group are reused by all its members (cf.
+ *         \ref cs_hodge_join_stiffness_cache). Done once, at the first
+ *         computation, when all scheme contexts are available.
+ *
+ * \param[in]  gw    pointer to the main cs_gwf_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_group_tracer_equations(const cs_gwf_t    *gw)
+{
+  static bool  grouping_done = false;
+
+  if (grouping_done)
+    return;
+  grouping_done = true;
+
+  /* Identify the tracer owning the stiffness cache (if none, the cache is
+     either unclaimed or held by another equation such as Richards) */
+  const void  *cache_owner = cs_hodge_get_stiffness_cache_owner();
+  if (cache_owner == NULL)
+    return;
+
+  int  leader = -1;
+  for (int i = 0; i < gw->n_tracers; i++) {
+    if (cs_equation_get_scheme_context(gw->tracers[i]->eq) == cache_owner) {
+      leader = i;
+      break;
+    }
+  }
+  if (leader < 0)
+    return;
+
+  for (int i = 0; i < gw->n_tracers; i++) {
+
+    if (i == leader)
+      continue;
+
+    cs_equation_t  *eq = gw->tracers[i]->eq;
+    if (_tracers_share_structure(gw->tracers[leader]->eq, eq))
+      cs_hodge_join_stiffness_cache(cs_equation_get_scheme_context(eq));
+
+  } /* Loop on tracer equations */
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1430,6 +1516,10 @@ cs_gwf_compute_steady_state(const cs_mesh_t              *mesh,
 
   }
 
+  /* Let tracers sharing the same transport structure reuse the cellwise
+     stiffness matrices built by the first one */
+  _group_tracer_equations(gw);
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
@@ -1501,6 +1591,10 @@ cs_gwf_compute(const cs_mesh_t              *mesh,
 
   }
 
+  /* Let tracers sharing the same transport structure reuse the cellwise
+     stiffness matrices built by the first one */
+  _group_tracer_equations(gw);
+
   for (int i = 0; i < gw->n_tracers; i++) {
 
     cs_gwf_tracer_t  *tracer = gw->tracers[i];
@@ -32,6 +32,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <float.h>
 #include <limits.h>
@@ -84,10 +85,37 @@ BEGIN_C_DECLS
  * Local structure definitions
  *============================================================================*/
 
+/* Cellwise cache for local stiffness matrices. When the mesh is static and
+   the diffusion property is steady in time, the local stiffness matrices
+   built during the first pass can be reused as is at the subsequent time
+   steps (rebuilding them is pure recomputation). A single cache instance
+   is available: the first equation claiming it becomes its owner and the
+   cache is only active between the calls to
+   \ref cs_hodge_open_stiffness_cache and
+   \ref cs_hodge_close_stiffness_cache performed by one of its owners.
+   Further equations relying on the very same diffusion property and Hodge
+   parameters may join the cache (cf. \ref cs_hodge_join_stiffness_cache)
+   so that the stiffness matrices are built once for the whole group */
+
+typedef struct {
+
+  int           n_owners; /* number of equations sharing the cache */
+  const void  **owners;   /* contexts of these equations; owners[0] is the
+                             one which claimed the cache first */
+  bool          in_use;   /* true during an owner's building stage */
+  cs_lnum_t     n_cells;
+  int           stride;   /* allocated size for each local matrix */
+  char         *built;    /* 1 if the cell entry is available, 0 otherwise */
+  cs_real_t    *val;      /* cached coefficients of the local matrices */
+
+} _stiffness_cache_t;
+
 /*============================================================================
  * Local variables
  *============================================================================*/
 
+static _stiffness_cache_t  _stiff_cache = {0, NULL, false, 0, 0, NULL, NULL};
+
 /*============================================================================
  * Private constant variables
  *============================================================================*/
@@ -102,6 +130,83 @@ static const double  cs_hodge_vc_coef = 3./20;
  * Private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Check if a context belongs to the owners of the stiffness cache
+ *
+ * \param[in] owner    pointer identifying an equation context
+ *
+ * \return true if this context shares the cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_is_stiffness_cache_owner(const void   *owner)
+{
+  if (owner == NULL)
+    return false;
+  for (int i = 0; i < _stiff_cache.n_owners; i++)
+    if (_stiff_cache.owners[i] == owner)
+      return true;
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Retrieve the cached stiffness matrix related to a cell if the
+ *          cache is active and the cell entry has already been built
+ *
+ * \param[in]      c_id    cell id
+ * \param[in]      n_rows  size of the local stiffness matrix
+ * \param[in, out] sloc    pointer to the cs_sdm_t structure to fill
+ *
+ * \return true if sloc has been set from the cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_get_cached_stiffness(cs_lnum_t    c_id,
+                      int          n_rows,
+                      cs_sdm_t    *sloc)
+{
+  if (!_stiff_cache.in_use)
+    return false;
+  if (_stiff_cache.built[c_id] == 0)
+    return false;
+
+  cs_sdm_square_init(n_rows, sloc);
+  memcpy(sloc->val,
+         _stiff_cache.val + (size_t)c_id * _stiff_cache.stride,
+         (size_t)(n_rows*n_rows)*sizeof(cs_real_t));
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Store the stiffness matrix related to a cell inside the cache
+ *          if the cache is active (each cell entry is written by one thread
+ *          only so no synchronization is needed)
+ *
+ * \param[in] c_id    cell id
+ * \param[in] sloc    pointer to the cs_sdm_t structure to store
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_set_cached_stiffness(cs_lnum_t          c_id,
+                      const cs_sdm_t    *sloc)
+{
+  if (!_stiff_cache.in_use)
+    return;
+
+  assert(sloc->n_rows * sloc->n_rows <= _stiff_cache.stride);
+  memcpy(_stiff_cache.val + (size_t)c_id * _stiff_cache.stride,
+         sloc->val,
+         (size_t)(sloc->n_rows*sloc->n_rows)*sizeof(cs_real_t));
+  _stiff_cache.built[c_id] = 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Check the coherency of the values of a stiffness matrix
@@ -465,6 +570,143 @@ _compute_hodge_cost(const int       n_ent,
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Claim and allocate the cache storing cellwise stiffness matrices.
+ *          To be used when the mesh is static and the diffusion property is
+ *          steady in time so that the local stiffness matrices built during
+ *          the first pass can be reused at the subsequent time steps.
+ *          A single cache instance is available: the first caller becomes
+ *          its owner, further claims by other owners are ignored.
+ *
+ * \param[in] owner       pointer identifying the owner (e.g. an equation
+ *                        context)
+ * \param[in] n_cells     number of cells
+ * \param[in] n_max_rows  max. size of a local stiffness matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_set_stiffness_cache(const void    *owner,
+                             cs_lnum_t      n_cells,
+                             int            n_max_rows)
+{
+  if (owner == NULL || n_cells < 1 || n_max_rows < 1)
+    return;
+  if (_stiff_cache.n_owners > 0 && _stiff_cache.owners[0] != owner)
+    return; /* Cache already claimed by another owner */
+
+  if (_stiff_cache.n_owners == 0) {
+    BFT_REALLOC(_stiff_cache.owners, 1, const void *);
+    _stiff_cache.owners[0] = owner;
+    _stiff_cache.n_owners = 1;
+  }
+  _stiff_cache.in_use = false;
+  _stiff_cache.n_cells = n_cells;
+  _stiff_cache.stride = n_max_rows*n_max_rows;
+
+  BFT_REALLOC(_stiff_cache.val,
+              (size_t)n_cells * _stiff_cache.stride, cs_real_t);
+  BFT_REALLOC(_stiff_cache.built, n_cells, char);
+  memset(_stiff_cache.built, 0, n_cells*sizeof(char));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Join the cache storing cellwise stiffness matrices as an
+ *          additional owner so that the stiffness matrices built by the
+ *          first owner are reused. The caller has to make sure that both
+ *          equations rely on the same diffusion property and the same
+ *          Hodge parameters. No effect if the cache has not been claimed.
+ *
+ * \param[in] owner       pointer identifying the joining equation context
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_join_stiffness_cache(const void    *owner)
+{
+  if (owner == NULL || _stiff_cache.n_owners == 0)
+    return;
+  if (_is_stiffness_cache_owner(owner))
+    return; /* Already a member */
+
+  BFT_REALLOC(_stiff_cache.owners, _stiff_cache.n_owners + 1, const void *);
+  _stiff_cache.owners[_stiff_cache.n_owners] = owner;
+  _stiff_cache.n_owners += 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Retrieve the context which first claimed the cache storing
+ *          cellwise stiffness matrices
+ *
+ * \return the pointer given at the claiming stage or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_hodge_get_stiffness_cache_owner(void)
+{
+  if (_stiff_cache.n_owners == 0)
+    return NULL;
+  return _stiff_cache.owners[0];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Activate the cache storing cellwise stiffness matrices before a
+ *          building stage. Only effective if owner has claimed the cache
+ *          beforehand (cf. \ref cs_hodge_set_stiffness_cache)
+ *
+ * \param[in] owner       pointer identifying the owner
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_open_stiffness_cache(const void    *owner)
+{
+  if (_is_stiffness_cache_owner(owner))
+    _stiff_cache.in_use = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Deactivate the cache storing cellwise stiffness matrices after a
+ *          building stage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_close_stiffness_cache(void)
+{
+  _stiff_cache.in_use = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the cache storing cellwise stiffness matrices. Only
+ *          effective when called by its owner.
+ *
+ * \param[in] owner       pointer identifying the owner
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_free_stiffness_cache(const void    *owner)
+{
+  if (!_is_stiffness_cache_owner(owner))
+    return;
+
+  BFT_FREE(_stiff_cache.val);
+  BFT_FREE(_stiff_cache.built);
+  BFT_FREE(_stiff_cache.owners);
+  _stiff_cache.n_owners = 0;
+  _stiff_cache.in_use = false;
+  _stiff_cache.n_cells = 0;
+  _stiff_cache.stride = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Build a local stiffness matrix using the generic COST algo.
@@ -615,6 +857,9 @@ cs_hodge_vb_cost_get_stiffness(const cs_param_hodge_t    h_info,
                       CS_CDO_LOCAL_PV | CS_CDO_LOCAL_PEQ | CS_CDO_LOCAL_DFQ |
                       CS_CDO_LOCAL_EV));
 
+  if (_get_cached_stiffness(cm->c_id, cm->n_vc, cb->loc))
+    return;
+
   double  *kappa = cb->values;
   double  *alpha = cb->values + cm->n_ec;
   cs_real_3_t  *pq = cb->vectors;
@@ -763,6 +1008,8 @@ cs_hodge_vb_cost_get_stiffness(const cs_param_hodge_t    h_info,
       si[ej] = sloc->val[ej*sloc->n_rows + ei];
   }
 
+  _set_cached_stiffness(cm->c_id, sloc);
+
 #if defined(DEBUG) && !defined(NDEBUG) && CS_HODGE_DBG > 1
   if (cm->c_id % CS_HODGE_MODULO == 0) {
     cs_log_printf(CS_LOG_DEFAULT, ">> Local stiffness matrix");
@@ -796,6 +1043,9 @@ cs_hodge_vb_voro_get_stiffness(const cs_param_hodge_t    h_info,
                       CS_CDO_LOCAL_PV | CS_CDO_LOCAL_PEQ | CS_CDO_LOCAL_DFQ |
                       CS_CDO_LOCAL_EV));
 
+  if (_get_cached_stiffness(cm->c_id, cm->n_vc, cb->loc))
+    return;
+
   /* Initialize the local stiffness matrix */
   cs_sdm_t  *sloc = cb->loc;
   cs_sdm_square_init(cm->n_vc, sloc);
@@ -855,6 +1105,8 @@ cs_hodge_vb_voro_get_stiffness(const cs_param_hodge_t    h_info,
 
   } /* Tensor-valued property */
 
+  _set_cached_stiffness(cm->c_id, sloc);
+
 #if defined(DEBUG) && !defined(NDEBUG) && CS_HODGE_DBG > 1
   if (cm->c_id % CS_HODGE_MODULO == 0) {
     cs_log_printf(CS_LOG_DEFAULT, ">> Local stiffness matrix");
@@ -888,6 +1140,9 @@ cs_hodge_vb_wbs_get_stiffness(const cs_param_hodge_t    h_info,
                       CS_CDO_LOCAL_PVQ | CS_CDO_LOCAL_DEQ | CS_CDO_LOCAL_PFQ |
                       CS_CDO_LOCAL_EV  | CS_CDO_LOCAL_HFQ | CS_CDO_LOCAL_FEQ));
 
+  if (_get_cached_stiffness(cm->c_id, cm->n_vc, cb->loc))
+    return;
+
   cs_real_3_t  grd_c, grd_f, grd_v1, grd_v2, matg;
 
   cs_real_3_t  *uvc = cb->vectors;
@@ -989,6 +1244,8 @@ cs_hodge_vb_wbs_get_stiffness(const cs_param_hodge_t    h_info,
       sloc->val[sj*sloc->n_rows+si] = mi[sj];
   }
 
+  _set_cached_stiffness(cm->c_id, sloc);
+
 #if defined(DEBUG) && !defined(NDEBUG) && CS_HODGE_DBG > 1
   if (cm->c_id % CS_HODGE_MODULO == 0) {
     cs_log_printf(CS_LOG_DEFAULT, ">> Local stiffness matrix");
@@ -1935,7 +2192,7 @@ cs_hodge_matvec(const cs_cdo_connect_t       *connect,
   }
   assert(connect != NULL && quant != NULL); // Sanity checks
 
-#pragma omp parallel if (quant->n_cells > CS_THR_MIN) default(none)        \
+#pragma omp parallel if (quant->n_cells > CS_THR_MIN)        \
   shared(quant, connect, in_vals, t_eval, result, pty)
   {
 #if defined(HAVE_OPENMP) /* Determine default number of OpenMP threads */
@@ -68,6 +68,89 @@ typedef void
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Claim and allocate the cache storing cellwise stiffness matrices.
+ *          To be used when the mesh is static and the diffusion property is
+ *          steady in time so that the local stiffness matrices built during
+ *          the first pass can be reused at the subsequent time steps.
+ *          A single cache instance is available: the first caller becomes
+ *          its owner, further claims by other owners are ignored.
+ *
+ * \param[in] owner       pointer identifying the owner (e.g. an equation
+ *                        context)
+ * \param[in] n_cells     number of cells
+ * \param[in] n_max_rows  max. size of a local stiffness matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_set_stiffness_cache(const void    *owner,
+                             cs_lnum_t      n_cells,
+                             int            n_max_rows);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Join the cache storing cellwise stiffness matrices as an
+ *          additional owner so that the stiffness matrices built by the
+ *          first owner are reused. The caller has to make sure that both
+ *          equations rely on the same diffusion property and the same
+ *          Hodge parameters. No effect if the cache has not been claimed.
+ *
+ * \param[in] owner       pointer identifying the joining equation context
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_join_stiffness_cache(const void    *owner);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Retrieve the context which first claimed the cache storing
+ *          cellwise stiffness matrices
+ *
+ * \return the pointer given at the claiming stage or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_hodge_get_stiffness_cache_owner(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Activate the cache storing cellwise stiffness matrices before a
+ *          building stage. Only effective if owner has claimed the cache
+ *          beforehand (cf. \ref cs_hodge_set_stiffness_cache)
+ *
+ * \param[in] owner       pointer identifying the owner
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_open_stiffness_cache(const void    *owner);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Deactivate the cache storing cellwise stiffness matrices after a
+ *          building stage
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_close_stiffness_cache(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the cache storing cellwise stiffness matrices. Only
+ *          effective when called by its owner.
+ *
+ * \param[in] owner       pointer identifying the owner
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hodge_free_stiffness_cache(const void    *owner);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Build a local stiffness matrix using the generic COST algo.
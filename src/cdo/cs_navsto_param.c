@@ -466,6 +466,9 @@ cs_navsto_param_set(cs_navsto_param_t    *nsp,
     else if (strcmp(val, "upper_schur_gmres") == 0) {
       nsp->sles_strategy = CS_NAVSTO_SLES_UPPER_SCHUR_GMRES;
     }
+    else if (strcmp(val, "block_amg_schur") == 0) {
+      nsp->sles_strategy = CS_NAVSTO_SLES_BLOCK_AMG_SCHUR;
+    }
     else {
       const char *_val = val;
       bft_error(__FILE__, __LINE__, 0,
@@ -115,6 +115,16 @@ typedef enum {
  * multigrid iteration and the block 11 is an approximation of the Schur
  * complement preconditionned with a minres. The main iterative solver is a
  * flexible GMRES. Available choice when a monolithic approach is used.
+ *
+ * \var CS_NAVSTO_SLES_BLOCK_AMG_SCHUR
+ *
+ * The Navier-Stokes system of equations is solved using a block diagonal
+ * preconditioner where the velocity block is handled by one cycle of the
+ * in-house algebraic multigrid and the pressure block by a diagonal
+ * approximation of the Schur complement (pressure mass matrix scaled by the
+ * laminar viscosity). The main iterative solver is a GMRES. This strategy
+ * relies only on Code_Saturne solvers (no external library is required).
+ * Available choice when a monolithic approach is used.
  */
 
 typedef enum {
@@ -124,6 +134,7 @@ typedef enum {
   CS_NAVSTO_SLES_ADDITIVE_GMRES_BY_BLOCK,
   CS_NAVSTO_SLES_DIAG_SCHUR_GMRES,
   CS_NAVSTO_SLES_UPPER_SCHUR_GMRES,
+  CS_NAVSTO_SLES_BLOCK_AMG_SCHUR,
 
   CS_NAVSTO_SLES_N_TYPES
 
@@ -79,6 +79,8 @@ typedef enum {
 
   CS_PARAM_OMP_ASSEMBLY_ATOMIC,
   CS_PARAM_OMP_ASSEMBLY_CRITICAL,
+  CS_PARAM_OMP_ASSEMBLY_STAGED,   /* per-thread staging buffers, merged in a
+                                     deterministic reduction pass */
   CS_PARAM_OMP_ASSEMBLY_N_STRATEGIES
 
 } cs_param_omp_assembly_strategy_t;
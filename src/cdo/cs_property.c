@@ -968,15 +968,16 @@ cs_property_eval_at_cells(cs_real_t               t_eval,
     cs_xdef_t  *def = pty->defs[i];
     const cs_zone_t  *z = cs_volume_zone_by_id(def->z_id);
 
-    pty->get_eval_at_cell[i](z->n_elts,
-                             z->elt_ids,
-                             false, /* without compact output */
-                             cs_glob_mesh,
-                             cs_cdo_connect,
-                             cs_cdo_quant,
-                             t_eval,
-                             def->input,
-                             array);
+    /* Batch evaluation: one dispatch for the whole zone */
+    cs_xdef_eval_n(def,
+                   z->n_elts,
+                   z->elt_ids,
+                   false, /* without compact output */
+                   cs_glob_mesh,
+                   cs_cdo_connect,
+                   cs_cdo_quant,
+                   t_eval,
+                   array);
 
   } /* Loop on definitions */
 
@@ -262,6 +262,29 @@ cs_property_is_uniform(const cs_property_t   *pty)
     return false;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  returns true if the property is steady in time, otherwise false
+ *
+ * \param[in]    pty    pointer to a property to test
+ *
+ * \return  true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+cs_property_is_steady(const cs_property_t   *pty)
+{
+  if (pty == NULL)
+    return false;
+
+  for (int i = 0; i < pty->n_definitions; i++)
+    if (!(pty->defs[i]->state & CS_FLAG_STATE_STEADY))
+      return false;
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  returns true if the property is isotropic, otherwise false
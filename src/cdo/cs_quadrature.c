@@ -29,12 +29,15 @@
  *----------------------------------------------------------------------------*/
 
 #include <math.h>
+#include <string.h>
 #include <assert.h>
 
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "bft_mem.h"
+
 /*----------------------------------------------------------------------------
  * Header for the current file
  *----------------------------------------------------------------------------*/
@@ -87,6 +90,35 @@ cs_quadrature_type_name[CS_QUADRATURE_N_TYPES][CS_BASE_STRING_LEN] =
     N_("higher (single weight)"),
     N_("highest") };
 
+/* Barycentric coordinates and weight fractions for each quadrature rule,
+   set up once by cs_quadrature_setup(); row g of a table gives the
+   barycentric coefficients of the shape vertices for Gauss point g,
+   followed by its weight as a fraction of the shape measure. */
+
+static double  _tria_bw_3pts[3][4];
+static double  _tria_bw_4pts[4][4];
+static double  _tria_bw_7pts[7][4];
+static double  _tetr_bw_4pts[4][5];
+static double  _tetr_bw_5pts[5][5];
+static double  _tetr_bw_15pts[15][5];
+
+/* Per-thread cache of the last mapped quadrature rule, so that repeated
+   evaluations on the same triangle or tetrahedron reuse the mapped Gauss
+   points and weights. */
+
+typedef struct {
+
+  int          n_pts;        /* number of cached Gauss points, or 0 */
+  int          dim;          /* 2 for a triangle, 3 for a tetrahedron */
+  double       meas;         /* shape measure (area or volume) */
+  cs_real_t    v[12];        /* shape vertex coordinates */
+  cs_real_3_t  gpts[15];     /* mapped Gauss points */
+  double       weights[15];  /* associated weights */
+
+} _quad_cache_t;
+
+static _quad_cache_t  *_quad_cache = NULL;
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -131,6 +163,97 @@ cs_quadrature_setup(void)
   _tetr_quad15g31 = (5. + sqrt(15.)) / 20.;
   _tetr_quad15w1  = (2665. + 14. * sqrt(15.) ) / 37800.;
   _tetr_quad15w2  = (2665. - 14. * sqrt(15.) ) / 37800.;
+
+  /* Barycentric coordinate and weight fraction tables, in the same point
+     ordering as the mapping functions below */
+
+  {
+    const double  c1 = _tria_quad7c1, d1 = 1 - 2*_tria_quad7c1;
+    const double  c2 = _tria_quad7c2, d2 = 1 - 2*_tria_quad7c2;
+
+    const double  tria_3pts[3][4] = {{0.5, 0.5, 0.,  _quad_over3},
+                                     {0.5, 0.,  0.5, _quad_over3},
+                                     {0.,  0.5, 0.5, _quad_over3}};
+
+    const double  tria_4pts[4][4]
+      = {{_quad_over3, _quad_over3, _quad_over3, -_quad_9ov16},
+         {0.2, 0.2, 0.6, _quad_25ov48},
+         {0.2, 0.6, 0.2, _quad_25ov48},
+         {0.6, 0.2, 0.2, _quad_25ov48}};
+
+    const double  tria_7pts[7][4]
+      = {{_quad_over3, _quad_over3, _quad_over3, _quad_9ov40},
+         {c1, c1, d1, _tria_quad7c3},
+         {c1, d1, c1, _tria_quad7c3},
+         {d1, c1, c1, _tria_quad7c3},
+         {c2, c2, d2, _tria_quad7c4},
+         {c2, d2, c2, _tria_quad7c4},
+         {d2, c2, c2, _tria_quad7c4}};
+
+    memcpy(_tria_bw_3pts, tria_3pts, sizeof(tria_3pts));
+    memcpy(_tria_bw_4pts, tria_4pts, sizeof(tria_4pts));
+    memcpy(_tria_bw_7pts, tria_7pts, sizeof(tria_7pts));
+  }
+
+  {
+    const double  c1 = _tetr_quad4c1, c2 = _tetr_quad4c2;
+    const double  g1 = _tetr_quad15g1, g11 = _tetr_quad15g11;
+    const double  g2 = _tetr_quad15g2, g21 = _tetr_quad15g21;
+    const double  g3 = _tetr_quad15g3, g31 = _tetr_quad15g31;
+
+    const double  tetr_4pts[4][5] = {{c1, c1, c1, c2, 0.25},
+                                     {c2, c1, c1, c1, 0.25},
+                                     {c1, c2, c1, c1, 0.25},
+                                     {c1, c1, c2, c1, 0.25}};
+
+    const double  tetr_5pts[5][5]
+      = {{_quad_over6, _quad_over6, _quad_over6, 0.5, 0.45},
+         {0.5, _quad_over6, _quad_over6, _quad_over6, 0.45},
+         {_quad_over6, 0.5, _quad_over6, _quad_over6, 0.45},
+         {_quad_over6, _quad_over6, 0.5, _quad_over6, 0.45},
+         {0.25, 0.25, 0.25, 0.25, -0.8}};
+
+    const double  tetr_15pts[15][5]
+      = {{g1,  g1,  g1,  g11, _tetr_quad15w1},
+         {g1,  g1,  g11, g1,  _tetr_quad15w1},
+         {g1,  g11, g1,  g1,  _tetr_quad15w1},
+         {g11, g1,  g1,  g1,  _tetr_quad15w1},
+         {g2,  g2,  g2,  g21, _tetr_quad15w2},
+         {g2,  g2,  g21, g2,  _tetr_quad15w2},
+         {g2,  g21, g2,  g2,  _tetr_quad15w2},
+         {g21, g2,  g2,  g2,  _tetr_quad15w2},
+         {g3,  g3,  g31, g31, _tetr_quad15w3},
+         {g3,  g31, g31, g3,  _tetr_quad15w3},
+         {g3,  g31, g3,  g31, _tetr_quad15w3},
+         {g31, g3,  g3,  g31, _tetr_quad15w3},
+         {g31, g31, g3,  g3,  _tetr_quad15w3},
+         {g31, g3,  g31, g3,  _tetr_quad15w3},
+         {0.25, 0.25, 0.25, 0.25, _tetr_quad15w4}};
+
+    memcpy(_tetr_bw_4pts, tetr_4pts, sizeof(tetr_4pts));
+    memcpy(_tetr_bw_5pts, tetr_5pts, sizeof(tetr_5pts));
+    memcpy(_tetr_bw_15pts, tetr_15pts, sizeof(tetr_15pts));
+  }
+
+  /* Allocate and reset the per-thread quadrature cache */
+
+  if (_quad_cache == NULL)
+    BFT_MALLOC(_quad_cache, cs_glob_n_threads, _quad_cache_t);
+
+  for (int t = 0; t < cs_glob_n_threads; t++)
+    _quad_cache[t].n_pts = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the structures allocated by cs_quadrature_setup()
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_finalize(void)
+{
+  BFT_FREE(_quad_cache);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -478,6 +601,224 @@ cs_quadrature_tet_15pts(const cs_real_3_t   v1,
   weights[14] = vol * _tetr_quad15w4;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the barycentric coordinate and weight fraction table for a
+ *         triangle quadrature rule
+ *
+ *         Row g (at coefs + 4*g) gives the barycentric coefficients of the
+ *         three vertices for Gauss point g, followed by its weight as a
+ *         fraction of the triangle area.
+ *
+ * \param[in]  n_pts   number of Gauss points of the rule (3, 4 or 7)
+ *
+ * \return a pointer to the requested table
+ */
+/*----------------------------------------------------------------------------*/
+
+const double *
+cs_quadrature_tria_bary_coefs(int  n_pts)
+{
+  switch (n_pts) {
+  case 3:
+    return (const double *)_tria_bw_3pts;
+  case 4:
+    return (const double *)_tria_bw_4pts;
+  case 7:
+    return (const double *)_tria_bw_7pts;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid number of Gauss points (%d) for a triangle.\n",
+              __func__, n_pts);
+  }
+
+  return NULL; /* Avoid no return warning */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the barycentric coordinate and weight fraction table for a
+ *         tetrahedron quadrature rule
+ *
+ *         Row g (at coefs + 5*g) gives the barycentric coefficients of the
+ *         four vertices for Gauss point g, followed by its weight as a
+ *         fraction of the tetrahedron volume.
+ *
+ * \param[in]  n_pts   number of Gauss points of the rule (4, 5 or 15)
+ *
+ * \return a pointer to the requested table
+ */
+/*----------------------------------------------------------------------------*/
+
+const double *
+cs_quadrature_tet_bary_coefs(int  n_pts)
+{
+  switch (n_pts) {
+  case 4:
+    return (const double *)_tetr_bw_4pts;
+  case 5:
+    return (const double *)_tetr_bw_5pts;
+  case 15:
+    return (const double *)_tetr_bw_15pts;
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid number of Gauss points (%d) for a tetrahedron.\n",
+              __func__, n_pts);
+  }
+
+  return NULL; /* Avoid no return warning */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute quadrature points for a triangle, reusing the points
+ *          mapped by the previous call on this thread when the triangle is
+ *          the same
+ *
+ *          The returned pointers remain valid until the next cached call
+ *          on the same thread.
+ *
+ * \param[in]   n_pts    number of Gauss points of the rule (3, 4 or 7)
+ * \param[in]   v1       first vertex
+ * \param[in]   v2       second vertex
+ * \param[in]   v3       third vertex
+ * \param[in]   area     area of triangle {v1, v2, v3}
+ * \param[out]  gpts     pointer to the gauss points
+ * \param[out]  weights  pointer to the weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tria_cached(int                  n_pts,
+                          const cs_real_3_t    v1,
+                          const cs_real_3_t    v2,
+                          const cs_real_3_t    v3,
+                          double               area,
+                          const cs_real_3_t  **gpts,
+                          const double       **weights)
+{
+  int  t_id = 0;
+
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+#endif
+
+  assert(_quad_cache != NULL);
+
+  _quad_cache_t  *qc = _quad_cache + t_id;
+
+  if (   qc->n_pts != n_pts || qc->dim != 2
+      || memcmp(&(qc->meas), &area, sizeof(double)) != 0
+      || memcmp(qc->v,     v1, 3*sizeof(cs_real_t)) != 0
+      || memcmp(qc->v + 3, v2, 3*sizeof(cs_real_t)) != 0
+      || memcmp(qc->v + 6, v3, 3*sizeof(cs_real_t)) != 0) {
+
+    switch (n_pts) {
+    case 3:
+      cs_quadrature_tria_3pts(v1, v2, v3, area, qc->gpts, qc->weights);
+      break;
+    case 4:
+      cs_quadrature_tria_4pts(v1, v2, v3, area, qc->gpts, qc->weights);
+      break;
+    case 7:
+      cs_quadrature_tria_7pts(v1, v2, v3, area, qc->gpts, qc->weights);
+      break;
+    default:
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Invalid number of Gauss points (%d) for a triangle.\n",
+                __func__, n_pts);
+    }
+
+    qc->n_pts = n_pts;
+    qc->dim = 2;
+    qc->meas = area;
+    memcpy(qc->v,     v1, 3*sizeof(cs_real_t));
+    memcpy(qc->v + 3, v2, 3*sizeof(cs_real_t));
+    memcpy(qc->v + 6, v3, 3*sizeof(cs_real_t));
+
+  }
+
+  *gpts = (const cs_real_3_t *)qc->gpts;
+  *weights = qc->weights;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute quadrature points for a tetrahedron, reusing the points
+ *          mapped by the previous call on this thread when the tetrahedron
+ *          is the same
+ *
+ *          The returned pointers remain valid until the next cached call
+ *          on the same thread.
+ *
+ * \param[in]   n_pts    number of Gauss points of the rule (4, 5 or 15)
+ * \param[in]   v1       first vertex
+ * \param[in]   v2       second vertex
+ * \param[in]   v3       third vertex
+ * \param[in]   v4       fourth vertex
+ * \param[in]   vol      volume of tetrahedron {v1, v2, v3, v4}
+ * \param[out]  gpts     pointer to the gauss points
+ * \param[out]  weights  pointer to the weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_cached(int                  n_pts,
+                         const cs_real_3_t    v1,
+                         const cs_real_3_t    v2,
+                         const cs_real_3_t    v3,
+                         const cs_real_3_t    v4,
+                         double               vol,
+                         const cs_real_3_t  **gpts,
+                         const double       **weights)
+{
+  int  t_id = 0;
+
+#if defined(HAVE_OPENMP)
+  t_id = omp_get_thread_num();
+#endif
+
+  assert(_quad_cache != NULL);
+
+  _quad_cache_t  *qc = _quad_cache + t_id;
+
+  if (   qc->n_pts != n_pts || qc->dim != 3
+      || memcmp(&(qc->meas), &vol, sizeof(double)) != 0
+      || memcmp(qc->v,     v1, 3*sizeof(cs_real_t)) != 0
+      || memcmp(qc->v + 3, v2, 3*sizeof(cs_real_t)) != 0
+      || memcmp(qc->v + 6, v3, 3*sizeof(cs_real_t)) != 0
+      || memcmp(qc->v + 9, v4, 3*sizeof(cs_real_t)) != 0) {
+
+    switch (n_pts) {
+    case 4:
+      cs_quadrature_tet_4pts(v1, v2, v3, v4, vol, qc->gpts, qc->weights);
+      break;
+    case 5:
+      cs_quadrature_tet_5pts(v1, v2, v3, v4, vol, qc->gpts, qc->weights);
+      break;
+    case 15:
+      cs_quadrature_tet_15pts(v1, v2, v3, v4, vol, qc->gpts, qc->weights);
+      break;
+    default:
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Invalid number of Gauss points (%d) for a"
+                " tetrahedron.\n", __func__, n_pts);
+    }
+
+    qc->n_pts = n_pts;
+    qc->dim = 3;
+    qc->meas = vol;
+    memcpy(qc->v,     v1, 3*sizeof(cs_real_t));
+    memcpy(qc->v + 3, v2, 3*sizeof(cs_real_t));
+    memcpy(qc->v + 6, v3, 3*sizeof(cs_real_t));
+    memcpy(qc->v + 9, v4, 3*sizeof(cs_real_t));
+
+  }
+
+  *gpts = (const cs_real_3_t *)qc->gpts;
+  *weights = qc->weights;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
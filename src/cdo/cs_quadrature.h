@@ -216,6 +216,15 @@ typedef void
 void
 cs_quadrature_setup(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the structures allocated by cs_quadrature_setup()
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return th name associated to a type of quadrature
@@ -491,6 +500,100 @@ cs_quadrature_tet_15pts(const cs_real_3_t   v1,
                         cs_real_3_t         gpts[],
                         double              weights[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the barycentric coordinate and weight fraction table for a
+ *         triangle quadrature rule
+ *
+ *         Row g (at coefs + 4*g) gives the barycentric coefficients of the
+ *         three vertices for Gauss point g, followed by its weight as a
+ *         fraction of the triangle area.
+ *
+ * \param[in]  n_pts   number of Gauss points of the rule (3, 4 or 7)
+ *
+ * \return a pointer to the requested table
+ */
+/*----------------------------------------------------------------------------*/
+
+const double *
+cs_quadrature_tria_bary_coefs(int  n_pts);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the barycentric coordinate and weight fraction table for a
+ *         tetrahedron quadrature rule
+ *
+ *         Row g (at coefs + 5*g) gives the barycentric coefficients of the
+ *         four vertices for Gauss point g, followed by its weight as a
+ *         fraction of the tetrahedron volume.
+ *
+ * \param[in]  n_pts   number of Gauss points of the rule (4, 5 or 15)
+ *
+ * \return a pointer to the requested table
+ */
+/*----------------------------------------------------------------------------*/
+
+const double *
+cs_quadrature_tet_bary_coefs(int  n_pts);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute quadrature points for a triangle, reusing the points
+ *          mapped by the previous call on this thread when the triangle is
+ *          the same
+ *
+ *          The returned pointers remain valid until the next cached call
+ *          on the same thread.
+ *
+ * \param[in]   n_pts    number of Gauss points of the rule (3, 4 or 7)
+ * \param[in]   v1       first vertex
+ * \param[in]   v2       second vertex
+ * \param[in]   v3       third vertex
+ * \param[in]   area     area of triangle {v1, v2, v3}
+ * \param[out]  gpts     pointer to the gauss points
+ * \param[out]  weights  pointer to the weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tria_cached(int                  n_pts,
+                          const cs_real_3_t    v1,
+                          const cs_real_3_t    v2,
+                          const cs_real_3_t    v3,
+                          double               area,
+                          const cs_real_3_t  **gpts,
+                          const double       **weights);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute quadrature points for a tetrahedron, reusing the points
+ *          mapped by the previous call on this thread when the tetrahedron
+ *          is the same
+ *
+ *          The returned pointers remain valid until the next cached call
+ *          on the same thread.
+ *
+ * \param[in]   n_pts    number of Gauss points of the rule (4, 5 or 15)
+ * \param[in]   v1       first vertex
+ * \param[in]   v2       second vertex
+ * \param[in]   v3       third vertex
+ * \param[in]   v4       fourth vertex
+ * \param[in]   vol      volume of tetrahedron {v1, v2, v3, v4}
+ * \param[out]  gpts     pointer to the gauss points
+ * \param[out]  weights  pointer to the weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_quadrature_tet_cached(int                  n_pts,
+                         const cs_real_3_t    v1,
+                         const cs_real_3_t    v2,
+                         const cs_real_3_t    v3,
+                         const cs_real_3_t    v4,
+                         double               vol,
+                         const cs_real_3_t  **gpts,
+                         const double       **weights);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the integral over an edge with the mid-point rule and add
@@ -671,11 +774,12 @@ cs_quadrature_tria_3pts_scal(double                tcur,
                              void                 *input,
                              double                results[])
 {
-  cs_real_3_t  gauss_pts[3];
-  double  evaluation[3], weights[3];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[3];
 
-  /* Compute Gauss points and its unique weight */
-  cs_quadrature_tria_3pts(v1, v2, v3, area, gauss_pts, weights);
+  /* Get Gauss points and its unique weight (cached per cell shape) */
+  cs_quadrature_tria_cached(3, v1, v2, v3, area, &gauss_pts, &weights);
 
   ana(tcur, 3, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -711,11 +815,12 @@ cs_quadrature_tria_4pts_scal(double                tcur,
                              void                 *input,
                              double                results[])
 {
-  cs_real_3_t  gauss_pts[4];
-  double  evaluation[4], weights[4];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[4];
 
-  /* Compute Gauss points and its weights */
-  cs_quadrature_tria_4pts(v1, v2, v3, area, gauss_pts, weights);
+  /* Get Gauss points and its weights (cached per cell shape) */
+  cs_quadrature_tria_cached(4, v1, v2, v3, area, &gauss_pts, &weights);
 
   ana(tcur, 4, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -792,11 +897,12 @@ cs_quadrature_tria_3pts_vect(double                tcur,
                              void                 *input,
                              double                results[])
 {
-  cs_real_3_t  gauss_pts[3];
-  double  evaluation[3*3], weights[3];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[3*3];
 
-  /* Compute Gauss points and its unique weight */
-  cs_quadrature_tria_3pts(v1, v2, v3, area, gauss_pts, weights);
+  /* Get Gauss points and its unique weight (cached per cell shape) */
+  cs_quadrature_tria_cached(3, v1, v2, v3, area, &gauss_pts, &weights);
 
   ana(tcur, 3, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -834,11 +940,12 @@ cs_quadrature_tria_4pts_vect(double                tcur,
                              void                 *input,
                              double                results[])
 {
-  cs_real_3_t  gauss_pts[4];
-  double  evaluation[3*4], weights[4];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[3*4];
 
-  /* Compute Gauss points and its weights */
-  cs_quadrature_tria_4pts(v1, v2, v3, area, gauss_pts, weights);
+  /* Get Gauss points and its weights (cached per cell shape) */
+  cs_quadrature_tria_cached(4, v1, v2, v3, area, &gauss_pts, &weights);
 
   ana(tcur, 4, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -917,11 +1024,12 @@ cs_quadrature_tria_3pts_tens(double                tcur,
                              void                 *input,
                              double                results[])
 {
-  cs_real_3_t  gauss_pts[3];
-  double  evaluation[9*3], weights[3];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[9*3];
 
-  /* Compute Gauss points and its unique weight */
-  cs_quadrature_tria_3pts(v1, v2, v3, area, gauss_pts, weights);
+  /* Get Gauss points and its unique weight (cached per cell shape) */
+  cs_quadrature_tria_cached(3, v1, v2, v3, area, &gauss_pts, &weights);
 
   ana(tcur, 3, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -960,11 +1068,12 @@ cs_quadrature_tria_4pts_tens(double                tcur,
                              void                 *input,
                              double                results[])
 {
-  cs_real_3_t  gauss_pts[4];
-  double  evaluation[9*4], weights[4];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[9*4];
 
-  /* Compute Gauss points and its weights */
-  cs_quadrature_tria_4pts(v1, v2, v3, area, gauss_pts, weights);
+  /* Get Gauss points and its weights (cached per cell shape) */
+  cs_quadrature_tria_cached(4, v1, v2, v3, area, &gauss_pts, &weights);
 
   ana(tcur, 4, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -1047,11 +1156,12 @@ cs_quadrature_tet_4pts_scal(double                tcur,
                             void                 *input,
                             double                results[])
 {
-  cs_real_3_t  gauss_pts[4];
-  double  evaluation[4], weights[4];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[4];
 
-  /* Compute Gauss points and its unique weight */
-  cs_quadrature_tet_4pts(v1, v2, v3, v4, vol, gauss_pts, weights);
+  /* Get Gauss points and its unique weight (cached per cell shape) */
+  cs_quadrature_tet_cached(4, v1, v2, v3, v4, vol, &gauss_pts, &weights);
 
   ana(tcur, 4, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -1089,11 +1199,12 @@ cs_quadrature_tet_5pts_scal(double                tcur,
                             void                 *input,
                             double                results[])
 {
-  cs_real_3_t  gauss_pts[5];
-  double  evaluation[5], weights[5];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[5];
 
-  /* Compute Gauss points and its weights */
-  cs_quadrature_tet_5pts(v1, v2, v3, v4, vol, gauss_pts, weights);
+  /* Get Gauss points and its weights (cached per cell shape) */
+  cs_quadrature_tet_cached(5, v1, v2, v3, v4, vol, &gauss_pts, &weights);
 
   ana(tcur, 5, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -1175,11 +1286,12 @@ cs_quadrature_tet_4pts_vect(double                tcur,
                             void                 *input,
                             double                results[])
 {
-  cs_real_3_t  gauss_pts[4];
-  double  evaluation[3*4], weights[4];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[3*4];
 
-  /* Compute Gauss points and its unique weight */
-  cs_quadrature_tet_4pts(v1, v2, v3, v4, vol, gauss_pts, weights);
+  /* Get Gauss points and its unique weight (cached per cell shape) */
+  cs_quadrature_tet_cached(4, v1, v2, v3, v4, vol, &gauss_pts, &weights);
 
   ana(tcur, 4, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -1219,11 +1331,12 @@ cs_quadrature_tet_5pts_vect(double                tcur,
                             void                 *input,
                             double                results[])
 {
-  cs_real_3_t  gauss_pts[5];
-  double  evaluation[3*5], weights[5];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[3*5];
 
-  /* Compute Gauss points and its weights */
-  cs_quadrature_tet_5pts(v1, v2, v3, v4, vol, gauss_pts, weights);
+  /* Get Gauss points and its weights (cached per cell shape) */
+  cs_quadrature_tet_cached(5, v1, v2, v3, v4, vol, &gauss_pts, &weights);
 
   ana(tcur, 5, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -1306,11 +1419,12 @@ cs_quadrature_tet_4pts_tens(double                tcur,
                             void                 *input,
                             double                results[])
 {
-  cs_real_3_t  gauss_pts[4];
-  double  evaluation[9*4], weights[4];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[9*4];
 
-  /* Compute Gauss points and its unique weight */
-  cs_quadrature_tet_4pts(v1, v2, v3, v4, vol, gauss_pts, weights);
+  /* Get Gauss points and its unique weight (cached per cell shape) */
+  cs_quadrature_tet_cached(4, v1, v2, v3, v4, vol, &gauss_pts, &weights);
 
   ana(tcur, 4, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -1351,11 +1465,12 @@ cs_quadrature_tet_5pts_tens(double                tcur,
                             void                 *input,
                             double                results[])
 {
-  cs_real_3_t  gauss_pts[5];
-  double  evaluation[9*5], weights[5];
+  const cs_real_3_t  *gauss_pts;
+  const double  *weights;
+  double  evaluation[9*5];
 
-  /* Compute Gauss points and its weights */
-  cs_quadrature_tet_5pts(v1, v2, v3, v4, vol, gauss_pts, weights);
+  /* Get Gauss points and its weights (cached per cell shape) */
+  cs_quadrature_tet_cached(5, v1, v2, v3, v4, vol, &gauss_pts, &weights);
 
   ana(tcur, 5, NULL, (const cs_real_t *)gauss_pts, false, input, evaluation);
 
@@ -116,6 +116,57 @@ _create_sdm(cs_flag_t   flag,
   return mat;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Fixed-size square matrix-vector products for the dominant
+ *          CDO-VB/FB local sizes. The constant loop bounds let the
+ *          compiler fully unroll and vectorize these kernels.
+ *
+ * \param[in]      a   matrix values (row-major)
+ * \param[in]      x   vector to multiply
+ * \param[in, out] y   result of the product
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_matvec_sq4(const cs_real_t  *restrict a,
+            const cs_real_t  *restrict x,
+            cs_real_t        *restrict y)
+{
+  for (short int i = 0; i < 4; i++) {
+    const cs_real_t  *a_i = a + 4*i;
+    y[i] = a_i[0]*x[0] + a_i[1]*x[1] + a_i[2]*x[2] + a_i[3]*x[3];
+  }
+}
+
+static inline void
+_matvec_sq6(const cs_real_t  *restrict a,
+            const cs_real_t  *restrict x,
+            cs_real_t        *restrict y)
+{
+  for (short int i = 0; i < 6; i++) {
+    const cs_real_t  *a_i = a + 6*i;
+    cs_real_t  s = 0.;
+    for (short int j = 0; j < 6; j++)
+      s += a_i[j]*x[j];
+    y[i] = s;
+  }
+}
+
+static inline void
+_matvec_sq8(const cs_real_t  *restrict a,
+            const cs_real_t  *restrict x,
+            cs_real_t        *restrict y)
+{
+  for (short int i = 0; i < 8; i++) {
+    const cs_real_t  *a_i = a + 8*i;
+    cs_real_t  s = 0.;
+    for (short int j = 0; j < 8; j++)
+      s += a_i[j]*x[j];
+    y[i] = s;
+  }
+}
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -708,6 +759,22 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
 
   const int  n = mat->n_rows;
 
+  /* Fixed-size kernels for the dominant local sizes */
+
+  switch (n) {
+  case 4:
+    _matvec_sq4(mat->val, vec, mv);
+    return;
+  case 6:
+    _matvec_sq6(mat->val, vec, mv);
+    return;
+  case 8:
+    _matvec_sq8(mat->val, vec, mv);
+    return;
+  default:
+    break;
+  }
+
   /* Initialize mv */
   const cs_real_t  v = vec[0];
   for (short int i = 0; i < n; i++)
@@ -722,6 +789,71 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute dense matrix-vector products for a batch of small
+ *          square systems of the same size, stored contiguously.
+ *          Results have been previously allocated.
+ *
+ * \param[in]      n_sys    number of systems in the batch
+ * \param[in]      n_rows   size of each (square) system
+ * \param[in]      m_vals   matrix values (n_rows*n_rows per system)
+ * \param[in]      vecs     vectors to multiply (n_rows per system)
+ * \param[in, out] mvs      results (n_rows per system)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_square_matvec_batch(cs_lnum_t          n_sys,
+                           int                n_rows,
+                           const cs_real_t   *m_vals,
+                           const cs_real_t   *vecs,
+                           cs_real_t         *mvs)
+{
+  /* Sanity checks */
+  assert(m_vals != NULL && vecs != NULL && mvs != NULL);
+
+  const cs_lnum_t  m_stride = n_rows*n_rows;
+
+  switch (n_rows) {
+
+  case 4:
+    for (cs_lnum_t s = 0; s < n_sys; s++)
+      _matvec_sq4(m_vals + s*m_stride, vecs + 4*s, mvs + 4*s);
+    break;
+
+  case 6:
+    for (cs_lnum_t s = 0; s < n_sys; s++)
+      _matvec_sq6(m_vals + s*m_stride, vecs + 6*s, mvs + 6*s);
+    break;
+
+  case 8:
+    for (cs_lnum_t s = 0; s < n_sys; s++)
+      _matvec_sq8(m_vals + s*m_stride, vecs + 8*s, mvs + 8*s);
+    break;
+
+  default:
+    for (cs_lnum_t s = 0; s < n_sys; s++) {
+
+      const cs_real_t  *a = m_vals + s*m_stride;
+      const cs_real_t  *x = vecs + s*n_rows;
+      cs_real_t  *y = mvs + s*n_rows;
+
+      for (short int i = 0; i < n_rows; i++) {
+        const cs_real_t  *a_i = a + i*n_rows;
+        cs_real_t  sum = 0.;
+        for (short int j = 0; j < n_rows; j++)
+          sum += a_i[j] * x[j];
+        y[i] = sum;
+      }
+
+    }
+    break;
+
+  } /* End of switch on system size */
+
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute a dense matrix-vector product for a rectangular matrix
@@ -1659,6 +1791,49 @@ cs_sdm_66_ldlt_solve(const cs_real_t    f[21],
   x[0] = x[0]*f[0]  -f[15]*x[5] -f[10]*x[4] -f[6]*x[3] -f[3]*x[2] -f[1]*x[1];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a 8x8 matrix with a modified Cholesky decomposition (L.D.L^T)
+ *         The solution should be already allocated
+ * Ref. http://mathforcollege.com/nm/mws/gen/04sle/mws_gen_sle_txt_cholesky.pdf
+ *
+ * \param[in]      f    vector of the coefficients of the decomposition
+ * \param[in]      b    right-hand side
+ * \param[in,out]  x    solution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_88_ldlt_solve(const cs_real_t    f[36],
+                     const cs_real_t    b[8],
+                     cs_real_t          x[8])
+{
+  /* Sanity check */
+  assert(f != NULL && b != NULL && x != NULL);
+
+  x[0] = b[0];
+  x[1] = b[1] - x[0]*f[1];
+  x[2] = b[2] - x[0]*f[3]  - x[1]*f[4];
+  x[3] = b[3] - x[0]*f[6]  - x[1]*f[7]  - x[2]*f[8];
+  x[4] = b[4] - x[0]*f[10] - x[1]*f[11] - x[2]*f[12] - x[3]*f[13];
+  x[5] = b[5] - x[0]*f[15] - x[1]*f[16] - x[2]*f[17] - x[3]*f[18] - x[4]*f[19];
+  x[6] = b[6] - x[0]*f[21] - x[1]*f[22] - x[2]*f[23] - x[3]*f[24] - x[4]*f[25]
+              - x[5]*f[26];
+  x[7] = b[7] - x[0]*f[28] - x[1]*f[29] - x[2]*f[30] - x[3]*f[31] - x[4]*f[32]
+              - x[5]*f[33] - x[6]*f[34];
+
+  x[7] = x[7]*f[35];
+  x[6] = x[6]*f[27] -f[34]*x[7];
+  x[5] = x[5]*f[20] -f[33]*x[7] -f[26]*x[6];
+  x[4] = x[4]*f[14] -f[32]*x[7] -f[25]*x[6] -f[19]*x[5];
+  x[3] = x[3]*f[9]  -f[31]*x[7] -f[24]*x[6] -f[18]*x[5] -f[13]*x[4];
+  x[2] = x[2]*f[5]  -f[30]*x[7] -f[23]*x[6] -f[17]*x[5] -f[12]*x[4] -f[8]*x[3];
+  x[1] = x[1]*f[2]  -f[29]*x[7] -f[22]*x[6] -f[16]*x[5] -f[11]*x[4] -f[7]*x[3]
+                    -f[4]*x[2];
+  x[0] = x[0]*f[0]  -f[28]*x[7] -f[21]*x[6] -f[15]*x[5] -f[10]*x[4] -f[6]*x[3]
+                    -f[3]*x[2]  -f[1]*x[1];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Solve a SPD matrix with a L.D.L^T (Modified Cholesky decomposition)
@@ -1682,9 +1857,24 @@ cs_sdm_ldlt_solve(int                n_rows,
   /* Sanity check */
   assert(facto != NULL && rhs != NULL && sol != NULL);
 
-  if (n_rows == 1) {
+  switch (n_rows) {
+  case 1:
     sol[0] = rhs[0] * facto[0];
     return;
+  case 3:
+    cs_sdm_33_ldlt_solve(facto, rhs, sol);
+    return;
+  case 4:
+    cs_sdm_44_ldlt_solve(facto, rhs, sol);
+    return;
+  case 6:
+    cs_sdm_66_ldlt_solve(facto, rhs, sol);
+    return;
+  case 8:
+    cs_sdm_88_ldlt_solve(facto, rhs, sol);
+    return;
+  default:
+    break;
   }
 
   /* 1 - Solving Lz = b with forward substitution :
@@ -1734,6 +1924,67 @@ cs_sdm_ldlt_solve(int                n_rows,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a set of L.D.L^T factorized systems sharing the same size,
+ *         stored contiguously (one factorization and one right-hand side per
+ *         system). Fixed-size kernels are used for the most common cell-local
+ *         system sizes so that the compiler may vectorize across systems.
+ *
+ * \param[in]       n_sys    number of systems to solve
+ * \param[in]       n_rows   dimension of each system
+ * \param[in]       factos   array of factorization coefficients
+ *                           (n_sys * n_rows*(n_rows+1)/2)
+ * \param[in]       rhs      array of right-hand sides (n_sys * n_rows)
+ * \param[in, out]  sols     array of solutions (n_sys * n_rows)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_ldlt_solve_batch(cs_lnum_t          n_sys,
+                        int                n_rows,
+                        const cs_real_t   *factos,
+                        const cs_real_t   *rhs,
+                        cs_real_t         *sols)
+{
+  /* Sanity check */
+  assert(factos != NULL && rhs != NULL && sols != NULL);
+
+  const cs_lnum_t  f_stride = n_rows*(n_rows+1)/2;
+
+  switch (n_rows) {
+
+  case 3:
+    for (cs_lnum_t i = 0; i < n_sys; i++)
+      cs_sdm_33_ldlt_solve(factos + i*f_stride, rhs + 3*i, sols + 3*i);
+    break;
+
+  case 4:
+    for (cs_lnum_t i = 0; i < n_sys; i++)
+      cs_sdm_44_ldlt_solve(factos + i*f_stride, rhs + 4*i, sols + 4*i);
+    break;
+
+  case 6:
+    for (cs_lnum_t i = 0; i < n_sys; i++)
+      cs_sdm_66_ldlt_solve(factos + i*f_stride, rhs + 6*i, sols + 6*i);
+    break;
+
+  case 8:
+    for (cs_lnum_t i = 0; i < n_sys; i++)
+      cs_sdm_88_ldlt_solve(factos + i*f_stride, rhs + 8*i, sols + 8*i);
+    break;
+
+  default:
+    for (cs_lnum_t i = 0; i < n_sys; i++)
+      cs_sdm_ldlt_solve(n_rows,
+                        factos + i*f_stride,
+                        rhs + i*n_rows,
+                        sols + i*n_rows);
+    break;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Test if a matrix is symmetric. Return 0. if the extradiagonal
@@ -687,6 +687,27 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
                      const cs_real_t   *vec,
                      cs_real_t         *mv);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute dense matrix-vector products for a set of small square
+ *          matrices sharing the same size and stored contiguously
+ *          mvs has been previously allocated
+ *
+ * \param[in]      n_sys   number of local systems
+ * \param[in]      n_rows  size of each local system
+ * \param[in]      m_vals  matrix coefficients (n_sys * n_rows*n_rows)
+ * \param[in]      vecs    vectors to use (n_sys * n_rows)
+ * \param[in, out] mvs     results of the matrix-vector products
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_square_matvec_batch(cs_lnum_t          n_sys,
+                           int                n_rows,
+                           const cs_real_t   *m_vals,
+                           const cs_real_t   *vecs,
+                           cs_real_t         *mvs);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Compute a dense matrix-vector product for a rectangular matrix
@@ -1016,6 +1037,23 @@ cs_sdm_66_ldlt_solve(const cs_real_t    f[21],
                      const cs_real_t    b[6],
                      cs_real_t          x[6]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a 8x8 matrix with a modified Cholesky decomposition (L.D.L^T)
+ *         The solution should be already allocated
+ * Ref. http://mathforcollege.com/nm/mws/gen/04sle/mws_gen_sle_txt_cholesky.pdf
+ *
+ * \param[in]      f    vector of the coefficients of the decomposition
+ * \param[in]      b    right-hand side
+ * \param[in,out]  x    solution
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_88_ldlt_solve(const cs_real_t    f[36],
+                     const cs_real_t    b[8],
+                     cs_real_t          x[8]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Solve a SPD matrix with a L.D.L^T (Modified Cholesky decomposition)
@@ -1036,6 +1074,29 @@ cs_sdm_ldlt_solve(int                n_rows,
                   const cs_real_t   *rhs,
                   cs_real_t         *sol);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Solve a set of L.D.L^T factorized systems sharing the same size,
+ *         stored contiguously (one factorization and one right-hand side per
+ *         system). Fixed-size kernels are used for the most common cell-local
+ *         system sizes so that the compiler may vectorize across systems.
+ *
+ * \param[in]       n_sys    number of systems to solve
+ * \param[in]       n_rows   dimension of each system
+ * \param[in]       factos   array of factorization coefficients
+ *                           (n_sys * n_rows*(n_rows+1)/2)
+ * \param[in]       rhs      array of right-hand sides (n_sys * n_rows)
+ * \param[in, out]  sols     array of solutions (n_sys * n_rows)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sdm_ldlt_solve_batch(cs_lnum_t          n_sys,
+                        int                n_rows,
+                        const cs_real_t   *factos,
+                        const cs_real_t   *rhs,
+                        cs_real_t         *sols);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Test if a matrix is symmetric. Return 0. if the extradiagonal
@@ -43,6 +43,12 @@
 
 BEGIN_C_DECLS
 
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_math.h"
+
 /*----------------------------------------------------------------------------
  * Header for the current file
  *----------------------------------------------------------------------------*/
@@ -321,6 +327,78 @@ cs_static_condensation_recover_vector(const cs_adjacency_t    *c2x,
   } /* Loop on cells */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Opposite process of the static condensation fused with the
+ *          computation of the divergence of the face-based field.
+ *          Both operations sweep the same cell --> faces adjacency and read
+ *          the same face values, so performing them in one pass avoids
+ *          re-streaming the adjacency and px arrays through the cache.
+ *          Case of vector-valued CDO face-based equations
+ *
+ * \param[in]      c2f         pointer to the cell --> faces adjacency
+ * \param[in]      quant       pointer to a cs_cdo_quantities_t structure
+ * \param[in]      rc_tilda    pointer to the rhs related to cell DoFs (Acc-1
+ * \param[in]      acx_tilda   pointer to an unrolled matrix Acc^-1 * Acx
+ * \param[in]      px          values of the fields at faces
+ * \param[in, out] pc          values of the field at cells
+ * \param[in, out] div         divergence of the face-based field at cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_recover_vector_div(const cs_adjacency_t       *c2f,
+                                          const cs_cdo_quantities_t  *quant,
+                                          const cs_real_t            *rc_tilda,
+                                          const cs_real_t            *acx_tilda,
+                                          const cs_real_t            *px,
+                                          cs_real_t                  *pc,
+                                          cs_real_t                  *div)
+{
+  assert(pc != NULL && px != NULL && div != NULL);
+  const cs_lnum_t  n_cells = c2f->n_elts;
+  const int  stride = 3;
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_real_t  acx_px[3] = {0., 0., 0.}; /* Allocated to stride */
+    cs_real_t  c_div = 0.0;
+
+    for (cs_lnum_t i = c2f->idx[c_id]; i < c2f->idx[c_id+1]; i++) {
+
+      const cs_lnum_t  f_id = c2f->ids[i];
+      const cs_real_t  *_px = px + stride*f_id;
+
+      /* Contribution to the recovered cell values */
+      for (int k = 0; k < stride; k++)
+        acx_px[k] += _px[k] * acx_tilda[stride*i+k];
+
+      /* Contribution to the divergence */
+      if (f_id < quant->n_i_faces)
+        c_div += c2f->sgn[i]*cs_math_3_dot_product(_px,
+                                                   quant->i_face_normal
+                                                   + 3*f_id);
+      else {
+
+        const cs_lnum_t  bf_id = f_id - quant->n_i_faces;
+
+        c_div += c2f->sgn[i]*cs_math_3_dot_product(_px,
+                                                   quant->b_face_normal
+                                                   + 3*bf_id);
+
+      } /* Boundary face */
+
+    } /* Loop on cell faces */
+
+    for (int k = 0; k < stride; k++)
+      pc[stride*c_id+k] = rc_tilda[stride*c_id+k] - acx_px[k];
+
+    div[c_id] = c_div/quant->cell_vol[c_id];
+
+  } /* Loop on cells */
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
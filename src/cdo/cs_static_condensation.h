@@ -138,6 +138,34 @@ cs_static_condensation_recover_vector(const cs_adjacency_t    *c2x,
                                       const cs_real_t         *px,
                                       cs_real_t               *pc);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Opposite process of the static condensation fused with the
+ *          computation of the divergence of the face-based field.
+ *          Both operations sweep the same cell --> faces adjacency and read
+ *          the same face values, so performing them in one pass avoids
+ *          re-streaming the adjacency and px arrays through the cache.
+ *          Case of vector-valued CDO face-based equations
+ *
+ * \param[in]      c2f         pointer to the cell --> faces adjacency
+ * \param[in]      quant       pointer to a cs_cdo_quantities_t structure
+ * \param[in]      rc_tilda    pointer to the rhs related to cell DoFs (Acc-1
+ * \param[in]      acx_tilda   pointer to an unrolled matrix Acc^-1 * Acx
+ * \param[in]      px          values of the fields at faces
+ * \param[in, out] pc          values of the field at cells
+ * \param[in, out] div         divergence of the face-based field at cells
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_recover_vector_div(const cs_adjacency_t       *c2f,
+                                          const cs_cdo_quantities_t  *quant,
+                                          const cs_real_t            *rc_tilda,
+                                          const cs_real_t            *acx_tilda,
+                                          const cs_real_t            *px,
+                                          cs_real_t                  *pc,
+                                          cs_real_t                  *div);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
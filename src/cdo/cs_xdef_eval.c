@@ -1226,6 +1226,128 @@ cs_xdef_eval_cell_by_field(cs_lnum_t                    n_elts,
               " %s: Invalid case for the input field", __func__);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate a quantity described by a cs_xdef_t structure for a set
+ *         of elements. One dispatch is done for the whole set so that the
+ *         cost of the indirect call is paid once per batch and the built-in
+ *         range evaluators (constant, time function, array...) can run their
+ *         vectorized loops. Analytic definitions trigger a single call to
+ *         the user-defined function over the full list of elements.
+ *
+ * \param[in]  def        pointer to a cs_xdef_t structure
+ * \param[in]  n_elts     number of elements to consider
+ * \param[in]  elt_ids    list of element ids
+ * \param[in]  compact    true:no indirection, false:indirection for output
+ * \param[in]  mesh       pointer to a cs_mesh_t structure
+ * \param[in]  connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]  quant      pointer to a cs_cdo_quantities_t structure
+ * \param[in]  time_eval  physical time at which one evaluates the term
+ * \param[out] eval       result of the evaluation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_eval_n(const cs_xdef_t             *def,
+               cs_lnum_t                    n_elts,
+               const cs_lnum_t             *elt_ids,
+               bool                         compact,
+               const cs_mesh_t             *mesh,
+               const cs_cdo_connect_t      *connect,
+               const cs_cdo_quantities_t   *quant,
+               cs_real_t                    time_eval,
+               cs_real_t                   *eval)
+{
+  if (def == NULL)
+    return;
+  if (n_elts < 1)
+    return;
+
+  assert(eval != NULL);
+
+  switch (def->type) {
+
+  case CS_XDEF_BY_VALUE:
+    switch (def->dim) {
+    case 1:
+      cs_xdef_eval_scalar_by_val(n_elts, elt_ids, compact,
+                                 mesh, connect, quant, time_eval,
+                                 def->input, eval);
+      break;
+    case 3:
+      cs_xdef_eval_vector_by_val(n_elts, elt_ids, compact,
+                                 mesh, connect, quant, time_eval,
+                                 def->input, eval);
+      break;
+    case 9:
+      cs_xdef_eval_tensor_by_val(n_elts, elt_ids, compact,
+                                 mesh, connect, quant, time_eval,
+                                 def->input, eval);
+      break;
+    default:
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Invalid dimension of definition.", __func__);
+    }
+    break;
+
+  case CS_XDEF_BY_TIME_FUNCTION:
+    switch (def->dim) {
+    case 1:
+      cs_xdef_eval_scalar_at_cells_by_time_func(n_elts, elt_ids, compact,
+                                                mesh, connect, quant,
+                                                time_eval, def->input, eval);
+      break;
+    case 3:
+      cs_xdef_eval_vector_at_cells_by_time_func(n_elts, elt_ids, compact,
+                                                mesh, connect, quant,
+                                                time_eval, def->input, eval);
+      break;
+    case 9:
+      cs_xdef_eval_tensor_at_cells_by_time_func(n_elts, elt_ids, compact,
+                                                mesh, connect, quant,
+                                                time_eval, def->input, eval);
+      break;
+    default:
+      bft_error(__FILE__, __LINE__, 0,
+                " %s: Invalid dimension of definition.", __func__);
+    }
+    break;
+
+  case CS_XDEF_BY_ANALYTIC_FUNCTION:
+    if (def->support == CS_XDEF_SUPPORT_BOUNDARY)
+      cs_xdef_eval_at_b_faces_by_analytic(n_elts, elt_ids, compact,
+                                          mesh, connect, quant, time_eval,
+                                          def->input, eval);
+    else
+      cs_xdef_eval_at_cells_by_analytic(n_elts, elt_ids, compact,
+                                        mesh, connect, quant, time_eval,
+                                        def->input, eval);
+    break;
+
+  case CS_XDEF_BY_ARRAY:
+    if (def->dim == 1)
+      cs_xdef_eval_scalar_at_cells_by_array(n_elts, elt_ids, compact,
+                                            mesh, connect, quant, time_eval,
+                                            def->input, eval);
+    else
+      cs_xdef_eval_nd_at_cells_by_array(n_elts, elt_ids, compact,
+                                        mesh, connect, quant, time_eval,
+                                        def->input, eval);
+    break;
+
+  case CS_XDEF_BY_FIELD:
+    cs_xdef_eval_cell_by_field(n_elts, elt_ids, compact,
+                               mesh, connect, quant, time_eval,
+                               def->input, eval);
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid type of definition.", __func__);
+
+  } /* Switch on the type of definition */
+}
+
 /*----------------------------------------------------------------------------*/
 
 #undef _dp3
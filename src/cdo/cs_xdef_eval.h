@@ -495,6 +495,38 @@ cs_xdef_eval_cell_by_field(cs_lnum_t                    n_elts,
                            void                        *input,
                            cs_real_t                   *eval);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate a quantity described by a cs_xdef_t structure for a set
+ *         of elements. One dispatch is done for the whole set so that the
+ *         cost of the indirect call is paid once per batch and the built-in
+ *         range evaluators (constant, time function, array...) can run their
+ *         vectorized loops. Analytic definitions trigger a single call to
+ *         the user-defined function over the full list of elements.
+ *
+ * \param[in]  def        pointer to a cs_xdef_t structure
+ * \param[in]  n_elts     number of elements to consider
+ * \param[in]  elt_ids    list of element ids
+ * \param[in]  compact    true:no indirection, false:indirection for output
+ * \param[in]  mesh       pointer to a cs_mesh_t structure
+ * \param[in]  connect    pointer to a cs_cdo_connect_t structure
+ * \param[in]  quant      pointer to a cs_cdo_quantities_t structure
+ * \param[in]  time_eval  physical time at which one evaluates the term
+ * \param[out] eval       result of the evaluation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_xdef_eval_n(const cs_xdef_t             *def,
+               cs_lnum_t                    n_elts,
+               const cs_lnum_t             *elt_ids,
+               bool                         compact,
+               const cs_mesh_t             *mesh,
+               const cs_cdo_connect_t      *connect,
+               const cs_cdo_quantities_t   *quant,
+               cs_real_t                    time_eval,
+               cs_real_t                   *eval);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
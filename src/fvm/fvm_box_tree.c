@@ -304,6 +304,40 @@ _get_box_tree_stats(fvm_box_tree_t  *bt)
     _update_tree_stats(bt, 0);
 }
 
+/*----------------------------------------------------------------------------
+ * Build the list of current tree leaves, in depth-first order.
+ *
+ * The list is used to replace recursive traversals of the tree by flat
+ * (and thus easily threadable) loops on its leaves.
+ *
+ * parameters:
+ *   bt       <-- pointer to the box tree structure
+ *   node_id  <-- id of the starting node
+ *   n_leaves <-> current number of leaves in the list
+ *   leaf_ids <-> ids of the tree leaves
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_leaf_ids(const fvm_box_tree_t  *bt,
+                cs_lnum_t              node_id,
+                cs_lnum_t             *n_leaves,
+                cs_lnum_t              leaf_ids[])
+{
+  cs_lnum_t   i;
+
+  const _node_t  *node = bt->nodes + node_id;
+
+  if (node->is_leaf == false) {
+    for (i = 0; i < bt->n_children; i++)
+      _build_leaf_ids(bt,
+                      bt->child_ids[bt->n_children*node_id + i],
+                      n_leaves,
+                      leaf_ids);
+  }
+  else
+    leaf_ids[(*n_leaves)++] = node_id;
+}
+
 /*----------------------------------------------------------------------------
  * Get the coordinates in the grid for the current point at this level.
  *
@@ -621,66 +655,20 @@ _evaluate_splitting_1d(fvm_box_tree_t       *bt,
   return n_linked_boxes;
 }
 
-/*----------------------------------------------------------------------------
- * Evaluate the box distribution over the leaves of the box tree to help
- * determine if we should add a level to the tree structure.
- *
- * parameters:
- *   bt              <->  pointer to the box tree being built
- *   boxes           <--  pointer to the associated box set structure
- *   node_id         <--  id of the starting node
- *   build_type      <--  layout variant for building the tree structure
- *   next_level_size -->  size of box_ids for the next level
- *----------------------------------------------------------------------------*/
-
-static void
-_count_next_level(fvm_box_tree_t           *bt,
-                  const fvm_box_set_t      *boxes,
-                  cs_lnum_t                 node_id,
-                  fvm_box_tree_sync_t       build_type,
-                  cs_lnum_t                *next_level_size)
-{
-  cs_lnum_t   i;
-
-  _node_t  *node = bt->nodes + node_id;
-
-  if (node->is_leaf == false) {
-
-    assert(bt->child_ids[bt->n_children*node_id] > 0);
-
-    for (i = 0; i < bt->n_children; i++)
-      _count_next_level(bt,
-                        boxes,
-                        bt->child_ids[bt->n_children*node_id + i],
-                        build_type,
-                        next_level_size);
-
-  }
-
-  else { /* if (node->is_leaf == true) */
-    if (   node->n_boxes < bt->threshold
-        && node_id != 0                    /* Root node is always divided */
-        && build_type == FVM_BOX_TREE_ASYNC_LEVEL)
-      *next_level_size += node->n_boxes;
-
-    else { /* Split node and evaluate box distribution between its children */
-      if (boxes->dim == 3)
-        *next_level_size += _evaluate_splitting_3d(bt, boxes, node_id);
-      else if (boxes->dim == 2)
-        *next_level_size += _evaluate_splitting_2d(bt, boxes, node_id);
-      else if (boxes->dim == 1)
-        *next_level_size += _evaluate_splitting_1d(bt, boxes, node_id);
-    }
-  }
-}
-
 /*----------------------------------------------------------------------------
  * Test if we have to continue the building of the box tree.
  *
+ * The box distribution over the leaves of the next level is also
+ * evaluated here (leaf by leaf, so this may be threaded), and returned
+ * for use by the next level's build.
+ *
  * parameters:
  *   bt         <->  pointer to the box tree being built
  *   boxes      <--  pointer to the associated box set structure
  *   build_type <--  layout variant for building the tree structure
+ *   n_leaves   <--  number of current tree leaves
+ *   leaf_ids   <--  ids of the current tree leaves
+ *   leaf_count -->  number of boxes linked to each leaf at the next level
  *   next_size  -->  size of box_ids for the next tree if required
  *
  * returns:
@@ -691,6 +679,9 @@ static _Bool
 _recurse_tree_build(fvm_box_tree_t       *bt,
                     const fvm_box_set_t  *boxes,
                     fvm_box_tree_sync_t   build_type,
+                    cs_lnum_t             n_leaves,
+                    const cs_lnum_t       leaf_ids[],
+                    cs_lnum_t             leaf_count[],
                     cs_lnum_t            *next_size)
 {
   int  state = 0;
@@ -739,15 +730,38 @@ _recurse_tree_build(fvm_box_tree_t       *bt,
 
   if (state == 0) {
 
+    cs_lnum_t li;
     float box_ratio;
 
     /* Limit, to avoid excessive memory usage */
 
-    _count_next_level(bt,
-                      boxes,
-                      0,  /* Starts from root */
-                      build_type,
-                      &_next_size);
+#   pragma omp parallel for reduction(+:_next_size) \
+                            if (n_leaves > CS_THR_MIN)
+    for (li = 0; li < n_leaves; li++) {
+
+      cs_lnum_t  _count = 0;
+      const cs_lnum_t  node_id = leaf_ids[li];
+      const _node_t  *node = bt->nodes + node_id;
+
+      if (   node->n_boxes < bt->threshold
+          && node_id != 0                    /* Root node is always divided */
+          && build_type == FVM_BOX_TREE_ASYNC_LEVEL)
+        _count = node->n_boxes;
+
+      else { /* Split node and evaluate box distribution
+                between its children */
+        if (boxes->dim == 3)
+          _count = _evaluate_splitting_3d(bt, boxes, node_id);
+        else if (boxes->dim == 2)
+          _count = _evaluate_splitting_2d(bt, boxes, node_id);
+        else if (boxes->dim == 1)
+          _count = _evaluate_splitting_1d(bt, boxes, node_id);
+      }
+
+      leaf_count[li] = _count;
+      _next_size += _count;
+
+    }
 
     if (bt->stats.n_boxes > 0)
       box_ratio = (_next_size*1.0)/bt->stats.n_boxes;
@@ -865,12 +879,17 @@ _new_node(fvm_box_tree_t     *bt,
 /*----------------------------------------------------------------------------
  * Split a node into its children and define the new box distribution.
  *
+ * The ids of the children nodes and the positions in the new box_ids
+ * array are determined by the caller, so that several nodes may be
+ * split concurrently.
+ *
  * parameters:
- *   bt         <->  pointer to the box tree being built
- *   next_bt    <->  pointer to the next box tree being built
- *   boxes      <--  pointer to the associated box set structure
- *   node_id    <--  id of the starting node
- *   shift_ids  <->  first free position free in new box_ids
+ *   bt           <->  pointer to the box tree being built
+ *   next_bt      <->  pointer to the next box tree being built
+ *   boxes        <--  pointer to the associated box set structure
+ *   node_id      <--  id of the starting node
+ *   n_init_nodes <--  id of the first child node
+ *   shift_id     <--  first free position in new box_ids
  *----------------------------------------------------------------------------*/
 
 static void
@@ -878,15 +897,15 @@ _split_node_3d(fvm_box_tree_t       *bt,
                fvm_box_tree_t       *next_bt,
                const fvm_box_set_t  *boxes,
                cs_lnum_t             node_id,
-               cs_lnum_t            *shift_ids)
+               cs_lnum_t             n_init_nodes,
+               cs_lnum_t             shift_id)
 {
   int j, i;
   fvm_morton_code_t  min_code, max_code;
   fvm_morton_code_t  children[8];
 
   cs_lnum_t   n_linked_boxes = 0;
-  cs_lnum_t   _shift_ids = *shift_ids;
-  cs_lnum_t   n_init_nodes = next_bt->n_nodes;
+  cs_lnum_t   _shift_ids = shift_id;
   _node_t  split_node = next_bt->nodes[node_id];
 
   const _node_t  node = bt->nodes[node_id];
@@ -894,15 +913,6 @@ _split_node_3d(fvm_box_tree_t       *bt,
 
   assert(bt->n_children == 8);
 
-  /* Add the leaves to the next_bt structure */
-
-  if (n_init_nodes + 8 > next_bt->n_max_nodes) {
-    assert(next_bt->n_max_nodes > 0);
-    next_bt->n_max_nodes *= 2;
-    BFT_REALLOC(next_bt->nodes, next_bt->n_max_nodes, _node_t);
-    BFT_REALLOC(next_bt->child_ids, next_bt->n_max_nodes*8, cs_lnum_t);
-  }
-
   /* Define a Morton code for each child and create the children nodes */
 
   fvm_morton_get_children(3, node.morton_code, children);
@@ -918,7 +928,6 @@ _split_node_3d(fvm_box_tree_t       *bt,
   split_node.is_leaf = false;
 
   next_bt->nodes[node_id] = split_node;
-  next_bt->n_nodes = n_init_nodes + 8;
 
   /* Counting loop on boxes associated to the node_id */
 
@@ -1047,10 +1056,6 @@ _split_node_3d(fvm_box_tree_t       *bt,
          == (  next_bt->nodes[n_init_nodes + 8 - 1].start_id
              + next_bt->nodes[n_init_nodes + 8 - 1].n_boxes));
 #endif
-
-  /* Return pointers */
-
-  *shift_ids = _shift_ids;
 }
 
 static void
@@ -1058,15 +1063,15 @@ _split_node_2d(fvm_box_tree_t       *bt,
                fvm_box_tree_t       *next_bt,
                const fvm_box_set_t  *boxes,
                cs_lnum_t             node_id,
-               cs_lnum_t            *shift_ids)
+               cs_lnum_t             n_init_nodes,
+               cs_lnum_t             shift_id)
 {
   int j, i;
   fvm_morton_code_t  min_code, max_code;
   fvm_morton_code_t  children[4];
 
   cs_lnum_t   n_linked_boxes = 0;
-  cs_lnum_t   _shift_ids = *shift_ids;
-  cs_lnum_t   n_init_nodes = next_bt->n_nodes;
+  cs_lnum_t   _shift_ids = shift_id;
   _node_t  split_node = next_bt->nodes[node_id];
 
   const _node_t  node = bt->nodes[node_id];
@@ -1074,15 +1079,6 @@ _split_node_2d(fvm_box_tree_t       *bt,
 
   assert(bt->n_children == 4);
 
-  /* Add the leaves to the next_bt structure */
-
-  if (n_init_nodes + 4 > next_bt->n_max_nodes) {
-    assert(next_bt->n_max_nodes > 0);
-    next_bt->n_max_nodes *= 2;
-    BFT_REALLOC(next_bt->nodes, next_bt->n_max_nodes, _node_t);
-    BFT_REALLOC(next_bt->child_ids, next_bt->n_max_nodes*4, cs_lnum_t);
-  }
-
   /* Define a Morton code for each child and create the children nodes */
 
   fvm_morton_get_children(2, node.morton_code, children);
@@ -1098,7 +1094,6 @@ _split_node_2d(fvm_box_tree_t       *bt,
   split_node.is_leaf = false;
 
   next_bt->nodes[node_id] = split_node;
-  next_bt->n_nodes = n_init_nodes + 4;
 
   /* Counting loop on boxes associated to the node_id */
 
@@ -1227,10 +1222,6 @@ _split_node_2d(fvm_box_tree_t       *bt,
          == (  next_bt->nodes[n_init_nodes + 4 - 1].start_id
              + next_bt->nodes[n_init_nodes + 4 - 1].n_boxes));
 #endif
-
-  /* Return pointers */
-
-  *shift_ids = _shift_ids;
 }
 
 static void
@@ -1238,15 +1229,15 @@ _split_node_1d(fvm_box_tree_t       *bt,
                fvm_box_tree_t       *next_bt,
                const fvm_box_set_t  *boxes,
                cs_lnum_t             node_id,
-               cs_lnum_t            *shift_ids)
+               cs_lnum_t             n_init_nodes,
+               cs_lnum_t             shift_id)
 {
   int j, i;
   fvm_morton_code_t  min_code, max_code;
   fvm_morton_code_t  children[2];
 
   cs_lnum_t   n_linked_boxes = 0;
-  cs_lnum_t   _shift_ids = *shift_ids;
-  cs_lnum_t   n_init_nodes = next_bt->n_nodes;
+  cs_lnum_t   _shift_ids = shift_id;
   _node_t  split_node = next_bt->nodes[node_id];
 
   const _node_t  node = bt->nodes[node_id];
@@ -1254,15 +1245,6 @@ _split_node_1d(fvm_box_tree_t       *bt,
 
   assert(bt->n_children == 2);
 
-  /* Add the leaves to the next_bt structure */
-
-  if (n_init_nodes + 2 > next_bt->n_max_nodes) {
-    assert(next_bt->n_max_nodes > 0);
-    next_bt->n_max_nodes *= 2;
-    BFT_REALLOC(next_bt->nodes, next_bt->n_max_nodes, _node_t);
-    BFT_REALLOC(next_bt->child_ids, next_bt->n_max_nodes*2, cs_lnum_t);
-  }
-
   /* Define a Morton code for each child and create the children nodes */
 
   fvm_morton_get_children(1, node.morton_code, children);
@@ -1278,7 +1260,6 @@ _split_node_1d(fvm_box_tree_t       *bt,
   split_node.is_leaf = false;
 
   next_bt->nodes[node_id] = split_node;
-  next_bt->n_nodes = n_init_nodes + 2;
 
   /* Counting loop on boxes associated to the node_id */
 
@@ -1407,52 +1388,86 @@ _split_node_1d(fvm_box_tree_t       *bt,
          == (  next_bt->nodes[n_init_nodes + 2 - 1].start_id
              + next_bt->nodes[n_init_nodes + 2 - 1].n_boxes));
 #endif
-
-  /* Return pointers */
-
-  *shift_ids = _shift_ids;
 }
 
 /*----------------------------------------------------------------------------
  * Evaluate the box distribution over the leaves of the box tree when adding
  * a level to the tree structure.
  *
+ * Children node ids and positions in the new box_ids array are determined
+ * in a prior pass over the leaves, so the leaves may then be split
+ * concurrently.
+ *
  * parameters:
  *   bt         <->  pointer to the box tree being built
  *   next_bt    <->  pointer to the next box tree being built
  *   boxes      <--  pointer to the associated box set structure
- *   node_id    <--  id of the starting node
  *   build_type <--  layout variant for building the tree structure
- *   shift_ids  <->  first free position free in new box_ids
+ *   n_leaves   <--  number of current tree leaves
+ *   leaf_ids   <--  ids of the current tree leaves
+ *   leaf_count <--  number of boxes linked to each leaf at the next level
  *----------------------------------------------------------------------------*/
 
 static void
 _build_next_level(fvm_box_tree_t       *bt,
                   fvm_box_tree_t       *next_bt,
                   const fvm_box_set_t  *boxes,
-                  cs_lnum_t             node_id,
                   fvm_box_tree_sync_t   build_type,
-                  cs_lnum_t            *shift_ids)
+                  cs_lnum_t             n_leaves,
+                  const cs_lnum_t       leaf_ids[],
+                  const cs_lnum_t       leaf_count[])
 {
-  cs_lnum_t   i;
+  cs_lnum_t   li;
 
-  cs_lnum_t   _shift_ids = *shift_ids;
-  const _node_t  *cur_node = bt->nodes + node_id;
+  cs_lnum_t  *node_shift = NULL, *box_shift = NULL;
 
-  if (cur_node->is_leaf == false) {
+  cs_lnum_t  n_new_nodes = 0, _shift_ids = 0;
+  const cs_lnum_t  n_init_nodes = next_bt->n_nodes;
 
-    assert(bt->child_ids[bt->n_children*node_id] > 0);
+  /* Determine the id of the first child node and the first position in
+     the new box_ids array associated with each leaf */
 
-    for (i = 0; i < bt->n_children; i++)
-      _build_next_level(bt,
-                        next_bt,
-                        boxes,
-                        bt->child_ids[bt->n_children*node_id + i],
-                        build_type,
-                        &_shift_ids);
+  BFT_MALLOC(node_shift, n_leaves, cs_lnum_t);
+  BFT_MALLOC(box_shift, n_leaves, cs_lnum_t);
+
+  for (li = 0; li < n_leaves; li++) {
+
+    const cs_lnum_t  node_id = leaf_ids[li];
+    const _node_t  *cur_node = bt->nodes + node_id;
+
+    node_shift[li] = n_init_nodes + n_new_nodes;
+    box_shift[li] = _shift_ids;
+
+    if (   cur_node->n_boxes >= bt->threshold
+        || node_id == 0                    /* Root node is always divided */
+        || build_type != FVM_BOX_TREE_ASYNC_LEVEL)
+      n_new_nodes += bt->n_children;
+
+    _shift_ids += leaf_count[li];
+
+  }
+
+  /* Add the new nodes to the next_bt structure in a single step,
+     so that no reallocation may occur while leaves are being split */
+
+  if (n_init_nodes + n_new_nodes > next_bt->n_max_nodes) {
+    next_bt->n_max_nodes = n_init_nodes + n_new_nodes;
+    BFT_REALLOC(next_bt->nodes, next_bt->n_max_nodes, _node_t);
+    BFT_REALLOC(next_bt->child_ids,
+                next_bt->n_max_nodes*next_bt->n_children,
+                cs_lnum_t);
   }
 
-  else { /* if (node->is_leaf == true) */
+  next_bt->n_nodes = n_init_nodes + n_new_nodes;
+
+  /* Now split (or simply copy) the leaves; writes relative to different
+     leaves are independent, given the shifts computed above */
+
+# pragma omp parallel for schedule(dynamic) if (n_leaves > CS_THR_MIN)
+  for (li = 0; li < n_leaves; li++) {
+
+    const cs_lnum_t  node_id = leaf_ids[li];
+    const _node_t  *cur_node = bt->nodes + node_id;
 
     if (   cur_node->n_boxes < bt->threshold
         && node_id != 0                    /* Root node is always divided */
@@ -1460,13 +1475,14 @@ _build_next_level(fvm_box_tree_t       *bt,
 
       /* Copy related box_ids in the new next_ids */
 
+      cs_lnum_t  i;
       _node_t *next_node = next_bt->nodes + node_id;
 
       next_node->n_boxes = cur_node->n_boxes;
-      next_node->start_id = _shift_ids;
+      next_node->start_id = box_shift[li];
 
       for (i = 0; i < cur_node->n_boxes; i++)
-        next_bt->box_ids[_shift_ids++]
+        next_bt->box_ids[box_shift[li] + i]
           = bt->box_ids[cur_node->start_id + i];
     }
     else {  /* Split node and evaluate box distribution between its children */
@@ -1476,26 +1492,28 @@ _build_next_level(fvm_box_tree_t       *bt,
                        next_bt,
                        boxes,
                        node_id,
-                       &_shift_ids);
+                       node_shift[li],
+                       box_shift[li]);
       else if (boxes->dim == 2)
         _split_node_2d(bt,
                        next_bt,
                        boxes,
                        node_id,
-                       &_shift_ids);
+                       node_shift[li],
+                       box_shift[li]);
       else if (boxes->dim == 1)
         _split_node_1d(bt,
                        next_bt,
                        boxes,
                        node_id,
-                       &_shift_ids);
+                       node_shift[li],
+                       box_shift[li]);
     }
 
   }
 
-  /* Prepare return values */
-
-  *shift_ids = _shift_ids;
+  BFT_FREE(box_shift);
+  BFT_FREE(node_shift);
 }
 
 #if defined(HAVE_MPI)
@@ -2080,11 +2098,10 @@ fvm_box_tree_set_boxes(fvm_box_tree_t       *bt,
                        const fvm_box_set_t  *boxes,
                        fvm_box_tree_sync_t   build_type)
 {
-  cs_lnum_t   box_id;
-
   fvm_box_tree_t  tmp_bt;
 
-  cs_lnum_t   next_box_ids_size = 0, shift = 0;
+  cs_lnum_t   next_box_ids_size = 0;
+  cs_lnum_t  *leaf_ids = NULL, *leaf_count = NULL;
   cs_coord_t anchor[3] = {0., 0., 0.};
 
   /* Initialization */
@@ -2123,12 +2140,54 @@ fvm_box_tree_set_boxes(fvm_box_tree_t       *bt,
 
   _new_node(bt, fvm_morton_encode(boxes->dim, 0, anchor), 0);
 
-  /* Initialize bt by assigning all boxes to the root leaf */
+  /* Initialize bt by assigning all boxes to the root leaf, ordered along
+     the Morton curve defined by the box centers; boxes assigned to a
+     given subtree are thus mostly contiguous in box_ids, which improves
+     the memory locality of the per-level passes below */
 
   BFT_MALLOC(bt->box_ids, boxes->n_boxes, cs_lnum_t);
 
-  for (box_id = 0; box_id < boxes->n_boxes; box_id++)
-    bt->box_ids[box_id] = box_id;
+  if (boxes->n_boxes > 0) {
+
+    cs_lnum_t   i, j;
+    cs_coord_t  *box_cen = NULL;
+    fvm_morton_code_t  *box_codes = NULL;
+
+    cs_coord_t  extents[6] = {0., 0., 0., 1., 1., 1.};
+
+    const int  dim = boxes->dim;
+    const fvm_morton_int_t  level = sizeof(fvm_morton_int_t)*8 - 1;
+
+    for (i = 0; i < dim; i++) {
+      extents[i] = 0.;
+      extents[i + dim] = 1.;
+    }
+
+    BFT_MALLOC(box_cen, boxes->n_boxes*dim, cs_coord_t);
+
+#   pragma omp parallel for private(j) if (boxes->n_boxes > CS_THR_MIN)
+    for (i = 0; i < boxes->n_boxes; i++) {
+      const cs_coord_t  *box_min = _box_min(boxes, i);
+      const cs_coord_t  *box_max = _box_max(boxes, i);
+      for (j = 0; j < dim; j++)
+        box_cen[i*dim + j] = (box_min[j] + box_max[j]) * 0.5;
+    }
+
+    BFT_MALLOC(box_codes, boxes->n_boxes, fvm_morton_code_t);
+
+    fvm_morton_encode_coords(dim,
+                             level,
+                             extents,
+                             boxes->n_boxes,
+                             box_cen,
+                             box_codes);
+
+    fvm_morton_local_order(boxes->n_boxes, box_codes, bt->box_ids);
+
+    BFT_FREE(box_codes);
+    BFT_FREE(box_cen);
+
+  }
 
   (bt->nodes[0]).is_leaf = true;
   (bt->nodes[0]).n_boxes = boxes->n_boxes;
@@ -2138,12 +2197,31 @@ fvm_box_tree_set_boxes(fvm_box_tree_t       *bt,
 
   _get_box_tree_stats(bt);
 
-  /* Build local tree structure by adding boxes from the root */
+  /* Build local tree structure by adding boxes from the root,
+     level by level */
+
+  while (true) {
 
-  while (_recurse_tree_build(bt,
-                             boxes,
-                             build_type,
-                             &next_box_ids_size)) {
+    cs_lnum_t  n_leaves = 0;
+
+    /* Build the list of current leaves, on which the counting and
+       splitting passes may loop concurrently */
+
+    BFT_REALLOC(leaf_ids, bt->stats.n_leaves, cs_lnum_t);
+    BFT_REALLOC(leaf_count, bt->stats.n_leaves, cs_lnum_t);
+
+    _build_leaf_ids(bt, 0, &n_leaves, leaf_ids);
+
+    assert(n_leaves == bt->stats.n_leaves);
+
+    if (_recurse_tree_build(bt,
+                            boxes,
+                            build_type,
+                            n_leaves,
+                            leaf_ids,
+                            leaf_count,
+                            &next_box_ids_size) == false)
+      break;
 
     /* Initialize next_bt: copy of bt */
 
@@ -2160,16 +2238,14 @@ fvm_box_tree_set_boxes(fvm_box_tree_t       *bt,
     /* Define a box ids list for the next level of the boxtree */
 
     BFT_REALLOC(tmp_bt.box_ids, next_box_ids_size, cs_lnum_t);
-    shift = 0;
 
     _build_next_level(bt,
                       &tmp_bt,
                       boxes,
-                      0, /* Starts from root */
                       build_type,
-                      &shift);
-
-    assert(shift == next_box_ids_size);
+                      n_leaves,
+                      leaf_ids,
+                      leaf_count);
 
     /* replace current tree by the tree computed at a higher level */
 
@@ -2184,6 +2260,9 @@ fvm_box_tree_set_boxes(fvm_box_tree_t       *bt,
 #endif
 
   } /* While building should continue */
+
+  BFT_FREE(leaf_count);
+  BFT_FREE(leaf_ids);
 }
 
 #if defined(HAVE_MPI)
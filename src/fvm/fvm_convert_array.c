@@ -36,6 +36,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <string.h>
 
 /*----------------------------------------------------------------------------
  *  Local headers
@@ -66,6 +67,86 @@ BEGIN_C_DECLS
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Convert and gather contiguous, interlaced floating-point values using
+ * a parent entity number indirection.
+ *
+ * This is a blocked, threaded fast path for the common case of a single
+ * parent list with interlaced data of identical source and destination
+ * dimension; the inner loops are contiguous over each element's
+ * components, so the compiler may vectorize them.
+ *
+ * parameters:
+ *   dim           <-- data dimension
+ *   n_elts        <-- number of elements to convert
+ *   parent_num    <-- parent entity numbers (1 to n)
+ *   src_datatype  <-- source data type (CS_FLOAT or CS_DOUBLE)
+ *   dest_datatype <-- destination data type (CS_FLOAT or CS_DOUBLE)
+ *   src_data      <-- source buffer
+ *   dest_data     --> destination buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_convert_array_fp_gather(const int             dim,
+                         const cs_lnum_t       n_elts,
+                         const cs_lnum_t       parent_num[],
+                         const cs_datatype_t   src_datatype,
+                         const cs_datatype_t   dest_datatype,
+                         const void     *const src_data,
+                         void           *const dest_data)
+{
+  const size_t _dim = (size_t)dim;
+
+  if (src_datatype == CS_FLOAT) {
+
+    const float *const src = src_data;
+
+    if (dest_datatype == CS_FLOAT) {
+      float *const dest = dest_data;
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        const size_t p = (size_t)(parent_num[i] - 1) * _dim;
+        for (size_t k = 0; k < _dim; k++)
+          dest[i*_dim + k] = src[p + k];
+      }
+    }
+    else { /* dest_datatype == CS_DOUBLE */
+      double *const dest = dest_data;
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        const size_t p = (size_t)(parent_num[i] - 1) * _dim;
+        for (size_t k = 0; k < _dim; k++)
+          dest[i*_dim + k] = src[p + k];
+      }
+    }
+
+  }
+  else { /* src_datatype == CS_DOUBLE */
+
+    const double *const src = src_data;
+
+    if (dest_datatype == CS_FLOAT) {
+      float *const dest = dest_data;
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        const size_t p = (size_t)(parent_num[i] - 1) * _dim;
+        for (size_t k = 0; k < _dim; k++)
+          dest[i*_dim + k] = src[p + k];
+      }
+    }
+    else { /* dest_datatype == CS_DOUBLE */
+      double *const dest = dest_data;
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++) {
+        const size_t p = (size_t)(parent_num[i] - 1) * _dim;
+        for (size_t k = 0; k < _dim; k++)
+          dest[i*_dim + k] = src[p + k];
+      }
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Convert an array representation of floats to floats, with possible
  * indirection, interlacing, de-interlacing, or change of data dimension.
@@ -1956,6 +2037,76 @@ _convert_array_uint64_to_uint64(const cs_lnum_t               src_idx_start,
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Convert a contiguous array of floating-point values from one type to
+ * another, or copy it if source and destination types are identical.
+ *
+ * The conversion is blocked and threaded, with contiguous inner loops
+ * the compiler may vectorize; it is also usable for file output staging
+ * buffers, whose conversion needs are a subset of those of writers.
+ *
+ * Source and destination datatypes must be CS_FLOAT or CS_DOUBLE,
+ * except when identical, in which case any datatype is allowed.
+ *
+ * parameters:
+ *   n_values      <-- number of values to convert
+ *   src_datatype  <-- source data type
+ *   dest_datatype <-- destination data type
+ *   src_data      <-- source buffer
+ *   dest_data     --> destination buffer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_convert_array_contiguous(const size_t          n_values,
+                             const cs_datatype_t   src_datatype,
+                             const cs_datatype_t   dest_datatype,
+                             const void     *const src_data,
+                             void           *const dest_data)
+{
+  if (src_datatype == dest_datatype) {
+
+    /* Blocked copy, so that large arrays are moved by multiple threads */
+
+    const size_t block_size = 1 << 18;
+    const size_t type_size = cs_datatype_size[src_datatype];
+    const size_t n_blocks = (n_values + block_size - 1) / block_size;
+
+#   pragma omp parallel for if (n_values > CS_THR_MIN)
+    for (size_t b = 0; b < n_blocks; b++) {
+      const size_t s_id = b*block_size;
+      const size_t e_id = CS_MIN(s_id + block_size, n_values);
+      memcpy((unsigned char *)dest_data + s_id*type_size,
+             (const unsigned char *)src_data + s_id*type_size,
+             (e_id - s_id)*type_size);
+    }
+
+  }
+  else if (src_datatype == CS_FLOAT && dest_datatype == CS_DOUBLE) {
+
+    const float *const src = src_data;
+    double *const dest = dest_data;
+
+#   pragma omp parallel for if (n_values > CS_THR_MIN)
+    for (size_t i = 0; i < n_values; i++)
+      dest[i] = src[i];
+
+  }
+  else if (src_datatype == CS_DOUBLE && dest_datatype == CS_FLOAT) {
+
+    const double *const src = src_data;
+    float *const dest = dest_data;
+
+#   pragma omp parallel for if (n_values > CS_THR_MIN)
+    for (size_t i = 0; i < n_values; i++)
+      dest[i] = src[i];
+
+  }
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("fvm_convert_array_contiguous() may only convert "
+                "between float and double data."));
+}
+
 /*----------------------------------------------------------------------------
  * Convert an array representation of one type to that of another type, with
  * possible indirection, interlacing, de-interlacing, or change of data
@@ -2008,6 +2159,42 @@ fvm_convert_array(const int                     src_dim,
 {
   assert(src_dim_shift <= src_dim);
 
+  /* Blocked, threaded fast paths for the most common output cases:
+     floating-point data, interlaced if multidimensional, with identical
+     source and destination dimensions, and at most one parent list. */
+
+  if (   (src_datatype == CS_FLOAT || src_datatype == CS_DOUBLE)
+      && (dest_datatype == CS_FLOAT || dest_datatype == CS_DOUBLE)
+      && src_dim == dest_dim
+      && src_dim_shift == 0
+      && (src_dim == 1 || src_interlace == CS_INTERLACE)) {
+
+    if (n_parent_lists == 0) {
+      const size_t type_size = cs_datatype_size[src_datatype];
+      fvm_convert_array_contiguous(  (size_t)(src_idx_end - src_idx_start)
+                                   * (size_t)src_dim,
+                                   src_datatype,
+                                   dest_datatype,
+                                     (const unsigned char *)src_data[0]
+                                   + (size_t)src_idx_start*src_dim*type_size,
+                                   dest_data);
+      return;
+    }
+    else if (   n_parent_lists == 1
+             && parent_num != NULL
+             && parent_num_shift[0] == 0) {
+      _convert_array_fp_gather(src_dim,
+                               src_idx_end - src_idx_start,
+                               parent_num + src_idx_start,
+                               src_datatype,
+                               dest_datatype,
+                               src_data[0],
+                               dest_data);
+      return;
+    }
+
+  }
+
   switch(src_datatype) {
 
   case CS_FLOAT:  /* float source datatype */
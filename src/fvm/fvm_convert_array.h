@@ -60,6 +60,32 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Convert a contiguous array of floating-point values from one type to
+ * another, or copy it if source and destination types are identical.
+ *
+ * The conversion is blocked and threaded, with contiguous inner loops
+ * the compiler may vectorize; it is also usable for file output staging
+ * buffers, whose conversion needs are a subset of those of writers.
+ *
+ * Source and destination datatypes must be CS_FLOAT or CS_DOUBLE,
+ * except when identical, in which case any datatype is allowed.
+ *
+ * parameters:
+ *   n_values      <-- number of values to convert
+ *   src_datatype  <-- source data type
+ *   dest_datatype <-- destination data type
+ *   src_data      <-- source buffer
+ *   dest_data     --> destination buffer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_convert_array_contiguous(const size_t          n_values,
+                             const cs_datatype_t   src_datatype,
+                             const cs_datatype_t   dest_datatype,
+                             const void     *const src_data,
+                             void           *const dest_data);
+
 /*----------------------------------------------------------------------------
  * Convert an array representation of one type to that of another type, with
  * possible indirection, interlacing, de-interlacing, or change of data
@@ -202,6 +202,63 @@ _s_compare(const void  *elt1,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Function pointer for conversion of a double precision value in
+ * range [0, 1] to a global number in range [1, g_max].
+ *
+ * This is used to sample the first adjacency value of each entity,
+ * and is passed through a function pointer
+ * to cs_sort_partition_dest_rank_id.
+ *
+ * parameters:
+ *   s     <-- coordinate between 0 and 1
+ *   elt   --> pointer to element
+ *   input <-- pointer to global maximum adjacency value (cs_gnum_t)
+ *----------------------------------------------------------------------------*/
+
+static void
+_s_to_gnum(double       s,
+           void        *elt,
+           const void  *input)
+{
+  const cs_gnum_t g_max = *(const cs_gnum_t *)input;
+
+  cs_gnum_t  *v = elt;
+  *v = (cs_gnum_t)(s * (double)g_max) + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief function pointer for comparison of 2 global numbers.
+ *
+ * This function is the same type as that used by qsort_r.
+ *
+ * \param[in]  elt1   first global number to compare
+ * \param[in]  elt2   second global number to compare
+ * \param[in]  input  pointer to optional (untyped) value or structure.
+ *
+ * \return < 0 if elt1 < elt2, 0 if elt1 == elt2, > 0 if elt1 > elt2
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_gnum_compare(const void  *elt1,
+              const void  *elt2,
+              const void  *input)
+{
+  CS_UNUSED(input);
+
+  int retval = 0;
+  if (  *(const cs_gnum_t *)elt1
+      < *(const cs_gnum_t *)elt2)
+    retval = -1;
+  else if (  *(const cs_gnum_t *)elt1
+           > *(const cs_gnum_t *)elt2)
+    retval = 1;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Use bubble sort on an expectedly short sequence of coordinates
  * to ensure lexicographical ordering.
@@ -840,18 +897,12 @@ _fvm_io_num_global_order_s(fvm_io_num_t       *this_io_num,
                            cs_gnum_t           global_num[],
                            MPI_Comm            comm)
 {
-  int  local_rank, size;
   cs_gnum_t current_gnum = 0, gnum_shift = 0;
 
   cs_gnum_t *r_gnum = NULL;
 
-  /* Initialization */
-
-  MPI_Comm_rank(comm, &local_rank);
-  MPI_Comm_size(comm, &size);
-
   /* Get maximum global number value for first value of each series
-     (does not need to be exact, simply used to define blocks) */
+     (does not need to be exact, simply used for sampling) */
 
   {
     cs_gnum_t   local_max = 0, global_max = 0;
@@ -863,23 +914,43 @@ _fvm_io_num_global_order_s(fvm_io_num_t       *this_io_num,
     this_io_num->global_count = global_max;
   }
 
-  /* block_info */
-
-  cs_block_dist_info_t
-    bi = cs_block_dist_compute_sizes(local_rank,
-                                     size,
-                                     1,
-                                     0,
-                                     this_io_num->global_count);
-
-  const cs_gnum_t block_size = bi.block_size;
+  /* Use a sample-based partitioning of the first adjacency value
+     rather than a uniform block distribution, as the distribution of
+     those values may be quite irregular (such as when numbering entities
+     adjacent to a subset of the mesh), which could lead to a strong
+     load imbalance at large process counts. Entities with equal
+     adjacency values have equal first values, so they are assigned
+     to the same rank, which the ordering below requires. */
 
   int *dest_rank;
   BFT_MALLOC(dest_rank, this_io_num->global_num_size, int);
 
-  for (cs_lnum_t i = 0; i < this_io_num->global_num_size; i++) {
-    cs_gnum_t g_elt_id = global_num[stride*i] - 1;
-    dest_rank[i] = (g_elt_id / block_size)*bi.rank_step;
+  {
+    cs_gnum_t *s_num = NULL;
+    cs_lnum_t *order = NULL;
+
+    BFT_MALLOC(s_num, this_io_num->global_num_size, cs_gnum_t);
+    BFT_MALLOC(order, this_io_num->global_num_size, cs_lnum_t);
+
+    for (cs_lnum_t i = 0; i < this_io_num->global_num_size; i++)
+      s_num[i] = global_num[stride*i];
+
+    cs_order_gnum_allocated(NULL, s_num, order, this_io_num->global_num_size);
+
+    cs_sort_partition_dest_rank_id(_sampling_factors[1],
+                                   sizeof(cs_gnum_t),
+                                   this_io_num->global_num_size,
+                                   s_num,
+                                   NULL, /* weight */
+                                   order,
+                                   dest_rank,
+                                   _s_to_gnum,
+                                   _gnum_compare,
+                                   &(this_io_num->global_count),
+                                   comm);
+
+    BFT_FREE(order);
+    BFT_FREE(s_num);
   }
 
   cs_all_to_all_t
@@ -1049,20 +1120,13 @@ _fvm_io_num_global_order_index(fvm_io_num_t       *this_io_num,
                                cs_gnum_t           global_num[],
                                MPI_Comm            comm)
 {
-  int  local_rank, size;
-
   cs_gnum_t   current_global_num = 0, global_num_shift = 0;
   cs_gnum_t   *block_global_num = NULL, *recv_global_num = NULL;
 
   size_t      n_ent = this_io_num->global_num_size;
 
-  /* Initialization */
-
-  MPI_Comm_rank(comm, &local_rank);
-  MPI_Comm_size(comm, &size);
-
   /* Get maximum global number value for first value of each series
-     (does not need to be exact, simply used to define blocks) */
+     (does not need to be exact, simply used for sampling) */
 
   {
     cs_gnum_t   local_max = 0, global_max = 0;
@@ -1073,24 +1137,42 @@ _fvm_io_num_global_order_index(fvm_io_num_t       *this_io_num,
     this_io_num->global_count = global_max;
   }
 
-  /* block_size = ceil(this_io_num->global_count/size) */
+  /* Use a sample-based partitioning of the first adjacency value
+     rather than a uniform block distribution (see the matching logic
+     in _fvm_io_num_global_order_s); identical series have identical
+     first values, so they are assigned to the same rank, which the
+     ordering below requires. */
 
-  cs_block_dist_info_t
-    bi = cs_block_dist_compute_sizes(local_rank,
-                                     size,
-                                     1,
-                                     0,
-                                     this_io_num->global_count);
+  int *dest_rank;
+  BFT_MALLOC(dest_rank, this_io_num->global_num_size, int);
 
-  cs_gnum_t _block_size = bi.block_size;
+  {
+    cs_gnum_t *s_num = NULL;
+    cs_lnum_t *order = NULL;
 
-  /* Build for each block, a new ordered indexed list from the received
-     elements */
+    BFT_MALLOC(s_num, this_io_num->global_num_size, cs_gnum_t);
+    BFT_MALLOC(order, this_io_num->global_num_size, cs_lnum_t);
 
-  int *dest_rank;
-  BFT_MALLOC(dest_rank, this_io_num->global_num_size, int);
-  for (size_t i = 0; i < n_ent; i++)
-    dest_rank[i] = ((global_num[index[i]] - 1) / _block_size) * bi.rank_step;
+    for (size_t i = 0; i < n_ent; i++)
+      s_num[i] = global_num[index[i]];
+
+    cs_order_gnum_allocated(NULL, s_num, order, n_ent);
+
+    cs_sort_partition_dest_rank_id(_sampling_factors[1],
+                                   sizeof(cs_gnum_t),
+                                   n_ent,
+                                   s_num,
+                                   NULL, /* weight */
+                                   order,
+                                   dest_rank,
+                                   _s_to_gnum,
+                                   _gnum_compare,
+                                   &(this_io_num->global_count),
+                                   comm);
+
+    BFT_FREE(order);
+    BFT_FREE(s_num);
+  }
 
   int flags = CS_ALL_TO_ALL_ORDER_BY_SRC_RANK;
 
@@ -92,6 +92,9 @@ typedef struct {
                                           for each operation */
   int   **group_class_set;             /* Array of group class lists
                                           for each operation */
+  unsigned int **group_class_flag;     /* Bitmap of group classes for each
+                                          operation (1 bit per group class),
+                                          for O(1) membership tests */
 } _operation_list_t;
 
 /*----------------------------------------------------------------------------
@@ -506,10 +509,12 @@ _operation_list_allocate(void)
 
   BFT_MALLOC(ops->n_group_classes, ops->n_max_operations, int);
   BFT_MALLOC(ops->group_class_set, ops->n_max_operations, int *);
+  BFT_MALLOC(ops->group_class_flag, ops->n_max_operations, unsigned int *);
 
   for (i = 0; i < ops->n_max_operations; i++) {
     ops->postfix[i] = NULL;
     ops->group_class_set[i] = NULL;
+    ops->group_class_flag[i] = NULL;
     ops->n_calls[i] = 0;
     ops->n_group_classes[i] = 0;
   }
@@ -546,10 +551,12 @@ _operation_list_reallocate(_operation_list_t  *ops)
 
   BFT_REALLOC(ops->n_group_classes, ops->n_max_operations, int);
   BFT_REALLOC(ops->group_class_set, ops->n_max_operations, int *);
+  BFT_REALLOC(ops->group_class_flag, ops->n_max_operations, unsigned int *);
 
   for (i = old_size; i < ops->n_max_operations; i++) {
     ops->postfix[i] = NULL;
     ops->group_class_set[i] = NULL;
+    ops->group_class_flag[i] = NULL;
     ops->n_calls[i] = 0;
     ops->n_group_classes[i] = 0;
   }
@@ -576,11 +583,14 @@ _operation_list_free(_operation_list_t  *ops)
     for (i = 0; i < ops->n_max_operations; i++) {
       if (ops->group_class_set[i] != NULL)
         BFT_FREE(ops->group_class_set[i]);
+      if (ops->group_class_flag[i] != NULL)
+        BFT_FREE(ops->group_class_flag[i]);
       if (ops->postfix[i] != NULL)
         fvm_selector_postfix_destroy(ops->postfix + i);
     }
     BFT_FREE(ops->postfix);
     BFT_FREE(ops->group_class_set);
+    BFT_FREE(ops->group_class_flag);
     BFT_FREE(ops);
   }
 
@@ -602,8 +612,10 @@ _create_operation_group_class_set(const fvm_selector_t  *this_selector,
 {
   int gc_id;
   int *group_class_set;
+  unsigned int *group_class_flag;
 
   int n_group_classes = 0;
+  int flag_size = (this_selector->n_group_classes + 31) / 32;
 
   const fvm_selector_postfix_t  *pf
     = operations->postfix[operations->n_operations -1];
@@ -615,6 +627,18 @@ _create_operation_group_class_set(const fvm_selector_t  *this_selector,
   group_class_set
     = operations->group_class_set[operations->n_operations - 1];
 
+  /* Also build a bitmap of matching group classes, for constant-time
+     membership tests */
+
+  BFT_MALLOC(operations->group_class_flag[operations->n_operations - 1],
+             flag_size,
+             unsigned int);
+
+  group_class_flag
+    = operations->group_class_flag[operations->n_operations - 1];
+
+  memset(group_class_flag, 0, flag_size*sizeof(unsigned int));
+
   for (gc_id = 0; gc_id < this_selector->n_group_classes; gc_id++) {
 
     /* update group class list for current operation */
@@ -625,8 +649,10 @@ _create_operation_group_class_set(const fvm_selector_t  *this_selector,
                                   this_selector->group_ids[gc_id],
                                   this_selector->attribute_ids[gc_id],
                                   NULL,
-                                  NULL))
+                                  NULL)) {
       group_class_set[n_group_classes++] = gc_id;
+      group_class_flag[gc_id / 32] |= (1u << (gc_id % 32));
+    }
   }
 
   operations->n_group_classes[operations->n_operations-1] = n_group_classes;
@@ -962,8 +988,29 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
         = ts->_operations->n_group_classes[c_id];
       const int *_criteria_group_class_set
         = ts->_operations->group_class_set[c_id];
+      const unsigned int *_criteria_group_class_flag
+        = ts->_operations->group_class_flag[c_id];
 
-      if (ts->_n_group_class_elements != NULL) {
+      /* For criteria matching many group classes, a single pass over
+         elements with a constant-time bitmap test per element is both
+         cache-friendlier than concatenating many per-class element
+         lists and produces an ordered selection */
+
+      if (   n_criteria_group_classes > 32
+          && ts->group_class_id != NULL
+          && _criteria_group_class_flag != NULL) {
+
+        const int gc_id_base = ts->group_class_id_base;
+
+        for (i = 0; i < ts->n_elements; i++) {
+          int _gc_id = ts->group_class_id[i] - gc_id_base;
+          if (_criteria_group_class_flag[_gc_id / 32] & (1u << (_gc_id % 32)))
+            selected_elements[(*n_selected_elements)++] = i + elt_id_base;
+        }
+
+      }
+
+      else if (ts->_n_group_class_elements != NULL) {
 
         for (gc_id = 0; gc_id < n_criteria_group_classes; gc_id++) {
           for (i = 0;
@@ -1014,22 +1061,34 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
                     "for 3 spatial dimension."),
                   str, dim);
 
-    /* Loop on all elements */
+    /* Loop on all elements; expression evaluation only reads the
+       postfix structure, so elements may be tested in parallel, with
+       a flag array keeping the selection order deterministic */
+
+    char *selected_flag = NULL;
+    BFT_MALLOC(selected_flag, ts->n_elements, char);
 
+#   pragma omp parallel for if (ts->n_elements > CS_THR_MIN)
     for (i = 0; i < ts->n_elements; i++) {
 
-      gc_id = ts->group_class_id[i] - ts->group_class_id_base;
+      int _gc_id = ts->group_class_id[i] - ts->group_class_id_base;
 
-      if (fvm_selector_postfix_eval(pf,
-                                    ts->n_class_groups[gc_id],
-                                    ts->n_class_attributes[gc_id],
-                                    ts->group_ids[gc_id],
-                                    ts->attribute_ids[gc_id],
-                                    ts->coords + (i*dim),
-                                    ts->normals + (i*dim)))
-        selected_elements[(*n_selected_elements)++] = i + elt_id_base;
+      selected_flag[i] = fvm_selector_postfix_eval(pf,
+                                                   ts->n_class_groups[_gc_id],
+                                                   ts->n_class_attributes[_gc_id],
+                                                   ts->group_ids[_gc_id],
+                                                   ts->attribute_ids[_gc_id],
+                                                   ts->coords + (i*dim),
+                                                   ts->normals + (i*dim));
 
     }
+
+    for (i = 0; i < ts->n_elements; i++) {
+      if (selected_flag[i])
+        selected_elements[(*n_selected_elements)++] = i + elt_id_base;
+    }
+
+    BFT_FREE(selected_flag);
   }
 
   ts->n_evals += 1;
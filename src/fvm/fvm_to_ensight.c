@@ -87,6 +87,8 @@ typedef struct {
   bool         text_mode;          /* true if using text output */
   bool         swap_endian;        /* true if binary file endianness must
                                       be changed */
+  bool         compress_output;    /* true if binary files should be
+                                      gzip-compressed (adding .gz suffix) */
 
   bool         discard_polygons;   /* Option to discard polygonal elements */
   bool         discard_polyhedra;  /* Option to discard polyhedral elements */
@@ -203,6 +205,13 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     if (this_writer->swap_endian == true)
       cs_file_set_swap_endian(f.bf, 1);
+
+    /* When requested and possible (serial rank 0 standard IO with zlib),
+       switch to gzip-compressed output; otherwise, output simply remains
+       uncompressed. */
+
+    if (this_writer->compress_output == true && append == false)
+      cs_file_set_gzip(f.bf, -1);
   }
 
   return f;
@@ -2525,6 +2534,12 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   text                output text files
  *   binary              output binary files (default)
  *   big_endian          force binary files to big-endian
+ *   gz                  gzip-compress binary geometry and variable files
+ *                       (adding a .gz suffix); files must be decompressed
+ *                       before they can be read by EnSight or ParaView,
+ *                       as the format itself has no compressed variant;
+ *                       requires zlib and serial (rank 0) standard IO,
+ *                       and is ignored otherwise
  *   discard_polygons    do not output polygons or related values
  *   discard_polyhedra   do not output polyhedra or related values
  *   divide_polygons     tesselate polygons with triangles
@@ -2567,6 +2582,7 @@ fvm_to_ensight_init_writer(const char             *name,
 
   this_writer->text_mode = false;
   this_writer->swap_endian = false;
+  this_writer->compress_output = false;
   this_writer->discard_polygons = false;
   this_writer->discard_polyhedra = false;
   this_writer->divide_polygons = false;
@@ -2620,6 +2636,9 @@ fvm_to_ensight_init_writer(const char             *name,
       else if ((l_opt == 6) && (strncmp(options + i1, "binary", l_opt) == 0))
         this_writer->text_mode = false;
 
+      else if ((l_opt == 2) && (strncmp(options + i1, "gz", l_opt) == 0))
+        this_writer->compress_output = true;
+
       else if (   (l_opt == 10)
                && (strncmp(options + i1, "big_endian", l_opt) == 0)) {
         int int_endian = 0;
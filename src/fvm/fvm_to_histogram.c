@@ -103,10 +103,127 @@ static void * _catalyst_plugin = NULL;
 
 static fvm_to_histogram_display_t  *_fvm_to_vtk_display_histogram_png = NULL;
 
+/* Registered writers, for forced flush of buffered output */
+
+static int                          _n_writers = 0;
+static fvm_to_histogram_writer_t  **_writers = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Ensure a pending output buffer is large enough for upcoming data.
+ *
+ * The buffer is reallocated if necessary.
+ *
+ * parameters:
+ *   p        <-> pending histogram output
+ *   min_size <-- minimum buffer size
+ *----------------------------------------------------------------------------*/
+
+static void
+_ensure_buffer_size(fvm_to_histogram_pending_t  *p,
+                    size_t                       min_size)
+{
+  if (p->buffer_size < min_size) {
+    while (p->buffer_size < min_size)
+      p->buffer_size *= 2;
+    BFT_REALLOC(p->buffer, p->buffer_size, char);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add a pending output record for a writer's current file name.
+ *
+ * The file contents are formatted in memory, and written to disk in
+ * batches (see fvm_to_histogram_flush).
+ *
+ * parameters:
+ *   w <-> histogram writer
+ *
+ * returns:
+ *   pointer to new pending histogram output
+ *----------------------------------------------------------------------------*/
+
+static fvm_to_histogram_pending_t *
+_pending_append(fvm_to_histogram_writer_t  *w)
+{
+  fvm_to_histogram_pending_t  *p = NULL;
+
+  BFT_MALLOC(p, 1, fvm_to_histogram_pending_t);
+
+  BFT_MALLOC(p->file_name, strlen(w->file_name) + 1, char);
+  strcpy(p->file_name, w->file_name);
+
+  p->buffer_size = 1024;
+  p->buffer_end = 0;
+  BFT_MALLOC(p->buffer, p->buffer_size, char);
+
+  p->next = NULL;
+
+  if (w->pending == NULL)
+    w->pending = p;
+  else {
+    fvm_to_histogram_pending_t  *q = w->pending;
+    while (q->next != NULL)
+      q = q->next;
+    q->next = p;
+  }
+
+  /* Count buffered output instants */
+
+  if (w->nt != w->buf_nt) {
+    w->buf_nt = w->nt;
+    w->n_buf_instants += 1;
+  }
+
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Write buffered histogram files and empty a writer's pending output list.
+ *
+ * parameters:
+ *   w <-> histogram writer
+ *----------------------------------------------------------------------------*/
+
+static void
+_pending_write(fvm_to_histogram_writer_t  *w)
+{
+  fvm_to_histogram_pending_t  *p = w->pending;
+
+  while (p != NULL) {
+
+    fvm_to_histogram_pending_t  *p_next = p->next;
+
+    FILE *f = fopen(p->file_name, "w");
+
+    if (f == NULL)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), p->file_name);
+
+    else {
+      if (fwrite(p->buffer, 1, p->buffer_end, f) < p->buffer_end)
+        bft_error(__FILE__, __LINE__, ferror(f),
+                  _("Error writing file: \"%s\""), p->file_name);
+      if (fclose(f) != 0)
+        bft_error(__FILE__, __LINE__, errno,
+                  _("Error closing file: \"%s\""), p->file_name);
+    }
+
+    BFT_FREE(p->buffer);
+    BFT_FREE(p->file_name);
+    BFT_FREE(p);
+
+    p = p_next;
+  }
+
+  w->pending = NULL;
+  w->n_buf_instants = 0;
+  w->buf_nt = -2;
+}
+
 #if defined(HAVE_PLUGIN_CATALYST)
 
 /*----------------------------------------------------------------------------
@@ -158,29 +275,36 @@ _display_histogram_txt(cs_real_t                   var_min,
   double var_step;
   int i, j;
 
-  /* Open the txt file */
-  w->f = fopen(w->file_name, "w");
+  /* Format file contents in memory; actual writes are done in batches
+     (see fvm_to_histogram_flush). */
 
-  if (w->f ==  NULL) {
-    bft_error(__FILE__, __LINE__, errno,
-              _("Error opening file: \"%s\""), w->file_name);
-    return;
-  }
+  fvm_to_histogram_pending_t *p = _pending_append(w);
+
+  _ensure_buffer_size(p, p->buffer_end + 256 + strlen(var_name));
 
   /* Print header */
-  fprintf(w->f, "# Code_Saturne histograms\n#\n");
+  p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                           "# Code_Saturne histograms\n#\n");
   if (w->nt < 0)
-    fprintf(w->f, "# time independent\n");
+    p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                             "# time independent\n");
   else {
-    fprintf(w->f, "# time step id: %i\n", w->nt);
-    fprintf(w->f, "# time:         %12.5e\n#\n", w->t);
+    p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                             "# time step id: %i\n", w->nt);
+    p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                             "# time:         %12.5e\n#\n", w->t);
   }
 
   /* Print base min, max, and increment */
-  fprintf(w->f, "# Variable : %s\n\n",var_name);
+  p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                           "# Variable : %s\n\n", var_name);
 
-  fprintf(w->f, _("    minimum value =         %10.5e\n"), (double)var_min);
-  fprintf(w->f, _("    maximum value =         %10.5e\n\n"), (double)var_max);
+  p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                           _("    minimum value =         %10.5e\n"),
+                           (double)var_min);
+  p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                           _("    maximum value =         %10.5e\n\n"),
+                           (double)var_max);
 
   var_step = CS_ABS(var_max - var_min) / w->n_sub;
 
@@ -188,16 +312,21 @@ _display_histogram_txt(cs_real_t                   var_min,
 
     /* Number of elements in each subdivision */
 
-    for (i = 0, j = 1; i < w->n_sub - 1; i++, j++)
-      fprintf(w->f, "    %3d : [ %10.5e ; %10.5e [ = %10llu\n",
-                 i+1, var_min + i*var_step, var_min + j*var_step,
-                 (unsigned long long)(count[i]));
+    for (i = 0, j = 1; i < w->n_sub - 1; i++, j++) {
+      _ensure_buffer_size(p, p->buffer_end + 80);
+      p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                               "    %3d : [ %10.5e ; %10.5e [ = %10llu\n",
+                               i+1, var_min + i*var_step, var_min + j*var_step,
+                               (unsigned long long)(count[i]));
+    }
 
-    fprintf(w->f, "    %3d : [ %10.5e ; %10.5e ] = %10llu\n",
-               w->n_sub,
-               var_min + (w->n_sub - 1)*var_step,
-               var_max,
-               (unsigned long long)(count[w->n_sub - 1]));
+    _ensure_buffer_size(p, p->buffer_end + 80);
+    p->buffer_end += sprintf(p->buffer + p->buffer_end,
+                             "    %3d : [ %10.5e ; %10.5e ] = %10llu\n",
+                             w->n_sub,
+                             var_min + (w->n_sub - 1)*var_step,
+                             var_max,
+                             (unsigned long long)(count[w->n_sub - 1]));
 
   }
 }
@@ -226,48 +355,71 @@ _display_histogram_tex(cs_real_t                   var_min,
   int i;
 
   if (var_step > 0) {
-    /* Open the tex file if non-zero histogram */
-    w->f = fopen(w->file_name, "w");
 
-    if (w->f ==  NULL) {
-      bft_error(__FILE__, __LINE__, errno,
-                _("Error opening file: \"%s\""), w->file_name);
-      return;
+    /* Format file contents in memory if non-zero histogram; actual
+       writes are done in batches (see fvm_to_histogram_flush). */
+
+    fvm_to_histogram_pending_t *p = _pending_append(w);
+
+    char *b;
+
+    _ensure_buffer_size(p, p->buffer_end + 384 + strlen(var_name));
+    b = p->buffer;
+
+    p->buffer_end += sprintf(b + p->buffer_end, "\\begin{center}\n");
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "\\begin{tikzpicture}[font=\\footnotesize]\n");
+
+    p->buffer_end += sprintf(b + p->buffer_end, "  \\begin{axis}[\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    ybar,\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    bar width=18pt,\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    xlabel={%s},\n",var_name);
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "    ylabel={Number of elements},\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    ymin=0,\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    ytick=\\empty,\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    xtick=data,\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    axis x line=bottom,\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "    axis y line=left,\n");
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "    enlarge x limits=0.06,\n");
+
+    p->buffer_end += sprintf(b + p->buffer_end, "    symbolic x coords={");
+    for (i = 0 ; i < w->n_sub-1 ; i++) {
+      _ensure_buffer_size(p, p->buffer_end + 80);
+      b = p->buffer;
+      p->buffer_end += sprintf(b + p->buffer_end,
+                               "%.3e,",var_min + (i+0.5)*var_step);
+    }
+    _ensure_buffer_size(p, p->buffer_end + 256);
+    b = p->buffer;
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "%.3e},\n",var_min + (w->n_sub-0.5)*var_step);
+
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "    xticklabel style="
+                             "{rotate=45,font=\\scriptsize},\n");
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "    nodes near coords="
+                             "{\\pgfmathprintnumber\\pgfplotspointmeta}\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "  ]\n");
+    p->buffer_end += sprintf(b + p->buffer_end,
+                             "    \\addplot[fill=blue] coordinates {\n");
+    for (i = 0 ; i < w->n_sub ; i++) {
+      _ensure_buffer_size(p, p->buffer_end + 80);
+      b = p->buffer;
+      p->buffer_end += sprintf(b + p->buffer_end,
+                               "        (%.3e,%llu)\n",
+                               var_min + (i+0.5)*var_step,
+                               (unsigned long long)count[i]);
     }
+    _ensure_buffer_size(p, p->buffer_end + 80);
+    b = p->buffer;
+    p->buffer_end += sprintf(b + p->buffer_end, "    };\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "  \\end{axis}\n");
 
-    fprintf(w->f, "\\begin{center}\n");
-    fprintf(w->f, "\\begin{tikzpicture}[font=\\footnotesize]\n");
-
-    fprintf(w->f, "  \\begin{axis}[\n");
-    fprintf(w->f, "    ybar,\n");
-    fprintf(w->f, "    bar width=18pt,\n");
-    fprintf(w->f, "    xlabel={%s},\n",var_name);
-    fprintf(w->f, "    ylabel={Number of elements},\n");
-    fprintf(w->f, "    ymin=0,\n");
-    fprintf(w->f, "    ytick=\\empty,\n");
-    fprintf(w->f, "    xtick=data,\n");
-    fprintf(w->f, "    axis x line=bottom,\n");
-    fprintf(w->f, "    axis y line=left,\n");
-    fprintf(w->f, "    enlarge x limits=0.06,\n");
-
-    fprintf(w->f, "    symbolic x coords={");
-    for (i = 0 ; i < w->n_sub-1 ; i++)
-      fprintf(w->f, "%.3e,",var_min + (i+0.5)*var_step);
-    fprintf(w->f, "%.3e},\n",var_min + (w->n_sub-0.5)*var_step);
-
-    fprintf(w->f, "    xticklabel style={rotate=45,font=\\scriptsize},\n");
-    fprintf(w->f,
-            "    nodes near coords={\\pgfmathprintnumber\\pgfplotspointmeta}\n");
-    fprintf(w->f, "  ]\n");
-    fprintf(w->f, "    \\addplot[fill=blue] coordinates {\n");
-    for (i = 0 ; i < w->n_sub ; i++)
-      fprintf(w->f, "        (%.3e,%llu)\n",
-              var_min + (i+0.5)*var_step, (unsigned long long)count[i]);
-    fprintf(w->f, "    };\n");
-    fprintf(w->f, "  \\end{axis}\n");
-
-    fprintf(w->f, "\\end{tikzpicture}\n");
-    fprintf(w->f, "\\end{center}\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "\\end{tikzpicture}\n");
+    p->buffer_end += sprintf(b + p->buffer_end, "\\end{center}\n");
   }
 }
 
@@ -523,6 +675,7 @@ _field_output(void           *context,
  *   tex                 output TeX (TixZ) files
  *   png                 output PNG files
  *   [n_sub]             number of subdivisions
+ *   n_buf_steps=<n>     write output to file every 'n' output steps
  *
  * parameters:
  *   name           <-- base output case name.
@@ -594,6 +747,11 @@ fvm_to_histogram_init_writer(const char             *name,
 
   w->n_sub = 5; /* default */
 
+  w->n_buf_steps = 1;
+  w->n_buf_instants = 0;
+  w->buf_nt = -2;
+  w->pending = NULL;
+
   /* Parse options */
 
   if (options != NULL) {
@@ -627,6 +785,13 @@ fvm_to_histogram_init_writer(const char             *name,
 #endif
       }
 #endif
+      else if (strncmp(options + i1, "n_buf_steps=", 12) == 0) {
+        const char *s = options + i1 + 12;
+        int nb, nr;
+        nr = sscanf(s, "%d", &nb);
+        if (nr == 1 && nb > 0)
+          w->n_buf_steps = nb;
+      }
       else {
         const char *n_sub_opt = options+i1;
         while (*n_sub_opt != '\0' && !isdigit(*n_sub_opt))
@@ -643,6 +808,12 @@ fvm_to_histogram_init_writer(const char             *name,
 
   }
 
+  /* Register writer, for forced flush of buffered output */
+
+  _n_writers += 1;
+  BFT_REALLOC(_writers, _n_writers, fvm_to_histogram_writer_t *);
+  _writers[_n_writers - 1] = w;
+
   /* Return writer */
 
   return w;
@@ -664,10 +835,24 @@ fvm_to_histogram_finalize_writer(void  *writer)
   fvm_to_histogram_writer_t  *w
     = (fvm_to_histogram_writer_t *)writer;
 
+  /* Unregister writer */
+
+  for (int i = 0; i < _n_writers; i++) {
+    if (_writers[i] == w) {
+      for (int j = i; j < _n_writers - 1; j++)
+        _writers[j] = _writers[j+1];
+      _n_writers -= 1;
+      break;
+    }
+  }
+  if (_n_writers == 0)
+    BFT_FREE(_writers);
+
   BFT_FREE(w->name);
   BFT_FREE(w->path);
 
   fvm_to_histogram_flush(writer);
+  _pending_write(w);
 
   BFT_FREE(w->file_name);
 
@@ -779,9 +964,13 @@ fvm_to_histogram_export_field(void                  *writer,
 
 #if defined(HAVE_MPI)
 
+  /* Use a distributed block distribution (minimum rank step 1) rather
+     than gathering the whole field on rank 0: each rank bins its own
+     block, and only the bin counts are reduced for display. */
+
   if (w->n_ranks > 1)
     fvm_writer_field_helper_init_g(helper,
-                                   w->n_ranks,
+                                   1,
                                    0,
                                    w->comm);
 
@@ -811,6 +1000,9 @@ fvm_to_histogram_export_field(void                  *writer,
 /*----------------------------------------------------------------------------
  * Flush files associated with a given writer.
  *
+ * Output buffered in memory is only written to disk once the configured
+ * number of output instants has been accumulated (n_buf_steps option).
+ *
  * parameters:
  *   writer <-- pointer to associated writer
  *----------------------------------------------------------------------------*/
@@ -831,6 +1023,23 @@ fvm_to_histogram_flush(void  *writer)
   }
 
   BFT_FREE(w->buffer);
+
+  if (w->pending != NULL && w->n_buf_instants >= w->n_buf_steps)
+    _pending_write(w);
+}
+
+/*----------------------------------------------------------------------------
+ * Force write of buffered output for all histogram writers.
+ *
+ * This is intended for use in case of emergency output (i.e. when
+ * intercepting a fatal signal), so as to minimize data loss.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_histogram_flush_all(void)
+{
+  for (int i = 0; i < _n_writers; i++)
+    _pending_write(_writers[i]);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -58,6 +58,22 @@ typedef enum {
   CS_HISTOGRAM_PNG   /* .png file */
 } cs_histogram_format_t;
 
+/*----------------------------------------------------------------------------
+ * Histogram output buffered in memory (not yet written to file)
+ *----------------------------------------------------------------------------*/
+
+typedef struct _fvm_to_histogram_pending_t {
+
+  char    *file_name;       /* Associated file name */
+
+  char    *buffer;          /* Formatted file contents */
+  size_t   buffer_size;     /* Allocated buffer size */
+  size_t   buffer_end;      /* Used buffer size */
+
+  struct _fvm_to_histogram_pending_t  *next;  /* Next in list */
+
+} fvm_to_histogram_pending_t;
+
 /*----------------------------------------------------------------------------
  * Histogram writer structure
  *----------------------------------------------------------------------------*/
@@ -82,6 +98,14 @@ typedef struct {
 
   int               n_sub;         /* Number of subdivisions */
 
+  int               n_buf_steps;   /* Number of output instants to
+                                      accumulate in memory before files
+                                      are written (batched output) */
+  int               n_buf_instants;/* Current number of buffered instants */
+  int               buf_nt;        /* Time step of last buffered output */
+
+  fvm_to_histogram_pending_t  *pending;  /* Buffered output list, or NULL */
+
 #if defined(HAVE_MPI)
   MPI_Comm     comm;               /* Associated MPI communicator */
 #endif
@@ -119,6 +143,7 @@ typedef void
  *   tex                 output TeX (TixZ) files
  *   png                 output PNG files
  *   [n_sub]             number of subdivisions
+ *   n_buf_steps=<n>     write output to file every 'n' output steps
  *
  * parameters:
  *   name           <-- base output case name.
@@ -227,6 +252,16 @@ fvm_to_histogram_export_field(void                  *writer,
 void
 fvm_to_histogram_flush(void  *writer);
 
+/*----------------------------------------------------------------------------
+ * Force write of buffered output for all histogram writers.
+ *
+ * This is intended for use in case of emergency output (i.e. when
+ * intercepting a fatal signal), so as to minimize data loss.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_histogram_flush_all(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
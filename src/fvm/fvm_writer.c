@@ -139,7 +139,8 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     "3.0 +",
     (  FVM_WRITER_FORMAT_USE_EXTERNAL
      | FVM_WRITER_FORMAT_HAS_POLYGON
-     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON
+     | FVM_WRITER_FORMAT_SPARSE_FIELDS),
     FVM_WRITER_FIXED_MESH,
     0,                                 /* dynamic library count */
     NULL,                              /* dynamic library */
@@ -324,7 +325,8 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     (  FVM_WRITER_FORMAT_HAS_POLYGON
      | FVM_WRITER_FORMAT_HAS_POLYHEDRON
      | FVM_WRITER_FORMAT_SEPARATE_MESHES
-     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL),
+     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL
+     | FVM_WRITER_FORMAT_SPARSE_FIELDS),
        FVM_WRITER_TRANSIENT_CONNECT,
     0,                                 /* dynamic library count */
     NULL,                              /* dynamic library */
@@ -348,7 +350,8 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     (  FVM_WRITER_FORMAT_HAS_POLYGON
      | FVM_WRITER_FORMAT_HAS_POLYHEDRON
      | FVM_WRITER_FORMAT_SEPARATE_MESHES
-     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL),
+     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL
+     | FVM_WRITER_FORMAT_SPARSE_FIELDS),
     FVM_WRITER_TRANSIENT_CONNECT,
     0,                                 /* dynamic library count */
     NULL,                              /* dynamic library */
@@ -372,7 +375,8 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     (  FVM_WRITER_FORMAT_HAS_POLYGON
      | FVM_WRITER_FORMAT_HAS_POLYHEDRON
      | FVM_WRITER_FORMAT_SEPARATE_MESHES
-     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL),
+     | FVM_WRITER_FORMAT_NAME_IS_OPTIONAL
+     | FVM_WRITER_FORMAT_SPARSE_FIELDS),
     FVM_WRITER_FIXED_MESH,
     0,                                 /* dynamic library count */
     NULL,                              /* dynamic library */
@@ -1060,6 +1064,8 @@ fvm_writer_filter_option(char        *format_options,
  *   text                output text files
  *   binary              output binary files (default)
  *   big_endian          force binary files to big-endian
+ *   gz                  gzip-compress binary output files when possible
+ *                       (EnSight; requires decompression before reading)
  *   discard_polygons    do not output polygons or related values
  *   discard_polyhedra   do not output polyhedra or related values
  *   divide_polygons     tesselate polygons with triangles
@@ -1353,6 +1359,29 @@ fvm_writer_get_time_dep(const fvm_writer_t  *this_writer)
   return this_writer->time_dep;
 }
 
+/*----------------------------------------------------------------------------
+ * Query if readers of a writer's format accept fields present at only
+ * a subset of the output time steps.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   1 if fields may be skipped at some time steps, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_writer_supports_sparse_fields(const fvm_writer_t  *this_writer)
+{
+  assert(this_writer != NULL);
+  assert(this_writer->format != NULL);
+
+  if (this_writer->format->info_mask & FVM_WRITER_FORMAT_SPARSE_FIELDS)
+    return 1;
+  else
+    return 0;
+}
+
 /*----------------------------------------------------------------------------
  * Associate new time step with a mesh.
  *
@@ -318,6 +318,20 @@ fvm_writer_get_path(const fvm_writer_t  *this_writer);
 fvm_writer_time_dep_t
 fvm_writer_get_time_dep(const fvm_writer_t  *this_writer);
 
+/*----------------------------------------------------------------------------
+ * Query if readers of a writer's format accept fields present at only
+ * a subset of the output time steps.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   1 if fields may be skipped at some time steps, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_writer_supports_sparse_fields(const fvm_writer_t  *this_writer);
+
 /*----------------------------------------------------------------------------
  * Associate new time step with a mesh.
  *
@@ -60,6 +60,11 @@ BEGIN_C_DECLS
 
 #define FVM_WRITER_FORMAT_NAME_IS_OPTIONAL  (1 << 4)
 
+/* Readers of the format accept fields present at only a subset
+   of the output time steps */
+
+#define FVM_WRITER_FORMAT_SPARSE_FIELDS     (1 << 5)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -210,6 +210,33 @@ _thermal_table_choice(const char *name)
   return choice;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the tree node associated to a given fluid property.
+ *
+ * The head of the property node list is cached, as this query appears
+ * in the time loop (through physical property updates), where parsing
+ * the same path string at each call would be wasted work; the tree is
+ * not modified once the setup is read.
+ *
+ * parameters:
+ *   property_name        <--  name of the property
+ *----------------------------------------------------------------------------*/
+
+static cs_tree_node_t *
+_get_property_node(const char *property_name)
+{
+  static cs_tree_node_t *_root = NULL;
+  static cs_tree_node_t *_props = NULL;
+
+  if (_root != cs_glob_tree) {
+    _props = cs_tree_get_node(cs_glob_tree,
+                              "physical_properties/fluid_properties/property");
+    _root = cs_glob_tree;
+  }
+
+  return cs_tree_node_get_sibling_with_tag(_props, "name", property_name);
+}
+
 /*----------------------------------------------------------------------------
  * Return the value of the choice attribute from a property name.
  *
@@ -220,15 +247,9 @@ _thermal_table_choice(const char *name)
 static const char*
 _properties_choice(const char *property_name)
 {
-  const char *choice = NULL;
-  cs_tree_node_t *tn
-    = cs_tree_get_node(cs_glob_tree,
-                       "physical_properties/fluid_properties/property");
-  tn = cs_tree_node_get_sibling_with_tag(tn, "name", property_name);
+  cs_tree_node_t *tn = _get_property_node(property_name);
 
-  choice = cs_tree_node_get_child_value_str(tn, "choice");
-
-  return choice;
+  return cs_tree_node_get_child_value_str(tn, "choice");
 }
 
 /*----------------------------------------------------------------------------
@@ -262,22 +283,30 @@ _physical_property(cs_field_t          *c_prop,
   const char *law = NULL;
   const char *prop_choice = _properties_choice(c_prop->name);
 
+  /* Optional reduced update frequency: when a property declares an
+     update interval larger than 1, its law is only re-evaluated at
+     matching time steps (but always at the first step of a run, so
+     values are defined after initialization or restart). */
+
+  {
+    const cs_time_step_t *ts = cs_glob_time_step;
+    int upd_interval
+      = cs_field_get_key_int(c_prop,
+                             cs_field_key_id("property_update_interval"));
+    if (    upd_interval > 1
+        &&  ts->nt_cur > ts->nt_prev + 1
+        && (ts->nt_cur % upd_interval) != 0)
+      return;
+  }
+
   if (cs_gui_strcmp(prop_choice, "user_law"))
     user_law = 1;
 
   if (user_law) {
 
     /* search the formula for the law */
-    cs_tree_node_t *tn = cs_tree_find_node(cs_glob_tree, "property");
-    while (tn != NULL) {
-      const char *name = cs_tree_node_get_child_value_str(tn, "name");
-      if (cs_gui_strcmp(name, c_prop->name))
-        break;
-      else
-        tn = cs_tree_find_node_next(cs_glob_tree, tn, "property");
-    }
-    tn = cs_tree_get_node(tn, "formula");
-    law = cs_tree_node_get_value_str(tn);
+    cs_tree_node_t *tn = _get_property_node(c_prop->name);
+    law = cs_tree_node_get_child_value_str(tn, "formula");
 
     if (law != NULL)
       cs_meg_volume_function(c_prop, z);
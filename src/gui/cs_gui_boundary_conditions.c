@@ -30,6 +30,7 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
@@ -164,6 +165,10 @@ typedef struct {
   bool          *direction_e; /* formula for direction of velocity */
   bool        **scalar_e;     /* formula for scalar (neumann, dirichlet or
                                  exchange coefficient) */
+  bool        **scalar_e_steady;  /* true if the scalar formula does not
+                                     depend on time */
+  cs_real_t  ***scalar_e_vals;    /* cached values of time-independent
+                                     scalar formulas */
   bool         *head_loss_e;  /* formula for head loss (free inlet/outlet) */
   bool         *groundwat_e;  /* formula for hydraulic head (groundwater) */
 
@@ -390,6 +395,76 @@ _inlet_turbulence(cs_tree_node_t  *tn_bc,
   }
 }
 
+/*-----------------------------------------------------------------------------
+ * Check if a formula expression is steady (i.e. does not depend on time).
+ *
+ * The expression is considered steady if all identifiers appearing in it
+ * belong to a whitelist of time-independent symbols: face coordinates,
+ * mathematical constants, and mathematical functions of the expression
+ * language. Identifiers appearing as assignment targets (followed by
+ * "=") are also accepted. Any other identifier (time, time step,
+ * iteration number, notebook variable, or field name) makes the
+ * expression unsteady, so the check errs on the safe side.
+ *
+ * parameters:
+ *   expr <-- formula expression string
+ *
+ * return:
+ *   true if the expression cannot depend on time, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_steady_formula(const char  *expr)
+{
+  static const char *steady_ids[] = {
+    "x", "y", "z", "pi", "e",
+    "abs", "min", "max", "mod", "sqrt", "exp", "log", "log10",
+    "cos", "sin", "tan", "acos", "asin", "atan", "atan2",
+    "cosh", "sinh", "tanh"};
+
+  const int n_steady_ids = sizeof(steady_ids) / sizeof(steady_ids[0]);
+
+  if (expr == NULL)
+    return false;
+
+  const char *s = expr;
+
+  while (*s != '\0') {
+
+    if (isalpha(*s) || *s == '_') {
+
+      const char *w = s;
+      while (isalnum(*s) || *s == '_')
+        s++;
+      size_t l = s - w;
+
+      /* assignment target ? */
+
+      const char *n = s;
+      while (*n == ' ' || *n == '\t')
+        n++;
+      if (*n == '=' && *(n+1) != '=')
+        continue;
+
+      bool known = false;
+      for (int i = 0; i < n_steady_ids; i++) {
+        if (strlen(steady_ids[i]) == l && strncmp(steady_ids[i], w, l) == 0) {
+          known = true;
+          break;
+        }
+      }
+      if (! known)
+        return false;
+
+    }
+    else
+      s++;
+
+  }
+
+  return true;
+}
+
 /*-----------------------------------------------------------------------------
  * get scalar's values
  *
@@ -448,6 +523,8 @@ _boundary_scalar(cs_tree_node_t  *tn_bc,
         if (s != NULL) {
           boundaries->type_code[f_id][izone] = DIRICHLET_FORMULA;
           boundaries->scalar_e[f_id][izone * dim + i] = true;
+          boundaries->scalar_e_steady[f_id][izone * dim + i]
+            = _steady_formula(s);
         }
 
       }
@@ -457,6 +534,8 @@ _boundary_scalar(cs_tree_node_t  *tn_bc,
         if (s != NULL) {
           boundaries->type_code[f_id][izone] = NEUMANN_FORMULA;
           boundaries->scalar_e[f_id][izone * dim + i] = true;
+          boundaries->scalar_e_steady[f_id][izone * dim + i]
+            = _steady_formula(s);
         }
       }
       else if (! strcmp(choice, "exchange_coefficient_formula")) {
@@ -465,6 +544,8 @@ _boundary_scalar(cs_tree_node_t  *tn_bc,
         if (s != NULL) {
           boundaries->type_code[f_id][izone] = EXCHANGE_COEFF_FORMULA;
           boundaries->scalar_e[f_id][izone * dim + i] = true;
+          boundaries->scalar_e_steady[f_id][izone * dim + i]
+            = _steady_formula(s);
         }
       }
       else if (! strcmp(choice, "exchange_coefficient")) {
@@ -841,6 +922,8 @@ _init_boundaries(const cs_lnum_t   n_b_faces,
   BFT_MALLOC(boundaries->velocity_e,  n_zones,  bool);
   BFT_MALLOC(boundaries->direction_e, n_zones,  bool);
   BFT_MALLOC(boundaries->scalar_e,    n_fields,   bool *);
+  BFT_MALLOC(boundaries->scalar_e_steady, n_fields, bool *);
+  BFT_MALLOC(boundaries->scalar_e_vals,   n_fields, cs_real_t **);
   BFT_MALLOC(boundaries->head_loss_e, n_zones,  bool);
   BFT_MALLOC(boundaries->preout,    n_zones,    double);
 
@@ -909,6 +992,8 @@ _init_boundaries(const cs_lnum_t   n_b_faces,
       BFT_MALLOC(boundaries->type_code[f->id], n_zones, int);
       BFT_MALLOC(boundaries->values[f->id], n_zones * f->dim, cs_val_t);
       BFT_MALLOC(boundaries->scalar_e[f->id], n_zones * f->dim, bool);
+      BFT_MALLOC(boundaries->scalar_e_steady[f->id], n_zones * f->dim, bool);
+      BFT_MALLOC(boundaries->scalar_e_vals[f->id], n_zones, cs_real_t *);
     }
   }
 
@@ -977,11 +1062,13 @@ _init_boundaries(const cs_lnum_t   n_b_faces,
       int i = f->id;
       for (int izone = 0; izone < n_zones; izone++) {
         boundaries->type_code[i][izone] = -1;
+        boundaries->scalar_e_vals[i][izone] = NULL;
         for (int ii = 0; ii < f->dim; ii++) {
           boundaries->values[i][izone * f->dim + ii].val1 = 1.e30;
           boundaries->values[i][izone * f->dim + ii].val2 = 1.e30;
           boundaries->values[i][izone * f->dim + ii].val3 = 0.;
           boundaries->scalar_e[i][izone * f->dim + ii] = false;
+          boundaries->scalar_e_steady[i][izone * f->dim + ii] = false;
         }
       }
     }
@@ -1336,6 +1423,56 @@ _init_boundaries(const cs_lnum_t   n_b_faces,
 
 }
 
+/*-----------------------------------------------------------------------------
+ * Evaluate a scalar boundary condition formula on a given zone.
+ *
+ * When the formula does not depend on time, the values computed on the
+ * first call are cached in the boundaries structure and reused at the
+ * following time steps instead of re-evaluating the formula; in that
+ * case *cached is set to true and the returned array must not be freed
+ * by the caller.
+ *
+ * parameters:
+ *   f         <-- pointer to associated field
+ *   condition <-- formula condition type
+ *   izone     <-- associated zone id
+ *   bz        <-- associated boundary zone
+ *   cached    --> true if the returned array is owned by the cache
+ *
+ * return:
+ *   array of f->dim * bz->n_elts values (plus bz->n_elts exchange
+ *   coefficients for an exchange coefficient formula)
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_boundary_scalar_formula_values(const cs_field_t  *f,
+                                const char        *condition,
+                                int                izone,
+                                const cs_zone_t   *bz,
+                                bool              *cached)
+{
+  cs_real_t *vals = boundaries->scalar_e_vals[f->id][izone];
+
+  if (vals != NULL) {
+    *cached = true;
+    return vals;
+  }
+
+  vals = cs_meg_boundary_function(f->name, condition, bz);
+
+  bool steady = true;
+  for (cs_lnum_t i = 0; i < f->dim; i++) {
+    if (! boundaries->scalar_e_steady[f->id][izone * f->dim + i])
+      steady = false;
+  }
+
+  if (steady)
+    boundaries->scalar_e_vals[f->id][izone] = vals;
+
+  *cached = steady;
+  return vals;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1528,9 +1665,10 @@ void CS_PROCF (uiclim, UICLIM)(const int  *idarcy,
 
           case DIRICHLET_FORMULA:
             {
-              cs_real_t *new_vals = cs_meg_boundary_function(f->name,
-                                                             "dirichlet_formula",
-                                                             bz);
+              bool cached = false;
+              cs_real_t *new_vals
+                = _boundary_scalar_formula_values(f, "dirichlet_formula",
+                                                  izone, bz, &cached);
 
               for (cs_lnum_t ii = 0; ii < f->dim; ii++) {
                 for (cs_lnum_t ifac = 0; ifac < bz->n_elts; ifac++) {
@@ -1540,15 +1678,17 @@ void CS_PROCF (uiclim, UICLIM)(const int  *idarcy,
                     = new_vals[ii * bz->n_elts + ifac];
                 }
               }
-              BFT_FREE(new_vals);
+              if (! cached)
+                BFT_FREE(new_vals);
               break;
             }
 
           case NEUMANN_FORMULA:
             {
-              cs_real_t *new_vals = cs_meg_boundary_function(f->name,
-                                                             "neumann_formula",
-                                                             bz);
+              bool cached = false;
+              cs_real_t *new_vals
+                = _boundary_scalar_formula_values(f, "neumann_formula",
+                                                  izone, bz, &cached);
 
               for (cs_lnum_t ii = 0; ii < f->dim; ii++) {
                 for (cs_lnum_t ifac = 0; ifac < bz->n_elts; ifac++) {
@@ -1558,15 +1698,17 @@ void CS_PROCF (uiclim, UICLIM)(const int  *idarcy,
                     = new_vals[ii * bz->n_elts + ifac];
                 }
               }
-              BFT_FREE(new_vals);
+              if (! cached)
+                BFT_FREE(new_vals);
               break;
             }
 
           case EXCHANGE_COEFF_FORMULA:
             {
-              cs_real_t *new_vals = cs_meg_boundary_function(f->name,
-                                                             "exchange_coefficient_formula",
-                                                             bz);
+              bool cached = false;
+              cs_real_t *new_vals
+                = _boundary_scalar_formula_values
+                    (f, "exchange_coefficient_formula", izone, bz, &cached);
 
               for (cs_lnum_t ii = 0; ii < f->dim; ii++) {
                 for (cs_lnum_t ifac = 0; ifac < bz->n_elts; ifac++) {
@@ -1580,7 +1722,8 @@ void CS_PROCF (uiclim, UICLIM)(const int  *idarcy,
                     = new_vals[f->dim * bz->n_elts + ifac];
                 }
               }
-              BFT_FREE(new_vals);
+              if (! cached)
+                BFT_FREE(new_vals);
               break;
             }
         }
@@ -2684,6 +2827,10 @@ cs_gui_boundary_conditions_free_memory(void)
         BFT_FREE(boundaries->type_code[f->id]);
         BFT_FREE(boundaries->values[f->id]);
         BFT_FREE(boundaries->scalar_e[f->id]);
+        for (izone = 0; izone < n_zones; izone++)
+          BFT_FREE(boundaries->scalar_e_vals[f->id][izone]);
+        BFT_FREE(boundaries->scalar_e_steady[f->id]);
+        BFT_FREE(boundaries->scalar_e_vals[f->id]);
       }
     }
 
@@ -2747,6 +2894,8 @@ cs_gui_boundary_conditions_free_memory(void)
     BFT_FREE(boundaries->velocity_e);
     BFT_FREE(boundaries->direction_e);
     BFT_FREE(boundaries->scalar_e);
+    BFT_FREE(boundaries->scalar_e_steady);
+    BFT_FREE(boundaries->scalar_e_vals);
     BFT_FREE(boundaries->head_loss_e);
     BFT_FREE(boundaries->preout);
     BFT_FREE(boundaries->locator);
@@ -164,7 +164,8 @@ static cs_lagr_time_scheme_t _lagr_time_scheme
      .idiffl = 0,
      .ilapoi = 0,
      .iadded_mass = 0,
-     .added_mass_const = 0};
+     .added_mass_const = 0,
+     .subcycle_ratio = 0};
 
 /* Main Lagragian physical model parameters */
 
@@ -412,6 +413,18 @@ cs_lagr_coal_comb_t *cs_glob_lagr_coal_comb = &_lagr_coal_comb;
 
 cs_real_t *bound_stat = NULL;
 
+/* Boundary faces touched by particle statistics since the last reset,
+   so that unsteady resets of the boundary statistics may sweep only the
+   touched subset rather than the full dense array; when the touched
+   subset grows past a fixed fraction of the local faces, or cannot be
+   tracked (as on restart), a dense reset is used instead. */
+
+static bool        _bound_stat_touched_overflow = true;
+static cs_lnum_t   _bound_stat_n_touched = 0;
+static cs_lnum_t   _bound_stat_n_touched_max = 0;
+static cs_lnum_t  *_bound_stat_touched_ids = NULL;
+static char       *_bound_stat_touched_flag = NULL;
+
 const cs_lagr_zone_data_t     *cs_glob_lagr_boundary_conditions = NULL;
 const cs_lagr_zone_data_t     *cs_glob_lagr_volume_conditions = NULL;
 
@@ -1077,6 +1090,53 @@ _get_n_deleted(cs_lagr_particle_set_t  *p_set,
   return res;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reset boundary statistics.
+ *
+ * When the set of boundary faces touched since the previous reset has
+ * been fully tracked, only that subset is swept; otherwise the full
+ * dense array is zeroed.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_bound_stat_reset(void)
+{
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const int n_stats = cs_glob_lagr_dim->n_boundary_stats;
+
+  if (_bound_stat_touched_overflow) {
+
+    for (int ii = 0; ii < n_stats; ii++) {
+      cs_real_t *restrict b_stat = bound_stat + (size_t)ii*n_b_faces;
+#     pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+      for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++)
+        b_stat[ifac] = 0.0;
+    }
+
+    if (_bound_stat_touched_flag != NULL) {
+      memset(_bound_stat_touched_flag, 0, n_b_faces);
+      _bound_stat_touched_overflow = false;
+    }
+
+  }
+  else {
+
+    for (int ii = 0; ii < n_stats; ii++) {
+      cs_real_t *restrict b_stat = bound_stat + (size_t)ii*n_b_faces;
+      for (cs_lnum_t jj = 0; jj < _bound_stat_n_touched; jj++)
+        b_stat[_bound_stat_touched_ids[jj]] = 0.0;
+    }
+
+    for (cs_lnum_t jj = 0; jj < _bound_stat_n_touched; jj++)
+      _bound_stat_touched_flag[_bound_stat_touched_ids[jj]] = 0;
+
+  }
+
+  _bound_stat_n_touched = 0;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1102,9 +1162,15 @@ cs_lagr_init_c_arrays(int          dim_cs_glob_lagr_source_terms[2],
 
   assert(bound_stat == NULL);
 
-  if (n_boundary_stats > 0)
+  if (n_boundary_stats > 0) {
     BFT_MALLOC(bound_stat, n_b_faces * n_boundary_stats, cs_real_t);
 
+    _bound_stat_n_touched_max = n_b_faces/4 + 1;
+    BFT_MALLOC(_bound_stat_touched_ids, _bound_stat_n_touched_max, cs_lnum_t);
+    BFT_MALLOC(_bound_stat_touched_flag, n_b_faces, char);
+    memset(_bound_stat_touched_flag, 0, n_b_faces);
+  }
+
   BFT_MALLOC(cs_glob_lagr_source_terms->st_val,
              cs_glob_lagr_dim->ntersl * cs_glob_mesh->n_cells_with_ghosts,
              cs_real_t);
@@ -1128,6 +1194,8 @@ cs_lagr_finalize(void)
   if (n_boundary_stats > 0) {
     assert(bound_stat != NULL);
     BFT_FREE(bound_stat);
+    BFT_FREE(_bound_stat_touched_ids);
+    BFT_FREE(_bound_stat_touched_flag);
   }
 
   BFT_FREE(cs_glob_lagr_precipitation_model->nbprec);
@@ -1174,6 +1242,8 @@ cs_lagr_finalize(void)
 
   cs_lagr_tracking_finalize();
 
+  cs_lagr_poisson_finalize();
+
   cs_lagr_finalize_zone_conditions();
 
   /* Fluid gradients */
@@ -1184,6 +1254,34 @@ cs_lagr_finalize(void)
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark a boundary face as touched by particle boundary statistics.
+ *
+ * This must be called for each face whose entries in \ref bound_stat are
+ * assigned a possibly nonzero contribution, so that statistics resets
+ * may be restricted to the touched subset of faces.
+ *
+ * \param[in]  face_id  boundary face id
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_bound_stat_touch(cs_lnum_t  face_id)
+{
+  if (_bound_stat_touched_overflow || _bound_stat_touched_flag[face_id] != 0)
+    return;
+
+  if (_bound_stat_n_touched >= _bound_stat_n_touched_max) {
+    _bound_stat_touched_overflow = true;
+    return;
+  }
+
+  _bound_stat_touched_flag[face_id] = 1;
+  _bound_stat_touched_ids[_bound_stat_n_touched] = face_id;
+  _bound_stat_n_touched += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Provide access to injection set structure.
@@ -2364,12 +2462,7 @@ cs_lagr_solve_time_step(const int         itypfb[],
           lag_bdi->tstatp = 0.0;
           lag_bdi->npstf  = 0;
 
-          for (int  ii = 0; ii < cs_glob_lagr_dim->n_boundary_stats; ii++) {
-
-            for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++)
-              bound_stat[ii * n_b_faces + ifac] = 0.0;
-
-          }
+          _bound_stat_reset();
 
         }
 
@@ -2466,6 +2559,8 @@ cs_lagr_solve_time_step(const int         itypfb[],
             cs_real_t p_diam = cs_lagr_particles_get_real
                                  (p_set, npt, CS_LAGR_DIAMETER);
 
+            cs_lagr_bound_stat_touch(face_id);
+
             bound_stat[lag_bdi->iclogt * n_b_faces + face_id]
               += cs_lagr_particles_get_real(p_set, npt, CS_LAGR_DEPO_TIME);
             bound_stat[lag_bdi->iclogh * n_b_faces + face_id]
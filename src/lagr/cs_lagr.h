@@ -253,6 +253,16 @@ typedef struct {
   /*! Added-mass constant (\f$ C_A = 1\f$) */
   cs_real_t        added_mass_const;
 
+  /*! maximum allowed ratio between the Lagrangian time step and the
+    smallest local characteristic time (minimum of the particle
+    relaxation time and of the Lagrangian integral time scales) before
+    the integration of a given particle is subcycled with a locally
+    reduced time step; particles with larger characteristic times keep
+    the full step in a single pass.
+    Only used with \ref t_order = 1 and without a deposition submodel;
+    a value <= 0 (the default) deactivates subcycling */
+  cs_real_t        subcycle_ratio;
+
 } cs_lagr_time_scheme_t;
 
 /*! Main physical model parameters for the Lagrangian module */
@@ -1386,6 +1396,20 @@ cs_lagr_init_c_arrays(int          dim_cs_glob_lagr_source_terms[2],
 void
 cs_lagr_finalize(void);
 
+/*----------------------------------------------------------------------------
+ * Mark a boundary face as touched by particle boundary statistics.
+ *
+ * This must be called for each face whose entries in bound_stat are
+ * assigned a possibly nonzero contribution, so that statistics resets
+ * may be restricted to the touched subset of faces.
+ *
+ * parameters:
+ *   face_id <-- boundary face id
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_bound_stat_touch(cs_lnum_t  face_id);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
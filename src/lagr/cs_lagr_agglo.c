@@ -286,12 +286,165 @@ _gaps_classes(cs_lnum_2_t  *array,
   return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the slot matching a class in a class hash table.
+ *
+ * Linear probing; returns either the slot holding the class or the
+ * first empty slot of its probe sequence.
+ *
+ * \param[in]  hash      hash table
+ * \param[in]  class_nb  aggregate class searched for
+ *
+ * \return slot id associated with the class
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_class_hash_slot(const cs_lagr_agglo_class_hash_t  *hash,
+                 cs_lnum_t                          class_nb)
+{
+  /* Fibonacci hashing; size is a power of 2 */
+
+  cs_lnum_t s
+    = (cs_lnum_t)(  ((cs_gnum_t)class_nb * 2654435761u)
+                  & (cs_gnum_t)(hash->size - 1));
+
+  while (   hash->slot[s][0] != class_nb
+         && hash->slot[s][0] > -1)
+    s = (s + 1) & (hash->size - 1);
+
+  return s;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a class to parcel index hash table.
+ *
+ * \param[in]  n_expected  expected number of entries
+ *
+ * \return  pointer to created hash table
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_hash_t *
+cs_lagr_agglo_class_hash_create(cs_lnum_t  n_expected)
+{
+  cs_lagr_agglo_class_hash_t *hash;
+
+  BFT_MALLOC(hash, 1, cs_lagr_agglo_class_hash_t);
+
+  /* Size to a power of 2, keeping the load factor below one half */
+
+  cs_lnum_t size = 16;
+  while (size < n_expected*2)
+    size *= 2;
+
+  hash->size = size;
+  hash->n_used = 0;
+  BFT_MALLOC(hash->slot, size, cs_lnum_2_t);
+
+  for (cs_lnum_t i = 0; i < size; i++) {
+    hash->slot[i][0] = -1;
+    hash->slot[i][1] = -1;
+  }
+
+  return hash;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a class to parcel index hash table.
+ *
+ * \param[in, out]  hash  pointer to hash table pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_hash_destroy(cs_lagr_agglo_class_hash_t  **hash)
+{
+  if (hash != NULL && *hash != NULL) {
+    BFT_FREE((*hash)->slot);
+    BFT_FREE(*hash);
+    *hash = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the parcel index associated with a given class.
+ *
+ * \param[in]  hash      hash table
+ * \param[in]  class_nb  aggregate class searched for
+ *
+ * \return  associated parcel index, or -1 if the class is not mapped
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_hash_find(const cs_lagr_agglo_class_hash_t  *hash,
+                              cs_lnum_t                          class_nb)
+{
+  cs_lnum_t s = _class_hash_slot(hash, class_nb);
+
+  return (hash->slot[s][0] == class_nb) ? hash->slot[s][1] : -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Map a class to a parcel index, inserting or replacing the entry.
+ *
+ * \param[in, out]  hash      hash table
+ * \param[in]       class_nb  aggregate class (key)
+ * \param[in]       part_idx  associated parcel index
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_hash_set(cs_lagr_agglo_class_hash_t  *hash,
+                             cs_lnum_t                    class_nb,
+                             cs_lnum_t                    part_idx)
+{
+  /* Grow and rehash when the load factor reaches one half */
+
+  if (hash->n_used*2 >= hash->size) {
+
+    cs_lnum_t prev_size = hash->size;
+    cs_lnum_2_t *prev_slot = hash->slot;
+
+    hash->size = prev_size*2;
+    hash->n_used = 0;
+    BFT_MALLOC(hash->slot, hash->size, cs_lnum_2_t);
+
+    for (cs_lnum_t i = 0; i < hash->size; i++) {
+      hash->slot[i][0] = -1;
+      hash->slot[i][1] = -1;
+    }
+
+    for (cs_lnum_t i = 0; i < prev_size; i++) {
+      if (prev_slot[i][0] > -1)
+        cs_lagr_agglo_class_hash_set(hash, prev_slot[i][0], prev_slot[i][1]);
+    }
+
+    BFT_FREE(prev_slot);
+
+  }
+
+  cs_lnum_t s = _class_hash_slot(hash, class_nb);
+
+  if (hash->slot[s][0] != class_nb)
+    hash->n_used += 1;
+
+  hash->slot[s][0] = class_nb;
+  hash->slot[s][1] = part_idx;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -453,6 +606,13 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
   long long int vp = 0;
   cs_lnum_t new_class_nb = 0;
 
+  /* Broadphase for newly created parcels: maps each aggregate class to
+     the latest new parcel of that class, avoiding a linear scan of all
+     new parcels for each agglomeration event */
+
+  cs_lagr_agglo_class_hash_t *new_hash
+    = cs_lagr_agglo_class_hash_create(lnum_particles);
+
   /* Treat agglomeration between pairs*/
   while (kk >= 0) {
     cs_real_t rand;
@@ -584,20 +744,15 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
 
       cs_lnum_t add_to_end = 1;
 
-      for (cs_lnum_t indx = p_set->n_particles;
-          indx < p_set->n_particles + newpart;
-          indx++) {
-        cs_lnum_t stat_class
-          = cs_lagr_particles_get_lnum(p_set, indx, CS_LAGR_PARTICLE_AGGREGATE);
+      cs_lnum_t indx = cs_lagr_agglo_class_hash_find(new_hash, new_class_nb);
+      if (indx > -1) {
         cs_real_t stat_weight
           = cs_lagr_particles_get_real(p_set, indx, CS_LAGR_STAT_WEIGHT);
-        if (   (stat_class == new_class_nb)
-            && (stat_weight + vp <= parcmax)) {
+        if (stat_weight + vp <= parcmax) {
           long long int _auxx = round(stat_weight);
           cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT, _auxx+vp);
 
           add_to_end = 0;
-          break;
         }
       }
 
@@ -645,11 +800,16 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
         cs_lagr_particles_set_lnum(p_set, inserted_parts-1,
                                    CS_LAGR_PARTICLE_AGGREGATE, new_class_nb);
 
+        cs_lagr_agglo_class_hash_set(new_hash, new_class_nb,
+                                     inserted_parts-1);
+
       }
     }
     kk--;
   }
 
+  cs_lagr_agglo_class_hash_destroy(&new_hash);
+
   /* Store class and index of newly created particles */
   cs_lnum_2_t *interf_agglo;
   BFT_MALLOC(interf_agglo, newpart, cs_lnum_2_t);
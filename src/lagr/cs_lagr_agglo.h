@@ -41,10 +41,81 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Hash table mapping aggregate classes to parcel indices; used as a
+    broadphase by agglomeration and fragmentation to locate the newly
+    created parcel of a given class in constant time. */
+
+typedef struct {
+
+  cs_lnum_t     size;   /*!< number of slots (power of 2) */
+  cs_lnum_t     n_used; /*!< number of occupied slots */
+  cs_lnum_2_t  *slot;   /*!< {class, parcel index} pairs;
+                             class -1 marks an empty slot */
+
+} cs_lagr_agglo_class_hash_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a class to parcel index hash table.
+ *
+ * \param[in]  n_expected  expected number of entries
+ *
+ * \return  pointer to created hash table
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_hash_t *
+cs_lagr_agglo_class_hash_create(cs_lnum_t  n_expected);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a class to parcel index hash table.
+ *
+ * \param[in, out]  hash  pointer to hash table pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_hash_destroy(cs_lagr_agglo_class_hash_t  **hash);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the parcel index associated with a given class.
+ *
+ * \param[in]  hash      hash table
+ * \param[in]  class_nb  aggregate class searched for
+ *
+ * \return  associated parcel index, or -1 if the class is not mapped
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_hash_find(const cs_lagr_agglo_class_hash_t  *hash,
+                              cs_lnum_t                          class_nb);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Map a class to a parcel index, inserting or replacing the entry.
+ *
+ * \param[in, out]  hash      hash table
+ * \param[in]       class_nb  aggregate class (key)
+ * \param[in]       part_idx  associated parcel index
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_hash_set(cs_lagr_agglo_class_hash_t  *hash,
+                             cs_lnum_t                    class_nb,
+                             cs_lnum_t                    part_idx);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
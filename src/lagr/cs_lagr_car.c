@@ -156,29 +156,50 @@ cs_lagr_car(int              iprev,
 
   const cs_real_t *grav = cs_glob_physical_constants->gravity;
 
-  /* Compute Tp and Tc in case of thermal model
-     -------------------------------------------*/
+  /* Gather particle data used below into contiguous (structure of
+     arrays) slices, improving access locality for the loops below */
+
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  cs_lnum_t    *cell_ids;
+  cs_real_t    *p_diams, *p_masses;
+  cs_real_3_t  *part_vel, *part_vel_seen;
 
-  for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+  BFT_MALLOC(cell_ids, n_particles, cs_lnum_t);
+  BFT_MALLOC(p_diams, n_particles, cs_real_t);
+  BFT_MALLOC(p_masses, n_particles, cs_real_t);
+  BFT_MALLOC(part_vel, n_particles, cs_real_3_t);
+  BFT_MALLOC(part_vel_seen, n_particles, cs_real_3_t);
 
+  for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
     unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+    cell_ids[ip] = cs_lagr_particle_get_cell_id(particle, p_am);
+  }
+
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_DIAMETER, p_diams);
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_MASS, p_masses);
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_VELOCITY,
+                                (cs_real_t *)part_vel);
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_VELOCITY_SEEN,
+                                (cs_real_t *)part_vel_seen);
 
-    cs_real_t      p_diam   = cs_lagr_particle_get_real(particle, p_am,
-                                                        CS_LAGR_DIAMETER);
-    cs_lnum_t      cell_id  = cs_lagr_particle_get_cell_id(particle, p_am);
+  /* Compute Tp and Tc in case of thermal model
+     -------------------------------------------*/
+
+  for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
+
+    cs_real_t  p_diam  = p_diams[ip];
+    cs_lnum_t  cell_id = cell_ids[ip];
 
     if (cell_id >= 0) {
 
-      cs_real_t p_mass = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
-      cs_real_t p_rom  = p_mass * d6spi / pow(p_diam, 3.0);
+      cs_real_t p_rom  = p_masses[ip] * d6spi / pow(p_diam, 3.0);
 
       cs_real_t  rom           = extra->cromf->val[cell_id];
       cs_real_t  xnul          = extra->viscl->val[cell_id] / rom;
-      cs_real_t *part_vel_seen = cs_lagr_particle_attr(particle, p_am,
-                                                       CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_vel      = cs_lagr_particle_attr(particle, p_am, CS_LAGR_VELOCITY);
 
-      cs_real_t rel_vel_norm = cs_math_3_distance(part_vel_seen, part_vel);
+      cs_real_t rel_vel_norm = cs_math_3_distance(part_vel_seen[ip],
+                                                  part_vel[ip]);
 
       /* Compute the local Reynolds number */
       cs_real_t rep = rel_vel_norm * p_diam / xnul; /* local Reynolds number */
@@ -234,7 +255,7 @@ cs_lagr_car(int              iprev,
         cs_real_t prt  = xnul / xrkl;
         cs_real_t fnus = 2.0 + 0.55 * pow (rep, 0.5) * pow (prt, (d1s3));
 
-        cs_real_t p_cp = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_CP);
+        cs_real_t p_cp = cs_lagr_particles_get_real(p_set, ip, CS_LAGR_CP);
 
         /* Thermal characteristic time Tc computation */
         tempct[ip] = d2 * p_rom * p_cp / (fnus * 6.0 * rom * xcp * xrkl);
@@ -327,11 +348,9 @@ cs_lagr_car(int              iprev,
 
     /* -> Calcul de TL et BX     */
 
-    for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+    for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
-
-      cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_am);
+      cs_lnum_t cell_id = cell_ids[ip];
 
       if (cell_id >= 0) {
 
@@ -339,18 +358,13 @@ cs_lagr_car(int              iprev,
 
         if (dissip[cell_id] > 0.0 && energi[cell_id] > 0.0) {
 
-          cs_real_t *part_vel_seen = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY_SEEN);
-          cs_real_t *part_vel      = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY);
-
           cs_real_t tl  = cl * energi[cell_id] / dissip[cell_id];
           tl  = CS_MAX(tl, cs_math_epzero);
 
           for (cs_lnum_t i = 0; i < 3; i++) {
 
-            vpart[i] = part_vel[i];
-            vflui[i] = part_vel_seen[i];
+            vpart[i] = part_vel[ip][i];
+            vflui[i] = part_vel_seen[ip][i];
 
           }
 
@@ -511,11 +525,9 @@ cs_lagr_car(int              iprev,
 
   else {
 
-    for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+    for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
-
-      if (cs_lagr_particle_get_cell_id(particle, p_am) >= 0) {
+      if (cell_ids[ip] >= 0) {
 
         for (cs_lnum_t id = 0; id < 3; id++ ) {
 
@@ -548,11 +560,9 @@ cs_lagr_car(int              iprev,
 
     cs_field_t *stat_w = cs_lagr_stat_get_stat_weight(0);
 
-    for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
-
-      unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+    for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
 
-      cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_am);
+      cs_lnum_t cell_id = cell_ids[ip];
 
       if (cell_id >= 0) {
 
@@ -584,11 +594,9 @@ cs_lagr_car(int              iprev,
 
   else {
 
-    for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
-
-      unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+    for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
 
-      cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_am);
+      cs_lnum_t cell_id = cell_ids[ip];
 
       if (cell_id >= 0) {
 
@@ -604,6 +612,11 @@ cs_lagr_car(int              iprev,
 
   }
 
+  BFT_FREE(part_vel_seen);
+  BFT_FREE(part_vel);
+  BFT_FREE(p_masses);
+  BFT_FREE(p_diams);
+  BFT_FREE(cell_ids);
 }
 
 /*----------------------------------------------------------------------------*/
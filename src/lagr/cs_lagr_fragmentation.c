@@ -211,20 +211,23 @@ _find_class(cs_lnum_t  array[][2],
  * \param[in]  rho                     density of the particles
  * \param[in]  parcmax                 maximum statistical weight that a
  *                                     particle can have
+ * \param[in]  new_hash                class to parcel index map for the
+ *                                     fragments created so far
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_add_particle(cs_lnum_t   lnum_particles,
-              cs_lnum_t  *newpart,
-              cs_lnum_t   vp,
-              cs_lnum_t  *corr,
-              cs_lnum_t   frag_idx,
-              cs_lnum_t   newclass,
-              cs_real_t   minimum_particle_diam,
-              cs_real_t   rho,
-              cs_real_t   parcmax,
-              cs_lnum_t   interf[][2])
+_add_particle(cs_lnum_t                    lnum_particles,
+              cs_lnum_t                   *newpart,
+              cs_lnum_t                    vp,
+              cs_lnum_t                   *corr,
+              cs_lnum_t                    frag_idx,
+              cs_lnum_t                    newclass,
+              cs_real_t                    minimum_particle_diam,
+              cs_real_t                    rho,
+              cs_real_t                    parcmax,
+              cs_lnum_t                    interf[][2],
+              cs_lagr_agglo_class_hash_t  *new_hash)
 {
   /* Get information on the new fragment*/
   cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
@@ -244,30 +247,28 @@ _add_particle(cs_lnum_t   lnum_particles,
     }
   }
 
-  /* Add a new particle at the end of the set (otherwise)*/
-  cs_lnum_t add_to_end = 1;
-  for (cs_lnum_t indx = p_set->n_particles;
-       indx < p_set->n_particles + *newpart;
-       indx++) {
-    int stat_class = cs_lagr_particles_get_lnum(p_set, indx,
-                                                CS_LAGR_PARTICLE_AGGREGATE);
+  /* Merge with a fragment created earlier (otherwise); the hash maps
+     each class to the latest fragment of that class, avoiding a linear
+     scan of all new fragments for each fragmentation event */
+
+  cs_lnum_t indx = cs_lagr_agglo_class_hash_find(new_hash, newclass);
+  if (indx > -1) {
     cs_real_t stat_weight = cs_lagr_particles_get_real(p_set, indx,
                                                        CS_LAGR_STAT_WEIGHT);
-    if ((stat_class == newclass)
-       && (stat_weight + vp <= parcmax)) {
+    if (stat_weight + vp <= parcmax) {
       long long int auxx = round(stat_weight);
       cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT, auxx+vp);
-
-      add_to_end = 0;
       return;
     }
   }
 
-  if (add_to_end) {
-    (*newpart)++;
-    _insert_particles(*newpart, vp, corr, frag_idx, newclass,
-                      minimum_particle_diam, rho);
-  }
+  /* Add a new particle at the end of the set (otherwise) */
+
+  (*newpart)++;
+  _insert_particles(*newpart, vp, corr, frag_idx, newclass,
+                    minimum_particle_diam, rho);
+  cs_lagr_agglo_class_hash_set(new_hash, newclass,
+                               p_set->n_particles + *newpart - 1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -485,6 +486,10 @@ cs_lagr_fragmentation(cs_real_t  dt,
   cs_real_t cker = 0.;
   cker = cs_glob_lagr_fragmentation_model->scalar_kernel;
 
+  /* Broadphase for the fragments created below */
+  cs_lagr_agglo_class_hash_t *new_hash
+    = cs_lagr_agglo_class_hash_create(lnum_particles);
+
   for (cs_lnum_t i = 0; i < lnum_particles; ++i) {
 
     cs_lnum_t cell_num = cs_lagr_particles_get_lnum(p_set, corr[i], CS_LAGR_CELL_NUM);
@@ -526,21 +531,23 @@ cs_lagr_fragmentation(cs_real_t  dt,
 
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_1,
                         minimum_particle_diam, rho, parcmax,
-                        interf);
+                        interf, new_hash);
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_2,
                         minimum_particle_diam, rho, parcmax,
-                        interf);
+                        interf, new_hash);
         }
         else {
           cs_lnum_t class_nb_even = class_nb / 2;
           _add_particle(lnum_particles, &newpart, 2*vp, corr, i, class_nb_even,
                         minimum_particle_diam, rho, parcmax,
-                        interf);
+                        interf, new_hash);
         }
       }
     }
   }
 
+  cs_lagr_agglo_class_hash_destroy(&new_hash);
+
   /* Local array to save new fragments (class, index) */
   cs_lnum_2_t *interf_frag;
   BFT_MALLOC(interf_frag, newpart, cs_lnum_2_t);
@@ -636,6 +636,23 @@ _init_particles(cs_lagr_particle_set_t         *p_set,
 
   const cs_real_t pis6 = cs_math_pi / 6.0;
 
+  /* Pre-draw random values for the whole injected batch, so the
+     per-particle loop does not go through scalar generator calls */
+
+  const cs_lnum_t n_new = elt_particle_idx[n_elts];
+
+  cs_real_t *batch_random = NULL, *interf_random = NULL;
+
+  if (n_new > 0) {
+    BFT_MALLOC(batch_random, n_new, cs_real_t);
+    cs_random_uniform(n_new, batch_random);
+
+    if (cs_glob_lagr_model->deposition == 1) {
+      BFT_MALLOC(interf_random, n_new, cs_real_t);
+      cs_random_uniform(n_new, interf_random);
+    }
+  }
+
   /* Loop on zone elements where particles are injected */
 
   for (cs_lnum_t li = 0; li < n_elts; li++) {
@@ -660,8 +677,7 @@ _init_particles(cs_lagr_particle_set_t         *p_set,
 
       /* Random value associated with each particle */
 
-      cs_real_t part_random = -1;
-      cs_random_uniform(1, &part_random);
+      cs_real_t part_random = batch_random[p_id - p_set->n_particles];
       cs_lagr_particle_set_real(particle, p_am, CS_LAGR_RANDOM_VALUE,
                                 part_random);
 
@@ -879,8 +895,7 @@ _init_particles(cs_lagr_particle_set_t         *p_set,
 
       if (cs_glob_lagr_model->deposition == 1) {
 
-        cs_real_t random;
-        cs_random_uniform(1, &random);
+        cs_real_t random = interf_random[p_id - p_set->n_particles];
         cs_lagr_particle_set_real(particle, p_am,
                                   CS_LAGR_INTERF, 5.0 + 15.0 * random);
         cs_lagr_particle_set_real(particle, p_am,
@@ -913,6 +928,9 @@ _init_particles(cs_lagr_particle_set_t         *p_set,
 
   }
 
+  BFT_FREE(batch_random);
+  BFT_FREE(interf_random);
+
   /* Update weights to have the correct flow rate
      -------------------------------------------- */
 
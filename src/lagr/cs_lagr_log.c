@@ -58,6 +58,7 @@
 #include "cs_field.h"
 
 #include "cs_lagr.h"
+#include "cs_lagr_query.h"
 #include "cs_lagr_tracking.h"
 #include "cs_lagr_post.h"
 #include "cs_lagr_stat.h"
@@ -477,6 +478,12 @@ cs_lagr_log_setup(void)
      cs_glob_lagr_time_scheme->t_order,
      _status(cs_glob_lagr_time_scheme->ilapoi));
 
+  if (cs_glob_lagr_time_scheme->subcycle_ratio > 0)
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    per-particle subcycling ratio:                %g\n"),
+       (double)cs_glob_lagr_time_scheme->subcycle_ratio);
+
   cs_log_printf
     (CS_LOG_SETUP,
      _("\n  Trajectory/particle postprocessing options:\n"));
@@ -624,6 +631,26 @@ cs_lagr_log_iteration(void)
                   pc->n_g_cumulative_failed * 100. / pc->n_g_cumulative_total);
       cs_log_separator(CS_LOG_DEFAULT);
 
+  /* Distribution of particles across ranks */
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_lnum_t n_p_loc = cs_lagr_query_n_particles();
+    cs_lnum_t n_p_min = n_p_loc, n_p_max = n_p_loc;
+
+    cs_parall_counter_max(&n_p_max, 1);
+    cs_parall_min(1, CS_LNUM_TYPE, &n_p_min);
+
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("   Particles per rank: min %10llu, max %10llu, imbalance %9.4f\n"),
+       (unsigned long long)n_p_min,
+       (unsigned long long)n_p_max,
+       cs_lagr_query_particle_imbalance());
+    cs_log_separator(CS_LOG_DEFAULT);
+
+  }
+
   /* Flow rate for each zone   */
   cs_log_printf(CS_LOG_DEFAULT,
                 _("   Zone  Class  Mass flow rate(kg/s)      Name (type)\n"));
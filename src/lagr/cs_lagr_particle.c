@@ -1133,6 +1133,31 @@ cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Reserve (preallocate) particle set buffer capacity.
+ *
+ * Growing the particle set requires copying its whole buffer, which can
+ * be very expensive for large sets; with continuous injection, calling
+ * this during setup with the expected peak particle count ensures the
+ * buffer is allocated once and never reallocated during the run. Slots
+ * of exited or merged particles are recycled in place by the tracking
+ * compaction, so the reserved capacity is reused across time steps.
+ *
+ * Contrary to \ref cs_lagr_particle_set_resize, no check is done
+ * relative to a global particle number limit.
+ *
+ * \param[in]  n_particles_max  local number of particles to reserve for
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_reserve(cs_lnum_t  n_particles_max)
+{
+  if (cs_glob_lagr_particle_set != NULL)
+    _particle_set_resize(cs_glob_lagr_particle_set, n_particles_max);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set reallocation factor for particle sets.
@@ -1214,6 +1239,86 @@ cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
   *((cs_lnum_t *)(p_buf + p_am->displ[1][CS_LAGR_RANK_ID])) = cs_glob_rank_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Gather a real-valued particle attribute into a contiguous array.
+ *
+ * The main particle storage is interleaved (array of structures), which
+ * is practical for particle displacement and exchange, but prevents
+ * vectorization of computational kernels; this copies an attribute of
+ * all particles to a contiguous (structure of arrays) slice, interlaced
+ * if the attribute has multiple components.
+ *
+ * \param[in]   particles  associated particle set
+ * \param[in]   time_id    associated time id (0: current, 1: previous)
+ * \param[in]   attr       attribute whose values are requested
+ * \param[out]  values     attribute values (size: n_particles * dimension)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_gather_real(const cs_lagr_particle_set_t  *particles,
+                              int                            time_id,
+                              cs_lagr_attribute_t            attr,
+                              cs_real_t                      values[])
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  assert(p_am->count[time_id][attr] > 0);
+  assert(p_am->datatype[attr] == CS_REAL_TYPE);
+
+  const cs_lnum_t n_particles = particles->n_particles;
+  const cs_lnum_t count = p_am->count[time_id][attr];
+  const size_t extents = p_am->extents;
+  const unsigned char *p_buf
+    = particles->p_buffer + p_am->displ[time_id][attr];
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    const cs_real_t *v = (const cs_real_t *)(p_buf + extents*i);
+    for (cs_lnum_t j = 0; j < count; j++)
+      values[i*count + j] = v[j];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Scatter a real-valued particle attribute from a contiguous array.
+ *
+ * This is the reverse of \ref cs_lagr_particles_gather_real, copying
+ * values computed on a contiguous (structure of arrays) slice back to
+ * the main interleaved particle storage.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       time_id    associated time id (0: current, 1: previous)
+ * \param[in]       attr       attribute whose values are set
+ * \param[in]       values     attribute values (size: n_particles * dimension)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_scatter_real(cs_lagr_particle_set_t  *particles,
+                               int                      time_id,
+                               cs_lagr_attribute_t      attr,
+                               const cs_real_t          values[])
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+
+  assert(p_am->count[time_id][attr] > 0);
+  assert(p_am->datatype[attr] == CS_REAL_TYPE);
+
+  const cs_lnum_t n_particles = particles->n_particles;
+  const cs_lnum_t count = p_am->count[time_id][attr];
+  const size_t extents = p_am->extents;
+  unsigned char *p_buf
+    = particles->p_buffer + p_am->displ[time_id][attr];
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+    cs_real_t *v = (cs_real_t *)(p_buf + extents*i);
+    for (cs_lnum_t j = 0; j < count; j++)
+      v[j] = values[i*count + j];
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
@@ -1310,6 +1310,20 @@ cs_lagr_particle_source_term_const(void                           *particle,
 int
 cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles);
 
+/*----------------------------------------------------------------------------
+ * Reserve (preallocate) particle set buffer capacity.
+ *
+ * Calling this during setup with the expected peak particle count
+ * ensures the buffer is allocated once and not regrown (with copies)
+ * during the run.
+ *
+ * parameters:
+ *   n_particles_max <-- local number of particles to reserve for
+ *----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_reserve(cs_lnum_t  n_particles_max);
+
 /*----------------------------------------------------------------------------
  * Set reallocation factor for particle sets.
  *
@@ -1365,6 +1379,50 @@ void
 cs_lagr_particles_current_to_previous(cs_lagr_particle_set_t  *particles,
                                       cs_lnum_t                particle_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Gather a real-valued particle attribute into a contiguous array.
+ *
+ * The main particle storage is interleaved (array of structures), which
+ * is practical for particle displacement and exchange, but prevents
+ * vectorization of computational kernels; this copies an attribute of
+ * all particles to a contiguous (structure of arrays) slice, interlaced
+ * if the attribute has multiple components.
+ *
+ * \param[in]   particles  associated particle set
+ * \param[in]   time_id    associated time id (0: current, 1: previous)
+ * \param[in]   attr       attribute whose values are requested
+ * \param[out]  values     attribute values (size: n_particles * dimension)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_gather_real(const cs_lagr_particle_set_t  *particles,
+                              int                            time_id,
+                              cs_lagr_attribute_t            attr,
+                              cs_real_t                      values[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Scatter a real-valued particle attribute from a contiguous array.
+ *
+ * This is the reverse of \ref cs_lagr_particles_gather_real, copying
+ * values computed on a contiguous (structure of arrays) slice back to
+ * the main interleaved particle storage.
+ *
+ * \param[in, out]  particles  associated particle set
+ * \param[in]       time_id    associated time id (0: current, 1: previous)
+ * \param[in]       attr       attribute whose values are set
+ * \param[in]       values     attribute values (size: n_particles * dimension)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particles_scatter_real(cs_lagr_particle_set_t  *particles,
+                               int                      time_id,
+                               cs_lagr_attribute_t      attr,
+                               const cs_real_t          values[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Dump a cs_lagr_particle_set_t structure
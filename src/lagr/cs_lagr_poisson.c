@@ -53,6 +53,8 @@
 
 #include "cs_boundary_conditions.h"
 #include "cs_equation_iterative_solve.h"
+#include "cs_multigrid.h"
+#include "cs_sles.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parameters.h"
@@ -75,6 +77,15 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Correction potential of the previous call, kept as initial guess */
+
+static cs_lnum_t   _phi_prev_size = 0;
+static cs_real_t  *_phi_prev = NULL;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -185,6 +196,13 @@ _lageqp(cs_real_t   *vitessel,
 
   bft_printf(_("   ** RESOLUTION POUR LA VARIABLE Pressure correction"));
 
+  /* Define a persistent multigrid solver for this system on the first
+     pass; the cs_sles_t instance and its parameters are retained by
+     name across calls. */
+
+  if (cs_sles_find(-1, "PoissonL") == NULL)
+    cs_multigrid_define(-1, "PoissonL", CS_MULTIGRID_V_CYCLE);
+
   /* ====================================================================
    * 2. TERMES SOURCES
    * ==================================================================== */
@@ -200,6 +218,15 @@ _lageqp(cs_real_t   *vitessel,
 
   }
 
+  /* The correction of the previous call is a good initial guess, as
+     the particle statistics driving the right-hand side evolve slowly
+     from one correction to the next. */
+
+  if (_phi_prev != NULL && _phi_prev_size == ncel) {
+    for (cs_lnum_t iel = 0; iel < ncel; iel++)
+      phi[iel] = _phi_prev[iel];
+  }
+
   /*     "VITESSE" DE DIFFUSION FACE     */
   cs_face_viscosity(m,
                     fvq,
@@ -358,6 +385,14 @@ _lageqp(cs_real_t   *vitessel,
                                      NULL,         /* xcpp */
                                      NULL);        /* eswork */
 
+  /* Save the correction for the next call's initial guess */
+
+  if (_phi_prev_size != ncel) {
+    BFT_REALLOC(_phi_prev, ncel, cs_real_t);
+    _phi_prev_size = ncel;
+  }
+  memcpy(_phi_prev, phi, ncel*sizeof(cs_real_t));
+
   /* Free memory */
 
   BFT_FREE(viscf);
@@ -511,4 +546,16 @@ cs_lagr_poisson(const int  itypfb[])
 
 }
 
+/*-----------------------------------------------------------------*/
+/*! \brief Free arrays kept between particle velocity corrections
+ */
+/*-----------------------------------------------------------------*/
+
+void
+cs_lagr_poisson_finalize(void)
+{
+  _phi_prev_size = 0;
+  BFT_FREE(_phi_prev);
+}
+
 END_C_DECLS
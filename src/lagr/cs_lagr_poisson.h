@@ -61,6 +61,15 @@ BEGIN_C_DECLS
 void
 cs_lagr_poisson(const int  itypfb[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free arrays kept between particle velocity corrections
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_poisson_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
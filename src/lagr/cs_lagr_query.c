@@ -42,6 +42,7 @@
 #include "cs_parall.h"
 
 #include "cs_lagr.h"
+#include "cs_lagr_particle.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -111,6 +112,58 @@ cs_lagr_particle_restart(void)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local (per-rank) number of particles.
+ *
+ * \return local number of particles, 0 if module is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_query_n_particles(void)
+{
+  cs_lnum_t retval = 0;
+
+  const cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  if (p_set != NULL)
+    retval = p_set->n_particles;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the particle load imbalance across MPI ranks.
+ *
+ * The imbalance is defined as the ratio of the maximum per-rank particle
+ * count to the mean per-rank count; a perfectly balanced distribution
+ * yields 1. This call is collective on all ranks.
+ *
+ * \return particle load imbalance, 1 if no particles are present
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t
+cs_lagr_query_particle_imbalance(void)
+{
+  cs_real_t retval = 1.;
+
+  cs_lnum_t n_loc = cs_lagr_query_n_particles();
+  cs_lnum_t n_max = n_loc;
+  cs_gnum_t n_tot = n_loc;
+
+  cs_parall_counter(&n_tot, 1);
+  cs_parall_counter_max(&n_max, 1);
+
+  if (n_tot > 0)
+    retval =   (cs_real_t)n_max * (cs_real_t)cs_glob_n_ranks
+             / (cs_real_t)n_tot;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
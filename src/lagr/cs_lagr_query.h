@@ -69,6 +69,32 @@ cs_lagr_model_type(void);
 int
 cs_lagr_particle_restart(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local (per-rank) number of particles.
+ *
+ * \return local number of particles, 0 if module is not active
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_query_n_particles(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the particle load imbalance across MPI ranks.
+ *
+ * The imbalance is defined as the ratio of the maximum per-rank particle
+ * count to the mean per-rank count; a perfectly balanced distribution
+ * yields 1. This call is collective on all ranks.
+ *
+ * \return particle load imbalance, 1 if no particles are present
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_real_t
+cs_lagr_query_particle_imbalance(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
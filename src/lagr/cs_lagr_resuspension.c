@@ -126,11 +126,87 @@ cs_lagr_resuspension(void)
   /* 1.    Resuspension sub model   */
   /* ================================================================  */
 
+  const int clogging = cs_glob_lagr_model->clogging;
+  const cs_real_t diam_mean = cs_glob_lagr_clogging_model->diam_mean;
+
   cs_lnum_t test_colli;
   cs_real_t adhesion_energ;
 
+  /* Gather boundary-layer candidates into a compact batch: only
+     particles attached to a boundary face and in a deposition state
+     handled by the sub-model are concerned; in wall-bounded flows
+     this is usually a small fraction of the local population. */
+
+  cs_lnum_t n_cand = 0;
+  cs_lnum_t *cand_id;
+  BFT_MALLOC(cand_id, p_set->n_particles, cs_lnum_t);
+
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
+    unsigned char *part = p_set->p_buffer + p_am->extents * ip;
+    cs_lnum_t face_id
+      = cs_lagr_particle_get_lnum(part, p_am, CS_LAGR_NEIGHBOR_FACE_ID);
+    cs_lnum_t flag
+      = cs_lagr_particle_get_lnum(part, p_am, CS_LAGR_DEPOSITION_FLAG);
+
+    if (   face_id > -1
+        && (   flag == CS_LAGR_PART_IMPOSED_MOTION
+            || flag == CS_LAGR_PART_DEPOSITED
+            || flag == CS_LAGR_PART_ROLLING)) {
+      cand_id[n_cand] = ip;
+      n_cand++;
+    }
+
+  }
+
+  /* Fluid temperature seen by the batch, with the thermal model
+     selection hoisted out of the particle loop */
+
+  cs_real_t *cand_temp;
+  BFT_MALLOC(cand_temp, n_cand, cs_real_t);
+
+  if (extra->scal_t != NULL) {
+
+    if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
+        && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS) {
+      for (cs_lnum_t i = 0; i < n_cand; i++) {
+        unsigned char *part = p_set->p_buffer + p_am->extents * cand_id[i];
+        cs_lnum_t iel = cs_lagr_particle_get_cell_id(part, p_am);
+        cand_temp[i] = extra->scal_t->val[iel] + tkelvi;
+      }
+    }
+
+    else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
+             && cs_glob_thermal_model->itpscl ==
+                        CS_TEMPERATURE_SCALE_KELVIN) {
+      for (cs_lnum_t i = 0; i < n_cand; i++) {
+        unsigned char *part = p_set->p_buffer + p_am->extents * cand_id[i];
+        cs_lnum_t iel = cs_lagr_particle_get_cell_id(part, p_am);
+        cand_temp[i] = extra->scal_t->val[iel];
+      }
+    }
+
+    else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY) {
+      cs_lnum_t mode = 1;
+      for (cs_lnum_t i = 0; i < n_cand; i++) {
+        unsigned char *part = p_set->p_buffer + p_am->extents * cand_id[i];
+        cs_lnum_t iel = cs_lagr_particle_get_cell_id(part, p_am);
+        CS_PROCF (usthht,USTHHT)(&mode,
+                                 &(extra->scal_t->val[iel]),
+                                 &(cand_temp[i]));
+      }
+    }
+
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_cand; i++)
+      cand_temp[i] = cs_glob_fluid_properties->t0;
+  }
+
+  for (cs_lnum_t i = 0; i < n_cand; i++) {
+
+    cs_lnum_t ip = cand_id[i];
+
     unsigned char *part = p_set->p_buffer + p_am->extents * ip;
     cs_lnum_t face_id
       = cs_lagr_particle_get_lnum(part, p_am, CS_LAGR_NEIGHBOR_FACE_ID);
@@ -147,32 +223,9 @@ cs_lagr_resuspension(void)
 
     cs_lnum_t iel = cs_lagr_particle_get_cell_id(part, p_am);
 
-    cs_real_t temp;
-
-    if (extra->scal_t != NULL) {
-
-      if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
-          && cs_glob_thermal_model->itpscl == CS_TEMPERATURE_SCALE_CELSIUS)
-        temp = extra->scal_t->val[iel] + tkelvi;
-
-      else if (   cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_TEMPERATURE
-               && cs_glob_thermal_model->itpscl ==
-                          CS_TEMPERATURE_SCALE_KELVIN)
-        temp = extra->scal_t->val[iel];
-
-      else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY) {
-
-        cs_lnum_t mode = 1;
-        CS_PROCF (usthht,USTHHT)(&mode, &(extra->scal_t->val[iel]), &temp);
-
-      }
-
-    }
-    else
-      temp = cs_glob_fluid_properties->t0;
+    cs_real_t temp = cand_temp[i];
 
     cs_lnum_t flag = cs_lagr_particle_get_lnum(part, p_am, CS_LAGR_DEPOSITION_FLAG);
-    cs_real_t diam_mean = cs_glob_lagr_clogging_model->diam_mean;
 
     /* Treatment of internal deposition and user imposed motion */
     if (flag == CS_LAGR_PART_IMPOSED_MOTION && face_id > -1) {
@@ -218,8 +271,8 @@ cs_lagr_resuspension(void)
     }
 
     /* Monolayer resuspension model */
-    if ((    cs_glob_lagr_model->clogging == 0 && face_id > 0)
-         || (   cs_glob_lagr_model->clogging == 1 && face_id > 0
+    if ((    clogging == 0 && face_id > 0)
+         || (   clogging == 1 && face_id > 0
              && bound_stat[face_id + n_faces * lag_bi->ihdepm] < diam_mean)) {
 
       if (flag == CS_LAGR_PART_DEPOSITED)
@@ -290,6 +343,8 @@ cs_lagr_resuspension(void)
 
               if (lag_bi->iflmbd == 1) {
 
+                cs_lagr_bound_stat_touch(face_id);
+
                 bound_stat[lag_bi->ires   * n_faces + face_id] +=   p_stat_weight;
                 bound_stat[lag_bi->iflres * n_faces + face_id] +=   p_stat_weight * p_mass / norm_face;
                 bound_stat[lag_bi->iflm   * n_faces + face_id] += - p_stat_weight * p_mass / norm_face;
@@ -362,6 +417,8 @@ cs_lagr_resuspension(void)
 
                 if (lag_bi->iflmbd == 1) {
 
+                  cs_lagr_bound_stat_touch(face_id);
+
                   bound_stat[lag_bi->ires   * n_faces + face_id] +=   p_stat_weight;
                   bound_stat[lag_bi->iflres * n_faces + face_id] +=   p_stat_weight * p_mass / norm_face;
                   bound_stat[lag_bi->iflm   * n_faces + face_id] += - p_stat_weight * p_mass / norm_face;
@@ -383,7 +440,7 @@ cs_lagr_resuspension(void)
 
       }
     } /* Enf of monolayer resuspension */
-       else if (    cs_glob_lagr_model->clogging == 1
+       else if (    clogging == 1
                  && bound_stat[face_id + n_faces * lag_bi->ihdepm] >= diam_mean) {
 
       /* Treatment of multilayer resuspension */
@@ -498,6 +555,8 @@ cs_lagr_resuspension(void)
 
             if (lag_bi->iflmbd == 1) {
 
+              cs_lagr_bound_stat_touch(face_id);
+
               bound_stat[lag_bi->ires   * n_faces + face_id] +=   p_stat_weight;
               bound_stat[lag_bi->iflres * n_faces + face_id] +=   p_stat_weight * p_mass / norm_face;
               bound_stat[lag_bi->iflm   * n_faces + face_id] += - p_stat_weight * p_mass / norm_face;
@@ -517,6 +576,9 @@ cs_lagr_resuspension(void)
 
   }
 
+  BFT_FREE(cand_temp);
+  BFT_FREE(cand_id);
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -50,6 +50,7 @@
 #include "cs_physical_model.h"
 #include "cs_random.h"
 #include "cs_thermal_model.h"
+#include "cs_time_step.h"
 
 #include "cs_lagr.h"
 #include "cs_lagr_adh.h"
@@ -89,6 +90,11 @@ static const double _k_boltz = 1.38e-23;
 
 /*----------------------------------------------------------------------------*/
 /*! \brief Integration of SDEs by 1st order time scheme
+ *
+ * If \ref cs_lagr_time_scheme_t::subcycle_ratio is positive, particles
+ * whose characteristic times are small relative to the time step are
+ * integrated over several substeps, with coefficients frozen over the
+ * full step.
  *
  * \param[in]  dtp       time step
  * \param[in]  taup      dynamic characteristic time
@@ -127,47 +133,197 @@ _lages1(cs_real_t           dtp,
 
   cs_real_t tkelvi = cs_physical_constants_celsius_to_kelvin;
 
-  cs_real_t vitf = 0.0;
+  cs_lnum_t nor = cs_glob_lagr_time_step->nor;
 
-  cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
-  cs_real_t ter1f, ter2f, ter3f;
-  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
-  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
-  cs_real_t p11, p21, p22, p31, p32, p33;
-  cs_real_t omega2, gama2, omegam;
-  cs_real_t grga2, gagam, gaome;
-  cs_real_t tbrix1, tbrix2, tbriu;
+  const cs_lnum_t n_particles = p_set->n_particles;
+  const int lamvbr = cs_glob_lagr_brownian->lamvbr;
 
-  cs_lnum_t nor = cs_glob_lagr_time_step->nor;
+  /* Gather particle data into contiguous (structure of arrays) slices,
+     so that the integration loop below runs on unit-stride data and
+     may be vectorized by the compiler */
 
-  /* Integrate SDE's over particles */
+  cs_lnum_t    *cell_id;
+  cs_real_3_t  *part_vel, *part_vel_seen, *part_coords;
+  cs_real_3_t  *old_part_vel, *old_part_vel_seen, *old_part_coords;
 
-  for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+  BFT_MALLOC(cell_id, n_particles, cs_lnum_t);
+  BFT_MALLOC(part_vel, n_particles, cs_real_3_t);
+  BFT_MALLOC(part_vel_seen, n_particles, cs_real_3_t);
+  BFT_MALLOC(part_coords, n_particles, cs_real_3_t);
+  BFT_MALLOC(old_part_vel, n_particles, cs_real_3_t);
+  BFT_MALLOC(old_part_vel_seen, n_particles, cs_real_3_t);
+  BFT_MALLOC(old_part_coords, n_particles, cs_real_3_t);
 
+  for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
     unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
+    cell_id[ip] = cs_lagr_particle_get_cell_id(particle, p_am);
+  }
 
-    cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle, p_am);
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_VELOCITY,
+                                (cs_real_t *)part_vel);
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_VELOCITY_SEEN,
+                                (cs_real_t *)part_vel_seen);
+  cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_COORDS,
+                                (cs_real_t *)part_coords);
+  cs_lagr_particles_gather_real(p_set, 1, CS_LAGR_VELOCITY,
+                                (cs_real_t *)old_part_vel);
+  cs_lagr_particles_gather_real(p_set, 1, CS_LAGR_VELOCITY_SEEN,
+                                (cs_real_t *)old_part_vel_seen);
+  cs_lagr_particles_gather_real(p_set, 1, CS_LAGR_COORDS,
+                                (cs_real_t *)old_part_coords);
 
-    if (cell_id >= 0) {
+  /* In case of Brownian movement, the fluid temperature seen by each
+     particle depends on the physical and thermal models, so compute it
+     in a separate (scalar) pass, keeping the main loop free of branches */
 
-      cs_real_t *old_part_vel      = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY);
-      cs_real_t *old_part_vel_seen = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_vel          = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY);
-      cs_real_t *part_vel_seen     = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_VELOCITY_SEEN);
-      cs_real_t *part_coords       = cs_lagr_particle_attr(particle, p_am,
-                                                           CS_LAGR_COORDS);
-      cs_real_t *old_part_coords   = cs_lagr_particle_attr_n(particle, p_am, 1,
-                                                             CS_LAGR_COORDS);
+  cs_real_t *tempf = NULL, *p_mass = NULL;
 
-      cs_real_t rom = extra->cromf->val[cell_id];
+  if (lamvbr == 1) {
+
+    BFT_MALLOC(tempf, n_particles, cs_real_t);
+    BFT_MALLOC(p_mass, n_particles, cs_real_t);
+
+    cs_lagr_particles_gather_real(p_set, 0, CS_LAGR_MASS, p_mass);
+
+    for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
+
+      if (cell_id[ip] < 0) {
+        tempf[ip] = 0;
+        continue;
+      }
+
+      if (   cs_glob_physical_model_flag[CS_COMBUSTION_COAL] >= 0
+          || cs_glob_physical_model_flag[CS_COMBUSTION_PCLC] >= 0)
+        tempf[ip] = extra->t_gaz->val[cell_id[ip]];
+
+      else if (   cs_glob_physical_model_flag[CS_COMBUSTION_3PT] >= 0
+               || cs_glob_physical_model_flag[CS_COMBUSTION_EBU] >= 0
+               || cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] >= 0
+               || cs_glob_physical_model_flag[CS_JOULE_EFFECT] >= 0)
+        tempf[ip] = extra->temperature->val[cell_id[ip]];
+
+      else if (   cs_glob_thermal_model->itherm ==
+                          CS_THERMAL_MODEL_TEMPERATURE
+               && cs_glob_thermal_model->itpscl ==
+                          CS_TEMPERATURE_SCALE_CELSIUS)
+        tempf[ip] = extra->scal_t->val[cell_id[ip]] + tkelvi;
+
+      else if (   cs_glob_thermal_model->itherm ==
+                          CS_THERMAL_MODEL_TEMPERATURE
+               && cs_glob_thermal_model->itpscl ==
+                          CS_TEMPERATURE_SCALE_KELVIN)
+        tempf[ip] = extra->scal_t->val[cell_id[ip]];
+
+      else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY) {
+
+        cs_lnum_t mode  = 1;
+        CS_PROCF (usthht,USTHHT) (&mode,
+                                  &(extra->scal_t->val[cell_id[ip]]),
+                                  &(tempf[ip]));
+
+        tempf[ip] = tempf[ip] + tkelvi;
+
+      }
+
+      else
+        tempf[ip] = cs_glob_fluid_properties->t0;
+
+    }
+
+  }
+
+  /* Integrate SDE's over particles.
+
+     When per-particle subcycling is active, stiff particles (whose
+     characteristic times are small compared to the Lagrangian time step)
+     are integrated over several substeps with frozen coefficients,
+     while the others keep the full step in a single pass. */
+
+  const cs_real_t subc_r = cs_glob_lagr_time_scheme->subcycle_ratio;
+  const int idistu = cs_glob_lagr_time_scheme->idistu;
+  const cs_gnum_t sub_key_base = (cs_gnum_t)(cs_glob_time_step->nt_cur) << 33;
+
+  for (cs_lnum_t ip = 0; ip < n_particles; ip++) {
+
+    if (cell_id[ip] >= 0) {
+
+      cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8;
+      cs_real_t aux9, aux10, aux11;
+      cs_real_t ter1f, ter2f, ter3f;
+      cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
+      cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
+      cs_real_t p11, p21, p22, p31, p32, p33;
+      cs_real_t omega2, gama2, omegam;
+      cs_real_t grga2, gagam, gaome;
+      cs_real_t tbrix1, tbrix2, tbriu;
+
+      /* Number of substeps for this particle */
+
+      cs_lnum_t n_sub = 1;
+      if (subc_r > 0) {
+        cs_real_t tmin = CS_MIN(taup[ip], tlag[ip][0]);
+        tmin = CS_MIN(tmin, tlag[ip][1]);
+        tmin = CS_MIN(tmin, tlag[ip][2]);
+        if (tmin > 0 && dtp > subc_r * tmin) {
+          n_sub = (cs_lnum_t)ceil(dtp / (subc_r * tmin));
+          n_sub = CS_MIN(n_sub, 64);
+        }
+      }
+
+      const cs_real_t dts = dtp / n_sub;
+
+      cs_real_t vp_o[3], vs_o[3], xp_o[3];
+      for (cs_lnum_t id = 0; id < 3; id++) {
+        vp_o[id] = old_part_vel[ip][id];
+        vs_o[id] = old_part_vel_seen[ip][id];
+        xp_o[id] = old_part_coords[ip][id];
+      }
+
+      for (cs_lnum_t i_sub = 0; i_sub < n_sub; i_sub++) {
+
+      cs_real_t vg[3][3];
+      cs_real_t bg[6];
+
+      /* The first substep reuses the Gaussian draws of the standard
+         (non-subcycled) path; later substeps use independent
+         counter-based sub-streams, so results do not depend on the
+         particle distribution across ranks or threads */
+
+      if (i_sub == 0) {
+        for (cs_lnum_t id = 0; id < 3; id++) {
+          for (cs_lnum_t ivf = 0; ivf < 3; ivf++)
+            vg[id][ivf] = vagaus[ip][id][ivf];
+        }
+        if (lamvbr == 1) {
+          for (cs_lnum_t id = 0; id < 6; id++)
+            bg[id] = brgaus[ip * 6 + id];
+        }
+      }
+      else {
+        cs_gnum_t keys[9];
+        cs_gnum_t kb = sub_key_base | ((cs_gnum_t)i_sub << 54);
+        if (idistu == 1) {
+          for (cs_lnum_t i = 0; i < 9; i++)
+            keys[i] = kb + (cs_gnum_t)(ip*9 + i);
+          cs_random_normal_n(9, keys, &(vg[0][0]));
+        }
+        else {
+          for (cs_lnum_t id = 0; id < 3; id++) {
+            for (cs_lnum_t ivf = 0; ivf < 3; ivf++)
+              vg[id][ivf] = 0.0;
+          }
+        }
+        if (lamvbr == 1) {
+          kb |= (cs_gnum_t)1 << 32;
+          for (cs_lnum_t i = 0; i < 6; i++)
+            keys[i] = kb + (cs_gnum_t)(ip*6 + i);
+          cs_random_normal_n(6, keys, bg);
+        }
+      }
 
       for (cs_lnum_t id = 0; id < 3; id++) {
 
-        vitf = extra->vel->vals[1][cell_id * 3 + id];
+        cs_real_t vitf = extra->vel->vals[1][cell_id[ip] * 3 + id];
 
         /* --> (2.1) Calcul preliminaires :    */
         /* ----------------------------   */
@@ -179,8 +335,8 @@ _lages1(cs_real_t           dtp,
         /* --> (2.2) Calcul des coefficients/termes deterministes */
         /* ----------------------------------------------------    */
 
-        aux1 = exp(-dtp / taup[ip]);
-        aux2 = exp(-dtp / tlag[ip][id]);
+        aux1 = exp(-dts / taup[ip]);
+        aux2 = exp(-dts / tlag[ip][id]);
         aux3 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
         aux4 = tlag[ip][id] / (tlag[ip][id] + taup[ip]);
         aux5 = tlag[ip][id] * (1.0 - aux2);
@@ -191,30 +347,30 @@ _lages1(cs_real_t           dtp,
         /* --> trajectory terms */
         cs_real_t aa = taup[ip] * (1.0 - aux1);
         cs_real_t bb = (aux5 - aa) * aux3;
-        cs_real_t cc = dtp - aa - bb;
+        cs_real_t cc = dts - aa - bb;
 
-        ter1x = aa * old_part_vel[id];
-        ter2x = bb * old_part_vel_seen[id];
+        ter1x = aa * vp_o[id];
+        ter2x = bb * vs_o[id];
         ter3x = cc * tci;
-        ter4x = (dtp - aa) * force;
+        ter4x = (dts - aa) * force;
 
         /* --> flow-seen velocity terms   */
-        ter1f = old_part_vel_seen[id] * aux2;
+        ter1f = vs_o[id] * aux2;
         ter2f = tci * (1.0 - aux2);
 
         /* --> termes pour la vitesse des particules     */
         cs_real_t dd = aux3 * (aux2 - aux1);
         cs_real_t ee = 1.0 - aux1;
 
-        ter1p = old_part_vel[id] * aux1;
-        ter2p = old_part_vel_seen[id] * dd;
+        ter1p = vp_o[id] * aux1;
+        ter2p = vs_o[id] * dd;
         ter3p = tci * (ee - dd);
         ter4p = force * ee;
 
         /* --> integrale sur la vitesse du fluide vu     */
         gama2  = 0.5 * (1.0 - aux2 * aux2);
         p11   = sqrt(gama2 * aux6);
-        ter3f = p11 * vagaus[ip][id][0];
+        ter3f = p11 * vg[id][0];
 
         /* --> integral for the particles velocity  */
         aux9  = 0.5 * tlag[ip][id] * (1.0 - aux2 * aux2);
@@ -240,7 +396,7 @@ _lages1(cs_real_t           dtp,
 
         }
 
-        ter5p = p21 * vagaus[ip][id][0] + p22 * vagaus[ip][id][1];
+        ter5p = p21 * vg[id][0] + p22 * vg[id][1];
 
         /* --> (2.3) Calcul des coefficients pour les integrales stochastiques :  */
         /* --> integrale sur la position des particules  */
@@ -253,7 +409,7 @@ _lages1(cs_real_t           dtp,
                           - 0.5 * tlag[ip][id] * (1.0 - aux2 * aux2)
                           + cs_math_pow2(taup[ip]) / (tlag[ip][id] + taup[ip]) * (1.0 - aux1 * aux2)
                           ) * aux6;
-        omega2 =   aux7 * (aux7 * dtp - 2.0 * (tlag[ip][id] * aux5 - taup[ip] * aa))
+        omega2 =   aux7 * (aux7 * dts - 2.0 * (tlag[ip][id] * aux5 - taup[ip] * aa))
                  + 0.5 * tlag[ip][id] * tlag [ip][id] * aux5 * (1.0 + aux2)
                  + 0.5 * taup[ip] * taup[ip] * aa * (1.0 + aux1)
                  - 2.0 * aux4 * tlag[ip][id] * taup[ip] * taup[ip] * (1.0 - aux1* aux2);
@@ -271,72 +427,34 @@ _lages1(cs_real_t           dtp,
 
         p33 = omega2 - cs_math_pow2(p31) - cs_math_pow2(p32);
         p33 = sqrt(CS_MAX(0.0, p33));
-        ter5x = p31 * vagaus[ip][id][0] + p32 * vagaus[ip][id][1] + p33 * vagaus[ip][id][2];
+        ter5x = p31 * vg[id][0] + p32 * vg[id][1] + p33 * vg[id][2];
 
         /* --> (2.3) Calcul des Termes dans le cas du mouvement Brownien :   */
-        if (cs_glob_lagr_brownian->lamvbr == 1) {
-
-          /* Calcul de la temperature du fluide en fonction du type  */
-          /* d'ecoulement    */
-          cs_real_t tempf;
-          if (   cs_glob_physical_model_flag[CS_COMBUSTION_COAL] >= 0
-              || cs_glob_physical_model_flag[CS_COMBUSTION_PCLC] >= 0)
-            tempf = extra->t_gaz->val[cell_id];
-
-          else if (   cs_glob_physical_model_flag[CS_COMBUSTION_3PT] >= 0
-                   || cs_glob_physical_model_flag[CS_COMBUSTION_EBU] >= 0
-                   || cs_glob_physical_model_flag[CS_ELECTRIC_ARCS] >= 0
-                   || cs_glob_physical_model_flag[CS_JOULE_EFFECT] >= 0)
-            tempf = extra->temperature->val[cell_id];
-
-          else if (   cs_glob_thermal_model->itherm ==
-                              CS_THERMAL_MODEL_TEMPERATURE
-                   && cs_glob_thermal_model->itpscl ==
-                              CS_TEMPERATURE_SCALE_CELSIUS)
-            tempf = extra->scal_t->val[cell_id] + tkelvi;
-
-          else if (   cs_glob_thermal_model->itherm ==
-                              CS_THERMAL_MODEL_TEMPERATURE
-                   && cs_glob_thermal_model->itpscl ==
-                              CS_TEMPERATURE_SCALE_KELVIN)
-            tempf = extra->scal_t->val[cell_id];
-
-          else if (cs_glob_thermal_model->itherm == CS_THERMAL_MODEL_ENTHALPY) {
-
-            cs_lnum_t mode  = 1;
-            CS_PROCF (usthht,USTHHT) (&mode, &(extra->scal_t->val[cell_id]), &tempf);
-
-            tempf = tempf + tkelvi;
-
-          }
-
-          else
-            tempf = cs_glob_fluid_properties->t0;
+        if (lamvbr == 1) {
 
-          cs_real_t p_mass = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
+          cs_real_t ddbr = sqrt(  2.0 * _k_boltz * tempf[ip]
+                                / (p_mass[ip] * taup[ip]));
 
-          cs_real_t ddbr = sqrt(2.0 * _k_boltz * tempf / (p_mass * taup[ip]));
-
-          cs_real_t tix2 = cs_math_pow2((taup[ip] * ddbr)) * (dtp - taup[ip] * (1.0 - aux1) * (3.0 - aux1) / 2.0);
-          cs_real_t tiu2 = ddbr * ddbr * taup[ip] * (1.0 - exp( -2.0 * dtp / taup[ip])) / 2.0;
+          cs_real_t tix2 = cs_math_pow2((taup[ip] * ddbr)) * (dts - taup[ip] * (1.0 - aux1) * (3.0 - aux1) / 2.0);
+          cs_real_t tiu2 = ddbr * ddbr * taup[ip] * (1.0 - exp( -2.0 * dts / taup[ip])) / 2.0;
 
           cs_real_t tixiu  = cs_math_pow2((ddbr * taup[ip] * (1.0 - aux1))) / 2.0;
 
           tbrix2 = tix2 - (tixiu * tixiu) / tiu2;
 
           if (tbrix2 > 0.0)
-            tbrix2    = sqrt(tbrix2) * brgaus[ip * 6 + id];
+            tbrix2    = sqrt(tbrix2) * bg[id];
           else
             tbrix2    = 0.0;
 
           if (tiu2 > 0.0)
-            tbrix1    = tixiu / sqrt(tiu2) * brgaus[ip * 6 + id + 3];
+            tbrix1    = tixiu / sqrt(tiu2) * bg[id + 3];
           else
             tbrix1    = 0.0;
 
           if (tiu2 > 0.0) {
 
-            tbriu      = sqrt(tiu2) * brgaus[ip * 6 + id + 3];
+            tbriu      = sqrt(tiu2) * bg[id + 3];
             terbru[ip] = sqrt(tiu2);
 
           }
@@ -359,21 +477,54 @@ _lages1(cs_real_t           dtp,
         /* Finalisation des ecritures */
 
         /* --> trajectoire */
-        part_coords[id] = old_part_coords[id] + ter1x + ter2x + ter3x
-                                              + ter4x + ter5x + tbrix1 + tbrix2;
+        part_coords[ip][id] = xp_o[id]
+                            + ter1x + ter2x + ter3x
+                            + ter4x + ter5x + tbrix1 + tbrix2;
 
         /* --> vitesse fluide vu     */
-        part_vel_seen[id] = ter1f + ter2f + ter3f;
+        part_vel_seen[ip][id] = ter1f + ter2f + ter3f;
 
         /* --> vitesse particules    */
-        part_vel[id] = ter1p + ter2p + ter3p + ter4p + ter5p + tbriu;
+        part_vel[ip][id] = ter1p + ter2p + ter3p + ter4p + ter5p + tbriu;
 
       }
 
+      /* The state at the end of a substep is the starting point
+         of the next one */
+
+      if (i_sub < n_sub - 1) {
+        for (cs_lnum_t id = 0; id < 3; id++) {
+          vp_o[id] = part_vel[ip][id];
+          vs_o[id] = part_vel_seen[ip][id];
+          xp_o[id] = part_coords[ip][id];
+        }
+      }
+
+      }
 
     }
 
   }
+
+  /* Scatter updated values back to the main particle storage */
+
+  cs_lagr_particles_scatter_real(p_set, 0, CS_LAGR_VELOCITY,
+                                 (const cs_real_t *)part_vel);
+  cs_lagr_particles_scatter_real(p_set, 0, CS_LAGR_VELOCITY_SEEN,
+                                 (const cs_real_t *)part_vel_seen);
+  cs_lagr_particles_scatter_real(p_set, 0, CS_LAGR_COORDS,
+                                 (const cs_real_t *)part_coords);
+
+  BFT_FREE(p_mass);
+  BFT_FREE(tempf);
+
+  BFT_FREE(old_part_coords);
+  BFT_FREE(old_part_vel_seen);
+  BFT_FREE(old_part_vel);
+  BFT_FREE(part_coords);
+  BFT_FREE(part_vel_seen);
+  BFT_FREE(part_vel);
+  BFT_FREE(cell_id);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1207,6 +1358,8 @@ _lagesd(cs_real_t           dtp,
           p_set->n_part_resusp += 1;
           p_set->weight_resusp += p_stat_w;
 
+          cs_lagr_bound_stat_touch(n_f_id);
+
           if (cs_glob_lagr_boundary_interactions->iflmbd == 1) {
 
             bound_stat[n_f_id + nfabor * cs_glob_lagr_boundary_interactions->ires]
@@ -1322,6 +1475,8 @@ _lagesd(cs_real_t           dtp,
             if (cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG)
                 == CS_LAGR_PART_DEPOSITED ) {
 
+              cs_lagr_bound_stat_touch(n_f_id);
+
               bound_stat[n_f_id + nfabor * cs_glob_lagr_boundary_interactions->iscovc]
                 -=   cs_math_pi * cs_math_pow2(p_diam) * p_stat_w
                    * 0.25 / mq->b_f_face_surf[n_f_id];
@@ -1633,6 +1788,8 @@ _lagesd(cs_real_t           dtp,
           p_set->n_part_resusp += 1;
           p_set->weight_resusp += p_stat_w;
 
+          cs_lagr_bound_stat_touch(n_f_id);
+
           if (cs_glob_lagr_boundary_interactions->iflmbd == 1) {
 
             bound_stat[n_f_id + nfabor * cs_glob_lagr_boundary_interactions->ires]
@@ -1842,6 +1999,8 @@ _lagesd(cs_real_t           dtp,
                 cs_lagr_particle_set_lnum(particle, p_am, CS_LAGR_DEPOSITION_FLAG, 2);
 
                 /* Update of surface covered and deposit height */
+                cs_lagr_bound_stat_touch(n_f_id);
+
                 bound_stat[n_f_id + nfabor * cs_glob_lagr_boundary_interactions->iscovc] -=
                   cs_math_pi * cs_math_pow2(p_diam) * p_stat_w
                   * 0.25 / mq->b_f_face_surf[n_f_id];
@@ -1921,6 +2080,8 @@ _lagesd(cs_real_t           dtp,
                 cs_real_t d_stay = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_HEIGHT);
                 cs_lagr_particle_set_real(particle, p_am, CS_LAGR_HEIGHT, d_stay);
 
+                cs_lagr_bound_stat_touch(n_f_id);
+
                 bound_stat[n_f_id + nfabor * cs_glob_lagr_boundary_interactions->ihdepm] -=
                   cs_math_pi * height_reent * cs_math_pow2(p_diam) * p_stat_w
                   * 0.25 / mq->b_f_face_surf[n_f_id];
@@ -2442,8 +2603,16 @@ cs_lagr_sde(cs_real_t           dt_p,
       }
     }
     else {
-      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
-        cs_random_normal(9, &(vagaus[ip][0][0]));
+      /* batched, counter-based draw: keys combine the time step
+         and the local value index */
+      cs_lnum_t n_vals = p_set->n_particles * 9;
+      cs_gnum_t *keys;
+      BFT_MALLOC(keys, n_vals, cs_gnum_t);
+      cs_gnum_t key_base = (cs_gnum_t)(cs_glob_time_step->nt_cur) << 33;
+      for (cs_lnum_t i = 0; i < n_vals; i++)
+        keys[i] = key_base + (cs_gnum_t)i;
+      cs_random_normal_n(n_vals, keys, &(vagaus[0][0][0]));
+      BFT_FREE(keys);
     }
   }
 
@@ -2471,8 +2640,17 @@ cs_lagr_sde(cs_real_t           dt_p,
       }
     }
     else {
-      for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
-        cs_random_normal(6, &(brgaus[6 * ip]));
+      /* second sub-stream of the current time step (bit 32 set),
+         distinct from the one used for vagaus above */
+      cs_lnum_t n_vals = p_set->n_particles * 6;
+      cs_gnum_t *keys;
+      BFT_MALLOC(keys, n_vals, cs_gnum_t);
+      cs_gnum_t key_base =   ((cs_gnum_t)(cs_glob_time_step->nt_cur) << 33)
+                           | ((cs_gnum_t)1 << 32);
+      for (cs_lnum_t i = 0; i < n_vals; i++)
+        keys[i] = key_base + (cs_gnum_t)i;
+      cs_random_normal_n(n_vals, keys, brgaus);
+      BFT_FREE(keys);
     }
   }
 
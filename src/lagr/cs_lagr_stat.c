@@ -246,6 +246,38 @@ cs_lagr_stat_options_t *cs_glob_lagr_stat_options = &_lagr_stat_options;
  * Private functions definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute particle index bounds for a local thread.
+ *
+ * When called inside an OpenMP parallel section, this will return the
+ * start and past-the-end indexes for the particle range assigned to that
+ * thread. In other cases, the start index is 0, and the past-the-end
+ * index is n.
+ *
+ * parameters:
+ *   n    <-- number of particles
+ *   s_id --> start index for the current thread
+ *   e_id --> past-the-end index for the current thread
+ *----------------------------------------------------------------------------*/
+
+static void
+_thread_range(cs_lnum_t   n,
+              cs_lnum_t  *s_id,
+              cs_lnum_t  *e_id)
+{
+#if defined(HAVE_OPENMP)
+  int t_id = omp_get_thread_num();
+  int n_t = omp_get_num_threads();
+  cs_lnum_t t_n = (n + n_t - 1) / n_t;
+  *s_id =  t_id    * t_n;
+  *e_id = (t_id+1) * t_n;
+  if (*e_id > n) *e_id = n;
+#else
+  *s_id = 0;
+  *e_id = n;
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Particle data function computing unit value for mesh-based data
  *
@@ -1902,116 +1934,255 @@ _cs_lagr_stat_update_all(void)
               mean_val = f_mean->val;
             }
 
-            cs_real_t *pval = NULL;
+            /* Per-thread partial accumulators: each thread builds
+               partial moments over its particle range with the same
+               online updates, starting from a zero weight; partials
+               are then merged into the global arrays below. */
+
+            const cs_lnum_t dim = mt->dim;
+            const cs_lnum_t dim_m = mt->data_dim;
+
+            const int n_threads = cs_glob_n_threads;
+
+            cs_real_t *restrict t_wa_sum, *restrict t_val;
+            cs_real_t *restrict t_mean = NULL;
+            cs_real_t *t_pval = NULL;
+
+            BFT_MALLOC(t_wa_sum, (size_t)n_threads*n_w_elts, cs_real_t);
+            BFT_MALLOC(t_val, (size_t)n_threads*n_w_elts*dim, cs_real_t);
+            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
+              BFT_MALLOC(t_mean, (size_t)n_threads*n_w_elts*dim_m, cs_real_t);
             if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
+              BFT_MALLOC(t_pval, (size_t)n_threads*dim_m, cs_real_t);
+
+#           pragma omp parallel if (p_set->n_particles > CS_THR_MIN)
+            {
+              int t_id = 0;
+#if defined(HAVE_OPENMP)
+              t_id = omp_get_thread_num();
+#endif
+
+              cs_lnum_t s_p, e_p;
+              _thread_range(p_set->n_particles, &s_p, &e_p);
+
+              cs_real_t *restrict w_sum = t_wa_sum + (size_t)t_id*n_w_elts;
+              cs_real_t *restrict v_sum = t_val + (size_t)t_id*n_w_elts*dim;
+              cs_real_t *restrict m_sum
+                = (t_mean != NULL) ?
+                    t_mean + (size_t)t_id*n_w_elts*dim_m : NULL;
+
+              for (cs_lnum_t j = 0; j < n_w_elts; j++)
+                w_sum[j] = 0.;
+              for (cs_lnum_t j = 0; j < n_w_elts*dim; j++)
+                v_sum[j] = 0.;
+              if (m_sum != NULL) {
+                for (cs_lnum_t j = 0; j < n_w_elts*dim_m; j++)
+                  m_sum[j] = 0.;
+              }
+
+              cs_real_t *pval = NULL;
+              if (mt->p_data_func != NULL)
+                pval = t_pval + (size_t)t_id*dim_m;
+
+              for (cs_lnum_t part = s_p; part < e_p; part++) {
+
+                unsigned char *particle
+                  = p_set->p_buffer + p_set->p_am->extents * part;
+
+                cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle,
+                                                                 p_set->p_am);
+
+                int p_class = 0;
+                if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
+                  p_class = cs_lagr_particle_get_lnum(particle,
+                                                      p_set->p_am,
+                                                      CS_LAGR_STAT_CLASS);
+
+                if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
+
+                  /* weight associated to current particle */
+
+                  cs_real_t p_weight;
+
+                  if (mwa->p_data_func == NULL)
+                    p_weight = cs_lagr_particle_get_real(particle,
+                                                         p_set->p_am,
+                                                         CS_LAGR_STAT_WEIGHT);
+                  else
+                    mwa->p_data_func(mwa->data_input,
+                                     particle,
+                                     p_set->p_am,
+                                     &p_weight);
+                  p_weight *= dt_val[cell_id*dt_mult];
+
+                  if (mt->p_data_func == NULL)
+                    pval = cs_lagr_particle_attr(particle, p_set->p_am,
+                                                 attr_id);
+                  else
+                    mt->p_data_func(mt->data_input, particle, p_set->p_am,
+                                    pval);
+
+                  /* update weight sum with new particle weight */
+                  const cs_real_t wa_sum_n
+                    = CS_MAX(p_weight + w_sum[cell_id], 1e-100);
+
+                  if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+                    if (dim == 6) { /* variance-covariance matrix */
+
+                      assert(dim_m == 3);
+
+                      double delta[3], delta_n[3], r[3], m_n[3];
+
+                      for (int l = 0; l < 3; l++) {
+
+                        cs_lnum_t jl = cell_id*6 + l;
+                        cs_lnum_t jml = cell_id*3 + l;
+                        delta[l]   = pval[l] - m_sum[jml];
+                        r[l] = delta[l] * (p_weight / wa_sum_n);
+                        m_n[l] = m_sum[jml] + r[l];
+                        delta_n[l] = pval[l] - m_n[l];
+                        v_sum[jl] = (  v_sum[jl]*w_sum[cell_id]
+                                     + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+
+                      }
+
+                      /* Covariance terms.
+                         Note we could have a symmetric formula using
+                         0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+                         instead of
+                         delta[i]*delta_n[j]
+                         but unit tests in cs_moment_test.c do not seem to
+                         favor one variant over the other; we use the
+                         simplest one.  */
+
+                      cs_lnum_t j3 = cell_id*6 + 3,
+                                j4 = cell_id*6 + 4,
+                                j5 = cell_id*6 + 5;
+
+                      v_sum[j3] = (  v_sum[j3]*w_sum[cell_id]
+                                   + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+                      v_sum[j4] = (  v_sum[j4]*w_sum[cell_id]
+                                   + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+                      v_sum[j5] = (  v_sum[j5]*w_sum[cell_id]
+                                   + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
 
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
+                      /* update mean value */
 
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
+                      for (cs_lnum_t l = 0; l < 3; l++)
+                        m_sum[cell_id*3 + l] += r[l];
 
-              cs_lnum_t cell_id = cs_lagr_particle_get_cell_id(particle,
-                                                               p_set->p_am);
+                    }
 
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
+                    else { /* simple variance */
 
-              if (cell_id >= 0 && (p_class == mt->class || mt->class == 0)) {
+                      /* new weight for the cell: weight attached to
+                         current particle (=dt*weight) plus old weight */
 
-                /* weight associated to current particle */
+                      for (cs_lnum_t l = 0; l < dim; l++) {
 
-                cs_real_t p_weight;
+                        double delta = pval[l] - m_sum[cell_id*dim+l];
+                        double r = delta * (p_weight / wa_sum_n);
+                        double m_n = m_sum[cell_id*dim+l] + r;
 
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id*dt_mult];
+                        v_sum[cell_id*dim+l]
+                          = (  v_sum[cell_id*dim+l]*w_sum[cell_id]
+                             + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
 
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr(particle, p_set->p_am, attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
+                        /* update mean value */
 
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id], 1e-100);
+                        m_sum[cell_id*dim+l] += r;
 
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+                      }
 
-                  if (mt->dim == 6) { /* variance-covariance matrix */
+                    }
 
-                    assert(mt->data_dim == 3);
+                  }
 
-                    double delta[3], delta_n[3], r[3], m_n[3];
+                  else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
 
-                    for (int l = 0; l < 3; l++) {
+                    for (cs_lnum_t l = 0; l < dim; l++)
+                      v_sum[cell_id*dim+l] +=   (pval[l] - v_sum[cell_id*dim+l])
+                                              * p_weight / wa_sum_n;
 
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / wa_sum_n);
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+                  } /* End of test if moment is a variance or a mean */
 
-                    }
+                  /* update local weight associated to current
+                     moment and class */
 
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
+                  w_sum[cell_id] += p_weight;
 
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
+                } /* End of test if particle is in a cell
+                     and if particle class corresponds to moment class */
 
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+              } /* end of loop on particles */
 
-                    /* update mean value */
+            } /* end of OpenMP parallel section */
+
+            /* Merge per-thread partial moments into the global arrays,
+               using the pairwise combination of weighted moments
+               (Chan et al. update formulas) */
+
+            for (int t_id = 0; t_id < n_threads; t_id++) {
+
+              const cs_real_t *restrict w_sum
+                = t_wa_sum + (size_t)t_id*n_w_elts;
+              const cs_real_t *restrict v_sum
+                = t_val + (size_t)t_id*n_w_elts*dim;
+              const cs_real_t *restrict m_sum
+                = (t_mean != NULL) ?
+                    t_mean + (size_t)t_id*n_w_elts*dim_m : NULL;
+
+#             pragma omp parallel for if (n_w_elts > CS_THR_MIN)
+              for (cs_lnum_t j = 0; j < n_w_elts; j++) {
+
+                if (w_sum[j] <= 0.)
+                  continue;
+
+                const cs_real_t wa_sum_n
+                  = CS_MAX(w_sum[j] + l_wa_sum[j], 1e-100);
+                const cs_real_t ww = l_wa_sum[j] * (w_sum[j] / wa_sum_n);
+
+                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+                  if (dim == 6) { /* variance-covariance matrix */
+
+                    double delta[3], r[3];
+
+                    for (int l = 0; l < 3; l++) {
+                      delta[l] = m_sum[j*3 + l] - mean_val[j*3 + l];
+                      r[l] = delta[l] * (w_sum[j] / wa_sum_n);
+                      cs_lnum_t jl = j*6 + l;
+                      val[jl] = (  val[jl]*l_wa_sum[j]
+                                 + v_sum[jl]*w_sum[j]
+                                 + delta[l]*delta[l]*ww) / wa_sum_n;
+                    }
+
+                    cs_lnum_t j3 = j*6 + 3, j4 = j*6 + 4, j5 = j*6 + 5;
+
+                    val[j3] = (  val[j3]*l_wa_sum[j] + v_sum[j3]*w_sum[j]
+                               + delta[0]*delta[1]*ww) / wa_sum_n;
+                    val[j4] = (  val[j4]*l_wa_sum[j] + v_sum[j4]*w_sum[j]
+                               + delta[1]*delta[2]*ww) / wa_sum_n;
+                    val[j5] = (  val[j5]*l_wa_sum[j] + v_sum[j5]*w_sum[j]
+                               + delta[0]*delta[2]*ww) / wa_sum_n;
 
                     for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
+                      mean_val[j*3 + l] += r[l];
 
                   }
 
                   else { /* simple variance */
 
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
-
-                    const cs_lnum_t dim = mt->dim;
-
                     for (cs_lnum_t l = 0; l < dim; l++) {
 
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / wa_sum_n);
-                      double m_n = mean_val[cell_id*dim+l] + r;
+                      double delta = m_sum[j*dim + l] - mean_val[j*dim + l];
 
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+                      val[j*dim + l] = (  val[j*dim + l]*l_wa_sum[j]
+                                        + v_sum[j*dim + l]*w_sum[j]
+                                        + delta*delta*ww) / wa_sum_n;
 
-                      /* update mean value */
-
-                      mean_val[cell_id*dim+l] += r;
+                      mean_val[j*dim + l] += delta * (w_sum[j] / wa_sum_n);
 
                     }
 
@@ -2021,25 +2192,24 @@ _cs_lagr_stat_update_all(void)
 
                 else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
 
-                  const cs_lnum_t dim = mt->dim;
-
                   for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / wa_sum_n;
-
-                } /* End of test if moment is a variance or a mean */
+                    val[j*dim + l] +=   (v_sum[j*dim + l] - val[j*dim + l])
+                                      * w_sum[j] / wa_sum_n;
 
-                /* update local weight associated to current moment and class */
+                }
 
-                l_wa_sum[cell_id] += p_weight;
+                l_wa_sum[j] += w_sum[j];
 
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
+              }
 
-            } /* end of loop on particles */
+            } /* end of loop on threads */
 
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
+            BFT_FREE(t_wa_sum);
+            BFT_FREE(t_val);
+            if (t_mean != NULL)
+              BFT_FREE(t_mean);
+            if (t_pval != NULL)
+              BFT_FREE(t_pval);
 
             mt->nt_cur = ts->nt_cur;
             if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
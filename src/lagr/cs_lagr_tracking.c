@@ -201,6 +201,9 @@ typedef struct {
 #if defined(HAVE_MPI)
   MPI_Request  *request;
   MPI_Status   *status;
+
+  int           request_count; /* number of pending requests
+                                  (particle exchange in progress) */
 #endif
 
 } cs_lagr_halo_t;
@@ -522,6 +525,8 @@ _create_lagr_halo(size_t  extents)
     BFT_MALLOC(lagr_halo->request, request_size, MPI_Request);
     BFT_MALLOC(lagr_halo->status,  request_size, MPI_Status);
 
+    lagr_halo->request_count = 0;
+
   }
 #endif
 
@@ -933,6 +938,8 @@ _b_mass_contribution(const cs_lagr_particle_set_t   *particles,
       = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
     cs_real_t face_area = b_face_surf[neighbor_face_id];
 
+    cs_lagr_bound_stat_touch(neighbor_face_id);
+
     part_b_mass_flux[neighbor_face_id]
       += sign * cur_stat_weight * cur_mass / face_area;
 
@@ -1272,6 +1279,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       /* computation of the number of particles in contact with */
       /* the depositing particle                                */
 
+      cs_lagr_bound_stat_touch(face_id);
+
       surface_coverage = &bound_stat[cs_glob_lagr_boundary_interactions->iscovc * n_b_faces + face_id];
       deposit_height_mean = &bound_stat[cs_glob_lagr_boundary_interactions->ihdepm * n_b_faces + face_id];
       deposit_height_var = &bound_stat[cs_glob_lagr_boundary_interactions->ihdepv * n_b_faces + face_id];
@@ -1708,6 +1717,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
         particles->weight_fou += particle_stat_weight;
 
         /* Recording for statistics */
+        cs_lagr_bound_stat_touch(face_id);
         if (cs_glob_lagr_boundary_interactions->iencnbbd > 0) {
           bound_stat[  cs_glob_lagr_boundary_interactions->iencnb
                      * n_b_faces + face_id]
@@ -1852,6 +1862,8 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
        || b_type == CS_LAGR_REBOUND
        || b_type == CS_LAGR_FOULING) {
 
+    cs_lagr_bound_stat_touch(face_id);
+
     /* Number of particle-boundary interactions  */
     if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0)
       bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
@@ -2400,25 +2412,27 @@ _exchange_counter(const cs_halo_t  *halo,
 }
 
 /*----------------------------------------------------------------------------
- * Exchange particles
+ * Start exchange of particles: post non-blocking sends and receives.
+ *
+ * Received particles are placed after position n_particles_prev in the
+ * main particle buffer (the buffer has been resized accordingly by
+ * _lagr_halo_count), so local work such as compacting the particle
+ * set below that position may proceed while messages are in flight;
+ * the exchange is completed by _exchange_particles_end.
  *
  * parameters:
- *  halo      <-- pointer to a cs_halo_t structure
- *  lag_halo  <-> pointer to a cs_lagr_halo_t structure
- *  particles <-- set of particles to update
+ *  halo             <-- pointer to a cs_halo_t structure
+ *  lag_halo         <-> pointer to a cs_lagr_halo_t structure
+ *  particles        <-> set of particles to update
+ *  n_particles_prev <-- number of particles before compaction
  *----------------------------------------------------------------------------*/
 
 static void
-_exchange_particles(const cs_halo_t         *halo,
-                    cs_lagr_halo_t          *lag_halo,
-                    cs_lagr_particle_set_t  *particles)
+_exchange_particles_begin(const cs_halo_t         *halo,
+                          cs_lagr_halo_t          *lag_halo,
+                          cs_lagr_particle_set_t  *particles,
+                          cs_lnum_t                n_particles_prev)
 {
-  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
-
-  const size_t tot_extents = lag_halo->extents;
-
-  cs_lnum_t  n_recv_particles = 0;
-
 #if defined(HAVE_MPI)
 
   if (cs_glob_n_ranks > 1) {
@@ -2427,29 +2441,24 @@ _exchange_particles(const cs_halo_t         *halo,
     int  request_count = 0;
     const int  local_rank = cs_glob_rank_id;
 
+    const size_t tot_extents = lag_halo->extents;
+
     /* Receive data from distant ranks */
 
     for (rank = 0; rank < halo->n_c_domains; rank++) {
 
-      cs_lnum_t shift =   particles->n_particles
-                        + lag_halo->recv_shift[rank];
-
-      if (lag_halo->recv_count[rank] > 0) {
-
-        if (halo->c_domain_rank[rank] != local_rank) {
-          void  *recv_buf = particles->p_buffer + tot_extents*shift;
-          n_recv_particles += lag_halo->recv_count[rank];
-          MPI_Irecv(recv_buf,
-                    lag_halo->recv_count[rank],
-                    _cs_mpi_particle_type,
-                    halo->c_domain_rank[rank],
-                    halo->c_domain_rank[rank],
-                    cs_glob_mpi_comm,
-                    &(lag_halo->request[request_count++]));
-        }
-        else
-          local_rank_id = rank;
+      cs_lnum_t shift = n_particles_prev + lag_halo->recv_shift[rank];
 
+      if (   lag_halo->recv_count[rank] > 0
+          && halo->c_domain_rank[rank] != local_rank) {
+        void  *recv_buf = particles->p_buffer + tot_extents*shift;
+        MPI_Irecv(recv_buf,
+                  lag_halo->recv_count[rank],
+                  _cs_mpi_particle_type,
+                  halo->c_domain_rank[rank],
+                  halo->c_domain_rank[rank],
+                  cs_glob_mpi_comm,
+                  &(lag_halo->request[request_count++]));
       }
 
     }
@@ -2483,9 +2492,66 @@ _exchange_particles(const cs_halo_t         *halo,
 
     }
 
+    lag_halo->request_count = request_count;
+
+  }
+
+#else
+
+  CS_UNUSED(halo);
+  CS_UNUSED(lag_halo);
+  CS_UNUSED(particles);
+  CS_UNUSED(n_particles_prev);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Complete exchange of particles started by _exchange_particles_begin.
+ *
+ * Waits for all pending exchanges, handles local periodic copies, then
+ * moves received particles just after the (compacted) local particles
+ * and updates the particle count and weight.
+ *
+ * parameters:
+ *  halo             <-- pointer to a cs_halo_t structure
+ *  lag_halo         <-> pointer to a cs_lagr_halo_t structure
+ *  particles        <-> set of particles to update
+ *  n_particles_prev <-- number of particles before compaction
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_particles_end(const cs_halo_t         *halo,
+                        cs_lagr_halo_t          *lag_halo,
+                        cs_lagr_particle_set_t  *particles,
+                        cs_lnum_t                n_particles_prev)
+{
+  int local_rank_id = (cs_glob_n_ranks == 1) ? 0 : -1;
+
+  const size_t tot_extents = lag_halo->extents;
+
+  cs_lnum_t  n_recv_particles = 0;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const int  local_rank = cs_glob_rank_id;
+
+    for (int rank = 0; rank < halo->n_c_domains; rank++) {
+      if (lag_halo->recv_count[rank] > 0) {
+        if (halo->c_domain_rank[rank] != local_rank)
+          n_recv_particles += lag_halo->recv_count[rank];
+        else
+          local_rank_id = rank;
+      }
+    }
+
     /* Wait for all exchanges */
 
-    MPI_Waitall(request_count, lag_halo->request, lag_halo->status);
+    MPI_Waitall(lag_halo->request_count, lag_halo->request, lag_halo->status);
+
+    lag_halo->request_count = 0;
 
   }
 #endif /* defined(HAVE_MPI) */
@@ -2495,7 +2561,7 @@ _exchange_particles(const cs_halo_t         *halo,
   if (halo->n_transforms > 0) {
     if (local_rank_id > -1) {
 
-      cs_lnum_t  recv_shift =   particles->n_particles
+      cs_lnum_t  recv_shift =   n_particles_prev
                               + lag_halo->recv_shift[local_rank_id];
       cs_lnum_t  send_shift = lag_halo->send_shift[local_rank_id];
 
@@ -2512,6 +2578,14 @@ _exchange_particles(const cs_halo_t         *halo,
     }
   }
 
+  /* Move received particles just after the compacted local particles
+     (regions may overlap, so use memmove) */
+
+  if (particles->n_particles < n_particles_prev && n_recv_particles > 0)
+    memmove(particles->p_buffer + tot_extents*particles->n_particles,
+            particles->p_buffer + tot_extents*n_particles_prev,
+            tot_extents*((size_t)n_recv_particles));
+
   /* Update particle count and weight */
 
   cs_real_t tot_weight = 0.;
@@ -2653,17 +2727,16 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
     }
   }
 
-  /* Loop on particles, transferring particles to synchronize to send_buf
-     for particle set, and removing particles that otherwise exited the domain */
+  const cs_lnum_t n_particles_prev = particles->n_particles;
 
-  for (i = 0; i < particles->n_particles; i++) {
+  /* First loop on particles, transferring particles to synchronize to
+     send_buf */
+
+  for (i = 0; i < n_particles_prev; i++) {
 
     cs_lagr_tracking_state_t cur_part_state
       = _get_tracking_info(particles, i)->state;
 
-    cs_real_t cur_part_stat_weight
-      = cs_lagr_particles_get_real(particles, i, CS_LAGR_STAT_WEIGHT);
-
     /* Particle changes domain */
 
     if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
@@ -2809,6 +2882,33 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
     } /* TO_SYNC */
 
+  } /* End of first loop on particles */
+
+  /* Start particle exchange (non-blocking), so that the compaction of
+     the local particle set below overlaps with migration */
+
+  if (halo != NULL)
+    _exchange_particles_begin(halo, lag_halo, particles, n_particles_prev);
+
+  /* Second loop on particles: compact the particle set, removing sent
+     particles and particles that exited the domain */
+
+  for (i = 0; i < n_particles_prev; i++) {
+
+    cs_lagr_tracking_state_t cur_part_state
+      = _get_tracking_info(particles, i)->state;
+
+    cs_real_t cur_part_stat_weight
+      = cs_lagr_particles_get_real(particles, i, CS_LAGR_STAT_WEIGHT);
+
+    /* Particle changed domain (already packed for sending above) */
+
+    if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
+
+      /* Nothing more to do here */
+
+    }
+
     /* Particle remains in domain */
 
     else if (cur_part_state == CS_LAGR_PART_MERGED) {
@@ -2852,10 +2952,10 @@ _sync_particle_set(cs_lagr_particle_set_t  *particles)
 
   particles->n_part_merged += n_merged_particles;
 
-  /* Exchange particles, then update set */
+  /* Complete particle exchange, then update set */
 
   if (halo != NULL)
-    _exchange_particles(halo, lag_halo, particles);
+    _exchange_particles_end(halo, lag_halo, particles, n_particles_prev);
 
   cs_parall_max(1, CS_INT_TYPE, &continue_displacement);
 
@@ -3012,6 +3112,11 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
 /*----------------------------------------------------------------------------
  * Update particle set structures: compact array.
  *
+ * Particles are binned by current cell id (a counting sort), so that
+ * after each displacement stage, successive particles share cell
+ * geometry and field data; this keeps the tracking and integration
+ * loops cache-friendly however particles mix over time.
+ *
  * parameters:
  *   particles        <-> pointer to particle set structure
  *   part_b_mass_flux <-> particle mass flux array, or NULL
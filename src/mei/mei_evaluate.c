@@ -35,9 +35,15 @@
 #include <assert.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
+#if defined(HAVE_DLOPEN)
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -74,6 +80,143 @@ extern "C" {
 
 #define HASHSIZE 701
 
+/*!
+ * \brief Number of points handled per block by the array evaluation.
+ */
+
+#define MEI_BLOCK_SIZE 128
+
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Opcodes of the compiled form of an expression */
+
+typedef enum {
+
+  MEI_OP_CONST,    /* load an immediate constant */
+  MEI_OP_LOAD,     /* load a symbol (input array or symbol table value) */
+  MEI_OP_FUNC1,    /* function of one argument */
+  MEI_OP_FUNC2,    /* function of two arguments */
+  MEI_OP_ADD,
+  MEI_OP_SUB,
+  MEI_OP_MUL,
+  MEI_OP_DIV,
+  MEI_OP_POW,
+  MEI_OP_NEG,
+  MEI_OP_NOT,
+  MEI_OP_LT,
+  MEI_OP_GT,
+  MEI_OP_GE,
+  MEI_OP_LE,
+  MEI_OP_EQ,
+  MEI_OP_NE,
+  MEI_OP_AND,
+  MEI_OP_OR
+
+} mei_opcode_t;
+
+/* Register instruction: r[dst] = op(r[a], r[b])
+ *
+ * Each instruction writes a distinct register, so the number of registers
+ * equals the number of instructions (expressions built by the GUI are
+ * small, so no register reuse is needed). */
+
+typedef struct {
+
+  mei_opcode_t  op;      /* opcode */
+  int           r_a;     /* first operand register (-1 if unused) */
+  int           r_b;     /* second operand register (-1 if unused) */
+  double        imm;     /* immediate value (MEI_OP_CONST) */
+  struct item  *item;    /* symbol table record (MEI_OP_LOAD) */
+  int           in_id;   /* input array id, rebound at each array
+                            evaluation (MEI_OP_LOAD, -1 if scalar) */
+  func1_t       f1;      /* function pointer (MEI_OP_FUNC1) */
+  func2_t       f2;      /* function pointer (MEI_OP_FUNC2) */
+
+} mei_instr_t;
+
+#if defined(HAVE_DLOPEN)
+
+/* Prototype of a natively compiled expression: the variable symbols are
+   read from the "in" arrays, the other symbols from the "scal" array. */
+
+typedef void
+(mei_native_f_t)(int                   n,
+                 const double *const  *in,
+                 const double         *scal,
+                 double               *out);
+
+#endif
+
+/* Compiled (flat register bytecode) form of an expression */
+
+struct _mei_code_t {
+
+  int           compiled;    /* 1 if the expression could be compiled,
+                                0 if the node-based fallback must be used */
+  int           n_instr;     /* number of instructions (= registers) */
+  int           max_instr;   /* allocated instructions */
+  mei_instr_t  *instr;       /* instruction list, in evaluation order */
+  int           result_reg;  /* register holding the expression value,
+                                or -1 if the expression ends with a
+                                statement (value 0, as the interpreter) */
+
+  /* Symbols assigned inside the expression are mapped to registers at
+     compilation time; these arrays are only used during compilation. */
+
+  int           n_locals;
+  int           max_locals;
+  const char  **local_name;
+  int          *local_reg;
+
+#if defined(HAVE_DLOPEN)
+
+  /* Native (generated C, dlopened) form, built by
+     mei_tree_compile_native; NULL if not requested or not possible. */
+
+  mei_native_f_t  *native_f;     /* natively compiled function */
+  int              n_nat_vars;   /* number of bound variable symbols */
+  char           **nat_var_name; /* bound variable symbol names */
+  int              n_scal;       /* number of scalar symbols read at
+                                    each evaluation */
+  struct item    **scal_item;    /* records of the scalar symbols */
+
+#endif
+
+};
+
+#if defined(HAVE_DLOPEN)
+
+/* Cache of natively compiled expressions; identical expressions with the
+   same variable binding (GUI-defined expressions are often repeated over
+   several zones) are only compiled and loaded once. Handles are kept for
+   the whole run. */
+
+typedef struct {
+
+  char            *key;     /* expression string + variable binding */
+  void            *handle;  /* handle from dlopen */
+  mei_native_f_t  *f;       /* compiled function */
+
+} mei_native_cache_t;
+
+#endif
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+#if defined(HAVE_DLOPEN)
+
+/* Cache of natively compiled expressions */
+
+static int                  _native_cache_size = 0;
+static int                  _native_cache_max = 0;
+static mei_native_cache_t  *_native_cache = NULL;
+
+#endif
+
 /*=============================================================================
  * Specific pragmas to disable some unrelevant warnings
  *============================================================================*/
@@ -393,6 +536,693 @@ _evaluate(mei_node_t  *p)
   return 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append an instruction to a compiled expression.
+ *
+ * \param [in] c    compiled expression
+ * \param [in] op   opcode
+ * \param [in] r_a  first operand register, or -1
+ * \param [in] r_b  second operand register, or -1
+ * \return destination register of the new instruction
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_code_emit(struct _mei_code_t  *c,
+           mei_opcode_t         op,
+           int                  r_a,
+           int                  r_b)
+{
+  mei_instr_t *instr;
+
+  if (c->n_instr >= c->max_instr) {
+    c->max_instr = (c->max_instr == 0) ? 16 : c->max_instr*2;
+    BFT_REALLOC(c->instr, c->max_instr, mei_instr_t);
+  }
+
+  instr = c->instr + c->n_instr;
+
+  instr->op = op;
+  instr->r_a = r_a;
+  instr->r_b = r_b;
+  instr->imm = 0.;
+  instr->item = NULL;
+  instr->in_id = -1;
+  instr->f1 = NULL;
+  instr->f2 = NULL;
+
+  return c->n_instr++;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile a node of an interpreter to register bytecode.
+ *
+ * Returns the register holding the node value, -1 for a statement with
+ * no value (assignment), or -2 if the node cannot be compiled (control
+ * flow constructs), in which case the caller must fall back to the
+ * node-based interpreter.
+ *
+ * \param [in] c compiled expression under construction
+ * \param [in] p node of an interpreter
+ * \return register id, -1 (no value), or -2 (not compilable)
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_compile_node(struct _mei_code_t  *c,
+              mei_node_t          *p)
+{
+  int i, r, r_a, r_b;
+  struct item *item;
+
+  if (!p) return -2;
+
+  switch(p->flag) {
+
+  case CONSTANT:
+    r = _code_emit(c, MEI_OP_CONST, -1, -1);
+    c->instr[r].imm = p->type->con.value;
+    return r;
+
+  case ID:
+
+    /* A symbol assigned earlier in the expression refers to the register
+       holding its latest value; other symbols are read from the symbol
+       table or bound to an input array at evaluation time. */
+
+    for (i = c->n_locals-1; i >= 0; i--) {
+      if (strcmp(c->local_name[i], p->type->id.i) == 0)
+        return c->local_reg[i];
+    }
+
+    item = mei_hash_table_lookup(p->ht, p->type->id.i);
+    if (item == NULL)
+      return -2;
+
+    r = _code_emit(c, MEI_OP_LOAD, -1, -1);
+    c->instr[r].item = item;
+    return r;
+
+  case FUNC1:
+    item = mei_hash_table_lookup(p->ht, p->type->func.name);
+    if (item == NULL)
+      return -2;
+    r_a = _compile_node(c, p->type->func.op);
+    if (r_a < 0)
+      return -2;
+    r = _code_emit(c, MEI_OP_FUNC1, r_a, -1);
+    c->instr[r].f1 = item->data->func;
+    c->instr[r].item = item;
+    return r;
+
+  case FUNC2:
+    item = mei_hash_table_lookup(p->ht, p->type->funcx.name);
+    if (item == NULL)
+      return -2;
+    r_a = _compile_node(c, p->type->funcx.op[0]);
+    if (r_a < 0)
+      return -2;
+    r_b = _compile_node(c, p->type->funcx.op[1]);
+    if (r_b < 0)
+      return -2;
+    r = _code_emit(c, MEI_OP_FUNC2, r_a, r_b);
+    c->instr[r].f2 = item->data->f2;
+    c->instr[r].item = item;
+    return r;
+
+  case FUNC3:
+  case FUNC4:
+    return -2;
+
+  case OPR:
+
+    switch(p->type->opr.oper) {
+
+    case WHILE:
+    case IF:
+    case PRINT:
+
+      /* Per-point control flow is left to the node-based interpreter */
+
+      return -2;
+
+    case ';':
+      r = _compile_node(c, p->type->opr.op[0]);
+      if (r == -2)
+        return -2;
+      return _compile_node(c, p->type->opr.op[1]);
+
+    case '=':
+      r = _compile_node(c, p->type->opr.op[1]);
+      if (r < 0)
+        return -2;
+      if (c->n_locals >= c->max_locals) {
+        c->max_locals = (c->max_locals == 0) ? 8 : c->max_locals*2;
+        BFT_REALLOC(c->local_name, c->max_locals, const char *);
+        BFT_REALLOC(c->local_reg, c->max_locals, int);
+      }
+      c->local_name[c->n_locals] = p->type->opr.op[0]->type->id.i;
+      c->local_reg[c->n_locals] = r;
+      c->n_locals++;
+      return -1;
+
+    case UPLUS:
+      return _compile_node(c, p->type->opr.op[0]);
+
+    case UMINUS:
+      r_a = _compile_node(c, p->type->opr.op[0]);
+      if (r_a < 0)
+        return -2;
+      return _code_emit(c, MEI_OP_NEG, r_a, -1);
+
+    case '!':
+      r_a = _compile_node(c, p->type->opr.op[0]);
+      if (r_a < 0)
+        return -2;
+      return _code_emit(c, MEI_OP_NOT, r_a, -1);
+
+    default:
+      {
+        mei_opcode_t op;
+
+        switch(p->type->opr.oper) {
+        case '+': op = MEI_OP_ADD; break;
+        case '-': op = MEI_OP_SUB; break;
+        case '*': op = MEI_OP_MUL; break;
+        case '/': op = MEI_OP_DIV; break;
+        case '^': op = MEI_OP_POW; break;
+        case '<': op = MEI_OP_LT;  break;
+        case '>': op = MEI_OP_GT;  break;
+        case GE:  op = MEI_OP_GE;  break;
+        case LE:  op = MEI_OP_LE;  break;
+        case EQ:  op = MEI_OP_EQ;  break;
+        case NE:  op = MEI_OP_NE;  break;
+        case AND: op = MEI_OP_AND; break;
+        case OR:  op = MEI_OP_OR;  break;
+        default:
+          return -2;
+        }
+
+        r_a = _compile_node(c, p->type->opr.op[0]);
+        if (r_a < 0)
+          return -2;
+        r_b = _compile_node(c, p->type->opr.op[1]);
+        if (r_b < 0)
+          return -2;
+        return _code_emit(c, op, r_a, r_b);
+      }
+    }
+  }
+
+  return -2;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile the expression of an interpreter to register bytecode.
+ *
+ * The compiled form is always returned; if the expression contains
+ * constructs which cannot be compiled, its \em compiled member is 0 and
+ * the node-based interpreter must be used instead.
+ *
+ * \param [in] ev interpreter
+ * \return compiled expression
+ */
+/*----------------------------------------------------------------------------*/
+
+static struct _mei_code_t *
+_code_build(mei_tree_t  *ev)
+{
+  int r;
+  struct _mei_code_t *c = NULL;
+
+  BFT_MALLOC(c, 1, struct _mei_code_t);
+
+  c->compiled = 0;
+  c->n_instr = 0;
+  c->max_instr = 0;
+  c->instr = NULL;
+  c->result_reg = -1;
+  c->n_locals = 0;
+  c->max_locals = 0;
+  c->local_name = NULL;
+  c->local_reg = NULL;
+
+#if defined(HAVE_DLOPEN)
+  c->native_f = NULL;
+  c->n_nat_vars = 0;
+  c->nat_var_name = NULL;
+  c->n_scal = 0;
+  c->scal_item = NULL;
+#endif
+
+  r = _compile_node(c, ev->node);
+
+  if (r == -2) {
+    BFT_FREE(c->instr);
+    c->n_instr = 0;
+    c->max_instr = 0;
+  }
+  else {
+    c->result_reg = r;
+    c->compiled = 1;
+  }
+
+  /* The symbol/register map is only needed during compilation */
+
+  BFT_FREE(c->local_name);
+  BFT_FREE(c->local_reg);
+  c->n_locals = 0;
+  c->max_locals = 0;
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run a compiled expression over an array of evaluation points.
+ *
+ * Each opcode is applied to a whole block of points at a time, so inner
+ * loops are simple and vectorizable.
+ *
+ * \param [in]  c         compiled expression
+ * \param [in]  n_vars    number of variable symbols
+ * \param [in]  var_names names of the variable symbols
+ * \param [in]  var_vals  variable values, interleaved by variable
+ *                        (var_vals[i*n_points + j] for variable i, point j)
+ * \param [in]  n_points  number of evaluation points
+ * \param [out] results   expression value at each point
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_code_run(struct _mei_code_t  *c,
+          const int            n_vars,
+          const char         **var_names,
+          const double        *var_vals,
+          const int            n_points,
+          double              *results)
+{
+  int i, j, k, s;
+  double *r = NULL;
+
+  /* Bind loads to the input arrays; other symbols keep their current
+     symbol table value for the whole point set. */
+
+  for (i = 0; i < c->n_instr; i++) {
+    mei_instr_t *instr = c->instr + i;
+    if (instr->op == MEI_OP_LOAD) {
+      instr->in_id = -1;
+      for (j = 0; j < n_vars; j++) {
+        if (strcmp(instr->item->key, var_names[j]) == 0) {
+          instr->in_id = j;
+          break;
+        }
+      }
+    }
+  }
+
+  BFT_MALLOC(r, c->n_instr*MEI_BLOCK_SIZE, double);
+
+  for (s = 0; s < n_points; s += MEI_BLOCK_SIZE) {
+
+    const int n = (n_points - s < MEI_BLOCK_SIZE) ? n_points - s : MEI_BLOCK_SIZE;
+
+    for (i = 0; i < c->n_instr; i++) {
+
+      const mei_instr_t *instr = c->instr + i;
+      double *restrict rd = r + i*MEI_BLOCK_SIZE;
+      const double *restrict ra
+        = (instr->r_a > -1) ? r + instr->r_a*MEI_BLOCK_SIZE : NULL;
+      const double *restrict rb
+        = (instr->r_b > -1) ? r + instr->r_b*MEI_BLOCK_SIZE : NULL;
+
+      switch(instr->op) {
+
+      case MEI_OP_CONST:
+        for (k = 0; k < n; k++)
+          rd[k] = instr->imm;
+        break;
+
+      case MEI_OP_LOAD:
+        if (instr->in_id > -1) {
+          const double *v = var_vals + instr->in_id*n_points + s;
+          for (k = 0; k < n; k++)
+            rd[k] = v[k];
+        }
+        else {
+          const double v = instr->item->data->value;
+          for (k = 0; k < n; k++)
+            rd[k] = v;
+        }
+        break;
+
+      case MEI_OP_FUNC1:
+        for (k = 0; k < n; k++)
+          rd[k] = instr->f1(ra[k]);
+        break;
+
+      case MEI_OP_FUNC2:
+        for (k = 0; k < n; k++)
+          rd[k] = instr->f2(ra[k], rb[k]);
+        break;
+
+      case MEI_OP_ADD:
+        for (k = 0; k < n; k++)
+          rd[k] = ra[k] + rb[k];
+        break;
+
+      case MEI_OP_SUB:
+        for (k = 0; k < n; k++)
+          rd[k] = ra[k] - rb[k];
+        break;
+
+      case MEI_OP_MUL:
+        for (k = 0; k < n; k++)
+          rd[k] = ra[k] * rb[k];
+        break;
+
+      case MEI_OP_DIV:
+        for (k = 0; k < n; k++) {
+          if (rb[k] == 0.)
+            bft_error(__FILE__, __LINE__, 0,
+                      _("Error: floating point exception\n"));
+          rd[k] = ra[k] / rb[k];
+        }
+        break;
+
+      case MEI_OP_POW:
+        for (k = 0; k < n; k++)
+          rd[k] = pow(ra[k], rb[k]);
+        break;
+
+      case MEI_OP_NEG:
+        for (k = 0; k < n; k++)
+          rd[k] = -ra[k];
+        break;
+
+      case MEI_OP_NOT:
+        for (k = 0; k < n; k++)
+          rd[k] = ! (ra[k] != 0.);
+        break;
+
+      case MEI_OP_LT:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] < rb[k]);
+        break;
+
+      case MEI_OP_GT:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] > rb[k]);
+        break;
+
+      case MEI_OP_GE:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] >= rb[k]);
+        break;
+
+      case MEI_OP_LE:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] <= rb[k]);
+        break;
+
+      case MEI_OP_EQ:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] == rb[k]);
+        break;
+
+      case MEI_OP_NE:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] != rb[k]);
+        break;
+
+      case MEI_OP_AND:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] != 0. && rb[k] != 0.);
+        break;
+
+      case MEI_OP_OR:
+        for (k = 0; k < n; k++)
+          rd[k] = (ra[k] != 0. || rb[k] != 0.);
+        break;
+
+      }
+    }
+
+    if (c->result_reg > -1) {
+      const double *rr = r + c->result_reg*MEI_BLOCK_SIZE;
+      for (k = 0; k < n; k++)
+        results[s + k] = rr[k];
+    }
+    else {
+      for (k = 0; k < n; k++)
+        results[s + k] = 0.;
+    }
+
+  }
+
+  BFT_FREE(r);
+}
+
+#if defined(HAVE_DLOPEN)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the C name of a predefined function of the interpreter,
+ * or NULL if the function has no direct C equivalent.
+ *
+ * \param [in] name name of the function in the interpreter
+ * \return name of the function in C, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static const char *
+_native_func_name(const char  *name)
+{
+  static const char *names[] = { "exp",  "log",  "sqrt",
+                                 "sin",  "cos",  "tan",
+                                 "asin", "acos", "atan",
+                                 "sinh", "cosh", "tanh",
+                                 "atan2" };
+
+  size_t i;
+
+  for (i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+    if (strcmp(name, names[i]) == 0)
+      return names[i];
+  }
+
+  /* Functions whose C name differs from the interpreter name */
+
+  if (strcmp(name, "abs") == 0)
+    return "fabs";
+  else if (strcmp(name, "int") == 0)
+    return "floor";
+  else if (strcmp(name, "min") == 0)
+    return "fmin";
+  else if (strcmp(name, "max") == 0)
+    return "fmax";
+  else if (strcmp(name, "mod") == 0)
+    return "fmod";
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the C source equivalent to a compiled expression.
+ *
+ * The variable binding of the compiled expression (in_id of the load
+ * instructions and scalar symbol list) must have been set beforehand.
+ *
+ * \param [in] f    file to which the source is written
+ * \param [in] c    compiled expression
+ * \return 0 in case of success, 1 if the expression cannot be translated
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_native_generate(FILE                *f,
+                 struct _mei_code_t  *c)
+{
+  int i, i_scal = 0;
+
+  fprintf(f, "#include <math.h>\n\n"
+             "void\n"
+             "mei_expr_eval(int                   n,\n"
+             "              const double *const  *in,\n"
+             "              const double         *scal,\n"
+             "              double               *out)\n"
+             "{\n"
+             "  int i;\n"
+             "  for (i = 0; i < n; i++) {\n");
+
+  for (i = 0; i < c->n_instr; i++) {
+
+    const mei_instr_t *instr = c->instr + i;
+    const int a = instr->r_a, b = instr->r_b;
+
+    fprintf(f, "    const double r%d = ", i);
+
+    switch(instr->op) {
+
+    case MEI_OP_CONST:
+      fprintf(f, "%.17g;\n", instr->imm);
+      break;
+
+    case MEI_OP_LOAD:
+      if (instr->in_id > -1)
+        fprintf(f, "in[%d][i];\n", instr->in_id);
+      else
+        fprintf(f, "scal[%d];\n", i_scal++);
+      break;
+
+    case MEI_OP_FUNC1:
+      {
+        const char *name = _native_func_name(instr->item->key);
+        if (name == NULL)
+          return 1;
+        fprintf(f, "%s(r%d);\n", name, a);
+      }
+      break;
+
+    case MEI_OP_FUNC2:
+      {
+        const char *name = _native_func_name(instr->item->key);
+        if (name == NULL)
+          return 1;
+        fprintf(f, "%s(r%d, r%d);\n", name, a, b);
+      }
+      break;
+
+    case MEI_OP_ADD:
+      fprintf(f, "r%d + r%d;\n", a, b);
+      break;
+    case MEI_OP_SUB:
+      fprintf(f, "r%d - r%d;\n", a, b);
+      break;
+    case MEI_OP_MUL:
+      fprintf(f, "r%d * r%d;\n", a, b);
+      break;
+    case MEI_OP_DIV:
+      fprintf(f, "r%d / r%d;\n", a, b);
+      break;
+    case MEI_OP_POW:
+      fprintf(f, "pow(r%d, r%d);\n", a, b);
+      break;
+    case MEI_OP_NEG:
+      fprintf(f, "-r%d;\n", a);
+      break;
+    case MEI_OP_NOT:
+      fprintf(f, "(r%d == 0.);\n", a);
+      break;
+    case MEI_OP_LT:
+      fprintf(f, "(r%d < r%d);\n", a, b);
+      break;
+    case MEI_OP_GT:
+      fprintf(f, "(r%d > r%d);\n", a, b);
+      break;
+    case MEI_OP_GE:
+      fprintf(f, "(r%d >= r%d);\n", a, b);
+      break;
+    case MEI_OP_LE:
+      fprintf(f, "(r%d <= r%d);\n", a, b);
+      break;
+    case MEI_OP_EQ:
+      fprintf(f, "(r%d == r%d);\n", a, b);
+      break;
+    case MEI_OP_NE:
+      fprintf(f, "(r%d != r%d);\n", a, b);
+      break;
+    case MEI_OP_AND:
+      fprintf(f, "(r%d != 0. && r%d != 0.);\n", a, b);
+      break;
+    case MEI_OP_OR:
+      fprintf(f, "(r%d != 0. || r%d != 0.);\n", a, b);
+      break;
+
+    default:
+      return 1;
+    }
+  }
+
+  if (c->result_reg > -1)
+    fprintf(f, "    out[i] = r%d;\n", c->result_reg);
+  else
+    fprintf(f, "    out[i] = 0.;\n");
+
+  /* Unused register warnings are harmless in generated code */
+
+  fprintf(f, "  }\n"
+             "  (void)scal; (void)in;\n"
+             "}\n");
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile generated C source to a shared library and load the
+ * expression evaluation function from it.
+ *
+ * The C compiler may be selected through the CS_MEI_CC environment
+ * variable ("cc" by default).
+ *
+ * \param [in]  src_path path of the generated source file
+ * \param [out] handle   handle of the loaded library
+ * \return pointer to the loaded function, or NULL in case of failure
+ */
+/*----------------------------------------------------------------------------*/
+
+static mei_native_f_t *
+_native_load(const char   *src_path,
+             void        **handle)
+{
+  char *cmd = NULL, *lib_path = NULL;
+  size_t l;
+  const char *cc = getenv("CS_MEI_CC");
+  mei_native_f_t *f = NULL;
+
+  *handle = NULL;
+
+  if (cc == NULL)
+    cc = "cc";
+
+  l = strlen(src_path) + 4;
+  BFT_MALLOC(lib_path, l, char);
+  snprintf(lib_path, l, "%s", src_path);
+  strncpy(lib_path + strlen(src_path) - 2, ".so", 4);
+
+  l = strlen(cc) + strlen(src_path) + strlen(lib_path) + 64;
+  BFT_MALLOC(cmd, l, char);
+  snprintf(cmd, l, "%s -O2 -shared -fPIC -o %s %s -lm > /dev/null 2>&1",
+           cc, lib_path, src_path);
+
+  if (system(cmd) == 0) {
+    *handle = dlopen(lib_path, RTLD_LAZY);
+    if (*handle != NULL) {
+      f = (mei_native_f_t *)dlsym(*handle, "mei_expr_eval");
+      if (f == NULL) {
+        dlclose(*handle);
+        *handle = NULL;
+      }
+    }
+  }
+
+  /* The library mapping remains valid after unlink */
+
+  unlink(lib_path);
+
+  BFT_FREE(cmd);
+  BFT_FREE(lib_path);
+
+  return f;
+}
+
+#endif /* defined(HAVE_DLOPEN) */
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Store error message.
@@ -515,6 +1345,7 @@ mei_tree_new(const char *expr)
   ev->lines   = NULL;
   ev->labels  = NULL;
   ev->node    = NULL;
+  ev->code    = NULL;
 
   return ev;
 }
@@ -565,6 +1396,7 @@ mei_tree_new_with_shared_symbols(const char   *const expr,
   ev->lines   = NULL;
   ev->labels  = NULL;
   ev->node    = NULL;
+  ev->code    = NULL;
 
   return ev;
 }
@@ -860,6 +1692,271 @@ mei_evaluate(mei_tree_t  *ev)
   return _evaluate(ev->node);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluates the expression \em ev for an array of points.
+ *
+ * The expression is compiled to a flat register bytecode on first call,
+ * and each opcode is then run over the whole point set in vectorizable
+ * loops; expressions using control flow constructs (if, while, print)
+ * fall back to a point-by-point node evaluation.
+ *
+ * Symbols listed in \em var_names take their per-point values from
+ * \em var_vals; all other symbols keep their current value from the
+ * table of symbols.
+ *
+ * \param [in]  ev        interpreter
+ * \param [in]  n_vars    number of variable symbols
+ * \param [in]  var_names names of the variable symbols
+ * \param [in]  var_vals  variable values, interleaved by variable
+ *                        (var_vals[i*n_points + j] for variable i, point j)
+ * \param [in]  n_points  number of evaluation points
+ * \param [out] results   value of the interpreted expression at each point
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+mei_evaluate_n(mei_tree_t    *ev,
+               const int      n_vars,
+               const char   **var_names,
+               const double  *var_vals,
+               const int      n_points,
+               double        *results)
+{
+  int i, j;
+
+  assert(ev != NULL);
+
+  if (n_points < 1)
+    return;
+
+  if (ev->code == NULL)
+    ev->code = _code_build(ev);
+
+#if defined(HAVE_DLOPEN)
+
+  /* Use the natively compiled function if available and if the variable
+     binding matches the one given to mei_tree_compile_native */
+
+  if (ev->code->native_f != NULL && n_vars == ev->code->n_nat_vars) {
+
+    int binding_ok = 1;
+
+    for (i = 0; i < n_vars; i++) {
+      if (strcmp(var_names[i], ev->code->nat_var_name[i]) != 0) {
+        binding_ok = 0;
+        break;
+      }
+    }
+
+    if (binding_ok) {
+
+      const double **in = NULL;
+      double *scal = NULL;
+
+      if (n_vars > 0)
+        BFT_MALLOC(in, n_vars, const double *);
+      for (i = 0; i < n_vars; i++)
+        in[i] = var_vals + i*n_points;
+
+      if (ev->code->n_scal > 0)
+        BFT_MALLOC(scal, ev->code->n_scal, double);
+      for (i = 0; i < ev->code->n_scal; i++)
+        scal[i] = ev->code->scal_item[i]->data->value;
+
+      ev->code->native_f(n_points, in, scal, results);
+
+      BFT_FREE(in);
+      BFT_FREE(scal);
+
+      return;
+    }
+  }
+
+#endif
+
+  if (ev->code->compiled)
+    _code_run(ev->code, n_vars, var_names, var_vals, n_points, results);
+
+  else {
+
+    /* Fallback: point-by-point evaluation through the syntax tree */
+
+    for (j = 0; j < n_points; j++) {
+      for (i = 0; i < n_vars; i++)
+        mei_hash_table_insert(ev->symbol,
+                              var_names[i],
+                              CONSTANT,
+                              var_vals[i*n_points + j],
+                              NULL,
+                              NULL);
+      results[j] = _evaluate(ev->node);
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile the expression \em ev to native code for a given set of
+ * variable symbols.
+ *
+ * The expression is translated to C, compiled to a shared library, and
+ * loaded; subsequent calls to \ref mei_evaluate_n with the same variable
+ * symbols then run at native speed. Identical expressions with the same
+ * variable binding share a single compiled library. If native compilation
+ * is not possible (no dynamic loader support, no compiler available at run
+ * time, or control flow constructs in the expression), \ref mei_evaluate_n
+ * transparently keeps its bytecode or node-based path.
+ *
+ * Unlike the interpreter, natively compiled expressions follow IEEE
+ * semantics for division by zero instead of raising an error.
+ *
+ * \param [in] ev        interpreter
+ * \param [in] n_vars    number of variable symbols
+ * \param [in] var_names names of the variable symbols
+ * \return 0 if the expression is compiled natively, 1 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+mei_tree_compile_native(mei_tree_t   *ev,
+                        const int     n_vars,
+                        const char  **var_names)
+{
+#if defined(HAVE_DLOPEN)
+
+  int i, j;
+  size_t l;
+  char *key = NULL;
+  struct _mei_code_t *c = NULL;
+
+  static int _native_id = 0;
+
+  assert(ev != NULL);
+
+  if (ev->code == NULL)
+    ev->code = _code_build(ev);
+
+  c = ev->code;
+
+  if (c->native_f != NULL)
+    return 0;
+
+  if (c->compiled == 0)
+    return 1;
+
+  /* Bind loads to the variable symbols and build the list of scalar
+     symbols read at each evaluation */
+
+  BFT_FREE(c->scal_item);
+  c->n_scal = 0;
+
+  for (i = 0; i < c->n_instr; i++) {
+    mei_instr_t *instr = c->instr + i;
+    if (instr->op == MEI_OP_LOAD) {
+      instr->in_id = -1;
+      for (j = 0; j < n_vars; j++) {
+        if (strcmp(instr->item->key, var_names[j]) == 0) {
+          instr->in_id = j;
+          break;
+        }
+      }
+      if (instr->in_id < 0) {
+        BFT_REALLOC(c->scal_item, c->n_scal+1, struct item *);
+        c->scal_item[c->n_scal] = instr->item;
+        c->n_scal++;
+      }
+    }
+  }
+
+  /* Search the cache for an identical expression with the same binding */
+
+  l = strlen(ev->string) + 1;
+  for (i = 0; i < n_vars; i++)
+    l += strlen(var_names[i]) + 1;
+
+  BFT_MALLOC(key, l, char);
+  strcpy(key, ev->string);
+  for (i = 0; i < n_vars; i++) {
+    strcat(key, "\n");
+    strcat(key, var_names[i]);
+  }
+
+  for (i = 0; i < _native_cache_size; i++) {
+    if (strcmp(_native_cache[i].key, key) == 0) {
+      c->native_f = _native_cache[i].f;
+      BFT_FREE(key);
+      break;
+    }
+  }
+
+  /* Generate, compile, and load the expression if not cached */
+
+  if (c->native_f == NULL) {
+
+    char src_path[64];
+    FILE *f;
+    void *handle = NULL;
+    mei_native_f_t *nf = NULL;
+
+    snprintf(src_path, 64, "./mei_native_p%d_%d.c",
+             (int)getpid(), _native_id++);
+
+    f = fopen(src_path, "w");
+
+    if (f != NULL) {
+      int retcode = _native_generate(f, c);
+      if (fclose(f) != 0)
+        retcode = 1;
+      if (retcode == 0)
+        nf = _native_load(src_path, &handle);
+      unlink(src_path);
+    }
+
+    if (nf == NULL) {
+      BFT_FREE(key);
+      return 1;
+    }
+
+    if (_native_cache_size >= _native_cache_max) {
+      _native_cache_max = (_native_cache_max == 0) ? 8 : _native_cache_max*2;
+      BFT_REALLOC(_native_cache, _native_cache_max, mei_native_cache_t);
+    }
+
+    _native_cache[_native_cache_size].key = key;
+    _native_cache[_native_cache_size].handle = handle;
+    _native_cache[_native_cache_size].f = nf;
+    _native_cache_size++;
+
+    c->native_f = nf;
+  }
+
+  /* Save the variable binding for coherency checks at evaluation */
+
+  c->n_nat_vars = n_vars;
+  if (n_vars > 0)
+    BFT_MALLOC(c->nat_var_name, n_vars, char *);
+  for (i = 0; i < n_vars; i++) {
+    l = strlen(var_names[i]) + 1;
+    BFT_MALLOC(c->nat_var_name[i], l, char);
+    strncpy(c->nat_var_name[i], var_names[i], l);
+  }
+
+  return 0;
+
+#else
+
+  CS_UNUSED(n_vars);
+  CS_UNUSED(var_names);
+
+  assert(ev != NULL);
+
+  return 1;
+
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free memory and return NULL.
@@ -884,6 +1981,18 @@ mei_tree_destroy(mei_tree_t  *ev)
     BFT_FREE(ev->string);
     mei_free_node(ev->node);
 
+    if (ev->code != NULL) {
+#if defined(HAVE_DLOPEN)
+      /* library handles are owned by the expression cache */
+      for (i = 0; i < ev->code->n_nat_vars; i++)
+        BFT_FREE(ev->code->nat_var_name[i]);
+      BFT_FREE(ev->code->nat_var_name);
+      BFT_FREE(ev->code->scal_item);
+#endif
+      BFT_FREE(ev->code->instr);
+      BFT_FREE(ev->code);
+    }
+
     for (i=0; i < ev->errors; i++)
       BFT_FREE(ev->labels[i]);
 
@@ -46,6 +46,12 @@ extern "C" {
  * Type definitions
  *============================================================================*/
 
+/*!
+ * \brief Compiled (bytecode) form of an expression (opaque)
+ */
+
+struct _mei_code_t;
+
 /*!
  * \brief Structure defining an interpreter for a mathematical expression
  */
@@ -58,6 +64,8 @@ struct _mei_tree_t {
   char         **labels;  /*!< Array of the error description                   */
   hash_table_t  *symbol;  /*!< Table of symbols                                 */
   mei_node_t    *node;    /*!< Root node of the interpreter                     */
+  struct _mei_code_t  *code;  /*!< Compiled form (built on first array
+                                evaluation, may be NULL)                       */
 };
 
 /*!
@@ -208,6 +216,64 @@ mei_tree_lookup(mei_tree_t  *ev,
 double
 mei_evaluate(mei_tree_t  *ev);
 
+/*----------------------------------------------------------------------------
+ * Evaluates the expression for an array of points.
+ *
+ * The expression is compiled to a flat register bytecode on the first call,
+ * then each opcode is run over the whole point set in vectorizable loops;
+ * expressions using control flow constructs (if, while, print) fall back to
+ * a point-by-point evaluation through the syntax tree.
+ *
+ * Symbols listed in var_names take their per-point values from var_vals;
+ * all other symbols keep their current value from the table of symbols.
+ *
+ * parameters:
+ *   ev        <-- interpreter
+ *   n_vars    <-- number of variable symbols
+ *   var_names <-- names of the variable symbols
+ *   var_vals  <-- variable values, interleaved by variable
+ *                 (var_vals[i*n_points + j] for variable i, point j)
+ *   n_points  <-- number of evaluation points
+ *   results   --> value of the interpreted expression at each point
+ *----------------------------------------------------------------------------*/
+
+void
+mei_evaluate_n(mei_tree_t    *ev,
+               const int      n_vars,
+               const char   **var_names,
+               const double  *var_vals,
+               const int      n_points,
+               double        *results);
+
+/*----------------------------------------------------------------------------
+ * Compiles the expression to native code for a given set of variable
+ * symbols.
+ *
+ * The expression is translated to C, compiled to a shared library, and
+ * loaded; subsequent calls to mei_evaluate_n with the same variable symbols
+ * then run at native speed. Identical expressions with the same variable
+ * binding share a single compiled library. If native compilation is not
+ * possible (no dynamic loader support, no compiler available at run time,
+ * or control flow constructs in the expression), mei_evaluate_n
+ * transparently keeps its bytecode or node-based path.
+ *
+ * The C compiler may be selected through the CS_MEI_CC environment
+ * variable ("cc" by default).
+ *
+ * parameters:
+ *   ev        <-- interpreter
+ *   n_vars    <-- number of variable symbols
+ *   var_names <-- names of the variable symbols
+ *
+ * returns:
+ *   0 if the expression is compiled natively, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+int
+mei_tree_compile_native(mei_tree_t   *ev,
+                        const int     n_vars,
+                        const char  **var_names);
+
 /*----------------------------------------------------------------------------
  * Free memory and return NULL.
  *
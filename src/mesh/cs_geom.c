@@ -76,6 +76,11 @@ BEGIN_C_DECLS
 #define HUGE_VAL 1.0e+30
 #endif
 
+/* Block size for batched segment/face intersection tests; blocks use
+   fixed-size local work arrays, small enough to stay cache-resident */
+
+#define CS_GEOM_BATCH_SIZE 64
+
 /*============================================================================
  * Static global variables
  *===========================================================================*/
@@ -135,6 +140,45 @@ _test_edge(const cs_real_t  sx0[3],
   return (cs_math_3_dot_product(disp, p) > 0 ? 1 : -1);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the signed volume of the parallelepiped tested by _test_edge,
+ * given a precomputed segment displacement.
+ *
+ * Branch-free variant used by the batched intersection tests, so the
+ * calling loops over segments may be vectorized.
+ *
+ * parameters:
+ *   sx0    <-- Previous location of the particle
+ *   disp   <-- Displacement of the particle (sx1 - sx0)
+ *   vtx_0  <-- First vertex of the edge (sorted by index)
+ *   vtx_1  <-- Second vertex of the edge (sorted by index)
+ *
+ * returns:
+ *   the signed volume (positive or negative as in _test_edge)
+ *----------------------------------------------------------------------------*/
+
+inline static cs_real_t
+_edge_orient_vol(const cs_real_t  sx0[3],
+                 const cs_real_t  disp[3],
+                 const cs_real_t  vtx_0[3],
+                 const cs_real_t  vtx_1[3])
+{
+  const cs_real_t vO[3] = {sx0[0] - vtx_0[0],
+                           sx0[1] - vtx_0[1],
+                           sx0[2] - vtx_0[2]};
+
+  const cs_real_t edge[3] = {vtx_1[0] - vtx_0[0],
+                             vtx_1[1] - vtx_0[1],
+                             vtx_1[2] - vtx_0[2]};
+
+  /* p = edge ^ vO */
+  const cs_real_t p[3] = {edge[1]*vO[2] - edge[2]*vO[1],
+                          edge[2]*vO[0] - edge[0]*vO[2],
+                          edge[0]*vO[1] - edge[1]*vO[0]};
+
+  return disp[0]*p[0] + disp[1]*p[1] + disp[2]*p[2];
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -418,6 +462,227 @@ cs_geom_segment_intersect_face(int              orient,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a batch of line segments intersect a given face.
+ *
+ * This function produces the same results as calling
+ * \ref cs_geom_segment_intersect_face once per segment, but computes the
+ * orientation predicates (signed volumes) for all segments of a block in
+ * simple inner loops which may be vectorized by the compiler, with the
+ * face sub-triangle geometry factorized out of the per-segment work.
+ *
+ * If the orient parameter is set to -1 or 1, intersection is only
+ * considered when (sx1-sx0).normal.orient > 0.
+ * If set to 0, intersection is considered in both cases.
+ *
+ * \param[in]      orient       if -1 or 1, multiplies face_normal to check
+ *                              for segment
+ * \param[in]      n_vertices   number of face vertices
+ * \param[in]      vertex_ids   ids of face vertices
+ * \param[in]      vtx_coord    vertex coordinates
+ * \param[in]      face_cog     coordinates of face center
+ * \param[in]      n_segments   number of segments to test
+ * \param[in]      sx0          segment start coordinates
+ * \param[in]      sx1          segment end coordinates
+ * \param[out]     t_intersect  for each segment, 2 if it does not go
+ *                              through the face's plane, or minimum
+ *                              relative distance (in terms of segment
+ *                              length) of intersection point to face
+ * \param[in, out] n_crossings  number of sub-face crossings for each
+ *                              segment [0: in; 1: out], incremented
+ * \param[in, out] face_norm    local face unit normal of the crossed
+ *                              sub-triangle for each segment, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_geom_segment_intersect_face_batch(int              orient,
+                                     cs_lnum_t        n_vertices,
+                                     const cs_lnum_t  vertex_ids[],
+                                     const cs_real_t  vtx_coord[][3],
+                                     const cs_real_t  face_cog[3],
+                                     cs_lnum_t        n_segments,
+                                     const cs_real_t  sx0[][3],
+                                     const cs_real_t  sx1[][3],
+                                     cs_real_t        t_intersect[],
+                                     int              n_crossings[][2],
+                                     cs_real_t        face_norm[][3])
+{
+  const double epsilon = 1.e-15;
+
+  assert(sizeof(cs_real_t) == 8);
+
+  /* Loop on blocks of segments */
+
+  for (cs_lnum_t s_id_0 = 0; s_id_0 < n_segments;
+       s_id_0 += CS_GEOM_BATCH_SIZE) {
+
+    const cs_lnum_t n_b = CS_MIN(CS_GEOM_BATCH_SIZE, n_segments - s_id_0);
+
+    cs_real_t  disp[CS_GEOM_BATCH_SIZE][3], vgo[CS_GEOM_BATCH_SIZE][3];
+    cs_real_t  od_p[CS_GEOM_BATCH_SIZE], og_p[CS_GEOM_BATCH_SIZE];
+    cs_real_t  w_vol[CS_GEOM_BATCH_SIZE];
+    int  p0[CS_GEOM_BATCH_SIZE], pi[CS_GEOM_BATCH_SIZE];
+    int  pip1[CS_GEOM_BATCH_SIZE], n_intersects[CS_GEOM_BATCH_SIZE];
+
+    const cs_real_t  *vtx_0 = vtx_coord[vertex_ids[0]];
+    const cs_real_t  *vtx_1;
+
+    for (cs_lnum_t s = 0; s < n_b; s++) {
+      const cs_lnum_t s_id = s_id_0 + s;
+      for (int j = 0; j < 3; j++) {
+        disp[s][j] = sx1[s_id][j] - sx0[s_id][j];
+        vgo[s][j] = sx0[s_id][j] - face_cog[j];
+      }
+      n_intersects[s] = 0;
+      t_intersect[s_id] = 2.;
+    }
+
+    /* 1st vertex: vector e0, p0 = e0 ^ vgo */
+
+    for (cs_lnum_t s = 0; s < n_b; s++)
+      p0[s] = (  _edge_orient_vol(sx0[s_id_0 + s], disp[s], face_cog, vtx_0)
+               > 0 ? 1 : -1);
+
+    memcpy(pip1, p0, n_b*sizeof(int));
+
+    /* Loop on vertices of the face */
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+
+      cs_real_3_t e0, e1;
+
+      cs_lnum_t vtx_id_0 = vertex_ids[i];
+      cs_lnum_t vtx_id_1 = vertex_ids[(i+1)%n_vertices];
+
+      vtx_0 = vtx_coord[vtx_id_0];
+      vtx_1 = vtx_coord[vtx_id_1];
+      for (int j = 0; j < 3; j++) {
+        e0[j] = vtx_0[j] - face_cog[j];
+        e1[j] = vtx_1[j] - face_cog[j];
+      }
+
+      /* P = e1^e0: same value for the two neighbooring cells */
+
+      const cs_real_3_t pvec = {e1[1]*e0[2] - e1[2]*e0[1],
+                                e1[2]*e0[0] - e1[0]*e0[2],
+                                e1[0]*e0[1] - e1[1]*e0[0]};
+
+      const double det = cs_math_3_norm(e0)*cs_math_3_norm(pvec);
+
+      /* Check the orientation of the 3rd edge (vector e_out), and sort its
+       * vertices so that it gives the same answer for the same edge for
+       * another face */
+
+      const int reorient_edge = (vtx_id_0 < vtx_id_1 ? 1 : -1);
+
+      const cs_real_t  *evtx_0 = (reorient_edge == 1) ? vtx_0 : vtx_1;
+      const cs_real_t  *evtx_1 = (reorient_edge == 1) ? vtx_1 : vtx_0;
+
+      /* Orientation predicates for all segments of the block */
+
+      memcpy(pi, pip1, n_b*sizeof(int));
+
+      if (i == n_vertices - 1)
+        memcpy(pip1, p0, n_b*sizeof(int));
+      else {
+        for (cs_lnum_t s = 0; s < n_b; s++)
+          pip1[s] = (  _edge_orient_vol(sx0[s_id_0 + s], disp[s],
+                                        face_cog, vtx_1)
+                     > 0 ? 1 : -1);
+      }
+
+      for (cs_lnum_t s = 0; s < n_b; s++) {
+        od_p[s] =   disp[s][0]*pvec[0]
+                  + disp[s][1]*pvec[1]
+                  + disp[s][2]*pvec[2];
+        og_p[s] = - (  vgo[s][0]*pvec[0]
+                     + vgo[s][1]*pvec[1]
+                     + vgo[s][2]*pvec[2]);
+        w_vol[s] = _edge_orient_vol(sx0[s_id_0 + s], disp[s], evtx_0, evtx_1);
+      }
+
+      /* Resolve crossings for each segment of the block */
+
+      for (cs_lnum_t s = 0; s < n_b; s++) {
+
+        const cs_lnum_t s_id = s_id_0 + s;
+
+        /* This sign is absolute (ie same result is obtained if the face is
+         * seen from the other neighbooring cell). */
+        const int sign_od_p = (od_p[s] > 0 ? 1 : -1);
+
+        const int u_sign = pip1[s] * sign_od_p;
+        const int v_sign = - pi[s] * sign_od_p;
+        const int w_sign = (w_vol[s] > 0 ? 1 : -1)
+                           * reorient_edge * sign_od_p;
+
+        /* The projection of point O along displacement (OD) is outside of
+         * the triangle then no intersection */
+        if (w_sign > 0 || u_sign < 0 || v_sign < 0)
+          continue;
+
+        /* Line (OD) intersects the triangle because
+         * u_sign >= 0, v_sign >= 0 and w_sign <= 0 */
+
+        const int sign_og_p = (og_p[s] > 0 ? 1 : -1);
+
+        /* Same sign (meaning there is a possible intersection with t > 0). */
+        if (sign_od_p == sign_og_p) {
+          /* The line (OD) enters (n_crossings[0]++)
+           * or leaves (n_crossings[1]++) the cell */
+          if (orient != sign_od_p) {
+            n_crossings[s_id][1]++;
+            if (fabs(og_p[s]) < fabs(od_p[s])) {
+              /* There is a real intersection (outward) with 0 <= t < 1 */
+              double t = 0.;
+              n_intersects[s]++;
+
+              if (fabs(od_p[s]) > epsilon * fabs(det))
+                t = og_p[s] / od_p[s];
+
+              if (t < t_intersect[s_id]) {
+                t_intersect[s_id] = t;
+                /* Store the normal if needed */
+                if (face_norm != NULL)
+                  cs_math_3_normalise(pvec, face_norm[s_id]);
+              }
+            }
+          } else {
+            n_crossings[s_id][0]++;
+            /* Incomming intersection on segment [OD] */
+            if (fabs(og_p[s]) < fabs(od_p[s]))
+              n_intersects[s]--;
+          }
+
+        } else {
+          /* Opposite sign (meaning there is a possible intersection of the
+           * line with t < 0). */
+          if (orient != sign_od_p)
+            n_crossings[s_id][1]++;
+          else
+            n_crossings[s_id][0]++;
+        }
+
+      } /* End of loop on segments of the block */
+
+    } /* End of loop on vertices of the face */
+
+    /* In case intersections were removed due to non-convex cases
+     *  (i.e. n_intersects < 1, but t < 1), the returned value is forced
+     *  to 2 (no intersection since the segment entered and left from
+     *  this face). */
+
+    for (cs_lnum_t s = 0; s < n_b; s++) {
+      const cs_lnum_t s_id = s_id_0 + s;
+      if (n_intersects[s] < 1 && t_intersect[s_id] < 1.)
+        t_intersect[s_id] = 2.;
+    }
+
+  } /* End of loop on blocks of segments */
+}
+
 /*---------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -126,6 +126,53 @@ cs_geom_segment_intersect_face(int              orient,
                                int              n_crossings[2],
                                cs_real_t        *face_norm);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Test if a batch of line segments intersect a given face.
+ *
+ * This function produces the same results as calling
+ * \ref cs_geom_segment_intersect_face once per segment, but computes the
+ * orientation predicates for all segments of a block in simple inner
+ * loops which may be vectorized by the compiler, with the face
+ * sub-triangle geometry factorized out of the per-segment work.
+ *
+ * If the orient parameter is set to -1 or 1, intersection is only
+ * considered when (sx1-sx0).normal.orient > 0.
+ * If set to 0, intersection is considered in both cases.
+ *
+ * \param[in]      orient       if -1 or 1, multiplies face_normal to check
+ *                              for segment
+ * \param[in]      n_vertices   number of face vertices
+ * \param[in]      vertex_ids   ids of face vertices
+ * \param[in]      vtx_coord    vertex coordinates
+ * \param[in]      face_cog     coordinates of face center
+ * \param[in]      n_segments   number of segments to test
+ * \param[in]      sx0          segment start coordinates
+ * \param[in]      sx1          segment end coordinates
+ * \param[out]     t_intersect  for each segment, 2 if it does not go
+ *                              through the face's plane, or minimum
+ *                              relative distance (in terms of segment
+ *                              length) of intersection point to face
+ * \param[in, out] n_crossings  number of sub-face crossings for each
+ *                              segment [0: in; 1: out], incremented
+ * \param[in, out] face_norm    local face unit normal of the crossed
+ *                              sub-triangle for each segment, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_geom_segment_intersect_face_batch(int              orient,
+                                     cs_lnum_t        n_vertices,
+                                     const cs_lnum_t  vertex_ids[],
+                                     const cs_real_t  vtx_coord[][3],
+                                     const cs_real_t  face_cog[3],
+                                     cs_lnum_t        n_segments,
+                                     const cs_real_t  sx0[][3],
+                                     const cs_real_t  sx1[][3],
+                                     cs_real_t        t_intersect[],
+                                     int              n_crossings[][2],
+                                     cs_real_t        face_norm[][3]);
+
 /*---------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -77,6 +77,15 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Static global variables
+ *===========================================================================*/
+
+/* Out-of-core mode: spill structures which are not needed during the
+   memory peak of the intersection search to per-rank scratch files */
+
+static bool  _cs_join_out_of_core = false;
+
 /*============================================================================
  * Private function definitions
  *===========================================================================*/
@@ -1679,6 +1688,24 @@ cs_join_set_advanced_param(int      join_num,
                       tmr_distrib);
 }
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate out-of-core mode for joining operations.
+ *
+ * In this mode, structures which are not needed during the memory peak of
+ * the intersection search are spilled to per-rank scratch files, reducing
+ * the footprint of joinings on very large meshes at the cost of additional
+ * I/O.
+ *
+ * parameters:
+ *   active <-- true to activate out-of-core mode, false to deactivate it
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_set_out_of_core(bool  active)
+{
+  _cs_join_out_of_core = active;
+}
+
 /*----------------------------------------------------------------------------
  * Apply all the defined joining operations.
  *
@@ -1787,6 +1814,21 @@ cs_join_all(bool  preprocess)
         bft_printf(_("\n  Number of faces to treat locally: %10d\n"),
                    work_jmesh->n_faces);
 
+      /* In out-of-core mode, the local mesh is only needed again once
+         intersections have been detected, so spill it to a scratch file
+         over the memory peak of the intersection search */
+
+      char  *spill_filename = NULL;
+
+      if (_cs_join_out_of_core) {
+        BFT_MALLOC(spill_filename,
+                   strlen("Join_Spill_.tmp") + 2 + 5 + 1,
+                   char);
+        sprintf(spill_filename, "Join%02d_Spill_%05d.tmp",
+                join_param.num, CS_MAX(cs_glob_rank_id, 0));
+        cs_join_mesh_spill(local_jmesh, spill_filename);
+      }
+
       /*
 
         Define new vertices and/or update old vertices from the real
@@ -1817,6 +1859,11 @@ cs_join_all(bool  preprocess)
                            &vtx_eset,
                            &inter_edges);
 
+      if (spill_filename != NULL) {
+        cs_join_mesh_restore(local_jmesh, spill_filename);
+        BFT_FREE(spill_filename);
+      }
+
       /*
          Merge vertices from equivalences found between vertices.
          Update work structures after the merge step.
@@ -106,6 +106,21 @@ cs_join_set_advanced_param(int      join_num,
                            double   tmr,
                            double   tmr_distrib);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate out-of-core mode for joining operations.
+ *
+ * In this mode, structures which are not needed during the memory peak of
+ * the intersection search are spilled to per-rank scratch files, reducing
+ * the footprint of joinings on very large meshes at the cost of additional
+ * I/O.
+ *
+ * parameters:
+ *   active <-- true to activate out-of-core mode, false to deactivate it
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_set_out_of_core(bool  active);
+
 /*----------------------------------------------------------------------------
  * Apply all the defined joining operations.
  *
@@ -391,6 +391,7 @@ _check_equiv(const cs_join_edges_t  *edges,
     cs_lnum_t  v1e2_id = edges->def[2*e2_id]-1;
     cs_lnum_t  v2e2_id = edges->def[2*e2_id+1]-1;
 
+#   pragma omp atomic
     _n_inter_tolerance_warnings++;
 
     if (verbosity > 3) {
@@ -3658,11 +3659,9 @@ cs_join_intersect_edges(cs_join_param_t         param,
                         cs_join_eset_t        **vtx_eset,
                         cs_join_inter_set_t   **inter_set)
 {
-  cs_lnum_t  i, j, k;
-  double  abs_e1[2], abs_e2[2];
+  cs_lnum_t  i;
 
   cs_join_type_t  join_type = CS_JOIN_TYPE_CONFORMING;
-  cs_lnum_t  n_inter = 0;
   cs_lnum_t  n_inter_detected = 0, n_real_inter = 0, n_trivial_inter = 0;
   cs_gnum_t  n_g_inter[3] = {0, 0, 0};
   cs_join_inter_set_t  *_inter_set = NULL;
@@ -3692,35 +3691,70 @@ cs_join_intersect_edges(cs_join_param_t         param,
   _inter_set = cs_join_inter_set_create(50);
   _vtx_eset = cs_join_eset_create(30);
 
-  /* Loop on edges */
+  /* Loop on edges. Each thread handles a contiguous range of the
+     edge-edge visibility list and appends its intersections and trivial
+     equivalences to private sets, which are merged in thread order below
+     so that results do not depend on the number of threads. Detailed
+     logging (verbosity > 3) interleaves output from the intersection
+     routines, so threading is disabled in that case. */
+
+  {
+    const int  n_max_threads = cs_glob_n_threads;
+
+    cs_join_inter_set_t  **t_inter_set = NULL;
+    cs_join_eset_t  **t_vtx_eset = NULL;
+
+    BFT_MALLOC(t_inter_set, n_max_threads, cs_join_inter_set_t *);
+    BFT_MALLOC(t_vtx_eset, n_max_threads, cs_join_eset_t *);
+
+    for (i = 0; i < n_max_threads; i++) {
+      t_inter_set[i] = NULL;
+      t_vtx_eset[i] = NULL;
+    }
+
+#   pragma omp parallel if (param.verbosity < 4) \
+                        reduction(+:n_inter_detected, n_trivial_inter)
+    {
+      cs_lnum_t  ii, j, k;
+      double  abs_e1[2], abs_e2[2];
+
+      int  t_id = 0;
+      cs_lnum_t  t_s_id = 0, t_e_id = edge_edge_vis->n_elts;
+      cs_lnum_t  n_inter = 0;
+      cs_join_type_t  t_join_type = CS_JOIN_TYPE_CONFORMING;
+
+#if defined(HAVE_OPENMP)
+      {
+        const int  n_t = omp_get_num_threads();
+        const cs_lnum_t  block = (edge_edge_vis->n_elts + n_t - 1) / n_t;
+
+        t_id = omp_get_thread_num();
+        t_s_id = CS_MIN(block*t_id, edge_edge_vis->n_elts);
+        t_e_id = CS_MIN(t_s_id + block, edge_edge_vis->n_elts);
+      }
+#endif
 
-  for (i = 0; i < edge_edge_vis->n_elts; i++) {
+      cs_join_inter_set_t  *l_inter_set = cs_join_inter_set_create(50);
+      cs_join_eset_t  *l_vtx_eset = cs_join_eset_create(30);
 
-    int  e1 = edge_edge_vis->g_elts[i]; /* This is a local number */
+      for (ii = t_s_id; ii < t_e_id; ii++) {
 
-    for (j = edge_edge_vis->index[i]; j < edge_edge_vis->index[i+1]; j++) {
+        int  e1 = edge_edge_vis->g_elts[ii]; /* This is a local number */
 
-      int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
-      int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
-      int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
+        for (j = edge_edge_vis->index[ii];
+             j < edge_edge_vis->index[ii+1];
+             j++) {
 
-      assert(e1 != e2);
+          int  e2 = edge_edge_vis->g_list[j]; /* This is a local number */
+          int  e1_id = (e1 < e2 ? e1 - 1 : e2 - 1);
+          int  e2_id = (e1 < e2 ? e2 - 1 : e1 - 1);
 
-      /* Get edge-edge intersection */
+          assert(e1 != e2);
 
-      if (param.icm == 1)
-        _edge_edge_3d_inter(mesh,
-                            edges,
-                            param.fraction,
-                            e1_id, abs_e1,
-                            e2_id, abs_e2,
-                            parall_eps2,
-                            param.verbosity,
-                            logfile,
-                            &n_inter);
+          /* Get edge-edge intersection */
 
-      else if (param.icm == 2)
-        _new_edge_edge_3d_inter(mesh,
+          if (param.icm == 1)
+            _edge_edge_3d_inter(mesh,
                                 edges,
                                 param.fraction,
                                 e1_id, abs_e1,
@@ -3730,67 +3764,131 @@ cs_join_intersect_edges(cs_join_param_t         param,
                                 logfile,
                                 &n_inter);
 
-      n_inter_detected += n_inter;
+          else if (param.icm == 2)
+            _new_edge_edge_3d_inter(mesh,
+                                    edges,
+                                    param.fraction,
+                                    e1_id, abs_e1,
+                                    e2_id, abs_e2,
+                                    parall_eps2,
+                                    param.verbosity,
+                                    logfile,
+                                    &n_inter);
+
+          n_inter_detected += n_inter;
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
-      if (param.verbosity > 3 && n_inter > 0) {
+          if (param.verbosity > 3 && n_inter > 0) {
 
-        cs_lnum_t  v1e1 = edges->def[2*e1_id] - 1;
-        cs_lnum_t  v2e1 = edges->def[2*e1_id+1] - 1;
-        cs_lnum_t  v1e2 = edges->def[2*e2_id] - 1;
-        cs_lnum_t  v2e2 = edges->def[2*e2_id+1] - 1;
+            cs_lnum_t  v1e1 = edges->def[2*e1_id] - 1;
+            cs_lnum_t  v2e1 = edges->def[2*e1_id+1] - 1;
+            cs_lnum_t  v1e2 = edges->def[2*e2_id] - 1;
+            cs_lnum_t  v2e2 = edges->def[2*e2_id+1] - 1;
 
-        fprintf(logfile,
-                "\n Intersection: "
-                "E1 (%llu) [%llu - %llu] / E2 (%llu) [%llu - %llu]\n",
-                (unsigned long long)edges->gnum[e1_id],
-                (unsigned long long)mesh->vertices[v1e1].gnum,
-                (unsigned long long)mesh->vertices[v2e1].gnum,
-                (unsigned long long)edges->gnum[e2_id],
-                (unsigned long long)mesh->vertices[v1e2].gnum,
-                (unsigned long long)mesh->vertices[v2e2].gnum);
-        fprintf(logfile, "  n_inter: %d ", n_inter);
-        for (k = 0; k < n_inter; k++)
-          fprintf(logfile,
-                  " (%d) - s_e1 = %g, s_e2 = %g", k, abs_e1[k], abs_e2[k]);
-        fflush(logfile);
-      }
+            fprintf(logfile,
+                    "\n Intersection: "
+                    "E1 (%llu) [%llu - %llu] / E2 (%llu) [%llu - %llu]\n",
+                    (unsigned long long)edges->gnum[e1_id],
+                    (unsigned long long)mesh->vertices[v1e1].gnum,
+                    (unsigned long long)mesh->vertices[v2e1].gnum,
+                    (unsigned long long)edges->gnum[e2_id],
+                    (unsigned long long)mesh->vertices[v1e2].gnum,
+                    (unsigned long long)mesh->vertices[v2e2].gnum);
+            fprintf(logfile, "  n_inter: %d ", n_inter);
+            for (k = 0; k < n_inter; k++)
+              fprintf(logfile,
+                      " (%d) - s_e1 = %g, s_e2 = %g",
+                      k, abs_e1[k], abs_e2[k]);
+            fflush(logfile);
+          }
 #endif
 
-      for (k = 0; k < n_inter; k++) {
+          for (k = 0; k < n_inter; k++) {
 
-        bool  trivial = false;
+            bool  trivial = false;
 
-        if (abs_e1[k] <= merge_limit || abs_e1[k] >= 1.0 - merge_limit)
-          if (abs_e2[k] <= merge_limit || abs_e2[k] >= 1.0 - merge_limit)
-            trivial = true;
+            if (abs_e1[k] <= merge_limit || abs_e1[k] >= 1.0 - merge_limit)
+              if (abs_e2[k] <= merge_limit || abs_e2[k] >= 1.0 - merge_limit)
+                trivial = true;
 
-        if (trivial) {
+            if (trivial) {
 
-          _add_trivial_equiv(e1_id,
-                             e2_id,
-                             abs_e1[k],
-                             abs_e2[k],
-                             edges,
-                             _vtx_eset);
+              _add_trivial_equiv(e1_id,
+                                 e2_id,
+                                 abs_e1[k],
+                                 abs_e2[k],
+                                 edges,
+                                 l_vtx_eset);
 
-          n_trivial_inter += 1;
+              n_trivial_inter += 1;
 
-        }
-        else {
+            }
+            else {
+
+              t_join_type = CS_JOIN_TYPE_NON_CONFORMING;
+
+              _add_inter(e1_id, e2_id, abs_e1[k], abs_e2[k], l_inter_set);
+
+            }
+
+          } /* End of loop on detected edge_edge_vis */
+
+        } /* End of loop on entities intersecting elements */
+
+      } /* End of loop on elements in intersection list */
+
+      if (t_join_type == CS_JOIN_TYPE_NON_CONFORMING) {
+#       pragma omp critical
+        join_type = CS_JOIN_TYPE_NON_CONFORMING;
+      }
+
+      t_inter_set[t_id] = l_inter_set;
+      t_vtx_eset[t_id] = l_vtx_eset;
+
+    } /* End of OpenMP parallel section */
 
-          if (join_type == CS_JOIN_TYPE_CONFORMING)
-            join_type = CS_JOIN_TYPE_NON_CONFORMING;
+    /* Append thread-local sets in thread (i.e. initial edge) order */
 
-          _add_inter(e1_id, e2_id, abs_e1[k], abs_e2[k], _inter_set);
+    for (i = 0; i < n_max_threads; i++) {
 
+      cs_join_inter_set_t  *is = t_inter_set[i];
+      cs_join_eset_t  *es = t_vtx_eset[i];
+
+      if (is != NULL) {
+        if (_inter_set->n_inter + is->n_inter > _inter_set->n_max_inter) {
+          _inter_set->n_max_inter = _inter_set->n_inter + is->n_inter;
+          BFT_REALLOC(_inter_set->inter_lst,
+                      2*_inter_set->n_max_inter,
+                      cs_join_inter_t);
         }
+        if (is->n_inter > 0)
+          memcpy(_inter_set->inter_lst + 2*_inter_set->n_inter,
+                 is->inter_lst,
+                 2*is->n_inter*sizeof(cs_join_inter_t));
+        _inter_set->n_inter += is->n_inter;
+        cs_join_inter_set_destroy(&is);
+      }
 
-      } /* End of loop on detected edge_edge_vis */
+      if (es != NULL) {
+        if (_vtx_eset->n_equiv + es->n_equiv > _vtx_eset->n_max_equiv) {
+          _vtx_eset->n_max_equiv = _vtx_eset->n_equiv + es->n_equiv;
+          BFT_REALLOC(_vtx_eset->equiv_couple,
+                      2*_vtx_eset->n_max_equiv,
+                      cs_lnum_t);
+        }
+        if (es->n_equiv > 0)
+          memcpy(_vtx_eset->equiv_couple + 2*_vtx_eset->n_equiv,
+                 es->equiv_couple,
+                 2*es->n_equiv*sizeof(cs_lnum_t));
+        _vtx_eset->n_equiv += es->n_equiv;
+        cs_join_eset_destroy(&es);
+      }
 
-    } /* End of loop on entities intersecting elements */
+    }
 
-  } /* End of loop on elements in intersection list */
+    BFT_FREE(t_inter_set);
+    BFT_FREE(t_vtx_eset);
+  }
 
   n_real_inter = n_inter_detected - n_trivial_inter;
 
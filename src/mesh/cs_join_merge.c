@@ -2008,19 +2008,14 @@ _merge_vertices(cs_join_param_t    param,
                 cs_lnum_t          n_vertices,
                 cs_join_vertex_t   vertices[])
 {
-  cs_lnum_t  i, j, k, list_size;
-  cs_join_vertex_t  merged_vertex;
-  bool  ok;
+  cs_lnum_t  i, j, list_size;
 
   cs_lnum_t  max_list_size = 0, vv_max_list_size = 0;
-  cs_lnum_t  n_loops = 0, n_max_loops = 0, n_transitivity = 0;
+  cs_lnum_t  n_max_loops = 0, n_transitivity = 0;
 
   cs_join_gset_t  *equiv_gnum = NULL;
-  cs_real_t  *rbuf = NULL;
-  cs_lnum_t  *merge_index = NULL, *ibuf = NULL;
+  cs_lnum_t  *merge_index = NULL;
   cs_gnum_t  *merge_list = NULL, *merge_ref_elts = NULL;
-  cs_gnum_t  *list = NULL;
-  cs_join_vertex_t  *set = NULL, *vbuf = NULL;
   FILE  *logfile = cs_glob_join_log;
 
   const int  verbosity = param.verbosity;
@@ -2087,96 +2082,127 @@ _merge_vertices(cs_join_param_t    param,
                  (unsigned long long)g_max_list_size);
   }
 
-  /* Temporary buffers allocation */
+  /* Merge sets of vertices. The sets built by the tag spreading are
+     disjoint, so they may be processed concurrently, each thread using
+     private work buffers. Detailed logging (verbosity > 3) requires
+     serial processing to keep log output readable. */
 
-  BFT_MALLOC(ibuf, 4*max_list_size + vv_max_list_size, cs_lnum_t);
-  BFT_MALLOC(rbuf, vv_max_list_size, cs_real_t);
-  BFT_MALLOC(vbuf, 2*max_list_size, cs_join_vertex_t);
-  BFT_MALLOC(list, max_list_size, cs_gnum_t);
-  BFT_MALLOC(set, max_list_size, cs_join_vertex_t);
+# pragma omp parallel if (verbosity < 4) reduction(+:n_transitivity)
+  {
+    cs_lnum_t  t_n_max_loops = 0;
 
-  /* Merge set of vertices */
+    cs_real_t  *rbuf = NULL;
+    cs_lnum_t  *ibuf = NULL;
+    cs_gnum_t  *list = NULL;
+    cs_join_vertex_t  *set = NULL, *vbuf = NULL;
 
-  for (i = 0; i < merge_set->n_elts; i++) {
+    /* Temporary buffers allocation (per thread) */
 
-    list_size = merge_index[i+1] - merge_index[i];
+    BFT_MALLOC(ibuf, 4*max_list_size + vv_max_list_size, cs_lnum_t);
+    BFT_MALLOC(rbuf, vv_max_list_size, cs_real_t);
+    BFT_MALLOC(vbuf, 2*max_list_size, cs_join_vertex_t);
+    BFT_MALLOC(list, max_list_size, cs_gnum_t);
+    BFT_MALLOC(set, max_list_size, cs_join_vertex_t);
 
-    if (list_size > 1) {
+#   pragma omp for
+    for (cs_lnum_t ii = 0; ii < merge_set->n_elts; ii++) {
 
-      for (j = 0, k = merge_index[i]; k < merge_index[i+1]; k++, j++) {
-        list[j] = merge_list[k];
-        set[j] = vertices[list[j]];
-      }
+      cs_lnum_t  jj, kk;
+      cs_join_vertex_t  merged_vertex;
+      bool  ok;
+
+      cs_lnum_t  sub_size = merge_index[ii+1] - merge_index[ii];
+
+      if (sub_size > 1) {
+
+        for (jj = 0, kk = merge_index[ii]; kk < merge_index[ii+1]; kk++, jj++) {
+          list[jj] = merge_list[kk];
+          set[jj] = vertices[list[jj]];
+        }
 
-      /* Define the resulting cs_join_vertex_t structure of the merge */
+        /* Define the resulting cs_join_vertex_t structure of the merge */
 
-      merged_vertex = _compute_merged_vertex(list_size, set);
+        merged_vertex = _compute_merged_vertex(sub_size, set);
 
-      /* Check if the vertex resulting of the merge is in the tolerance
-         for each vertex of the list */
+        /* Check if the vertex resulting of the merge is in the tolerance
+           for each vertex of the list */
 
-      ok = _is_in_tolerance(list_size, set, merged_vertex);
+        ok = _is_in_tolerance(sub_size, set, merged_vertex);
 
 #if CS_JOIN_MERGE_TOL_REDUC
-      if (ok == false) { /*
-                            The merged vertex is not in the tolerance of
-                            each vertex. This is a transitivity problem.
-                            We have to split the initial set into several
-                            subsets.
-                         */
-
-        n_transitivity++;
-
-        /* Display information on vertices to merge */
-        if (verbosity > 3) {
-          fprintf(logfile,
-                  "\n Begin merge for ref. elt: %llu - list_size: %d\n",
-                  (unsigned long long)merge_ref_elts[i],
-                  merge_index[i+1] - merge_index[i]);
-          for (j = 0; j < list_size; j++) {
-            fprintf(logfile, "%9llu -", (unsigned long long)list[j]);
-            cs_join_mesh_dump_vertex(logfile, set[j]);
+        if (ok == false) { /*
+                              The merged vertex is not in the tolerance of
+                              each vertex. This is a transitivity problem.
+                              We have to split the initial set into several
+                              subsets.
+                           */
+
+          cs_lnum_t  n_loops = 0;
+
+          n_transitivity++;
+
+          /* Display information on vertices to merge */
+          if (verbosity > 3) {
+            fprintf(logfile,
+                    "\n Begin merge for ref. elt: %llu - list_size: %d\n",
+                    (unsigned long long)merge_ref_elts[ii],
+                    merge_index[ii+1] - merge_index[ii]);
+            for (jj = 0; jj < sub_size; jj++) {
+              fprintf(logfile, "%9llu -", (unsigned long long)list[jj]);
+              cs_join_mesh_dump_vertex(logfile, set[jj]);
+            }
+            fprintf(logfile, "\nMerged vertex rejected:\n");
+            cs_join_mesh_dump_vertex(logfile, merged_vertex);
           }
-          fprintf(logfile, "\nMerged vertex rejected:\n");
-          cs_join_mesh_dump_vertex(logfile, merged_vertex);
-        }
 
-        n_loops = _solve_transitivity(param,
-                                      list_size,
-                                      set,
-                                      vbuf,
-                                      rbuf,
-                                      ibuf);
-
-        for (j = 0; j < list_size; j++)
-          vertices[list[j]] = set[j];
-
-        n_max_loops = CS_MAX(n_max_loops, n_loops);
-
-        if (verbosity > 3) { /* Display information */
-          fprintf(logfile, "\n  %3d loop(s) to get consistent subsets\n",
-                  n_loops);
-          fprintf(logfile, "\n End merge for ref. elt: %llu - list_size: %d\n",
-                  (unsigned long long)merge_ref_elts[i],
-                  merge_index[i+1] - merge_index[i]);
-          for (j = 0; j < list_size; j++) {
-            fprintf(logfile, "%7llu -", (unsigned long long)list[j]);
-            cs_join_mesh_dump_vertex(logfile, vertices[list[j]]);
+          n_loops = _solve_transitivity(param,
+                                        sub_size,
+                                        set,
+                                        vbuf,
+                                        rbuf,
+                                        ibuf);
+
+          for (jj = 0; jj < sub_size; jj++)
+            vertices[list[jj]] = set[jj];
+
+          t_n_max_loops = CS_MAX(t_n_max_loops, n_loops);
+
+          if (verbosity > 3) { /* Display information */
+            fprintf(logfile, "\n  %3d loop(s) to get consistent subsets\n",
+                    n_loops);
+            fprintf(logfile,
+                    "\n End merge for ref. elt: %llu - list_size: %d\n",
+                    (unsigned long long)merge_ref_elts[ii],
+                    merge_index[ii+1] - merge_index[ii]);
+            for (jj = 0; jj < sub_size; jj++) {
+              fprintf(logfile, "%7llu -", (unsigned long long)list[jj]);
+              cs_join_mesh_dump_vertex(logfile, vertices[list[jj]]);
+            }
+            fprintf(logfile, "\n");
           }
-          fprintf(logfile, "\n");
-        }
 
-      }
-      else /* New vertex data for the sub-elements */
+        }
+        else /* New vertex data for the sub-elements */
 
 #endif /* CS_JOIN_MERGE_TOL_REDUC */
 
-        for (j = 0; j < list_size; j++)
-          vertices[list[j]] = merged_vertex;
+          for (jj = 0; jj < sub_size; jj++)
+            vertices[list[jj]] = merged_vertex;
+
+      } /* sub_size > 1 */
 
-    } /* list_size > 1 */
+    } /* End of loop on potential merges */
 
-  } /* End of loop on potential merges */
+#   pragma omp critical
+    n_max_loops = CS_MAX(n_max_loops, t_n_max_loops);
+
+    BFT_FREE(ibuf);
+    BFT_FREE(vbuf);
+    BFT_FREE(rbuf);
+    BFT_FREE(set);
+    BFT_FREE(list);
+
+  } /* End of OpenMP parallel section */
 
   /* Apply merge to vertex initially identical */
 
@@ -2232,12 +2258,6 @@ _merge_vertices(cs_join_param_t    param,
 
   /* Free memory */
 
-  BFT_FREE(ibuf);
-  BFT_FREE(vbuf);
-  BFT_FREE(rbuf);
-  BFT_FREE(set);
-  BFT_FREE(list);
-
   cs_join_gset_destroy(&equiv_gnum);
 }
 
@@ -31,6 +31,8 @@
  *---------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <errno.h>
+#include <stdio.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
@@ -1973,6 +1975,127 @@ cs_join_mesh_copy(cs_join_mesh_t        **mesh,
   *mesh = _mesh;
 }
 
+/*----------------------------------------------------------------------------
+ * Spill the arrays of a cs_join_mesh_t structure to a scratch file.
+ *
+ * Counts are kept, but the face and vertex arrays are written to the given
+ * file and freed, reducing the memory footprint while the structure is not
+ * needed; they may be read back with cs_join_mesh_restore().
+ *
+ * parameters:
+ *   mesh     <-> pointer to the cs_join_mesh_t structure to spill
+ *   filename <-- name of the associated scratch file
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_mesh_spill(cs_join_mesh_t  *mesh,
+                   const char      *filename)
+{
+  if (mesh == NULL)
+    return;
+
+  FILE  *f = fopen(filename, "wb");
+
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Unable to open file \"%s\" to spill joining mesh."),
+              filename);
+
+  size_t  connect_size = 0;
+  size_t  n_written = 0, n_values = 0;
+
+  if (mesh->n_faces > 0) {
+
+    connect_size = mesh->face_vtx_idx[mesh->n_faces];
+
+    n_values += mesh->n_faces + connect_size + mesh->n_faces + 1;
+    n_written += fwrite(mesh->face_gnum, sizeof(cs_gnum_t),
+                        mesh->n_faces, f);
+    n_written += fwrite(mesh->face_vtx_idx, sizeof(cs_lnum_t),
+                        mesh->n_faces + 1, f);
+    n_written += fwrite(mesh->face_vtx_lst, sizeof(cs_lnum_t),
+                        connect_size, f);
+
+  }
+
+  if (mesh->n_vertices > 0) {
+    n_values += mesh->n_vertices;
+    n_written += fwrite(mesh->vertices, sizeof(cs_join_vertex_t),
+                        mesh->n_vertices, f);
+  }
+
+  if (n_written != n_values || fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error writing file \"%s\" to spill joining mesh."),
+              filename);
+
+  BFT_FREE(mesh->face_gnum);
+  BFT_FREE(mesh->face_vtx_idx);
+  BFT_FREE(mesh->face_vtx_lst);
+  BFT_FREE(mesh->vertices);
+}
+
+/*----------------------------------------------------------------------------
+ * Restore the arrays of a cs_join_mesh_t structure spilled to a scratch
+ * file by cs_join_mesh_spill(); the scratch file is removed.
+ *
+ * parameters:
+ *   mesh     <-> pointer to the cs_join_mesh_t structure to restore
+ *   filename <-- name of the associated scratch file
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_mesh_restore(cs_join_mesh_t  *mesh,
+                     const char      *filename)
+{
+  if (mesh == NULL)
+    return;
+
+  FILE  *f = fopen(filename, "rb");
+
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Unable to open file \"%s\" to restore joining mesh."),
+              filename);
+
+  size_t  n_read = 0, n_values = 0;
+
+  if (mesh->n_faces > 0) {
+
+    BFT_MALLOC(mesh->face_gnum, mesh->n_faces, cs_gnum_t);
+    BFT_MALLOC(mesh->face_vtx_idx, mesh->n_faces + 1, cs_lnum_t);
+
+    n_values += 2*mesh->n_faces + 1;
+    n_read += fread(mesh->face_gnum, sizeof(cs_gnum_t),
+                    mesh->n_faces, f);
+    n_read += fread(mesh->face_vtx_idx, sizeof(cs_lnum_t),
+                    mesh->n_faces + 1, f);
+
+    size_t  connect_size = mesh->face_vtx_idx[mesh->n_faces];
+
+    BFT_MALLOC(mesh->face_vtx_lst, connect_size, cs_lnum_t);
+
+    n_values += connect_size;
+    n_read += fread(mesh->face_vtx_lst, sizeof(cs_lnum_t),
+                    connect_size, f);
+
+  }
+
+  if (mesh->n_vertices > 0) {
+    BFT_MALLOC(mesh->vertices, mesh->n_vertices, cs_join_vertex_t);
+    n_values += mesh->n_vertices;
+    n_read += fread(mesh->vertices, sizeof(cs_join_vertex_t),
+                    mesh->n_vertices, f);
+  }
+
+  if (n_read != n_values || fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error reading file \"%s\" to restore joining mesh."),
+              filename);
+
+  remove(filename);
+}
+
 /*----------------------------------------------------------------------------
  * Compute the global min/max tolerance defined on vertices and display it
  *
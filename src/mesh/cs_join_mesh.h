@@ -299,6 +299,35 @@ void
 cs_join_mesh_copy(cs_join_mesh_t        **mesh,
                   const cs_join_mesh_t   *ref_mesh);
 
+/*----------------------------------------------------------------------------
+ * Spill the arrays of a cs_join_mesh_t structure to a scratch file.
+ *
+ * Counts are kept, but the face and vertex arrays are written to the given
+ * file and freed, reducing the memory footprint while the structure is not
+ * needed; they may be read back with cs_join_mesh_restore().
+ *
+ * parameters:
+ *   mesh     <-> pointer to the cs_join_mesh_t structure to spill
+ *   filename <-- name of the associated scratch file
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_mesh_spill(cs_join_mesh_t  *mesh,
+                   const char      *filename);
+
+/*----------------------------------------------------------------------------
+ * Restore the arrays of a cs_join_mesh_t structure spilled to a scratch
+ * file by cs_join_mesh_spill(); the scratch file is removed.
+ *
+ * parameters:
+ *   mesh     <-> pointer to the cs_join_mesh_t structure to restore
+ *   filename <-- name of the associated scratch file
+ *---------------------------------------------------------------------------*/
+
+void
+cs_join_mesh_restore(cs_join_mesh_t  *mesh,
+                     const char      *filename);
+
 /*----------------------------------------------------------------------------
  * Compute the global min/max tolerance defined on vertices and display it
  *
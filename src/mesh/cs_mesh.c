@@ -55,6 +55,7 @@
 #include "cs_interface.h"
 #include "cs_log.h"
 #include "cs_mesh_halo.h"
+#include "cs_mesh_location.h"
 #include "cs_numbering.h"
 #include "cs_order.h"
 #include "cs_mesh_quantities.h"
@@ -3152,6 +3153,11 @@ cs_mesh_init_selectors(void)
   if (cs_glob_mesh->class_defs == NULL)
     cs_mesh_init_group_classes(cs_glob_mesh);
 
+  /* Re-initializing the selectors implies the mesh has been modified,
+     so cached mesh location lists must be rebuilt */
+
+  cs_mesh_location_invalidate();
+
   /* Construction of the selectors */
 
   cs_glob_mesh->select_cells
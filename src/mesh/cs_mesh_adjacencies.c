@@ -53,6 +53,7 @@
 #include "cs_halo.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
+#include "cs_mesh_quantities.h"
 #include "cs_sort.h"
 
 /*----------------------------------------------------------------------------
@@ -88,6 +89,10 @@ static cs_mesh_adjacencies_t  _cs_glob_mesh_adjacencies;
 
 const cs_mesh_adjacencies_t  *cs_glob_mesh_adjacencies = NULL;
 
+/* Build optional cell -> cells geometric data upon mesh updates ? */
+
+static bool  _need_cell_cells_geom = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -197,6 +202,73 @@ _update_cell_cells(cs_mesh_adjacencies_t  *ma)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update optional cell -> cells geometric data
+ *
+ * The standard cell -> cells connectivity is assumed up to date, as are
+ * the mesh quantities.
+ *
+ * parameters:
+ *   ma <-> mesh adjacecies structure to update
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_cells_geom(cs_mesh_adjacencies_t  *ma)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_2_t *restrict face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = mq->weight;
+  const cs_real_3_t *restrict dijpf = (const cs_real_3_t *restrict)mq->dijpf;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_faces = m->n_i_faces;
+
+  const cs_lnum_t *c2c_idx = ma->cell_cells_idx;
+  const cs_lnum_t *c2c = ma->cell_cells;
+
+  /* The mapping from cell -> cells entries to faces is only unambiguous
+     when a single face is adjacent to 2 given cells */
+
+  if (ma->single_faces_to_cells == false) {
+    BFT_FREE(ma->cell_cells_face);
+    BFT_FREE(ma->cell_cells_weight);
+    BFT_FREE(ma->cell_cells_dijpf);
+    return;
+  }
+
+  BFT_REALLOC(ma->cell_cells_face, c2c_idx[n_cells], cs_lnum_t);
+  BFT_REALLOC(ma->cell_cells_weight, c2c_idx[n_cells], cs_real_t);
+  BFT_REALLOC(ma->cell_cells_dijpf, c2c_idx[n_cells], cs_real_3_t);
+
+  for (cs_lnum_t face_id = 0; face_id < n_faces; face_id++) {
+
+    cs_lnum_t i = face_cells[face_id][0];
+    cs_lnum_t j = face_cells[face_id][1];
+
+    if (i < n_cells) {
+      cs_lnum_t k = c2c_idx[i];
+      while (c2c[k] != j)
+        k++;
+      ma->cell_cells_face[k] = face_id;
+      ma->cell_cells_weight[k] = weight[face_id];
+      for (cs_lnum_t l = 0; l < 3; l++)
+        ma->cell_cells_dijpf[k][l] = dijpf[face_id][l];
+    }
+
+    if (j < n_cells) {
+      cs_lnum_t k = c2c_idx[j];
+      while (c2c[k] != i)
+        k++;
+      ma->cell_cells_face[k] = face_id;
+      ma->cell_cells_weight[k] = 1. - weight[face_id];
+      for (cs_lnum_t l = 0; l < 3; l++)
+        ma->cell_cells_dijpf[k][l] = -dijpf[face_id][l];
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Update cells -> boundary faces connectivity
  *
@@ -351,6 +423,10 @@ cs_mesh_adjacencies_initialize(void)
   ma->cell_cells_idx = NULL;
   ma->cell_cells = NULL;
 
+  ma->cell_cells_face = NULL;
+  ma->cell_cells_weight = NULL;
+  ma->cell_cells_dijpf = NULL;
+
   ma->cell_cells_e_idx = NULL;
   ma->cell_cells_e = NULL;
 
@@ -374,6 +450,10 @@ cs_mesh_adjacencies_finalize(void)
   BFT_FREE(ma->cell_cells_idx);
   BFT_FREE(ma->cell_cells);
 
+  BFT_FREE(ma->cell_cells_face);
+  BFT_FREE(ma->cell_cells_weight);
+  BFT_FREE(ma->cell_cells_dijpf);
+
   BFT_FREE(ma->cell_b_faces_idx);
   BFT_FREE(ma->cell_b_faces);
 
@@ -395,6 +475,11 @@ cs_mesh_adjacencies_update_mesh(void)
 
   _update_cell_cells(ma);
 
+  /* (re)build optional cell -> cells geometric data */
+
+  if (_need_cell_cells_geom)
+    _update_cell_cells_geom(ma);
+
   /* Map shared connectivities */
 
   cs_mesh_adjacencies_update_cell_cells_e();
@@ -422,6 +507,33 @@ cs_mesh_adjacencies_update_cell_cells_e(void)
   ma->cell_cells_e = m->cell_cells_lst;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update optional cell -> cells geometric data in
+ *         mesh adjacencies helper API relative to mesh and mesh quantities.
+ *
+ * The data maps each entry of the standard cell -> cells adjacency to the
+ * matching interior face id, face weight and I'J' vector copied from the
+ * mesh quantities, the weight and vector being expressed relative to the
+ * row cell, so face-based loops may gather all geometric terms from a
+ * single indexed structure.
+ *
+ * Once built by a first call to this function, the data is updated upon
+ * subsequent mesh modifications. It is only available when a single face
+ * is adjacent to 2 given cells; mesh quantities must be up to date.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_cell_cells_geom(void)
+{
+  cs_mesh_adjacencies_t *ma = &_cs_glob_mesh_adjacencies;
+
+  _need_cell_cells_geom = true;
+
+  _update_cell_cells_geom(ma);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a cs_adjacency_t structure of size n_elts
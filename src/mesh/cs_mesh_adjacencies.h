@@ -74,6 +74,17 @@ typedef struct {
   cs_lnum_t  *cell_cells_idx;          /* indexes (shared) */
   cs_lnum_t  *cell_cells;              /* adjacency (shared) */
 
+  /* cells -> cells geometric data (optional), with the same indexing
+     as the standard cells -> cells connectivity; only available when a
+     single face is adjacent to 2 given cells */
+
+  cs_lnum_t    *cell_cells_face;    /* matching interior face id */
+  cs_real_t    *cell_cells_weight;  /* matching face weight, relative
+                                       to the row cell */
+  cs_real_3_t  *cell_cells_dijpf;   /* matching I'J' vector, oriented
+                                       from the row cell to the
+                                       column cell */
+
   /* cells -> cells connectivity (extended) */
 
   const cs_lnum_t  *cell_cells_e_idx;  /* indexes (shared) */
@@ -148,6 +159,26 @@ cs_mesh_adjacencies_update_mesh(void);
 void
 cs_mesh_adjacencies_update_cell_cells_e(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update optional cell -> cells geometric data in
+ *         mesh adjacencies helper API relative to mesh and mesh quantities.
+ *
+ * The data maps each entry of the standard cell -> cells adjacency to the
+ * matching interior face id, face weight and I'J' vector copied from the
+ * mesh quantities, the weight and vector being expressed relative to the
+ * row cell, so face-based loops may gather all geometric terms from a
+ * single indexed structure.
+ *
+ * Once built by a first call to this function, the data is updated upon
+ * subsequent mesh modifications. It is only available when a single face
+ * is adjacent to 2 given cells; mesh quantities must be up to date.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_adjacencies_update_cell_cells_geom(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Create a cs_adjacency_t structure of size n_elts
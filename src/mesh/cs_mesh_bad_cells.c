@@ -116,264 +116,237 @@ static int  _call_type_visualize = 0;
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Evaluate cell's non-orthogonality.
+ * Evaluate face-based bad cell criteria in a single threaded sweep.
  *
- * Compute orthogonal normal using the distance between two consecutive
- * cell centers and the surface vector orthogonal to the face.
- * Evaluates a level of non-orthogonality and tags identified bad cells.
+ * Orthogonality, center offsetting, volume ratio, and the face
+ * contributions to the least-squares gradient conditioning are all
+ * computed in one pass over faces, using the face numbering's groups
+ * and threads so that cell flags and accumulators may be updated
+ * without conflicts.
+ *
+ * The caller is expected to synchronize the flags of ghost cells once
+ * all criteria (including cell-based ones) have been evaluated.
  *
  * parameters:
  *   mesh                 <-- pointer to associated mesh structure.
  *   mesh_quantities      <-- pointer to associated mesh quantities structure
- *   bad_cell_flag        <-- array of bad cell flags for various uses
+ *   type_mask            <-- mask of criteria to compute
+ *   w1                   <-> least-squares accumulators
+ *                            (6 values per cell, interleaved by array),
+ *                            or NULL
+ *   bad_cell_flag        <-> array of bad cell flags for various uses
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_ortho_norm(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
+_compute_face_criteria(const cs_mesh_t             *mesh,
+                       const cs_mesh_quantities_t  *mesh_quantities,
+                       int                          type_mask,
+                       cs_real_t                   *w1,
+                       unsigned                     bad_cell_flag[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
+  const int n_i_groups = mesh->i_face_numbering->n_groups;
+  const int n_i_threads = mesh->i_face_numbering->n_threads;
+  const int n_b_groups = mesh->b_face_numbering->n_groups;
+  const int n_b_threads = mesh->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index
+    = mesh->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index
+    = mesh->b_face_numbering->group_index;
+
+  const cs_lnum_t n_cells_wghosts = mesh->n_cells_with_ghosts;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)mesh_quantities->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)mesh_quantities->i_face_normal;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)mesh_quantities->b_face_normal;
+  const cs_real_3_t *restrict dofij
+    = (const cs_real_3_t *restrict)mesh_quantities->dofij;
+  const cs_real_t *restrict volume = mesh_quantities->cell_vol;
 
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3];
-  cs_real_t  face_normal[3], vect[3];
+  /* Loop on interior faces */
+  /*------------------------*/
 
-  double  cos_alpha, i_face_ortho, b_face_ortho;
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-  const cs_lnum_t  dim = 3;
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-  /* Loop on interior faces */
-  /*------------------------*/
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+        cs_real_t  vect[3], dij[3];
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+        const cs_lnum_t  cell1 = i_face_cells[face_id][0];
+        const cs_lnum_t  cell2 = i_face_cells[face_id][1];
 
-    /* Get information on mesh quantities */
+        for (cs_lnum_t i = 0; i < 3; i++)
+          vect[i] = cell_cen[cell2][i] - cell_cen[cell1][i];
 
-    for (i = 0; i < dim; i++) {
+        /* Evaluate the non-orthogonality. */
 
-      /* Center of gravity for each cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
+        if (type_mask & CS_BAD_CELL_ORTHO_NORM) {
 
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
+          double cos_alpha = _COSINE_3D(vect, i_face_normal[face_id]);
 
-    }
+          if (cos_alpha < 0.1) {
+            bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
+            bad_cell_flag[cell2] |= CS_BAD_CELL_ORTHO_NORM;
+          }
+        }
 
-    /* Evaluate the non-orthogonality. */
+        /* Compute center offsetting coefficient,
+           in a manner consistent with iterative gradient reconstruction */
 
-    for (i = 0; i < dim; i++)
-      vect[i] = cell_center2[i] - cell_center1[i];
+        if (type_mask & CS_BAD_CELL_OFFSET) {
 
-    cos_alpha = _COSINE_3D(vect, face_normal);
+          double of_n =   _MODULE_3D(dofij[face_id])
+                        * _MODULE_3D(i_face_normal[face_id]);
 
-    i_face_ortho = cos_alpha;
+          double off_1 = 1 - pow(of_n / volume[cell1], 1/3.);
+          double off_2 = 1 - pow(of_n / volume[cell2], 1/3.);
 
-    if (i_face_ortho < 0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_ORTHO_NORM;
-    }
-  }
+          if (off_1 < 0.1)
+            bad_cell_flag[cell1] |= CS_BAD_CELL_OFFSET;
+          if (off_2 < 0.1)
+            bad_cell_flag[cell2] |= CS_BAD_CELL_OFFSET;
+        }
 
-  /* Loop on boundary faces */
-  /*------------------------*/
+        /* Least-squares gradient contribution */
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+        if (type_mask & CS_BAD_CELL_LSQ_GRAD) {
 
-    cell1 = mesh->b_face_cells[face_id];
+          double unsdij = 1.0 / _MODULE_3D(vect);
 
-    /* Get information on mesh quantities */
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dij[i] = vect[i] * unsdij;
 
-    for (i = 0; i < dim; i++) {
+          w1[cell1] += dij[0] * dij[0];
+          w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
+          w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
+          w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
+          w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
+          w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
 
-      /* Center of gravity of the cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
+          w1[cell2] += dij[0] * dij[0];
+          w1[cell2 + n_cells_wghosts] += dij[1] * dij[1];
+          w1[cell2 + 2 * n_cells_wghosts] += dij[2] * dij[2];
+          w1[cell2 + 3 * n_cells_wghosts] += dij[0] * dij[1];
+          w1[cell2 + 4 * n_cells_wghosts] += dij[0] * dij[2];
+          w1[cell2 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+        }
 
-      /* Face center coordinates */
-      face_center[i] = mesh_quantities->b_face_cog[face_id*dim + i];
+        /* Evaluate the cell's geometric continuity (volume ratio). */
 
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->b_face_normal[face_id*dim + i];
+        if (type_mask & CS_BAD_CELL_RATIO) {
 
-    }
+          double vol_ratio = fmin(volume[cell1] / volume[cell2],
+                                  volume[cell2] / volume[cell1]);
 
-    /* Evaluate the non-orthogonality. */
-    for (i = 0; i < dim; i++)
-      vect[i] = face_center[i] - cell_center1[i];
+          if (vol_ratio < 0.1*0.1) {
+            bad_cell_flag[cell1] |= CS_BAD_CELL_RATIO;
+            bad_cell_flag[cell2] |= CS_BAD_CELL_RATIO;
+          }
+        }
 
-    cos_alpha = _COSINE_3D(vect, face_normal);
+      } /* loop on faces */
 
-    b_face_ortho = cos_alpha;
+    } /* loop on threads */
 
-    if (b_face_ortho < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-  }
+  } /* loop on thread groups */
 
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
+  /* Loop on boundary faces */
+  /*------------------------*/
 
-/*----------------------------------------------------------------------------
- * Evaluate cell's center offsetting.
- *
- * Compute center offsetting coefficient for interior faces.
- * Evaluates a non-matching level (offset) and tags identified bad cells.
- *
- * parameters:
- *   mesh                   <-- pointer to associated mesh structure
- *   mesh_quantities        <-- pointer to associated mesh quantities
- *                              structure
- *   bad_cell_flag          <-- array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-static void
-_compute_offsetting(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
-{
-  cs_lnum_t  face_id, cell1, cell2;
-  double  of_n, off_1, off_2;
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-  const cs_real_t *v_of, *v_n;
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
 
-  /* Loop on interior faces */
+        cs_real_t  vect[3], dij[3];
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+        const cs_lnum_t  cell1 = mesh->b_face_cells[face_id];
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+        /* Evaluate the non-orthogonality. */
 
-    /* Compute center offsetting coefficient,
-       in a manner consistent with iterative gradient reconstruction */
+        if (type_mask & CS_BAD_CELL_ORTHO_NORM) {
 
-    v_of = &(mesh_quantities->dofij[face_id*3]);
-    v_n = &(mesh_quantities->i_face_normal[face_id*3]);
-    of_n = _MODULE_3D(v_of) * _MODULE_3D(v_n);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            vect[i] =   mesh_quantities->b_face_cog[face_id*3 + i]
+                      - cell_cen[cell1][i];
 
-    off_1 = 1 - pow(of_n / mesh_quantities->cell_vol[cell1], 1/3.);
-    off_2 = 1 - pow(of_n / mesh_quantities->cell_vol[cell2], 1/3.);
+          double cos_alpha = _COSINE_3D(vect, b_face_normal[face_id]);
 
-    if (off_1 < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_OFFSET;
-    if (off_2 < 0.1)
-      bad_cell_flag[cell2] |= CS_BAD_CELL_OFFSET;
+          if (cos_alpha < 0.1)
+            bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
+        }
 
-  }
+        /* Least-squares gradient contribution */
 
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
+        if (type_mask & CS_BAD_CELL_LSQ_GRAD) {
+
+          double surf_n_inv = 1.0 / _MODULE_3D(b_face_normal[face_id]);
+
+          for (cs_lnum_t i = 0; i < 3; i++)
+            dij[i] = b_face_normal[face_id][i] * surf_n_inv;
+
+          w1[cell1] += dij[0] * dij[0];
+          w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
+          w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
+          w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
+          w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
+          w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
 }
 
 /*----------------------------------------------------------------------------
  * Evaluate cell's distorsion.
  *
- * Compute Least Squares Gradient coefficient for cells.
- * Evaluates a distorsion level (based on LSQ Gradient Method) and tags
- * identified bad cells.
+ * Analyzes the least-squares accumulators built by
+ * _compute_face_criteria, evaluates a distorsion level (based on LSQ
+ * Gradient Method) and tags identified bad cells.
  *
  * parameters:
  *   mesh               <-- pointer to associated mesh structure
- *   mesh_quantities    <-- pointer to associated mesh quantities structure
+ *   w1                 <-- least-squares accumulators
+ *                          (6 values per cell, interleaved by array)
  *   bad_cell_flag      --> array of bad cell flags for various uses
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_least_squares(const cs_mesh_t             *mesh,
-                       const cs_mesh_quantities_t  *mesh_quantities,
-                       unsigned                     bad_cell_flag[])
+_compute_least_squares(const cs_mesh_t  *mesh,
+                       const cs_real_t  *w1,
+                       unsigned          bad_cell_flag[])
 {
-  cs_real_t lsq;
-  const cs_lnum_t  dim = mesh->dim;
   const cs_lnum_t  n_cells = mesh->n_cells;
   const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
 
-  const cs_real_3_t *b_face_normal
-    = (const cs_real_3_t *)mesh_quantities->b_face_normal;
-
-  cs_lnum_t     i, k, face_id, cell1, cell2, cell_id;
-  cs_real_3_t   cell_center1, cell_center2, vect, dij, eigenvalues;
-  cs_real_33_t  w2;
-
-  double unsdij, surfn, surf_n_inv, min_diag, max_diag;
-  double xam, q, p, r, phi;
-
-  cs_real_t *w1 = NULL;
-
   const double pi = 4 * atan(1);
 
-  BFT_MALLOC(w1, 6 * n_cells_wghosts, cs_real_t);
-
-  for (i = 0; i < 6 * n_cells_wghosts; i++)
-    w1[i] = 0.;
-
-  /* Loop on interior faces */
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
-
-    /* Center of gravity for each cell */
-
-    for (i = 0; i < dim; i++) {
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
-      vect[i] = cell_center2[i] - cell_center1[i];
-    }
-
-    unsdij = 1.0 / _MODULE_3D(vect);
-
-    for (i = 0; i < dim; i++)
-      dij[i] = vect[i] * unsdij;
-
-    w1[cell1] += dij[0] * dij[0];
-    w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
-
-    w1[cell2] += dij[0] * dij[0];
-    w1[cell2 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell2 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell2 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell2 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell2 + 5 * n_cells_wghosts] += dij[1] * dij[2];
-
-  }
-
-  /* Loop on boundary faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
-    cell1 = mesh->b_face_cells[face_id];
-
-    surfn = _MODULE_3D(b_face_normal[face_id]);
-
-    surf_n_inv = 1.0 / surfn;
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
 
-    for (i = 0; i < dim; i++)
-      dij[i] = b_face_normal[face_id][i] * surf_n_inv;
+    cs_lnum_t     i, k;
+    cs_real_3_t   eigenvalues;
+    cs_real_33_t  w2;
 
-    w1[cell1] += dij[0] * dij[0];
-    w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
-  }
-
-  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+    double min_diag, max_diag;
+    double q, p, r, phi;
 
     w2[0][0] = w1[cell_id];
     w2[1][1] = w1[cell_id + n_cells_wghosts];
@@ -387,7 +360,7 @@ _compute_least_squares(const cs_mesh_t             *mesh,
 
     /* Compute the eigenvalues for a given real symmetric 3x3 matrix */
 
-    xam = w2[0][1] * w2[0][1] + w2[0][2] * w2[0][2] + w2[1][2] * w2[1][2];
+    double xam = w2[0][1]*w2[0][1] + w2[0][2]*w2[0][2] + w2[1][2]*w2[1][2];
 
     /* First check if the matrix is diagonal */
     if (xam <= 0.) {
@@ -448,66 +421,11 @@ _compute_least_squares(const cs_mesh_t             *mesh,
       max_diag = fmax(max_diag, fabs(eigenvalues[i]));
     }
 
-    lsq = min_diag / max_diag;
+    cs_real_t lsq = min_diag / max_diag;
 
     if (lsq < 0.1)
       bad_cell_flag[cell_id] |= CS_BAD_CELL_LSQ_GRAD;
   }
-
-  BFT_FREE(w1);
-
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
-
-/*----------------------------------------------------------------------------
- * Evaluate cell's volume ratio.
- *
- * Compute Volume Ratio coefficient for cells.
- * Evaluates a the cell's geometric continuity (based on volume ratio) and
- * tags identified bad cells.
- *
- * parameters:
- *   mesh                <-- pointer to associated mesh structure
- *   mesh_quantities     <-- pointer to associated mesh quantities structure
- *   bad_cell_flag       --> array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
-
-static void
-_compute_volume_ratio(const cs_mesh_t             *mesh,
-                      const cs_mesh_quantities_t  *mesh_quantities,
-                      unsigned                     bad_cell_flag[])
-{
-  double vol_ratio;
-  cs_real_t *volume = mesh_quantities->cell_vol;
-
-  cs_lnum_t   face_id, cell1, cell2;
-
-  /* Loop on interior faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
-
-    vol_ratio = fmin(volume[cell1] / volume[cell2],
-                     volume[cell2] / volume[cell1]);
-
-    if (vol_ratio < 0.1*0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_RATIO;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_RATIO;
-    }
-  }
-
-  if (mesh->halo != NULL)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
 }
 
 /*----------------------------------------------------------------------------
@@ -888,14 +806,53 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Evaluate mesh quality criteria */
   /*--------------------------------*/
 
-  /* Condition 1: Orthogonal Normal */
-  /*--------------------------------*/
+  /* All face-based criteria are computed in a single sweep;
+     the ghost cell flags are synchronized once, after that sweep
+     and the cell-based least-squares analysis. */
+
+  {
+    int type_mask =   _type_flag_compute[call_type]
+                    & (  CS_BAD_CELL_ORTHO_NORM | CS_BAD_CELL_OFFSET
+                       | CS_BAD_CELL_LSQ_GRAD | CS_BAD_CELL_RATIO);
+
+    if (   (type_mask & CS_BAD_CELL_OFFSET)
+        && cs_glob_mesh_quantities->min_vol < 0.)
+      type_mask -= CS_BAD_CELL_OFFSET;
+
+    if (type_mask != 0) {
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_ORTHO_NORM)
-    _compute_ortho_norm(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
+      cs_real_t *w1 = NULL;
 
+      if (type_mask & CS_BAD_CELL_LSQ_GRAD) {
+        const cs_lnum_t w1_size = 6 * n_cells_wghosts;
+        BFT_MALLOC(w1, w1_size, cs_real_t);
+#       pragma omp parallel for if (w1_size > CS_THR_MIN)
+        for (cs_lnum_t j = 0; j < w1_size; j++)
+          w1[j] = 0.;
+      }
+
+      _compute_face_criteria(mesh,
+                             mesh_quantities,
+                             type_mask,
+                             w1,
+                             bad_cell_flag);
+
+      if (type_mask & CS_BAD_CELL_LSQ_GRAD) {
+        _compute_least_squares(mesh, w1, bad_cell_flag);
+        BFT_FREE(w1);
+      }
+
+      if (mesh->halo != NULL)
+        cs_halo_sync_untyped(mesh->halo,
+                             CS_HALO_EXTENDED,
+                             sizeof(unsigned),
+                             bad_cell_flag);
+
+    }
+  }
+
+  /* Condition 1: Orthogonal Normal */
+  /*--------------------------------*/
 
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_ORTHO_NORM) {
 
@@ -923,12 +880,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 2: Orthogonal A-Frame */
   /*---------------------------------*/
 
-  if (   _type_flag_compute[call_type] & CS_BAD_CELL_OFFSET
-      && cs_glob_mesh_quantities->min_vol >= 0.)
-    _compute_offsetting(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
-
   if (   _type_flag_compute[call_type_log] & CS_BAD_CELL_OFFSET
       && cs_glob_mesh_quantities->min_vol >= 0.) {
 
@@ -956,11 +907,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 3: Least Squares Gradient */
   /*-------------------------------------*/
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_LSQ_GRAD)
-    _compute_least_squares(mesh,
-                           mesh_quantities,
-                           bad_cell_flag);
-
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_LSQ_GRAD) {
 
     ibad = 0;
@@ -987,11 +933,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 4: Volume Ratio */
   /*---------------------------*/
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_RATIO)
-    _compute_volume_ratio(mesh,
-                          mesh_quantities,
-                          bad_cell_flag);
-
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_RATIO) {
 
     ibad = 0;
@@ -87,6 +87,31 @@ typedef struct _vtx_lookup_table {
 
 } vtx_lookup_table_t;
 
+/* Cache used to reuse halo structures from one halo definition to the
+   next one when the associated interface information is unchanged */
+
+typedef struct {
+
+  bool          active;         /* Is caching active ? */
+
+  cs_lnum_t     n_cells;        /* Number of local cells */
+  cs_lnum_t     n_vertices;     /* Number of local vertices */
+  cs_lnum_t     n_i_faces;      /* Number of local internal faces */
+  int           halo_type;      /* Halo type of the cached halo */
+
+  cs_lnum_t     vtx_ifs_size;   /* Size of packed vertex interface info */
+  cs_lnum_t     face_ifs_size;  /* Size of packed face interface info */
+  cs_lnum_t    *vtx_ifs;        /* Packed vertex interface info */
+  cs_lnum_t    *face_ifs;       /* Packed face interface info */
+
+  cs_halo_t    *halo;           /* Copy of the previously built halo */
+  cs_lnum_t    *gcell_vtx_idx;  /* Ghost cell -> vertices index */
+  cs_lnum_t    *gcell_vtx_lst;  /* Ghost cell -> vertices list */
+  cs_lnum_2_t  *i_face_cells;   /* Face -> cells connectivity including
+                                   updated ghost cell values */
+
+} _halo_cache_t;
+
 
 /*=============================================================================
  * Local Macro definitions
@@ -96,6 +121,10 @@ typedef struct _vtx_lookup_table {
  *  Global static variables
  *============================================================================*/
 
+static _halo_cache_t  _halo_cache = {false, -1, -1, -1, CS_HALO_N_TYPES,
+                                     0, 0, NULL, NULL,
+                                     NULL, NULL, NULL, NULL};
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -2960,12 +2989,383 @@ _create_gcell_faces_connect(cs_mesh_t                 *mesh,
   *p_cell_faces_lst = cell_faces_lst;
 }
 
+/*---------------------------------------------------------------------------
+ * Compute the size of the buffer needed to pack an interface set's contents.
+ *
+ * parameters:
+ *   ifs <-- pointer to interface set, or NULL
+ *
+ * returns:
+ *   buffer size, as a number of cs_lnum_t values
+ *---------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_pack_interfaces_size(const cs_interface_set_t  *ifs)
+{
+  int  i, n_interfaces;
+  cs_lnum_t  retval = 1;
+
+  if (ifs == NULL)
+    return retval;
+
+  n_interfaces = cs_interface_set_size(ifs);
+
+  for (i = 0; i < n_interfaces; i++) {
+    const cs_interface_t  *itf = cs_interface_set_get(ifs, i);
+    retval += 3 + cs_interface_get_tr_index_size(itf) + cs_interface_size(itf);
+  }
+
+  return retval;
+}
+
+/*---------------------------------------------------------------------------
+ * Pack an interface set's contents into a buffer, so that two interface
+ * sets may be compared by comparing their packed contents.
+ *
+ * parameters:
+ *   ifs <-- pointer to interface set, or NULL
+ *   buf --> buffer of size _pack_interfaces_size(ifs)
+ *---------------------------------------------------------------------------*/
+
+static void
+_pack_interfaces(const cs_interface_set_t  *ifs,
+                 cs_lnum_t                  buf[])
+{
+  int  i, n_interfaces = 0;
+  cs_lnum_t  j, shift = 1;
+
+  if (ifs != NULL)
+    n_interfaces = cs_interface_set_size(ifs);
+
+  buf[0] = n_interfaces;
+
+  for (i = 0; i < n_interfaces; i++) {
+
+    const cs_interface_t  *itf = cs_interface_set_get(ifs, i);
+    const cs_lnum_t  itf_size = cs_interface_size(itf);
+    const cs_lnum_t  tr_size = cs_interface_get_tr_index_size(itf);
+    const cs_lnum_t  *tr_index = cs_interface_get_tr_index(itf);
+    const cs_lnum_t  *elt_ids = cs_interface_get_elt_ids(itf);
+
+    buf[shift++] = cs_interface_rank(itf);
+    buf[shift++] = itf_size;
+    buf[shift++] = tr_size;
+
+    for (j = 0; j < tr_size; j++)
+      buf[shift++] = tr_index[j];
+
+    for (j = 0; j < itf_size; j++)
+      buf[shift++] = elt_ids[j];
+
+  }
+}
+
+/*---------------------------------------------------------------------------
+ * Free structures retained by the halo cache and mark it empty.
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_cache_free(void)
+{
+  BFT_FREE(_halo_cache.vtx_ifs);
+  BFT_FREE(_halo_cache.face_ifs);
+  BFT_FREE(_halo_cache.gcell_vtx_idx);
+  BFT_FREE(_halo_cache.gcell_vtx_lst);
+  BFT_FREE(_halo_cache.i_face_cells);
+
+  if (_halo_cache.halo != NULL)
+    cs_halo_destroy(&(_halo_cache.halo));
+
+  _halo_cache.n_cells = -1;
+  _halo_cache.n_vertices = -1;
+  _halo_cache.n_i_faces = -1;
+  _halo_cache.halo_type = CS_HALO_N_TYPES;
+  _halo_cache.vtx_ifs_size = 0;
+  _halo_cache.face_ifs_size = 0;
+}
+
+/*---------------------------------------------------------------------------
+ * Check if the halo cache contents may be reused for a mesh.
+ *
+ * The cached halo may only be reused if the local mesh sizes and the
+ * contents of the face and vertex interfaces are unchanged on all ranks,
+ * as ghost cell structures are built collectively.
+ *
+ * parameters:
+ *   mesh       <-- pointer to cs_mesh_t structure
+ *   face_ifs   <-- pointer to faces interfaces
+ *   vertex_ifs <-- pointer to vertex interfaces
+ *
+ * returns:
+ *   true if the cached structures match the given mesh and interfaces
+ *   on all ranks, false otherwise
+ *---------------------------------------------------------------------------*/
+
+static bool
+_halo_cache_matches(const cs_mesh_t           *mesh,
+                    const cs_interface_set_t  *face_ifs,
+                    const cs_interface_set_t  *vertex_ifs)
+{
+  int  unchanged = 0;
+
+  if (   _halo_cache.halo != NULL
+      && _halo_cache.n_cells == mesh->n_cells
+      && _halo_cache.n_vertices == mesh->n_vertices
+      && _halo_cache.n_i_faces == mesh->n_i_faces
+      && _halo_cache.halo_type == (int)(mesh->halo_type)
+      && _halo_cache.vtx_ifs_size == _pack_interfaces_size(vertex_ifs)
+      && _halo_cache.face_ifs_size == _pack_interfaces_size(face_ifs)) {
+
+    cs_lnum_t  *buf = NULL;
+
+    BFT_MALLOC(buf,
+               CS_MAX(_halo_cache.vtx_ifs_size, _halo_cache.face_ifs_size),
+               cs_lnum_t);
+
+    _pack_interfaces(vertex_ifs, buf);
+
+    if (memcmp(buf, _halo_cache.vtx_ifs,
+               _halo_cache.vtx_ifs_size*sizeof(cs_lnum_t)) == 0) {
+
+      _pack_interfaces(face_ifs, buf);
+
+      if (memcmp(buf, _halo_cache.face_ifs,
+                 _halo_cache.face_ifs_size*sizeof(cs_lnum_t)) == 0)
+        unchanged = 1;
+
+    }
+
+    BFT_FREE(buf);
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int unchanged_loc = unchanged;
+    MPI_Allreduce(&unchanged_loc, &unchanged, 1, MPI_INT, MPI_MIN,
+                  cs_glob_mpi_comm);
+  }
+#endif
+
+  return (unchanged == 1) ? true : false;
+}
+
+/*---------------------------------------------------------------------------
+ * Save the structures built by the current halo definition in the halo
+ * cache, along with the mesh size and interface information they match.
+ *
+ * parameters:
+ *   mesh          <-- pointer to cs_mesh_t structure
+ *   face_ifs      <-- pointer to faces interfaces
+ *   vertex_ifs    <-- pointer to vertex interfaces
+ *   gcell_vtx_idx <-- ghost cell -> vertices connectivity index, or NULL
+ *   gcell_vtx_lst <-- ghost cell -> vertices connectivity list, or NULL
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_cache_update(const cs_mesh_t           *mesh,
+                   const cs_interface_set_t  *face_ifs,
+                   const cs_interface_set_t  *vertex_ifs,
+                   const cs_lnum_t            gcell_vtx_idx[],
+                   const cs_lnum_t            gcell_vtx_lst[])
+{
+  cs_lnum_t  i;
+  cs_halo_t  *h = NULL;
+
+  const cs_halo_t  *halo = mesh->halo;
+
+  _halo_cache_free();
+
+  _halo_cache.n_cells = mesh->n_cells;
+  _halo_cache.n_vertices = mesh->n_vertices;
+  _halo_cache.n_i_faces = mesh->n_i_faces;
+  _halo_cache.halo_type = (int)(mesh->halo_type);
+
+  _halo_cache.vtx_ifs_size = _pack_interfaces_size(vertex_ifs);
+  _halo_cache.face_ifs_size = _pack_interfaces_size(face_ifs);
+
+  BFT_MALLOC(_halo_cache.vtx_ifs, _halo_cache.vtx_ifs_size, cs_lnum_t);
+  BFT_MALLOC(_halo_cache.face_ifs, _halo_cache.face_ifs_size, cs_lnum_t);
+
+  _pack_interfaces(vertex_ifs, _halo_cache.vtx_ifs);
+  _pack_interfaces(face_ifs, _halo_cache.face_ifs);
+
+  /* Deep copy of the halo structure */
+
+  h = cs_halo_create_from_ref(halo);
+
+  h->n_local_elts = halo->n_local_elts;
+
+  for (i = 0; i < CS_HALO_N_TYPES; i++) {
+    h->n_send_elts[i] = halo->n_send_elts[i];
+    h->n_elts[i] = halo->n_elts[i];
+  }
+
+  memcpy(h->send_index, halo->send_index,
+         (2*halo->n_c_domains + 1)*sizeof(cs_lnum_t));
+  memcpy(h->index, halo->index,
+         (2*halo->n_c_domains + 1)*sizeof(cs_lnum_t));
+
+  if (halo->n_transforms > 0) {
+    cs_lnum_t  perio_lst_size = 2*halo->n_transforms * 2*halo->n_c_domains;
+    memcpy(h->send_perio_lst, halo->send_perio_lst,
+           perio_lst_size*sizeof(cs_lnum_t));
+    memcpy(h->perio_lst, halo->perio_lst,
+           perio_lst_size*sizeof(cs_lnum_t));
+  }
+
+  if (halo->n_send_elts[CS_HALO_EXTENDED] > 0) {
+    BFT_MALLOC(h->send_list, halo->n_send_elts[CS_HALO_EXTENDED], cs_lnum_t);
+    memcpy(h->send_list, halo->send_list,
+           halo->n_send_elts[CS_HALO_EXTENDED]*sizeof(cs_lnum_t));
+  }
+
+  _halo_cache.halo = h;
+
+  /* Ghost cell -> vertices connectivity */
+
+  if (gcell_vtx_idx != NULL) {
+
+    cs_lnum_t  n_ghost_cells = mesh->n_ghost_cells;
+
+    BFT_MALLOC(_halo_cache.gcell_vtx_idx, n_ghost_cells + 1, cs_lnum_t);
+    memcpy(_halo_cache.gcell_vtx_idx, gcell_vtx_idx,
+           (n_ghost_cells + 1)*sizeof(cs_lnum_t));
+
+    if (gcell_vtx_lst != NULL && gcell_vtx_idx[n_ghost_cells] > 0) {
+      BFT_MALLOC(_halo_cache.gcell_vtx_lst,
+                 gcell_vtx_idx[n_ghost_cells],
+                 cs_lnum_t);
+      memcpy(_halo_cache.gcell_vtx_lst, gcell_vtx_lst,
+             gcell_vtx_idx[n_ghost_cells]*sizeof(cs_lnum_t));
+    }
+
+  }
+
+  /* Face -> cells connectivity, including updated ghost cell values */
+
+  BFT_MALLOC(_halo_cache.i_face_cells, mesh->n_i_faces, cs_lnum_2_t);
+  memcpy(_halo_cache.i_face_cells, mesh->i_face_cells,
+         mesh->n_i_faces*sizeof(cs_lnum_2_t));
+}
+
+/*---------------------------------------------------------------------------
+ * Restore halo structures from the halo cache.
+ *
+ * The mesh's halo structure, assumed freshly built by cs_halo_create()
+ * from the (unchanged) vertex interfaces, is filled with the cached
+ * contents, and mesh elements bound to halo management are updated as by
+ * a full halo definition.
+ *
+ * parameters:
+ *   mesh            <-> pointer to cs_mesh_t structure
+ *   p_gcell_vtx_idx --> pointer to the ghost cell -> vertices index
+ *   p_gcell_vtx_lst --> pointer to the ghost cell -> vertices list
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_cache_restore(cs_mesh_t   *mesh,
+                    cs_lnum_t   *p_gcell_vtx_idx[],
+                    cs_lnum_t   *p_gcell_vtx_lst[])
+{
+  cs_lnum_t  i;
+  cs_halo_t  *halo = mesh->halo;
+
+  cs_lnum_t  *gcell_vtx_idx = NULL, *gcell_vtx_lst = NULL;
+
+  const cs_halo_t  *h = _halo_cache.halo;
+
+  assert(halo->n_c_domains == h->n_c_domains);
+  assert(halo->n_transforms == h->n_transforms);
+
+  for (i = 0; i < CS_HALO_N_TYPES; i++) {
+    halo->n_send_elts[i] = h->n_send_elts[i];
+    halo->n_elts[i] = h->n_elts[i];
+  }
+
+  memcpy(halo->send_index, h->send_index,
+         (2*halo->n_c_domains + 1)*sizeof(cs_lnum_t));
+  memcpy(halo->index, h->index,
+         (2*halo->n_c_domains + 1)*sizeof(cs_lnum_t));
+
+  if (halo->n_transforms > 0) {
+    cs_lnum_t  perio_lst_size = 2*halo->n_transforms * 2*halo->n_c_domains;
+    memcpy(halo->send_perio_lst, h->send_perio_lst,
+           perio_lst_size*sizeof(cs_lnum_t));
+    memcpy(halo->perio_lst, h->perio_lst,
+           perio_lst_size*sizeof(cs_lnum_t));
+  }
+
+  if (h->n_send_elts[CS_HALO_EXTENDED] > 0) {
+    BFT_MALLOC(halo->send_list, h->n_send_elts[CS_HALO_EXTENDED], cs_lnum_t);
+    memcpy(halo->send_list, h->send_list,
+           h->n_send_elts[CS_HALO_EXTENDED]*sizeof(cs_lnum_t));
+  }
+
+  /* Update mesh structure elements bound to halo management */
+
+  mesh->n_ghost_cells = halo->n_elts[CS_HALO_EXTENDED];
+  mesh->n_cells_with_ghosts = mesh->n_cells + mesh->n_ghost_cells;
+
+  if (_halo_cache.gcell_vtx_idx != NULL) {
+
+    cs_lnum_t  n_ghost_cells = mesh->n_ghost_cells;
+
+    BFT_MALLOC(gcell_vtx_idx, n_ghost_cells + 1, cs_lnum_t);
+    memcpy(gcell_vtx_idx, _halo_cache.gcell_vtx_idx,
+           (n_ghost_cells + 1)*sizeof(cs_lnum_t));
+
+    if (_halo_cache.gcell_vtx_lst != NULL) {
+      BFT_MALLOC(gcell_vtx_lst, gcell_vtx_idx[n_ghost_cells], cs_lnum_t);
+      memcpy(gcell_vtx_lst, _halo_cache.gcell_vtx_lst,
+             gcell_vtx_idx[n_ghost_cells]*sizeof(cs_lnum_t));
+    }
+
+  }
+
+  memcpy(mesh->i_face_cells, _halo_cache.i_face_cells,
+         mesh->n_i_faces*sizeof(cs_lnum_2_t));
+
+  if (mesh->n_ghost_cells > 0)
+    BFT_REALLOC(mesh->cell_family, mesh->n_cells_with_ghosts, cs_lnum_t);
+
+  cs_halo_update_buffers(halo);
+
+  *p_gcell_vtx_idx = gcell_vtx_idx;
+  *p_gcell_vtx_lst = gcell_vtx_lst;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate caching of halo structures between definitions.
+ *
+ * When the cache is active, the structures built by the latest call to
+ * cs_mesh_halo_define() are retained (at the cost of a halo-sized memory
+ * overhead), and reused by the next call if the local mesh sizes and the
+ * face and vertex interface contents are unchanged on all ranks. This
+ * avoids a full ghost cell structure rebuild when a mesh modification
+ * did not affect parallel or periodic interfaces.
+ *
+ * Deactivating the cache frees the retained structures.
+ *
+ * parameters:
+ *   activate <-- true to activate the cache, false to deactivate it
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_set_cache(bool  activate)
+{
+  _halo_cache.active = activate;
+
+  if (_halo_cache.active == false)
+    _halo_cache_free();
+}
+
 /*----------------------------------------------------------------------------
  * Define halo structures for internal and distant ghost cells.
  *
@@ -2991,6 +3391,24 @@ cs_mesh_halo_define(cs_mesh_t           *mesh,
 
   halo->n_local_elts = mesh->n_cells;
 
+  /* When the halo cache is active and neither the mesh sizes nor the
+     interface information have changed since the previous definition,
+     restore the previous halo structures instead of rebuilding them. */
+
+  if (_halo_cache.active) {
+    if (_halo_cache_matches(mesh, face_ifs, vertex_ifs)) {
+
+      if (mesh->verbosity > 0) {
+        bft_printf(_("    Halo restored from previous definition\n"));
+        bft_printf_flush();
+      }
+
+      _halo_cache_restore(mesh, p_gcell_vtx_idx, p_gcell_vtx_lst);
+
+      return;
+    }
+  }
+
   /*  Define cell -> internal faces connectivity for ghost cells */
 
   _create_gcell_faces_connect(mesh,
@@ -3086,6 +3504,13 @@ cs_mesh_halo_define(cs_mesh_t           *mesh,
 
   cs_halo_update_buffers(halo);
 
+  if (_halo_cache.active)
+    _halo_cache_update(mesh,
+                       face_ifs,
+                       vertex_ifs,
+                       gcell_vtx_idx,
+                       gcell_vtx_lst);
+
 #if 0 /* for debugging purposes */
   cs_halo_dump(halo, 1);
 #endif
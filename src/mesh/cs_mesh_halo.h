@@ -43,6 +43,25 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate caching of halo structures between definitions.
+ *
+ * When the cache is active, the structures built by the latest call to
+ * cs_mesh_halo_define() are retained (at the cost of a halo-sized memory
+ * overhead), and reused by the next call if the local mesh sizes and the
+ * face and vertex interface contents are unchanged on all ranks. This
+ * avoids a full ghost cell structure rebuild when a mesh modification
+ * did not affect parallel or periodic interfaces.
+ *
+ * Deactivating the cache frees the retained structures.
+ *
+ * parameters:
+ *   activate <-- true to activate the cache, false to deactivate it
+ *---------------------------------------------------------------------------*/
+
+void
+cs_mesh_halo_set_cache(bool  activate);
+
 /*----------------------------------------------------------------------------
  * Define halo structures for internal and distant ghost cells.
  *
@@ -110,6 +110,8 @@ struct _cs_mesh_location_t {
   int                        *sub_ids;      /* List of mesh location ids */
   bool                        complement;   /* Take the complement ? */
   bool                        explicit_ids; /* Need explicit ids ? */
+  bool                        up_to_date;   /* Built since the associated
+                                               mesh was last modified ? */
 
   cs_lnum_t                   n_elts[3];    /* Number of associated elements:
                                                0: local,
@@ -305,6 +307,7 @@ _mesh_location_define(const char               *name,
   ml->sub_ids = NULL;
   ml->complement = false;
   ml->explicit_ids = false;
+  ml->up_to_date = false;
 
   for (i = 0; i < 3; i++)
     ml->n_elts[i] = 0;
@@ -549,6 +552,17 @@ cs_mesh_location_build(cs_mesh_t  *mesh,
     fvm_selector_t *selector = NULL;
     cs_mesh_location_t  *ml = _mesh_location + ml_id;
 
+    /* Locations based on selection criteria only depend on the mesh,
+       so the lists evaluated at the previous build may be reused as
+       long as it has not been modified (see
+       cs_mesh_location_invalidate) */
+
+    if (ml->select_str != NULL && ml->up_to_date && ml->mesh == mesh) {
+      if (ml->explicit_ids && explicit_ids_size < ml->n_elts[0])
+        explicit_ids_size = ml->n_elts[0];
+      continue;
+    }
+
     ml->mesh = mesh;
 
     if (ml->elt_list != NULL)
@@ -630,6 +644,8 @@ cs_mesh_location_build(cs_mesh_t  *mesh,
       }
     }
 
+    ml->up_to_date = true;
+
     if (ml->explicit_ids && explicit_ids_size < ml->n_elts[0])
       explicit_ids_size = ml->n_elts[0];
 
@@ -646,6 +662,26 @@ cs_mesh_location_build(cs_mesh_t  *mesh,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark all mesh locations as requiring a rebuild.
+ *
+ * Locations based on selection criteria are evaluated once per mesh, at
+ * the first call to \ref cs_mesh_location_build following this function,
+ * and reused by subsequent builds. This function must thus be called
+ * whenever the mesh is modified (it is called by
+ * \ref cs_mesh_init_selectors, so mesh modification procedures
+ * re-initializing the mesh selectors need no additional call).
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_location_invalidate(void)
+{
+  for (int i = 0; i < _n_mesh_locations; i++)
+    (_mesh_location + i)->up_to_date = false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define a new mesh location.
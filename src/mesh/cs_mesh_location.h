@@ -174,6 +174,20 @@ void
 cs_mesh_location_build(cs_mesh_t  *mesh,
                        int         id);
 
+/*----------------------------------------------------------------------------
+ * Mark all mesh locations as requiring a rebuild.
+ *
+ * Locations based on selection criteria are evaluated once per mesh, at
+ * the first call to cs_mesh_location_build following this function, and
+ * reused by subsequent builds. This function must thus be called whenever
+ * the mesh is modified (it is called by cs_mesh_init_selectors, so mesh
+ * modification procedures re-initializing the mesh selectors need no
+ * additional call).
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_location_invalidate(void);
+
 /*----------------------------------------------------------------------------
  * Define a new mesh location.
  *
@@ -339,276 +339,247 @@ _int_face_histogram(const cs_mesh_t  *mesh,
 }
 
 /*----------------------------------------------------------------------------
- * Compute weighting coefficient and center offsetting coefficient
- * for internal faces.
+ * Evaluate face warping angle.
  *
  * parameters:
- *   mesh             <-- pointer to mesh structure.
- *   mesh_quantities  <-- pointer to mesh quantities structures.
- *   weighting        <-> array for weigthing coefficient.
- *   offsetting       <-> array for offsetting coefficient.
+ *   idx_start       <-- first vertex index
+ *   idx_end         <-- last vertex index
+ *   face_vertex_id  <-- face -> vertices connectivity
+ *   face_normal     <-- face normal
+ *   vertex_coords   <-- vertices coordinates
+ *   face_warping    --> face warping angle
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_weighting_offsetting(const cs_mesh_t             *mesh,
-                              const cs_mesh_quantities_t  *mesh_quantities,
-                              cs_real_t                    weighting[],
-                              cs_real_t                    offsetting[])
+_get_face_warping(cs_lnum_t        idx_start,
+                  cs_lnum_t        idx_end,
+                  const cs_real_t  face_normal[],
+                  const cs_lnum_t  face_vertex_id[],
+                  const cs_real_t  vertex_coords[],
+                  double           face_warping[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3], face_normal[3];
-  cs_real_t  v0[3], v1[3], v2[3];
-
-  double  coef0 = 0, coef1 = 0, coef2 = 0;
-
-  const cs_lnum_t  dim = mesh->dim;
-
-  /* Compute weighting coefficient */
-  /*-------------------------------*/
-
-  /* Loop on internal faces */
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    /* Get local number of the cells in contact with the face */
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
-
-    /* Get information on mesh quantities */
-
-    for (i = 0; i < dim; i++) {
-
-      /* Center of gravity for each cell */
-
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
+  cs_lnum_t  i, idx, vertex_id1, vertex_id2;
+  double  edge_cos_alpha;
+  cs_real_t  vect[3];
 
-      /* Face center coordinates */
+  double  cos_alpha = 0.;
 
-      face_center[i] = mesh_quantities->i_face_cog[face_id*dim + i];
+  const int  dim = 3;
+  const double  rad_to_deg = 180. / acos(-1.);
 
-      /* Surface vector (orthogonal to the face) */
+  /* Loop on edges */
 
-      face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
+  for (idx = idx_start; idx < idx_end - 1; idx++) {
 
-    }
+    vertex_id1 = face_vertex_id[idx];
+    vertex_id2 = face_vertex_id[idx + 1];
 
-    /* Compute weighting coefficient with two approaches. Keep the max value. */
+    /* Get vertex coordinates */
 
-    for (i = 0; i < dim; i++) {
+    for (i = 0; i < dim; i++)
+      vect[i] =  vertex_coords[vertex_id2*dim + i]
+               - vertex_coords[vertex_id1*dim + i];
 
-      v0[i] = cell_center2[i] - cell_center1[i];
-      v1[i] = face_center[i] - cell_center1[i];
-      v2[i] = cell_center2[i] - face_center[i];
+    edge_cos_alpha = _COSINE_3D(vect, face_normal);
+    edge_cos_alpha = CS_ABS(edge_cos_alpha);
+    cos_alpha = CS_MAX(cos_alpha, edge_cos_alpha);
 
-    }
+  }
 
-    coef0 = _DOT_PRODUCT_3D(v0, face_normal);
-    coef1 = _DOT_PRODUCT_3D(v1, face_normal)/coef0;
-    coef2 = _DOT_PRODUCT_3D(v2, face_normal)/coef0;
+  /* Last edge */
 
-    weighting[face_id] = CS_MAX(coef1, coef2);
+  vertex_id1 = face_vertex_id[idx_end - 1];
+  vertex_id2 = face_vertex_id[idx_start];
 
-    /* Compute center offsetting coefficient */
-    /*---------------------------------------*/
+  /* Get vertex coordinates */
 
-    for (i = 0; i < dim; i++) {
-      v1[i] = mesh_quantities->dofij[face_id*3 + i];
-      v2[i] = mesh_quantities->i_face_normal[face_id*3 + i];
-    }
-    double of_s = _MODULE_3D(v1) * _MODULE_3D(v2);
+  for (i = 0; i < dim; i++)
+    vect[i] =  vertex_coords[vertex_id2*dim + i]
+             - vertex_coords[vertex_id1*dim + i];
 
-    offsetting[cell1] = CS_MAX(offsetting[cell1],
-        1. - pow(of_s / fabs(mesh_quantities->cell_vol[cell1]), 1./3.));
-    offsetting[cell2] = CS_MAX(offsetting[cell2],
-        1. - pow(of_s / fabs(mesh_quantities->cell_vol[cell2]), 1./3.));
+  edge_cos_alpha = _COSINE_3D(vect, face_normal);
+  edge_cos_alpha = CS_ABS(edge_cos_alpha);
+  cos_alpha = CS_MAX(cos_alpha, edge_cos_alpha);
+  cos_alpha = CS_MIN(cos_alpha, 1.);
 
-  } /* End of loop on faces */
+  *face_warping = 90. - acos(cos_alpha) * rad_to_deg;
 
 }
 
 /*----------------------------------------------------------------------------
- * Compute angle between face normal and segment based on centers of the
- * adjacent cells. Evaluates a level of non-orthogonality.
+ * Compute face warping, weighting, center offsetting, and orthogonality
+ * criteria in a single threaded sweep over faces.
+ *
+ * Interior faces are handled through the face numbering's groups and
+ * threads so that the cellwise offsetting maximum is computed without
+ * conflicts; other criteria are face-based, so boundary faces use a
+ * simple parallel loop.
+ *
+ * Any of the output arrays may be NULL, in which case the corresponding
+ * criterion is not computed.
  *
  * parameters:
  *   mesh             <-- pointer to mesh structure.
  *   mesh_quantities  <-- pointer to mesh quantities structures.
- *   i_face_ortho     <-> array for internal faces.
- *   b_face_ortho     <-> array for border faces.
+ *   i_face_warping   <-> warping angle for internal faces, or NULL
+ *   b_face_warping   <-> warping angle for border faces, or NULL
+ *   weighting        <-> weighting coefficient, or NULL
+ *   offsetting       <-> cell offsetting coefficient, or NULL
+ *   i_face_ortho     <-> non-orthogonality angle for internal faces, or NULL
+ *   b_face_ortho     <-> non-orthogonality angle for border faces, or NULL
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_orthogonality(const cs_mesh_t             *mesh,
-                       const cs_mesh_quantities_t  *mesh_quantities,
-                       cs_real_t                    i_face_ortho[],
-                       cs_real_t                    b_face_ortho[])
+_compute_quality_criteria(const cs_mesh_t             *mesh,
+                          const cs_mesh_quantities_t  *mesh_quantities,
+                          cs_real_t                    i_face_warping[],
+                          cs_real_t                    b_face_warping[],
+                          cs_real_t                    weighting[],
+                          cs_real_t                    offsetting[],
+                          cs_real_t                    i_face_ortho[],
+                          cs_real_t                    b_face_ortho[])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
-  double  cos_alpha;
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3];
-  cs_real_t  face_normal[3], vect[3];
+  const int n_i_groups = mesh->i_face_numbering->n_groups;
+  const int n_i_threads = mesh->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index
+    = mesh->i_face_numbering->group_index;
+
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)mesh_quantities->cell_cen;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)mesh_quantities->i_face_cog;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)mesh_quantities->i_face_normal;
+  const cs_real_3_t *restrict dofij
+    = (const cs_real_3_t *restrict)mesh_quantities->dofij;
+  const cs_real_t *restrict cell_vol = mesh_quantities->cell_vol;
 
   const double  rad_to_deg = 180. / acos(-1.);
-  const cs_lnum_t  dim = mesh->dim;
+
+  assert(mesh->dim == 3);
 
   /* Loop on internal faces */
   /*------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    /* Get local number of the cells beside the face */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
 
-    /* Get information on mesh quantities */
+        cs_real_t  v0[3], v1[3], v2[3];
 
-    for (i = 0; i < dim; i++) {
+        const cs_lnum_t  cell1 = i_face_cells[face_id][0];
+        const cs_lnum_t  cell2 = i_face_cells[face_id][1];
 
-      /* Center of gravity for each cell */
+        /* Evaluate warping for each edge of face. Keep the max. */
 
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
+        if (i_face_warping != NULL)
+          _get_face_warping(mesh->i_face_vtx_idx[face_id],
+                            mesh->i_face_vtx_idx[face_id + 1],
+                            i_face_normal[face_id],
+                            mesh->i_face_vtx_lst,
+                            mesh->vtx_coord,
+                            &(i_face_warping[face_id]));
 
-      /* Surface vector (orthogonal to the face) */
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          v0[i] = cell_cen[cell2][i] - cell_cen[cell1][i];
+          v1[i] = i_face_cog[face_id][i] - cell_cen[cell1][i];
+          v2[i] = cell_cen[cell2][i] - i_face_cog[face_id][i];
+        }
 
-      face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
+        /* Compute weighting coefficient with two approaches.
+           Keep the max value. */
 
-    }
+        if (weighting != NULL) {
+          double coef0 = _DOT_PRODUCT_3D(v0, i_face_normal[face_id]);
+          double coef1 = _DOT_PRODUCT_3D(v1, i_face_normal[face_id])/coef0;
+          double coef2 = _DOT_PRODUCT_3D(v2, i_face_normal[face_id])/coef0;
+          weighting[face_id] = CS_MAX(coef1, coef2);
+        }
 
-    /* Compute angle which evaluates the non-orthogonality. */
+        /* Compute center offsetting coefficient */
 
-    for (i = 0; i < dim; i++)
-      vect[i] = cell_center2[i] - cell_center1[i];
+        if (offsetting != NULL) {
+          double of_s =   _MODULE_3D(dofij[face_id])
+                        * _MODULE_3D(i_face_normal[face_id]);
+          offsetting[cell1] = CS_MAX(offsetting[cell1],
+              1. - pow(of_s / fabs(cell_vol[cell1]), 1./3.));
+          offsetting[cell2] = CS_MAX(offsetting[cell2],
+              1. - pow(of_s / fabs(cell_vol[cell2]), 1./3.));
+        }
 
-    cos_alpha = _COSINE_3D(vect, face_normal);
-    cos_alpha = CS_ABS(cos_alpha);
-    cos_alpha = CS_MIN(cos_alpha, 1);
+        /* Compute angle which evaluates the non-orthogonality. */
 
-    if (cos_alpha < 1.)
-      i_face_ortho[face_id] = acos(cos_alpha) * rad_to_deg;
-    else
-      i_face_ortho[face_id] = 0.;
+        if (i_face_ortho != NULL) {
+          double cos_alpha = _COSINE_3D(v0, i_face_normal[face_id]);
+          cos_alpha = CS_ABS(cos_alpha);
+          cos_alpha = CS_MIN(cos_alpha, 1);
+          if (cos_alpha < 1.)
+            i_face_ortho[face_id] = acos(cos_alpha) * rad_to_deg;
+          else
+            i_face_ortho[face_id] = 0.;
+        }
 
-  } /* End of loop on internal faces */
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
 
   /* Loop on border faces */
   /*----------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
-
-    /* Get local number of the cell beside the face */
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
-    cell1 = mesh->b_face_cells[face_id];
+    cs_real_t  vect[3];
 
-    /* Get information on mesh quantities */
+    const cs_lnum_t  cell1 = mesh->b_face_cells[face_id];
+    const cs_real_t  *face_normal
+      = mesh_quantities->b_face_normal + face_id*3;
 
-    for (i = 0; i < dim; i++) {
+    /* Evaluate warping for each edge */
 
-      /* Center of gravity of the cell */
+    if (b_face_warping != NULL)
+      _get_face_warping(mesh->b_face_vtx_idx[face_id],
+                        mesh->b_face_vtx_idx[face_id + 1],
+                        face_normal,
+                        mesh->b_face_vtx_lst,
+                        mesh->vtx_coord,
+                        &(b_face_warping[face_id]));
 
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
+    /* Compute alpha: angle wich evaluate the difference with orthogonality. */
 
-      /* Face center coordinates */
+    if (b_face_ortho != NULL) {
 
-      face_center[i] = mesh_quantities->b_face_cog[face_id*dim + i];
+      for (cs_lnum_t i = 0; i < 3; i++)
+        vect[i] =   mesh_quantities->b_face_cog[face_id*3 + i]
+                  - cell_cen[cell1][i];
 
-      /* Surface vector (orthogonal to the face) */
+      double cos_alpha = _COSINE_3D(vect, face_normal);
+      cos_alpha = CS_ABS(cos_alpha);
+      cos_alpha = CS_MIN(cos_alpha, 1);
 
-      face_normal[i] = mesh_quantities->b_face_normal[face_id*dim + i];
+      if (cos_alpha < 1.)
+        b_face_ortho[face_id] = acos(cos_alpha) * rad_to_deg;
+      else
+        b_face_ortho[face_id] = 0.;
 
     }
 
-    /* Compute alpha: angle wich evaluate the difference with orthogonality. */
-
-    for (i = 0; i < dim; i++)
-      vect[i] = face_center[i] - cell_center1[i];
-
-    cos_alpha = _COSINE_3D(vect, face_normal);
-    cos_alpha = CS_ABS(cos_alpha);
-    cos_alpha = CS_MIN(cos_alpha, 1);
-
-    if (cos_alpha < 1.)
-      b_face_ortho[face_id] = acos(cos_alpha) * rad_to_deg;
-    else
-      b_face_ortho[face_id] = 0.;
-
   } /* End of loop on border faces */
 
 }
 
-/*----------------------------------------------------------------------------
- * Evaluate face warping angle.
- *
- * parameters:
- *   idx_start       <-- first vertex index
- *   idx_end         <-- last vertex index
- *   face_vertex_id  <-- face -> vertices connectivity
- *   face_normal     <-- face normal
- *   vertex_coords   <-- vertices coordinates
- *   face_warping    --> face warping angle
- *----------------------------------------------------------------------------*/
-
-static void
-_get_face_warping(cs_lnum_t        idx_start,
-                  cs_lnum_t        idx_end,
-                  const cs_real_t  face_normal[],
-                  const cs_lnum_t  face_vertex_id[],
-                  const cs_real_t  vertex_coords[],
-                  double           face_warping[])
-{
-  cs_lnum_t  i, idx, vertex_id1, vertex_id2;
-  double  edge_cos_alpha;
-  cs_real_t  vect[3];
-
-  double  cos_alpha = 0.;
-
-  const int  dim = 3;
-  const double  rad_to_deg = 180. / acos(-1.);
-
-  /* Loop on edges */
-
-  for (idx = idx_start; idx < idx_end - 1; idx++) {
-
-    vertex_id1 = face_vertex_id[idx];
-    vertex_id2 = face_vertex_id[idx + 1];
-
-    /* Get vertex coordinates */
-
-    for (i = 0; i < dim; i++)
-      vect[i] =  vertex_coords[vertex_id2*dim + i]
-               - vertex_coords[vertex_id1*dim + i];
-
-    edge_cos_alpha = _COSINE_3D(vect, face_normal);
-    edge_cos_alpha = CS_ABS(edge_cos_alpha);
-    cos_alpha = CS_MAX(cos_alpha, edge_cos_alpha);
-
-  }
-
-  /* Last edge */
-
-  vertex_id1 = face_vertex_id[idx_end - 1];
-  vertex_id2 = face_vertex_id[idx_start];
-
-  /* Get vertex coordinates */
-
-  for (i = 0; i < dim; i++)
-    vect[i] =  vertex_coords[vertex_id2*dim + i]
-             - vertex_coords[vertex_id1*dim + i];
-
-  edge_cos_alpha = _COSINE_3D(vect, face_normal);
-  edge_cos_alpha = CS_ABS(edge_cos_alpha);
-  cos_alpha = CS_MAX(cos_alpha, edge_cos_alpha);
-  cos_alpha = CS_MIN(cos_alpha, 1.);
-
-  *face_warping = 90. - acos(cos_alpha) * rad_to_deg;
-
-}
-
 /*----------------------------------------------------------------------------
  * Transform face values to cell values using the maximum value
  * of a cell's faces.
@@ -857,6 +828,7 @@ _compute_warp_error(const cs_mesh_t              *mesh,
   /* Build cell -> face connectivity */
   _build_c2f(mesh, &c2f_idx, &c2f_ids);
 
+# pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < mesh->n_cells; c_id++) {
 
     const cs_real_t  invvol_c = 1/vol[c_id];
@@ -934,33 +906,24 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
                                 cs_real_t           i_face_warping[],
                                 cs_real_t           b_face_warping[])
 {
-  cs_lnum_t  i, face_id, idx_start, idx_end;
-  cs_real_t  this_face_normal[3];
-
-  const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_b_faces = mesh->n_b_faces;
   const cs_lnum_t  *i_face_vtx_idx = mesh->i_face_vtx_idx;
   const cs_lnum_t  *b_face_vtx_idx = mesh->b_face_vtx_idx;
 
-  assert(dim == 3);
+  assert(mesh->dim == 3);
 
   /* Compute warping for internal faces */
   /*------------------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    /* Get normal to the face */
-
-    for (i = 0; i < dim; i++)
-      this_face_normal[i] = i_face_normal[face_id*dim + i];
+# pragma omp parallel for if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
 
     /* Evaluate warping for each edge of face. Keep the max. */
 
-    idx_start = i_face_vtx_idx[face_id];
-    idx_end = i_face_vtx_idx[face_id + 1];
-
-    _get_face_warping(idx_start,
-                      idx_end,
-                      this_face_normal,
+    _get_face_warping(i_face_vtx_idx[face_id],
+                      i_face_vtx_idx[face_id + 1],
+                      i_face_normal + face_id*3,
                       mesh->i_face_vtx_lst,
                       mesh->vtx_coord,
                       &(i_face_warping[face_id]));
@@ -970,21 +933,14 @@ cs_mesh_quality_compute_warping(const cs_mesh_t    *mesh,
   /* Compute warping for border faces */
   /*----------------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
-
-    /* Get face normal */
-
-    for (i = 0; i < dim; i++)
-      this_face_normal[i] = b_face_normal[face_id*dim + i];
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
     /* Evaluate warping for each edge */
 
-    idx_start = b_face_vtx_idx[face_id];
-    idx_end = b_face_vtx_idx[face_id + 1];
-
-    _get_face_warping(idx_start,
-                      idx_end,
-                      this_face_normal,
+    _get_face_warping(b_face_vtx_idx[face_id],
+                      b_face_vtx_idx[face_id + 1],
+                      b_face_normal + face_id*3,
                       mesh->b_face_vtx_lst,
                       mesh->vtx_coord,
                       &(b_face_warping[face_id]));
@@ -1005,8 +961,6 @@ void
 cs_mesh_quality(const cs_mesh_t             *mesh,
                 const cs_mesh_quantities_t  *mesh_quantities)
 {
-  cs_lnum_t  i;
-
   bool  compute_volume = true;
   bool  compute_weighting = true;
   bool  compute_orthogonality = true;
@@ -1068,27 +1022,61 @@ cs_mesh_quality(const cs_mesh_t             *mesh,
   /* Evaluate mesh quality criteria */
   /*--------------------------------*/
 
-  /*--------------*/
-  /* Face warping */
-  /*--------------*/
+  /* Face warping, weighting, offsetting, and orthogonality are
+     computed in a single threaded sweep over faces */
 
-  if (compute_warping == true) {
+  double  *i_face_warping = NULL, *b_face_warping = NULL;
+  double  *weighting = NULL, *offsetting = NULL;
+  double  *i_face_ortho = NULL, *b_face_ortho = NULL;
+
+  {
+    cs_lnum_t wa_size = 0;
 
-    double  *i_face_warping = NULL, *b_face_warping = NULL;
+    if (compute_warping == true)
+      wa_size += n_i_faces + n_b_faces;
+    if (compute_weighting == true)
+      wa_size += n_i_faces + n_cells_wghosts;
+    if (compute_orthogonality == true)
+      wa_size += n_i_faces + n_b_faces;
 
-    BFT_MALLOC(working_array, n_i_faces + n_b_faces, double);
+    BFT_MALLOC(working_array, wa_size, double);
 
-    for (i = 0; i < n_i_faces + n_b_faces; i++)
-      working_array[i] = 0.;
+#   pragma omp parallel for if (wa_size > CS_THR_MIN)
+    for (cs_lnum_t j = 0; j < wa_size; j++)
+      working_array[j] = 0.;
 
-    i_face_warping = working_array;
-    b_face_warping = working_array + n_i_faces;
+    double *p = working_array;
 
-    cs_mesh_quality_compute_warping(mesh,
-                                    mesh_quantities->i_face_normal,
-                                    mesh_quantities->b_face_normal,
-                                    i_face_warping,
-                                    b_face_warping);
+    if (compute_warping == true) {
+      i_face_warping = p;
+      b_face_warping = p + n_i_faces;
+      p += n_i_faces + n_b_faces;
+    }
+    if (compute_weighting == true) {
+      weighting = p;
+      offsetting = p + n_i_faces;
+      p += n_i_faces + n_cells_wghosts;
+    }
+    if (compute_orthogonality == true) {
+      i_face_ortho = p;
+      b_face_ortho = p + n_i_faces;
+    }
+
+    _compute_quality_criteria(mesh,
+                              mesh_quantities,
+                              i_face_warping,
+                              b_face_warping,
+                              weighting,
+                              offsetting,
+                              i_face_ortho,
+                              b_face_ortho);
+  }
+
+  /*--------------*/
+  /* Face warping */
+  /*--------------*/
+
+  if (compute_warping == true) {
 
     /* Display histograms */
 
@@ -1161,8 +1149,6 @@ cs_mesh_quality(const cs_mesh_t             *mesh,
                         b_face_warping,
                         ts);
 
-    BFT_FREE(working_array);
-
   } /* End of face warping treatment */
 
   /*----------------------------------------------*/
@@ -1171,23 +1157,6 @@ cs_mesh_quality(const cs_mesh_t             *mesh,
 
   if (compute_weighting == true) {
 
-    double  *weighting = NULL, *offsetting = NULL;
-
-    /* Only defined on internal faces */
-
-    BFT_MALLOC(working_array, n_i_faces + n_cells_wghosts, double);
-
-    for (i = 0; i < n_i_faces + n_cells_wghosts; i++)
-      working_array[i] = 0.;
-
-    weighting = working_array;
-    offsetting = working_array + n_i_faces;
-
-    _compute_weighting_offsetting(mesh,
-                                  mesh_quantities,
-                                  weighting,
-                                  offsetting);
-
     /* Display histograms */
 
     if (mesh->n_g_i_faces > 0) {
@@ -1248,8 +1217,6 @@ cs_mesh_quality(const cs_mesh_t             *mesh,
 
     } /* End of post-processing on volume */
 
-    BFT_FREE(working_array);
-
   } /* End of off-setting and weighting treatment */
 
   /*---------------------*/
@@ -1258,21 +1225,6 @@ cs_mesh_quality(const cs_mesh_t             *mesh,
 
   if (compute_orthogonality == true) {
 
-    double  *i_face_ortho = NULL, *b_face_ortho = NULL;
-
-    BFT_MALLOC(working_array, n_i_faces + n_b_faces, double);
-
-    for (i = 0; i < n_i_faces + n_b_faces; i++)
-      working_array[i] = 0.;
-
-    i_face_ortho = working_array;
-    b_face_ortho = working_array + n_i_faces;
-
-    _compute_orthogonality(mesh,
-                           mesh_quantities,
-                           i_face_ortho,
-                           b_face_ortho);
-
     /* Display histograms */
 
     if (mesh->n_g_i_faces > 0) {
@@ -1336,10 +1288,10 @@ cs_mesh_quality(const cs_mesh_t             *mesh,
                         b_face_ortho,
                         ts);
 
-    BFT_FREE(working_array);
-
   } /* End of non-orthogonality treatment */
 
+  BFT_FREE(working_array);
+
   if (face_to_cell != NULL)
     BFT_FREE(face_to_cell);
 
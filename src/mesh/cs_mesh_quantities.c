@@ -545,6 +545,46 @@ _compute_cell_cocg_it(const cs_mesh_t        *m,
     cs_math_33_inv_cramer_in_place(cocg[cell_id]);
 }
 
+/*----------------------------------------------------------------------------
+ * Get face numbering ranges for threaded face -> cell scatter loops.
+ *
+ * When no face numbering is available (for example during mesh
+ * modification, before renumbering), a single group and thread covering
+ * all faces is returned, so the calling loop runs serially.
+ *
+ * parameters:
+ *   numbering   <--  face numbering structure, or NULL
+ *   n_faces     <--  number of faces
+ *   n_groups    -->  number of face groups
+ *   n_threads   -->  number of threads
+ *   group_index -->  group index (start and past-the-end face ids
+ *                    for each group and thread)
+ *   _index      <->  caller work array of size 2, used as group index
+ *                    when numbering is NULL
+ *----------------------------------------------------------------------------*/
+
+static void
+_get_face_groups(const cs_numbering_t   *numbering,
+                 cs_lnum_t               n_faces,
+                 int                    *n_groups,
+                 int                    *n_threads,
+                 const cs_lnum_t       **group_index,
+                 cs_lnum_t               _index[2])
+{
+  if (numbering != NULL) {
+    *n_groups = numbering->n_groups;
+    *n_threads = numbering->n_threads;
+    *group_index = numbering->group_index;
+  }
+  else {
+    _index[0] = 0;
+    _index[1] = n_faces;
+    *n_groups = 1;
+    *n_threads = 1;
+    *group_index = _index;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Build the geometrical matrix linear gradient correction
  *
@@ -586,7 +626,17 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
   cs_real_t    *restrict corr_grad_lin_det = fvq->corr_grad_lin_det;
   cs_real_33_t *restrict corr_grad_lin     = fvq->corr_grad_lin;
 
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  cs_lnum_t _i_index[2], _b_index[2];
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _get_face_groups(m->i_face_numbering, n_i_faces,
+                   &n_i_groups, &n_i_threads, &i_group_index, _i_index);
+  _get_face_groups(m->b_face_numbering, n_b_faces,
+                   &n_b_groups, &n_b_threads, &b_group_index, _b_index);
+
   /* Initialization */
+# pragma omp parallel for if (n_cells_with_ghosts > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
     for (cs_lnum_t i = 0; i < 3; i++) {
       for (cs_lnum_t j = 0; j < 3; j++)
@@ -595,31 +645,60 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
   }
 
   /* Internal faces contribution */
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
-    cs_lnum_t cell_id1 = i_face_cells[face_id][0];
-    cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
-    for (cs_lnum_t i = 0; i < 3; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++) {
-        cs_real_t flux = i_face_cog[face_id][i] * i_face_normal[face_id][j];
-        corr_grad_lin[cell_id1][i][j] += flux;
-        corr_grad_lin[cell_id2][i][j] -= flux;
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t cell_id1 = i_face_cells[face_id][0];
+        cs_lnum_t cell_id2 = i_face_cells[face_id][1];
+
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          for (cs_lnum_t j = 0; j < 3; j++) {
+            cs_real_t flux = i_face_cog[face_id][i] * i_face_normal[face_id][j];
+            corr_grad_lin[cell_id1][i][j] += flux;
+            corr_grad_lin[cell_id2][i][j] -= flux;
+          }
+        }
+
       }
+
     }
+
   }
 
   /* Boundary faces contribution */
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-    cs_lnum_t cell_id = b_face_cells[face_id];
-    for (cs_lnum_t i = 0; i < 3; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++) {
-        cs_real_t flux = b_face_cog[face_id][i] * b_face_normal[face_id][j];
-        corr_grad_lin[cell_id][i][j] += flux;
+
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+      for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t cell_id = b_face_cells[face_id];
+        for (cs_lnum_t i = 0; i < 3; i++) {
+          for (cs_lnum_t j = 0; j < 3; j++) {
+            cs_real_t flux = b_face_cog[face_id][i] * b_face_normal[face_id][j];
+            corr_grad_lin[cell_id][i][j] += flux;
+          }
+        }
+
       }
+
     }
+
   }
 
   /* Matrix inversion */
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
     double cocg11 = corr_grad_lin[cell_id][0][0] / cell_vol[cell_id];
     double cocg12 = corr_grad_lin[cell_id][1][0] / cell_vol[cell_id];
@@ -808,7 +887,8 @@ _compute_face_normal(cs_lnum_t         n_faces,
  * Compute quantities associated to faces (border or internal)
  *
  * parameters:
- *   n_faces         <--  number of faces
+ *   n_faces         <--  number of faces (or size of face_ids list)
+ *   face_ids        <--  list of faces to handle, or NULL for all
  *   vtx_coord       <--  vertex coordinates
  *   face_vtx_idx    <--  "face -> vertices" connectivity index
  *   face_vtx        <--  "face -> vertices" connectivity
@@ -832,6 +912,7 @@ _compute_face_normal(cs_lnum_t         n_faces,
 
 static void
 _compute_face_quantities(const cs_lnum_t    n_faces,
+                         const cs_lnum_t    face_ids[],
                          const cs_real_3_t  vtx_coord[],
                          const cs_lnum_t    face_vtx_idx[],
                          const cs_lnum_t    face_vtx[],
@@ -849,7 +930,9 @@ _compute_face_quantities(const cs_lnum_t    n_faces,
   /* Loop on faces */
 
 # pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+  for (cs_lnum_t f_idx = 0; f_idx < n_faces; f_idx++) {
+
+    const cs_lnum_t f_id = (face_ids != NULL) ? face_ids[f_idx] : f_idx;
 
     /* Define the polygon (P) according to the vertices (Pi) of the face */
 
@@ -1019,19 +1102,23 @@ _compute_face_quantities(const cs_lnum_t    n_faces,
  * Compute face surfaces based on face norms.
  *
  * parameters:
- *   n_faces         <--  number of faces
+ *   n_faces         <--  number of faces (or size of face_ids list)
+ *   face_ids        <--  list of faces to handle, or NULL for all
  *   face_norm       <--  face surface normals
  *   face_surf       -->  face surfaces
  *----------------------------------------------------------------------------*/
 
 static void
 _compute_face_surface(cs_lnum_t        n_faces,
+                      const cs_lnum_t  face_ids[],
                       const cs_real_t  face_norm[],
                       cs_real_t        face_surf[])
 {
 # pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++)
+  for (cs_lnum_t f_idx = 0; f_idx < n_faces; f_idx++) {
+    const cs_lnum_t f_id = (face_ids != NULL) ? face_ids[f_idx] : f_idx;
     face_surf[f_id] = cs_math_3_norm(face_norm + f_id*3);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -1087,6 +1174,7 @@ _adjust_face_cog_v11_v52(cs_lnum_t         n_faces,
   /* Loop on faces
    --------------- */
 
+# pragma omp parallel for  if (n_faces > CS_THR_MIN)
   for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
 
     cs_real_t tri_vol_part = 0.;
@@ -1218,6 +1306,7 @@ _refine_warped_face_centers(cs_lnum_t          n_faces,
 
   /* Loop on faces */
 
+# pragma omp parallel for  if (n_faces > CS_THR_MIN)
   for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
 
     /* Define the polygon (P) according to the vertices (Pi) of the face */
@@ -1524,7 +1613,13 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
 /*!
  * \brief  Compute cell centers and volumes.
  *
+ * When a cell selection flag is given, only flagged cells are updated
+ * (the approximate cell centers used as a basis for the computation are
+ * still updated for all cells).
+ *
  * \param[in]   mesh         pointer to mesh structure
+ * \param[in]   c_flag       cell selection flag (1: update; 0: keep),
+ *                           or NULL for all
  * \param[in]   i_face_norm  surface normal of internal faces
  * \param[in]   i_face_cog   center of gravity of internal faces
  * \param[in]   b_face_norm  surface normal of border faces
@@ -1536,6 +1631,7 @@ _correct_cell_face_center(const cs_mesh_t  *mesh,
 
 static void
 _compute_cell_quantities(const cs_mesh_t    *mesh,
+                         const cs_lnum_t     c_flag[],
                          const cs_real_3_t   i_face_norm[],
                          const cs_real_3_t   i_face_cog[],
                          const cs_real_3_t   b_face_norm[],
@@ -1570,46 +1666,84 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
                                     (const cs_real_t *)b_face_cog,
                                     (cs_real_t *)a_cell_cen);
 
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  cs_lnum_t _i_index[2], _b_index[2];
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _get_face_groups(mesh->i_face_numbering, n_i_faces,
+                   &n_i_groups, &n_i_threads, &i_group_index, _i_index);
+  _get_face_groups(mesh->b_face_numbering, n_b_faces,
+                   &n_b_groups, &n_b_threads, &b_group_index, _b_index);
+
   /* Initialization */
 
-  for (cs_lnum_t j = 0; j < n_cells_ext; j++)
-    cell_vol[j] = 0.;
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t j = 0; j < n_cells_ext; j++) {
+    if (c_flag == NULL || c_flag[j])
+      cell_vol[j] = 0.;
+  }
 
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
   for (cs_lnum_t j = 0; j < n_cells_ext; j++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      cell_cen[j][i] = 0.;
+    if (c_flag == NULL || c_flag[j]) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[j][i] = 0.;
+    }
   }
 
   /* Loop on interior faces
      ---------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Implicit subdivision of cell into face vertices-cell-center pyramids */
+        /* For each cell sharing the internal face, we update
+         * cell_cen and cell_area */
+
+        cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        cs_lnum_t c_id2 = i_face_cells[f_id][1];
+
+        if (c_flag != NULL) {
+          if (c_id1 > -1 && c_flag[c_id1] == 0)
+            c_id1 = -1;
+          if (c_id2 > -1 && c_flag[c_id2] == 0)
+            c_id2 = -1;
+          if (c_id1 < 0 && c_id2 < 0)
+            continue;
+        }
+
+        /* Implicit subdivision of cell into face
+           vertices-cell-center pyramids */
+
+        if (c_id1 > -1) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                             i_face_cog[f_id],
+                                             i_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id1][i]);
+          cell_vol[c_id1] += pyra_vol_3;
+        }
+        if (c_id2 > -1) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                             a_cell_cen[c_id2],
+                                             i_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id2][i]);
+          cell_vol[c_id2] += pyra_vol_3;
+        }
+
+      }
 
-    if (c_id1 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
-                                                            i_face_cog[f_id],
-                                                            i_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
-    }
-    if (c_id2 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(i_face_cog[f_id],
-                                                            a_cell_cen[c_id2],
-                                                            i_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id2][i]);
-      cell_vol[c_id2] += pyra_vol_3;
     }
 
   } /* End of loop on interior faces */
@@ -1617,25 +1751,42 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
   /* Loop on boundary faces
      --------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    cs_lnum_t c_id1 = b_face_cells[f_id];
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
 
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
+        /* For each cell sharing a border face, we update the numerator
+         * of cell_cen and cell_area */
+
+        cs_lnum_t c_id1 = b_face_cells[f_id];
+
+        if (c_flag != NULL && c_id1 > -1) {
+          if (c_flag[c_id1] == 0)
+            c_id1 = -1;
+        }
+
+        /* Computation of the area of the face
+           (note that c_id1 == -1 may happen for isolated faces,
+           which are cleaned afterwards) */
+
+        if (c_id1 > -1) {
+          cs_real_t pyra_vol_3
+            = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                             b_face_cog[f_id],
+                                             b_face_norm[f_id]);
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
+                                               + 0.25*a_cell_cen[c_id1][i]);
+          cell_vol[c_id1] += pyra_vol_3;
+        }
+
+      }
 
-    if (c_id1 > -1) {
-      cs_real_t pyra_vol_3 = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
-                                                            b_face_cog[f_id],
-                                                            b_face_norm[f_id]);
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
-                                           + 0.25*a_cell_cen[c_id1][i]);
-      cell_vol[c_id1] += pyra_vol_3;
     }
 
   } /* End of loop on boundary faces */
@@ -1645,8 +1796,14 @@ _compute_cell_quantities(const cs_mesh_t    *mesh,
   /* Loop on cells to finalize the computation
      ----------------------------------------- */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
+    if (c_flag != NULL) {
+      if (c_flag[c_id] == 0)
+        continue;
+    }
+
     for (cs_lnum_t i = 0; i < 3; i++)
       cell_cen[c_id][i] /= cell_vol[c_id];
 
@@ -1927,6 +2084,8 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
  *
  * parameters:
  *   mesh           <--  pointer to mesh structure
+ *   c_flag         <--  cell selection flag (1: update; 0: keep),
+ *                       or NULL for all
  *   i_face_norm    <--  surface normal of internal faces
  *   i_face_cog     <--  center of gravity of internal faces
  *   b_face_norm    <--  surface normal of border faces
@@ -1937,6 +2096,7 @@ _recompute_cell_cen_face(const cs_mesh_t     *mesh,
 
 static void
 _compute_cell_volume(const cs_mesh_t   *mesh,
+                     const cs_lnum_t    c_flag[],
                      const cs_real_3_t  i_face_norm[],
                      const cs_real_3_t  i_face_cog[],
                      const cs_real_3_t  b_face_norm[],
@@ -1946,41 +2106,87 @@ _compute_cell_volume(const cs_mesh_t   *mesh,
 {
   const cs_real_t  a_third = 1.0/3.0;
 
+  const cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  cs_lnum_t _i_index[2], _b_index[2];
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _get_face_groups(mesh->i_face_numbering, mesh->n_i_faces,
+                   &n_i_groups, &n_i_threads, &i_group_index, _i_index);
+  _get_face_groups(mesh->b_face_numbering, mesh->n_b_faces,
+                   &n_b_groups, &n_b_threads, &b_group_index, _b_index);
+
   /* Initialization */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells_with_ghosts; cell_id++)
-    cell_vol[cell_id] = 0;
+# pragma omp parallel for if (n_cells_with_ghosts > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
+    if (c_flag == NULL || c_flag[cell_id])
+      cell_vol[cell_id] = 0;
+  }
 
   /* Loop on internal faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_i_faces; fac_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t fac_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           fac_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           fac_id++) {
+
+        cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
+        cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+
+        if (c_flag == NULL || c_flag[cell_id1])
+          cell_vol[cell_id1]
+            += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                              i_face_cog[fac_id],
+                                              i_face_norm[fac_id]);
+        if (c_flag == NULL || c_flag[cell_id2])
+          cell_vol[cell_id2]
+            -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
+                                              i_face_cog[fac_id],
+                                              i_face_norm[fac_id]);
+      }
 
-    cs_lnum_t cell_id1 = mesh->i_face_cells[fac_id][0];
-    cs_lnum_t cell_id2 = mesh->i_face_cells[fac_id][1];
+    }
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
-    cell_vol[cell_id2] -= cs_math_3_distance_dot_product(cell_cen[cell_id2],
-                                                         i_face_cog[fac_id],
-                                                         i_face_norm[fac_id]);
   }
 
   /* Loop on border faces */
 
-  for (cs_lnum_t fac_id = 0; fac_id < mesh->n_b_faces; fac_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
+      for (cs_lnum_t fac_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           fac_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           fac_id++) {
+
+        cs_lnum_t cell_id1 = mesh->b_face_cells[fac_id];
+
+        if (c_flag == NULL || c_flag[cell_id1])
+          cell_vol[cell_id1]
+            += cs_math_3_distance_dot_product(cell_cen[cell_id1],
+                                              b_face_cog[fac_id],
+                                              b_face_norm[fac_id]);
+      }
+
+    }
 
-    cell_vol[cell_id1] += cs_math_3_distance_dot_product(cell_cen[cell_id1],
-                                                         b_face_cog[fac_id],
-                                                         b_face_norm[fac_id]);
   }
 
   /* First Computation of the volume */
 
-  for (cs_lnum_t cell_id = 0; cell_id < mesh->n_cells; cell_id++)
-    cell_vol[cell_id] *= a_third;
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+    if (c_flag == NULL || c_flag[cell_id])
+      cell_vol[cell_id] *= a_third;
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -2068,8 +2274,10 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
  * Compute some distances relative to faces and associated weighting.
  *
  * parameters:
- *   n_i_faces      <--  number of interior faces
- *   n_b_faces      <--  number of border  faces
+ *   n_i_faces      <--  number of interior faces (or size of i_face_ids)
+ *   n_b_faces      <--  number of border  faces (or size of b_face_ids)
+ *   i_face_ids     <--  list of interior faces to handle, or NULL for all
+ *   b_face_ids     <--  list of border faces to handle, or NULL for all
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
  *   i_face_norm    <--  surface normal of interior faces
@@ -2086,6 +2294,8 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
 static void
 _compute_face_distances(cs_lnum_t          n_i_faces,
                         cs_lnum_t          n_b_faces,
+                        const cs_lnum_t    i_face_ids[],
+                        const cs_lnum_t    b_face_ids[],
                         const cs_lnum_2_t  i_face_cells[],
                         const cs_lnum_t    b_face_cells[],
                         const cs_real_t    i_face_normal[][3],
@@ -2102,7 +2312,10 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+# pragma omp parallel for reduction(+:w_count) if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+
+    const cs_lnum_t face_id = (i_face_ids != NULL) ? i_face_ids[f_idx] : f_idx;
 
     const cs_real_t *face_nomal = i_face_normal[face_id];
     cs_real_t normal[3];
@@ -2167,7 +2380,10 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
 
   w_count = 0;
 
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+# pragma omp parallel for reduction(+:w_count) if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_idx = 0; f_idx < n_b_faces; f_idx++) {
+
+    const cs_lnum_t face_id = (b_face_ids != NULL) ? b_face_ids[f_idx] : f_idx;
 
     const cs_real_t *face_nomal = b_face_normal[face_id];
     cs_real_t normal[3];
@@ -2232,8 +2448,10 @@ _compute_face_distances(cs_lnum_t          n_i_faces,
  *
  * parameters:
  *   dim            <--  dimension
- *   n_i_faces      <--  number of interior faces
- *   n_b_faces      <--  number of border  faces
+ *   n_i_faces      <--  number of interior faces (or size of i_face_ids)
+ *   n_b_faces      <--  number of border  faces (or size of b_face_ids)
+ *   i_face_ids     <--  list of interior faces to handle, or NULL for all
+ *   b_face_ids     <--  list of border faces to handle, or NULL for all
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
  *   i_face_norm    <--  surface normal of interior faces
@@ -2253,6 +2471,8 @@ static void
 _compute_face_vectors(int                dim,
                       const cs_lnum_t    n_i_faces,
                       const cs_lnum_t    n_b_faces,
+                      const cs_lnum_t    i_face_ids[],
+                      const cs_lnum_t    b_face_ids[],
                       const cs_lnum_2_t  i_face_cells[],
                       const cs_lnum_t    b_face_cells[],
                       const cs_real_t    i_face_normal[],
@@ -2268,39 +2488,35 @@ _compute_face_vectors(int                dim,
                       cs_real_t          diipb[],
                       cs_real_t          dofij[])
 {
-  cs_lnum_t face_id;
-  cs_lnum_t cell_id;
-
-  cs_real_t dipjp, psi, pond;
-  cs_real_t surfnx, surfny, surfnz;
-  cs_real_t vecigx, vecigy, vecigz, vecijx, vecijy, vecijz;
-
   /* Interior faces */
 
-  for (face_id = 0; face_id < n_i_faces; face_id++) {
+# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+
+    const cs_lnum_t face_id = (i_face_ids != NULL) ? i_face_ids[f_idx] : f_idx;
 
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
 
     /* Normalized normal */
-    surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
-    surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
-    surfnz = i_face_normal[face_id*dim + 2] / i_face_surf[face_id];
+    cs_real_t surfnx = i_face_normal[face_id*dim]     / i_face_surf[face_id];
+    cs_real_t surfny = i_face_normal[face_id*dim + 1] / i_face_surf[face_id];
+    cs_real_t surfnz = i_face_normal[face_id*dim + 2] / i_face_surf[face_id];
 
     /* ---> IJ */
-    vecijx = cell_cen[cell_id2*dim]     - cell_cen[cell_id1*dim];
-    vecijy = cell_cen[cell_id2*dim + 1] - cell_cen[cell_id1*dim + 1];
-    vecijz = cell_cen[cell_id2*dim + 2] - cell_cen[cell_id1*dim + 2];
+    cs_real_t vecijx = cell_cen[cell_id2*dim]     - cell_cen[cell_id1*dim];
+    cs_real_t vecijy = cell_cen[cell_id2*dim + 1] - cell_cen[cell_id1*dim + 1];
+    cs_real_t vecijz = cell_cen[cell_id2*dim + 2] - cell_cen[cell_id1*dim + 2];
 
     /* ---> DIJPP = IJ.NIJ */
-    dipjp = vecijx*surfnx + vecijy*surfny + vecijz*surfnz;
+    cs_real_t dipjp = vecijx*surfnx + vecijy*surfny + vecijz*surfnz;
 
     /* ---> DIJPF = (IJ.NIJ).NIJ */
     dijpf[face_id*dim]     = dipjp*surfnx;
     dijpf[face_id*dim + 1] = dipjp*surfny;
     dijpf[face_id*dim + 2] = dipjp*surfnz;
 
-    pond = weight[face_id];
+    cs_real_t pond = weight[face_id];
 
     /* ---> DOFIJ = OF */
     dofij[face_id*dim]     = i_face_cog[face_id*dim]
@@ -2318,22 +2534,25 @@ _compute_face_vectors(int                dim,
 
   /* Border faces */
 
-  for (face_id = 0; face_id < n_b_faces; face_id++) {
+# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_idx = 0; f_idx < n_b_faces; f_idx++) {
+
+    const cs_lnum_t face_id = (b_face_ids != NULL) ? b_face_ids[f_idx] : f_idx;
 
-    cell_id = b_face_cells[face_id];
+    cs_lnum_t cell_id = b_face_cells[face_id];
 
     /* Normalized normal */
-    surfnx = b_face_normal[face_id*dim]     / b_face_surf[face_id];
-    surfny = b_face_normal[face_id*dim + 1] / b_face_surf[face_id];
-    surfnz = b_face_normal[face_id*dim + 2] / b_face_surf[face_id];
+    cs_real_t surfnx = b_face_normal[face_id*dim]     / b_face_surf[face_id];
+    cs_real_t surfny = b_face_normal[face_id*dim + 1] / b_face_surf[face_id];
+    cs_real_t surfnz = b_face_normal[face_id*dim + 2] / b_face_surf[face_id];
 
     /* ---> IG */
-    vecigx = b_face_cog[face_id*dim]     - cell_cen[cell_id*dim];
-    vecigy = b_face_cog[face_id*dim + 1] - cell_cen[cell_id*dim + 1];
-    vecigz = b_face_cog[face_id*dim + 2] - cell_cen[cell_id*dim + 2];
+    cs_real_t vecigx = b_face_cog[face_id*dim]     - cell_cen[cell_id*dim];
+    cs_real_t vecigy = b_face_cog[face_id*dim + 1] - cell_cen[cell_id*dim + 1];
+    cs_real_t vecigz = b_face_cog[face_id*dim + 2] - cell_cen[cell_id*dim + 2];
 
     /* ---> PSI = IG.NIJ */
-    psi = vecigx*surfnx + vecigy*surfny + vecigz*surfnz;
+    cs_real_t psi = vecigx*surfnx + vecigy*surfny + vecigz*surfnz;
 
     /* ---> DIIPB = IG - (IG.NIJ)NIJ */
     diipb[face_id*dim]     = vecigx - psi*surfnx;
@@ -2381,7 +2600,8 @@ _compute_face_vectors(int                dim,
  *
  * parameters:
  *   dim            <--  dimension
- *   n_i_faces      <--  number of interior faces
+ *   n_i_faces      <--  number of interior faces (or size of i_face_ids)
+ *   i_face_ids     <--  list of interior faces to handle, or NULL for all
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   i_face_norm    <--  surface normal of interior faces
  *   i_face_cog     <--  center of gravity of interior faces
@@ -2395,6 +2615,7 @@ _compute_face_vectors(int                dim,
 
 static void
 _compute_face_sup_vectors(const cs_lnum_t    n_i_faces,
+                          const cs_lnum_t    i_face_ids[],
                           const cs_lnum_2_t  i_face_cells[],
                           const cs_real_t    i_face_normal[][3],
                           const cs_real_t    i_face_cog[][3],
@@ -2409,7 +2630,10 @@ _compute_face_sup_vectors(const cs_lnum_t    n_i_faces,
 
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+# pragma omp parallel for reduction(+:w_count) if (n_i_faces > CS_THR_MIN)
+  for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+
+    const cs_lnum_t face_id = (i_face_ids != NULL) ? i_face_ids[f_idx] : f_idx;
 
     cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -2886,6 +3110,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
   /* Compute face centers of gravity, normals, and surfaces */
 
   _compute_face_quantities(n_i_faces,
+                           NULL,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->i_face_vtx_idx,
                            mesh->i_face_vtx_lst,
@@ -2893,10 +3118,12 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
                            (cs_real_3_t *)mesh_quantities->i_face_normal);
 
   _compute_face_surface(n_i_faces,
+                        NULL,
                         mesh_quantities->i_face_normal,
                         mesh_quantities->i_face_surf);
 
   _compute_face_quantities(n_b_faces,
+                           NULL,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->b_face_vtx_idx,
                            mesh->b_face_vtx_lst,
@@ -2904,6 +3131,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
                            (cs_real_3_t *)mesh_quantities->b_face_normal);
 
   _compute_face_surface(n_b_faces,
+                        NULL,
                         mesh_quantities->b_face_normal,
                         mesh_quantities->b_face_surf);
 
@@ -2960,6 +3188,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
     break;
   case 1:
     _compute_cell_quantities(mesh,
+                             NULL,
                              (const cs_real_3_t *)mesh_quantities->i_face_normal,
                              (const cs_real_3_t *)mesh_quantities->i_face_cog,
                              (const cs_real_3_t *)mesh_quantities->b_face_normal,
@@ -3017,6 +3246,7 @@ cs_mesh_quantities_compute_preprocess(const cs_mesh_t       *mesh,
   if (volume_computed == false)
     _compute_cell_volume
       (mesh,
+       NULL,
        (const cs_real_3_t *)(mesh_quantities->i_face_normal),
        (const cs_real_3_t *)(mesh_quantities->i_face_cog),
        (const cs_real_3_t *)(mesh_quantities->b_face_normal),
@@ -3196,6 +3426,8 @@ cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
 
   _compute_face_distances(mesh->n_i_faces,
                           mesh->n_b_faces,
+                          NULL,
+                          NULL,
                           (const cs_lnum_2_t *)(mesh->i_face_cells),
                           mesh->b_face_cells,
                           (const cs_real_3_t *)(mesh_quantities->i_face_normal),
@@ -3213,6 +3445,8 @@ cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
   _compute_face_vectors(dim,
                         mesh->n_i_faces,
                         mesh->n_b_faces,
+                        NULL,
+                        NULL,
                         (const cs_lnum_2_t *)(mesh->i_face_cells),
                         mesh->b_face_cells,
                         mesh_quantities->i_face_normal,
@@ -3232,6 +3466,7 @@ cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
 
   _compute_face_sup_vectors
     (mesh->n_i_faces,
+     NULL,
      (const cs_lnum_2_t *)(mesh->i_face_cells),
      (const cs_real_3_t *)(mesh_quantities->i_face_normal),
      (const cs_real_3_t *)(mesh_quantities->i_face_cog),
@@ -3279,6 +3514,338 @@ cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities incrementally after vertex displacement.
+ *
+ * Face centers, normals, and surfaces are recomputed only for faces with
+ * at least one moved vertex, cell centers and volumes only for cells
+ * adjacent to such faces, and face distances and non-orthogonality
+ * vectors only for faces adjacent to such cells; other entities keep
+ * their previous values, which are identical to those a full computation
+ * would produce. Gradient-related cocg terms are still updated globally.
+ *
+ * When quantities have not been computed yet, or active options require
+ * global passes (cell or face center corrections, porous models), a full
+ * computation is done instead.
+ *
+ * \param[in]       mesh             pointer to mesh structure
+ * \param[in, out]  mesh_quantities  pointer to mesh quantities structures
+ * \param[in]       vtx_moved        moved indicator for each vertex
+ *                                   (0: unchanged; 1: moved), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *mesh,
+                                cs_mesh_quantities_t  *mesh_quantities,
+                                const int              vtx_moved[])
+{
+  const cs_lnum_t  dim = mesh->dim;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t  n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t  n_cells_with_ghosts = mesh->n_cells_with_ghosts;
+
+  /* Fall back to a full computation when it has not been done yet, or
+     when active options require global passes */
+
+  if (   mesh_quantities->cell_cen == NULL
+      || mesh_quantities->weight == NULL
+      || vtx_moved == NULL
+      || cs_glob_porous_model > 0
+      || _ajust_face_cog_compat_v11_v52
+      || (cs_glob_mesh_quantities_flag & (  CS_CELL_CENTER_CORRECTION
+                                          | CS_CELL_FACE_CENTER_CORRECTION
+                                          | CS_CELL_VOLUME_RATIO_CORRECTION
+                                          | CS_FACE_CENTER_REFINE))) {
+    cs_mesh_quantities_compute(mesh, mesh_quantities);
+    return;
+  }
+
+  _n_computations++;
+
+  /* Select faces with at least one moved vertex, whose geometric
+     quantities must be recomputed */
+
+  cs_lnum_t  *i_face_ids = NULL, *b_face_ids = NULL;
+  cs_lnum_t  n_sel_i_faces = 0, n_sel_b_faces = 0;
+
+  BFT_MALLOC(i_face_ids, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(b_face_ids, n_b_faces, cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t s_id = mesh->i_face_vtx_idx[f_id];
+    cs_lnum_t e_id = mesh->i_face_vtx_idx[f_id + 1];
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      if (vtx_moved[mesh->i_face_vtx_lst[j]]) {
+        i_face_ids[n_sel_i_faces++] = f_id;
+        break;
+      }
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t s_id = mesh->b_face_vtx_idx[f_id];
+    cs_lnum_t e_id = mesh->b_face_vtx_idx[f_id + 1];
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      if (vtx_moved[mesh->b_face_vtx_lst[j]]) {
+        b_face_ids[n_sel_b_faces++] = f_id;
+        break;
+      }
+    }
+  }
+
+  /* Flag cells adjacent to those faces, whose center and volume must be
+     recomputed; remotely flagged ghost cells are obtained through halo
+     synchronization */
+
+  cs_lnum_t  *c_flag = NULL;
+
+  BFT_MALLOC(c_flag, n_cells_with_ghosts, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_with_ghosts; c_id++)
+    c_flag[c_id] = 0;
+
+  for (cs_lnum_t f_idx = 0; f_idx < n_sel_i_faces; f_idx++) {
+    cs_lnum_t f_id = i_face_ids[f_idx];
+    cs_lnum_t c_id1 = mesh->i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = mesh->i_face_cells[f_id][1];
+    if (c_id1 > -1)
+      c_flag[c_id1] = 1;
+    if (c_id2 > -1)
+      c_flag[c_id2] = 1;
+  }
+
+  for (cs_lnum_t f_idx = 0; f_idx < n_sel_b_faces; f_idx++) {
+    cs_lnum_t c_id = mesh->b_face_cells[b_face_ids[f_idx]];
+    if (c_id > -1)
+      c_flag[c_id] = 1;
+  }
+
+  if (mesh->halo != NULL)
+    cs_halo_sync_num(mesh->halo, CS_HALO_EXTENDED, c_flag);
+
+  /* Recompute geometric quantities of selected faces */
+
+  _compute_face_quantities(n_sel_i_faces,
+                           i_face_ids,
+                           (const cs_real_3_t *)mesh->vtx_coord,
+                           mesh->i_face_vtx_idx,
+                           mesh->i_face_vtx_lst,
+                           (cs_real_3_t *)mesh_quantities->i_face_cog,
+                           (cs_real_3_t *)mesh_quantities->i_face_normal);
+
+  _compute_face_surface(n_sel_i_faces,
+                        i_face_ids,
+                        mesh_quantities->i_face_normal,
+                        mesh_quantities->i_face_surf);
+
+  _compute_face_quantities(n_sel_b_faces,
+                           b_face_ids,
+                           (const cs_real_3_t *)mesh->vtx_coord,
+                           mesh->b_face_vtx_idx,
+                           mesh->b_face_vtx_lst,
+                           (cs_real_3_t *)mesh_quantities->b_face_cog,
+                           (cs_real_3_t *)mesh_quantities->b_face_normal);
+
+  _compute_face_surface(n_sel_b_faces,
+                        b_face_ids,
+                        mesh_quantities->b_face_normal,
+                        mesh_quantities->b_face_surf);
+
+  /* Recompute centers and volumes of flagged cells */
+
+  bool volume_computed = false;
+
+  switch (_cell_cen_algorithm) {
+
+  case 0:
+    cs_mesh_quantities_cell_faces_cog(mesh,
+                                      mesh_quantities->i_face_normal,
+                                      mesh_quantities->i_face_cog,
+                                      mesh_quantities->b_face_normal,
+                                      mesh_quantities->b_face_cog,
+                                      mesh_quantities->cell_cen);
+    break;
+  case 1:
+    _compute_cell_quantities(mesh,
+                             c_flag,
+                             (const cs_real_3_t *)mesh_quantities->i_face_normal,
+                             (const cs_real_3_t *)mesh_quantities->i_face_cog,
+                             (const cs_real_3_t *)mesh_quantities->b_face_normal,
+                             (const cs_real_3_t *)mesh_quantities->b_face_cog,
+                             (cs_real_3_t *)mesh_quantities->cell_cen,
+                             mesh_quantities->cell_vol);
+    volume_computed = true;
+    break;
+
+  default:
+    assert(0);
+
+  }
+
+  if (volume_computed == false)
+    _compute_cell_volume
+      (mesh,
+       c_flag,
+       (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+       (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+       (const cs_real_3_t *)(mesh_quantities->b_face_normal),
+       (const cs_real_3_t *)(mesh_quantities->b_face_cog),
+       (const cs_real_3_t *)(mesh_quantities->cell_cen),
+       mesh_quantities->cell_vol);
+
+  /* Synchronize geometric quantities */
+
+  if (mesh->halo != NULL) {
+
+    cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED,
+                             mesh_quantities->cell_cen, 3);
+    if (mesh->n_init_perio > 0)
+      cs_halo_perio_sync_coords(mesh->halo, CS_HALO_EXTENDED,
+                                mesh_quantities->cell_cen);
+
+    cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, mesh_quantities->cell_vol);
+
+  }
+
+  _cell_volume_reductions(mesh,
+                          mesh_quantities->cell_vol,
+                          &(mesh_quantities->min_vol),
+                          &(mesh_quantities->max_vol),
+                          &(mesh_quantities->tot_vol));
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    cs_real_t  _min_vol, _max_vol, _tot_vol;
+
+    MPI_Allreduce(&(mesh_quantities->min_vol), &_min_vol, 1, CS_MPI_REAL,
+                  MPI_MIN, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mesh_quantities->max_vol), &_max_vol, 1, CS_MPI_REAL,
+                  MPI_MAX, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mesh_quantities->tot_vol), &_tot_vol, 1, CS_MPI_REAL,
+                  MPI_SUM, cs_glob_mpi_comm);
+
+    mesh_quantities->min_vol = _min_vol;
+    mesh_quantities->max_vol = _max_vol;
+    mesh_quantities->tot_vol = _tot_vol;
+
+  }
+#endif
+
+  mesh_quantities->min_f_vol = mesh_quantities->min_vol;
+  mesh_quantities->max_f_vol = mesh_quantities->max_vol;
+  mesh_quantities->tot_f_vol = mesh_quantities->tot_vol;
+
+  /* Extend the face selection to faces adjacent to updated cells, whose
+     distances and non-orthogonality vectors depend on cell centers */
+
+  n_sel_i_faces = 0;
+  n_sel_b_faces = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t c_id1 = mesh->i_face_cells[f_id][0];
+    cs_lnum_t c_id2 = mesh->i_face_cells[f_id][1];
+    if (   (c_id1 > -1 && c_flag[c_id1])
+        || (c_id2 > -1 && c_flag[c_id2]))
+      i_face_ids[n_sel_i_faces++] = f_id;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t c_id = mesh->b_face_cells[f_id];
+    if (c_id > -1) {
+      if (c_flag[c_id])
+        b_face_ids[n_sel_b_faces++] = f_id;
+    }
+  }
+
+  BFT_FREE(c_flag);
+
+  /* Recompute distances relative to selected faces and associated
+     weighting */
+
+  _compute_face_distances(n_sel_i_faces,
+                          n_sel_b_faces,
+                          i_face_ids,
+                          b_face_ids,
+                          (const cs_lnum_2_t *)(mesh->i_face_cells),
+                          mesh->b_face_cells,
+                          (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+                          (const cs_real_3_t *)(mesh_quantities->b_face_normal),
+                          (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+                          (const cs_real_3_t *)(mesh_quantities->b_face_cog),
+                          (const cs_real_3_t *)(mesh_quantities->cell_cen),
+                          (const cs_real_t *)(mesh_quantities->cell_vol),
+                          mesh_quantities->i_dist,
+                          mesh_quantities->b_dist,
+                          mesh_quantities->weight);
+
+  /* Recompute vectors relative to selected faces to handle
+     non-orthogonalities */
+
+  _compute_face_vectors(dim,
+                        n_sel_i_faces,
+                        n_sel_b_faces,
+                        i_face_ids,
+                        b_face_ids,
+                        (const cs_lnum_2_t *)(mesh->i_face_cells),
+                        mesh->b_face_cells,
+                        mesh_quantities->i_face_normal,
+                        mesh_quantities->b_face_normal,
+                        mesh_quantities->i_face_cog,
+                        mesh_quantities->b_face_cog,
+                        mesh_quantities->i_face_surf,
+                        mesh_quantities->b_face_surf,
+                        mesh_quantities->cell_cen,
+                        mesh_quantities->weight,
+                        mesh_quantities->b_dist,
+                        mesh_quantities->dijpf,
+                        mesh_quantities->diipb,
+                        mesh_quantities->dofij);
+
+  _compute_face_sup_vectors
+    (n_sel_i_faces,
+     i_face_ids,
+     (const cs_lnum_2_t *)(mesh->i_face_cells),
+     (const cs_real_3_t *)(mesh_quantities->i_face_normal),
+     (const cs_real_3_t *)(mesh_quantities->i_face_cog),
+     (const cs_real_3_t *)(mesh_quantities->cell_cen),
+     mesh_quantities->cell_vol,
+     mesh_quantities->i_dist,
+     (cs_real_3_t *)(mesh_quantities->diipf),
+     (cs_real_3_t *)(mesh_quantities->djjpf));
+
+  BFT_FREE(i_face_ids);
+  BFT_FREE(b_face_ids);
+
+  /* Compute 3x3 cocg matrixes */
+
+  if (_compute_cocg_s_it == 1)
+    _compute_cell_cocg_s_it(mesh, mesh_quantities);
+
+  if (_compute_cocg_lsq == 1)
+    _compute_cell_cocg_lsq(mesh, mesh_quantities, NULL);
+
+  if (_compute_cocg_it == 1)
+    _compute_cell_cocg_it(mesh, mesh_quantities, NULL);
+
+  /* Build the geometrical matrix linear gradient correction */
+
+  if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_WARPED_CORRECTION)
+    _compute_corr_grad_lin(mesh, mesh_quantities);
+
+  if (mesh_quantities->min_vol <= 0.)
+    bft_printf(_(" --- Information on the volumes\n"
+                 "       Minimum control volume      = %14.7e\n"
+                 "       Maximum control volume      = %14.7e\n"
+                 "       Total volume for the domain = %14.7e\n"),
+               mesh_quantities->min_vol, mesh_quantities->max_vol,
+               mesh_quantities->tot_vol);
+}
+
 /*----------------------------------------------------------------------------
  * Compute min, max, and total
  *
@@ -3404,6 +3971,7 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
 
   _compute_face_sup_vectors
     (mesh->n_i_faces,
+     NULL,
      (const cs_lnum_2_t *)(mesh->i_face_cells),
      (const cs_real_3_t *)(mesh_quantities->i_face_normal),
      (const cs_real_3_t *)(mesh_quantities->i_face_cog),
@@ -3481,6 +4049,7 @@ cs_mesh_quantities_i_faces(const cs_mesh_t   *mesh,
   BFT_MALLOC(i_face_normal, mesh->n_i_faces * mesh->dim, cs_real_t);
 
   _compute_face_quantities(mesh->n_i_faces,
+                           NULL,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->i_face_vtx_idx,
                            mesh->i_face_vtx_lst,
@@ -3514,6 +4083,7 @@ cs_mesh_quantities_b_faces(const cs_mesh_t   *mesh,
   BFT_MALLOC(b_face_normal, mesh->n_b_faces * mesh->dim, cs_real_t);
 
   _compute_face_quantities(mesh->n_b_faces,
+                           NULL,
                            (const cs_real_3_t *)mesh->vtx_coord,
                            mesh->b_face_vtx_idx,
                            mesh->b_face_vtx_lst,
@@ -3580,6 +4150,16 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
 
   BFT_MALLOC(cell_area, n_cells_with_ghosts, cs_real_t);
 
+  int n_i_groups, n_i_threads, n_b_groups, n_b_threads;
+  cs_lnum_t _i_index[2], _b_index[2];
+  const cs_lnum_t *i_group_index, *b_group_index;
+
+  _get_face_groups(mesh->i_face_numbering, n_i_faces,
+                   &n_i_groups, &n_i_threads, &i_group_index, _i_index);
+  _get_face_groups(mesh->b_face_numbering, n_b_faces,
+                   &n_b_groups, &n_b_threads, &b_group_index, _b_index);
+
+# pragma omp parallel for if (n_cells_with_ghosts > CS_THR_MIN)
   for (cs_lnum_t j = 0; j < n_cells_with_ghosts; j++) {
 
     cell_area[j] = 0.;
@@ -3592,27 +4172,38 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
   /* Loop on interior faces
      ---------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    /* For each cell sharing the internal face, we update
-     * cell_cen and cell_area */
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-    cs_lnum_t c_id1 = i_face_cells[f_id][0];
-    cs_lnum_t c_id2 = i_face_cells[f_id][1];
+        /* For each cell sharing the internal face, we update
+         * cell_cen and cell_area */
 
-    /* Computation of the area of the face */
+        cs_lnum_t c_id1 = i_face_cells[f_id][0];
+        cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-    cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+        /* Computation of the area of the face */
+
+        cs_real_t area = cs_math_3_norm(i_face_norm + 3*f_id);
+
+        if (c_id1 > -1) {
+          cell_area[c_id1] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
+        }
+        if (c_id2 > -1) {
+          cell_area[c_id2] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
+        }
+
+      }
 
-    if (c_id1 > -1) {
-      cell_area[c_id1] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += i_face_cog[3*f_id + i]*area;
-    }
-    if (c_id2 > -1) {
-      cell_area[c_id2] += area;
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id2 + i] += i_face_cog[3*f_id + i]*area;
     }
 
   } /* End of loop on interior faces */
@@ -3620,27 +4211,38 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
   /* Loop on boundary faces
      --------------------- */
 
-  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+  for (int g_id = 0; g_id < n_b_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    /* For each cell sharing a border face, we update the numerator
-     * of cell_cen and cell_area */
+      for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+           f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+           f_id++) {
 
-    cs_lnum_t c_id1 = b_face_cells[f_id];
+        /* For each cell sharing a border face, we update the numerator
+         * of cell_cen and cell_area */
 
-    /* Computation of the area of the face
-       (note that c_id1 == -1 may happen for isolated faces,
-       which are cleaned afterwards) */
+        cs_lnum_t c_id1 = b_face_cells[f_id];
 
-    if (c_id1 > -1) {
+        /* Computation of the area of the face
+           (note that c_id1 == -1 may happen for isolated faces,
+           which are cleaned afterwards) */
 
-      cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
+        if (c_id1 > -1) {
 
-      cell_area[c_id1] += area;
+          cs_real_t area = cs_math_3_norm(b_face_norm + 3*f_id);
 
-      /* Computation of the numerator */
+          cell_area[c_id1] += area;
 
-      for (cs_lnum_t i = 0; i < 3; i++)
-        cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
+          /* Computation of the numerator */
+
+          for (cs_lnum_t i = 0; i < 3; i++)
+            cell_cen[3*c_id1 + i] += b_face_cog[3*f_id + i]*area;
+
+        }
+
+      }
 
     }
 
@@ -3649,6 +4251,7 @@ cs_mesh_quantities_cell_faces_cog(const cs_mesh_t  *mesh,
   /* Loop on cells to finalize the computation of center of gravity
      -------------------------------------------------------------- */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
 
     for (cs_lnum_t i = 0; i < 3; i++)
@@ -3690,6 +4293,7 @@ cs_mesh_quantities_cell_volume(const cs_mesh_t  *mesh)
   cs_mesh_quantities_b_faces(mesh, &b_face_cog, &b_face_normal);
 
   _compute_cell_quantities(mesh,
+                           NULL,
                            (const cs_real_3_t *)i_face_normal,
                            (const cs_real_3_t *)i_face_cog,
                            (const cs_real_3_t *)b_face_normal,
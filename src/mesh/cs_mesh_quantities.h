@@ -306,6 +306,33 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *mesh,
                            cs_mesh_quantities_t  *mesh_quantities);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities incrementally after vertex displacement.
+ *
+ * Face centers, normals, and surfaces are recomputed only for faces with
+ * at least one moved vertex, cell centers and volumes only for cells
+ * adjacent to such faces, and face distances and non-orthogonality
+ * vectors only for faces adjacent to such cells; other entities keep
+ * their previous values, which are identical to those a full computation
+ * would produce. Gradient-related cocg terms are still updated globally.
+ *
+ * When quantities have not been computed yet, or active options require
+ * global passes (cell or face center corrections, porous models), a full
+ * computation is done instead.
+ *
+ * \param[in]       mesh             pointer to mesh structure
+ * \param[in, out]  mesh_quantities  pointer to mesh quantities structures
+ * \param[in]       vtx_moved        moved indicator for each vertex
+ *                                   (0: unchanged; 1: moved), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *mesh,
+                                cs_mesh_quantities_t  *mesh_quantities,
+                                const int              vtx_moved[]);
+
 /*----------------------------------------------------------------------------
  * Compute fluid mesh quantities
  *
@@ -4132,20 +4132,30 @@ _o2n_idx_update_b_face_arrays(cs_mesh_t        *m,
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Refine flagged mesh cells.
+ * \brief Refine flagged mesh cells, keeping the old to new cell mapping.
  *
- * \param[in, out]  m           mesh
- * \param[in]       conforming  if true, propagate refinement to ensure
- *                              subdivision is conforming
- * \param[in]       cell_flag   subdivision type for each cell
- *                              (0: none; 1: isotropic)
+ * New cells resulting from the subdivision of a given cell are
+ * contiguous, so the mapping may be expressed as an index: new cells
+ * matching old cell i are cell_o2n_idx[i] to cell_o2n_idx[i+1] - 1.
+ * This mapping allows transferring cell-based data from the previous
+ * to the refined mesh, as long as cells are not renumbered.
+ *
+ * \param[in, out]  m             mesh
+ * \param[in]       conforming    if true, propagate refinement to ensure
+ *                                subdivision is conforming
+ * \param[in]       cell_flag     subdivision type for each cell
+ *                                (0: none; 1: isotropic)
+ * \param[out]      cell_o2n_idx  old to new cells index (allocated here;
+ *                                the caller is responsible for freeing it),
+ *                                or NULL if not needed
  */
 /*----------------------------------------------------------------------------*/
 
 void
-cs_mesh_refine_simple(cs_mesh_t  *m,
-                      bool        conforming,
-                      const int   cell_flag[])
+cs_mesh_refine_simple_map(cs_mesh_t   *m,
+                          bool         conforming,
+                          const int    cell_flag[],
+                          cs_lnum_t  **cell_o2n_idx)
 {
   cs_lnum_t n_v_ini = m->n_vertices;
   cs_lnum_t n_f_ini = m->n_b_faces + m->n_i_faces;
@@ -4443,7 +4453,11 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
 
   BFT_FREE(c2f2v_start);
 
-  BFT_FREE(c_o2n_idx);
+  if (cell_o2n_idx != NULL)
+    *cell_o2n_idx = c_o2n_idx;
+  else
+    BFT_FREE(c_o2n_idx);
+
   BFT_FREE(c_i_face_idx);
   BFT_FREE(c_i_face_connect_idx);
 
@@ -4475,6 +4489,26 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
   cs_mesh_update_auxiliary(cs_glob_mesh);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged mesh cells.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       conforming  if true, propagate refinement to ensure
+ *                              subdivision is conforming
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_simple(cs_mesh_t  *m,
+                      bool        conforming,
+                      const int   cell_flag[])
+{
+  cs_mesh_refine_simple_map(m, conforming, cell_flag, NULL);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Refine selected mesh cells.
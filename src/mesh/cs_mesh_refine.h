@@ -67,6 +67,33 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
                       bool        conforming,
                       const int   cell_flag[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged mesh cells, keeping the old to new cell mapping.
+ *
+ * New cells resulting from the subdivision of a given cell are
+ * contiguous, so the mapping may be expressed as an index: new cells
+ * matching old cell i are cell_o2n_idx[i] to cell_o2n_idx[i+1] - 1.
+ * This mapping allows transferring cell-based data from the previous
+ * to the refined mesh, as long as cells are not renumbered.
+ *
+ * \param[in, out]  m             mesh
+ * \param[in]       conforming    if true, propagate refinement to ensure
+ *                                subdivision is conforming
+ * \param[in]       cell_flag     subdivision type for each cell
+ *                                (0: none; 1: isotropic)
+ * \param[out]      cell_o2n_idx  old to new cells index (allocated here;
+ *                                the caller is responsible for freeing it),
+ *                                or NULL if not needed
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_simple_map(cs_mesh_t   *m,
+                          bool         conforming,
+                          const int    cell_flag[],
+                          cs_lnum_t  **cell_o2n_idx);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Refine selected mesh cells.
@@ -82,6 +82,11 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Maximum global number of entities per conversion and write pass when
+   saving a mesh without transfer (0: convert each section in one pass) */
+
+static cs_gnum_t _chunk_size = 0;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -279,6 +284,643 @@ _write_face_vertices_g(const cs_mesh_t    *mesh,
                              pp_out);
 }
 
+/*----------------------------------------------------------------------------
+ * Write a non-indexed section in parallel, in bounded-size passes.
+ *
+ * Entities are redistributed and written by chunks of at most _chunk_size
+ * global entities, so that temporary part-to-block buffers remain bounded
+ * independently of mesh size.
+ *
+ * parameters:
+ *   sec_name        <-- section name
+ *   n_g_elts        <-- global number of entities
+ *   location_id     <-- id of associated location
+ *   n_location_vals <-- number of values per entity
+ *   elt_type        <-- element type
+ *   n_elts          <-- local number of entities
+ *   elt_gnum        <-- global number of each local entity
+ *   order           <-- ordering of local entities by global number
+ *   part_vals       <-- local values, interlaced if n_location_vals > 1
+ *   min_rank_step   <-- minimum rank step between blocks
+ *   pp_out          <-> output file
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_block_stream(const char       *sec_name,
+                    cs_gnum_t         n_g_elts,
+                    size_t            location_id,
+                    size_t            n_location_vals,
+                    cs_datatype_t     elt_type,
+                    cs_lnum_t         n_elts,
+                    const cs_gnum_t   elt_gnum[],
+                    const cs_lnum_t   order[],
+                    const void       *part_vals,
+                    int               min_rank_step,
+                    cs_io_t          *pp_out)
+{
+  cs_gnum_t g0;
+  cs_lnum_t start_id = 0;
+
+  const size_t elt_size = cs_datatype_size[elt_type] * n_location_vals;
+  const cs_gnum_t chunk_size = (_chunk_size > 0) ? _chunk_size : n_g_elts;
+  const unsigned char *_part_vals = part_vals;
+
+  cs_io_write_block_start(sec_name,
+                          n_g_elts,
+                          location_id,
+                          0, /* index id */
+                          n_location_vals,
+                          elt_type,
+                          pp_out);
+
+  for (g0 = 1; g0 <= n_g_elts; g0 += chunk_size) {
+
+    cs_lnum_t i, k, end_id;
+    cs_block_dist_info_t chunk_bi;
+    cs_part_to_block_t *d = NULL;
+    cs_gnum_t *chunk_gnum = NULL;
+    unsigned char *chunk_vals = NULL, *block_vals = NULL;
+
+    cs_gnum_t g1 = g0 + chunk_size;
+    if (g1 > n_g_elts + 1)
+      g1 = n_g_elts + 1;
+
+    /* Extract local entities belonging to this chunk */
+
+    end_id = start_id;
+    while (end_id < n_elts && elt_gnum[order[end_id]] < g1)
+      end_id++;
+
+    BFT_MALLOC(chunk_gnum, end_id - start_id, cs_gnum_t);
+    BFT_MALLOC(chunk_vals, (end_id - start_id)*elt_size, unsigned char);
+
+    for (i = start_id, k = 0; i < end_id; i++, k++) {
+      cs_lnum_t elt_id = order[i];
+      chunk_gnum[k] = elt_gnum[elt_id] - g0 + 1;
+      memcpy(chunk_vals + k*elt_size,
+             _part_vals + (size_t)elt_id*elt_size,
+             elt_size);
+    }
+
+    /* Distribute to blocks and write */
+
+    chunk_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                           cs_glob_n_ranks,
+                                           min_rank_step,
+                                           0,
+                                           g1 - g0);
+
+    d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        chunk_bi,
+                                        end_id - start_id,
+                                        chunk_gnum);
+
+    BFT_MALLOC(block_vals,
+               (chunk_bi.gnum_range[1] - chunk_bi.gnum_range[0])*elt_size,
+               unsigned char);
+
+    cs_part_to_block_copy_array(d,
+                                elt_type,
+                                n_location_vals,
+                                chunk_vals,
+                                block_vals);
+
+    cs_part_to_block_destroy(&d);
+
+    BFT_FREE(chunk_vals);
+    BFT_FREE(chunk_gnum);
+
+    cs_io_write_block_part(chunk_bi.gnum_range[0],
+                           chunk_bi.gnum_range[1],
+                           n_location_vals,
+                           elt_type,
+                           block_vals,
+                           pp_out);
+
+    BFT_FREE(block_vals);
+
+    start_id = end_id;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write face -> cell connectivity in parallel, in bounded-size passes.
+ *
+ * parameters:
+ *   mesh          <-- pointer to mesh structure
+ *   mb            <-- mesh builder
+ *   cell_gnum     <-- global cell numbers, including halo
+ *   face_gnum     <-- global face numbers (interior, then boundary)
+ *   order         <-- ordering of local faces by global number
+ *   pp_out        <-> output file
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_face_cells_stream(const cs_mesh_t          *mesh,
+                         const cs_mesh_builder_t  *mb,
+                         const cs_gnum_t           cell_gnum[],
+                         const cs_gnum_t           face_gnum[],
+                         const cs_lnum_t           order[],
+                         cs_io_t                  *pp_out)
+{
+  cs_gnum_t g0;
+  cs_lnum_t start_id = 0;
+
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_faces = mesh->n_i_faces + mesh->n_b_faces;
+  const cs_gnum_t chunk_size = (_chunk_size > 0) ? _chunk_size : mb->n_g_faces;
+
+  const cs_datatype_t gnum_type
+    = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+
+  cs_io_write_block_start("face_cells",
+                          mb->n_g_faces,
+                          2, /* location_id */
+                          0, /* index id */
+                          2, /* n_location_vals */
+                          gnum_type,
+                          pp_out);
+
+  for (g0 = 1; g0 <= mb->n_g_faces; g0 += chunk_size) {
+
+    cs_lnum_t i, k, end_id;
+    cs_block_dist_info_t chunk_bi;
+    cs_part_to_block_t *d = NULL;
+    cs_gnum_t *chunk_gnum = NULL, *chunk_cell_g = NULL, *block_cell_g = NULL;
+
+    cs_gnum_t g1 = g0 + chunk_size;
+    if (g1 > mb->n_g_faces + 1)
+      g1 = mb->n_g_faces + 1;
+
+    /* Extract local faces belonging to this chunk */
+
+    end_id = start_id;
+    while (end_id < n_faces && face_gnum[order[end_id]] < g1)
+      end_id++;
+
+    BFT_MALLOC(chunk_gnum, end_id - start_id, cs_gnum_t);
+    BFT_MALLOC(chunk_cell_g, (end_id - start_id)*2, cs_gnum_t);
+
+    for (i = start_id, k = 0; i < end_id; i++, k++) {
+      cs_lnum_t face_id = order[i];
+      chunk_gnum[k] = face_gnum[face_id] - g0 + 1;
+      if (face_id < n_i_faces) {
+        chunk_cell_g[k*2]     = cell_gnum[mesh->i_face_cells[face_id][0]];
+        chunk_cell_g[k*2 + 1] = cell_gnum[mesh->i_face_cells[face_id][1]];
+      }
+      else {
+        chunk_cell_g[k*2]     = cell_gnum[mesh->b_face_cells[face_id
+                                                             - n_i_faces]];
+        chunk_cell_g[k*2 + 1] = 0;
+      }
+    }
+
+    /* Distribute to blocks and write */
+
+    chunk_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                           cs_glob_n_ranks,
+                                           mb->min_rank_step,
+                                           0,
+                                           g1 - g0);
+
+    d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        chunk_bi,
+                                        end_id - start_id,
+                                        chunk_gnum);
+
+    BFT_MALLOC(block_cell_g,
+               (chunk_bi.gnum_range[1] - chunk_bi.gnum_range[0])*2,
+               cs_gnum_t);
+
+    cs_part_to_block_copy_array(d,
+                                gnum_type,
+                                2,
+                                chunk_cell_g,
+                                block_cell_g);
+
+    cs_part_to_block_destroy(&d);
+
+    BFT_FREE(chunk_cell_g);
+    BFT_FREE(chunk_gnum);
+
+    cs_io_write_block_part(chunk_bi.gnum_range[0],
+                           chunk_bi.gnum_range[1],
+                           2,
+                           gnum_type,
+                           block_cell_g,
+                           pp_out);
+
+    BFT_FREE(block_cell_g);
+
+    start_id = end_id;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Write face -> vertices connectivity in parallel, in bounded-size passes.
+ *
+ * The index and connectivity sections are written in two successive
+ * sweeps over the same face chunks, as sections may not be interleaved
+ * in the output file.
+ *
+ * parameters:
+ *   mesh    <-- pointer to mesh structure
+ *   mb      <-- mesh builder
+ *   face_gnum <-- global face numbers (interior, then boundary)
+ *   order   <-- ordering of local faces by global number
+ *   pp_out  <-> output file
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_face_vertices_stream(const cs_mesh_t          *mesh,
+                            const cs_mesh_builder_t  *mb,
+                            const cs_gnum_t           face_gnum[],
+                            const cs_lnum_t           order[],
+                            cs_io_t                  *pp_out)
+{
+  cs_gnum_t g0;
+  cs_lnum_t start_id;
+
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_faces = mesh->n_i_faces + mesh->n_b_faces;
+  const cs_gnum_t chunk_size = (_chunk_size > 0) ? _chunk_size : mb->n_g_faces;
+
+  const cs_datatype_t gnum_type
+    = (sizeof(cs_gnum_t) == 8) ? CS_UINT64 : CS_UINT32;
+
+  /* First sweep: cumulative index, built from face vertex counts
+     with a running offset carried across chunks */
+
+  cs_gnum_t carry = 1;
+
+  cs_io_write_block_start("face_vertices_index",
+                          mb->n_g_faces + 1,
+                          2, /* location_id */
+                          1, /* index id */
+                          1, /* n_location_vals */
+                          gnum_type,
+                          pp_out);
+
+  start_id = 0;
+
+  for (g0 = 1; g0 <= mb->n_g_faces; g0 += chunk_size) {
+
+    cs_lnum_t i, k, end_id, n_block;
+    cs_block_dist_info_t chunk_bi;
+    cs_part_to_block_t *d = NULL;
+    cs_gnum_t block_tot, scan_tot, chunk_tot;
+    cs_gnum_t idx_range[2];
+    cs_gnum_t *chunk_gnum = NULL, *chunk_count = NULL;
+    cs_gnum_t *block_count = NULL, *block_idx_g = NULL;
+
+    cs_gnum_t g1 = g0 + chunk_size;
+    if (g1 > mb->n_g_faces + 1)
+      g1 = mb->n_g_faces + 1;
+
+    /* Extract local face vertex counts for this chunk */
+
+    end_id = start_id;
+    while (end_id < n_faces && face_gnum[order[end_id]] < g1)
+      end_id++;
+
+    BFT_MALLOC(chunk_gnum, end_id - start_id, cs_gnum_t);
+    BFT_MALLOC(chunk_count, end_id - start_id, cs_gnum_t);
+
+    for (i = start_id, k = 0; i < end_id; i++, k++) {
+      cs_lnum_t face_id = order[i];
+      chunk_gnum[k] = face_gnum[face_id] - g0 + 1;
+      if (face_id < n_i_faces)
+        chunk_count[k] =   mesh->i_face_vtx_idx[face_id+1]
+                         - mesh->i_face_vtx_idx[face_id];
+      else
+        chunk_count[k] =   mesh->b_face_vtx_idx[face_id - n_i_faces + 1]
+                         - mesh->b_face_vtx_idx[face_id - n_i_faces];
+    }
+
+    /* Distribute counts to blocks */
+
+    chunk_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                           cs_glob_n_ranks,
+                                           mb->min_rank_step,
+                                           0,
+                                           g1 - g0);
+
+    n_block = chunk_bi.gnum_range[1] - chunk_bi.gnum_range[0];
+
+    d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        chunk_bi,
+                                        end_id - start_id,
+                                        chunk_gnum);
+
+    BFT_MALLOC(block_count, n_block, cs_gnum_t);
+
+    cs_part_to_block_copy_array(d,
+                                gnum_type,
+                                1,
+                                chunk_count,
+                                block_count);
+
+    cs_part_to_block_destroy(&d);
+
+    BFT_FREE(chunk_count);
+    BFT_FREE(chunk_gnum);
+
+    /* Convert counts to global index values */
+
+    block_tot = 0;
+    for (i = 0; i < n_block; i++)
+      block_tot += block_count[i];
+
+    MPI_Scan(&block_tot, &scan_tot, 1, CS_MPI_GNUM, MPI_SUM,
+             cs_glob_mpi_comm);
+    MPI_Allreduce(&block_tot, &chunk_tot, 1, CS_MPI_GNUM, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    BFT_MALLOC(block_idx_g, n_block + 1, cs_gnum_t);
+
+    block_idx_g[0] = carry + scan_tot - block_tot;
+    for (i = 0; i < n_block; i++)
+      block_idx_g[i+1] = block_idx_g[i] + block_count[i];
+
+    BFT_FREE(block_count);
+
+    /* On the last chunk, the last non-empty block also provides
+       the past-the-end index entry */
+
+    idx_range[0] = chunk_bi.gnum_range[0];
+    idx_range[1] = chunk_bi.gnum_range[1];
+    if (g1 == mb->n_g_faces + 1) {
+      if (chunk_bi.gnum_range[0] > g1 - g0) {
+        idx_range[0] += 1;
+        idx_range[1] += 1;
+      }
+      else if (chunk_bi.gnum_range[1] == g1 - g0 + 1)
+        idx_range[1] += 1;
+    }
+
+    cs_io_write_block_part(idx_range[0],
+                           idx_range[1],
+                           1,
+                           gnum_type,
+                           block_idx_g,
+                           pp_out);
+
+    BFT_FREE(block_idx_g);
+
+    carry += chunk_tot;
+    start_id = end_id;
+  }
+
+  /* Second sweep: connectivity proper */
+
+  cs_io_write_block_start("face_vertices",
+                          mb->n_g_face_connect_size,
+                          2, /* location_id */
+                          1, /* index id */
+                          1, /* n_location_vals */
+                          gnum_type,
+                          pp_out);
+
+  start_id = 0;
+
+  for (g0 = 1; g0 <= mb->n_g_faces; g0 += chunk_size) {
+
+    cs_lnum_t i, j, k, l, end_id, n_block;
+    cs_block_dist_info_t chunk_bi;
+    cs_part_to_block_t *d = NULL;
+    cs_gnum_t block_tot, scan_tot;
+    cs_lnum_t *chunk_idx = NULL, *block_idx = NULL;
+    cs_gnum_t *chunk_gnum = NULL, *chunk_vtx_g = NULL, *block_vtx_g = NULL;
+
+    cs_gnum_t g1 = g0 + chunk_size;
+    if (g1 > mb->n_g_faces + 1)
+      g1 = mb->n_g_faces + 1;
+
+    /* Extract local face vertices for this chunk */
+
+    end_id = start_id;
+    while (end_id < n_faces && face_gnum[order[end_id]] < g1)
+      end_id++;
+
+    BFT_MALLOC(chunk_gnum, end_id - start_id, cs_gnum_t);
+    BFT_MALLOC(chunk_idx, end_id - start_id + 1, cs_lnum_t);
+
+    chunk_idx[0] = 0;
+    for (i = start_id, k = 0; i < end_id; i++, k++) {
+      cs_lnum_t face_id = order[i];
+      chunk_gnum[k] = face_gnum[face_id] - g0 + 1;
+      if (face_id < n_i_faces)
+        chunk_idx[k+1] = chunk_idx[k] + (  mesh->i_face_vtx_idx[face_id+1]
+                                         - mesh->i_face_vtx_idx[face_id]);
+      else
+        chunk_idx[k+1]
+          = chunk_idx[k] + (  mesh->b_face_vtx_idx[face_id - n_i_faces + 1]
+                            - mesh->b_face_vtx_idx[face_id - n_i_faces]);
+    }
+
+    BFT_MALLOC(chunk_vtx_g, chunk_idx[end_id - start_id], cs_gnum_t);
+
+    for (i = start_id, l = 0; i < end_id; i++) {
+      cs_lnum_t face_id = order[i];
+      if (face_id < n_i_faces) {
+        for (j = mesh->i_face_vtx_idx[face_id];
+             j < mesh->i_face_vtx_idx[face_id+1];
+             j++)
+          chunk_vtx_g[l++]
+            = mesh->global_vtx_num[mesh->i_face_vtx_lst[j]];
+      }
+      else {
+        for (j = mesh->b_face_vtx_idx[face_id - n_i_faces];
+             j < mesh->b_face_vtx_idx[face_id - n_i_faces + 1];
+             j++)
+          chunk_vtx_g[l++]
+            = mesh->global_vtx_num[mesh->b_face_vtx_lst[j]];
+      }
+    }
+
+    /* Distribute to blocks */
+
+    chunk_bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                           cs_glob_n_ranks,
+                                           mb->min_rank_step,
+                                           0,
+                                           g1 - g0);
+
+    n_block = chunk_bi.gnum_range[1] - chunk_bi.gnum_range[0];
+
+    d = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        chunk_bi,
+                                        end_id - start_id,
+                                        chunk_gnum);
+
+    BFT_MALLOC(block_idx, n_block + 1, cs_lnum_t);
+
+    cs_part_to_block_copy_index(d, chunk_idx, block_idx);
+
+    BFT_MALLOC(block_vtx_g, block_idx[n_block], cs_gnum_t);
+
+    cs_part_to_block_copy_indexed(d,
+                                  gnum_type,
+                                  chunk_idx,
+                                  chunk_vtx_g,
+                                  block_idx,
+                                  block_vtx_g);
+
+    cs_part_to_block_destroy(&d);
+
+    BFT_FREE(chunk_vtx_g);
+    BFT_FREE(chunk_idx);
+    BFT_FREE(chunk_gnum);
+
+    /* Determine this rank's range in the chunk's values and write */
+
+    block_tot = block_idx[n_block];
+
+    MPI_Scan(&block_tot, &scan_tot, 1, CS_MPI_GNUM, MPI_SUM,
+             cs_glob_mpi_comm);
+
+    cs_io_write_block_part(scan_tot - block_tot + 1,
+                           scan_tot + 1,
+                           1,
+                           gnum_type,
+                           block_vtx_g,
+                           pp_out);
+
+    BFT_FREE(block_vtx_g);
+    BFT_FREE(block_idx);
+
+    start_id = end_id;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Save mesh data in parallel, in bounded-size passes.
+ *
+ * Contrary to _mesh_to_builder_g(), builder fields are not kept, and
+ * entities are redistributed and written by chunks of at most _chunk_size
+ * global entities, so peak memory overhead is bounded independently of
+ * mesh size; this is useful mainly when checkpointing large meshes.
+ *
+ * parameters:
+ *   mesh      <-- pointer to mesh structure
+ *   mb        <-> mesh builder
+ *   pp_out    <-> output file
+ *----------------------------------------------------------------------------*/
+
+static void
+_mesh_to_builder_g_stream(const cs_mesh_t    *mesh,
+                          cs_mesh_builder_t  *mb,
+                          cs_io_t            *pp_out)
+{
+  cs_lnum_t i, j;
+
+  cs_lnum_t *order = NULL;
+  cs_lnum_t *face_gc_id = NULL;
+  cs_gnum_t *cell_gnum = NULL, *face_gnum = NULL;
+
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+  const cs_lnum_t n_faces = mesh->n_i_faces + mesh->n_b_faces;
+
+  const cs_datatype_t real_type
+    = (sizeof(cs_real_t) == 8) ? CS_DOUBLE : CS_FLOAT;
+  const cs_datatype_t cs_int_type
+    = (sizeof(cs_int_t) == 8) ? CS_INT64 : CS_INT32;
+
+  /* Build global face numbering and ordering */
+
+  BFT_MALLOC(face_gnum, n_faces, cs_gnum_t);
+
+  for (i = 0; i < n_i_faces; i++)
+    face_gnum[i] = mesh->global_i_face_num[i];
+  for (i = 0, j = n_i_faces; i < n_b_faces; i++, j++)
+    face_gnum[j] = mesh->global_b_face_num[i] + mesh->n_g_i_faces;
+
+  order = cs_order_gnum(NULL, face_gnum, n_faces);
+
+  /* Face -> cell connectivity */
+
+  cell_gnum = cs_mesh_get_cell_gnum(mesh, 1);
+
+  _write_face_cells_stream(mesh, mb, cell_gnum, face_gnum, order, pp_out);
+
+  BFT_FREE(cell_gnum);
+
+  /* Cell group classes */
+
+  {
+    cs_lnum_t *cell_order = cs_order_gnum(NULL,
+                                          mesh->global_cell_num,
+                                          mesh->n_cells);
+
+    _write_block_stream("cell_group_class_id",
+                        mesh->n_g_cells,
+                        1, /* location_id */
+                        1, /* n_location_vals */
+                        cs_int_type,
+                        mesh->n_cells,
+                        mesh->global_cell_num,
+                        cell_order,
+                        mesh->cell_family,
+                        mb->min_rank_step,
+                        pp_out);
+
+    BFT_FREE(cell_order);
+  }
+
+  /* Face group classes */
+
+  BFT_MALLOC(face_gc_id, n_faces, cs_lnum_t);
+
+  for (i = 0; i < n_i_faces; i++)
+    face_gc_id[i] = mesh->i_face_family[i];
+  for (i = 0, j = n_i_faces; i < n_b_faces; i++, j++)
+    face_gc_id[j] = mesh->b_face_family[i];
+
+  _write_block_stream("face_group_class_id",
+                      mb->n_g_faces,
+                      2, /* location_id */
+                      1, /* n_location_vals */
+                      cs_int_type,
+                      n_faces,
+                      face_gnum,
+                      order,
+                      face_gc_id,
+                      mb->min_rank_step,
+                      pp_out);
+
+  BFT_FREE(face_gc_id);
+
+  /* Face -> vertex connectivity */
+
+  _write_face_vertices_stream(mesh, mb, face_gnum, order, pp_out);
+
+  BFT_FREE(order);
+  BFT_FREE(face_gnum);
+
+  /* Vertex coordinates */
+
+  {
+    cs_lnum_t *vtx_order = cs_order_gnum(NULL,
+                                         mesh->global_vtx_num,
+                                         mesh->n_vertices);
+
+    _write_block_stream("vertex_coords",
+                        mesh->n_g_vertices,
+                        3, /* location_id */
+                        3, /* n_location_vals */
+                        real_type,
+                        mesh->n_vertices,
+                        mesh->global_vtx_num,
+                        vtx_order,
+                        mesh->vtx_coord,
+                        mb->min_rank_step,
+                        pp_out);
+
+    BFT_FREE(vtx_order);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Transfer or save mesh data to builder in parallel.
  *
@@ -1376,8 +2018,12 @@ cs_mesh_to_builder(cs_mesh_t          *mesh,
 
 #if defined(HAVE_MPI)
 
-  if (cs_glob_n_ranks > 1)
-    _mesh_to_builder_g(mesh, mb, transfer, pp_out);
+  if (cs_glob_n_ranks > 1) {
+    if (_chunk_size > 0 && transfer == false && pp_out != NULL)
+      _mesh_to_builder_g_stream(mesh, mb, pp_out);
+    else
+      _mesh_to_builder_g(mesh, mb, transfer, pp_out);
+  }
 
 #endif
 
@@ -1430,6 +2076,32 @@ cs_mesh_to_builder(cs_mesh_t          *mesh,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of global mesh entities per conversion
+ * and write pass when saving a mesh without transfer.
+ *
+ * When this size is greater than 0, sections saved by \ref cs_mesh_to_builder
+ * in parallel without transferring data to the builder are redistributed
+ * and written by chunks of at most this many global cells, faces, or
+ * vertices, so peak temporary memory is bounded independently of mesh size,
+ * at the cost of additional communication and write latency.
+ *
+ * This setting does not affect the output file's structure or contents,
+ * and is ignored when data is transferred to the builder (as full block
+ * arrays must be built in that case), or in serial mode.
+ *
+ * \param[in]  chunk_size  maximum global number of entities per pass,
+ *                         or 0 for single-pass behavior (the default)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_to_builder_set_chunk_size(cs_gnum_t  chunk_size)
+{
+  _chunk_size = chunk_size;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Transfer mesh partitioning info to mesh builder structure.
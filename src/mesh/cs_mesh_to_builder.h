@@ -86,6 +86,24 @@ cs_mesh_to_builder(cs_mesh_t          *mesh,
                    bool                transfer,
                    cs_io_t            *pp_out);
 
+/*----------------------------------------------------------------------------
+ * Set the maximum number of global mesh entities per conversion and write
+ * pass when saving a mesh without transfer.
+ *
+ * When this size is greater than 0, sections saved in parallel without
+ * transferring data to the builder are redistributed and written by chunks
+ * of at most this many global cells, faces, or vertices, so peak temporary
+ * memory is bounded independently of mesh size, at the cost of additional
+ * communication and write latency.
+ *
+ * parameters:
+ *   chunk_size <-- maximum global number of entities per pass,
+ *                  or 0 for single-pass behavior (the default)
+ *----------------------------------------------------------------------------*/
+
+void
+cs_mesh_to_builder_set_chunk_size(cs_gnum_t  chunk_size);
+
 /*----------------------------------------------------------------------------
  * Transfer mesh partitioning info to mesh builder structure.
  *
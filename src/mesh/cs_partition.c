@@ -209,6 +209,19 @@ static int                       *_part_extra_partitions_list = NULL;
 
 static bool                       _part_uniform_sfc_block_size = false;
 
+/* Optional cell weights (with matching global cell numbers) defined on a
+   previously built mesh partition, used to balance computational cost
+   rather than cell counts at the next space-filling curve partitioning */
+
+static cs_lnum_t                  _part_n_weight_cells = 0;
+static cs_gnum_t                 *_part_weight_gnum = NULL;
+static cs_real_t                 *_part_cell_weight = NULL;
+
+/* Threshold on the ratio of maximum to mean time step cost above which
+   rebalancing is recommended (<= 1 deactivates the check) */
+
+static double                     _part_imbalance_threshold = 0.;
+
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
 #else
@@ -931,6 +944,150 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks from a space-filling curve numbering so that the sum
+ * of user-defined cell weights is balanced across ranks.
+ *
+ * The cells are split at positions of equal cumulative weight along the
+ * space-filling curve rather than at positions of equal cell count.
+ * Weights previously defined through cs_partition_set_cell_weight() on the
+ * cells of an existing partition are first moved to the mesh builder's
+ * block distribution, then ordered along the curve.
+ *
+ * parameters:
+ *   n_g_cells <-- global number of cells
+ *   n_ranks   <-- number of ranks in partition
+ *   mb        <-- pointer to mesh builder helper structure
+ *   cell_num  <-- global cell numbers along the space-filling curve
+ *   cell_rank --> cell rank
+ *   comm      <-- associated MPI communicator
+ *
+ * returns:
+ *   true if a weight-based partition was computed, false if weights
+ *   were unusable (in which case cell_rank is left undefined)
+ *----------------------------------------------------------------------------*/
+
+static bool
+_cell_rank_by_sfc_weight(cs_gnum_t                 n_g_cells,
+                         int                       n_ranks,
+                         const cs_mesh_builder_t  *mb,
+                         const cs_gnum_t           cell_num[],
+                         int                       cell_rank[],
+                         MPI_Comm                  comm)
+{
+  cs_lnum_t i;
+
+  int local_rank, comm_size;
+  MPI_Comm_rank(comm, &local_rank);
+  MPI_Comm_size(comm, &comm_size);
+
+  const cs_lnum_t n_cells
+    = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  /* Move weights from the prior partition to the cell block
+     distribution; cells with no prior weight default to zero,
+     which is acceptable for balancing as long as most have one */
+
+  cs_real_t *block_weight;
+  BFT_MALLOC(block_weight, n_cells, cs_real_t);
+  for (i = 0; i < n_cells; i++)
+    block_weight[i] = 0.;
+
+  cs_part_to_block_t *pb
+    = cs_part_to_block_create_by_gnum(comm,
+                                      mb->cell_bi,
+                                      _part_n_weight_cells,
+                                      _part_weight_gnum);
+
+  cs_part_to_block_copy_array(pb,
+                              CS_REAL_TYPE,
+                              1,
+                              _part_cell_weight,
+                              block_weight);
+
+  cs_part_to_block_destroy(&pb);
+
+  /* Order weights along the space-filling curve */
+
+  cs_block_dist_info_t sfc_bi
+    = cs_block_dist_compute_sizes(local_rank, comm_size, 1, 0, n_g_cells);
+
+  cs_all_to_all_t *d
+    = cs_all_to_all_create_from_block(n_cells,
+                                      CS_ALL_TO_ALL_USE_DEST_ID,
+                                      cell_num,
+                                      sfc_bi,
+                                      comm);
+
+  cs_real_t *sfc_weight
+    = cs_all_to_all_copy_array(d,
+                               CS_REAL_TYPE,
+                               1,
+                               false, /* reverse */
+                               block_weight,
+                               NULL);
+
+  BFT_FREE(block_weight);
+
+  const cs_lnum_t n_sfc_cells = cs_all_to_all_n_elts_dest(d);
+
+  /* Cumulative weight up to the start of this rank's curve section,
+     and total weight */
+
+  double w_sum = 0., w_scan = 0., w_tot = 0.;
+
+  for (i = 0; i < n_sfc_cells; i++)
+    w_sum += sfc_weight[i];
+
+  MPI_Scan(&w_sum, &w_scan, 1, MPI_DOUBLE, MPI_SUM, comm);
+  MPI_Allreduce(&w_sum, &w_tot, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+  if (w_tot <= 0.) {
+    BFT_FREE(sfc_weight);
+    cs_all_to_all_destroy(&d);
+    return false;
+  }
+
+  /* Split at equal cumulative weight, using each cell's mid-weight
+     position so that zero-weight cells follow their curve neighbors */
+
+  int *sfc_rank;
+  BFT_MALLOC(sfc_rank, n_sfc_cells, int);
+
+  double w_cur = w_scan - w_sum;
+  const double w_step = w_tot / n_ranks;
+
+  for (i = 0; i < n_sfc_cells; i++) {
+    int r = (w_cur + 0.5*sfc_weight[i]) / w_step;
+    if (r < 0)
+      r = 0;
+    else if (r >= n_ranks)
+      r = n_ranks - 1;
+    sfc_rank[i] = r;
+    w_cur += sfc_weight[i];
+  }
+
+  BFT_FREE(sfc_weight);
+
+  /* Return ranks to the cell block distribution */
+
+  cs_all_to_all_copy_array(d,
+                           CS_INT_TYPE,
+                           1,
+                           true, /* reverse */
+                           sfc_rank,
+                           cell_rank);
+
+  BFT_FREE(sfc_rank);
+  cs_all_to_all_destroy(&d);
+
+  return true;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
@@ -1005,7 +1162,24 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  bool have_weighted_ranks = false;
+
+#if defined(HAVE_MPI)
+  if (_part_cell_weight != NULL && cs_glob_n_ranks > 1
+      && _part_uniform_sfc_block_size == false)
+    have_weighted_ranks = _cell_rank_by_sfc_weight(n_g_cells,
+                                                   n_ranks,
+                                                   mb,
+                                                   cell_num,
+                                                   cell_rank,
+                                                   comm);
+#endif
+
+  if (have_weighted_ranks) {
+    /* ranks already defined from cell weights */
+  }
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -3043,6 +3217,117 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define per-cell computational weights for the next partitioning.
+ *
+ * Weights are given on the cells of an existing (current) partition, with
+ * matching global cell numbers, and are used by space-filling curve based
+ * partitionings to split the curve at equal cumulative weight rather than
+ * equal cell counts. They are ignored by graph-based partitionings.
+ *
+ * Weights apply at the next (re)partitioning of the mesh; calling this
+ * function with a NULL weight array reverts to unweighted partitioning.
+ *
+ * \param[in]  n_cells    number of local cells
+ * \param[in]  cell_gnum  global cell numbers (size: n_cells)
+ * \param[in]  weight     cell weights (size: n_cells), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weight(cs_lnum_t         n_cells,
+                             const cs_gnum_t   cell_gnum[],
+                             const cs_real_t   weight[])
+{
+  if (weight == NULL || n_cells < 1) {
+    _part_n_weight_cells = 0;
+    BFT_FREE(_part_weight_gnum);
+    BFT_FREE(_part_cell_weight);
+    return;
+  }
+
+  _part_n_weight_cells = n_cells;
+
+  BFT_REALLOC(_part_weight_gnum, n_cells, cs_gnum_t);
+  BFT_REALLOC(_part_cell_weight, n_cells, cs_real_t);
+
+  memcpy(_part_weight_gnum, cell_gnum, sizeof(cs_gnum_t)*n_cells);
+  memcpy(_part_cell_weight, weight, sizeof(cs_real_t)*n_cells);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the load imbalance threshold above which rebalancing
+ *        is recommended.
+ *
+ * The imbalance is measured by \ref cs_partition_rebalance_needed as the
+ * ratio of the maximum to the mean per-rank cost; a threshold lower than
+ * or equal to 1 deactivates the check.
+ *
+ * \param[in]  threshold  imbalance threshold
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_imbalance_threshold(double  threshold)
+{
+  _part_imbalance_threshold = threshold;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if the current load imbalance justifies rebalancing.
+ *
+ * The cost passed by each rank is usually a measure of recent time step
+ * cost, such as obtained with \ref cs_timer_stats. This function is
+ * collective on all ranks; it returns true when the ratio of the maximum
+ * to the mean cost exceeds the threshold set with
+ * \ref cs_partition_set_imbalance_threshold.
+ *
+ * \param[in]  cost  local computational cost measure (usually elapsed time)
+ *
+ * \return  true if rebalancing is recommended, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_partition_rebalance_needed(double  cost)
+{
+  bool retval = false;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1 && _part_imbalance_threshold > 1.) {
+
+    double cost_max = cost, cost_sum = cost;
+
+    MPI_Allreduce(&cost, &cost_max, 1, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(&cost, &cost_sum, 1, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+
+    double cost_mean = cost_sum / cs_glob_n_ranks;
+
+    if (cost_mean > 0. && cost_max/cost_mean > _part_imbalance_threshold) {
+      bft_printf(_("\n"
+                   "Load imbalance (max/mean cost ratio): %12.5e\n"
+                   "exceeds threshold: %12.5e; rebalancing recommended.\n"),
+                 cost_max/cost_mean, _part_imbalance_threshold);
+      retval = true;
+    }
+
+  }
+
+#else
+
+  CS_UNUSED(cost);
+
+#endif
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3463,6 +3748,14 @@ cs_partition(cs_mesh_t             *mesh,
     _part_n_extra_partitions = 0;
   }
 
+  /* Reset cell weights if used */
+
+  if (_part_n_weight_cells > 0) {
+    _part_n_weight_cells = 0;
+    BFT_FREE(_part_weight_gnum);
+    BFT_FREE(_part_cell_weight);
+  }
+
   /* Copy to mesh builder */
 
   mb->have_cell_rank = true;
@@ -224,6 +224,61 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Define per-cell computational weights for the next partitioning.
+ *
+ * Weights are given on the cells of an existing (current) partition, with
+ * matching global cell numbers, and are used by space-filling curve based
+ * partitionings to split the curve at equal cumulative weight rather than
+ * equal cell counts. They are ignored by graph-based partitionings.
+ *
+ * Weights apply at the next (re)partitioning of the mesh; calling this
+ * function with a NULL weight array reverts to unweighted partitioning.
+ *
+ * parameters:
+ *   n_cells   <-- number of local cells
+ *   cell_gnum <-- global cell numbers (size: n_cells)
+ *   weight    <-- cell weights (size: n_cells), or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weight(cs_lnum_t         n_cells,
+                             const cs_gnum_t   cell_gnum[],
+                             const cs_real_t   weight[]);
+
+/*----------------------------------------------------------------------------
+ * Set the load imbalance threshold above which rebalancing is recommended.
+ *
+ * The imbalance is measured by cs_partition_rebalance_needed() as the
+ * ratio of the maximum to the mean per-rank cost; a threshold lower than
+ * or equal to 1 deactivates the check.
+ *
+ * parameters:
+ *   threshold <-- imbalance threshold
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_imbalance_threshold(double  threshold);
+
+/*----------------------------------------------------------------------------
+ * Indicate if the current load imbalance justifies rebalancing.
+ *
+ * The cost passed by each rank is usually a measure of recent time step
+ * cost, such as obtained with cs_timer_stats. This function is collective
+ * on all ranks; it returns true when the ratio of the maximum to the mean
+ * cost exceeds the threshold set with
+ * cs_partition_set_imbalance_threshold().
+ *
+ * parameters:
+ *   cost <-- local computational cost measure (usually elapsed time)
+ *
+ * returns:
+ *   true if rebalancing is recommended, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_partition_rebalance_needed(double  cost);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
@@ -63,6 +63,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_rad_transfer.h"
+#include "cs_rad_transfer_bcs.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -160,6 +161,9 @@ BEGIN_C_DECLS
         Also, in order to have proper initialization of the variables, whatever
         the value of \ref nfreqr, the radiation module is called at
         the first time step of a calculation (restart or not).
+        When \ref cs_rad_transfer_params_t::adaptive_freq "adaptive_freq"
+        is set, the period is adapted to the monitored drift of the
+        radiative source term and \ref nfreqr bounds it from above.
   \var  cs_rad_transfer_params_t::nwsgg
         Spectral radiation models (ADF and FSCK).\n
         Number of ETRs to solve.
@@ -244,7 +248,10 @@ cs_rad_transfer_params_t _rt_params = {.type = CS_RAD_TRANSFER_NONE,
                                        .itpt1d = 4,
                                        .atmo_ir_absorption = false,
                                        .dispersion = false,
-                                       .dispersion_coeff = 1.};
+                                       .dispersion_coeff = 1.,
+                                       .sweep_solve = false,
+                                       .adaptive_freq = false,
+                                       .freq_drift_tol = 0.01};
 
 cs_rad_transfer_params_t *cs_glob_rad_transfer_params = &_rt_params;
 
@@ -295,6 +302,8 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_bcs_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -123,6 +123,22 @@ typedef struct {
                                        value of 1 already improves precision in
                                        both cases. */
 
+  bool          sweep_solve;         /*!< solve each DOM direction by direct
+                                       upwind sweeps (topological ordering
+                                       and substitution) instead of an
+                                       iterative linear solver; only
+                                       applicable without dispersion */
+
+  bool          adaptive_freq;       /*!< adapt the solve period to the
+                                       monitored drift of the radiative
+                                       source term, extrapolating the
+                                       explicit source term on skipped
+                                       time steps; \ref nfreqr then acts
+                                       as the maximum period */
+  cs_real_t     freq_drift_tol;      /*!< allowed relative drift of the
+                                       explicit radiative source term
+                                       between two solves when
+                                       \ref adaptive_freq is set */
 
 } cs_rad_transfer_params_t;
 
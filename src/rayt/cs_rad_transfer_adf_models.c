@@ -141,6 +141,48 @@ _line_to_array(FILE      *radfile,
   *nvalues = index;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Locate a value in a sorted tabulation by bisection.
+ *
+ * Parameters
+ * \param[in]   x    value to locate
+ * \param[in]   tab  sorted tabulated abscissa
+ * \param[in]   n    tabulation size
+ * \param[out]  r    interpolation weight in the interval
+ *
+ * \return  interval index
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_tab_interval(cs_real_t        x,
+              const cs_real_t  tab[],
+              cs_int_t         n,
+              cs_real_t       *r)
+{
+  if (x <= tab[0]) {
+    *r = 0.0;
+    return 0;
+  }
+  else if (x >= tab[n - 1]) {
+    *r = 1.0;
+    return n - 2;
+  }
+
+  int i0 = 0, i1 = n - 1;
+  while (i1 - i0 > 1) {
+    int im = (i0 + i1) / 2;
+    if (x > tab[im])
+      i0 = im;
+    else
+      i1 = im;
+  }
+
+  *r = (x - tab[i0]) / (tab[i0 + 1] - tab[i0]);
+  return i0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Determine the radiation coefficients of the ADF 08 model
@@ -281,7 +323,7 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
     }
   }
 
-  int it, ix, l;
+  int it, ix;
   for (cs_lnum_t iel = 0; iel < ncells; iel++) {
     if (pco2[iel] > 0.0)
       y[iel] = ph2o[iel] / pco2[iel];
@@ -289,38 +331,10 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
       y[iel] = ysto[nysto - 1];
 
     /* Interpolation temperature */
-    if (teloc[iel] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (teloc[iel] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (teloc[iel] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (teloc[iel] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    it = _tab_interval(teloc[iel], tsto, ntsto, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (y[iel] <= ysto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (y[iel] >= ysto[nysto - 1]) {
-      rx = 1.0;
-      ix = nysto - 2;
-    }
-    else {
-      l = 0;
-      while (y[iel] > ysto[l])
-        l++;
-      ix = l - 1;
-      rx = (y[iel] - ysto[ix]) / (ysto[ix + 1] - ysto[ix]);
-    }
+    ix = _tab_interval(y[iel], ysto, nysto, &rx);
 
     /* Absortion Coefficient */
 
@@ -356,38 +370,10 @@ cs_rad_transfer_adf08(const cs_real_t  pco2[],
       y[iel] = ysto[nysto - 1];
 
     /* Interpolation temperature */
-    if (tpaadf[ifac] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (tpaadf[ifac] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (tpaadf[ifac] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (tpaadf[ifac] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    it = _tab_interval(tpaadf[ifac], tsto, ntsto, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (y[iel] <= ysto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (y[iel] >= ysto[nysto - 1]) {
-      rx = 1.0;
-      ix = nysto - 2;
-    }
-    else {
-      l = 0;
-      while (y[iel] > ysto[l])
-        l++;
-      ix = l - 1;
-      rx = (y[iel] - ysto[ix]) / (ysto[ix + 1] - ysto[ix]);
-    }
+    ix = _tab_interval(y[iel], ysto, nysto, &rx);
 
     /* Absortion Coefficient     */
 
@@ -555,42 +541,14 @@ cs_rad_transfer_adf50(const cs_real_t  pco2[],
     }
   }
 
-  int it, ix, l;
+  int it, ix;
   for (cs_lnum_t iel = 0; iel < ncells; iel++) {
 
     /* Interpolation temperature */
-    if (teloc[iel] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (teloc[iel] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (teloc[iel] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (teloc[iel] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    it = _tab_interval(teloc[iel], tsto, ntsto, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (ph2o[iel] <= xh2osto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (ph2o[iel] >= xh2osto[nxh2osto - 1]) {
-      rx = 1.0;
-      ix = nxh2osto - 2;
-    }
-    else {
-      l = 0;
-      while (ph2o[iel] > xh2osto[l])
-        l++;
-      ix = l - 1;
-      rx = (ph2o[iel] - xh2osto[ix]) / (xh2osto[ix + 1] - xh2osto[ix]);
-    }
+    ix = _tab_interval(ph2o[iel], xh2osto, nxh2osto, &rx);
 
     /* Absortion Coefficient */
     for (cs_int_t i = 0; i < nwsgg; i++) {
@@ -627,38 +585,10 @@ cs_rad_transfer_adf50(const cs_real_t  pco2[],
     cs_lnum_t iel = cs_glob_mesh->b_face_cells[ifac];
 
     /* Interpolation temperature */
-    if (tpaadf[ifac] <= tsto[0]) {
-      rt = 0.0;
-      it = 0;
-    }
-    else if (tpaadf[ifac] >= tsto[ntsto - 1]) {
-      rt = 1.0;
-      it = ntsto - 2;
-    }
-    else {
-      l = 0;
-      while (tpaadf[ifac] > tsto[l])
-        l++;
-      it = l - 1;
-      rt = (tpaadf[ifac] - tsto[it]) / (tsto[it + 1] - tsto[it]);
-    }
+    it = _tab_interval(tpaadf[ifac], tsto, ntsto, &rt);
 
     /* Interpolation H2O-molefraction */
-    if (ph2o[iel] <= xh2osto[0]) {
-      rx = 0.0;
-      ix = 0;
-    }
-    else if (ph2o[iel] >= xh2osto[nxh2osto - 1]) {
-      rx = 1.0;
-      ix = nxh2osto - 2;
-    }
-    else {
-      l = 0;
-      while (ph2o[iel] > xh2osto[l])
-        l++;
-      ix = l - 1;
-      rx = (ph2o[iel] - xh2osto[ix]) / (xh2osto[ix + 1] - xh2osto[ix]);
-    }
+    ix = _tab_interval(ph2o[iel], xh2osto, nxh2osto, &rx);
 
     /* Absortion Coefficient     */
 
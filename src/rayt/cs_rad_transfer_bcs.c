@@ -59,6 +59,7 @@
 #include "cs_parameters.h"
 #include "cs_prototypes.h"
 #include "cs_thermal_model.h"
+#include "cs_time_step.h"
 #include "cs_boundary_conditions.h"
 #include "cs_physical_constants.h"
 
@@ -94,6 +95,26 @@ int ipacli = 0;
  * Local type definitions
  *============================================================================*/
 
+/* Categories of the boundary face radiation index */
+
+enum {
+  CS_RAD_BF_FREE = 0,   /* inlet, outlet, or symmetry face */
+  CS_RAD_BF_WALL = 1,   /* smooth or rough wall face */
+  CS_RAD_BF_OTHER = 2   /* unexpected face type */
+};
+
+/*=============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Boundary face radiation index: face categories and unit normals,
+   built once per time step and reused by every band and direction of
+   the boundary coefficients computation. */
+
+static int           _bf_rad_index_nt = -1;
+static int          *_bf_rad_cat = NULL;
+static cs_real_3_t  *_bf_rad_unormal = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -102,6 +123,62 @@ int ipacli = 0;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the boundary face radiation index if needed.
+ *
+ * The face categories and unit normals are built at most once per time
+ * step, so the per-band and per-direction boundary coefficient loops
+ * only stream through precomputed arrays.
+ *
+ * \param[in] bc_type  boundary face types
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_bf_rad_index(const int  bc_type[])
+{
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
+  const cs_real_t *b_face_surf = cs_glob_mesh_quantities->b_face_surf;
+
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  if (_bf_rad_index_nt == nt_cur && _bf_rad_cat != NULL)
+    return;
+
+  BFT_REALLOC(_bf_rad_cat, n_b_faces, int);
+  BFT_REALLOC(_bf_rad_unormal, n_b_faces, cs_real_3_t);
+
+# pragma omp parallel for if (n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+
+    switch (bc_type[face_id]) {
+    case CS_INLET:
+    case CS_CONVECTIVE_INLET:
+    case CS_OUTLET:
+    case CS_FREE_INLET:
+    case CS_SYMMETRY:
+      _bf_rad_cat[face_id] = CS_RAD_BF_FREE;
+      break;
+    case CS_SMOOTHWALL:
+    case CS_ROUGHWALL:
+      _bf_rad_cat[face_id] = CS_RAD_BF_WALL;
+      break;
+    default:
+      _bf_rad_cat[face_id] = CS_RAD_BF_OTHER;
+    }
+
+    cs_real_t invsurf = 1. / b_face_surf[face_id];
+    for (cs_lnum_t i = 0; i < 3; i++)
+      _bf_rad_unormal[face_id][i] = b_face_normal[face_id][i] * invsurf;
+
+  }
+
+  _bf_rad_index_nt = nt_cur;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief synchronize radiative boundary condition error logging across
@@ -1196,8 +1273,6 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
   cs_real_t onedpi  = 1.0 / cs_math_pi;
 
   const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
-  cs_real_3_t *b_face_normal
-    = (cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
 
   /* Initialization */
 
@@ -1233,6 +1308,12 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
 
   if (cs_glob_rad_transfer_params->type == CS_RAD_TRANSFER_DOM) {
 
+    /* Face categories and unit normals are direction and band
+       independent, so they are taken from the boundary face radiation
+       index, updated at most once per time step. */
+
+    _update_bf_rad_index(bc_type);
+
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
 
       /* Copy the appropriate flux density to the local variable qpatmp*/
@@ -1248,29 +1329,13 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
 
       cs_real_t hint = 0.0;
 
-      if (vect_s != NULL) {
-        cs_real_3_t normal;
-        cs_math_3_normalise(b_face_normal[face_id], normal);
-        if ((bc_type[face_id] == CS_INLET
-          || bc_type[face_id] == CS_CONVECTIVE_INLET
-          || bc_type[face_id] == CS_OUTLET
-          || bc_type[face_id] == CS_FREE_INLET)
-            && (CS_ABS(cs_math_3_dot_product(vect_s,  normal)) <cs_math_epzero)) {
-
-        }
-      }
       /* Inlet/Outlet face: entering intensity fixed to zero flux
        * which mimic an infinite extrusion
        * (warning: the treatment is different from than of P-1 model)
        * Symmetry: the reflecting boundary conditions (eps=0)
        * is not feasible (because that would required to couple directions)
        * So we impose an homogeneous Neumann that model an infinite extrusion */
-      if ( bc_type[face_id] == CS_INLET
-        || bc_type[face_id] == CS_CONVECTIVE_INLET
-        || bc_type[face_id] == CS_OUTLET
-        || bc_type[face_id] == CS_FREE_INLET
-        || bc_type[face_id] == CS_SYMMETRY) {
-
+      if (_bf_rad_cat[face_id] == CS_RAD_BF_FREE) {
 
         bool neumann = true;
 
@@ -1278,12 +1343,11 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
          * if the normal to the face is colinear to the direction
          * or if coupled to a 1D module (Atmospheric module)
          * (warning: the treatment is different from than of P-1 model) */
-        if (vect_s != NULL) {
-          cs_real_3_t normal;
-          cs_math_3_normalise(b_face_normal[face_id], normal);
-          if (CS_ABS(cs_math_3_dot_product(vect_s,  normal)) <cs_math_epzero)
-            neumann = false;
-        }
+        if (   vect_s != NULL
+            && CS_ABS(cs_math_3_dot_product(vect_s,
+                                            _bf_rad_unormal[face_id]))
+               < cs_math_epzero)
+          neumann = false;
 
         if (neumann) {
           cs_real_t qimp  = 0.;
@@ -1314,8 +1378,7 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
       }
 
       /* Wall boundary face: calculated intensity */
-      else if (   bc_type[face_id] == CS_SMOOTHWALL
-               || bc_type[face_id] == CS_ROUGHWALL) {
+      else if (_bf_rad_cat[face_id] == CS_RAD_BF_WALL) {
         cs_real_t twall = f_tempb->val[face_id] + xptk;
         /* Remember: In case of the usage of the standard radiation
            models of Code_Saturne, w_gg=1  */
@@ -1419,6 +1482,20 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
   cs_boundary_conditions_error(bc_type, "Luminance BC values");
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory related to radiative boundary conditions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_bcs_finalize(void)
+{
+  BFT_FREE(_bf_rad_cat);
+  BFT_FREE(_bf_rad_unormal);
+  _bf_rad_index_nt = -1;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
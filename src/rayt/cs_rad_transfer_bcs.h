@@ -151,6 +151,15 @@ cs_rad_transfer_bc_coeffs(int        bc_type[],
                           cs_real_t  w_gg[],
                           int        gg_id);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory related to radiative boundary conditions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_bcs_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -94,6 +94,37 @@ static cs_real_t  *dwv;
 static cs_real_t  *kmfs;
 static cs_real_t  *gq;
 
+/* Quantized-state cache for local spectral properties.
+
+   Repeated thermodynamic states (temperature and CO2/H2O mole
+   fractions falling in the same quantization bin) reuse the
+   radiation coefficients and weights computed for the bin instead of
+   re-running the 4d interpolation. Cached values are pure functions
+   of the quantized local and reference states, so the cache persists
+   across radiation steps and is flushed only when the quantized
+   reference state moves to another bin. */
+
+typedef struct {
+
+  cs_gnum_t  *key;     /* encoded quantized state per slot */
+  cs_real_t  *val;     /* cached coefficients per slot */
+  cs_lnum_t   size;    /* number of slots (power of 2) */
+  cs_lnum_t   n_used;  /* number of slots used */
+  cs_lnum_t   stride;  /* values per slot */
+  cs_gnum_t   ref_key; /* quantized reference state at last flush */
+
+} _fsck_cache_t;
+
+static _fsck_cache_t  _k_cache = {NULL, NULL, 0, 0, 0, 0};
+
+#define _CACHE_KEY_EMPTY  ((cs_gnum_t)-1)
+
+/* Quantization bins: well below the spacing of the tabulated data
+   (temperatures every ~75 K, mole fractions every 0.25) */
+
+static const cs_real_t  _cache_t_bin = 2.5;    /* temperature bin (K) */
+static const cs_real_t  _cache_x_bin = 0.002;  /* mole fraction bin */
+
 /*=============================================================================
  * Local const variables
  *============================================================================*/
@@ -158,6 +189,166 @@ _line_to_array(FILE      *radfile,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Encode a quantized thermodynamic state.
+ *
+ * \param[in]  t         temperature
+ * \param[in]  xco2      CO2 volume fraction
+ * \param[in]  xh2o      H2O volume fraction
+ * \param[in]  boundary  boundary state marker
+ *
+ * \return encoded cache key
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_gnum_t
+_cache_encode(cs_real_t  t,
+              cs_real_t  xco2,
+              cs_real_t  xh2o,
+              bool       boundary)
+{
+  cs_gnum_t i_t = (cs_gnum_t)(t / _cache_t_bin + 0.5);
+  cs_gnum_t i_1 = (cs_gnum_t)(xco2 / _cache_x_bin + 0.5);
+  cs_gnum_t i_2 = (cs_gnum_t)(xh2o / _cache_x_bin + 0.5);
+
+  return i_t | (i_1 << 21) | (i_2 << 42) | ((cs_gnum_t)boundary << 63);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find the slot matching a key in the spectral property cache.
+ *
+ * \param[in]  key  encoded quantized state
+ *
+ * \return matching or free slot id
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_lnum_t
+_cache_slot(cs_gnum_t  key)
+{
+  cs_lnum_t s_id
+    = (cs_lnum_t)((key * (cs_gnum_t)2654435761u) & (cs_gnum_t)(_k_cache.size - 1));
+
+  while (   _k_cache.key[s_id] != key
+         && _k_cache.key[s_id] != _CACHE_KEY_EMPTY)
+    s_id = (s_id + 1) & (_k_cache.size - 1);
+
+  return s_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Prepare the spectral property cache for a reference state.
+ *
+ * The cache is allocated on first use, grown when half full, and
+ * flushed when the quantized reference state changes bin.
+ *
+ * \param[in]  ref_key  encoded quantized reference state
+ * \param[in]  stride   cached values per slot
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cache_update(cs_gnum_t  ref_key,
+              cs_lnum_t  stride)
+{
+  if (_k_cache.size == 0) {
+    _k_cache.size = 4096;
+    _k_cache.stride = stride;
+    BFT_MALLOC(_k_cache.key, _k_cache.size, cs_gnum_t);
+    BFT_MALLOC(_k_cache.val, _k_cache.size*stride, cs_real_t);
+  }
+
+  else if (ref_key == _k_cache.ref_key)
+    return;
+
+  /* Flush (first use or stale reference state) */
+
+  for (cs_lnum_t i = 0; i < _k_cache.size; i++)
+    _k_cache.key[i] = _CACHE_KEY_EMPTY;
+
+  _k_cache.n_used = 0;
+  _k_cache.ref_key = ref_key;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Access the cached values for a quantized state, inserting the
+ *        state if needed.
+ *
+ * \param[in]   key  encoded quantized state
+ * \param[out]  hit  true if the state was already cached
+ *
+ * \return pointer to the values cached for the state
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_cache_vals(cs_gnum_t   key,
+            bool       *hit)
+{
+  /* Grow at half load so probe chains stay short */
+
+  if ((_k_cache.n_used + 1)*2 > _k_cache.size) {
+
+    cs_lnum_t prev_size = _k_cache.size;
+    cs_gnum_t *prev_key = _k_cache.key;
+    cs_real_t *prev_val = _k_cache.val;
+    cs_lnum_t stride = _k_cache.stride;
+
+    _k_cache.size = prev_size*2;
+    BFT_MALLOC(_k_cache.key, _k_cache.size, cs_gnum_t);
+    BFT_MALLOC(_k_cache.val, _k_cache.size*stride, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < _k_cache.size; i++)
+      _k_cache.key[i] = _CACHE_KEY_EMPTY;
+
+    for (cs_lnum_t i = 0; i < prev_size; i++) {
+      if (prev_key[i] != _CACHE_KEY_EMPTY) {
+        cs_lnum_t s_id = _cache_slot(prev_key[i]);
+        _k_cache.key[s_id] = prev_key[i];
+        memcpy(_k_cache.val + s_id*stride,
+               prev_val + i*stride,
+               stride*sizeof(cs_real_t));
+      }
+    }
+
+    BFT_FREE(prev_key);
+    BFT_FREE(prev_val);
+  }
+
+  cs_lnum_t s_id = _cache_slot(key);
+
+  if (_k_cache.key[s_id] == key)
+    *hit = true;
+
+  else {
+    _k_cache.key[s_id] = key;
+    _k_cache.n_used += 1;
+    *hit = false;
+  }
+
+  return _k_cache.val + s_id*_k_cache.stride;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the spectral property cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cache_finalize(void)
+{
+  BFT_FREE(_k_cache.key);
+  BFT_FREE(_k_cache.val);
+  _k_cache.size = 0;
+  _k_cache.n_used = 0;
+  _k_cache.ref_key = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief number of segents
@@ -936,7 +1127,7 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
   /* Initialization */
 
   cs_real_t   *gfskref, *kfskref, *kfsk, *gfsk, *gg1;
-  cs_real_t   *kg1, *as, *ag, *aw, *kloctmp;
+  cs_real_t   *kg1, *as;
 
   BFT_MALLOC(gfskref, ng, cs_real_t);
   BFT_MALLOC(kfskref, ng, cs_real_t);
@@ -946,10 +1137,6 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
   BFT_MALLOC(kg1, ng, cs_real_t);
   BFT_MALLOC(as, ng, cs_real_t);
 
-  BFT_MALLOC(ag, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-  BFT_MALLOC(aw, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-  BFT_MALLOC(kloctmp, cs_glob_rad_transfer_params->nwsgg, cs_real_t);
-
   cs_field_t *f_bound_t = cs_field_by_name_try("boundary_temperature");
   cs_real_t *tpfsck = f_bound_t->val;
 
@@ -1210,6 +1397,17 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
   ph2oref /= cs_glob_mesh_quantities->tot_vol;
   tref = sum1 / sum2;
 
+  /* Quantize the reference state so cached local coefficients remain
+     valid while the reference state stays in the same bin; the bins
+     are much finer than the tabulated data spacing */
+
+  tref    = floor(tref    / _cache_t_bin + 0.5) * _cache_t_bin;
+  pco2ref = floor(pco2ref / _cache_x_bin + 0.5) * _cache_x_bin;
+  ph2oref = floor(ph2oref / _cache_x_bin + 0.5) * _cache_x_bin;
+
+  _cache_update(_cache_encode(tref, pco2ref, ph2oref, false),
+                2*cs_glob_rad_transfer_params->nwsgg);
+
   /* Interpolation */
 
   /* Determination of the k-distribution at the reference state */
@@ -1228,95 +1426,132 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
 
   for (cs_lnum_t iel = 0; iel < cs_glob_mesh->n_cells; iel++) {
 
-    /* Determination of the local absorbtion coefficient */
-    for (int i = 0; i < ng; i++) {
-      kfsk[i] = 0.;
-      gfsk[i] = 0.;
-    }
-    _interpolation4d (tref,
-                      teloc[iel],
-                      pco2[iel],
-                      ph2o[iel],
-                      interp_method,
+    /* Quantized local state; on a cache hit, the bin already holds the
+       local absorption coefficients and weights */
+
+    bool hit;
+    cs_real_t *cvals = _cache_vals(_cache_encode(teloc[iel],
+                                                 pco2[iel],
+                                                 ph2o[iel],
+                                                 false),
+                                   &hit);
+    cs_real_t *cvals_a = cvals + cs_glob_rad_transfer_params->nwsgg;
+
+    if (hit == false) {
+
+      cs_real_t tq  = floor(teloc[iel] / _cache_t_bin + 0.5) * _cache_t_bin;
+      cs_real_t x1q = floor(pco2[iel]  / _cache_x_bin + 0.5) * _cache_x_bin;
+      cs_real_t x2q = floor(ph2o[iel]  / _cache_x_bin + 0.5) * _cache_x_bin;
+
+      /* Determination of the local absorbtion coefficient */
+      for (int i = 0; i < ng; i++) {
+        kfsk[i] = 0.;
+        gfsk[i] = 0.;
+      }
+      _interpolation4d (tref,
+                        tq,
+                        x1q,
+                        x2q,
+                        interp_method,
+                        gfsk,
+                        kfsk);
+      /* [m^-1] */
+      for (int i = 0; i < ng; i++)
+        kfsk[i] /= 100.0;
+      _simple_interpg(ng,
                       gfsk,
-                      kfsk);
-    /* [m^-1] */
-    for (int i = 0; i < ng; i++)
-      kfsk[i] /= 100.0;
-    _simple_interpg(ng,
-                    gfsk,
-                    kfsk,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    kloctmp);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      kloc[i * cs_glob_mesh->n_cells + iel] = kloctmp[i];
+                      kfsk,
+                      cs_glob_rad_transfer_params->nwsgg,
+                      gq,
+                      cvals);
+
+      /* Determination of the local weights */
+      for (int i = 0; i < ng; i++) {
+        kfsk[i] = 0.;
+        gfsk[i] = 0.;
+      }
+      _interpolation4d(tq,
+                       tref,
+                       pco2ref,
+                       ph2oref,
+                       interp_method,
+                       gg1,
+                       kg1);
+      /* [m^-1] */
+      for (int i = 0; i < ng; i++)
+        kg1[i] *= 100.0;
+      _simple_interpg(ng,
+                      kg1,
+                      gg1,
+                      ng,
+                      kfskref,
+                      gfsk);
+      as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
+      as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
+      for (int k = 1; k < ng - 1; k++)
+        as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
+      _simple_interpg(ng,
+                      gfskref,
+                      as,
+                      cs_glob_rad_transfer_params->nwsgg,
+                      gq,
+                      cvals_a);
 
+    }
 
-    /* Determination of the local weights */
-    for (int i = 0; i < ng; i++) {
-      kfsk[i] = 0.;
-      gfsk[i] = 0.;
+    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++) {
+      kloc[i * cs_glob_mesh->n_cells + iel] = cvals[i];
+      aloc[i * cs_glob_mesh->n_cells + iel] = cvals_a[i];
     }
-    _interpolation4d(teloc[iel],
-                     tref,
-                     pco2ref,
-                     ph2oref,
-                     interp_method,
-                     gg1,
-                     kg1);
-    /* [m^-1] */
-    for (int i = 0; i < ng; i++)
-      kg1[i] *= 100.0;
-    _simple_interpg(ng,
-                    kg1,
-                    gg1,
-                    ng,
-                    kfskref,
-                    gfsk);
-    as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng-1] = (gfsk[ng-1] - gfsk[ng - 2]) / (gfskref[ng-1] - gfskref[ng - 2] + 1e-15);
-    for (int k = 1; k < ng - 1; k++)
-      as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
-    _simple_interpg(ng,
-                    gfskref,
-                    as,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    ag);
-    for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      aloc[i * cs_glob_mesh->n_cells + iel] = ag[i];
 
   }
 
   for (cs_lnum_t ifac = 0; ifac < cs_glob_mesh->n_b_faces; ifac++) {
-    _interpolation4d(tpfsck[ifac],
-                     tref,
-                     pco2ref,
-                     ph2oref,
-                     interp_method,
-                     gg1,
-                     kg1);
-    for (int i = 0; i < ng; i++)
-      kg1[i] *= 100.0;
-    _simple_interpg(ng,
-                    kg1,
-                    gg1,
-                    ng,
-                    kfskref,
-                    gfsk);
-    as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
-    as[ng] = (gfsk[ng] - gfsk[ng - 1]) / (gfskref[ng] - gfskref[ng - 1] + 1e-15);
-    for (int k = 1; k < ng - 1; k++)
-      as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
-    _simple_interpg(ng,
-                    gfskref,
-                    as,
-                    cs_glob_rad_transfer_params->nwsgg,
-                    gq,
-                    aw);
+
+    /* Boundary states depend on the wall temperature only; they share
+       the cache, marked as boundary bins */
+
+    bool hit;
+    cs_real_t *cvals = _cache_vals(_cache_encode(tpfsck[ifac],
+                                                 pco2ref,
+                                                 ph2oref,
+                                                 true),
+                                   &hit);
+
+    if (hit == false) {
+
+      cs_real_t tq = floor(tpfsck[ifac] / _cache_t_bin + 0.5) * _cache_t_bin;
+
+      _interpolation4d(tq,
+                       tref,
+                       pco2ref,
+                       ph2oref,
+                       interp_method,
+                       gg1,
+                       kg1);
+      for (int i = 0; i < ng; i++)
+        kg1[i] *= 100.0;
+      _simple_interpg(ng,
+                      kg1,
+                      gg1,
+                      ng,
+                      kfskref,
+                      gfsk);
+      as[0]  = (gfsk[1] - gfsk[0]) / (gfskref[1] - gfskref[0] + 1e-15);
+      as[ng] = (gfsk[ng] - gfsk[ng - 1]) / (gfskref[ng] - gfskref[ng - 1] + 1e-15);
+      for (int k = 1; k < ng - 1; k++)
+        as[k] = (gfsk[k + 1] - gfsk[k - 1]) / (gfskref[k + 1] - gfskref[k - 1] + 1e-15);
+      _simple_interpg(ng,
+                      gfskref,
+                      as,
+                      cs_glob_rad_transfer_params->nwsgg,
+                      gq,
+                      cvals);
+
+    }
+
     for (int i = 0; i < cs_glob_rad_transfer_params->nwsgg; i++)
-      alocb[i * cs_glob_mesh->n_b_faces + ifac] = aw[i];
+      alocb[i * cs_glob_mesh->n_b_faces + ifac] = cvals[i];
   }
 
   /* free memory */
@@ -1329,9 +1564,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     BFT_FREE(dwv);
     BFT_FREE(kmfs);
     BFT_FREE(gq);
+    _cache_finalize();
   }
-
-  BFT_FREE(kloctmp);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -55,6 +55,7 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_parall.h"
@@ -97,6 +98,13 @@ BEGIN_C_DECLS
 
 static int ipadom = 0;
 
+/* Adaptive solve period state */
+
+static int        _period_cur = 1;      /* current solve period */
+static int        _nt_last_solve = -1;  /* time step of last full solve */
+static cs_real_t *_st_prev = NULL;      /* explicit source term at last solve */
+static cs_real_t *_st_slope = NULL;     /* per-step extrapolation slope */
+
 /*=============================================================================
  * Local Macro Definitions
  *============================================================================*/
@@ -311,6 +319,553 @@ _order_by_direction(void)
   BFT_FREE(s);
 }
 
+/*----------------------------------------------------------------------------
+ * Build cell -> interior faces connectivity, with orientation.
+ *
+ * Face numbers in the list are signed: face f_id appears as f_id+1 when
+ * its normal is outward for the considered cell, -(f_id+1) otherwise.
+ *
+ * parameters:
+ *   cell_faces_idx --> cell -> interior faces index
+ *   cell_faces_lst --> signed interior face list
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_cell_faces(cs_lnum_t  **cell_faces_idx,
+                  cs_lnum_t  **cell_faces_lst)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  cs_lnum_t *idx, *lst, *shift;
+
+  BFT_MALLOC(idx, n_cells + 1, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++)
+    idx[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (i_face_cells[f_id][0] < n_cells)
+      idx[i_face_cells[f_id][0] + 1] += 1;
+    if (i_face_cells[f_id][1] < n_cells)
+      idx[i_face_cells[f_id][1] + 1] += 1;
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    idx[c_id + 1] += idx[c_id];
+
+  BFT_MALLOC(lst, idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(shift, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    shift[c_id] = idx[c_id];
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t c_id0 = i_face_cells[f_id][0];
+    cs_lnum_t c_id1 = i_face_cells[f_id][1];
+    if (c_id0 < n_cells) {
+      lst[shift[c_id0]] = f_id + 1;
+      shift[c_id0] += 1;
+    }
+    if (c_id1 < n_cells) {
+      lst[shift[c_id1]] = -(f_id + 1);
+      shift[c_id1] += 1;
+    }
+  }
+
+  BFT_FREE(shift);
+
+  *cell_faces_idx = idx;
+  *cell_faces_lst = lst;
+}
+
+/*----------------------------------------------------------------------------
+ * Order local cells along a propagation direction.
+ *
+ * Topological ordering (Kahn's algorithm) of the upwinded interior face
+ * graph: a cell appears after all local cells upwind of it for the
+ * considered direction, so the pure upwind system may be solved by
+ * substitution in that order. Cells caught in a dependency cycle (faces
+ * quasi-normal to the direction on deformed cells) are appended last;
+ * they are handled by the additional sweep passes of the caller.
+ *
+ * parameters:
+ *   cell_faces_idx <-- cell -> interior faces index
+ *   cell_faces_lst <-- signed interior face list
+ *   flurds         <-- s.n interior face flux
+ *   order          --> cell ordering (size: n_cells)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_order(const cs_lnum_t  cell_faces_idx[],
+             const cs_lnum_t  cell_faces_lst[],
+             const cs_real_t  flurds[],
+             cs_lnum_t        order[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  cs_lnum_t *n_upwind;
+  BFT_MALLOC(n_upwind, n_cells, cs_lnum_t);
+
+  /* Count local upwind neighbors of each cell; ghost cells are known
+     from the halo and carry no dependency */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_lnum_t nu = 0;
+
+    for (cs_lnum_t i = cell_faces_idx[c_id];
+         i < cell_faces_idx[c_id + 1];
+         i++) {
+      cs_lnum_t sf = cell_faces_lst[i];
+      cs_lnum_t f_id = CS_ABS(sf) - 1;
+      cs_real_t flux = (sf > 0) ? flurds[f_id] : -flurds[f_id];
+      if (flux < 0.) {
+        cs_lnum_t nb_id = (sf > 0) ?
+          i_face_cells[f_id][1] : i_face_cells[f_id][0];
+        if (nb_id < n_cells)
+          nu++;
+      }
+    }
+
+    n_upwind[c_id] = nu;
+
+  }
+
+  /* The ordering array doubles as the propagation queue */
+
+  cs_lnum_t n_ord = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (n_upwind[c_id] == 0) {
+      order[n_ord] = c_id;
+      n_ord++;
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_ord; i++) {
+
+    cs_lnum_t c_id = order[i];
+
+    for (cs_lnum_t j = cell_faces_idx[c_id];
+         j < cell_faces_idx[c_id + 1];
+         j++) {
+      cs_lnum_t sf = cell_faces_lst[j];
+      cs_lnum_t f_id = CS_ABS(sf) - 1;
+      cs_real_t flux = (sf > 0) ? flurds[f_id] : -flurds[f_id];
+      if (flux > 0.) {
+        cs_lnum_t nb_id = (sf > 0) ?
+          i_face_cells[f_id][1] : i_face_cells[f_id][0];
+        if (nb_id < n_cells) {
+          n_upwind[nb_id] -= 1;
+          if (n_upwind[nb_id] == 0) {
+            order[n_ord] = nb_id;
+            n_ord++;
+          }
+        }
+      }
+    }
+
+  }
+
+  if (n_ord < n_cells) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (n_upwind[c_id] > 0) {
+        order[n_ord] = c_id;
+        n_ord++;
+      }
+    }
+  }
+
+  assert(n_ord == n_cells);
+
+  BFT_FREE(n_upwind);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve one DOM direction by direct upwind sweeps.
+ *
+ * Once cells are ordered along the direction, the pure upwind
+ * convection/reaction system is triangular and a single substitution
+ * pass solves the local subdomain exactly (no reconstruction, which is
+ * consistent with the first-order upwind scheme). With several MPI
+ * ranks, sweep passes with halo updates in between pipeline the
+ * wavefront across subdomains, KBA fashion; passes are repeated until
+ * the inflow radiance is converged.
+ *
+ * parameters:
+ *   name           <-- direction name (for logging)
+ *   verbosity      <-- verbosity level
+ *   epsrsm         <-- convergence threshold for sweep passes
+ *   cell_faces_idx <-- cell -> interior faces index
+ *   cell_faces_lst <-- signed interior face list
+ *   flurds         <-- s.n interior face flux
+ *   flurdb         <-- s.n boundary face flux
+ *   coefap         <-- radiance BC coefficients (explicit part)
+ *   coefbp         <-- radiance BC coefficients (implicit part)
+ *   rovsdt         <-- implicit source term (diagonal contribution)
+ *   rhs            <-- explicit right hand side
+ *   radiance       <-> radiance (with ghost values)
+ *----------------------------------------------------------------------------*/
+
+static void
+_solve_by_sweep(const char       *name,
+                int               verbosity,
+                cs_real_t         epsrsm,
+                const cs_lnum_t   cell_faces_idx[],
+                const cs_lnum_t   cell_faces_lst[],
+                const cs_real_t   flurds[],
+                const cs_real_t   flurdb[],
+                const cs_real_t   coefap[],
+                const cs_real_t   coefbp[],
+                const cs_real_t   rovsdt[],
+                const cs_real_t   rhs[],
+                cs_real_t        *restrict radiance)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  cs_lnum_t *order;
+  BFT_MALLOC(order, n_cells, cs_lnum_t);
+
+  _sweep_order(cell_faces_idx, cell_faces_lst, flurds, order);
+
+  /* Boundary contributions do not change between passes:
+     outgoing faces add to the diagonal, incoming faces carry
+     the (Dirichlet) boundary radiance */
+
+  cs_real_t *b_den, *b_num;
+  BFT_MALLOC(b_den, n_cells, cs_real_t);
+  BFT_MALLOC(b_num, n_cells, cs_real_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    b_den[c_id] = 0.;
+    b_num[c_id] = 0.;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    cs_lnum_t c_id = b_face_cells[f_id];
+    if (flurdb[f_id] > 0.)
+      b_den[c_id] += flurdb[f_id];
+    else {
+      b_den[c_id] += flurdb[f_id] * coefbp[f_id];
+      b_num[c_id] -= flurdb[f_id] * coefap[f_id];
+    }
+  }
+
+  /* The wavefront crosses at most all subdomains; keep a margin
+     for local dependency cycles */
+
+  int n_max_sweeps = cs_glob_n_ranks + 10;
+  int n_sweeps;
+
+  for (n_sweeps = 1; n_sweeps <= n_max_sweeps; n_sweeps++) {
+
+    if (m->halo != NULL)
+      cs_halo_sync_var(m->halo, CS_HALO_STANDARD, radiance);
+
+    cs_real_t r_max = 0., v_max = 0.;
+
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+
+      cs_lnum_t c_id = order[i];
+
+      cs_real_t num = rhs[c_id] + b_num[c_id];
+      cs_real_t den = rovsdt[c_id] + b_den[c_id];
+
+      for (cs_lnum_t j = cell_faces_idx[c_id];
+           j < cell_faces_idx[c_id + 1];
+           j++) {
+        cs_lnum_t sf = cell_faces_lst[j];
+        cs_lnum_t f_id = CS_ABS(sf) - 1;
+        cs_real_t flux = (sf > 0) ? flurds[f_id] : -flurds[f_id];
+        if (flux > 0.)
+          den += flux;
+        else if (flux < 0.) {
+          cs_lnum_t nb_id = (sf > 0) ?
+            i_face_cells[f_id][1] : i_face_cells[f_id][0];
+          num -= flux * radiance[nb_id];
+        }
+      }
+
+      cs_real_t va = (CS_ABS(den) > DBL_MIN) ? num / den : radiance[c_id];
+
+      r_max = CS_MAX(r_max, CS_ABS(va - radiance[c_id]));
+      v_max = CS_MAX(v_max, CS_ABS(va));
+
+      radiance[c_id] = va;
+
+    }
+
+    if (cs_glob_n_ranks > 1) {
+      cs_real_t buf[2] = {r_max, v_max};
+      cs_parall_max(2, CS_REAL_TYPE, buf);
+      r_max = buf[0];
+      v_max = buf[1];
+    }
+
+    if (r_max <= epsrsm * CS_MAX(v_max, cs_math_epzero))
+      break;
+
+  }
+
+  if (verbosity >= 1)
+    bft_printf(_("   %s: converged in %d direct sweep passes\n"),
+               name, CS_MIN(n_sweeps, n_max_sweeps));
+
+  BFT_FREE(b_num);
+  BFT_FREE(b_den);
+  BFT_FREE(order);
+}
+
+/*----------------------------------------------------------------------------
+ * Solve all angular directions by direct sweeps, in parallel.
+ *
+ * When no rank-crossing synchronization is required (single rank, no
+ * periodicity), the directional sweeps are fully independent, so the
+ * angular loop itself may be distributed over threads; each direction
+ * is equally expensive, making the load trivially balanced. The
+ * radiance integration over solid angles is reduced per direction
+ * under a critical section, which is negligible next to the sweeps.
+ *
+ * parameters:
+ *   epsrsm         <-- convergence threshold for sweep passes
+ *   cell_faces_idx <-- cell -> interior faces index
+ *   cell_faces_lst <-- signed interior face list
+ *   coefap         <-- radiance BC coefficients (explicit part)
+ *   coefbp         <-- radiance BC coefficients (implicit part)
+ *   rovsdt         <-- implicit source term (diagonal contribution)
+ *   rhs0           <-- explicit right hand side
+ *   rad_st_expl    <-> explicit radiative source term
+ *   q              <-> explicit flux density vector
+ *   snplus_val     <-> integrated s.n weight at boundary faces
+ *   qincid_val     <-> incident flux density at boundary faces
+ *   qinspe_val     <-> spectral incident flux (NULL if not used)
+ *   gg_id          <-- number of the i-th gray gas
+ *----------------------------------------------------------------------------*/
+
+static void
+_sweep_all_directions(cs_real_t         epsrsm,
+                      const cs_lnum_t   cell_faces_idx[],
+                      const cs_lnum_t   cell_faces_lst[],
+                      const cs_real_t   coefap[],
+                      const cs_real_t   coefbp[],
+                      const cs_real_t   rovsdt[],
+                      const cs_real_t   rhs0[],
+                      cs_real_t        *restrict rad_st_expl,
+                      cs_real_3_t      *restrict q,
+                      cs_real_t        *restrict snplus_val,
+                      cs_real_t        *restrict qincid_val,
+                      cs_real_t        *restrict qinspe_val,
+                      int               gg_id)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->i_face_normal;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
+  const cs_real_t *b_face_surf = cs_glob_mesh_quantities->b_face_surf;
+
+  const int nwsgg = cs_glob_rad_transfer_params->nwsgg;
+
+  /* Flatten the angular discretization */
+
+  const int n_dirs_tot = 8 * cs_glob_rad_transfer_params->ndirs;
+
+  cs_real_3_t *dir_s;
+  cs_real_t *dir_omega;
+  BFT_MALLOC(dir_s, n_dirs_tot, cs_real_3_t);
+  BFT_MALLOC(dir_omega, n_dirs_tot, cs_real_t);
+
+  int n_dirs = 0;
+
+  for (int ii = -1; ii <= 1; ii+=2) {
+    for (int jj = -1; jj <= 1; jj+=2) {
+      for (int kk = -1; kk <= 1; kk+=2) {
+        for (int dir_id = 0;
+             dir_id < cs_glob_rad_transfer_params->ndirs;
+             dir_id++) {
+          dir_s[n_dirs][0] = ii * cs_glob_rad_transfer_params->vect_s[dir_id][0];
+          dir_s[n_dirs][1] = jj * cs_glob_rad_transfer_params->vect_s[dir_id][1];
+          dir_s[n_dirs][2] = kk * cs_glob_rad_transfer_params->vect_s[dir_id][2];
+          dir_omega[n_dirs] = cs_glob_rad_transfer_params->angsol[dir_id];
+          n_dirs++;
+        }
+      }
+    }
+  }
+
+  assert(n_dirs == n_dirs_tot);
+
+#pragma omp parallel
+  {
+    cs_real_t *t_flurds, *t_flurdb, *t_rad;
+    BFT_MALLOC(t_flurds, n_i_faces, cs_real_t);
+    BFT_MALLOC(t_flurdb, n_b_faces, cs_real_t);
+    BFT_MALLOC(t_rad, n_cells_ext, cs_real_t);
+
+#pragma omp for
+    for (int d_id = 0; d_id < n_dirs_tot; d_id++) {
+
+      const cs_real_t *vect_s = dir_s[d_id];
+      const cs_real_t domegat = dir_omega[d_id];
+
+      char cnom[80];
+      snprintf(cnom, 80, "%s%03d", "radiation_", d_id + 1);
+
+      for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++)
+        t_flurds[face_id]
+          = cs_math_3_dot_product(vect_s, i_face_normal[face_id]);
+
+      for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+        t_flurdb[face_id]
+          = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
+        t_rad[cell_id] = 0.0;
+
+      _solve_by_sweep(cnom,
+                      0, /* per-direction logging disabled in threads */
+                      epsrsm,
+                      cell_faces_idx,
+                      cell_faces_lst,
+                      t_flurds,
+                      t_flurdb,
+                      coefap,
+                      coefbp,
+                      rovsdt,
+                      rhs0,
+                      t_rad);
+
+      /* Integration of fluxes and source terms */
+
+#pragma omp critical
+      {
+        for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+          cs_real_t aa = t_rad[cell_id] * domegat;
+          rad_st_expl[cell_id] += aa;
+          q[cell_id][0] += aa * vect_s[0];
+          q[cell_id][1] += aa * vect_s[1];
+          q[cell_id][2] += aa * vect_s[2];
+        }
+
+        for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+          cs_lnum_t cell_id = b_face_cells[face_id];
+          cs_real_t aa
+            = cs_math_3_dot_product(vect_s, b_face_normal[face_id]);
+          aa /= b_face_surf[face_id];
+          aa = 0.5 * (aa + CS_ABS(aa)) * domegat;
+          snplus_val[face_id] += aa;
+          if (qinspe_val != NULL)
+            qinspe_val[gg_id + face_id * nwsgg] += aa * t_rad[cell_id];
+          else
+            qincid_val[face_id] += aa * t_rad[cell_id];
+        }
+      }
+
+    }
+
+    BFT_FREE(t_rad);
+    BFT_FREE(t_flurdb);
+    BFT_FREE(t_flurds);
+  }
+
+  BFT_FREE(dir_omega);
+  BFT_FREE(dir_s);
+}
+
+/*----------------------------------------------------------------------------
+ * Update the adaptive radiation solve period after a full solve.
+ *
+ * The relative drift of the explicit radiative source term since the
+ * previous solve, per time step, determines how many steps the source
+ * term may be extrapolated before it drifts by more than the allowed
+ * tolerance; the next solve period is set accordingly, bounded by the
+ * user period nfreqr. The per-step slope kept for extrapolation is the
+ * mean variation over the elapsed interval.
+ *
+ * parameters:
+ *   nt_cur <-- current (absolute) time step number
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_solve_period(int  nt_cur)
+{
+  const cs_rad_transfer_params_t *rt_params = cs_glob_rad_transfer_params;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_real_t *cell_vol = cs_glob_mesh_quantities->cell_vol;
+  const cs_real_t *cpro_re_st = CS_FI_(rad_est, 0)->val;
+
+  int period_max = CS_MAX(rt_params->nfreqr, 1);
+
+  if (_st_prev == NULL) {
+
+    BFT_MALLOC(_st_prev, n_cells, cs_real_t);
+    BFT_MALLOC(_st_slope, n_cells, cs_real_t);
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      _st_slope[cell_id] = 0.0;
+
+    _period_cur = 1;
+
+  }
+  else {
+
+    int n_since = CS_MAX(nt_cur - _nt_last_solve, 1);
+
+    cs_real_t sums[2] = {0., 0.};
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      sums[0] += CS_ABS(cpro_re_st[cell_id] - _st_prev[cell_id])
+                 * cell_vol[cell_id];
+      sums[1] += CS_ABS(cpro_re_st[cell_id]) * cell_vol[cell_id];
+    }
+
+    cs_parall_sum(2, CS_REAL_TYPE, sums);
+
+    cs_real_t drift = sums[0] / CS_MAX(sums[1], 1e-30) / n_since;
+
+    if (drift * period_max > rt_params->freq_drift_tol)
+      _period_cur = CS_MAX((int)(rt_params->freq_drift_tol / drift), 1);
+    else
+      _period_cur = period_max;
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+      _st_slope[cell_id] = (cpro_re_st[cell_id] - _st_prev[cell_id]) / n_since;
+
+    if (rt_params->iimlum >= 1)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    _("   Radiative source term drift: %11.4e /step;"
+                      " next solve in %d steps\n"),
+                    drift, _period_cur);
+
+  }
+
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+    _st_prev[cell_id] = cpro_re_st[cell_id];
+
+  _nt_last_solve = nt_cur;
+
+  if (nt_cur == cs_glob_time_step->nt_max) {
+    BFT_FREE(_st_prev);
+    BFT_FREE(_st_slope);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Radiative flux and source term computation
@@ -411,7 +966,7 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
 
   /* Initialization */
 
-  cs_field_t *f_qinspe;
+  cs_field_t *f_qinspe = NULL;
   if (cs_glob_rad_transfer_params->imoadf >= 1)
     /* Pointer to the spectral flux density field */
     f_qinspe = cs_field_by_name_try("spectral_rad_incident_flux");
@@ -436,7 +991,17 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
     vcopt.nswrsm =  2;
   }
 
-  if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
+  /* Direct sweep solve is restricted to the pure upwind case */
+
+  bool use_sweep = (   cs_glob_rad_transfer_params->sweep_solve
+                    && cs_glob_rad_transfer_params->dispersion == false);
+
+  cs_lnum_t *cell_faces_idx = NULL, *cell_faces_lst = NULL;
+
+  if (use_sweep)
+    _sweep_cell_faces(&cell_faces_idx, &cell_faces_lst);
+
+  else if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
     _order_by_direction();
 
   /*                              / -> ->
@@ -515,6 +1080,33 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
 
   int kdir = 0;
 
+  /* With independent directional sweeps (single rank, no periodicity,
+     no per-direction source updates), distribute directions over
+     threads; otherwise run the standard angular loop. */
+
+  bool dir_parallel = (   use_sweep
+                       && cs_glob_n_ranks == 1
+                       && cs_glob_mesh->halo == NULL
+                       && cs_glob_rad_transfer_params->atmo_ir_absorption == false);
+
+  if (dir_parallel)
+    _sweep_all_directions(vcopt.epsrsm,
+                          cell_faces_idx,
+                          cell_faces_lst,
+                          coefap,
+                          coefbp,
+                          rovsdt,
+                          rhs0,
+                          rad_st_expl,
+                          q,
+                          f_snplus->val,
+                          f_qincid->val,
+                          (cs_glob_rad_transfer_params->imoadf >= 1) ?
+                            f_qinspe->val : NULL,
+                          gg_id);
+
+  else {
+
   for (int ii = -1; ii <= 1; ii+=2) {
     for (int jj = -1; jj <= 1; jj+=2) {
       for (int kk = -1; kk <= 1; kk+=2) {
@@ -620,7 +1212,22 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
           /* In case of a theta-scheme, set theta = 1;
              no relaxation in steady case either */
 
-          cs_equation_iterative_solve_scalar(0,   /* idtvar */
+          if (use_sweep)
+            _solve_by_sweep(cnom,
+                            vcopt.iwarni,
+                            vcopt.epsrsm,
+                            cell_faces_idx,
+                            cell_faces_lst,
+                            flurds,
+                            flurdb,
+                            coefap,
+                            coefbp,
+                            rovsdt,
+                            rhs,
+                            radiance);
+
+          else
+            cs_equation_iterative_solve_scalar(0,   /* idtvar */
                                              1,   /* external sub-iteration */
                                              -1,  /* f_id */
                                              cnom,
@@ -712,6 +1319,8 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
     }
   }
 
+  } /* End of standard angular loop (dir_parallel == false) */
+
 #if 0
   /* TODO add clean generation and log of "per day source terms"
      for atmospheric radiative model */
@@ -733,6 +1342,10 @@ _cs_rad_transfer_sol(const cs_real_t            tempk[restrict],
 
   if (ck_u_d != NULL)
     BFT_FREE(ck_u_d);
+  if (use_sweep) {
+    BFT_FREE(cell_faces_idx);
+    BFT_FREE(cell_faces_lst);
+  }
   BFT_FREE(rhs0);
   BFT_FREE(dpvar);
   BFT_FREE(radiance);
@@ -1001,8 +1614,22 @@ cs_rad_transfer_solve(int               bc_type[],
   /* Initializations
      --------------- */
 
-  if (   ipadom > 1
-      && cs_glob_time_step->nt_cur%rt_params->nfreqr != 0)
+  if (rt_params->adaptive_freq) {
+    if (   ipadom > 1
+        && cs_glob_time_step->nt_cur - _nt_last_solve < _period_cur) {
+
+      /* Skipped step: advance the explicit source term along the slope
+         observed between the last two full solves */
+
+      cs_real_t *cpro_re_st = CS_FI_(rad_est, 0)->val;
+      for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++)
+        cpro_re_st[cell_id] += _st_slope[cell_id];
+
+      return;
+    }
+  }
+  else if (   ipadom > 1
+           && cs_glob_time_step->nt_cur%rt_params->nfreqr != 0)
     return;
 
   cs_log_printf(CS_LOG_DEFAULT,
@@ -2098,6 +2725,11 @@ cs_rad_transfer_solve(int               bc_type[],
   BFT_FREE(viscb);
   BFT_FREE(rhs);
   BFT_FREE(rovsdt);
+  /* Choose the next solve period from the source term drift */
+
+  if (rt_params->adaptive_freq)
+    _update_solve_period(cs_glob_time_step->nt_cur);
+
   BFT_FREE(tempk);
   BFT_FREE(coefap);
   BFT_FREE(coefbp);
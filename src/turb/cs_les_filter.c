@@ -79,190 +79,262 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
-/*============================================================================
- * Private function definitions
- *============================================================================*/
+/* Cached filter stencil, in CSR form: for each cell, the cell itself,
+   its face neighbors, and its extended neighborhood, with volume-based
+   weights normalized so each row sums to 1. */
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+static cs_lnum_t   _w_n_cells = 0;
+static cs_lnum_t  *_w_idx = NULL;
+static cs_lnum_t  *_w_cell = NULL;
+static cs_real_t  *_w_weight = NULL;
 
-/*=============================================================================
- * Public function definitions
+/*============================================================================
+ * Private function definitions
  *============================================================================*/
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Compute filters for dynamic models.
- *
- * This function deals with the standard or extended neighborhood.
+/*----------------------------------------------------------------------------
+ * Build the cached filter weights.
  *
- * \param[in]   stride   stride of array to filter
- * \param[in]   val      array of values to filter
- * \param[out]  f_val    array of filtered values
- */
-/*----------------------------------------------------------------------------*/
+ * The stencil merges each cell, its face neighbors and its extended
+ * neighborhood; weights are cell volumes, normalized per row, so the
+ * apply kernel reduces to a weighted gather with no division.
+ *----------------------------------------------------------------------------*/
 
-void
-cs_les_filter(int        stride,
-              cs_real_t  val[],
-              cs_real_t  f_val[])
+static void
+_build_filter_weights(void)
 {
-  cs_real_t *w1 = NULL, *w2 = NULL;
-
   const cs_mesh_t  *mesh = cs_glob_mesh;
-  const cs_lnum_t  _stride = stride;
+  const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
+
   const cs_lnum_t  n_cells = mesh->n_cells;
-  const cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
-  const cs_lnum_t  n_elts_l = n_cells * _stride;
-  const cs_lnum_t  n_elts = n_cells_ext * _stride;
-  const int n_i_groups = mesh->i_face_numbering->n_groups;
-  const int n_i_threads = mesh->i_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = mesh->i_face_numbering->group_index;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
   const cs_lnum_t  *cell_cells_idx = mesh->cell_cells_idx;
   const cs_lnum_t  *cell_cells_lst = mesh->cell_cells_lst;
-  const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
-
-  assert(cell_cells_idx != NULL);
-
-  /* Allocate and initialize working buffers */
 
-  BFT_MALLOC(w1, n_elts, cs_real_t);
-  BFT_MALLOC(w2, n_elts, cs_real_t);
+  cs_lnum_t  *pos;
 
-  /* Case for scalar variable */
-  /*--------------------------*/
-
-  if (stride == 1) {
+  assert(cell_cells_idx != NULL);
 
-    /* Synchronize valiable */
+  _w_n_cells = n_cells;
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, val);
+  BFT_MALLOC(_w_idx, n_cells + 1, cs_lnum_t);
 
-    /* Define filtered valiable array */
+  /* Count entries: self + extended neighborhood + face neighbors */
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _w_idx[i+1] = 1 + cell_cells_idx[i+1] - cell_cells_idx[i];
 
-      w1[i] = val[i] * cell_vol[i];
-      w2[i] = cell_vol[i];
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_lnum_t i = mesh->i_face_cells[face_id][0];
+    cs_lnum_t j = mesh->i_face_cells[face_id][1];
+    if (i < n_cells)
+      _w_idx[i+1] += 1;
+    if (j < n_cells)
+      _w_idx[j+1] += 1;
+  }
 
-      /* Loop on connected cells (without cells sharing a face) */
+  _w_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _w_idx[i+1] += _w_idx[i];
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        w1[i] += val[k] * cell_vol[k];
-        w2[i] += cell_vol[k];
-      }
+  BFT_MALLOC(_w_cell, _w_idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(_w_weight, _w_idx[n_cells], cs_real_t);
+  BFT_MALLOC(pos, n_cells, cs_lnum_t);
 
-    } /* End of loop on cells */
+  /* Fill stencil: self and extended neighborhood first, then faces */
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_lnum_t p = _w_idx[i];
+    _w_cell[p++] = i;
+    for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++)
+      _w_cell[p++] = cell_cells_lst[j];
+    pos[i] = p;
+  }
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+    cs_lnum_t i = mesh->i_face_cells[face_id][0];
+    cs_lnum_t j = mesh->i_face_cells[face_id][1];
+    if (i < n_cells)
+      _w_cell[pos[i]++] = j;
+    if (j < n_cells)
+      _w_cell[pos[j]++] = i;
+  }
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+  BFT_FREE(pos);
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+  /* Normalized volume weights */
 
-          w1[i] += val[j] * cell_vol[j];
-          w2[i] += cell_vol[j];
-          w1[j] += val[i] * cell_vol[i];
-          w2[j] += cell_vol[i];
+# pragma omp parallel for
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_real_t vol_tot = 0.;
+    for (cs_lnum_t j = _w_idx[i]; j < _w_idx[i+1]; j++) {
+      _w_weight[j] = cell_vol[_w_cell[j]];
+      vol_tot += _w_weight[j];
+    }
+    const cs_real_t inv_vol_tot = 1. / vol_tot;
+    for (cs_lnum_t j = _w_idx[i]; j < _w_idx[i+1]; j++)
+      _w_weight[j] *= inv_vol_tot;
+  }
+}
 
-        }
+/*----------------------------------------------------------------------------
+ * Apply the cached filter weights to one array.
+ *
+ * parameters:
+ *   stride <-- stride of array to filter
+ *   val    <-- array of values to filter (with halo values)
+ *   f_val  --> array of filtered values
+ *----------------------------------------------------------------------------*/
 
-      }
+static void
+_apply_filter_weights(cs_lnum_t         stride,
+                      const cs_real_t  *val,
+                      cs_real_t        *f_val)
+{
+  const cs_lnum_t  n_cells = _w_n_cells;
 
-    }
+  if (stride == 1) {
 
 #   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++)
-      f_val[i] = w1[i]/w2[i];
-
-    /* Synchronize valiable */
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      cs_real_t s = 0.;
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd reduction(+:s)
+#     endif
+      for (cs_lnum_t j = _w_idx[i]; j < _w_idx[i+1]; j++)
+        s += _w_weight[j] * val[_w_cell[j]];
+      f_val[i] = s;
+    }
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val);
   }
-
-  /* Case for vector or tensor variable */
-  /*------------------------------------*/
-
   else {
 
-    /* Synchronize valiable */
-
-    if (mesh->halo != NULL)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, val, stride);
-
-    /* Define filtered valiable array */
+    assert(stride <= 9);
 
 #   pragma omp parallel for
     for (cs_lnum_t i = 0; i < n_cells; i++) {
-
-      for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-        const cs_lnum_t ic = i *_stride + c_id;
-        w1[ic] = val[ic] * cell_vol[i];
-        w2[ic] = cell_vol[i];
+      cs_real_t s[9];
+      for (cs_lnum_t c_id = 0; c_id < stride; c_id++)
+        s[c_id] = 0.;
+      for (cs_lnum_t j = _w_idx[i]; j < _w_idx[i+1]; j++) {
+        const cs_real_t w = _w_weight[j];
+        const cs_real_t *_val = val + _w_cell[j]*stride;
+        for (cs_lnum_t c_id = 0; c_id < stride; c_id++)
+          s[c_id] += w * _val[c_id];
       }
+      for (cs_lnum_t c_id = 0; c_id < stride; c_id++)
+        f_val[i*stride + c_id] = s[c_id];
+    }
 
-      /* Loop on connected cells (without cells sharing a face) */
+  }
+}
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-          const cs_lnum_t ic = i *_stride + c_id;
-          const cs_lnum_t kc = k *_stride + c_id;
-          w1[ic] += val[kc] * cell_vol[k];
-          w2[ic] += cell_vol[k];
-        }
-      }
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
-    } /* End of loop on cells */
+/*=============================================================================
+ * Public function definitions
+ *============================================================================*/
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models.
+ *
+ * This function deals with the standard or extended neighborhood.
+ *
+ * \param[in]   stride   stride of array to filter
+ * \param[in]   val      array of values to filter
+ * \param[out]  f_val    array of filtered values
+ */
+/*----------------------------------------------------------------------------*/
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+void
+cs_les_filter(int        stride,
+              cs_real_t  val[],
+              cs_real_t  f_val[])
+{
+  cs_les_filter_multi(1, &stride, &val, &f_val);
+}
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models for several arrays.
+ *
+ * This function behaves as \ref cs_les_filter for each array, but
+ * traverses the cached filter stencil once with all arrays batched, so
+ * the dynamic procedure may filter several quantities (velocity, its
+ * tensor products, density, ...) in a single pass.
+ *
+ * \param[in]   n_f      number of arrays to filter
+ * \param[in]   stride   stride of each array to filter
+ * \param[in]   val      arrays of values to filter
+ * \param[out]  f_val    arrays of filtered values
+ */
+/*----------------------------------------------------------------------------*/
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+void
+cs_les_filter_multi(int          n_f,
+                    const int    stride[],
+                    cs_real_t   *val[],
+                    cs_real_t   *f_val[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
 
-          for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-            const cs_lnum_t ic = i *_stride + c_id;
-            const cs_lnum_t jc = j *_stride + c_id;
-            w1[ic] += val[jc] * cell_vol[j];
-            w2[ic] += cell_vol[j];
-            w1[jc] += val[ic] * cell_vol[i];
-            w2[jc] += cell_vol[i];
-          }
+  /* Build or rebuild cached weights if needed */
 
-        }
+  if (_w_idx == NULL || _w_n_cells != mesh->n_cells) {
+    cs_les_filter_free();
+    _build_filter_weights();
+  }
 
-      }
+  /* Synchronize variables */
 
+  if (mesh->halo != NULL) {
+    for (int f_id = 0; f_id < n_f; f_id++) {
+      if (stride[f_id] == 1)
+        cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, val[f_id]);
+      else
+        cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED,
+                                 val[f_id], stride[f_id]);
     }
+  }
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_elts_l; i++)
-      f_val[i] = w1[i]/w2[i];
+  /* Apply filter (the stencil and weight arrays stay cache-resident
+     across the batched arrays) */
+
+  for (int f_id = 0; f_id < n_f; f_id++)
+    _apply_filter_weights(stride[f_id], val[f_id], f_val[f_id]);
 
-    /* Synchronize valiable */
+  /* Synchronize filtered variables */
 
-    if (mesh->halo != NULL)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, f_val, stride);
+  if (mesh->halo != NULL) {
+    for (int f_id = 0; f_id < n_f; f_id++) {
+      if (stride[f_id] == 1)
+        cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val[f_id]);
+      else
+        cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED,
+                                 f_val[f_id], stride[f_id]);
+    }
   }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the cached filter weights.
+ *
+ * This should be called when the mesh or cell volumes change (mesh
+ * modification, ALE, ...), so weights are rebuilt on the next filter
+ * application.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_free(void)
+{
+  BFT_FREE(_w_weight);
+  BFT_FREE(_w_cell);
+  BFT_FREE(_w_idx);
 
-  BFT_FREE(w2);
-  BFT_FREE(w1);
+  _w_n_cells = 0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -65,6 +65,35 @@ cs_les_filter(int        stride,
               cs_real_t  val[],
               cs_real_t  f_val[]);
 
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models for several arrays.
+ *
+ * This function behaves as cs_les_filter for each array, but traverses
+ * the cached filter stencil once with all arrays batched.
+ *
+ * parameters:
+ *   n_f     <--  number of arrays to filter
+ *   stride  <--  stride of each array to filter
+ *   val     <->  arrays of values to filter
+ *   f_val   -->  arrays of filtered values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int          n_f,
+                    const int    stride[],
+                    cs_real_t   *val[],
+                    cs_real_t   *f_val[]);
+
+/*----------------------------------------------------------------------------
+ * Free the cached filter weights.
+ *
+ * This should be called when the mesh or cell volumes change, so weights
+ * are rebuilt on the next filter application.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_free(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
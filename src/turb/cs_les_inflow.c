@@ -168,6 +168,22 @@ typedef struct _cs_inflow_batten_t {
   double        *amplitude_cos;          /* Amplitudes of the cosines         */
   double        *amplitude_sin;          /* Amplitudes of the sines           */
 
+  /* Cached per-point mode phases, advanced incrementally in time, so
+     the (points x modes) trigonometric evaluations are only needed when
+     the statistics at the inlet or the time increment change */
+
+  cs_lnum_t      n_points;               /* Number of cached points           */
+  double         time_cache;             /* Time of the cached phases         */
+  double         dt_cache;               /* Time increment of the cached
+                                            phase rotations                   */
+  double        *phase_cos;              /* Mode phase cosines
+                                            (n_points x n_modes)              */
+  double        *phase_sin;              /* Mode phase sines                  */
+  double        *rot_cos;                /* Per-step phase rotation cosines   */
+  double        *rot_sin;                /* Per-step phase rotation sines     */
+  double        *stats_cache;            /* Copy of the statistics the cached
+                                            phases are based on (7 per point) */
+
 } cs_inflow_batten_t;
 
 /* Synthetic Eddy Method (SEM) */
@@ -341,76 +357,207 @@ _batten_method(const cs_int_t       n_points,
 
   }
 
-  for (point_id = 0; point_id < n_points; point_id++) {
+  /* Check whether the cached mode phases are still usable: the spatial
+     part of the phases only depends on the statistics at the inlet */
 
-    double kinetic_energy;
+  const int  n_modes = inflow->n_modes;
 
-    double time_scale;
-    double velocity_scale;
-    double lenght_scale;
+  bool rebuild_phases = true;
 
-    double spectral_time;
-    double spectral_coordinates[3];
+  if (inflow->stats_cache != NULL && inflow->n_points == n_points) {
 
-    /*
-      Compute integral scales of turbulence :
-      -  Tb = k / epsilon
-      -  Vb = sqrt(k)
-      -  Lb = Tb * Vb     ( = k^(3/2) / epsilon )
-    */
+    rebuild_phases = false;
 
-    _TENSOR_TRACE_3D(kinetic_energy, reynolds_stresses + point_id*6);
-    kinetic_energy *= 0.5;
+    for (point_id = 0; point_id < n_points; point_id++) {
+      const double  *sc = inflow->stats_cache + point_id*7;
+      for (coo_id = 0; coo_id < 6; coo_id++) {
+        if (fabs(reynolds_stresses[point_id*6 + coo_id] - sc[coo_id]) > 0.)
+          rebuild_phases = true;
+      }
+      if (fabs(dissipation_rate[point_id] - sc[6]) > 0.)
+        rebuild_phases = true;
+      if (rebuild_phases)
+        break;
+    }
 
-    time_scale     = kinetic_energy / dissipation_rate[point_id];
-    velocity_scale = sqrt(kinetic_energy);
-    lenght_scale   = time_scale * velocity_scale;
+  }
 
-    /* Spectral position of the point in space and time */
+  if (rebuild_phases) {
 
-    spectral_time = two_pi * time / time_scale;
+    /* Compute the mode phases directly at the current time */
 
-    for (coo_id = 0; coo_id < 3; coo_id++)
-      spectral_coordinates[coo_id] =
-        two_pi * point_coordinates[point_id*3 + coo_id] / lenght_scale;
+    inflow->n_points = n_points;
 
-    /* Compute the velocity fluctuations */
+    BFT_REALLOC(inflow->phase_cos, n_points*n_modes, double);
+    BFT_REALLOC(inflow->phase_sin, n_points*n_modes, double);
+    BFT_REALLOC(inflow->rot_cos, n_points*n_modes, double);
+    BFT_REALLOC(inflow->rot_sin, n_points*n_modes, double);
+    BFT_REALLOC(inflow->stats_cache, n_points*7, double);
 
-    for (mode_id = 0; mode_id < inflow->n_modes; mode_id++) {
+#   pragma omp parallel for
+    for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
 
-      double spectral_velocity_scale = 0.;
-      double norm_wave_vector        = 0.;
-      double dxpot = 0.;
-      double mod_wave_vector[3];
+      double kinetic_energy;
 
-      _MODULE_3D(norm_wave_vector, wave_vector + mode_id*3);
+      double time_scale;
+      double velocity_scale;
+      double lenght_scale;
 
-      _INNER_PRODUCT_3D(spectral_velocity_scale,
-                        wave_vector + mode_id*3,
-                        reynolds_stresses + point_id*6,
-                        wave_vector + mode_id*3);
+      double spectral_time;
+      double spectral_coordinates[3];
 
-      spectral_velocity_scale = sqrt_three_half*sqrt(spectral_velocity_scale)
-        /norm_wave_vector;
+      double  *pc = inflow->phase_cos + p_id*n_modes;
+      double  *ps = inflow->phase_sin + p_id*n_modes;
+      double  *sc = inflow->stats_cache + p_id*7;
 
+      /*
+        Compute integral scales of turbulence :
+        -  Tb = k / epsilon
+        -  Vb = sqrt(k)
+        -  Lb = Tb * Vb     ( = k^(3/2) / epsilon )
+      */
 
-      for (coo_id = 0; coo_id < 3; coo_id++)
-        mod_wave_vector[coo_id] = wave_vector[mode_id*3 + coo_id]
-          * velocity_scale / spectral_velocity_scale;
+      _TENSOR_TRACE_3D(kinetic_energy, reynolds_stresses + p_id*6);
+      kinetic_energy *= 0.5;
 
-      _DOT_PRODUCT_3D(dxpot, mod_wave_vector, spectral_coordinates);
+      time_scale     = kinetic_energy / dissipation_rate[p_id];
+      velocity_scale = sqrt(kinetic_energy);
+      lenght_scale   = time_scale * velocity_scale;
 
-       dxpot += frequency[mode_id]*spectral_time;
+      /* Spectral position of the point in space and time */
 
-      for (coo_id = 0; coo_id < 3; coo_id++)
-        fluctuations[point_id*3 + coo_id] +=
-          amplitude_cos[mode_id*3 + coo_id]*cos(dxpot)
-          + amplitude_sin[mode_id*3 + coo_id]*sin(dxpot);
+      spectral_time = two_pi * time / time_scale;
+
+      for (int c_id = 0; c_id < 3; c_id++)
+        spectral_coordinates[c_id] =
+          two_pi * point_coordinates[p_id*3 + c_id] / lenght_scale;
+
+      for (int mode = 0; mode < n_modes; mode++) {
+
+        double spectral_velocity_scale = 0.;
+        double norm_wave_vector        = 0.;
+        double dxpot = 0.;
+        double mod_wave_vector[3];
+
+        _MODULE_3D(norm_wave_vector, wave_vector + mode*3);
+
+        _INNER_PRODUCT_3D(spectral_velocity_scale,
+                          wave_vector + mode*3,
+                          reynolds_stresses + p_id*6,
+                          wave_vector + mode*3);
+
+        spectral_velocity_scale = sqrt_three_half*sqrt(spectral_velocity_scale)
+          /norm_wave_vector;
+
+        for (int c_id = 0; c_id < 3; c_id++)
+          mod_wave_vector[c_id] = wave_vector[mode*3 + c_id]
+            * velocity_scale / spectral_velocity_scale;
+
+        _DOT_PRODUCT_3D(dxpot, mod_wave_vector, spectral_coordinates);
+
+        dxpot += frequency[mode]*spectral_time;
+
+        pc[mode] = cos(dxpot);
+        ps[mode] = sin(dxpot);
+
+      }
+
+      for (int c_id = 0; c_id < 6; c_id++)
+        sc[c_id] = reynolds_stresses[p_id*6 + c_id];
+      sc[6] = dissipation_rate[p_id];
 
     }
 
-    for (coo_id = 0; coo_id < 3; coo_id++)
-      fluctuations[point_id*3 + coo_id] *= sqrt_two_by_n_modes;
+    inflow->dt_cache = -1.;  /* cached rotations now stale */
+
+  }
+  else {
+
+    const double dt = time - inflow->time_cache;
+
+    if (!(fabs(dt - inflow->dt_cache) < 1.e-12*fabs(dt))) {
+
+      /* Recompute the per-step phase rotations for the new increment */
+
+#     pragma omp parallel for
+      for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+        double kinetic_energy;
+
+        double  *rc = inflow->rot_cos + p_id*n_modes;
+        double  *rs = inflow->rot_sin + p_id*n_modes;
+
+        _TENSOR_TRACE_3D(kinetic_energy, reynolds_stresses + p_id*6);
+        kinetic_energy *= 0.5;
+
+        const double theta
+          = two_pi * dt * dissipation_rate[p_id] / kinetic_energy;
+
+        for (int mode = 0; mode < n_modes; mode++) {
+          rc[mode] = cos(frequency[mode]*theta);
+          rs[mode] = sin(frequency[mode]*theta);
+        }
+
+      }
+
+      inflow->dt_cache = dt;
+
+    }
+
+    /* Advance the cached phases by one time increment; the slight
+       amplitude drift of the recurrence is corrected by a first order
+       renormalization */
+
+#   pragma omp parallel for
+    for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+      double  *pc = inflow->phase_cos + p_id*n_modes;
+      double  *ps = inflow->phase_sin + p_id*n_modes;
+      const double  *rc = inflow->rot_cos + p_id*n_modes;
+      const double  *rs = inflow->rot_sin + p_id*n_modes;
+
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (int mode = 0; mode < n_modes; mode++) {
+        double c = pc[mode]*rc[mode] - ps[mode]*rs[mode];
+        double s = ps[mode]*rc[mode] + pc[mode]*rs[mode];
+        double w = 1.5 - 0.5*(c*c + s*s);
+        pc[mode] = c*w;
+        ps[mode] = s*w;
+      }
+
+    }
+
+  }
+
+  inflow->time_cache = time;
+
+  /* Batched accumulation of the fluctuations from the cached phases */
+
+# pragma omp parallel for
+  for (cs_lnum_t p_id = 0; p_id < n_points; p_id++) {
+
+    const double  *pc = inflow->phase_cos + p_id*n_modes;
+    const double  *ps = inflow->phase_sin + p_id*n_modes;
+
+    double f0 = 0., f1 = 0., f2 = 0.;
+
+#   if defined(HAVE_OPENMP_SIMD)
+#     pragma omp simd reduction(+:f0, f1, f2)
+#   endif
+    for (int mode = 0; mode < n_modes; mode++) {
+      f0 +=   amplitude_cos[mode*3    ]*pc[mode]
+            + amplitude_sin[mode*3    ]*ps[mode];
+      f1 +=   amplitude_cos[mode*3 + 1]*pc[mode]
+            + amplitude_sin[mode*3 + 1]*ps[mode];
+      f2 +=   amplitude_cos[mode*3 + 2]*pc[mode]
+            + amplitude_sin[mode*3 + 2]*ps[mode];
+    }
+
+    fluctuations[p_id*3    ] += f0*sqrt_two_by_n_modes;
+    fluctuations[p_id*3 + 1] += f1*sqrt_two_by_n_modes;
+    fluctuations[p_id*3 + 2] += f2*sqrt_two_by_n_modes;
 
   }
 }
@@ -1155,6 +1302,15 @@ _cs_inflow_add_inlet(cs_inflow_type_t   type,
       BFT_MALLOC(inflow->amplitude_cos, 3*inflow->n_modes, double);
       BFT_MALLOC(inflow->amplitude_sin, 3*inflow->n_modes, double);
 
+      inflow->n_points = 0;
+      inflow->time_cache = -HUGE_VAL;
+      inflow->dt_cache = -1.;
+      inflow->phase_cos = NULL;
+      inflow->phase_sin = NULL;
+      inflow->rot_cos = NULL;
+      inflow->rot_sin = NULL;
+      inflow->stats_cache = NULL;
+
       inlet->inflow = inflow;
     }
     break;
@@ -2306,6 +2462,14 @@ cs_inflow_finalize(void)
         BFT_FREE(inflow->amplitude_cos);
         BFT_FREE(inflow->amplitude_sin);
 
+        inflow->n_points = 0;
+
+        BFT_FREE(inflow->phase_cos);
+        BFT_FREE(inflow->phase_sin);
+        BFT_FREE(inflow->rot_cos);
+        BFT_FREE(inflow->rot_sin);
+        BFT_FREE(inflow->stats_cache);
+
         BFT_FREE(inflow);
 
         inlet->inflow = NULL;
@@ -327,6 +327,8 @@ cs_user_linear_solvers(void)
    *  CS_SLES_GMRES               (generalized minimal residual)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
+   *  CS_SLES_P_MC_GAUSS_SEIDEL   (process-local multicolor Gauss-Seidel)
+   *  CS_SLES_P_MC_SYM_GAUSS_SEIDEL (multicolor symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
@@ -0,0 +1,653 @@
+/*
+  This file is part of Code_Saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2019 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Performance regression check.
+ *
+ * This program runs calibrated benchmarks of a few key kernels (sparse
+ * matrix-vector products for the main matrix formats, BLAS operations,
+ * and a gradient-type face gather loop) on a generated structured mesh,
+ * and compares the measured times against a stored per-machine baseline.
+ *
+ * It is run through the "perf-check" make target. On the first run,
+ * a baseline file is written; on subsequent runs, kernels slower than
+ * the baseline by more than a given tolerance are reported as
+ * regressions and the program exits with a nonzero status.
+ *
+ * The following environment variables may adjust the behavior:
+ *   CS_PERF_CHECK_BASELINE   path of baseline file
+ *                            (default: cs_perf_check.baseline)
+ *   CS_PERF_CHECK_TOLERANCE  relative tolerance (default: 0.15)
+ *   CS_PERF_CHECK_SIZE       cells per mesh direction (default: 32)
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_mem_usage.h"
+#include "bft_printf.h"
+
+#include "cs_system_info.h"
+
+#include "cs_blas.h"
+#include "cs_defs.h"
+#include "cs_timer.h"
+
+#include "cs_matrix.h"
+
+/*----------------------------------------------------------------------------*/
+
+/* Maximum number of benchmarked kernels */
+
+#define CS_PERF_CHECK_N_KERNELS_MAX 16
+
+/* Recorded results */
+
+static int _n_kernels = 0;
+static char _kernel_name[CS_PERF_CHECK_N_KERNELS_MAX][32];
+static double _kernel_time[CS_PERF_CHECK_N_KERNELS_MAX];
+
+/* Guard against dead-code elimination of benchmark loops */
+
+static double _check_sum = 0.0;
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Analysis of environment variables to determine
+ * if we require MPI, and initialization if necessary.
+ *----------------------------------------------------------------------------*/
+
+static void
+_mpi_init(void)
+{
+  int flag = 0;
+  bool use_mpi = false;
+
+#if   defined(__bg__) || defined(__CRAYXT_COMPUTE_LINUX_TARGET)
+
+  use_mpi = true;
+
+#elif defined(MPICH2) || defined(MPICH)
+  if (getenv("PMI_RANK") != NULL)
+    use_mpi = true;
+
+#elif defined(OPEN_MPI)
+  if (getenv("OMPI_COMM_WORLD_RANK") != NULL)    /* OpenMPI 1.3 and above */
+    use_mpi = true;
+
+#endif /* Tests for known MPI variants */
+
+  /* If we have determined from known MPI environment variables
+     of command line arguments that we are running under MPI,
+     initialize MPI */
+
+  if (use_mpi == true) {
+
+    MPI_Initialized(&flag);
+
+    if (!flag) {
+#if defined(MPI_VERSION) && (MPI_VERSION >= 2) && defined(HAVE_OPENMP)
+      int mpi_threads;
+      MPI_Init_thread(NULL, NULL, MPI_THREAD_FUNNELED, &mpi_threads);
+#else
+      MPI_Init(NULL, NULL);
+#endif
+    }
+
+    cs_glob_mpi_comm = MPI_COMM_WORLD;
+    MPI_Comm_size(cs_glob_mpi_comm, &cs_glob_n_ranks);
+    MPI_Comm_rank(cs_glob_mpi_comm, &cs_glob_rank_id);
+
+  }
+
+}
+
+#endif /* HAVE_MPI */
+
+/*----------------------------------------------------------------------------
+ * Record the mean time per call of a benchmarked kernel.
+ *
+ * In parallel, the maximum over ranks is recorded, so that all ranks
+ * compare the same value against the baseline.
+ *
+ * parameters:
+ *   name <-- kernel name (used as baseline file key)
+ *   wt   <-- mean wall-clock time per call, in seconds
+ *----------------------------------------------------------------------------*/
+
+static void
+_record_kernel(const char  *name,
+               double       wt)
+{
+  assert(_n_kernels < CS_PERF_CHECK_N_KERNELS_MAX);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    double wt_max = wt;
+    MPI_Allreduce(&wt, &wt_max, 1, MPI_DOUBLE, MPI_MAX, cs_glob_mpi_comm);
+    wt = wt_max;
+  }
+#endif
+
+  strncpy(_kernel_name[_n_kernels], name, 31);
+  _kernel_name[_n_kernels][31] = '\0';
+  _kernel_time[_n_kernels] = wt;
+  _n_kernels += 1;
+
+  bft_printf("  %-24s %12.5e s/call\n", name, wt);
+}
+
+/*----------------------------------------------------------------------------
+ * Build a structured (n x n x n) hexahedral mesh graph.
+ *
+ * Only the cell -> cell adjacency (one edge per interior face) is
+ * built, as this is what the matrix and face loop benchmarks require.
+ *
+ * parameters:
+ *   n       <-- number of cells per direction
+ *   edges   --> allocated interior face -> cells connectivity
+ *
+ * returns:
+ *   number of edges (interior faces)
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_build_mesh(cs_lnum_t       n,
+            cs_lnum_2_t   **edges)
+{
+  cs_lnum_t n_edges = 3*n*n*(n-1);
+  cs_lnum_2_t *_edges = NULL;
+
+  BFT_MALLOC(_edges, n_edges, cs_lnum_2_t);
+
+  cs_lnum_t j = 0;
+  for (cs_lnum_t k = 0; k < n; k++) {
+    for (cs_lnum_t jj = 0; jj < n; jj++) {
+      for (cs_lnum_t ii = 0; ii < n; ii++) {
+        cs_lnum_t c_id = (k*n + jj)*n + ii;
+        if (ii + 1 < n) {
+          _edges[j][0] = c_id; _edges[j][1] = c_id + 1; j++;
+        }
+        if (jj + 1 < n) {
+          _edges[j][0] = c_id; _edges[j][1] = c_id + n; j++;
+        }
+        if (k + 1 < n) {
+          _edges[j][0] = c_id; _edges[j][1] = c_id + n*n; j++;
+        }
+      }
+    }
+  }
+
+  assert(j == n_edges);
+
+  *edges = _edges;
+
+  return n_edges;
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark the sparse matrix-vector product for a given matrix type.
+ *
+ * The same multiply variants as those compared by the matrix tuning
+ * mechanism are exercised here, one matrix format at a time.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure
+ *   type      <-- matrix type
+ *   name      <-- kernel name for the baseline file
+ *   n_cells   <-- number of cells
+ *   n_edges   <-- number of interior faces
+ *   edges     <-- interior face -> cells connectivity
+ *   da        <-- diagonal coefficients
+ *   xa        <-- extra-diagonal coefficients (symmetric)
+ *----------------------------------------------------------------------------*/
+
+static void
+_spmv_test(double               t_measure,
+           cs_matrix_type_t     type,
+           const char          *name,
+           cs_lnum_t            n_cells,
+           cs_lnum_t            n_edges,
+           const cs_lnum_2_t   *edges,
+           const cs_real_t     *da,
+           const cs_real_t     *xa)
+{
+  int run_id = 0, n_runs = 8;
+  double wt0, wt1;
+
+  cs_matrix_structure_t *ms = cs_matrix_structure_create(type,
+                                                         true,
+                                                         n_cells,
+                                                         n_cells,
+                                                         n_edges,
+                                                         edges,
+                                                         NULL,
+                                                         NULL);
+
+  cs_matrix_t *m = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(m, true, NULL, NULL, n_edges, edges, da, xa);
+
+  cs_real_t *x = NULL, *y = NULL;
+  BFT_MALLOC(x, n_cells, cs_real_t);
+  BFT_MALLOC(y, n_cells, cs_real_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+    x[ii] = 1.0 + ii%10;
+
+  /* First call excluded from timing (setup, cache warming) */
+
+  cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, y);
+
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+
+  while (run_id < n_runs) {
+    while (run_id < n_runs) {
+      cs_matrix_vector_multiply(CS_HALO_ROTATION_COPY, m, x, y);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  _check_sum += y[n_cells/2];
+
+  _record_kernel(name, (wt1 - wt0)/n_runs);
+
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  cs_matrix_release_coefficients(m);
+  cs_matrix_destroy(&m);
+  cs_matrix_structure_destroy(&ms);
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark local BLAS operations (dot product and y <- alpha.x + y).
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure
+ *   n         <-- array size
+ *----------------------------------------------------------------------------*/
+
+static void
+_blas_test(double     t_measure,
+           cs_lnum_t  n)
+{
+  int run_id, n_runs;
+  double wt0, wt1;
+
+  cs_real_t *x = NULL, *y = NULL;
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(y, n, cs_real_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n; ii++) {
+    x[ii] = (ii%10 + 1)*0.1;
+    y[ii] = (ii%10 - 3)*0.2;
+  }
+
+  /* Dot product */
+
+  run_id = 0, n_runs = 16;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+
+  while (run_id < n_runs) {
+    while (run_id < n_runs) {
+      _check_sum += cs_dot(n, x, y) / n_runs;
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  _record_kernel("blas_dot_xy", (wt1 - wt0)/n_runs);
+
+  /* y <- alpha.x + y */
+
+  run_id = 0, n_runs = 16;
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+
+  while (run_id < n_runs) {
+    double alpha = 1.0/n_runs;
+    while (run_id < n_runs) {
+      cs_axpy(n, alpha, x, y);
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  _check_sum += y[n/2];
+
+  _record_kernel("blas_axpy", (wt1 - wt0)/n_runs);
+
+  BFT_FREE(y);
+  BFT_FREE(x);
+}
+
+/*----------------------------------------------------------------------------
+ * Benchmark a gradient-type face gather loop.
+ *
+ * This reproduces the memory access pattern of gradient reconstruction
+ * and right-hand side assembly: loop on interior faces, gathering cell
+ * values and scattering face contributions back to both cells.
+ *
+ * parameters:
+ *   t_measure <-- minimum time for each measure
+ *   n_cells   <-- number of cells
+ *   n_edges   <-- number of interior faces
+ *   edges     <-- interior face -> cells connectivity
+ *----------------------------------------------------------------------------*/
+
+static void
+_face_gather_test(double               t_measure,
+                  cs_lnum_t            n_cells,
+                  cs_lnum_t            n_edges,
+                  const cs_lnum_2_t   *edges)
+{
+  int run_id = 0, n_runs = 8;
+  double wt0, wt1;
+
+  cs_real_t *x = NULL, *y = NULL, *w = NULL;
+  BFT_MALLOC(x, n_cells, cs_real_t);
+  BFT_MALLOC(y, n_cells, cs_real_t);
+  BFT_MALLOC(w, n_edges, cs_real_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+    x[ii] = (ii%10 + 1)*0.1;
+    y[ii] = 0.0;
+  }
+# pragma omp parallel for
+  for (cs_lnum_t f_id = 0; f_id < n_edges; f_id++)
+    w[f_id] = 0.5 + (f_id%3)*0.25;
+
+  wt0 = cs_timer_wtime(), wt1 = wt0;
+
+  while (run_id < n_runs) {
+    while (run_id < n_runs) {
+      for (cs_lnum_t f_id = 0; f_id < n_edges; f_id++) {
+        cs_lnum_t ii = edges[f_id][0];
+        cs_lnum_t jj = edges[f_id][1];
+        cs_real_t pfac = w[f_id] * (x[jj] - x[ii]);
+        y[ii] += pfac;
+        y[jj] -= pfac;
+      }
+      run_id++;
+    }
+    wt1 = cs_timer_wtime();
+    if (wt1 - wt0 < t_measure)
+      n_runs *= 2;
+  }
+
+  _check_sum += y[n_cells/2];
+
+  _record_kernel("face_gather", (wt1 - wt0)/n_runs);
+
+  BFT_FREE(w);
+  BFT_FREE(y);
+  BFT_FREE(x);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare recorded kernel times with the stored baseline.
+ *
+ * If the baseline file does not exist, it is created from the current
+ * measures and the check passes. Otherwise, each kernel present in the
+ * baseline is compared, and kernels slower than baseline*(1 + tolerance)
+ * are counted as regressions. Kernels faster than baseline*(1 - tolerance)
+ * are reported, as the baseline should probably be updated.
+ *
+ * parameters:
+ *   path      <-- baseline file path
+ *   tolerance <-- allowed relative slowdown
+ *
+ * returns:
+ *   number of regressions detected
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_baseline(const char  *path,
+                  double       tolerance)
+{
+  int n_regressions = 0;
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+
+      /* No baseline yet: record one */
+
+      f = fopen(path, "w");
+      if (f == NULL)
+        bft_error(__FILE__, __LINE__, 0,
+                  "Unable to create baseline file \"%s\".", path);
+
+      fprintf(f, "# cs_perf_check baseline"
+              " (kernel name, mean seconds per call)\n");
+      for (int i = 0; i < _n_kernels; i++)
+        fprintf(f, "%s %14.7e\n", _kernel_name[i], _kernel_time[i]);
+
+      fclose(f);
+
+      bft_printf("\nNo baseline found; wrote \"%s\".\n", path);
+
+    }
+    else {
+
+      char line[128];
+      char name[64];
+      double wt_base;
+
+      bft_printf("\nComparison with baseline \"%s\""
+                 " (tolerance %4.0f%%):\n\n",
+                 path, tolerance*100.);
+
+      while (fgets(line, 128, f) != NULL) {
+
+        if (line[0] == '#')
+          continue;
+        if (sscanf(line, "%63s %le", name, &wt_base) != 2)
+          continue;
+
+        int i = 0;
+        while (i < _n_kernels && strcmp(name, _kernel_name[i]) != 0)
+          i++;
+        if (i >= _n_kernels) {
+          bft_printf("  %-24s not measured (ignored)\n", name);
+          continue;
+        }
+
+        double r = (_kernel_time[i] - wt_base) / wt_base;
+
+        if (r > tolerance) {
+          bft_printf("  %-24s REGRESSION: %+6.1f%%"
+                     " (%12.5e -> %12.5e s)\n",
+                     name, r*100., wt_base, _kernel_time[i]);
+          n_regressions += 1;
+        }
+        else if (r < -tolerance)
+          bft_printf("  %-24s improved:   %+6.1f%%"
+                     " (consider updating baseline)\n",
+                     name, r*100.);
+        else
+          bft_printf("  %-24s ok:         %+6.1f%%\n", name, r*100.);
+
+      }
+
+      fclose(f);
+
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Bcast(&n_regressions, 1, MPI_INT, 0, cs_glob_mpi_comm);
+#endif
+
+  return n_regressions;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  double t_measure = 0.5;
+  double tolerance = 0.15;
+  cs_lnum_t mesh_size = 32;
+
+  const char *baseline_path = "cs_perf_check.baseline";
+
+  /* Internationalization */
+
+#ifdef HAVE_SETLOCALE
+  if (!setlocale (LC_ALL,"")) {
+#if defined (DEBUG)
+     bft_printf("locale not supported by C library"
+                " or bad LANG environment variable");
+#endif
+  }
+#endif /* HAVE_SETLOCALE */
+
+  /* Initialization and environment */
+
+#if defined(HAVE_MPI)
+  _mpi_init();
+#endif
+
+  if (getenv("CS_PERF_CHECK_BASELINE") != NULL)
+    baseline_path = getenv("CS_PERF_CHECK_BASELINE");
+  if (getenv("CS_PERF_CHECK_TOLERANCE") != NULL)
+    tolerance = atof(getenv("CS_PERF_CHECK_TOLERANCE"));
+  if (getenv("CS_PERF_CHECK_SIZE") != NULL)
+    mesh_size = atoi(getenv("CS_PERF_CHECK_SIZE"));
+
+  if (tolerance <= 0. || mesh_size < 2)
+    bft_error(__FILE__, __LINE__, 0,
+              "Invalid tolerance (%g) or mesh size (%d).",
+              tolerance, (int)mesh_size);
+
+  bft_mem_init(NULL);
+
+  (void)cs_timer_wtime();
+
+#if defined(HAVE_MPI)
+  cs_system_info(cs_glob_mpi_comm);
+#else
+  cs_system_info();
+#endif
+
+  /* Build mesh graph and matrix coefficients */
+
+  cs_lnum_t n_cells = mesh_size*mesh_size*mesh_size;
+  cs_lnum_2_t *edges = NULL;
+  cs_lnum_t n_edges = _build_mesh(mesh_size, &edges);
+
+  cs_real_t *da = NULL, *xa = NULL;
+  BFT_MALLOC(da, n_cells, cs_real_t);
+  BFT_MALLOC(xa, n_edges, cs_real_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++)
+    da[ii] = 6.0 + (ii%10)*0.01;
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < n_edges; ii++)
+    xa[ii] = -1.0;
+
+  bft_printf("\nPerformance check on %d^3 cells (%d interior faces):\n\n",
+             (int)mesh_size, (int)n_edges);
+
+  /* Run benchmarks */
+
+  _spmv_test(t_measure, CS_MATRIX_NATIVE, "spmv_native",
+             n_cells, n_edges, edges, da, xa);
+  _spmv_test(t_measure, CS_MATRIX_CSR, "spmv_csr",
+             n_cells, n_edges, edges, da, xa);
+  _spmv_test(t_measure, CS_MATRIX_MSR, "spmv_msr",
+             n_cells, n_edges, edges, da, xa);
+
+  _blas_test(t_measure, n_cells);
+
+  _face_gather_test(t_measure, n_cells, n_edges, edges);
+
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  if (isnan(_check_sum))
+    bft_printf("check_sum is NaN\n");
+
+  /* Compare with baseline */
+
+  int n_regressions = _compare_baseline(baseline_path, tolerance);
+
+  if (cs_glob_rank_id < 1) {
+    if (n_regressions > 0)
+      bft_printf("\nperf-check: FAILED (%d regression(s))\n", n_regressions);
+    else
+      bft_printf("\nperf-check: passed\n");
+  }
+
+  /* Finalize */
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag;
+    MPI_Initialized(&mpi_flag);
+    if (mpi_flag != 0)
+      MPI_Finalize();
+  }
+#endif /* HAVE_MPI */
+
+  if (n_regressions > 0)
+    exit(EXIT_FAILURE);
+
+  exit (EXIT_SUCCESS);
+}